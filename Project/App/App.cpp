@@ -6,8 +6,26 @@
 void App::Initialize()
 {
 	Renderer::Initizlie();
+
+	// render worker core  Ƿ ݸ.
+	UINT physicalCoreCount = 0;
+	UINT logicalCoreCount = 0;
+	GetPhysicalCoreCount(&physicalCoreCount, &logicalCoreCount);
+	UINT loaderThreadCount = physicalCoreCount / 2;
+	if (loaderThreadCount < 1)
+	{
+		loaderThreadCount = 1;
+	}
+	if (loaderThreadCount > MAX_ASSET_LOAD_WORKER_COUNT)
+	{
+		loaderThreadCount = MAX_ASSET_LOAD_WORKER_COUNT;
+	}
+	m_AssetLoader.Initialize(this, loaderThreadCount);
+
 	initExternalData();
 
+	m_AnimationLODManager.Initialize(AnimationLODSettings());
+
 	m_pRenderObjects = &m_RenderObjects;
 	m_pLights = &m_Lights;
 	m_pLightSpheres = &m_LightSpheres;
@@ -60,8 +78,14 @@ int App::Run()
 			{
 				s_PrevFrameCheckTick = curTick;
 
-				WCHAR txt[64];
-				swprintf_s(txt, 64, L"DX12  %uFPS", s_FrameCount);
+				WCHAR txt[128];
+#ifdef USE_MULTI_THREAD
+				// pass   ұ(max / ).
+				swprintf_s(txt, 128, L"DX12  %uFPS  imbalance(shadow %.2f, object %.2f, mirror %.2f)", s_FrameCount,
+						   GetRenderPassImbalance(RenderPass_Shadow), GetRenderPassImbalance(RenderPass_Object), GetRenderPassImbalance(RenderPass_Mirror));
+#else
+				swprintf_s(txt, 128, L"DX12  %uFPS", s_FrameCount);
+#endif
 				SetWindowText(m_hMainWindow, txt);
 
 				s_FrameCount = 0;
@@ -76,31 +100,65 @@ void App::Update(const float DELTA_TIME)
 {
 	Renderer::Update(DELTA_TIME);
 
-	int state = 0;
-	int frame = 0;
-	bool bEndEffectorUpdateFlag = true;
+	// ε尡  asset ø scene ߰.  ĳʹ ̹ frame update.
+	m_AssetLoader.Update(MAX_ASSET_UPLOAD_PER_FRAME);
+
+	if (m_CharacterUpdateStates.size() != m_Characters.size())
+	{
+		const UINT64 PREV_SIZE = m_CharacterUpdateStates.size();
+		CharacterUpdateState initialState = {};
+		m_CharacterUpdateStates.resize(m_Characters.size(), initialState);
+
+		for (UINT64 i = PREV_SIZE, size = m_Characters.size(); i < size; ++i)
+		{
+			m_CharacterUpdateStates[i].Locomotion.Initialize(LOCOMOTION_FIXED_STEP, MAX_LOCOMOTION_STEP_PER_FRAME, m_Characters[i]->CharacterAnimationData.Position);
+		}
+	}
+
+	// Ű Է Ƿ main .
+	// LOD ī޶  frame ĳ ġ . IK ǳʶٸ  target raycast .
+	const Vector3 EYE_POS = GetCamera()->GetEyePos();
+	m_AnimationLODManager.BeginFrame();
 	for (UINT64 i = 0, size = m_Characters.size(); i < size; ++i)
 	{
-		SkinnedMeshModel* pCharacter = m_Characters[i];
-		
-		Vector3 deltaPos;
-		updateAnimationState(pCharacter, DELTA_TIME, &state, &frame, &deltaPos, &bEndEffectorUpdateFlag);
-		simulateCharacterContol(pCharacter, deltaPos, DELTA_TIME, state, frame, &bEndEffectorUpdateFlag);
+		CharacterUpdateState* pUpdateState = &m_CharacterUpdateStates[i];
+		pUpdateState->bEndEffectorUpdate = true;
+		updateAnimationState(m_Characters[i], pUpdateState, DELTA_TIME);
+
+		m_AnimationLODManager.SelectLOD(EYE_POS, m_Characters[i]->CharacterAnimationData.Position, (UINT)i, &pUpdateState->LOD);
+		if (!pUpdateState->LOD.bSolveIK)
+		{
+			pUpdateState->bEndEffectorUpdate = false;
+		}
+	}
+
+	runCharacterJobs(characterPoseJob, DELTA_TIME);
+
+	// PhysX controller ̵, raycast main .
+	for (UINT64 i = 0, size = m_Characters.size(); i < size; ++i)
+	{
+		simulateCharacterContol(m_Characters[i], &m_CharacterUpdateStates[i], DELTA_TIME);
 	}
 
 	m_pPhysicsManager->Update(DELTA_TIME);
 
 	for (UINT64 i = 0, size = m_Characters.size(); i < size; ++i)
 	{
-		SkinnedMeshModel* pCharacter = m_Characters[i];
+		SkinnedMeshModel::JointUpdateInfo* pUpdateInfo = &m_CharacterUpdateStates[i].UpdateInfo;
+		ZeroMemory(pUpdateInfo, sizeof(SkinnedMeshModel::JointUpdateInfo));
+		if (m_CharacterUpdateStates[i].LOD.bSolveIK)
+		{
+			updateEndEffectorPosition(m_Characters[i], pUpdateInfo);
+		}
+	}
 
-		SkinnedMeshModel::JointUpdateInfo updateInfo;
-		ZeroMemory(&updateInfo, sizeof(SkinnedMeshModel::JointUpdateInfo));
-		updateEndEffectorPosition(pCharacter, &updateInfo);
+	runCharacterJobs(characterAnimationJob, DELTA_TIME);
 
-		Matrix newWorld = Matrix::CreateFromQuaternion(m_pCharacter->CharacterAnimationData.Rotation) * Matrix::CreateTranslation(m_pCharacter->CharacterAnimationData.Position);
-		pCharacter->UpdateWorld(newWorld);
-		pCharacter->UpdateAnimation(state, frame, DELTA_TIME, &updateInfo);
+	for (UINT64 i = 0, size = m_Characters.size(); i < size; ++i)
+	{
+		const CharacterUpdateState& UPDATE_STATE = m_CharacterUpdateStates[i];
+		const bool bIK_SKIPPED = (UPDATE_STATE.ClipID == 0 && !UPDATE_STATE.LOD.bSolveIK);
+		m_AnimationLODManager.AddCharacterStats(UPDATE_STATE.LOD, m_Characters[i]->CharacterAnimationData.GetEvaluatedBoneCount(), bIK_SKIPPED);
 	}
 
 	for (UINT64 i = 0, size = m_RenderObjects.size(); i < size; ++i)
@@ -128,6 +186,10 @@ void App::Update(const float DELTA_TIME)
 
 void App::Cleanup()
 {
+	//  д  asset . ؽ ref Ƿ TextureManager  .
+	m_AssetLoader.Cleanup();
+	m_SceneModelLoadCount = 0;
+
 	Fence();
 	for (UINT i = 0; i < SWAP_CHAIN_FRAME_COUNT; ++i)
 	{
@@ -272,7 +334,6 @@ void App::initExternalData()
 
 	// ٴ(ſ).
 	{
-		Model* pGround = nullptr;
 		MeshInfo mesh = INIT_MESH_INFO;
 		MakeSquare(&mesh, 10.0f);
 
@@ -291,23 +352,10 @@ void App::initExternalData()
 		mesh.szNormalTextureFileName = path + L"patterned_wooden_wall_panels_48_05_normal.jpg";
 		mesh.szRoughnessTextureFileName = path + L"patterned_wooden_wall_panels_48_05_roughness.jpg";*/
 
-		pGround = new Model;
-		pGround->Initialize(this, { mesh });
-
-		MaterialConstant& groundMaterialConstantData = pGround->Meshes[0]->MaterialConstantData;
-		groundMaterialConstantData.AlbedoFactor = Vector3(0.7f);
-		groundMaterialConstantData.EmissionFactor = Vector3(0.0f);
-		groundMaterialConstantData.MetallicFactor = 0.5f;
-		groundMaterialConstantData.RoughnessFactor = 0.3f;
-
+		// ٴڿ ſó ݻ . ׸  . m_pMirror ε尡  .
 		Vector3 position = Vector3(0.0f);
-		pGround->UpdateWorld(Matrix::CreateRotationX(DirectX::XM_PI * 0.5f) * Matrix::CreateTranslation(position));
-		pGround->bCastShadow = false; // ٴ ׸  .
-
+		loadSceneModel(mesh, "Ground", Matrix::CreateRotationX(DirectX::XM_PI * 0.5f) * Matrix::CreateTranslation(position), RenderObjectType_MirrorType, false);
 		m_MirrorPlane = DirectX::SimpleMath::Plane(position, Vector3(0.0f, 1.0f, 0.0f));
-		m_pMirror = pGround; // ٴڿ ſó ݻ .
-		pGround->ModelType = RenderObjectType_MirrorType;
-		m_RenderObjects.push_back(pGround);
 
 		physx::PxRigidStatic* pGroundPlane = physx::PxCreatePlane(*pPhysics, physx::PxPlane(0.0f, 1.0f, 0.0f, 0.0f), *(m_pPhysicsManager->pCommonMaterial));
 		{
@@ -331,190 +379,25 @@ void App::initExternalData()
 	}
 
 	// Main Object.
+	//  FBX ״θ cook   mapؼ import  ü ǳʶ.
 	{
-		HRESULT hr = S_OK;
-
-		std::wstring path = L"./Assets/";
-		// std::wstring path = L"./Assets/other2/";
-		std::vector<std::wstring> clipNames =
+		AssetLoadDesc characterDesc;
+		characterDesc.Type = AssetType_Character;
+		characterDesc.BasePath = L"./Assets/";
+		// characterDesc.BasePath = L"./Assets/other2/";
+		characterDesc.FileName = L"Remy.fbx";
+		// characterDesc.FileName = L"character.fbx";
+		characterDesc.ClipNames =
 		{
 			L"CatwalkIdleTwistL.fbx", L"CatwalkIdleToWalkForward.fbx",
 			L"CatwalkWalkForward.fbx", L"CatwalkWalkStopTwistL.fbx",
 		};
-
-		std::wstring filename = L"Remy.fbx";
-		// std::wstring filename = L"character.fbx";
-		std::vector<MeshInfo> characterMeshInfo;
-		AnimationData characterDefaultAnimData;
-		hr = ReadFromFile(characterMeshInfo, &characterDefaultAnimData, path, filename);
-		BREAK_IF_FAILED(hr);
-
-		// ִϸ̼ Ŭ.
-		if (clipNames.size() > 0)
-		{
-			characterDefaultAnimData.Clips.clear();
-		}
-		for (UINT64 i = 0, size = clipNames.size(); i < size; ++i)
-		{
-			std::wstring& name = clipNames[i];
-			AnimationData animDataInClip;
-
-			hr = ReadAnimationFromFile(&animDataInClip, path, name);
-			BREAK_IF_FAILED(hr);
-
-			animDataInClip.Clips[0].Name.assign(name.begin(), name.end());
-			characterDefaultAnimData.Clips.push_back(animDataInClip.Clips[0]);
-		}
-
-		m_pCharacter = new SkinnedMeshModel;
-		m_pCharacter->Initialize(this, characterMeshInfo, characterDefaultAnimData);
-
-		Vector3 position(0.0f, 0.47f, 2.0f);
-		for (UINT64 i = 0, size = m_pCharacter->Meshes.size(); i < size; ++i)
-		{
-			Mesh* pCurMesh = m_pCharacter->Meshes[i];
-			MaterialConstant& materialConstantData = pCurMesh->MaterialConstantData;
-			materialConstantData.AlbedoFactor = Vector3(1.0f);
-			materialConstantData.RoughnessFactor = 0.8f;
-			materialConstantData.MetallicFactor = 0.0f;
-		}
-		m_pCharacter->Name = "MainCharacter";
-		m_pCharacter->bIsPickable = true;
-		m_pCharacter->UpdateWorld(Matrix::CreateTranslation(position));
-		m_pCharacter->CharacterAnimationData.Position = position;
-		m_RenderObjects.push_back((Model*)m_pCharacter);
-		m_Characters.push_back(m_pCharacter);
-
-
-		physx::PxControllerManager* pControlManager = m_pPhysicsManager->GetControllerManager();
-		physx::PxCapsuleController* pController = nullptr;
-
-		// capsule ޽ö ϰ .
-		physx::PxCapsuleControllerDesc capsuleDesc;
-		capsuleDesc.height = (m_pCharacter->BoundingSphere.Radius * 1.2f) - 0.3f;
-		capsuleDesc.radius = 0.15f;
-		capsuleDesc.upDirection = physx::PxVec3(0.0f, 1.0f, 0.0f);
-		capsuleDesc.position = physx::PxExtendedVec3(m_pCharacter->CharacterAnimationData.Position.x, m_pCharacter->CharacterAnimationData.Position.y, m_pCharacter->CharacterAnimationData.Position.z);
-		// capsuleDesc.position = physx::PxExtendedVec3(m_pCharacter->CharacterAnimationData.Position.x, 2.0f * (capsuleDesc.height + capsuleDesc.radius) - center.y - 0.15f, m_pCharacter->CharacterAnimationData.Position.z);
-		capsuleDesc.contactOffset = 0.0001f;
-		capsuleDesc.material = m_pPhysicsManager->pCommonMaterial;
-		capsuleDesc.stepOffset = (capsuleDesc.radius + capsuleDesc.height * 0.5f) * 0.3f;
-		capsuleDesc.climbingMode = physx::PxCapsuleClimbingMode::eCONSTRAINED;
-		pController = (physx::PxCapsuleController*)pControlManager->createController(capsuleDesc);
-		if (!pController)
-		{
-			__debugbreak();
-		}
-		{
-			physx::PxFilterData controllerFilter = {};
-			controllerFilter.word0 = CollisionGroup_KinematicBody;
-
-			physx::PxRigidDynamic* pCapsuleActor = pController->getActor();
-			physx::PxU32 numShapes = pCapsuleActor->getNbShapes();
-			std::vector<physx::PxShape*> capsuleShapes(numShapes);
-			pCapsuleActor->getShapes(capsuleShapes.data(), numShapes);
-
-			for (physx::PxU32 i = 0; i < numShapes; ++i)
-			{
-				physx::PxShape* pShape = capsuleShapes[i];
-				pShape->setSimulationFilterData(controllerFilter);
-				pShape->setQueryFilterData(controllerFilter);
-				pShape->setFlag(physx::PxShapeFlag::eSIMULATION_SHAPE, false);
-				pShape->setFlag(physx::PxShapeFlag::eSCENE_QUERY_SHAPE, true);
-			}
-
-			eCollisionGroup type = CollisionGroup_KinematicBody;
-			pCapsuleActor->userData = malloc(sizeof(eCollisionGroup));
-			memcpy(pCapsuleActor->userData, &type, sizeof(eCollisionGroup));
-		}
-
-
-		// end-effector 浹ü .
-		// physx::PxRigidDynamic* pRightFoot = nullptr;
-		// physx::PxRigidDynamic* pLeftFoot = nullptr;
-		physx::PxRigidDynamic* pRightFootTarget = nullptr;
-		physx::PxRigidDynamic* pLeftFootTarget = nullptr;
-		physx::PxSphereGeometry sphereGeom(0.015f);
-		physx::PxShape* pSphereShape = pPhysics->createShape(sphereGeom, *(m_pPhysicsManager->pCommonMaterial));
-		if (!pSphereShape)
-		{
-			__debugbreak();
-		}
-
-		eCollisionGroup type = CollisionGroup_EndEffector;
-		physx::PxFilterData endEffectorFilter = {};
-		endEffectorFilter.word0 = type;
-		pSphereShape->setSimulationFilterData(endEffectorFilter);
-		pSphereShape->setQueryFilterData(endEffectorFilter);
-
-		physx::PxTransform transform1;
-		physx::PxTransform transform2;
-		{
-			Matrix forTransform1 = (m_pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(0, 0, m_pCharacter->RightLeg.BodyChain[3].BoneID) * m_pCharacter->World);
-			Matrix forTransform2 = (m_pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(0, 0, m_pCharacter->LeftLeg.BodyChain[3].BoneID) * m_pCharacter->World);
-
-			Vector3 transform1Pos = forTransform1.Translation();
-			Vector3 transform2Pos = forTransform2.Translation();
-			Quaternion transform1Quat = Quaternion::CreateFromRotationMatrix(forTransform1);
-			Quaternion transform2Quat = Quaternion::CreateFromRotationMatrix(forTransform2);
-
-			transform1 = physx::PxTransform(physx::PxVec3(transform1Pos.x, transform1Pos.y, transform1Pos.z), physx::PxQuat(transform1Quat.x, transform1Quat.y, transform1Quat.z, transform1Quat.w));
-			transform2 = physx::PxTransform(physx::PxVec3(transform2Pos.x, transform2Pos.y, transform2Pos.z), physx::PxQuat(transform2Quat.x, transform2Quat.y, transform2Quat.z, transform2Quat.w));
-		}
-		/*pRightFoot = pPhysics->createRigidDynamic(transform1);
-		if (!pRightFoot)
-		{
-			__debugbreak();
-		}
-		pRightFoot->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
-		pRightFoot->attachShape(*pSphereShape);
-		pRightFoot->userData = malloc(sizeof(eCollisionGroup));
-		memcpy(pRightFoot->userData, &type, sizeof(eCollisionGroup));*/
-
-		pRightFootTarget = pPhysics->createRigidDynamic(transform1);
-		if (!pRightFootTarget)
-		{
-			__debugbreak();
-		}
-		pRightFootTarget->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
-		pRightFootTarget->attachShape(*pSphereShape);
-		pRightFootTarget->userData = malloc(sizeof(eCollisionGroup));
-		memcpy(pRightFootTarget->userData, &type, sizeof(eCollisionGroup));
-
-		/*pLeftFoot = pPhysics->createRigidDynamic(transform2);
-		if (!pLeftFoot)
-		{
-			__debugbreak();
-		}
-		pLeftFoot->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
-		pLeftFoot->attachShape(*pSphereShape);
-		pLeftFoot->userData = malloc(sizeof(eCollisionGroup));
-		memcpy(pLeftFoot->userData, &type, sizeof(eCollisionGroup));*/
-
-		pLeftFootTarget = pPhysics->createRigidDynamic(transform2);
-		if (!pLeftFootTarget)
-		{
-			__debugbreak();
-		}
-		pLeftFootTarget->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
-		pLeftFootTarget->attachShape(*pSphereShape);
-		pLeftFootTarget->userData = malloc(sizeof(eCollisionGroup));
-		memcpy(pLeftFootTarget->userData, &type, sizeof(eCollisionGroup));
-
-		/*m_pPhysicsManager->AddActor(pRightFoot);
-		m_pPhysicsManager->AddActor(pLeftFoot);*/
-		m_pPhysicsManager->AddActor(pRightFootTarget);
-		m_pPhysicsManager->AddActor(pLeftFootTarget);
-		m_pCharacter->pController = pController;
-		/*m_pCharacter->pRightFoot = pRightFoot;
-		m_pCharacter->pLeftFoot = pLeftFoot;*/
-		m_pCharacter->pRightFootTarget = pRightFootTarget;
-		m_pCharacter->pLeftFootTarget = pLeftFootTarget;
+		characterDesc.Name = "MainCharacter";
+		m_AssetLoader.Submit(characterDesc, onCharacterLoaded, this);
 	}
 
 	// 
 	{
-		Model* pSlope = nullptr;
 		MeshInfo mesh = INIT_MESH_INFO;
 		MakeSlope(&mesh, 20.0f, 1.5f);
 
@@ -526,22 +409,10 @@ void App::initExternalData()
 		mesh.szNormalTextureFileName = path + L"stringy_marble_Normal-dx.png";
 		mesh.szRoughnessTextureFileName = path + L"stringy_marble_Roughness.png";
 
-		pSlope = new Model;
-		pSlope->Initialize(this, { mesh });
-
-		MaterialConstant& groundMaterialConstantData = pSlope->Meshes[0]->MaterialConstantData;
-		groundMaterialConstantData.AlbedoFactor = Vector3(0.7f);
-		groundMaterialConstantData.EmissionFactor = Vector3(0.0f);
-		groundMaterialConstantData.MetallicFactor = 0.5f;
-		groundMaterialConstantData.RoughnessFactor = 0.3f;
-
 		// Vector3 position = Vector3(0.0f, -1.0f, 0.0f);
 		Vector3 position(0.0f);
 		Matrix newWorld = Matrix::CreateRotationY(90.0f * DirectX::XM_PI / 180.0f) * Matrix::CreateTranslation(position);
-		pSlope->UpdateWorld(newWorld);
-
-		pSlope->ModelType = RenderObjectType_DefaultType;
-		m_RenderObjects.push_back(pSlope);
+		loadSceneModel(mesh, "Slope", newWorld, RenderObjectType_DefaultType, true);
 
 		// mesh.indices ==> right-hand coordinates  .
 		mesh.Indices =
@@ -558,7 +429,6 @@ void App::initExternalData()
 
 	// 
 	{
-		Model* pStair = nullptr;
 		MeshInfo mesh = INIT_MESH_INFO;
 		MakeStair(&mesh, 5, 1.0f, 0.1f, 0.2f);
 
@@ -570,22 +440,10 @@ void App::initExternalData()
 		mesh.szNormalTextureFileName = path + L"stringy_marble_Normal-dx.png";
 		mesh.szRoughnessTextureFileName = path + L"stringy_marble_Roughness.png";
 
-		pStair = new Model;
-		pStair->Initialize(this, { mesh });
-
-		MaterialConstant& groundMaterialConstantData = pStair->Meshes[0]->MaterialConstantData;
-		groundMaterialConstantData.AlbedoFactor = Vector3(0.7f);
-		groundMaterialConstantData.EmissionFactor = Vector3(0.0f);
-		groundMaterialConstantData.MetallicFactor = 0.5f;
-		groundMaterialConstantData.RoughnessFactor = 0.3f;
-
 		// Vector3 position = Vector3(0.0f, -1.0f, 0.0f);
 		Vector3 position(0.0f, 0.0f, -3.0f);
 		Matrix newWorld = Matrix::CreateRotationY(90.0f * DirectX::XM_PI / 180.0f) * Matrix::CreateTranslation(position);
-		pStair->UpdateWorld(newWorld);
-
-		pStair->ModelType = RenderObjectType_DefaultType;
-		m_RenderObjects.push_back(pStair);
+		loadSceneModel(mesh, "Stair", newWorld, RenderObjectType_DefaultType, true);
 
 
 		mesh.Indices =
@@ -621,48 +479,252 @@ void App::initExternalData()
 	}
 }
 
-void App::updateAnimationState(SkinnedMeshModel* pCharacter, const float DELTA_TIME, int* pState, int* pFrame, Vector3* pDeltaPos, bool* pEndEffectorUpdateFlag)
+void App::loadSceneModel(const MeshInfo& MESH_INFO, const std::string& NAME, const Matrix& WORLD, eRenderObjectType modelType, bool bCastShadow)
+{
+	_ASSERT(m_SceneModelLoadCount < MAX_SCENE_MODEL_LOAD_COUNT);
+
+	SceneModelLoadDesc* pSceneDesc = &m_pSceneModelLoadDescs[m_SceneModelLoadCount];
+	++m_SceneModelLoadCount;
+
+	pSceneDesc->pApp = this;
+	pSceneDesc->World = WORLD;
+	pSceneDesc->ModelType = modelType;
+	pSceneDesc->bCastShadow = bCastShadow;
+
+	AssetLoadDesc desc;
+	desc.Type = AssetType_Model;
+	desc.MeshInfos.push_back(MESH_INFO);
+	desc.Name = NAME;
+	m_AssetLoader.Submit(desc, onSceneModelLoaded, pSceneDesc);
+}
+
+void App::initCharacter(SkinnedMeshModel* pCharacter)
+{
+	_ASSERT(pCharacter);
+
+	physx::PxPhysics* pPhysics = m_pPhysicsManager->GetPhysics();
+
+	m_pCharacter = pCharacter;
+
+	Vector3 position(0.0f, 0.47f, 2.0f);
+	for (UINT64 i = 0, size = m_pCharacter->Meshes.size(); i < size; ++i)
+	{
+		Mesh* pCurMesh = m_pCharacter->Meshes[i];
+		MaterialConstant& materialConstantData = pCurMesh->MaterialConstantData;
+		materialConstantData.AlbedoFactor = Vector3(1.0f);
+		materialConstantData.RoughnessFactor = 0.8f;
+		materialConstantData.MetallicFactor = 0.0f;
+	}
+	m_pCharacter->Name = "MainCharacter";
+	m_pCharacter->bIsPickable = true;
+	m_pCharacter->UpdateWorld(Matrix::CreateTranslation(position));
+	m_pCharacter->CharacterAnimationData.Position = position;
+	m_RenderObjects.push_back((Model*)m_pCharacter);
+	m_Characters.push_back(m_pCharacter);
+
+
+	physx::PxControllerManager* pControlManager = m_pPhysicsManager->GetControllerManager();
+	physx::PxCapsuleController* pController = nullptr;
+
+	// capsule ޽ö ϰ .
+	physx::PxCapsuleControllerDesc capsuleDesc;
+	capsuleDesc.height = (m_pCharacter->BoundingSphere.Radius * 1.2f) - 0.3f;
+	capsuleDesc.radius = 0.15f;
+	capsuleDesc.upDirection = physx::PxVec3(0.0f, 1.0f, 0.0f);
+	capsuleDesc.position = physx::PxExtendedVec3(m_pCharacter->CharacterAnimationData.Position.x, m_pCharacter->CharacterAnimationData.Position.y, m_pCharacter->CharacterAnimationData.Position.z);
+	// capsuleDesc.position = physx::PxExtendedVec3(m_pCharacter->CharacterAnimationData.Position.x, 2.0f * (capsuleDesc.height + capsuleDesc.radius) - center.y - 0.15f, m_pCharacter->CharacterAnimationData.Position.z);
+	capsuleDesc.contactOffset = 0.0001f;
+	capsuleDesc.material = m_pPhysicsManager->pCommonMaterial;
+	capsuleDesc.stepOffset = (capsuleDesc.radius + capsuleDesc.height * 0.5f) * 0.3f;
+	capsuleDesc.climbingMode = physx::PxCapsuleClimbingMode::eCONSTRAINED;
+	pController = (physx::PxCapsuleController*)pControlManager->createController(capsuleDesc);
+	if (!pController)
+	{
+		__debugbreak();
+	}
+	{
+		physx::PxFilterData controllerFilter = {};
+		controllerFilter.word0 = CollisionGroup_KinematicBody;
+
+		physx::PxRigidDynamic* pCapsuleActor = pController->getActor();
+		physx::PxU32 numShapes = pCapsuleActor->getNbShapes();
+		std::vector<physx::PxShape*> capsuleShapes(numShapes);
+		pCapsuleActor->getShapes(capsuleShapes.data(), numShapes);
+
+		for (physx::PxU32 i = 0; i < numShapes; ++i)
+		{
+			physx::PxShape* pShape = capsuleShapes[i];
+			pShape->setSimulationFilterData(controllerFilter);
+			pShape->setQueryFilterData(controllerFilter);
+			pShape->setFlag(physx::PxShapeFlag::eSIMULATION_SHAPE, false);
+			pShape->setFlag(physx::PxShapeFlag::eSCENE_QUERY_SHAPE, true);
+		}
+
+		eCollisionGroup type = CollisionGroup_KinematicBody;
+		pCapsuleActor->userData = malloc(sizeof(eCollisionGroup));
+		memcpy(pCapsuleActor->userData, &type, sizeof(eCollisionGroup));
+	}
+
+
+	// end-effector 浹ü .
+	// physx::PxRigidDynamic* pRightFoot = nullptr;
+	// physx::PxRigidDynamic* pLeftFoot = nullptr;
+	physx::PxRigidDynamic* pRightFootTarget = nullptr;
+	physx::PxRigidDynamic* pLeftFootTarget = nullptr;
+	physx::PxSphereGeometry sphereGeom(0.015f);
+	physx::PxShape* pSphereShape = pPhysics->createShape(sphereGeom, *(m_pPhysicsManager->pCommonMaterial));
+	if (!pSphereShape)
+	{
+		__debugbreak();
+	}
+
+	eCollisionGroup type = CollisionGroup_EndEffector;
+	physx::PxFilterData endEffectorFilter = {};
+	endEffectorFilter.word0 = type;
+	pSphereShape->setSimulationFilterData(endEffectorFilter);
+	pSphereShape->setQueryFilterData(endEffectorFilter);
+
+	physx::PxTransform transform1;
+	physx::PxTransform transform2;
+	{
+		Matrix forTransform1 = (m_pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(0, 0, m_pCharacter->RightLeg.BodyChain[3].BoneID) * m_pCharacter->World);
+		Matrix forTransform2 = (m_pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(0, 0, m_pCharacter->LeftLeg.BodyChain[3].BoneID) * m_pCharacter->World);
+
+		Vector3 transform1Pos = forTransform1.Translation();
+		Vector3 transform2Pos = forTransform2.Translation();
+		Quaternion transform1Quat = Quaternion::CreateFromRotationMatrix(forTransform1);
+		Quaternion transform2Quat = Quaternion::CreateFromRotationMatrix(forTransform2);
+
+		transform1 = physx::PxTransform(physx::PxVec3(transform1Pos.x, transform1Pos.y, transform1Pos.z), physx::PxQuat(transform1Quat.x, transform1Quat.y, transform1Quat.z, transform1Quat.w));
+		transform2 = physx::PxTransform(physx::PxVec3(transform2Pos.x, transform2Pos.y, transform2Pos.z), physx::PxQuat(transform2Quat.x, transform2Quat.y, transform2Quat.z, transform2Quat.w));
+	}
+	/*pRightFoot = pPhysics->createRigidDynamic(transform1);
+	if (!pRightFoot)
+	{
+		__debugbreak();
+	}
+	pRightFoot->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
+	pRightFoot->attachShape(*pSphereShape);
+	pRightFoot->userData = malloc(sizeof(eCollisionGroup));
+	memcpy(pRightFoot->userData, &type, sizeof(eCollisionGroup));*/
+
+	pRightFootTarget = pPhysics->createRigidDynamic(transform1);
+	if (!pRightFootTarget)
+	{
+		__debugbreak();
+	}
+	pRightFootTarget->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
+	pRightFootTarget->attachShape(*pSphereShape);
+	pRightFootTarget->userData = malloc(sizeof(eCollisionGroup));
+	memcpy(pRightFootTarget->userData, &type, sizeof(eCollisionGroup));
+
+	/*pLeftFoot = pPhysics->createRigidDynamic(transform2);
+	if (!pLeftFoot)
+	{
+		__debugbreak();
+	}
+	pLeftFoot->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
+	pLeftFoot->attachShape(*pSphereShape);
+	pLeftFoot->userData = malloc(sizeof(eCollisionGroup));
+	memcpy(pLeftFoot->userData, &type, sizeof(eCollisionGroup));*/
+
+	pLeftFootTarget = pPhysics->createRigidDynamic(transform2);
+	if (!pLeftFootTarget)
+	{
+		__debugbreak();
+	}
+	pLeftFootTarget->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
+	pLeftFootTarget->attachShape(*pSphereShape);
+	pLeftFootTarget->userData = malloc(sizeof(eCollisionGroup));
+	memcpy(pLeftFootTarget->userData, &type, sizeof(eCollisionGroup));
+
+	/*m_pPhysicsManager->AddActor(pRightFoot);
+	m_pPhysicsManager->AddActor(pLeftFoot);*/
+	m_pPhysicsManager->AddActor(pRightFootTarget);
+	m_pPhysicsManager->AddActor(pLeftFootTarget);
+	m_pCharacter->pController = pController;
+	/*m_pCharacter->pRightFoot = pRightFoot;
+	m_pCharacter->pLeftFoot = pLeftFoot;*/
+	m_pCharacter->pRightFootTarget = pRightFootTarget;
+	m_pCharacter->pLeftFootTarget = pLeftFootTarget;
+}
+
+void App::onSceneModelLoaded(AssetLoadJob* pJob, void* pUserData)
+{
+	const SceneModelLoadDesc* pSCENE_DESC = (const SceneModelLoadDesc*)pUserData;
+	App* pApp = pSCENE_DESC->pApp;
+	Model* pModel = pJob->pModel;
+	if (!pModel)
+	{
+		return;
+	}
+
+	// ٴ, ,   .
+	for (UINT64 i = 0, size = pModel->Meshes.size(); i < size; ++i)
+	{
+		MaterialConstant& materialConstantData = pModel->Meshes[i]->MaterialConstantData;
+		materialConstantData.AlbedoFactor = Vector3(0.7f);
+		materialConstantData.EmissionFactor = Vector3(0.0f);
+		materialConstantData.MetallicFactor = 0.5f;
+		materialConstantData.RoughnessFactor = 0.3f;
+	}
+
+	pModel->UpdateWorld(pSCENE_DESC->World);
+	pModel->ModelType = pSCENE_DESC->ModelType;
+	pModel->bCastShadow = pSCENE_DESC->bCastShadow;
+	if (pModel->ModelType == RenderObjectType_MirrorType)
+	{
+		pApp->m_pMirror = pModel;
+	}
+	pApp->m_RenderObjects.push_back(pModel);
+}
+
+void App::onCharacterLoaded(AssetLoadJob* pJob, void* pUserData)
+{
+	App* pApp = (App*)pUserData;
+	if (!pJob->pModel)
+	{
+		return;
+	}
+
+	pApp->initCharacter((SkinnedMeshModel*)pJob->pModel);
+}
+
+void App::updateAnimationState(SkinnedMeshModel* pCharacter, CharacterUpdateState* pUpdateState, const float DELTA_TIME)
 {
 	_ASSERT(pCharacter);
-	_ASSERT(pDeltaPos);
-	_ASSERT(pEndEffectorUpdateFlag);
+	_ASSERT(pUpdateState);
 
 	// States
 	// 0: idle
 	// 1: idle to walk
 	// 2: walk forward
 	// 3: walk to stop
-	static int s_State = 0;
-	static int s_FrameCount = 0;
+	int& state = pUpdateState->State;
+	int& frameCount = pUpdateState->FrameCount;
+	bool* pEndEffectorUpdateFlag = &pUpdateState->bEndEffectorUpdate;
 
-	const UINT64 ANIMATION_CLIP_SIZE = pCharacter->CharacterAnimationData.Clips[s_State].Keys[0].size();
-	const Vector3 GRAVITY(0.0f, -9.81f, 0.0f);
+	const UINT64 ANIMATION_CLIP_SIZE = pCharacter->CharacterAnimationData.Clips[state].Keys[0].size();
 
-	switch (s_State)
+	switch (state)
 	{
 		case 0:
 		{
-			if (s_FrameCount != 0)
+			if (frameCount != 0)
 			{
 				*pEndEffectorUpdateFlag = false;
 			}
 
-			*pDeltaPos = GRAVITY * pCharacter->CharacterAnimationData.Velocity * DELTA_TIME;
-			pCharacter->CharacterAnimationData.Position += *pDeltaPos;
-			
-			// pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
-
 			if (m_Keyboard.bPressed[VK_UP])
 			{
-				// s_State = 1;
-				s_State = 2;
-				s_FrameCount = 0;
-				pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
+				// state = 1;
+				state = 2;
+				frameCount = 0;
 				pCharacter->CharacterAnimationData.ResetAllIKRotations(0);
 			}
-			else if (s_FrameCount == ANIMATION_CLIP_SIZE) //   ٸ.
+			else if (frameCount == ANIMATION_CLIP_SIZE) //   ٸ.
 			{
-				s_FrameCount = 0; //  ȭ  ݺ.
+				frameCount = 0; //  ȭ  ݺ.
 				// pCharacter->CharacterAnimationData.ResetAllIKRotations(0);
 			}
 		}
@@ -670,16 +732,10 @@ void App::updateAnimationState(SkinnedMeshModel* pCharacter, const float DELTA_T
 
 		case 1:
 		{
-			pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
-			
-			*pDeltaPos = (pCharacter->CharacterAnimationData.Direction + GRAVITY) * pCharacter->CharacterAnimationData.Velocity * DELTA_TIME;
-			pCharacter->CharacterAnimationData.Position += *pDeltaPos;
-
-			if (s_FrameCount == ANIMATION_CLIP_SIZE)
+			if (frameCount == ANIMATION_CLIP_SIZE)
 			{
-				s_State = 2;
-				s_FrameCount = 0;
-				pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
+				state = 2;
+				frameCount = 0;
 			}
 		}
 		break;
@@ -702,41 +758,30 @@ void App::updateAnimationState(SkinnedMeshModel* pCharacter, const float DELTA_T
 				pCharacter->CharacterAnimationData.Direction = Vector3::TransformNormal(pCharacter->CharacterAnimationData.Direction, Matrix::CreateFromQuaternion(newRot));
 				pCharacter->CharacterAnimationData.Rotation = Quaternion::Concatenate(pCharacter->CharacterAnimationData.Rotation, newRot);
 			}
-			
-			pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
 
-			*pDeltaPos = (pCharacter->CharacterAnimationData.Direction + GRAVITY) * pCharacter->CharacterAnimationData.Velocity * DELTA_TIME;
-			m_pCharacter->CharacterAnimationData.Position += *pDeltaPos;
 
 			// Ű    . (   ȱ)
 			if (!m_Keyboard.bPressed[VK_UP])
 			{
-				// s_State = 3;
-				s_State = 0;
-				s_FrameCount = 0;
+				// state = 3;
+				state = 0;
+				frameCount = 0;
 				*pEndEffectorUpdateFlag = true;
 				pCharacter->CharacterAnimationData.ResetAllIKRotations(0);
 			}
-			if (s_FrameCount == ANIMATION_CLIP_SIZE)
+			if (frameCount == ANIMATION_CLIP_SIZE)
 			{
-				s_FrameCount = 0;
-				pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
+				frameCount = 0;
 			}
 		}
 		break;
 
 		case 3:
 		{
-			pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
-
-			*pDeltaPos = (pCharacter->CharacterAnimationData.Direction + GRAVITY) * pCharacter->CharacterAnimationData.Velocity * DELTA_TIME;
-			pCharacter->CharacterAnimationData.Position += *pDeltaPos;
-
-			if (s_FrameCount == ANIMATION_CLIP_SIZE)
+			if (frameCount == ANIMATION_CLIP_SIZE)
 			{
-				s_State = 0;
-				s_FrameCount = 0;
-				pCharacter->CharacterAnimationData.UpdateVelocity(s_State, s_FrameCount);
+				state = 0;
+				frameCount = 0;
 			}
 		}
 		break;
@@ -746,9 +791,9 @@ void App::updateAnimationState(SkinnedMeshModel* pCharacter, const float DELTA_T
 			break;
 	}
 
-	*pState = s_State;
-	*pFrame = s_FrameCount;
-	++s_FrameCount;
+	pUpdateState->ClipID = state;
+	pUpdateState->Frame = frameCount;
+	++frameCount;
 	/*{
 		char szDebugString[256];
 		sprintf_s(szDebugString, 256, "Velocity: %f\n", pCharacter->CharacterAnimationData.Velocity);
@@ -778,13 +823,19 @@ void App::updateEndEffectorPosition(SkinnedMeshModel* pCharacter, SkinnedMeshMod
 	pUpdateInfo->EndEffectorTargetPoses[SkinnedMeshModel::JointPart_LeftLeg] = leftFootPosVec;
 }
 
-void App::simulateCharacterContol(SkinnedMeshModel* pCharacter, const Vector3& DELTA_POS, const float DELTA_TIME, const int CLIP_ID, const int FRAME, bool* pEndEffectorUpdateFlag)
+void App::simulateCharacterContol(SkinnedMeshModel* pCharacter, CharacterUpdateState* pUpdateState, const float DELTA_TIME)
 {
 	_ASSERT(pCharacter);
-	_ASSERT(pEndEffectorUpdateFlag);
+	_ASSERT(pUpdateState);
+
+	const int CLIP_ID = pUpdateState->ClipID;
+	const int FRAME = pUpdateState->Frame;
+	const Vector3 GRAVITY(0.0f, -9.81f, 0.0f);
+	AnimationData* pAnimData = &pCharacter->CharacterAnimationData;
+	LocomotionIntegrator* pLocomotion = &pUpdateState->Locomotion;
 
-	// ġ .
-	physx::PxVec3 displacement = physx::PxVec3(DELTA_POS.x, DELTA_POS.y, DELTA_POS.z);
+	// idle(clip 0) root ̵ pose  ιǷ controller ߷¸.
+	const RootMotionTrack* pROOT_MOTION = (CLIP_ID == 0 ? nullptr : &pAnimData->Clips[CLIP_ID].RootMotion);
 
 	// physx 󿡼 ĳ ̵.
 	CustomFilterCallback filterCallback;
@@ -795,8 +846,26 @@ void App::simulateCharacterContol(SkinnedMeshModel* pCharacter, const Vector3& D
 	filters.mFilterData = &filterData;
 	filters.mFilterCallback = &filterCallback;
 
-	physx::PxControllerCollisionFlags flags = pCharacter->pController->move(displacement, 0.001f, DELTA_TIME, filters);
-	pCharacter->CharacterAnimationData.Update(CLIP_ID, FRAME, DELTA_TIME);
+	// pose characterPoseJob   .
+	// ̵ frame ̿    step  .
+	const float FIXED_STEP = pLocomotion->GetFixedStep();
+	const UINT STEP_COUNT = pLocomotion->BeginFrame(DELTA_TIME);
+	Vector3 rootMotionDisplacement;
+	for (UINT step = 0; step < STEP_COUNT; ++step)
+	{
+		Vector3 delta;
+		float deltaYaw;
+		pLocomotion->Step(pROOT_MOTION, pAnimData->Rotation, &delta, &deltaYaw);
+		rootMotionDisplacement += delta;
+
+		delta += GRAVITY * FIXED_STEP;
+		physx::PxVec3 displacement(delta.x, delta.y, delta.z);
+		pCharacter->pController->move(displacement, 0.001f, FIXED_STEP, filters);
+
+		const physx::PxExtendedVec3 STEP_POS = pCharacter->pController->getPosition();
+		pLocomotion->EndStep(Vector3((float)STEP_POS.x, (float)STEP_POS.y, (float)STEP_POS.z));
+	}
+	pAnimData->Velocity = (STEP_COUNT > 0 ? rootMotionDisplacement.Length() / (FIXED_STEP * STEP_COUNT) : 0.0f);
 
 	//{
 	//	Vector3 rightFootPos = (pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(CLIP_ID, FRAME, pCharacter->RightLeg.BodyChain[3].BoneID) * m_pCharacter->World).Translation();
@@ -809,13 +878,13 @@ void App::simulateCharacterContol(SkinnedMeshModel* pCharacter, const Vector3& D
 	//}
 
 	//  ġ target position .
-	if (*pEndEffectorUpdateFlag)
+	if (pUpdateState->bEndEffectorUpdate)
 	{
 		physx::PxRigidDynamic* pRightFootTarget = pCharacter->pRightFootTarget;
 		physx::PxRigidDynamic* pLeftFootTarget = pCharacter->pLeftFootTarget;
-		Vector3 rightFootPos = (pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(CLIP_ID, FRAME, pCharacter->RightLeg.BodyChain[2].BoneID) * m_pCharacter->World).Translation();
-		Vector3 leftFootPos = (pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(CLIP_ID, FRAME, pCharacter->LeftLeg.BodyChain[2].BoneID) * m_pCharacter->World).Translation();
-		Vector3 hipPos = (pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(CLIP_ID, FRAME, 0) * m_pCharacter->World).Translation();
+		Vector3 rightFootPos = (pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(CLIP_ID, FRAME, pCharacter->RightLeg.BodyChain[2].BoneID) * pCharacter->World).Translation();
+		Vector3 leftFootPos = (pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(CLIP_ID, FRAME, pCharacter->LeftLeg.BodyChain[2].BoneID) * pCharacter->World).Translation();
+		Vector3 hipPos = (pCharacter->CharacterAnimationData.GetGlobalBonePositionMatix(CLIP_ID, FRAME, 0) * pCharacter->World).Translation();
 
 		physx::PxTransform rightFootTransform(physx::PxVec3(rightFootPos.x, rightFootPos.y, rightFootPos.z));
 		physx::PxTransform leftFootTransform(physx::PxVec3(leftFootPos.x, leftFootPos.y, leftFootPos.z));
@@ -843,14 +912,75 @@ void App::simulateCharacterContol(SkinnedMeshModel* pCharacter, const Vector3& D
 		pLeftFootTarget->setKinematicTarget(leftFootTransform);
 	}
 
-	physx::PxExtendedVec3 nextPos = pCharacter->pController->getPosition();
-	Vector3 nextPosVec((float)nextPos.x, (float)nextPos.y, (float)nextPos.z);
+	Vector3 nextPosVec = pLocomotion->GetRenderPosition();
 	{
 		char szDebugString[256];
 		sprintf_s(szDebugString, 256, "pos: %f, %f, %f\n", nextPosVec.x, nextPosVec.y, nextPosVec.z);
 		OutputDebugStringA(szDebugString);
 	}
 	
-	// ޾ƿ ġ  ĳ ġ .
+	//   step ̸  ġ ׸.
 	pCharacter->CharacterAnimationData.Position = nextPosVec;
 }
+
+void App::runCharacterJobs(JobFunction pfnJob, const float DELTA_TIME)
+{
+	_ASSERT(pfnJob);
+
+	JobSystem* pJobSystem = GetJobSystem();
+
+	JobRange pRanges[MAX_CHARACTER_JOB_COUNT];
+	const UINT JOB_COUNT = pJobSystem->SplitRange((UINT)m_Characters.size(), MAX_CHARACTER_JOB_COUNT, pRanges);
+	if (JOB_COUNT == 0)
+	{
+		return;
+	}
+
+	for (UINT i = 0; i < JOB_COUNT; ++i)
+	{
+		CharacterJobDesc* pDesc = &m_pCharacterJobDescs[i];
+		pDesc->pApp = this;
+		pDesc->FirstCharacter = pRanges[i].First;
+		pDesc->CharacterCount = pRanges[i].Count;
+		pDesc->DeltaTime = DELTA_TIME;
+
+		pJobSystem->Submit(pfnJob, pDesc, &m_CharacterJobCounter);
+	}
+
+	pJobSystem->WaitForCounter(&m_CharacterJobCounter);
+}
+
+void App::characterPoseJob(void* pArg, UINT workerIndex)
+{
+	CharacterJobDesc* pDesc = (CharacterJobDesc*)pArg;
+	_ASSERT(pDesc);
+	_ASSERT(pDesc->pApp);
+
+	App* pApp = pDesc->pApp;
+	for (UINT i = pDesc->FirstCharacter, end = pDesc->FirstCharacter + pDesc->CharacterCount; i < end; ++i)
+	{
+		SkinnedMeshModel* pCharacter = pApp->m_Characters[i];
+		const CharacterUpdateState& UPDATE_STATE = pApp->m_CharacterUpdateStates[i];
+		pCharacter->CharacterAnimationData.SetLOD(UPDATE_STATE.LOD);
+		pCharacter->CharacterAnimationData.Update(UPDATE_STATE.ClipID, UPDATE_STATE.Frame, pDesc->DeltaTime);
+	}
+}
+
+void App::characterAnimationJob(void* pArg, UINT workerIndex)
+{
+	CharacterJobDesc* pDesc = (CharacterJobDesc*)pArg;
+	_ASSERT(pDesc);
+	_ASSERT(pDesc->pApp);
+
+	App* pApp = pDesc->pApp;
+	for (UINT i = pDesc->FirstCharacter, end = pDesc->FirstCharacter + pDesc->CharacterCount; i < end; ++i)
+	{
+		SkinnedMeshModel* pCharacter = pApp->m_Characters[i];
+		CharacterUpdateState* pUpdateState = &pApp->m_CharacterUpdateStates[i];
+		const AnimationData& ANIM_DATA = pCharacter->CharacterAnimationData;
+
+		Matrix newWorld = Matrix::CreateFromQuaternion(ANIM_DATA.Rotation) * Matrix::CreateTranslation(ANIM_DATA.Position);
+		pCharacter->UpdateWorld(newWorld);
+		pCharacter->UpdateAnimation(pUpdateState->ClipID, pUpdateState->Frame, pDesc->DeltaTime, &pUpdateState->UpdateInfo);
+	}
+}
@@ -3,9 +3,49 @@
 #include "../Graphics/Light.h"
 #include "../Util/LinkedList.h"
 #include "../Model/Model.h"
+#include "../Model/AssetLoader.h"
 #include "../Renderer/Renderer.h"
 #include "../Util/Utility.h"
 
+class App;
+
+// ĳͺ update . m_Characters   m_CharacterUpdateStates .
+struct CharacterUpdateState
+{
+	SkinnedMeshModel::JointUpdateInfo UpdateInfo;
+	LocomotionIntegrator Locomotion; // controller ̵   step.
+	AnimationLODState LOD;			 // ī޶ Ÿ  frame .
+	int State;				 // 0: idle, 1: idle to walk, 2: walk forward, 3: walk to stop.
+	int FrameCount;
+	int ClipID;				 // ̹ update  clip, frame.
+	int Frame;
+	bool bEndEffectorUpdate;
+};
+
+//  ĳ  ϳ óϴ job.
+struct CharacterJobDesc
+{
+	App* pApp;
+	UINT FirstCharacter;
+	UINT CharacterCount;
+	float DeltaTime;
+};
+
+// 񵿱 д scene ü. ε尡    m_RenderObjects ߰.
+struct SceneModelLoadDesc
+{
+	App* pApp;
+	Matrix World;
+	eRenderObjectType ModelType;
+	bool bCastShadow;
+};
+
+static const UINT MAX_CHARACTER_JOB_COUNT = MAX_JOB_WORKER_COUNT * 4;
+static const UINT MAX_SCENE_MODEL_LOAD_COUNT = 8;
+static const UINT MAX_ASSET_UPLOAD_PER_FRAME = 4; // Model  staging 簡 main ̹Ƿ frame  .
+static const float LOCOMOTION_FIXED_STEP = 1.0f / 60.0f;
+static const UINT MAX_LOCOMOTION_STEP_PER_FRAME = 8;
+
 class App final : public Renderer
 {
 public:
@@ -20,17 +60,42 @@ public:
 
 	void Cleanup();
 
+	inline const AnimationLODStats& GetAnimationLODStats() const { return m_AnimationLODManager.GetFrameStats(); }
+
 protected:
 	void initExternalData();
+	void loadSceneModel(const MeshInfo& MESH_INFO, const std::string& NAME, const Matrix& WORLD, eRenderObjectType modelType, bool bCastShadow);
+	// ε尡  ĳ , ġ, controller,  浹ü .
+	void initCharacter(SkinnedMeshModel* pCharacter);
 
-	void updateAnimationState(SkinnedMeshModel* pCharacter, const float DELTA_TIME, int* pState, int* pFrame, Vector3* pDeltapos, bool* pEndEffectorUpdateFlag);
+	// AssetLoader Ϸ callback. main .
+	static void onSceneModelLoaded(AssetLoadJob* pJob, void* pUserData);
+	static void onCharacterLoaded(AssetLoadJob* pJob, void* pUserData);
+
+	void updateAnimationState(SkinnedMeshModel* pCharacter, CharacterUpdateState* pUpdateState, const float DELTA_TIME);
 	void updateEndEffectorPosition(SkinnedMeshModel* pCharacter, SkinnedMeshModel::JointUpdateInfo* pUpdateInfo);
-	void simulateCharacterContol(SkinnedMeshModel* pCharacter, const Vector3& DELTA_POS, const float DELTA_TIME, const int CLIP_ID, const int FRAME, bool* pEndEffectorUpdateFlag);
+	void simulateCharacterContol(SkinnedMeshModel* pCharacter, CharacterUpdateState* pUpdateState, const float DELTA_TIME);
+
+	// ĳ  job  ϰ   . main 嵵 job ó.
+	void runCharacterJobs(JobFunction pfnJob, const float DELTA_TIME);
+
+	// pose . ĳ ̿ ϴ ° Ƿ .
+	static void characterPoseJob(void* pArg, UINT workerIndex);
+	// world, IK, bone palette . palette ring   ĳ͸ ̹Ƿ .
+	static void characterAnimationJob(void* pArg, UINT workerIndex);
 
 private:
 	// data
 	std::vector<Model*> m_RenderObjects;
 	std::vector<SkinnedMeshModel*> m_Characters;
+	std::vector<CharacterUpdateState> m_CharacterUpdateStates;
+	CharacterJobDesc m_pCharacterJobDescs[MAX_CHARACTER_JOB_COUNT] = { };
+	JobCounter m_CharacterJobCounter;
+	AnimationLODManager m_AnimationLODManager;
+
+	AssetLoader m_AssetLoader;
+	SceneModelLoadDesc m_pSceneModelLoadDescs[MAX_SCENE_MODEL_LOAD_COUNT] = { };
+	UINT m_SceneModelLoadCount = 0;
 
 	std::vector<Light> m_Lights;
 	std::vector<Model*> m_LightSpheres;
@@ -9,16 +9,21 @@ enum eRenderPass
 	RenderPass_MainRender,
 	RenderPass_RenderPassCount,
 };
-enum eRenderThreadEventType
+enum eRenderJobStage
 {
-	// RenderThreadEventType_Process,
-	RenderThreadEventType_Shadow,
-	RenderThreadEventType_Object,
-	RenderThreadEventType_Mirror,
-	RenderThreadEventType_Collider,
-	RenderThreadEventType_MainRender,
-	RenderThreadEventType_Desctroy,
-	RenderThreadEventType_Count
+	RenderJobStage_Shadow,
+	RenderJobStage_ShadowBarrier,
+	RenderJobStage_Object,
+	RenderJobStage_MirrorStencil,
+	RenderJobStage_Mirror,
+	RenderJobStage_MirrorBlendAndPost,
+	RenderJobStage_Count
+};
+enum eCullingView
+{
+	CullingView_Camera = 0,
+	CullingView_Mirror,
+	CullingView_Light, // ķ light ŭ ̾.
 };
 enum eRenderObjectType
 {
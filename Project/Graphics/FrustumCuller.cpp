@@ -0,0 +1,199 @@
+#include "../pch.h"
+#include "FrustumCuller.h"
+
+static const UINT CULLING_BOUNDS_STREAM_COUNT = 7;
+
+void ExtractFrustumPlanes(const Matrix& VIEW_PROJECTION, Frustum* pOutFrustum)
+{
+	_ASSERT(pOutFrustum);
+
+	// row-vector Ծ(clip = p * M)̹Ƿ    . D3D clip z  [0, w].
+	const Matrix& M = VIEW_PROJECTION;
+	Vector4* pPlanes = pOutFrustum->Planes;
+
+	pPlanes[0] = Vector4(M._14 + M._11, M._24 + M._21, M._34 + M._31, M._44 + M._41); // left
+	pPlanes[1] = Vector4(M._14 - M._11, M._24 - M._21, M._34 - M._31, M._44 - M._41); // right
+	pPlanes[2] = Vector4(M._14 + M._12, M._24 + M._22, M._34 + M._32, M._44 + M._42); // bottom
+	pPlanes[3] = Vector4(M._14 - M._12, M._24 - M._22, M._34 - M._32, M._44 - M._42); // top
+	pPlanes[4] = Vector4(M._13, M._23, M._33, M._43);								  // near
+	pPlanes[5] = Vector4(M._14 - M._13, M._24 - M._23, M._34 - M._33, M._44 - M._43); // far
+
+	for (UINT i = 0; i < FRUSTUM_PLANE_COUNT; ++i)
+	{
+		Vector4& plane = pPlanes[i];
+		float length = sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+		if (length > 1e-8f)
+		{
+			plane /= length;
+		}
+	}
+}
+
+void FrustumCuller::Initialize(UINT maxObjectCount)
+{
+	_ASSERT(maxObjectCount > 0);
+
+	// 4 óϹǷ 4  .
+	m_MaxObjectCount = (maxObjectCount + 3) & ~3;
+
+	const UINT STREAM_SIZE = sizeof(float) * m_MaxObjectCount;
+	m_pBoundsData = (float*)_aligned_malloc(STREAM_SIZE * CULLING_BOUNDS_STREAM_COUNT, 16);
+	ZeroMemory(m_pBoundsData, STREAM_SIZE * CULLING_BOUNDS_STREAM_COUNT);
+
+	m_pCenterX = m_pBoundsData;
+	m_pCenterY = m_pCenterX + m_MaxObjectCount;
+	m_pCenterZ = m_pCenterY + m_MaxObjectCount;
+	m_pRadius = m_pCenterZ + m_MaxObjectCount;
+	m_pExtentX = m_pRadius + m_MaxObjectCount;
+	m_pExtentY = m_pExtentX + m_MaxObjectCount;
+	m_pExtentZ = m_pExtentY + m_MaxObjectCount;
+
+	m_ObjectCount = 0;
+}
+
+void FrustumCuller::Reset()
+{
+	m_ObjectCount = 0;
+}
+
+UINT FrustumCuller::AddBounds(const Vector3& CENTER, const float RADIUS, const Vector3& EXTENTS)
+{
+	_ASSERT(m_pBoundsData);
+
+	if (m_ObjectCount >= m_MaxObjectCount)
+	{
+		__debugbreak();
+		return 0xffffffff;
+	}
+
+	UINT index = m_ObjectCount;
+	m_pCenterX[index] = CENTER.x;
+	m_pCenterY[index] = CENTER.y;
+	m_pCenterZ[index] = CENTER.z;
+	m_pRadius[index] = RADIUS;
+	m_pExtentX[index] = EXTENTS.x;
+	m_pExtentY[index] = EXTENTS.y;
+	m_pExtentZ[index] = EXTENTS.z;
+	++m_ObjectCount;
+
+	return index;
+}
+
+void FrustumCuller::SetBounds(UINT index, const Vector3& CENTER, const float RADIUS, const Vector3& EXTENTS)
+{
+	_ASSERT(index < m_ObjectCount);
+
+	m_pCenterX[index] = CENTER.x;
+	m_pCenterY[index] = CENTER.y;
+	m_pCenterZ[index] = CENTER.z;
+	m_pRadius[index] = RADIUS;
+	m_pExtentX[index] = EXTENTS.x;
+	m_pExtentY[index] = EXTENTS.y;
+	m_pExtentZ[index] = EXTENTS.z;
+}
+
+UINT FrustumCuller::CullRange(UINT startIndex, UINT count, const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility)
+{
+	_ASSERT(pOutVisibility);
+	_ASSERT(frustumCount <= MAX_CULLING_FRUSTUM_COUNT);
+	_ASSERT(startIndex + count <= m_ObjectCount);
+
+	const UINT END_INDEX = startIndex + count;
+
+	if (!frustumCount)
+	{
+		ZeroMemory(pOutVisibility + startIndex, count);
+		return 0;
+	}
+
+	//   ̸ splat ص. nx, ny, nz, d, |nx|, |ny|, |nz|.
+	__m128 ppPlaneSplats[MAX_CULLING_FRUSTUM_COUNT * FRUSTUM_PLANE_COUNT][7];
+	for (UINT f = 0; f < frustumCount; ++f)
+	{
+		for (UINT p = 0; p < FRUSTUM_PLANE_COUNT; ++p)
+		{
+			const Vector4& PLANE = pFRUSTUMS[f].Planes[p];
+			__m128* pSplat = ppPlaneSplats[f * FRUSTUM_PLANE_COUNT + p];
+			pSplat[0] = _mm_set1_ps(PLANE.x);
+			pSplat[1] = _mm_set1_ps(PLANE.y);
+			pSplat[2] = _mm_set1_ps(PLANE.z);
+			pSplat[3] = _mm_set1_ps(PLANE.w);
+			pSplat[4] = _mm_set1_ps(fabsf(PLANE.x));
+			pSplat[5] = _mm_set1_ps(fabsf(PLANE.y));
+			pSplat[6] = _mm_set1_ps(fabsf(PLANE.z));
+		}
+	}
+
+	const __m128 ZERO = _mm_setzero_ps();
+	const __m128 ALL_ONES = _mm_cmpeq_ps(ZERO, ZERO);
+	const __m128 SIGN_MASK = _mm_set1_ps(-0.0f);
+	UINT visibleCount = 0;
+
+	// 16byte  load   ġ 4  .   lane  .
+	for (UINT i = (startIndex & ~3); i < END_INDEX; i += 4)
+	{
+		const __m128 CENTER_X = _mm_load_ps(m_pCenterX + i);
+		const __m128 CENTER_Y = _mm_load_ps(m_pCenterY + i);
+		const __m128 CENTER_Z = _mm_load_ps(m_pCenterZ + i);
+		const __m128 NEG_RADIUS = _mm_xor_ps(_mm_load_ps(m_pRadius + i), SIGN_MASK);
+		const __m128 EXTENT_X = _mm_load_ps(m_pExtentX + i);
+		const __m128 EXTENT_Y = _mm_load_ps(m_pExtentY + i);
+		const __m128 EXTENT_Z = _mm_load_ps(m_pExtentZ + i);
+
+		__m128 visibleMask = ZERO;
+		for (UINT f = 0; f < frustumCount; ++f)
+		{
+			__m128 insideMask = ALL_ONES;
+			for (UINT p = 0; p < FRUSTUM_PLANE_COUNT; ++p)
+			{
+				const __m128* pSPLAT = ppPlaneSplats[f * FRUSTUM_PLANE_COUNT + p];
+
+				// ߽ɱ ȣ ִ Ÿ.
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pSPLAT[0], CENTER_X), _mm_mul_ps(pSPLAT[1], CENTER_Y)), _mm_add_ps(_mm_mul_ps(pSPLAT[2], CENTER_Z), pSPLAT[3]));
+				//    AABB  .
+				__m128 boxRadius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pSPLAT[4], EXTENT_X), _mm_mul_ps(pSPLAT[5], EXTENT_Y)), _mm_mul_ps(pSPLAT[6], EXTENT_Z));
+
+				__m128 sphereInside = _mm_cmpge_ps(distance, NEG_RADIUS);
+				__m128 boxInside = _mm_cmpge_ps(_mm_add_ps(distance, boxRadius), ZERO);
+				insideMask = _mm_and_ps(insideMask, _mm_and_ps(sphereInside, boxInside));
+			}
+
+			visibleMask = _mm_or_ps(visibleMask, insideMask);
+			if (_mm_movemask_ps(visibleMask) == 0xf)
+			{
+				break;
+			}
+		}
+
+		int visibleBits = _mm_movemask_ps(visibleMask);
+		UINT laneStart = (i < startIndex ? startIndex - i : 0);
+		UINT laneCount = (END_INDEX - i < 4 ? END_INDEX - i : 4);
+		for (UINT lane = laneStart; lane < laneCount; ++lane)
+		{
+			BYTE bVisible = (BYTE)((visibleBits >> lane) & 1);
+			pOutVisibility[i + lane] = bVisible;
+			visibleCount += bVisible;
+		}
+	}
+
+	return visibleCount;
+}
+
+void FrustumCuller::Cleanup()
+{
+	if (m_pBoundsData)
+	{
+		_aligned_free(m_pBoundsData);
+		m_pBoundsData = nullptr;
+	}
+	m_pCenterX = nullptr;
+	m_pCenterY = nullptr;
+	m_pCenterZ = nullptr;
+	m_pRadius = nullptr;
+	m_pExtentX = nullptr;
+	m_pExtentY = nullptr;
+	m_pExtentZ = nullptr;
+
+	m_MaxObjectCount = 0;
+	m_ObjectCount = 0;
+}
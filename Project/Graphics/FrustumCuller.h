@@ -0,0 +1,59 @@
+#pragma once
+
+#include <xmmintrin.h>
+#include <directxtk12/SimpleMath.h>
+
+// CPU frustum culling.
+//   SoA(structure of arrays) Ƶΰ SSE 4  ˻縦 .
+// sphere, AABB   ؾ ̴  ϸ,  frustum ѱ ϳ ġ .
+
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Vector4;
+using DirectX::SimpleMath::Matrix;
+
+static const UINT FRUSTUM_PLANE_COUNT = 6;
+static const UINT MAX_CULLING_FRUSTUM_COUNT = 6; // point light cube 6.
+
+struct Frustum
+{
+	Vector4 Planes[FRUSTUM_PLANE_COUNT]; // (nx, ny, nz, d). ȭǾ ְ  .
+};
+
+// view * projection Ŀ  (Gribb-Hartmann). ݻ/  Ŀ ״  .
+void ExtractFrustumPlanes(const Matrix& VIEW_PROJECTION, Frustum* pOutFrustum);
+
+class FrustumCuller
+{
+public:
+	FrustumCuller() = default;
+	~FrustumCuller() { Cleanup(); }
+
+	void Initialize(UINT maxObjectCount);
+
+	void Reset();
+	UINT AddBounds(const Vector3& CENTER, const float RADIUS, const Vector3& EXTENTS);
+	void SetBounds(UINT index, const Vector3& CENTER, const float RADIUS, const Vector3& EXTENTS);
+
+	// pOutVisibility[i] 0 Ǵ 1 . ̴  ȯ.
+	inline UINT Cull(const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility) { return CullRange(0, m_ObjectCount, pFRUSTUMS, frustumCount, pOutVisibility); }
+	// [startIndex, startIndex + count)  ˻. pOutVisibility ü index .
+	UINT CullRange(UINT startIndex, UINT count, const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility);
+
+	void Cleanup();
+
+	inline UINT GetObjectCount() { return m_ObjectCount; }
+	inline UINT GetMaxObjectCount() { return m_MaxObjectCount; }
+
+private:
+	float* m_pBoundsData = nullptr; // Ʒ stream ϳ 16byte  ޸𸮸  .
+	float* m_pCenterX = nullptr;
+	float* m_pCenterY = nullptr;
+	float* m_pCenterZ = nullptr;
+	float* m_pRadius = nullptr;
+	float* m_pExtentX = nullptr;
+	float* m_pExtentY = nullptr;
+	float* m_pExtentZ = nullptr;
+
+	UINT m_MaxObjectCount = 0;
+	UINT m_ObjectCount = 0;
+};
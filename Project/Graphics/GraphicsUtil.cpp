@@ -2,7 +2,6 @@
 #include <DirectXTex.h>
 #include <DirectXTexEXR.h>
 #include <directxtk12/DDSTextureLoader.h>
-#include <directxtk12/ResourceUploadBatch.h>
 #include <wrl/client.h>
 #include "../pch.h"
 
@@ -70,26 +69,23 @@ LB_RET:
 	return hr;
 }
 
-HRESULT ReadImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWidth, int* pHeight)
+// stb  ̹ 4äη  ϰ pImg .
+static HRESULT CopyToRGBAImage(unsigned char* pImg, int channels, int width, int height, std::vector<UCHAR>& image)
 {
 	HRESULT hr = S_OK;
-	int channels = 0;
 
-	char pFileName[MAX_PATH];
-	if (!WideCharToMultiByte(CP_ACP, 0, pszFileName, -1, pFileName, MAX_PATH, nullptr, nullptr))
+	if (!pImg)
 	{
-		pFileName[0] = '\0';
+		return E_FAIL;
 	}
 
-	unsigned char* pImg = stbi_load(pFileName, pWidth, pHeight, &channels, 0);
-
 	// 4äη  .
-	image.resize((*pWidth) * (*pHeight) * 4);
+	image.resize(width * height * 4);
 	switch (channels)
 	{
 		case 1:
 		{
-			for (int i = 0, size = (*pWidth) * (*pHeight); i < size; ++i)
+			for (int i = 0, size = width * height; i < size; ++i)
 			{
 				UCHAR g = pImg[i * channels];
 				for (int c = 0; c < 4; ++c)
@@ -102,7 +98,7 @@ HRESULT ReadImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWid
 
 		case 2:
 		{
-			for (int i = 0, size = (*pWidth) * (*pHeight); i < size; ++i)
+			for (int i = 0, size = width * height; i < size; ++i)
 			{
 				for (int c = 0; c < 2; ++c)
 				{
@@ -116,7 +112,7 @@ HRESULT ReadImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWid
 
 		case 3:
 		{
-			for (int i = 0, size = (*pWidth) * (*pHeight); i < size; ++i)
+			for (int i = 0, size = width * height; i < size; ++i)
 			{
 				for (int c = 0; c < 3; ++c)
 				{
@@ -129,7 +125,7 @@ HRESULT ReadImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWid
 
 		case 4:
 		{
-			for (int i = 0, size = (*pWidth) * (*pHeight); i < size; ++i)
+			for (int i = 0, size = width * height; i < size; ++i)
 			{
 				for (int c = 0; c < 4; ++c)
 				{
@@ -149,6 +145,29 @@ HRESULT ReadImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWid
 	return hr;
 }
 
+HRESULT ReadImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWidth, int* pHeight)
+{
+	int channels = 0;
+
+	char pFileName[MAX_PATH];
+	if (!WideCharToMultiByte(CP_ACP, 0, pszFileName, -1, pFileName, MAX_PATH, nullptr, nullptr))
+	{
+		pFileName[0] = '\0';
+	}
+
+	unsigned char* pImg = stbi_load(pFileName, pWidth, pHeight, &channels, 0);
+	return CopyToRGBAImage(pImg, channels, *pWidth, *pHeight, image);
+}
+
+HRESULT ReadImageFromMemory(const BYTE* pDATA, const UINT64 SIZE, std::vector<UCHAR>& image, int* pWidth, int* pHeight)
+{
+	_ASSERT(pDATA);
+
+	int channels = 0;
+	unsigned char* pImg = stbi_load_from_memory(pDATA, (int)SIZE, pWidth, pHeight, &channels, 0);
+	return CopyToRGBAImage(pImg, channels, *pWidth, *pHeight, image);
+}
+
 HRESULT ReadEXRImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWidth, int* pHeight, DXGI_FORMAT* pPixelFormat)
 {
 	HRESULT hr = S_OK;
@@ -179,27 +198,18 @@ LB_RET:
 	return hr;
 }
 
-HRESULT ReadDDSImage(ID3D12Device* pDevice, ID3D12CommandQueue* pCommandQueue, const WCHAR* pszFileName, ID3D12Resource** ppResource)
+HRESULT ReadDDSImage(ID3D12Device* pDevice, const WCHAR* pszFileName, ID3D12Resource** ppResource, std::unique_ptr<uint8_t[]>& ddsData, std::vector<D3D12_SUBRESOURCE_DATA>& subresources)
 {
 	_ASSERT(pDevice);
-	_ASSERT(pCommandQueue);
 	_ASSERT(*ppResource == nullptr);
 
 	HRESULT hr = S_OK;
 	Microsoft::WRL::ComPtr<ID3D12Resource> pResource;
-	DirectX::ResourceUploadBatch resourceUpload(pDevice);
 
-	resourceUpload.Begin();
-
-	hr = DirectX::CreateDDSTextureFromFile(pDevice, resourceUpload, pszFileName, pResource.ReleaseAndGetAddressOf());
+	// resource   б⸸. upload ȣڰ.
+	hr = DirectX::LoadDDSTextureFromFile(pDevice, pszFileName, pResource.ReleaseAndGetAddressOf(), ddsData, subresources);
 	BREAK_IF_FAILED(hr);
 
-	// Upload the resources to the GPU.
-	auto uploadResourcesFinished = resourceUpload.End(pCommandQueue);
-
-	// Wait for the upload thread to terminate
-	uploadResourcesFinished.wait();
-
 	pResource->SetName(L"TextureResource");
 
 	hr = pResource.CopyTo(ppResource);
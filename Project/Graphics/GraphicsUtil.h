@@ -1,10 +1,14 @@
 #pragma once
 
+#include <memory>
+
 HRESULT CompileShader(const WCHAR* pszFileName, const char* pszShaderVersion, const D3D_SHADER_MACRO* pSHADER_MACROS, ID3DBlob** ppShader);
 
 HRESULT ReadImage(const WCHAR* pszAlbedoFileName, const WCHAR* pszOpacityFileName, std::vector<UCHAR>& image, int* pWidth, int* pHeight);
 HRESULT ReadImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWidth, int* pHeight);
+HRESULT ReadImageFromMemory(const BYTE* pDATA, const UINT64 SIZE, std::vector<UCHAR>& image, int* pWidth, int* pHeight);
 HRESULT ReadEXRImage(const WCHAR* pszFileName, std::vector<UCHAR>& image, int* pWidth, int* pHeight, DXGI_FORMAT* pPixelFormat);
-HRESULT ReadDDSImage(ID3D12Device* pDevice, ID3D12CommandQueue* pCommandQueue, const WCHAR* pszFileName, ID3D12Resource** ppResource);
+// subresources ddsData  Ŵ. ؽĴ COPY_DEST · .
+HRESULT ReadDDSImage(ID3D12Device* pDevice, const WCHAR* pszFileName, ID3D12Resource** ppResource, std::unique_ptr<uint8_t[]>& ddsData, std::vector<D3D12_SUBRESOURCE_DATA>& subresources);
 
 UINT64 GetPixelSize(const DXGI_FORMAT PIXEL_FORMAT);
\ No newline at end of file
@@ -104,11 +104,11 @@ void Light::Update(const float DELTA_TIME, Camera& mainCamera)
 	}
 }
 
-void Light::RenderShadowMap(std::vector<Model*>* pRenderObjects)
+void Light::RenderShadowMap(std::vector<Model*>* pRenderObjects, const BYTE* pCasterVisibility)
 {
 	if (Property.LightType & LIGHT_SHADOW)
 	{
-		LightShadowMap.Render(pRenderObjects);
+		LightShadowMap.Render(pRenderObjects, pCasterVisibility);
 	}
 }
 
@@ -15,7 +15,7 @@ public:
 
 	void Update(const float DELTA_TIME, Camera& mainCamera);
 
-	void RenderShadowMap(std::vector<Model*>* pRenderObjects);
+	void RenderShadowMap(std::vector<Model*>* pRenderObjects, const BYTE* pCasterVisibility = nullptr);
 
 	void Cleanup();
 
@@ -0,0 +1,667 @@
+#include "../pch.h"
+#include "SceneBVH.h"
+
+static const UINT SCENE_BVH_INVALID_INDEX = 0xffffffff;
+
+enum eSceneBVHCullResult
+{
+	SceneBVHCullResult_Outside = 0,
+	SceneBVHCullResult_Intersect,
+	SceneBVHCullResult_Inside
+};
+
+static inline float GetAxis(const Vector3& V, int axis)
+{
+	return (axis == 0 ? V.x : (axis == 1 ? V.y : V.z));
+}
+
+static inline void ExpandBox(Vector3* pMin, Vector3* pMax, const Vector3& MIN, const Vector3& MAX)
+{
+	pMin->x = (MIN.x < pMin->x ? MIN.x : pMin->x);
+	pMin->y = (MIN.y < pMin->y ? MIN.y : pMin->y);
+	pMin->z = (MIN.z < pMin->z ? MIN.z : pMin->z);
+	pMax->x = (MAX.x > pMax->x ? MAX.x : pMax->x);
+	pMax->y = (MAX.y > pMax->y ? MAX.y : pMax->y);
+	pMax->z = (MAX.z > pMax->z ? MAX.z : pMax->z);
+}
+
+static int ClassifyBox(const Frustum* pFRUSTUMS, UINT frustumCount, const Vector3& MIN, const Vector3& MAX)
+{
+	const Vector3 CENTER((MIN.x + MAX.x) * 0.5f, (MIN.y + MAX.y) * 0.5f, (MIN.z + MAX.z) * 0.5f);
+	const Vector3 EXTENTS((MAX.x - MIN.x) * 0.5f, (MAX.y - MIN.y) * 0.5f, (MAX.z - MIN.z) * 0.5f);
+	bool bIntersect = false;
+
+	//  frustum  ϳ  ϸ inside,  ̸ outside.
+	for (UINT f = 0; f < frustumCount; ++f)
+	{
+		bool bOutside = false;
+		bool bInside = true;
+
+		for (UINT p = 0; p < FRUSTUM_PLANE_COUNT; ++p)
+		{
+			const Vector4& PLANE = pFRUSTUMS[f].Planes[p];
+			float distance = PLANE.x * CENTER.x + PLANE.y * CENTER.y + PLANE.z * CENTER.z + PLANE.w;
+			float boxRadius = fabsf(PLANE.x) * EXTENTS.x + fabsf(PLANE.y) * EXTENTS.y + fabsf(PLANE.z) * EXTENTS.z;
+
+			if (distance + boxRadius < 0.0f)
+			{
+				bOutside = true;
+				break;
+			}
+			if (distance - boxRadius < 0.0f)
+			{
+				bInside = false;
+			}
+		}
+
+		if (bOutside)
+		{
+			continue;
+		}
+		if (bInside)
+		{
+			return SceneBVHCullResult_Inside;
+		}
+		bIntersect = true;
+	}
+
+	return (bIntersect ? SceneBVHCullResult_Intersect : SceneBVHCullResult_Outside);
+}
+
+static float SquaredDistanceToBox(const Vector3& POINT, const Vector3& MIN, const Vector3& MAX)
+{
+	float squaredDistance = 0.0f;
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		float value = GetAxis(POINT, axis);
+		float boxMin = GetAxis(MIN, axis);
+		float boxMax = GetAxis(MAX, axis);
+
+		if (value < boxMin)
+		{
+			squaredDistance += (boxMin - value) * (boxMin - value);
+		}
+		else if (value > boxMax)
+		{
+			squaredDistance += (value - boxMax) * (value - boxMax);
+		}
+	}
+	return squaredDistance;
+}
+
+void SceneBVH::Initialize(UINT maxObjectCount)
+{
+	_ASSERT(maxObjectCount > 0);
+
+	m_MaxObjectCount = maxObjectCount;
+
+	// leaf ּ 1 ü Ƿ  2n - 1  .
+	const UINT MAX_NODE_COUNT = maxObjectCount * 2;
+	m_pNodes = (SceneBVHNode*)malloc(sizeof(SceneBVHNode) * MAX_NODE_COUNT);
+	ZeroMemory(m_pNodes, sizeof(SceneBVHNode) * MAX_NODE_COUNT);
+	m_pTraversalStack = (UINT*)malloc(sizeof(UINT) * MAX_NODE_COUNT);
+
+	m_pBounds = (SceneBounds*)malloc(sizeof(SceneBounds) * maxObjectCount);
+	ZeroMemory(m_pBounds, sizeof(SceneBounds) * maxObjectCount);
+	m_pObjectIndices = (UINT*)malloc(sizeof(UINT) * maxObjectCount);
+	m_pObjectPositions = (UINT*)malloc(sizeof(UINT) * maxObjectCount);
+	m_pLeafNodeIndices = (UINT*)malloc(sizeof(UINT) * maxObjectCount);
+	m_pOrderedVisibility = (BYTE*)malloc(maxObjectCount);
+
+	m_OrderedCuller.Initialize(maxObjectCount);
+
+	m_NodeCount = 0;
+	m_ObjectCount = 0;
+	m_BuildRootArea = 0.0f;
+}
+
+void SceneBVH::SetObjectBounds(UINT objectIndex, const SceneBounds& BOUNDS)
+{
+	_ASSERT(objectIndex < m_MaxObjectCount);
+	m_pBounds[objectIndex] = BOUNDS;
+}
+
+void SceneBVH::Build(UINT objectCount)
+{
+	_ASSERT(objectCount <= m_MaxObjectCount);
+
+	m_ObjectCount = objectCount;
+	m_NodeCount = 0;
+	m_BuildRootArea = 0.0f;
+	m_OrderedCuller.Reset();
+
+	if (!objectCount)
+	{
+		return;
+	}
+
+	for (UINT i = 0; i < objectCount; ++i)
+	{
+		m_pObjectIndices[i] = i;
+	}
+
+	SceneBVHNode* pRoot = m_pNodes;
+	pRoot->FirstObject = 0;
+	pRoot->ObjectCount = objectCount;
+	pRoot->LeftChild = 0;
+	pRoot->Parent = SCENE_BVH_INVALID_INDEX;
+	m_NodeCount = 1;
+	updateNodeBounds(0);
+
+	UINT stackSize = 0;
+	m_pTraversalStack[stackSize++] = 0;
+	while (stackSize)
+	{
+		UINT nodeIndex = m_pTraversalStack[--stackSize];
+		splitNode(nodeIndex);
+
+		UINT leftChild = m_pNodes[nodeIndex].LeftChild;
+		if (leftChild)
+		{
+			m_pTraversalStack[stackSize++] = leftChild;
+			m_pTraversalStack[stackSize++] = leftChild + 1;
+		}
+		else
+		{
+			for (UINT i = 0; i < m_pNodes[nodeIndex].ObjectCount; ++i)
+			{
+				m_pLeafNodeIndices[m_pObjectIndices[m_pNodes[nodeIndex].FirstObject + i]] = nodeIndex;
+			}
+		}
+	}
+
+	// BVH  culler ־ leaf  ӵ SoA ǵ .
+	for (UINT i = 0; i < objectCount; ++i)
+	{
+		UINT objectIndex = m_pObjectIndices[i];
+		const SceneBounds& BOUNDS = m_pBounds[objectIndex];
+
+		m_pObjectPositions[objectIndex] = i;
+		m_OrderedCuller.AddBounds(BOUNDS.Center, BOUNDS.Radius, BOUNDS.Extents);
+	}
+
+	m_BuildRootArea = surfaceArea(pRoot->Min, pRoot->Max);
+}
+
+void SceneBVH::Refit(UINT objectIndex, const SceneBounds& BOUNDS)
+{
+	_ASSERT(objectIndex < m_ObjectCount);
+
+	m_pBounds[objectIndex] = BOUNDS;
+	m_OrderedCuller.SetBounds(m_pObjectPositions[objectIndex], BOUNDS.Center, BOUNDS.Radius, BOUNDS.Extents);
+
+	// θ ڽ ̹Ƿ,   忡 絵 .
+	UINT nodeIndex = m_pLeafNodeIndices[objectIndex];
+	while (nodeIndex != SCENE_BVH_INVALID_INDEX)
+	{
+		SceneBVHNode* pNode = m_pNodes + nodeIndex;
+		const Vector3 OLD_MIN = pNode->Min;
+		const Vector3 OLD_MAX = pNode->Max;
+
+		updateNodeBounds(nodeIndex);
+		if (!memcmp(&OLD_MIN, &pNode->Min, sizeof(Vector3)) && !memcmp(&OLD_MAX, &pNode->Max, sizeof(Vector3)))
+		{
+			break;
+		}
+
+		nodeIndex = pNode->Parent;
+	}
+}
+
+bool SceneBVH::NeedsRebuild()
+{
+	if (!m_NodeCount)
+	{
+		return false;
+	}
+
+	const float ROOT_AREA = surfaceArea(m_pNodes[0].Min, m_pNodes[0].Max);
+	return (ROOT_AREA > m_BuildRootArea * 2.0f);
+}
+
+UINT SceneBVH::QueryFrustum(const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility)
+{
+	_ASSERT(pOutVisibility);
+
+	ZeroMemory(pOutVisibility, m_ObjectCount);
+	if (!m_NodeCount || !frustumCount)
+	{
+		return 0;
+	}
+
+	UINT visibleCount = 0;
+	UINT stackSize = 0;
+	m_pTraversalStack[stackSize++] = 0;
+
+	while (stackSize)
+	{
+		const SceneBVHNode* pNODE = m_pNodes + m_pTraversalStack[--stackSize];
+
+		int result = ClassifyBox(pFRUSTUMS, frustumCount, pNODE->Min, pNODE->Max);
+		if (result == SceneBVHCullResult_Outside)
+		{
+			continue;
+		}
+
+		if (result == SceneBVHCullResult_Inside)
+		{
+			// subtree ü . ü ˻  .
+			for (UINT i = 0; i < pNODE->ObjectCount; ++i)
+			{
+				pOutVisibility[m_pObjectIndices[pNODE->FirstObject + i]] = 1;
+			}
+			visibleCount += pNODE->ObjectCount;
+			continue;
+		}
+
+		if (pNODE->LeftChild)
+		{
+			m_pTraversalStack[stackSize++] = pNODE->LeftChild;
+			m_pTraversalStack[stackSize++] = pNODE->LeftChild + 1;
+			continue;
+		}
+
+		// 迡 ģ leaf SIMD ü ˻.
+		m_OrderedCuller.CullRange(pNODE->FirstObject, pNODE->ObjectCount, pFRUSTUMS, frustumCount, m_pOrderedVisibility);
+		for (UINT i = pNODE->FirstObject, end = pNODE->FirstObject + pNODE->ObjectCount; i < end; ++i)
+		{
+			if (m_pOrderedVisibility[i])
+			{
+				pOutVisibility[m_pObjectIndices[i]] = 1;
+				++visibleCount;
+			}
+		}
+	}
+
+	return visibleCount;
+}
+
+UINT SceneBVH::QuerySphere(const Vector3& CENTER, const float RADIUS, BYTE* pOutVisibility)
+{
+	_ASSERT(pOutVisibility);
+
+	ZeroMemory(pOutVisibility, m_ObjectCount);
+	if (!m_NodeCount)
+	{
+		return 0;
+	}
+
+	const float SQUARED_RADIUS = RADIUS * RADIUS;
+	UINT visibleCount = 0;
+	UINT stackSize = 0;
+	m_pTraversalStack[stackSize++] = 0;
+
+	while (stackSize)
+	{
+		const SceneBVHNode* pNODE = m_pNodes + m_pTraversalStack[--stackSize];
+
+		if (SquaredDistanceToBox(CENTER, pNODE->Min, pNODE->Max) > SQUARED_RADIUS)
+		{
+			continue;
+		}
+
+		if (pNODE->LeftChild)
+		{
+			m_pTraversalStack[stackSize++] = pNODE->LeftChild;
+			m_pTraversalStack[stackSize++] = pNODE->LeftChild + 1;
+			continue;
+		}
+
+		// frustum ˻  sphere, AABB    .
+		for (UINT i = 0; i < pNODE->ObjectCount; ++i)
+		{
+			UINT objectIndex = m_pObjectIndices[pNODE->FirstObject + i];
+			const SceneBounds& BOUNDS = m_pBounds[objectIndex];
+
+			Vector3 toCenter(BOUNDS.Center.x - CENTER.x, BOUNDS.Center.y - CENTER.y, BOUNDS.Center.z - CENTER.z);
+			float radiusSum = BOUNDS.Radius + RADIUS;
+			if (toCenter.x * toCenter.x + toCenter.y * toCenter.y + toCenter.z * toCenter.z > radiusSum * radiusSum)
+			{
+				continue;
+			}
+
+			Vector3 boxMin(BOUNDS.Center.x - BOUNDS.Extents.x, BOUNDS.Center.y - BOUNDS.Extents.y, BOUNDS.Center.z - BOUNDS.Extents.z);
+			Vector3 boxMax(BOUNDS.Center.x + BOUNDS.Extents.x, BOUNDS.Center.y + BOUNDS.Extents.y, BOUNDS.Center.z + BOUNDS.Extents.z);
+			if (SquaredDistanceToBox(CENTER, boxMin, boxMax) > SQUARED_RADIUS)
+			{
+				continue;
+			}
+
+			pOutVisibility[objectIndex] = 1;
+			++visibleCount;
+		}
+	}
+
+	return visibleCount;
+}
+
+UINT SceneBVH::QueryRay(const Vector3& ORIGIN, const Vector3& DIRECTION, const float MAX_DISTANCE, UINT* pOutObjectIndices, UINT maxObjectCount)
+{
+	_ASSERT(pOutObjectIndices);
+
+	if (!m_NodeCount)
+	{
+		return 0;
+	}
+
+	// slab test . 0  ū  .
+	float pInverseDirection[3];
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		float value = GetAxis(DIRECTION, axis);
+		pInverseDirection[axis] = (fabsf(value) > 1e-12f ? 1.0f / value : (value < 0.0f ? -1e30f : 1e30f));
+	}
+	const float DIRECTION_LENGTH_SQUARE = DIRECTION.x * DIRECTION.x + DIRECTION.y * DIRECTION.y + DIRECTION.z * DIRECTION.z;
+	const float MAX_T = MAX_DISTANCE / sqrtf(DIRECTION_LENGTH_SQUARE);
+
+	UINT hitCount = 0;
+	UINT stackSize = 0;
+	m_pTraversalStack[stackSize++] = 0;
+
+	while (stackSize && hitCount < maxObjectCount)
+	{
+		const SceneBVHNode* pNODE = m_pNodes + m_pTraversalStack[--stackSize];
+
+		float tMin = 0.0f;
+		float tMax = MAX_T;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			float origin = GetAxis(ORIGIN, axis);
+			float t0 = (GetAxis(pNODE->Min, axis) - origin) * pInverseDirection[axis];
+			float t1 = (GetAxis(pNODE->Max, axis) - origin) * pInverseDirection[axis];
+			if (t0 > t1)
+			{
+				float temp = t0;
+				t0 = t1;
+				t1 = temp;
+			}
+			tMin = (t0 > tMin ? t0 : tMin);
+			tMax = (t1 < tMax ? t1 : tMax);
+		}
+		if (tMin > tMax)
+		{
+			continue;
+		}
+
+		if (pNODE->LeftChild)
+		{
+			m_pTraversalStack[stackSize++] = pNODE->LeftChild;
+			m_pTraversalStack[stackSize++] = pNODE->LeftChild + 1;
+			continue;
+		}
+
+		for (UINT i = 0; i < pNODE->ObjectCount && hitCount < maxObjectCount; ++i)
+		{
+			UINT objectIndex = m_pObjectIndices[pNODE->FirstObject + i];
+			const SceneBounds& BOUNDS = m_pBounds[objectIndex];
+
+			// |ORIGIN + t * DIRECTION - CENTER| = RADIUS   .
+			Vector3 m(ORIGIN.x - BOUNDS.Center.x, ORIGIN.y - BOUNDS.Center.y, ORIGIN.z - BOUNDS.Center.z);
+			float b = m.x * DIRECTION.x + m.y * DIRECTION.y + m.z * DIRECTION.z;
+			float c = m.x * m.x + m.y * m.y + m.z * m.z - BOUNDS.Radius * BOUNDS.Radius;
+			if (c > 0.0f && b > 0.0f)
+			{
+				continue;
+			}
+
+			float discriminant = b * b - DIRECTION_LENGTH_SQUARE * c;
+			if (discriminant < 0.0f)
+			{
+				continue;
+			}
+
+			float t = (-b - sqrtf(discriminant)) / DIRECTION_LENGTH_SQUARE;
+			if (t > MAX_T)
+			{
+				continue;
+			}
+
+			pOutObjectIndices[hitCount] = objectIndex;
+			++hitCount;
+		}
+	}
+
+	return hitCount;
+}
+
+void SceneBVH::Cleanup()
+{
+	m_OrderedCuller.Cleanup();
+
+	if (m_pNodes)
+	{
+		free(m_pNodes);
+		m_pNodes = nullptr;
+	}
+	if (m_pTraversalStack)
+	{
+		free(m_pTraversalStack);
+		m_pTraversalStack = nullptr;
+	}
+	if (m_pBounds)
+	{
+		free(m_pBounds);
+		m_pBounds = nullptr;
+	}
+	if (m_pObjectIndices)
+	{
+		free(m_pObjectIndices);
+		m_pObjectIndices = nullptr;
+	}
+	if (m_pObjectPositions)
+	{
+		free(m_pObjectPositions);
+		m_pObjectPositions = nullptr;
+	}
+	if (m_pLeafNodeIndices)
+	{
+		free(m_pLeafNodeIndices);
+		m_pLeafNodeIndices = nullptr;
+	}
+	if (m_pOrderedVisibility)
+	{
+		free(m_pOrderedVisibility);
+		m_pOrderedVisibility = nullptr;
+	}
+
+	m_NodeCount = 0;
+	m_ObjectCount = 0;
+	m_MaxObjectCount = 0;
+	m_BuildRootArea = 0.0f;
+}
+
+void SceneBVH::getObjectBox(UINT objectIndex, Vector3* pMin, Vector3* pMax)
+{
+	// sphere, AABB   ξ ray(sphere) frustum(sphere + AABB) query  .
+	const SceneBounds& BOUNDS = m_pBounds[objectIndex];
+	const float HALF_X = (BOUNDS.Extents.x > BOUNDS.Radius ? BOUNDS.Extents.x : BOUNDS.Radius);
+	const float HALF_Y = (BOUNDS.Extents.y > BOUNDS.Radius ? BOUNDS.Extents.y : BOUNDS.Radius);
+	const float HALF_Z = (BOUNDS.Extents.z > BOUNDS.Radius ? BOUNDS.Extents.z : BOUNDS.Radius);
+
+	*pMin = Vector3(BOUNDS.Center.x - HALF_X, BOUNDS.Center.y - HALF_Y, BOUNDS.Center.z - HALF_Z);
+	*pMax = Vector3(BOUNDS.Center.x + HALF_X, BOUNDS.Center.y + HALF_Y, BOUNDS.Center.z + HALF_Z);
+}
+
+void SceneBVH::updateNodeBounds(UINT nodeIndex)
+{
+	SceneBVHNode* pNode = m_pNodes + nodeIndex;
+
+	if (pNode->LeftChild)
+	{
+		const SceneBVHNode* pLEFT = m_pNodes + pNode->LeftChild;
+		const SceneBVHNode* pRIGHT = pLEFT + 1;
+
+		pNode->Min = pLEFT->Min;
+		pNode->Max = pLEFT->Max;
+		ExpandBox(&pNode->Min, &pNode->Max, pRIGHT->Min, pRIGHT->Max);
+		return;
+	}
+
+	Vector3 objectMin;
+	Vector3 objectMax;
+	getObjectBox(m_pObjectIndices[pNode->FirstObject], &pNode->Min, &pNode->Max);
+	for (UINT i = 1; i < pNode->ObjectCount; ++i)
+	{
+		getObjectBox(m_pObjectIndices[pNode->FirstObject + i], &objectMin, &objectMax);
+		ExpandBox(&pNode->Min, &pNode->Max, objectMin, objectMax);
+	}
+}
+
+void SceneBVH::splitNode(UINT nodeIndex)
+{
+	SceneBVHNode* pNode = m_pNodes + nodeIndex;
+	if (pNode->ObjectCount <= SCENE_BVH_MAX_LEAF_OBJECT_COUNT)
+	{
+		return;
+	}
+
+	const UINT FIRST = pNode->FirstObject;
+	const UINT COUNT = pNode->ObjectCount;
+
+	// ߽  bin .
+	Vector3 centroidMin = m_pBounds[m_pObjectIndices[FIRST]].Center;
+	Vector3 centroidMax = centroidMin;
+	for (UINT i = 1; i < COUNT; ++i)
+	{
+		const Vector3& CENTER = m_pBounds[m_pObjectIndices[FIRST + i]].Center;
+		ExpandBox(&centroidMin, &centroidMax, CENTER, CENTER);
+	}
+
+	int bestAxis = -1;
+	UINT bestBin = 0;
+	float bestCost = FLT_MAX;
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const float AXIS_MIN = GetAxis(centroidMin, axis);
+		const float AXIS_MAX = GetAxis(centroidMax, axis);
+		if (AXIS_MAX - AXIS_MIN < 1e-6f)
+		{
+			continue;
+		}
+
+		const float BIN_SCALE = (float)SCENE_BVH_BIN_COUNT / (AXIS_MAX - AXIS_MIN);
+		UINT pBinCounts[SCENE_BVH_BIN_COUNT] = { 0, };
+		Vector3 pBinMins[SCENE_BVH_BIN_COUNT];
+		Vector3 pBinMaxs[SCENE_BVH_BIN_COUNT];
+		for (UINT bin = 0; bin < SCENE_BVH_BIN_COUNT; ++bin)
+		{
+			pBinMins[bin] = Vector3(FLT_MAX);
+			pBinMaxs[bin] = Vector3(-FLT_MAX);
+		}
+
+		for (UINT i = 0; i < COUNT; ++i)
+		{
+			UINT objectIndex = m_pObjectIndices[FIRST + i];
+			UINT bin = (UINT)((GetAxis(m_pBounds[objectIndex].Center, axis) - AXIS_MIN) * BIN_SCALE);
+			bin = (bin < SCENE_BVH_BIN_COUNT ? bin : SCENE_BVH_BIN_COUNT - 1);
+
+			Vector3 objectMin;
+			Vector3 objectMax;
+			getObjectBox(objectIndex, &objectMin, &objectMax);
+			ExpandBox(&pBinMins[bin], &pBinMaxs[bin], objectMin, objectMax);
+			++pBinCounts[bin];
+		}
+
+		// ʺ  / صΰ, ʺ ϸ鼭   ġ SAH  .
+		float pLeftAreas[SCENE_BVH_BIN_COUNT - 1];
+		UINT pLeftCounts[SCENE_BVH_BIN_COUNT - 1];
+		Vector3 accumMin(FLT_MAX);
+		Vector3 accumMax(-FLT_MAX);
+		UINT accumCount = 0;
+		for (UINT bin = 0; bin < SCENE_BVH_BIN_COUNT - 1; ++bin)
+		{
+			if (pBinCounts[bin])
+			{
+				ExpandBox(&accumMin, &accumMax, pBinMins[bin], pBinMaxs[bin]);
+				accumCount += pBinCounts[bin];
+			}
+			pLeftAreas[bin] = (accumCount ? surfaceArea(accumMin, accumMax) : 0.0f);
+			pLeftCounts[bin] = accumCount;
+		}
+
+		accumMin = Vector3(FLT_MAX);
+		accumMax = Vector3(-FLT_MAX);
+		accumCount = 0;
+		for (UINT bin = SCENE_BVH_BIN_COUNT - 1; bin > 0; --bin)
+		{
+			if (pBinCounts[bin])
+			{
+				ExpandBox(&accumMin, &accumMax, pBinMins[bin], pBinMaxs[bin]);
+				accumCount += pBinCounts[bin];
+			}
+			if (!accumCount || !pLeftCounts[bin - 1])
+			{
+				continue;
+			}
+
+			float cost = pLeftAreas[bin - 1] * (float)pLeftCounts[bin - 1] + surfaceArea(accumMin, accumMax) * (float)accumCount;
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestBin = bin;
+			}
+		}
+	}
+
+	UINT middle = FIRST + COUNT / 2;
+	if (bestAxis >= 0)
+	{
+		const float AXIS_MIN = GetAxis(centroidMin, bestAxis);
+		const float BIN_SCALE = (float)SCENE_BVH_BIN_COUNT / (GetAxis(centroidMax, bestAxis) - AXIS_MIN);
+
+		UINT left = FIRST;
+		UINT right = FIRST + COUNT;
+		while (left < right)
+		{
+			UINT bin = (UINT)((GetAxis(m_pBounds[m_pObjectIndices[left]].Center, bestAxis) - AXIS_MIN) * BIN_SCALE);
+			bin = (bin < SCENE_BVH_BIN_COUNT ? bin : SCENE_BVH_BIN_COUNT - 1);
+			if (bin < bestBin)
+			{
+				++left;
+			}
+			else
+			{
+				--right;
+				UINT temp = m_pObjectIndices[left];
+				m_pObjectIndices[left] = m_pObjectIndices[right];
+				m_pObjectIndices[right] = temp;
+			}
+		}
+
+		if (left > FIRST && left < FIRST + COUNT)
+		{
+			middle = left;
+		}
+	}
+	// ߽    ݾ .
+
+	UINT leftChild = m_NodeCount;
+	m_NodeCount += 2;
+
+	SceneBVHNode* pLeft = m_pNodes + leftChild;
+	pLeft->FirstObject = FIRST;
+	pLeft->ObjectCount = middle - FIRST;
+	pLeft->LeftChild = 0;
+	pLeft->Parent = nodeIndex;
+
+	SceneBVHNode* pRight = pLeft + 1;
+	pRight->FirstObject = middle;
+	pRight->ObjectCount = FIRST + COUNT - middle;
+	pRight->LeftChild = 0;
+	pRight->Parent = nodeIndex;
+
+	pNode->LeftChild = leftChild;
+
+	updateNodeBounds(leftChild);
+	updateNodeBounds(leftChild + 1);
+}
+
+float SceneBVH::surfaceArea(const Vector3& MIN, const Vector3& MAX)
+{
+	const float DX = MAX.x - MIN.x;
+	const float DY = MAX.y - MIN.y;
+	const float DZ = MAX.z - MIN.z;
+	return 2.0f * (DX * DY + DY * DZ + DZ * DX);
+}
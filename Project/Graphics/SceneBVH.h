@@ -0,0 +1,78 @@
+#pragma once
+
+#include "FrustumCuller.h"
+
+// scene   BVH. binned SAH ,  ̸ ش leaf root refit .
+// ü bounds BVH  FrustumCuller  ־, frustum query 迡 ģ leaf SIMD ˻.
+// query  traversal stack ϹǷ  忡 ȣ.
+
+static const UINT SCENE_BVH_MAX_LEAF_OBJECT_COUNT = 4;
+static const UINT SCENE_BVH_BIN_COUNT = 12;
+
+struct SceneBounds
+{
+	Vector3 Center;
+	float Radius;
+	Vector3 Extents;
+};
+struct SceneBVHNode
+{
+	Vector3 Min;
+	UINT FirstObject; // BVH  .  嵵 subtree ü  .
+	Vector3 Max;
+	UINT ObjectCount;
+	UINT LeftChild; // 0̸ leaf.  ڽ LeftChild + 1.
+	UINT Parent;
+};
+
+class SceneBVH
+{
+public:
+	SceneBVH() = default;
+	~SceneBVH() { Cleanup(); }
+
+	void Initialize(UINT maxObjectCount);
+
+	// SetObjectBounds ü bounds ä  Build.
+	void SetObjectBounds(UINT objectIndex, const SceneBounds& BOUNDS);
+	void Build(UINT objectCount);
+	//  ü bounds ٲٰ leaf root refit.
+	void Refit(UINT objectIndex, const SceneBounds& BOUNDS);
+	// refit  root build  ġ Ŀ true.
+	bool NeedsRebuild();
+
+	// visibility 迭 ü index  0 Ǵ 1 . ̴  ȯ.
+	UINT QueryFrustum(const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility);
+	UINT QuerySphere(const Vector3& CENTER, const float RADIUS, BYTE* pOutVisibility);
+	//  sphere ray  ü index . ĵǾ  .
+	UINT QueryRay(const Vector3& ORIGIN, const Vector3& DIRECTION, const float MAX_DISTANCE, UINT* pOutObjectIndices, UINT maxObjectCount);
+
+	void Cleanup();
+
+	inline UINT GetObjectCount() { return m_ObjectCount; }
+	inline UINT GetMaxObjectCount() { return m_MaxObjectCount; }
+	inline UINT GetNodeCount() { return m_NodeCount; }
+
+protected:
+	void getObjectBox(UINT objectIndex, Vector3* pMin, Vector3* pMax);
+	void updateNodeBounds(UINT nodeIndex);
+	void splitNode(UINT nodeIndex);
+	float surfaceArea(const Vector3& MIN, const Vector3& MAX);
+
+private:
+	SceneBVHNode* m_pNodes = nullptr;
+	UINT m_NodeCount = 0;
+
+	SceneBounds* m_pBounds = nullptr;		// ü .
+	UINT* m_pObjectIndices = nullptr;		// BVH  -> ü index.
+	UINT* m_pObjectPositions = nullptr;		// ü index -> BVH .
+	UINT* m_pLeafNodeIndices = nullptr;		// ü index -> leaf node.
+	BYTE* m_pOrderedVisibility = nullptr;	// BVH  scratch.
+	UINT* m_pTraversalStack = nullptr;
+
+	FrustumCuller m_OrderedCuller;
+
+	UINT m_MaxObjectCount = 0;
+	UINT m_ObjectCount = 0;
+	float m_BuildRootArea = 0.0f;
+};
@@ -129,7 +129,9 @@ void ShadowMap::Update(LightProperty& property, Camera& lightCam, Camera& mainCa
 				pShadowGlobalConstantData->ViewProjection = (lightSectionView * lightSectionProjection).Transpose();
 
 				m_ShadowConstantsBufferDataForGS.ViewProjects[i] = pShadowGlobalConstantData->ViewProjection;
+				ExtractFrustumPlanes(lightSectionView * lightSectionProjection, &m_pShadowFrustums[i]);
 			}
+			m_ShadowFrustumCount = 4;
 
 			mainCamera.bUseFirstPersonView = bOriginalFPS;
 		}
@@ -169,7 +171,9 @@ void ShadowMap::Update(LightProperty& property, Camera& lightCam, Camera& mainCa
 				pShadowGlobalConstantData->ViewProjection = (lightView * lightProjection).Transpose();
 
 				m_ShadowConstantsBufferDataForGS.ViewProjects[i] = pShadowGlobalConstantData->ViewProjection;
+				ExtractFrustumPlanes(lightView * lightProjection, &m_pShadowFrustums[i]);
 			}
+			m_ShadowFrustumCount = 6;
 		}
 		break;
 
@@ -184,15 +188,19 @@ void ShadowMap::Update(LightProperty& property, Camera& lightCam, Camera& mainCa
 			pShadowGlobalConstantData->Projection = lightProjection.Transpose();
 			pShadowGlobalConstantData->InverseProjection = lightProjection.Invert().Transpose();
 			pShadowGlobalConstantData->ViewProjection = (lightView * lightProjection).Transpose();
+
+			ExtractFrustumPlanes(lightView * lightProjection, &m_pShadowFrustums[0]);
+			m_ShadowFrustumCount = 1;
 		}
 		break;
 
 		default:
+			m_ShadowFrustumCount = 0;
 			break;
 	}
 }
 
-void ShadowMap::Render(std::vector<Model*>* pRenderObjects)
+void ShadowMap::Render(std::vector<Model*>* pRenderObjects, const BYTE* pCasterVisibility)
 {
 	_ASSERT(m_pRenderer);
 
@@ -200,8 +208,6 @@ void ShadowMap::Render(std::vector<Model*>* pRenderObjects)
 	ConstantBufferManager* pConstantBufferManager = m_pRenderer->GetConstantBufferManager();
 
 	ID3D12GraphicsCommandList* pCommandList = m_pRenderer->GetCommandList();
-	ConstantBufferPool* pShadowConstantBufferGSPool = pConstantBufferManager->GetConstantBufferPool(ConstantBufferType_ShadowConstant);
-	ConstantBufferPool* pShadowConstantBufferPool = pConstantBufferManager->GetConstantBufferPool(ConstantBufferType_GlobalConstant);
 	const UINT DSV_DESCRIPTOR_SIZE = pResourceManager->DSVDescriptorSize;
 	const UINT CBV_SRV_UAV_DESCRIPTOR_SIZE = pResourceManager->CBVSRVUAVDescriptorSize;
 
@@ -248,21 +254,16 @@ void ShadowMap::Render(std::vector<Model*>* pRenderObjects)
 	pCommandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
 
 
-	CBInfo* pShadowCBForGS = pShadowConstantBufferGSPool->AllocCB();
-	CBInfo* pShadowCB = pShadowConstantBufferPool->AllocCB();
-
-	// Upload constant buffer(mesh, material).
-	BYTE* pShadowGSConstMem = pShadowCBForGS->pSystemMemAddr;
-	BYTE* pShadowConstMem = pShadowCB->pSystemMemAddr;
-	memcpy(pShadowGSConstMem, &m_ShadowConstantsBufferDataForGS, sizeof(ShadowConstant));
-	memcpy(pShadowConstMem, &m_ShadowConstantBufferDatas[0], sizeof(GlobalConstant));
+	// root CBVθ Ƿ descriptor  ring ٷ ø.
+	D3D12_GPU_VIRTUAL_ADDRESS shadowConstantForGSAddr = pConstantBufferManager->UploadConstant(&m_ShadowConstantsBufferDataForGS, sizeof(ShadowConstant));
+	D3D12_GPU_VIRTUAL_ADDRESS shadowConstantAddr = pConstantBufferManager->UploadConstant(&m_ShadowConstantBufferDatas[0], sizeof(GlobalConstant));
 
 
 	for (UINT64 i = 0, size = pRenderObjects->size(); i < size; ++i)
 	{
 		Model* pModel = (*pRenderObjects)[i];
 
-		if (!pModel->bIsVisible || !pModel->bCastShadow)
+		if (!pModel->bIsVisible || !pModel->bCastShadow || (pCasterVisibility && !pCasterVisibility[i]))
 		{
 			continue;
 		}
@@ -276,11 +277,11 @@ void ShadowMap::Render(std::vector<Model*>* pRenderObjects)
 				
 				if ((m_LightType & m_TOTAL_LIGHT_TYPE) == LIGHT_DIRECTIONAL || (m_LightType & m_TOTAL_LIGHT_TYPE) == LIGHT_POINT)
 				{
-					pCommandList->SetGraphicsRootConstantBufferView(1, pShadowCBForGS->GPUMemAddr);
+					pCommandList->SetGraphicsRootConstantBufferView(1, shadowConstantForGSAddr);
 				}
 				else
 				{
-					pCommandList->SetGraphicsRootConstantBufferView(1, pShadowCB->GPUMemAddr);
+					pCommandList->SetGraphicsRootConstantBufferView(1, shadowConstantAddr);
 				}
 				
 				pModel->Render(pso);
@@ -294,11 +295,11 @@ void ShadowMap::Render(std::vector<Model*>* pRenderObjects)
 				
 				if ((m_LightType & m_TOTAL_LIGHT_TYPE) == LIGHT_DIRECTIONAL || (m_LightType & m_TOTAL_LIGHT_TYPE) == LIGHT_POINT)
 				{
-					pCommandList->SetGraphicsRootConstantBufferView(1, pShadowCBForGS->GPUMemAddr);
+					pCommandList->SetGraphicsRootConstantBufferView(1, shadowConstantForGSAddr);
 				}
 				else
 				{
-					pCommandList->SetGraphicsRootConstantBufferView(1, pShadowCB->GPUMemAddr);
+					pCommandList->SetGraphicsRootConstantBufferView(1, shadowConstantAddr);
 				}
 				
 				pCharacter->Render((eRenderPSOType)(pso + 1));
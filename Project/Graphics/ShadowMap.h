@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Camera.h"
+#include "FrustumCuller.h"
 #include "../Renderer/ConstantDataType.h"
 #include "../Model/SkinnedMeshModel.h"
 #include "../Renderer/TextureManager.h"
@@ -17,7 +18,8 @@ public:
 
 	void Update(LightProperty& property, Camera& lightCam, Camera& mainCamera);
 
-	void Render(std::vector<Model*>* pRenderObjects);
+	// pCasterVisibility  0 ü ǳʶ.
+	void Render(std::vector<Model*>* pRenderObjects, const BYTE* pCasterVisibility = nullptr);
 
 	void Cleanup();
 
@@ -30,6 +32,8 @@ public:
 
 	inline GlobalConstant* GetShadowConstantsBufferDataPtr() { return m_ShadowConstantBufferDatas; }
 	inline ShadowConstant* GetShadowConstantBufferDataForGSPtr() { return &m_ShadowConstantsBufferDataForGS; }
+	inline const Frustum* GetShadowFrustums() { return m_pShadowFrustums; }
+	inline UINT GetShadowFrustumCount() { return m_ShadowFrustumCount; }
 
 	void SetShadowWidth(const UINT WIDTH);
 	void SetShadowHeight(const UINT HEIGHT);
@@ -61,4 +65,6 @@ private:
 	};
 	GlobalConstant m_ShadowConstantBufferDatas[6];	 // spot, point, direc => 0, 6, 4 .
 	ShadowConstant m_ShadowConstantsBufferDataForGS; // 2 ̻ view  ϴ    geometry ;
+	Frustum m_pShadowFrustums[6];					 // caster culling. view projection ϳ.
+	UINT m_ShadowFrustumCount = 0;
 };
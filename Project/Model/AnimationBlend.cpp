@@ -0,0 +1,291 @@
+#include "../pch.h"
+#include "AnimationBlend.h"
+#include <xmmintrin.h>
+
+// 4 bone ó.   lane weight 0, ׵  ä  .
+
+static inline __m128 LoadWeights(const float WEIGHT, const float* pBONE_WEIGHTS, const UINT64 FIRST_BONE, const UINT LANE_COUNT)
+{
+	__m128 weights;
+	if (pBONE_WEIGHTS)
+	{
+		if (LANE_COUNT == 4)
+		{
+			weights = _mm_loadu_ps(pBONE_WEIGHTS + FIRST_BONE);
+		}
+		else
+		{
+			alignas(16) float pTemp[4] = { };
+			for (UINT lane = 0; lane < LANE_COUNT; ++lane)
+			{
+				pTemp[lane] = pBONE_WEIGHTS[FIRST_BONE + lane];
+			}
+			weights = _mm_load_ps(pTemp);
+		}
+		weights = _mm_mul_ps(weights, _mm_set1_ps(WEIGHT));
+	}
+	else
+	{
+		alignas(16) const float pLANE_MASK[4] = { 1.0f, (LANE_COUNT > 1 ? 1.0f : 0.0f), (LANE_COUNT > 2 ? 1.0f : 0.0f), (LANE_COUNT > 3 ? 1.0f : 0.0f) };
+		weights = _mm_mul_ps(_mm_load_ps(pLANE_MASK), _mm_set1_ps(WEIGHT));
+	}
+
+	return weights;
+}
+
+// Vector3 4(48byte) ״ xmm 3. lane  (x0 y0 z0 x1)(y1 z1 x2 y2)(z2 x3 y3 z3).
+static inline void LoadVectors(const Vector3* pSRC, const UINT LANE_COUNT, __m128* pOutVectors)
+{
+	const float* pFloats = &pSRC->x;
+	if (LANE_COUNT == 4)
+	{
+		pOutVectors[0] = _mm_loadu_ps(pFloats);
+		pOutVectors[1] = _mm_loadu_ps(pFloats + 4);
+		pOutVectors[2] = _mm_loadu_ps(pFloats + 8);
+		return;
+	}
+
+	alignas(16) float pTemp[12] = { };
+	for (UINT i = 0, end = LANE_COUNT * 3; i < end; ++i)
+	{
+		pTemp[i] = pFloats[i];
+	}
+	pOutVectors[0] = _mm_load_ps(pTemp);
+	pOutVectors[1] = _mm_load_ps(pTemp + 4);
+	pOutVectors[2] = _mm_load_ps(pTemp + 8);
+}
+
+static inline void StoreVectors(const __m128* pVECTORS, const UINT LANE_COUNT, Vector3* pDest)
+{
+	float* pFloats = &pDest->x;
+	if (LANE_COUNT == 4)
+	{
+		_mm_storeu_ps(pFloats, pVECTORS[0]);
+		_mm_storeu_ps(pFloats + 4, pVECTORS[1]);
+		_mm_storeu_ps(pFloats + 8, pVECTORS[2]);
+		return;
+	}
+
+	alignas(16) float pTemp[12];
+	_mm_store_ps(pTemp, pVECTORS[0]);
+	_mm_store_ps(pTemp + 4, pVECTORS[1]);
+	_mm_store_ps(pTemp + 8, pVECTORS[2]);
+	for (UINT i = 0, end = LANE_COUNT * 3; i < end; ++i)
+	{
+		pFloats[i] = pTemp[i];
+	}
+}
+
+// bone weight LoadVectors lane ġ ° ħ.
+static inline void ExpandVectorWeights(const __m128 WEIGHTS, __m128* pOutWeights)
+{
+	pOutWeights[0] = _mm_shuffle_ps(WEIGHTS, WEIGHTS, _MM_SHUFFLE(1, 0, 0, 0));
+	pOutWeights[1] = _mm_shuffle_ps(WEIGHTS, WEIGHTS, _MM_SHUFFLE(2, 2, 1, 1));
+	pOutWeights[2] = _mm_shuffle_ps(WEIGHTS, WEIGHTS, _MM_SHUFFLE(3, 3, 3, 2));
+}
+
+// quaternion 4 -> SoA(x, y, z, w).  lane ׵.
+static inline void LoadRotations(const Quaternion* pSRC, const UINT LANE_COUNT, __m128* pOutX, __m128* pOutY, __m128* pOutZ, __m128* pOutW)
+{
+	const __m128 IDENTITY = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	__m128 x = _mm_loadu_ps(&pSRC[0].x);
+	__m128 y = (LANE_COUNT > 1 ? _mm_loadu_ps(&pSRC[1].x) : IDENTITY);
+	__m128 z = (LANE_COUNT > 2 ? _mm_loadu_ps(&pSRC[2].x) : IDENTITY);
+	__m128 w = (LANE_COUNT > 3 ? _mm_loadu_ps(&pSRC[3].x) : IDENTITY);
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+
+	*pOutX = x;
+	*pOutY = y;
+	*pOutZ = z;
+	*pOutW = w;
+}
+
+static inline void StoreRotations(__m128 x, __m128 y, __m128 z, __m128 w, const UINT LANE_COUNT, Quaternion* pDest)
+{
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+
+	const __m128 pROTATIONS[4] = { x, y, z, w };
+	for (UINT lane = 0; lane < LANE_COUNT; ++lane)
+	{
+		_mm_storeu_ps(&pDest[lane].x, pROTATIONS[lane]);
+	}
+}
+
+static inline void NormalizeRotations(__m128* pX, __m128* pY, __m128* pZ, __m128* pW)
+{
+	__m128 lengthSquare = _mm_mul_ps(*pX, *pX);
+	lengthSquare = _mm_add_ps(lengthSquare, _mm_mul_ps(*pY, *pY));
+	lengthSquare = _mm_add_ps(lengthSquare, _mm_mul_ps(*pZ, *pZ));
+	lengthSquare = _mm_add_ps(lengthSquare, _mm_mul_ps(*pW, *pW));
+
+	const __m128 INVERSE_LENGTH = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSquare));
+	*pX = _mm_mul_ps(*pX, INVERSE_LENGTH);
+	*pY = _mm_mul_ps(*pY, INVERSE_LENGTH);
+	*pZ = _mm_mul_ps(*pZ, INVERSE_LENGTH);
+	*pW = _mm_mul_ps(*pW, INVERSE_LENGTH);
+}
+
+void AnimationPose::Resize(const UINT64 BONE_COUNT)
+{
+	if (Positions.size() < BONE_COUNT)
+	{
+		Positions.resize(BONE_COUNT);
+		Rotations.resize(BONE_COUNT);
+		Scales.resize(BONE_COUNT, Vector3(1.0f));
+	}
+}
+
+void BlendPoses(AnimationPose* pDest, const AnimationPose& SRC, const float WEIGHT, const float* pBONE_WEIGHTS, const UINT64 BONE_COUNT)
+{
+	_ASSERT(pDest);
+	_ASSERT(pDest->Positions.size() >= BONE_COUNT);
+	_ASSERT(SRC.Positions.size() >= BONE_COUNT);
+
+	if (WEIGHT <= 0.0f)
+	{
+		return;
+	}
+
+	const __m128 ZERO = _mm_setzero_ps();
+	const __m128 SIGN_MASK = _mm_set1_ps(-0.0f);
+
+	for (UINT64 boneID = 0; boneID < BONE_COUNT; boneID += 4)
+	{
+		const UINT LANE_COUNT = (BONE_COUNT - boneID < 4 ? (UINT)(BONE_COUNT - boneID) : 4);
+
+		const __m128 WEIGHTS = LoadWeights(WEIGHT, pBONE_WEIGHTS, boneID, LANE_COUNT);
+		// mask  bone  ǳʶ.
+		if (_mm_movemask_ps(_mm_cmpgt_ps(WEIGHTS, ZERO)) == 0)
+		{
+			continue;
+		}
+
+		// translation, scale. dest + (src - dest) * w.
+		__m128 pVectorWeights[3];
+		ExpandVectorWeights(WEIGHTS, pVectorWeights);
+		{
+			__m128 pDestVectors[3];
+			__m128 pSrcVectors[3];
+			LoadVectors(&pDest->Positions[boneID], LANE_COUNT, pDestVectors);
+			LoadVectors(&SRC.Positions[boneID], LANE_COUNT, pSrcVectors);
+			for (int i = 0; i < 3; ++i)
+			{
+				pDestVectors[i] = _mm_add_ps(pDestVectors[i], _mm_mul_ps(_mm_sub_ps(pSrcVectors[i], pDestVectors[i]), pVectorWeights[i]));
+			}
+			StoreVectors(pDestVectors, LANE_COUNT, &pDest->Positions[boneID]);
+
+			LoadVectors(&pDest->Scales[boneID], LANE_COUNT, pDestVectors);
+			LoadVectors(&SRC.Scales[boneID], LANE_COUNT, pSrcVectors);
+			for (int i = 0; i < 3; ++i)
+			{
+				pDestVectors[i] = _mm_add_ps(pDestVectors[i], _mm_mul_ps(_mm_sub_ps(pSrcVectors[i], pDestVectors[i]), pVectorWeights[i]));
+			}
+			StoreVectors(pDestVectors, LANE_COUNT, &pDest->Scales[boneID]);
+		}
+
+		// rotation.   src ȣ  ª  .
+		__m128 dx, dy, dz, dw;
+		__m128 sx, sy, sz, sw;
+		LoadRotations(&pDest->Rotations[boneID], LANE_COUNT, &dx, &dy, &dz, &dw);
+		LoadRotations(&SRC.Rotations[boneID], LANE_COUNT, &sx, &sy, &sz, &sw);
+
+		__m128 dot = _mm_mul_ps(dx, sx);
+		dot = _mm_add_ps(dot, _mm_mul_ps(dy, sy));
+		dot = _mm_add_ps(dot, _mm_mul_ps(dz, sz));
+		dot = _mm_add_ps(dot, _mm_mul_ps(dw, sw));
+		const __m128 SIGN = _mm_and_ps(dot, SIGN_MASK);
+
+		dx = _mm_add_ps(dx, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(sx, SIGN), dx), WEIGHTS));
+		dy = _mm_add_ps(dy, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(sy, SIGN), dy), WEIGHTS));
+		dz = _mm_add_ps(dz, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(sz, SIGN), dz), WEIGHTS));
+		dw = _mm_add_ps(dw, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(sw, SIGN), dw), WEIGHTS));
+		NormalizeRotations(&dx, &dy, &dz, &dw);
+
+		StoreRotations(dx, dy, dz, dw, LANE_COUNT, &pDest->Rotations[boneID]);
+	}
+}
+
+void AddPoses(AnimationPose* pDest, const AnimationPose& SRC, const AnimationPose& REFERENCE, const float WEIGHT, const float* pBONE_WEIGHTS, const UINT64 BONE_COUNT)
+{
+	_ASSERT(pDest);
+	_ASSERT(pDest->Positions.size() >= BONE_COUNT);
+	_ASSERT(SRC.Positions.size() >= BONE_COUNT);
+	_ASSERT(REFERENCE.Positions.size() >= BONE_COUNT);
+
+	if (WEIGHT <= 0.0f)
+	{
+		return;
+	}
+
+	const __m128 ZERO = _mm_setzero_ps();
+	const __m128 ONE = _mm_set1_ps(1.0f);
+	const __m128 SIGN_MASK = _mm_set1_ps(-0.0f);
+
+	for (UINT64 boneID = 0; boneID < BONE_COUNT; boneID += 4)
+	{
+		const UINT LANE_COUNT = (BONE_COUNT - boneID < 4 ? (UINT)(BONE_COUNT - boneID) : 4);
+
+		const __m128 WEIGHTS = LoadWeights(WEIGHT, pBONE_WEIGHTS, boneID, LANE_COUNT);
+		if (_mm_movemask_ps(_mm_cmpgt_ps(WEIGHTS, ZERO)) == 0)
+		{
+			continue;
+		}
+
+		// translation, scale. dest + (src - reference) * w.
+		__m128 pVectorWeights[3];
+		ExpandVectorWeights(WEIGHTS, pVectorWeights);
+		{
+			__m128 pDestVectors[3];
+			__m128 pSrcVectors[3];
+			__m128 pReferenceVectors[3];
+			LoadVectors(&pDest->Positions[boneID], LANE_COUNT, pDestVectors);
+			LoadVectors(&SRC.Positions[boneID], LANE_COUNT, pSrcVectors);
+			LoadVectors(&REFERENCE.Positions[boneID], LANE_COUNT, pReferenceVectors);
+			for (int i = 0; i < 3; ++i)
+			{
+				pDestVectors[i] = _mm_add_ps(pDestVectors[i], _mm_mul_ps(_mm_sub_ps(pSrcVectors[i], pReferenceVectors[i]), pVectorWeights[i]));
+			}
+			StoreVectors(pDestVectors, LANE_COUNT, &pDest->Positions[boneID]);
+
+			LoadVectors(&pDest->Scales[boneID], LANE_COUNT, pDestVectors);
+			LoadVectors(&SRC.Scales[boneID], LANE_COUNT, pSrcVectors);
+			LoadVectors(&REFERENCE.Scales[boneID], LANE_COUNT, pReferenceVectors);
+			for (int i = 0; i < 3; ++i)
+			{
+				pDestVectors[i] = _mm_add_ps(pDestVectors[i], _mm_mul_ps(_mm_sub_ps(pSrcVectors[i], pReferenceVectors[i]), pVectorWeights[i]));
+			}
+			StoreVectors(pDestVectors, LANE_COUNT, &pDest->Scales[boneID]);
+		}
+
+		__m128 sx, sy, sz, sw;
+		__m128 rx, ry, rz, rw;
+		LoadRotations(&SRC.Rotations[boneID], LANE_COUNT, &sx, &sy, &sz, &sw);
+		LoadRotations(&REFERENCE.Rotations[boneID], LANE_COUNT, &rx, &ry, &rz, &rw);
+
+		// delta = conjugate(reference) * src. (Hamilton )
+		__m128 ex = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(rw, sx), _mm_mul_ps(rx, sw)), _mm_sub_ps(_mm_mul_ps(ry, sz), _mm_mul_ps(rz, sy)));
+		__m128 ey = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(rw, sy), _mm_mul_ps(rx, sz)), _mm_add_ps(_mm_mul_ps(ry, sw), _mm_mul_ps(rz, sx)));
+		__m128 ez = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, sz), _mm_mul_ps(rx, sy)), _mm_sub_ps(_mm_mul_ps(ry, sx), _mm_mul_ps(rz, sw)));
+		__m128 ew = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rw, sw), _mm_mul_ps(rx, sx)), _mm_add_ps(_mm_mul_ps(ry, sy), _mm_mul_ps(rz, sz)));
+
+		// nlerp(identity, delta, w). w   delta  ª .
+		const __m128 SIGN = _mm_and_ps(ew, SIGN_MASK);
+		ex = _mm_mul_ps(_mm_xor_ps(ex, SIGN), WEIGHTS);
+		ey = _mm_mul_ps(_mm_xor_ps(ey, SIGN), WEIGHTS);
+		ez = _mm_mul_ps(_mm_xor_ps(ez, SIGN), WEIGHTS);
+		ew = _mm_add_ps(ONE, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(ew, SIGN), ONE), WEIGHTS));
+		NormalizeRotations(&ex, &ey, &ez, &ew);
+
+		// dest = dest * delta. ķδ R(delta) * R(dest)̹Ƿ bone   .
+		__m128 dx, dy, dz, dw;
+		LoadRotations(&pDest->Rotations[boneID], LANE_COUNT, &dx, &dy, &dz, &dw);
+
+		__m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dw, ex), _mm_mul_ps(dx, ew)), _mm_sub_ps(_mm_mul_ps(dy, ez), _mm_mul_ps(dz, ey)));
+		__m128 y = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(dw, ey), _mm_mul_ps(dx, ez)), _mm_add_ps(_mm_mul_ps(dy, ew), _mm_mul_ps(dz, ex)));
+		__m128 z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dw, ez), _mm_mul_ps(dx, ey)), _mm_sub_ps(_mm_mul_ps(dz, ew), _mm_mul_ps(dy, ex)));
+		__m128 w = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(dw, ew), _mm_mul_ps(dx, ex)), _mm_add_ps(_mm_mul_ps(dy, ey), _mm_mul_ps(dz, ez)));
+		NormalizeRotations(&x, &y, &z, &w);
+
+		StoreRotations(x, y, z, w, LANE_COUNT, &pDest->Rotations[boneID]);
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+#include <directxtk12/SimpleMath.h>
+
+// AnimationData SoA pose ο  pose ۿ layer blend.
+// ۴ bone    ĿǷ  frame Ҵ .
+
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Quaternion;
+
+enum eAnimationLayerMode
+{
+	AnimationLayerMode_Override = 0, // Ʒ   clip  weightŭ ű.
+	AnimationLayerMode_Additive,	 // clip ù pose ̸ weightŭ .
+};
+
+struct AnimationPose
+{
+	//  .
+	void Resize(const UINT64 BONE_COUNT);
+
+	std::vector<Vector3> Positions;
+	std::vector<Quaternion> Rotations;
+	std::vector<Vector3> Scales;
+};
+
+struct AnimationLayer
+{
+	int ClipID = -1;
+	eAnimationLayerMode Mode = AnimationLayerMode_Override;
+	float Weight = 0.0f;
+	std::vector<float> BoneWeights; // bone mask.    1.
+	AnimationPose ReferencePose;	// additive  pose.
+};
+
+// pDest = lerp(pDest, SRC, WEIGHT * pBONE_WEIGHTS[bone]). rotation   nlerp.
+// pBONE_WEIGHTS nullptr̸  bone WEIGHT.
+void BlendPoses(AnimationPose* pDest, const AnimationPose& SRC, const float WEIGHT, const float* pBONE_WEIGHTS, const UINT64 BONE_COUNT);
+
+// translation, scale (SRC - REFERENCE) * w ϰ,
+// rotation pDest * nlerp(identity, REFERENCE^-1 * SRC, w).  clip ذ Բ ϸ  clip .
+void AddPoses(AnimationPose* pDest, const AnimationPose& SRC, const AnimationPose& REFERENCE, const float WEIGHT, const float* pBONE_WEIGHTS, const UINT64 BONE_COUNT);
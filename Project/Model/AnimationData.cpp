@@ -1,126 +1,191 @@
-// #include <Eigen/Dense>
 #include "../pch.h"
 #include "../Util/Utility.h"
 #include "AnimationData.h"
+#include <xmmintrin.h>
+
+static inline __m128 MultiplyRow(const __m128 ROW, const __m128 M0, const __m128 M1, const __m128 M2, const __m128 M3)
+{
+	__m128 result = _mm_mul_ps(_mm_shuffle_ps(ROW, ROW, _MM_SHUFFLE(0, 0, 0, 0)), M0);
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(ROW, ROW, _MM_SHUFFLE(1, 1, 1, 1)), M1));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(ROW, ROW, _MM_SHUFFLE(2, 2, 2, 2)), M2));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(ROW, ROW, _MM_SHUFFLE(3, 3, 3, 3)), M3));
+	return result;
+}
+
+static inline void LoadMatrix(const Matrix& M, __m128* pOutRows)
+{
+	pOutRows[0] = _mm_loadu_ps(&M._11);
+	pOutRows[1] = _mm_loadu_ps(&M._21);
+	pOutRows[2] = _mm_loadu_ps(&M._31);
+	pOutRows[3] = _mm_loadu_ps(&M._41);
+}
+
+static inline void StoreMatrix(const __m128* pROWS, Matrix* pOutMatrix)
+{
+	_mm_storeu_ps(&pOutMatrix->_11, pROWS[0]);
+	_mm_storeu_ps(&pOutMatrix->_21, pROWS[1]);
+	_mm_storeu_ps(&pOutMatrix->_31, pROWS[2]);
+	_mm_storeu_ps(&pOutMatrix->_41, pROWS[3]);
+}
+
+// (*pA) * B. row-vector Ծ.
+static inline void MultiplyMatrix(const Matrix* pA, const __m128* pB_ROWS, __m128* pOutRows)
+{
+	pOutRows[0] = MultiplyRow(_mm_loadu_ps(&pA->_11), pB_ROWS[0], pB_ROWS[1], pB_ROWS[2], pB_ROWS[3]);
+	pOutRows[1] = MultiplyRow(_mm_loadu_ps(&pA->_21), pB_ROWS[0], pB_ROWS[1], pB_ROWS[2], pB_ROWS[3]);
+	pOutRows[2] = MultiplyRow(_mm_loadu_ps(&pA->_31), pB_ROWS[0], pB_ROWS[1], pB_ROWS[2], pB_ROWS[3]);
+	pOutRows[3] = MultiplyRow(_mm_loadu_ps(&pA->_41), pB_ROWS[0], pB_ROWS[1], pB_ROWS[2], pB_ROWS[3]);
+}
 
 Matrix AnimationClip::Key::GetTransform()
 {
 	return (Matrix::CreateScale(Scale) * Matrix::CreateFromQuaternion(Rotation) * Matrix::CreateTranslation(Position));
 }
 
-void AnimationData::Update(const int CLIP_ID, const int FRAME, const float DELTA_TIME)
+void AnimationClip::InitKeyTracks()
 {
-	TimeSinceLoaded += DELTA_TIME;
-
-	AnimationClip& clip = Clips[CLIP_ID];
-	float timeInTicks = (float)(TimeSinceLoaded * clip.TicksPerSec);
-	float animationTimeTicks = fmod(timeInTicks, (float)clip.Duration);
+	KeyTracks.resize(Keys.size());
 
-	// root bone id 0(ƴ  ).
+	for (UINT64 boneID = 0, totalBone = Keys.size(); boneID < totalBone; ++boneID)
 	{
-		const int ROOT_BONE_ID = 0;
-		
-		Vector3 interpolatedPos;
-		Vector3 interpolatedScale;
-		Quaternion interpolatedRot;
-		InterpolateKeyData(&interpolatedPos, &interpolatedRot, &interpolatedScale, &clip, 0, animationTimeTicks);
+		const std::vector<Key>& KEYS = Keys[boneID];
+		const UINT64 KEY_SIZE = KEYS.size();
+		KeyTrack& track = KeyTracks[boneID];
 
-		if (CLIP_ID == 0)
+		track.StartTime = (KEY_SIZE > 0 ? KEYS[0].Time : 0.0);
+		track.InverseStep = 0.0;
+		track.Cursor = 0;
+
+		if (KEY_SIZE < 2)
 		{
-			interpolatedPos.y = 0.0f;
-			BoneTransforms[ROOT_BONE_ID] = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(interpolatedRot) * Matrix::CreateTranslation(interpolatedPos);
+			continue;
 		}
-		else
+
+		//  key  ð + i * ݿ ִ Ȯ.
+		const double STEP = (KEYS[KEY_SIZE - 1].Time - track.StartTime) / (double)(KEY_SIZE - 1);
+		if (STEP <= 0.0)
+		{
+			continue;
+		}
+
+		const double TOLERANCE = STEP * 1e-3;
+		bool bUniform = true;
+		for (UINT64 i = 1; i < KEY_SIZE - 1; ++i)
+		{
+			if (fabs(KEYS[i].Time - (track.StartTime + STEP * (double)i)) > TOLERANCE)
+			{
+				bUniform = false;
+				break;
+			}
+		}
+
+		if (bUniform)
 		{
-			BoneTransforms[ROOT_BONE_ID] = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(interpolatedRot);
+			track.InverseStep = 1.0 / STEP;
 		}
 	}
+}
 
-	//  bone transform Ʈ.
-	// bone id θ->ڽ   Ǿ ֱ⿡ .
-	for (UINT64 boneID = 1, totalBone = BoneTransforms.size(); boneID < totalBone; ++boneID)
-	{
-		const int PARENT_ID = BoneParents[boneID];
+void AnimationData::Update(const int CLIP_ID, const int FRAME, const float DELTA_TIME)
+{
+	TimeSinceLoaded += DELTA_TIME;
+	m_EvaluatedBoneCount = 0;
 
-		Vector3 interpolatedPos;
-		Vector3 interpolatedScale;
-		Quaternion interpolatedRot;
-		InterpolateKeyData(&interpolatedPos, &interpolatedRot, &interpolatedScale, &clip, (const int)boneID, animationTimeTicks);
+	// mask  bone  local ȯ ״ Ƿ    Ǿ ־ .
+	m_bBoneMaskActive = (m_LOD.bUseBoneMask && !LODBoneIDs.empty() && m_LocalTransforms.size() >= BoneTransforms.size());
 
-		BoneTransforms[boneID] = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(interpolatedRot) * Matrix::CreateTranslation(interpolatedPos) * BoneTransforms[PARENT_ID];
+	updateCrossFade(CLIP_ID, DELTA_TIME);
+	if (m_LOD.UpdateInterval > 1)
+	{
+		updateLODPose(CLIP_ID);
 	}
+	else
+	{
+		evaluatePose(CLIP_ID);
+		m_bLODPoseValid = false;
+	}
+
+	buildLocalTransforms();
+	buildModelTransforms();
 }
 
 void AnimationData::UpdateForIK(const int CLIP_ID, const int FRAME)
 {
 	AnimationClip& clip = Clips[CLIP_ID];
-	float timeInTicks = (float)(TimeSinceLoaded * clip.TicksPerSec);
-	float animationTimeTicks = fmod(timeInTicks, (float)clip.Duration);
 
+	// m_Pose ̹ frame Update  ״.
+	for (UINT64 boneID = 0, totalBone = BoneTransforms.size(); boneID < totalBone; ++boneID)
 	{
-		const int ROOT_BONE_ID = 0;
+		m_Pose.Rotations[boneID] = Quaternion::Concatenate(m_Pose.Rotations[boneID], clip.IKRotations[boneID]);
+	}
 
-		Vector3 interpolatedPos;
-		Vector3 interpolatedScale;
-		Quaternion interpolatedRot;
-		InterpolateKeyData(&interpolatedPos, &interpolatedRot, &interpolatedScale, &clip, 0, animationTimeTicks);
+	buildLocalTransforms();
+	buildModelTransforms();
+}
 
-		Quaternion newRot = Quaternion::Concatenate(interpolatedRot, clip.IKRotations[ROOT_BONE_ID]);
-		//BoneTransforms[ROOT_BONE_ID] = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(newRot);
-		if (CLIP_ID == 0)
-		{
-			interpolatedPos.y = 0.0f;
-			BoneTransforms[ROOT_BONE_ID] = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(newRot) * Matrix::CreateTranslation(interpolatedPos);
-		}
-		else
-		{
-			BoneTransforms[ROOT_BONE_ID] = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(newRot);
-		}
+void AnimationData::ResetAllIKRotations(const int CLIP_ID)
+{
+	AnimationClip& clip = Clips[CLIP_ID];
+	for (UINT64 i = 0, end = clip.IKRotations.size(); i < end; ++i)
+	{
+		clip.IKRotations[i] = Quaternion();
 	}
+}
 
-	for (UINT64 boneID = 1, totalBone = BoneTransforms.size(); boneID < totalBone; ++boneID)
-	{
-		const int PARENT_ID = BoneParents[boneID];
+UINT AnimationData::AddLayer(const int CLIP_ID, const eAnimationLayerMode MODE, const float WEIGHT)
+{
+	_ASSERT(CLIP_ID >= 0 && (UINT64)CLIP_ID < Clips.size());
+
+	const UINT64 TOTAL_BONE = BoneTransforms.size();
+	m_Pose.Resize(TOTAL_BONE);
+	m_LayerPose.Resize(TOTAL_BONE);
 
-		Vector3 interpolatedPos;
-		Vector3 interpolatedScale;
-		Quaternion interpolatedRot;
-		InterpolateKeyData(&interpolatedPos, &interpolatedRot, &interpolatedScale, &clip, (const int)boneID, animationTimeTicks);
+	m_Layers.push_back(AnimationLayer());
+	AnimationLayer& layer = m_Layers.back();
+	layer.ClipID = CLIP_ID;
+	layer.Mode = MODE;
+	layer.Weight = WEIGHT;
 
-		Quaternion newRot = Quaternion::Concatenate(interpolatedRot, clip.IKRotations[boneID]);
-		BoneTransforms[boneID] = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(newRot) * Matrix::CreateTranslation(interpolatedPos) * BoneTransforms[PARENT_ID];
+	// additive clip  pose ̸ .
+	if (MODE == AnimationLayerMode_Additive)
+	{
+		layer.ReferencePose.Resize(TOTAL_BONE);
+		samplePose(CLIP_ID, 0.0f, &layer.ReferencePose);
 	}
+
+	return (UINT)(m_Layers.size() - 1);
 }
 
-void AnimationData::UpdateVelocity(const int CLIP_ID, const int FRAME)
+void AnimationData::SetLayerWeight(const UINT LAYER_INDEX, const float WEIGHT)
 {
-	AnimationClip& clip = Clips[CLIP_ID];
+	_ASSERT(LAYER_INDEX < m_Layers.size());
+	m_Layers[LAYER_INDEX].Weight = WEIGHT;
+}
 
-	const int ROOT_BONE_ID = 0;
-	std::vector<AnimationClip::Key>& keys = clip.Keys[ROOT_BONE_ID];
-	const UINT64 KEY_SIZE = keys.size();
-	AnimationClip::Key& key = keys[FRAME % KEY_SIZE];
+void AnimationData::SetLayerBoneMask(const UINT LAYER_INDEX, const int ROOT_BONE_ID, const float WEIGHT)
+{
+	_ASSERT(LAYER_INDEX < m_Layers.size());
+	_ASSERT(ROOT_BONE_ID >= 0 && (UINT64)ROOT_BONE_ID < BoneParents.size());
 
-	if (FRAME != 0)
-	{
-		Vector3 posDelta = key.Position - PrevKeyPos;
-		posDelta = Vector3::Transform(posDelta, DefaultTransform);
-		Velocity = posDelta.Length();
-	}
-	else
+	AnimationLayer& layer = m_Layers[LAYER_INDEX];
+	const UINT64 TOTAL_BONE = BoneParents.size();
+	layer.BoneWeights.assign(TOTAL_BONE, 0.0f);
+
+	// θ ׻ տ Ƿ     bone ü ä.
+	layer.BoneWeights[ROOT_BONE_ID] = WEIGHT;
+	for (UINT64 boneID = ROOT_BONE_ID + 1; boneID < TOTAL_BONE; ++boneID)
 	{
-		Velocity = 0.0f;
+		const int PARENT_ID = BoneParents[boneID];
+		if (PARENT_ID >= ROOT_BONE_ID && layer.BoneWeights[PARENT_ID] > 0.0f)
+		{
+			layer.BoneWeights[boneID] = WEIGHT;
+		}
 	}
-	PrevKeyPos = key.Position;
 }
 
-void AnimationData::ResetAllIKRotations(const int CLIP_ID)
+void AnimationData::ClearLayers()
 {
-	AnimationClip& clip = Clips[CLIP_ID];
-	for (UINT64 i = 0, end = clip.IKRotations.size(); i < end; ++i)
-	{
-		clip.IKRotations[i] = Quaternion();
-	}
+	m_Layers.clear();
 }
 
 void AnimationData::InterpolateKeyData(Vector3* pOutPosition, Quaternion* pOutRotation, Vector3* pOutScale, AnimationClip* pClip, const int BONE_ID, const float ANIMATION_TIME_TICK)
@@ -128,6 +193,12 @@ void AnimationData::InterpolateKeyData(Vector3* pOutPosition, Quaternion* pOutRo
 	_ASSERT(pOutScale);
 	_ASSERT(pClip);
 
+	if (pClip->Compressed.IsValid())
+	{
+		pClip->Compressed.SampleBone(BONE_ID, ANIMATION_TIME_TICK, pOutPosition, pOutRotation, pOutScale);
+		return;
+	}
+
 	std::vector<AnimationClip::Key>& keys = pClip->Keys[BONE_ID];
 	const UINT64 KEY_SIZE = keys.size();
 
@@ -154,6 +225,7 @@ void AnimationData::InterpolateKeyData(Vector3* pOutPosition, Quaternion* pOutRo
 	float t2 = (float)nextKey.Time;
 	float deltaTime = t2 - t1;
 	float factor = (ANIMATION_TIME_TICK - t1) / deltaTime;
+	factor = Clamp(factor, 0.0f, 1.0f); // ù key ,  key Ĵ  key .
 
 	// Calculate position data.
 	const Vector3& START_POS = curKey.Position;
@@ -164,7 +236,7 @@ void AnimationData::InterpolateKeyData(Vector3* pOutPosition, Quaternion* pOutRo
 	// Calculate rotation data.
 	const Quaternion& START_ROT = curKey.Rotation;
 	const Quaternion& END_ROT = nextKey.Rotation;
-	Quaternion interporlated = DirectX::XMQuaternionSlerp(START_ROT, END_ROT, factor);
+	Quaternion interporlated = Quaternion::Slerp(START_ROT, END_ROT, factor);
 	interporlated.Normalize();
 	*pOutRotation = interporlated;
 
@@ -180,19 +252,108 @@ Matrix AnimationData::Get(const int CLIP_ID, const int FRAME, const int BONE_ID)
 	return (InverseDefaultTransform * OffsetMatrices[BONE_ID] * BoneTransforms[BONE_ID] * InverseOffsetMatrices[0] * DefaultTransform);
 }
 
-Matrix AnimationData::GetRootBoneTransformWithoutLocalRot(const int CLIP_ID, const int FRAME)
+void AnimationData::PrepareClips()
 {
-	AnimationClip& clip = Clips[CLIP_ID];
+	const AnimationCompressionSettings COMPRESSION_SETTINGS;
+	for (UINT64 i = 0, size = Clips.size(); i < size; ++i)
+	{
+		AnimationClip& clip = Clips[i];
+		clip.InitKeyTracks();
+		if (clip.bPrepared)
+		{
+			continue;
+		}
+		clip.bPrepared = true;
+
+		// root ̵    key .
+		ExtractRootMotion(clip, InverseOffsetMatrices[0] * DefaultTransform, &clip.RootMotion);
+
+		UINT64 keyDataSize = 0;
+		for (UINT64 boneID = 0, totalBone = clip.Keys.size(); boneID < totalBone; ++boneID)
+		{
+			keyDataSize += clip.Keys[boneID].capacity() * sizeof(AnimationClip::Key);
+		}
+
+		//  Ѱ踦  ߸  key ״ .
+		if (!clip.Compressed.Initialize(clip, COMPRESSION_SETTINGS))
+		{
+			continue;
+		}
+
+		{
+			char szDebugString[256];
+			sprintf_s(szDebugString, 256, "Animation clip %s: %llu bytes -> %llu bytes. max error rot: %f, pos: %f, scale: %f\n",
+					  clip.Name.c_str(), keyDataSize, clip.Compressed.GetMemorySize(),
+					  clip.Compressed.GetMaxRotationError(), clip.Compressed.GetMaxTranslationError(), clip.Compressed.GetMaxScaleError());
+			OutputDebugStringA(szDebugString);
+		}
+
+		// root key frame  꿡  Ƿ .
+		for (UINT64 boneID = 1, totalBone = clip.Keys.size(); boneID < totalBone; ++boneID)
+		{
+			std::vector<AnimationClip::Key>().swap(clip.Keys[boneID]);
+		}
+	}
+}
 
+void AnimationData::InitSkinningTransforms()
+{
+	const UINT64 TOTAL_BONE = BoneTransforms.size();
+
+	m_SkinningPrefixes.resize(TOTAL_BONE);
+	for (UINT64 boneID = 0; boneID < TOTAL_BONE; ++boneID)
+	{
+		m_SkinningPrefixes[boneID] = InverseDefaultTransform * OffsetMatrices[boneID];
+	}
+	m_SkinningSuffix = InverseOffsetMatrices[0] * DefaultTransform;
+}
+
+void AnimationData::WriteSkinningMatrices(Matrix* pDest)
+{
+	_ASSERT(pDest);
+	_ASSERT(((UINT64)pDest & 15) == 0);
+	_ASSERT(m_SkinningPrefixes.size() == BoneTransforms.size());
+
+	// Get()   transposeؼ . upload heap write-combine̹Ƿ  ʰ stream storeθ ä.
+	const __m128 SUFFIX0 = _mm_loadu_ps(&m_SkinningSuffix._11);
+	const __m128 SUFFIX1 = _mm_loadu_ps(&m_SkinningSuffix._21);
+	const __m128 SUFFIX2 = _mm_loadu_ps(&m_SkinningSuffix._31);
+	const __m128 SUFFIX3 = _mm_loadu_ps(&m_SkinningSuffix._41);
+
+	for (UINT64 boneID = 0, totalBone = BoneTransforms.size(); boneID < totalBone; ++boneID)
+	{
+		__m128 pBone[4];
+		__m128 pTemp[4];
+		LoadMatrix(BoneTransforms[boneID], pBone);
+		MultiplyMatrix(&m_SkinningPrefixes[boneID], pBone, pTemp);
+
+		__m128 row0 = MultiplyRow(pTemp[0], SUFFIX0, SUFFIX1, SUFFIX2, SUFFIX3);
+		__m128 row1 = MultiplyRow(pTemp[1], SUFFIX0, SUFFIX1, SUFFIX2, SUFFIX3);
+		__m128 row2 = MultiplyRow(pTemp[2], SUFFIX0, SUFFIX1, SUFFIX2, SUFFIX3);
+		__m128 row3 = MultiplyRow(pTemp[3], SUFFIX0, SUFFIX1, SUFFIX2, SUFFIX3);
+		_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+		float* pDestRow = &pDest[boneID]._11;
+		_mm_stream_ps(pDestRow, row0);
+		_mm_stream_ps(pDestRow + 4, row1);
+		_mm_stream_ps(pDestRow + 8, row2);
+		_mm_stream_ps(pDestRow + 12, row3);
+	}
+
+	_mm_sfence();
+}
+
+Matrix AnimationData::GetRootBoneTransformWithoutLocalRot(const int CLIP_ID)
+{
 	// root bone id 0(ƴ  ).
 	const int ROOT_BONE_ID = 0;
-	std::vector<AnimationClip::Key>& keys = clip.Keys[ROOT_BONE_ID];
-	const UINT64 KEY_SIZE = keys.size();
 
-	const int PARENT_ID = BoneParents[ROOT_BONE_ID];
-	AnimationClip::Key& key = keys[FRAME % KEY_SIZE];
+	Vector3 position;
+	Quaternion rotation;
+	Vector3 scale(1.0f);
+	InterpolateKeyData(&position, &rotation, &scale, &Clips[CLIP_ID], ROOT_BONE_ID, getAnimationTimeTick(CLIP_ID));
 
-	Matrix ret = Matrix::CreateScale(key.Scale) * Matrix::CreateTranslation(key.Position);
+	Matrix ret = Matrix::CreateScale(scale) * Matrix::CreateTranslation(position);
 
 	return (InverseDefaultTransform * OffsetMatrices[0] * ret * InverseOffsetMatrices[0] * DefaultTransform);
 }
@@ -207,403 +368,461 @@ UINT AnimationData::findIndex(AnimationClip* pClip, const int BONE_ID, const flo
 	_ASSERT(pClip);
 	_ASSERT(BONE_ID >= 0);
 
-	UINT ret = 0;
+	const std::vector<AnimationClip::Key>& KEYS = pClip->Keys[BONE_ID];
+	const UINT64 KEY_SIZE = KEYS.size();
+	if (KEY_SIZE < 2)
+	{
+		return 0;
+	}
 
-	std::vector<AnimationClip::Key>& keys = pClip->Keys[BONE_ID];
-	for (UINT64 i = 0, end = keys.size() - 1; i < end; ++i)
+	// ȯ  [0, KEY_SIZE - 2].  key Ĵ  .
+	const UINT LAST_INDEX = (UINT)KEY_SIZE - 2;
+
+	if ((UINT64)BONE_ID >= pClip->KeyTracks.size())
+	{
+		return searchIndex(KEYS, ANIMATION_TIME_TICK);
+	}
+
+	AnimationClip::KeyTrack& track = pClip->KeyTracks[BONE_ID];
+	UINT index = 0;
+
+	if (track.InverseStep > 0.0)
+	{
+		//  . εҼ  յ  ĭ .
+		double fIndex = ((double)ANIMATION_TIME_TICK - track.StartTime) * track.InverseStep;
+		index = (fIndex <= 0.0 ? 0 : (fIndex >= (double)LAST_INDEX ? LAST_INDEX : (UINT)fIndex));
+
+		if (index > 0 && ANIMATION_TIME_TICK < (float)KEYS[index].Time)
+		{
+			--index;
+		}
+		else if (index < LAST_INDEX && ANIMATION_TIME_TICK >= (float)KEYS[index + 1].Time)
+		{
+			++index;
+		}
+		goto LB_RET;
+	}
+
+	//   ̸ cursor ġ ״ΰų  ĭ .
 	{
-		float t = (float)keys[i + 1].Time;
-		if (ANIMATION_TIME_TICK < t)
+		const UINT MAX_FORWARD_STEP = 4;
+
+		index = (track.Cursor > LAST_INDEX ? LAST_INDEX : track.Cursor);
+		if (index == 0 || ANIMATION_TIME_TICK >= (float)KEYS[index].Time)
 		{
-			ret = (UINT)i;
-			break;
+			for (UINT step = 0; step <= MAX_FORWARD_STEP; ++step)
+			{
+				if (index == LAST_INDEX || ANIMATION_TIME_TICK < (float)KEYS[index + 1].Time)
+				{
+					goto LB_RET;
+				}
+				++index;
+			}
 		}
 	}
 
-	return ret;
+	// loop ǰų ũ seek .
+	index = searchIndex(KEYS, ANIMATION_TIME_TICK);
+
+LB_RET:
+	track.Cursor = index;
+	return index;
 }
 
-Joint::Joint()
+UINT AnimationData::searchIndex(const std::vector<AnimationClip::Key>& KEYS, const float ANIMATION_TIME_TICK)
 {
-	// ʱ   ִ س.
-	for (int i = 0; i < JointAxis_AxisCount; ++i)
+	_ASSERT(KEYS.size() >= 2);
+
+	// ANIMATION_TIME_TICK < KEYS[i + 1].Time  ϴ   i.
+	UINT low = 0;
+	UINT high = (UINT)KEYS.size() - 2;
+	while (low < high)
 	{
-		AngleLimitation[i] = Vector2(-FLT_MAX, FLT_MAX);
+		UINT mid = low + (high - low) / 2;
+		if (ANIMATION_TIME_TICK < (float)KEYS[mid + 1].Time)
+		{
+			high = mid;
+		}
+		else
+		{
+			low = mid + 1;
+		}
 	}
+
+	return low;
 }
 
-void Joint::ApplyJacobian(float deltaThetaX, float deltaThetaY, float deltaThetaZ, AnimationData* pAnimationData, int clipID, int frame, Matrix& characerWorld)
+float AnimationData::getAnimationTimeTick(const int CLIP_ID)
 {
-	_ASSERT(pAnimationData);
-	_ASSERT(BoneID != 0xffffffff);
-
-	// ȯ .
-	
-	/*Matrix offset = characerWorld.Invert() * pAnimationData->InverseDefaultTransform * pAnimationData->OffsetMatrices[BoneID];
-	Vector3 xAxis = Vector3::Transform(Vector3::UnitX, offset);
-	Vector3 yAxis = Vector3::Transform(Vector3::UnitY, offset);
-	Vector3 zAxis = Vector3::Transform(Vector3::UnitZ, offset);
-
-	Quaternion deltaRot = Quaternion::CreateFromAxisAngle(xAxis, deltaThetaX);
-	deltaRot = Quaternion::Concatenate(deltaRot, Quaternion::CreateFromAxisAngle(yAxis, deltaThetaY));
-	deltaRot = Quaternion::Concatenate(deltaRot, Quaternion::CreateFromAxisAngle(zAxis, deltaThetaZ));*/
-
-	Quaternion deltaRot = Quaternion::CreateFromYawPitchRoll(deltaThetaY, deltaThetaX, deltaThetaZ);
-	/*Vector3 xAxis = Vector3(1.0f, 0.0f, 0.0f) * deltaThetaX;
-	Vector3 yAxis = Vector3(0.0f, 1.0f, 0.0f) * deltaThetaY;
-	Vector3 zAxis = Vector3(0.0f, 0.0f, 1.0f) * deltaThetaZ;
-	Quaternion xAxisRot;
-	Quaternion yAxisRot;
-	Quaternion zAxisRot;
-	const float EPSILON = 1.192092896e-7f;
-	{
-		const float xAxisAngle = xAxis.Length();
-		if (xAxisAngle < EPSILON)
+	const AnimationClip& CLIP = Clips[CLIP_ID];
+	float timeInTicks = (float)(TimeSinceLoaded * CLIP.TicksPerSec);
+	return fmod(timeInTicks, (float)CLIP.Duration);
+}
+
+void AnimationData::samplePose(const int CLIP_ID, const float ANIMATION_TIME_TICK, AnimationPose* pOutPose)
+{
+	_ASSERT(pOutPose);
+
+	AnimationClip* pClip = &Clips[CLIP_ID];
+	const UINT64 TOTAL_BONE = pClip->Keys.size();
+	pOutPose->Resize(TOTAL_BONE);
+
+	if (m_bBoneMaskActive)
+	{
+		for (UINT64 i = 0, size = LODBoneIDs.size(); i < size; ++i)
 		{
-			xAxisRot = Quaternion(xAxis * sinf(xAxisAngle), cosf(xAxisAngle));
+			const UINT BONE_ID = LODBoneIDs[i];
+			InterpolateKeyData(&pOutPose->Positions[BONE_ID], &pOutPose->Rotations[BONE_ID], &pOutPose->Scales[BONE_ID], pClip, (const int)BONE_ID, ANIMATION_TIME_TICK);
 		}
-		else
+		m_EvaluatedBoneCount += (UINT)LODBoneIDs.size();
+	}
+	else if (pClip->Compressed.IsValid())
+	{
+		pClip->Compressed.SamplePose(ANIMATION_TIME_TICK, pOutPose->Positions.data(), pOutPose->Rotations.data(), pOutPose->Scales.data());
+		m_EvaluatedBoneCount += (UINT)TOTAL_BONE;
+	}
+	else
+	{
+		for (UINT64 boneID = 0; boneID < TOTAL_BONE; ++boneID)
 		{
-			xAxisRot = Quaternion((xAxis / xAxisAngle) * sin(xAxisAngle), cosf(xAxisAngle));
+			InterpolateKeyData(&pOutPose->Positions[boneID], &pOutPose->Rotations[boneID], &pOutPose->Scales[boneID], pClip, (const int)boneID, ANIMATION_TIME_TICK);
 		}
+		m_EvaluatedBoneCount += (UINT)TOTAL_BONE;
+	}
+
+	// root bone id 0(ƴ  ).
+	// clip  óؾ cross-fade ߿ ̵ clip root ġ   .
+	const int ROOT_BONE_ID = 0;
+	if (CLIP_ID == 0)
+	{
+		pOutPose->Positions[ROOT_BONE_ID].y = 0.0f;
+	}
+	else
+	{
+		pOutPose->Positions[ROOT_BONE_ID] = Vector3(0.0f);
 	}
+}
+
+void AnimationData::updateCrossFade(const int CLIP_ID, const float DELTA_TIME)
+{
+	if (CLIP_ID != m_CurrentClipID)
 	{
-		const float yAxisAngle = yAxis.Length();
-		if (yAxisAngle < EPSILON)
+		if (m_CurrentClipID < 0 || CrossFadeDuration <= 0.0f)
+		{
+			m_FadeClipID = -1;
+		}
+		else if (CLIP_ID == m_FadeClipID)
 		{
-			yAxisRot = Quaternion(yAxis * sinf(yAxisAngle), cosf(yAxisAngle));
+			//  clip ǵư  ŭ ǵ.
+			m_FadeClipID = m_CurrentClipID;
+			m_FadeElapsed = m_FadeDuration - m_FadeElapsed;
 		}
 		else
 		{
-			yAxisRot = Quaternion((yAxis / yAxisAngle) * sinf(yAxisAngle), cosf(yAxisAngle));
+			m_FadeClipID = m_CurrentClipID;
+			m_FadeElapsed = 0.0f;
+			m_FadeDuration = CrossFadeDuration;
 		}
+
+		m_CurrentClipID = CLIP_ID;
+		return;
 	}
+
+	if (m_FadeClipID >= 0)
 	{
-		const float zAxisAngle = zAxis.Length();
-		if (zAxisAngle < EPSILON)
+		m_FadeElapsed += DELTA_TIME;
+		if (m_FadeElapsed >= m_FadeDuration)
 		{
-			zAxisRot = Quaternion(zAxis * sinf(zAxisAngle), cosf(zAxisAngle));
+			m_FadeClipID = -1;
+		}
+	}
+}
+
+void AnimationData::evaluatePose(const int CLIP_ID)
+{
+	const UINT64 TOTAL_BONE = BoneTransforms.size();
+
+	samplePose(CLIP_ID, getAnimationTimeTick(CLIP_ID), &m_Pose);
+
+	//  clip Ѿ ̸  ŭ  clip .
+	if (m_FadeClipID >= 0)
+	{
+		samplePose(m_FadeClipID, getAnimationTimeTick(m_FadeClipID), &m_LayerPose);
+		BlendPoses(&m_Pose, m_LayerPose, 1.0f - m_FadeElapsed / m_FadeDuration, nullptr, TOTAL_BONE);
+	}
+
+	for (UINT64 i = 0, end = m_Layers.size(); i < end; ++i)
+	{
+		const AnimationLayer& LAYER = m_Layers[i];
+		if (LAYER.Weight <= 0.0f)
+		{
+			continue;
+		}
+
+		samplePose(LAYER.ClipID, getAnimationTimeTick(LAYER.ClipID), &m_LayerPose);
+
+		const float* pBONE_WEIGHTS = (LAYER.BoneWeights.empty() ? nullptr : LAYER.BoneWeights.data());
+		if (LAYER.Mode == AnimationLayerMode_Additive)
+		{
+			AddPoses(&m_Pose, m_LayerPose, LAYER.ReferencePose, LAYER.Weight, pBONE_WEIGHTS, TOTAL_BONE);
 		}
 		else
 		{
-			zAxisRot = Quaternion((zAxis / zAxisAngle) * sinf(zAxisAngle), cosf(zAxisAngle));
+			BlendPoses(&m_Pose, m_LayerPose, LAYER.Weight, pBONE_WEIGHTS, TOTAL_BONE);
 		}
 	}
-	Quaternion deltaRot = Quaternion::Concatenate(xAxisRot, yAxisRot);
-	deltaRot = Quaternion::Concatenate(deltaRot, zAxisRot);*/
-
-	//  Ű Ϳ ȯ .
-	AnimationClip& clip = pAnimationData->Clips[clipID];
-	float timeInTicks = (float)(pAnimationData->TimeSinceLoaded * clip.TicksPerSec);
-	float animationTimeTicks = fmod(timeInTicks, (float)clip.Duration);
-
-	Vector3 interpolatedPos;
-	Vector3 interpolatedScale;
-	Quaternion interpolatedRot;
-	pAnimationData->InterpolateKeyData(&interpolatedPos, &interpolatedRot, &interpolatedScale, &clip, (const int)BoneID, animationTimeTicks);
-
-	Quaternion originRot = interpolatedRot;
-	Quaternion prevUpdateRot = clip.IKRotations[BoneID];
-
-	//   ȯ  .
-	Quaternion newUpdateRot = Quaternion::Concatenate(originRot, prevUpdateRot);
-	newUpdateRot = Quaternion::Concatenate(newUpdateRot, deltaRot);
-
-	////  , joint ü   ׽Ʈ.
-	//Matrix newUpdateRotMat = Matrix::CreateFromQuaternion(newUpdateRot);
-	//float pitch = asin(-newUpdateRotMat._23);
-	//float yaw = atan2(newUpdateRotMat._13, newUpdateRotMat._33);
-	//float roll = atan2(newUpdateRotMat._21, newUpdateRotMat._22);
-	//bool bUpdateFlag = false;
-
-	//// Restrict x-axis value.
-	//if (pitch < AngleLimitation[JointAxis_X].x || pitch > AngleLimitation[JointAxis_X].y)
-	//{
-	//	deltaThetaX = 0.0f;
-	//	bUpdateFlag = true;
-	//}
-
-	//// Restrict y-axis value.
-	//if (yaw < AngleLimitation[JointAxis_Y].x || yaw > AngleLimitation[JointAxis_Y].y)
-	//{
-	//	deltaThetaY = 0.0f;
-	//	bUpdateFlag = true;
-	//}
-
-	//// Restrict z-axis value.
-	//if (roll < AngleLimitation[JointAxis_Z].x || roll > AngleLimitation[JointAxis_Z].y)
-	//{
-	//	deltaThetaZ = 0.0f;
-	//	bUpdateFlag = true;
-	//}
-
-	//if (bUpdateFlag)
-	//{
-	//	deltaRot = Quaternion::CreateFromYawPitchRoll(deltaThetaY, deltaThetaX, deltaThetaZ);
-	//	newUpdateRot = Quaternion::Concatenate(prevUpdateRot, deltaRot);
-	//}
-
-
-	//clip.IKRotations[BoneID] = newUpdateRot;
-	clip.IKRotations[BoneID] = Quaternion::Concatenate(prevUpdateRot, deltaRot);
 }
 
-void Chain::Initialize(const int BODY_CHAIN_SIZE)
+void AnimationData::updateLODPose(const int CLIP_ID)
 {
-	BodyChain.resize(BODY_CHAIN_SIZE);
+	const UINT64 TOTAL_BONE = BoneTransforms.size();
 
-	m_JacobianMatrix = Eigen::MatrixXf(3, 3 * BODY_CHAIN_SIZE);
-	m_DeltaPos = Eigen::VectorXf(3);
-	m_DeltaTheta = Eigen::VectorXf(3 * BODY_CHAIN_SIZE);
-}
+	if (m_LOD.bEvaluate || !m_bLODPoseValid)
+	{
+		//  ̴ pose ؾ ܰ谡 ٲ Ƣ . ó̸   ٷ.
+		const bool bHAS_VISIBLE_POSE = (m_LocalTransforms.size() >= TOTAL_BONE);
+		if (bHAS_VISIBLE_POSE)
+		{
+			m_LODFromPose = m_Pose;
+		}
 
-bool Chain::SolveIK(AnimationData* pAnimationData, Vector3& targetPos, float* pDeltaThetas, const int CLIP_ID, const int FRAME, const float DELTA_TIME, Matrix& characterWorld)
-{
-	_ASSERT(pAnimationData);
-	_ASSERT(pDeltaThetas);
-	_ASSERT(BodyChain.size() > 0);
-
-//	bool bRetContinue = true;
-//
-//	const UINT64 TOTAL_JOINT = BodyChain.size();
-//	Joint* pEndEffector = &BodyChain[TOTAL_JOINT - 1];
-//	ZeroMemory(pDeltaThetas, sizeof(float) * 3 * TOTAL_JOINT); // hip .
-//
-//	Vector3 deltaPos = targetPos - pEndEffector->Position;
-//	float deltaPosLength = deltaPos.Length();
-//	{
-//		/*char szDebugString[256];
-//		sprintf_s(szDebugString, 256, "length: %f\n", deltaPosLength);
-//		OutputDebugStringA(szDebugString);*/
-//	}
-//	/*if (deltaPosLength < 0.01f || deltaPosLength > 0.8f)
-//	{
-//		bRetContinue = false;
-//		goto LB_RET;
-//	}*/
-//
-//	{
-//		Vector3 startToTarget = targetPos - BodyChain[0].Position;
-//		const float START_TO_TARGET_LENGTH = startToTarget.Length();
-//		const float LENGTH = (BodyChain[TOTAL_JOINT - 1].Position - BodyChain[0].Position).Length();
-//		float length = 0.0f;
-//		for (UINT64 i = 0; i < TOTAL_JOINT; ++i)
-//		{
-//			length += BodyChain[i].Length;
-//		}
-//		//if (length < START_TO_TARGET_LENGTH)
-//		//{
-//		//	/*char szDebugString[256];
-//		//	sprintf_s(szDebugString, 256, "length: %f targetLength: %f\n", LENGTH, START_TO_TARGET_LENGTH);
-//		//	OutputDebugStringA(szDebugString);*/
-//
-//		//	bRetContinue = false;
-//		//	goto LB_RET;
-//		//}
-//	}
-//
-//	//m_DeltaPos << deltaPos.x, deltaPos.y, deltaPos.z;
-//	m_DeltaPos[0] = deltaPos.x;
-//	m_DeltaPos[1] = deltaPos.y;
-//	m_DeltaPos[2] = deltaPos.z;
-//
-//	{
-//		int columnIndex = 0;
-//		Matrix inverseWorld = characterWorld.Invert();
-//		for (UINT64 i = 0, end = TOTAL_JOINT; i < end; ++i)
-//		{
-//			Joint* pJoint = &BodyChain[i];
-//			Vector3 diff = pEndEffector->Position - pJoint->Position;
-//			diff.Normalize();
-//
-//			Matrix offset = pAnimationData->InverseOffsetMatrices[pJoint->BoneID] * pAnimationData->DefaultTransform * characterWorld;
-//			Vector3 xAxis = Vector3::Transform(Vector3::UnitX, offset);
-//			Vector3 yAxis = Vector3::Transform(Vector3::UnitY, offset);
-//			Vector3 zAxis = Vector3::Transform(Vector3::UnitZ, offset);
-//
-//			Vector3 partialX = xAxis.Cross(diff);
-//			Vector3 partialY = yAxis.Cross(diff);
-//			Vector3 partialZ = zAxis.Cross(diff);
-//			/*Vector3 partialX = Vector3::UnitX.Cross(diff);
-//			Vector3 partialY = Vector3::UnitY.Cross(diff);
-//			Vector3 partialZ = Vector3::UnitZ.Cross(diff);*/
-//
-//			// 3-dof.
-//			/*m_JacobianMatrix.col(columnIndex) << partialX.x, partialX.y, partialX.z;
-//			m_JacobianMatrix.col(columnIndex + 1) << partialY.x, partialY.y, partialY.z;
-//			m_JacobianMatrix.col(columnIndex + 2) << partialZ.x, partialZ.y, partialZ.z;*/
-//			m_JacobianMatrix(0, columnIndex) = partialX.x;
-//			m_JacobianMatrix(1, columnIndex) = partialX.y;
-//			m_JacobianMatrix(2, columnIndex) = partialX.z;
-//			m_JacobianMatrix(0, columnIndex + 1) = partialY.x;
-//			m_JacobianMatrix(1, columnIndex + 1) = partialY.y;
-//			m_JacobianMatrix(2, columnIndex + 1) = partialY.z;
-//			m_JacobianMatrix(0, columnIndex + 2) = partialZ.x;
-//			m_JacobianMatrix(1, columnIndex + 2) = partialZ.y;
-//			m_JacobianMatrix(2, columnIndex + 2) = partialZ.z;
-//
-//			columnIndex += 3;
-//		}
-//	}
-//
-//	m_DeltaTheta = m_JacobianMatrix.bdcSvd(Eigen::ComputeFullU | Eigen::ComputeThinV).solve(m_DeltaPos);
-//	m_DeltaTheta *= DELTA_TIME;
-//	{
-//		char szDebugString[256];
-//		sprintf_s(szDebugString, 256, "Theta 1: %f, %f, %f  Theta 2: %f, %f, %f  Theta 3: %f, %f, %f  Theta 4: %f, %f, %f\n",
-//				  m_DeltaTheta[0], m_DeltaTheta[1], m_DeltaTheta[2],
-//				  m_DeltaTheta[3], m_DeltaTheta[4], m_DeltaTheta[5],
-//				  m_DeltaTheta[6], m_DeltaTheta[7], m_DeltaTheta[8],
-//				  m_DeltaTheta[9], m_DeltaTheta[10], m_DeltaTheta[11]);
-//		OutputDebugStringA(szDebugString);
-//	}
-//
-//	for (UINT64 i = 0, end = 3 * TOTAL_JOINT; i < end; ++i)
-//	{
-//		pDeltaThetas[i] = m_DeltaTheta[i];
-//	}
-//
-//LB_RET:
-//	return bRetContinue;
-
-	// https://www.ryanjuckett.com/analytic-two-bone-ik-in-2d/
-	// leg .
-
-	// bool bReached = ((BodyChain[0].Position - targetPos).Length() <= legLength);
-	
-	AnimationClip& clip = pAnimationData->Clips[CLIP_ID];
-	float timeInTicks = (float)(pAnimationData->TimeSinceLoaded * clip.TicksPerSec);
-	float animationTimeTicks = fmod(timeInTicks, (float)clip.Duration);
-
-	Joint& startJoint = BodyChain[0];
-	Joint& midJoint = BodyChain[1];
-	Joint& endJoint = BodyChain[2];
-	Matrix inverseWorld = characterWorld.Invert();
-	
-	Vector3 interpolatedPos;
-	Vector3 interpolatedScale;
-	Quaternion interpolatedRot;
-	Matrix transform;
-	pAnimationData->InterpolateKeyData(&interpolatedPos, &interpolatedRot, &interpolatedScale, &clip, startJoint.BoneID, animationTimeTicks);
-	transform = Matrix::CreateScale(interpolatedScale) * Matrix::CreateFromQuaternion(interpolatedRot) * Matrix::CreateTranslation(interpolatedPos);
-
-	Quaternion midIKRot;
-	Quaternion startIKRot;
-	float midJointAngle = 0.0f;
-	// mid joint angle.
-	{
-		Matrix offset = inverseWorld * pAnimationData->InverseDefaultTransform * pAnimationData->OffsetMatrices[startJoint.BoneID];
-		Vector3 targetPosInStartJointSpace = Vector3::Transform(targetPos, offset);
-		Vector3 startJointPos = Vector3::Transform(startJoint.Position, offset);
-		Vector3 midJointPos = Vector3::Transform(midJoint.Position, offset);
-		Vector3 endJointPos = Vector3::Transform(endJoint.Position, offset);
-
-		Vector3 startToTarget = targetPosInStartJointSpace - startJointPos;
-		Vector3 upLeg = midJointPos - startJointPos;
-		Vector3 leg = endJointPos - midJointPos;
-		startToTarget.x = 0.0f;
-		upLeg.x = 0.0f;
-		leg.x = 0.0f;
-
-		const float UPLEG_TO_LEG_LENGTH = upLeg.Length();
-		const float LEG_TO_FOOT_LENGTH = leg.Length();
-		const float UPLEG_TO_TARGET = startToTarget.Length();
-
-		// rotate in x-axis(yx).
-		float cosTheta = ((UPLEG_TO_TARGET * UPLEG_TO_TARGET) - (UPLEG_TO_LEG_LENGTH * UPLEG_TO_LEG_LENGTH) - (LEG_TO_FOOT_LENGTH * LEG_TO_FOOT_LENGTH)) / (2.0f * UPLEG_TO_LEG_LENGTH * LEG_TO_FOOT_LENGTH);
-		cosTheta = Clamp(cosTheta, -1.0f, 1.0f);
-		midJointAngle = acosf(cosTheta);
-		midJointAngle = Clamp(midJointAngle, 0.0f, DirectX::XM_PI);
+		evaluatePose(CLIP_ID);
+		m_LODToPose = m_Pose;
+		if (!bHAS_VISIBLE_POSE)
 		{
-			char szDebugString[256];
-			sprintf_s(szDebugString, 256, "midJointAngle: %f\n", midJointAngle);
-			OutputDebugStringA(szDebugString);
+			m_LODFromPose = m_Pose;
 		}
 
-		midIKRot = Quaternion::CreateFromAxisAngle(Vector3::UnitX, midJointAngle);
+		m_LODElapsedFrames = 0;
+		m_bLODPoseValid = true;
 	}
 
-	// start joint angle.
+	// sample frame 1 / interval ٰ  sample  frame .
+	++m_LODElapsedFrames;
+	float factor = (float)m_LODElapsedFrames / (float)m_LOD.UpdateInterval;
+	factor = (factor < 1.0f ? factor : 1.0f);
+
+	m_Pose = m_LODFromPose;
+	BlendPoses(&m_Pose, m_LODToPose, factor, nullptr, TOTAL_BONE);
+}
+
+void AnimationData::buildLocalTransforms()
+{
+	const UINT64 TOTAL_BONE = BoneTransforms.size();
+	_ASSERT(m_Pose.Rotations.size() >= TOTAL_BONE);
+
+	if (m_LocalTransforms.size() < TOTAL_BONE)
 	{
-		// xy(z-axis), yz(x-axis), zx(y-axis)  plane ٶ target pos  ؾ.(in start joint space)
-		// ⼭ mid joint yz 鿡 ȸϹǷ,  鸸 ̷д ϰ,     arctan .
+		m_LocalTransforms.resize(TOTAL_BONE);
+	}
+
+	// Scale * Rotation * Translation 4 bone SoA .
+	const __m128 ZERO = _mm_setzero_ps();
+	const __m128 ONE = _mm_set1_ps(1.0f);
+	const __m128 TWO = _mm_set1_ps(2.0f);
 
-		// yx
-		Quaternion startIKRotInZ;
+	const UINT* pBONE_IDS = (m_bBoneMaskActive ? LODBoneIDs.data() : nullptr);
+	const UINT64 BONE_COUNT = (m_bBoneMaskActive ? LODBoneIDs.size() : TOTAL_BONE);
+
+	for (UINT64 i = 0; i < BONE_COUNT; i += 4)
+	{
+		const UINT LANE_COUNT = (BONE_COUNT - i < 4 ? (UINT)(BONE_COUNT - i) : 4);
+
+		UINT64 pLaneBoneIDs[4];
+		for (UINT lane = 0; lane < LANE_COUNT; ++lane)
+		{
+			pLaneBoneIDs[lane] = (pBONE_IDS ? pBONE_IDS[i + lane] : i + lane);
+		}
+
+		//  lane ׵ ȯ ä.
+		__m128 pRotations[4] = { ZERO, ZERO, ZERO, ZERO };
+		alignas(16) float pPositions[3][4] = { };
+		alignas(16) float pScales[3][4] = { };
+		for (UINT lane = 0; lane < LANE_COUNT; ++lane)
 		{
-			Matrix offset = inverseWorld * pAnimationData->InverseDefaultTransform * pAnimationData->OffsetMatrices[startJoint.BoneID];
-			Vector3 targetPosInStartJointSpace = Vector3::Transform(targetPos, offset);
-			Vector3 startJointPos = Vector3::Transform(startJoint.Position, offset);
-			Vector3 midJointPos = Vector3::Transform(midJoint.Position, offset);
-			Vector3 endJointPos = Vector3::Transform(endJoint.Position, offset);
-
-			Vector3 startJointToEndJoint = endJointPos - startJointPos;
-			Vector3 startJointToTarget = targetPosInStartJointSpace - startJointPos;
-
-			startJointToEndJoint.z = 0.0f;
-			startJointToEndJoint.Normalize();
-			startJointToTarget.z = 0.0f;
-			startJointToTarget.Normalize();
-
-			float dot = startJointToEndJoint.Dot(startJointToTarget);
-			float angle = acosf(dot);
-			startIKRotInZ = Quaternion::CreateFromAxisAngle(Vector3::UnitZ, angle);
+			const UINT64 BONE_ID = pLaneBoneIDs[lane];
+			const Vector3& POSITION = m_Pose.Positions[BONE_ID];
+			const Vector3& SCALE = m_Pose.Scales[BONE_ID];
+			pRotations[lane] = _mm_loadu_ps(&m_Pose.Rotations[BONE_ID].x);
+			pPositions[0][lane] = POSITION.x;
+			pPositions[1][lane] = POSITION.y;
+			pPositions[2][lane] = POSITION.z;
+			pScales[0][lane] = SCALE.x;
+			pScales[1][lane] = SCALE.y;
+			pScales[2][lane] = SCALE.z;
 		}
 
-		// zy
-		Quaternion startIKRotInX;
+		__m128 x = pRotations[0];
+		__m128 y = pRotations[1];
+		__m128 z = pRotations[2];
+		__m128 w = pRotations[3];
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+
+		const __m128 XX = _mm_mul_ps(x, x);
+		const __m128 YY = _mm_mul_ps(y, y);
+		const __m128 ZZ = _mm_mul_ps(z, z);
+		const __m128 XY = _mm_mul_ps(x, y);
+		const __m128 XZ = _mm_mul_ps(x, z);
+		const __m128 YZ = _mm_mul_ps(y, z);
+		const __m128 WX = _mm_mul_ps(w, x);
+		const __m128 WY = _mm_mul_ps(w, y);
+		const __m128 WZ = _mm_mul_ps(w, z);
+
+		const __m128 SCALE_X = _mm_load_ps(pScales[0]);
+		const __m128 SCALE_Y = _mm_load_ps(pScales[1]);
+		const __m128 SCALE_Z = _mm_load_ps(pScales[2]);
+
+		// XMMatrixRotationQuaternion  row-vector ȸ .  ࿡ scale .
+		__m128 m00 = _mm_mul_ps(_mm_sub_ps(ONE, _mm_mul_ps(TWO, _mm_add_ps(YY, ZZ))), SCALE_X);
+		__m128 m01 = _mm_mul_ps(_mm_mul_ps(TWO, _mm_add_ps(XY, WZ)), SCALE_X);
+		__m128 m02 = _mm_mul_ps(_mm_mul_ps(TWO, _mm_sub_ps(XZ, WY)), SCALE_X);
+		__m128 m10 = _mm_mul_ps(_mm_mul_ps(TWO, _mm_sub_ps(XY, WZ)), SCALE_Y);
+		__m128 m11 = _mm_mul_ps(_mm_sub_ps(ONE, _mm_mul_ps(TWO, _mm_add_ps(XX, ZZ))), SCALE_Y);
+		__m128 m12 = _mm_mul_ps(_mm_mul_ps(TWO, _mm_add_ps(YZ, WX)), SCALE_Y);
+		__m128 m20 = _mm_mul_ps(_mm_mul_ps(TWO, _mm_add_ps(XZ, WY)), SCALE_Z);
+		__m128 m21 = _mm_mul_ps(_mm_mul_ps(TWO, _mm_sub_ps(YZ, WX)), SCALE_Z);
+		__m128 m22 = _mm_mul_ps(_mm_sub_ps(ONE, _mm_mul_ps(TWO, _mm_add_ps(XX, YY))), SCALE_Z);
+		__m128 zero0 = ZERO;
+		__m128 zero1 = ZERO;
+		__m128 zero2 = ZERO;
+		__m128 tx = _mm_load_ps(pPositions[0]);
+		__m128 ty = _mm_load_ps(pPositions[1]);
+		__m128 tz = _mm_load_ps(pPositions[2]);
+		__m128 one = ONE;
+
+		// SoA -> bone .
+		_MM_TRANSPOSE4_PS(m00, m01, m02, zero0);
+		_MM_TRANSPOSE4_PS(m10, m11, m12, zero1);
+		_MM_TRANSPOSE4_PS(m20, m21, m22, zero2);
+		_MM_TRANSPOSE4_PS(tx, ty, tz, one);
+
+		const __m128 pROW0[4] = { m00, m01, m02, zero0 };
+		const __m128 pROW1[4] = { m10, m11, m12, zero1 };
+		const __m128 pROW2[4] = { m20, m21, m22, zero2 };
+		const __m128 pROW3[4] = { tx, ty, tz, one };
+		for (UINT lane = 0; lane < LANE_COUNT; ++lane)
 		{
-			Matrix offset = inverseWorld * pAnimationData->InverseDefaultTransform * pAnimationData->OffsetMatrices[startJoint.BoneID];
-			Vector3 targetPosInStartJointSpace = Vector3::Transform(targetPos, offset);
-			Vector3 startJointPos = Vector3::Transform(startJoint.Position, offset);
-			Vector3 midJointPos = Vector3::Transform(midJoint.Position, offset);
-			Vector3 endJointPos = Vector3::Transform(endJoint.Position, offset);
-
-			Vector3 startJointToTarget = targetPosInStartJointSpace - startJointPos;
-			Vector3 upLeg = midJointPos - startJointPos;
-			Vector3 leg = endJointPos - midJointPos;
-			startJointToTarget.x = 0.0f;
-			upLeg.x = 0.0f;
-			leg.x = 0.0f;
-
-			const float UPLEG_TO_LEG_LENGTH = upLeg.Length();
-			const float LEG_TO_FOOT_LENGTH = leg.Length();
-			const float UPLEG_TO_TARGET = startJointToTarget.Length();
-			const float FIRST = UPLEG_TO_LEG_LENGTH + LEG_TO_FOOT_LENGTH * cosf(midJointAngle);
-			const float SECOND = LEG_TO_FOOT_LENGTH * sinf(midJointAngle);
-			float angle = atan2(startJointToTarget.z * FIRST + startJointToTarget.y * SECOND,
-								startJointToTarget.y * FIRST - startJointToTarget.z * SECOND);
-			startIKRotInX = Quaternion::CreateFromAxisAngle(Vector3::UnitX, angle);
+			float* pDest = &m_LocalTransforms[pLaneBoneIDs[lane]]._11;
+			_mm_storeu_ps(pDest, pROW0[lane]);
+			_mm_storeu_ps(pDest + 4, pROW1[lane]);
+			_mm_storeu_ps(pDest + 8, pROW2[lane]);
+			_mm_storeu_ps(pDest + 12, pROW3[lane]);
 		}
+	}
+}
+
+void AnimationData::buildModelTransforms()
+{
+	const UINT64 TOTAL_BONE = BoneTransforms.size();
+	if (TOTAL_BONE == 0)
+	{
+		return;
+	}
+
+	// root θ .
+	BoneTransforms[0] = m_LocalTransforms[0];
+
+	// bone id θ->ڽ   Ǿ ֱ⿡ θ ̹ Ǿ .
+	for (UINT64 boneID = 1; boneID < TOTAL_BONE; ++boneID)
+	{
+		const int PARENT_ID = BoneParents[boneID];
+		_ASSERT(PARENT_ID >= 0 && (UINT64)PARENT_ID < boneID);
+
+		__m128 pParent[4];
+		__m128 pResult[4];
+		LoadMatrix(BoneTransforms[PARENT_ID], pParent);
+		MultiplyMatrix(&m_LocalTransforms[boneID], pParent, pResult);
+		StoreMatrix(pResult, &BoneTransforms[boneID]);
+	}
+}
+
+Joint::Joint()
+{
+	// ʱ   ִ س.
+	for (int i = 0; i < JointAxis_AxisCount; ++i)
+	{
+		AngleLimitation[i] = Vector2(-FLT_MAX, FLT_MAX);
+	}
+}
 
-		// xz
-		Quaternion startIKRotInY;
+void Chain::Initialize(const int BODY_CHAIN_SIZE)
+{
+	_ASSERT(BODY_CHAIN_SIZE > 0 && (UINT)BODY_CHAIN_SIZE <= MAX_IK_CHAIN_JOINT);
+	BodyChain.resize(BODY_CHAIN_SIZE);
+}
+
+void Chain::BuildIKTask(AnimationData* pAnimationData, const Vector3& TARGET_POS, const Matrix& CHARACTER_WORLD, const UINT END_JOINT_INDEX, IKChainTask* pOutTask)
+{
+	_ASSERT(pAnimationData);
+	_ASSERT(pOutTask);
+	_ASSERT(END_JOINT_INDEX > 0 && END_JOINT_INDEX < BodyChain.size());
+
+	// world -> BoneTransforms . GetGlobalBonePositionMatix() * world  bone ȯ  .
+	const Matrix TO_BONE_SPACE = (pAnimationData->InverseOffsetMatrices[0] * pAnimationData->DefaultTransform * CHARACTER_WORLD).Invert();
+
+	pOutTask->JointCount = END_JOINT_INDEX + 1;
+	for (UINT i = 0; i <= END_JOINT_INDEX; ++i)
+	{
+		const UINT BONE_ID = BodyChain[i].BoneID;
+		_ASSERT(i == 0 || (UINT)pAnimationData->BoneParents[BONE_ID] == BodyChain[i - 1].BoneID);
+
+		pOutTask->Positions[i] = pAnimationData->BoneTransforms[BONE_ID].Translation();
+	}
+	pOutTask->Target = Vector3::Transform(TARGET_POS, TO_BONE_SPACE);
+
+	//  mid    .
+	pOutTask->Pole = pOutTask->Positions[1];
+
+	// mid          .
+	pOutTask->MinBend = 0.0f;
+	pOutTask->MaxBend = DirectX::XM_PI;
+	float widestRange = 0.0f;
+	for (int axis = 0; axis < Joint::JointAxis_AxisCount; ++axis)
+	{
+		const Vector2& LIMITATION = BodyChain[1].AngleLimitation[axis];
+		const float LOWER = Clamp(LIMITATION.x, -DirectX::XM_PI, DirectX::XM_PI);
+		const float UPPER = Clamp(LIMITATION.y, -DirectX::XM_PI, DirectX::XM_PI);
+		if (UPPER - LOWER <= widestRange)
 		{
-			Matrix offset = inverseWorld * pAnimationData->InverseDefaultTransform * pAnimationData->OffsetMatrices[startJoint.BoneID];
-			Vector3 targetPosInStartJointSpace = Vector3::Transform(targetPos, offset);
-			Vector3 startJointPos = Vector3::Transform(startJoint.Position, offset);
-			Vector3 midJointPos = Vector3::Transform(midJoint.Position, offset);
-			Vector3 endJointPos = Vector3::Transform(endJoint.Position, offset);
-
-			Vector3 startJointToEndJoint = endJointPos - startJointPos;
-			Vector3 startJointToTarget = targetPosInStartJointSpace - startJointPos;
-
-			startJointToEndJoint.y = 0.0f;
-			startJointToEndJoint.Normalize();
-			startJointToTarget.y = 0.0f;
-			startJointToTarget.Normalize();
-
-			float dot = startJointToEndJoint.Dot(startJointToTarget);
-			float angle = acosf(dot);
-			startIKRotInY = Quaternion::CreateFromAxisAngle(Vector3::UnitY, angle);
+			continue;
 		}
 
-		startIKRot = Quaternion::Concatenate(startIKRotInX, startIKRotInY);
-		startIKRot = Quaternion::Concatenate(startIKRot, startIKRotInZ);
+		widestRange = UPPER - LOWER;
+		pOutTask->MaxBend = (fabs(LOWER) > fabs(UPPER) ? fabs(LOWER) : fabs(UPPER));
+		pOutTask->MinBend = (LOWER <= 0.0f && UPPER >= 0.0f ? 0.0f : (fabs(LOWER) < fabs(UPPER) ? fabs(LOWER) : fabs(UPPER)));
 	}
 
-	clip.IKRotations[startJoint.BoneID] = startIKRot;
-	clip.IKRotations[midJoint.BoneID] = midIKRot;
-	
-	return true;
+	pOutTask->SolverType = (pOutTask->JointCount == 3 ? IKSolverType_TwoBone : IKSolverType_FABRIK);
+}
+
+void Chain::ApplyIKTask(AnimationData* pAnimationData, const int CLIP_ID, const IKChainTask& TASK)
+{
+	_ASSERT(pAnimationData);
+	_ASSERT(TASK.JointCount > 0 && TASK.JointCount <= BodyChain.size());
+
+	AnimationClip& clip = pAnimationData->Clips[CLIP_ID];
+
+	// Deltas bone  ȸ̰ IKRotations bone local sample ȸ  ǹǷ
+	// IK = B^-1 * (parent delta^-1 * delta) * B. B IK   bone .
+	// end effector Ʒ  θ  delta̹Ƿ IK ȸ .
+	Quaternion inverseParentDelta;
+	for (UINT64 i = 0, end = BodyChain.size(); i < end; ++i)
+	{
+		const UINT BONE_ID = BodyChain[i].BoneID;
+		const Quaternion& DELTA = TASK.Deltas[i < TASK.JointCount ? i : TASK.JointCount - 1];
+
+		Matrix boneTransform = pAnimationData->BoneTransforms[BONE_ID];
+		Vector3 scale;
+		Vector3 translation;
+		Quaternion boneRotation;
+		boneTransform.Decompose(scale, boneRotation, translation);
+
+		Quaternion inverseBoneRotation;
+		boneRotation.Inverse(inverseBoneRotation);
+
+		const Quaternion LOCAL_DELTA = Quaternion::Concatenate(inverseParentDelta, DELTA);
+		clip.IKRotations[BONE_ID] = Quaternion::Concatenate(Quaternion::Concatenate(inverseBoneRotation, LOCAL_DELTA), boneRotation);
+
+		DELTA.Inverse(inverseParentDelta);
+	}
 }
@@ -4,6 +4,11 @@
 #include <unordered_map>
 #include <vector>
 #include <string>
+#include "CompressedAnimationClip.h"
+#include "AnimationBlend.h"
+#include "IKSolver.h"
+#include "RootMotion.h"
+#include "AnimationLOD.h"
 
 using DirectX::SimpleMath::Matrix;
 using DirectX::SimpleMath::Quaternion;
@@ -28,12 +33,27 @@ struct AnimationClip
 		double Time = 0.0f;
 	};
 
+	// bone track key Ž  . InitKeyTracks ä.
+	struct KeyTrack
+	{
+		double StartTime = 0.0;
+		double InverseStep = 0.0; // key  ϸ 1 / . ƴϸ 0.
+		UINT Cursor = 0;		  //  ã key index.  θ ϸ ״ΰų ٷ  ĭ.
+	};
+
+	// Keys ä    ȣ.
+	void InitKeyTracks();
+
 	std::string Name;					 // Name of this animation clip.
 	std::vector<std::vector<Key>> Keys;  // Keys[boneID][frame or time].
+	std::vector<KeyTrack> KeyTracks;	 // KeyTracks[boneID].
+	CompressedAnimationClip Compressed;	 // ȿϸ sample ⼭. root  Keys    .
+	RootMotionTrack RootMotion;			 // import  root key  tick ̵.
 	std::vector<Quaternion> IKRotations;
 	int NumChannels;					 // Number of bones.
 	double Duration;					 // Duration of animation in ticks.
 	double TicksPerSec;					 // Frames per second.
+	bool bPrepared = false;				 // root motion ,  . cooked asset  clip true.
 };
 
 class AnimationData
@@ -43,19 +63,82 @@ public:
 	~AnimationData() = default;
 
 	void Update(const int CLIP_ID, const int FRAME, const float DELTA_TIME);
+	// Update   pose IK ȸ  ٽ .
 	void UpdateForIK(const int CLIP_ID, const int FRAME);
-	void UpdateVelocity(const int CLIP_ID, const int FRAME);
+
+	//  Update  LOD.  frame Update .
+	inline void SetLOD(const AnimationLODState& LOD) { m_LOD = LOD; }
+	//  Update sample bone .   frame 0.
+	inline UINT GetEvaluatedBoneCount() const { return m_EvaluatedBoneCount; }
 
 	void ResetAllIKRotations(const int CLIP_ID);
 
+	// layer base clip( cross-fade)  ߰  . ȯ  layer index.
+	// bone    ȣ.
+	UINT AddLayer(const int CLIP_ID, const eAnimationLayerMode MODE, const float WEIGHT);
+	void SetLayerWeight(const UINT LAYER_INDEX, const float WEIGHT);
+	// ROOT_BONE_ID   bone WEIGHT,  0.
+	void SetLayerBoneMask(const UINT LAYER_INDEX, const int ROOT_BONE_ID, const float WEIGHT);
+	void ClearLayers();
+
+	//  clip root motion , . ̹  clip ǳʶ.
+	// DefaultTransform, InverseOffsetMatrices   ȣ. cook ̳ SkinnedMeshModel ʱȭ .
+	void PrepareClips();
+
 	void InterpolateKeyData(Vector3* pOutPosition, Quaternion* pOutRotation, Vector3* pOutScale, AnimationClip* pClip, const int BONE_ID, const float ANIMATION_TIME_TICK);
 
+	// Get()  bone  . offset, default transform     ȣ.
+	void InitSkinningTransforms();
+	//  bone Get(...).Transpose() pDest . pDest 16byte ĵ upload ޸.
+	void WriteSkinningMatrices(Matrix* pDest);
+
 	Matrix Get(const int CLIP_ID, const int FRAME, const int BONE_ID);
-	Matrix GetRootBoneTransformWithoutLocalRot(const int CLIP_ID, const int FRAME);
+	//   ð root scale, ġ.
+	Matrix GetRootBoneTransformWithoutLocalRot(const int CLIP_ID);
 	Matrix GetGlobalBonePositionMatix(const int CLIP_ID, const int FRAME, const int BONE_ID);
 
 protected:
+	//  ̸ ٷ , ƴϸ cursor   ĭ  ϸ(seek, loop)  Ž.
 	UINT findIndex(AnimationClip* pClip, const int BONE_ID, const float ANIMATION_TIME_TICK);
+	UINT searchIndex(const std::vector<AnimationClip::Key>& KEYS, const float ANIMATION_TIME_TICK);
+
+	float getAnimationTimeTick(const int CLIP_ID);
+	//  bone local ȯ pOutPose.  clip̸   . root ġ ó ⼭.
+	// bone mask   LODBoneIDs.
+	void samplePose(const int CLIP_ID, const float ANIMATION_TIME_TICK, AnimationPose* pOutPose);
+	// clip ٲ cross-fade , ƴϸ .
+	void updateCrossFade(const int CLIP_ID, const float DELTA_TIME);
+	// base clip -> cross-fade -> layer  m_Pose ռ.
+	void evaluatePose(const int CLIP_ID);
+	// UpdateInterval frame evaluatePoseϰ,  ̴  ̴ pose  pose  m_Pose.
+	void updateLODPose(const int CLIP_ID);
+	// m_Pose -> m_LocalTransforms. 4 bone SIMD. bone mask   mask  bone   .
+	void buildLocalTransforms();
+	// m_LocalTransforms -> BoneTransforms. θ  .
+	void buildModelTransforms();
+
+protected:
+	AnimationPose m_Pose;
+	AnimationPose m_LayerPose; // cross-fade, layer clip sampleϴ ӽ .
+	std::vector<AnimationLayer> m_Layers;
+
+	int m_CurrentClipID = -1;
+	int m_FadeClipID = -1; //   clip.  -1.
+	float m_FadeElapsed = 0.0f;
+	float m_FadeDuration = 0.0f;
+
+	AnimationLODState m_LOD = {};
+	AnimationPose m_LODFromPose; //  .  sample  ̴ pose.
+	AnimationPose m_LODToPose;	 //  sample pose.
+	UINT m_LODElapsedFrames = 0;
+	bool m_bLODPoseValid = false;
+	bool m_bBoneMaskActive = false; // ̹ Update LODBoneIDs .
+	UINT m_EvaluatedBoneCount = 0;
+
+	std::vector<Matrix> m_LocalTransforms;
+
+	std::vector<Matrix> m_SkinningPrefixes; // InverseDefaultTransform * OffsetMatrices[boneID].
+	Matrix m_SkinningSuffix;				// InverseOffsetMatrices[0] * DefaultTransform.
 
 public:
 	std::unordered_map<std::string, int> BoneNameToID;	//  ̸ ε .
@@ -66,15 +149,16 @@ public:
 	std::vector<Matrix> NodeTransforms;
 	std::vector<Matrix> BoneTransforms;					// ش  key data ӿ   ȯ .
 	std::vector<AnimationClip> Clips;					// ִϸ̼ .
+	std::vector<UINT> LODBoneIDs;						//  Ÿ  bone. .   .
 
 	Matrix DefaultTransform;			// normalizing  ȯ  [-1, 1]^3
 	Matrix InverseDefaultTransform;		//  ǥ  ȯ .
-	Vector3 PrevKeyPos;					//  clip Ű  ġ.
 	Vector3 Position;					// ĳ ġ.
 	Vector3 Direction;					// direction ȸ ⸸ .
 	Quaternion Rotation;				// ȸ .
 
 	double TimeSinceLoaded = 0.25f;
+	float CrossFadeDuration = 0.2f;		// clip ٲ   clip  Ѿ ð(). 0̸ ٷ ȯ.
 	float NormalizingScale = 1.0f;
 	float Velocity = 0.0f;
 };
@@ -85,8 +169,6 @@ public:
 	Joint();
 	~Joint() = default;
 
-	void ApplyJacobian(float deltaX, float deltaY, float deltaZ, AnimationData* pAnimationData, int clipID, int frame, Matrix& characerWorld);
-
 public:
 	enum eJointAxis
 	{
@@ -109,13 +191,12 @@ public:
 
 	void Initialize(const int BODY_CHAIN_SIZE);
 
-	bool SolveIK(AnimationData* pAnimationData, Vector3& targetPos, float* pDeltaThetas, const int CLIP_ID, const int FRAME, const float DELTA_TIME, Matrix& characterWorld);
+	// BodyChain[0 ~ END_JOINT_INDEX] end effector TARGET_POS(world)  task ä.
+	// BoneTransforms IK   pose .
+	void BuildIKTask(AnimationData* pAnimationData, const Vector3& TARGET_POS, const Matrix& CHARACTER_WORLD, const UINT END_JOINT_INDEX, IKChainTask* pOutTask);
+	// Ǯ  CLIP_ID clip IKRotations .
+	void ApplyIKTask(AnimationData* pAnimationData, const int CLIP_ID, const IKChainTask& TASK);
 
 public:
 	std::vector<Joint> BodyChain; // root ~ child.
-
-private:
-	Eigen::MatrixXf m_JacobianMatrix;
-	Eigen::VectorXf m_DeltaPos;
-	Eigen::VectorXf m_DeltaTheta;
 };
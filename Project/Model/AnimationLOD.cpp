@@ -0,0 +1,112 @@
+#include "../pch.h"
+#include "Skeleton.h"
+#include "AnimationLOD.h"
+
+static const UINT UPDATE_INTERVALS[AnimationLODLevel_Count] = { 1, 2, 4 };
+
+void AnimationLODManager::Initialize(const AnimationLODSettings& SETTINGS)
+{
+	_ASSERT(SETTINGS.IKDistance <= SETTINGS.BoneMaskDistance);
+
+	m_Settings = SETTINGS;
+	m_FrameStats = {};
+	m_FrameCount = 0;
+}
+
+void AnimationLODManager::BeginFrame()
+{
+	m_FrameStats = {};
+	++m_FrameCount;
+}
+
+void AnimationLODManager::SelectLOD(const Vector3& EYE_POS, const Vector3& CHARACTER_POS, const UINT CHARACTER_INDEX, AnimationLODState* pState)
+{
+	_ASSERT(pState);
+
+	const float DISTANCE = (CHARACTER_POS - EYE_POS).Length();
+
+	//    ܰ辿. ־  迡 ٷ,   Hysteresisŭ  ; ٲ.
+	UINT level = (pState->Level < AnimationLODLevel_Count ? pState->Level : (UINT)AnimationLODLevel_Full);
+	while (level + 1 < AnimationLODLevel_Count && DISTANCE >= m_Settings.pLevelDistances[level + 1])
+	{
+		++level;
+	}
+	while (level > AnimationLODLevel_Full && DISTANCE < m_Settings.pLevelDistances[level] - m_Settings.Hysteresis)
+	{
+		--level;
+	}
+
+	const UINT INTERVAL = UPDATE_INTERVALS[level];
+	pState->Level = level;
+	pState->UpdateInterval = INTERVAL;
+	pState->bEvaluate = ((m_FrameCount + CHARACTER_INDEX) % INTERVAL == 0);
+	pState->bSolveIK = (DISTANCE < m_Settings.IKDistance);
+	pState->bUseBoneMask = (DISTANCE >= m_Settings.BoneMaskDistance);
+}
+
+void AnimationLODManager::AddCharacterStats(const AnimationLODState& STATE, const UINT EVALUATED_BONE_COUNT, const bool bIK_SKIPPED)
+{
+	_ASSERT(STATE.Level < AnimationLODLevel_Count);
+
+	++m_FrameStats.CharacterCount;
+	++m_FrameStats.pLevelCounts[STATE.Level];
+	m_FrameStats.EvaluatedBoneCount += EVALUATED_BONE_COUNT;
+	if (EVALUATED_BONE_COUNT > 0)
+	{
+		++m_FrameStats.EvaluatedCharacterCount;
+	}
+	if (bIK_SKIPPED)
+	{
+		++m_FrameStats.SkippedIKCount;
+	}
+}
+
+void BuildAnimationLODMask(const Skeleton& SKELETON, const float MIN_REACH_RATIO, std::vector<UINT>* pOutBoneIDs)
+{
+	_ASSERT(pOutBoneIDs);
+
+	const UINT BONE_COUNT = SKELETON.GetBoneCount();
+	pOutBoneIDs->clear();
+	if (BONE_COUNT == 0)
+	{
+		return;
+	}
+
+	// bone ڽ    chain . ڽ ID θ𺸴 ̹Ƿ ڿ ÷ .
+	std::vector<float> reaches(BONE_COUNT, 0.0f);
+	for (UINT boneID = BONE_COUNT - 1; boneID > 0; --boneID)
+	{
+		const int PARENT_ID = SKELETON.BoneParents[boneID];
+		if (PARENT_ID < 0)
+		{
+			continue;
+		}
+
+		const float REACH = reaches[boneID] + SKELETON.RestPositions[boneID].Length();
+		reaches[PARENT_ID] = (REACH > reaches[PARENT_ID] ? REACH : reaches[PARENT_ID]);
+	}
+
+	float maxReach = 0.0f;
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		if (SKELETON.BoneParents[boneID] < 0 && reaches[boneID] > maxReach)
+		{
+			maxReach = reaches[boneID];
+		}
+	}
+	const float MIN_REACH = maxReach * MIN_REACH_RATIO;
+
+	// root ׻ . θ  ڽĵ .
+	std::vector<BYTE> bKeeps(BONE_COUNT, 0);
+	pOutBoneIDs->reserve(BONE_COUNT);
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		const int PARENT_ID = SKELETON.BoneParents[boneID];
+		const bool bKEEP = (PARENT_ID < 0 || (bKeeps[PARENT_ID] && reaches[boneID] >= MIN_REACH));
+		if (bKEEP)
+		{
+			bKeeps[boneID] = 1;
+			pOutBoneIDs->push_back(boneID);
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <directxtk12/SimpleMath.h>
+#include <vector>
+
+// ī޶ Ÿ  ִϸ̼ LOD.
+//  ĳʹ pose  frame sampleϰ ̴ , IK ǳʶٰ, skeleton LOD mask bone .
+
+using DirectX::SimpleMath::Vector3;
+
+class Skeleton;
+
+enum eAnimationLODLevel
+{
+	AnimationLODLevel_Full = 0, //  frame sample.
+	AnimationLODLevel_Half,		// 2 frame.
+	AnimationLODLevel_Quarter,	// 4 frame.
+	AnimationLODLevel_Count
+};
+
+struct AnimationLODSettings
+{
+	float pLevelDistances[AnimationLODLevel_Count] = { 0.0f, 8.0f, 20.0f }; //  Ÿ ش ܰ.
+	float Hysteresis = 1.0f;		//  ܰ ƿ  ̸ŭ  ٰ; . 迡 ܰ谡  ʰ.
+	float IKDistance = 6.0f;		//  Ÿ  IK  raycast .
+	float BoneMaskDistance = 12.0f; //  Ÿ  LOD mask bone sample.
+};
+
+// ĳͺ. SelectLOD  frame .
+struct AnimationLODState
+{
+	UINT Level;
+	UINT UpdateInterval; // frame . 1 ϸ  frame.
+	bool bEvaluate;		 // ̹ frame clip sample. ƴϸ ռ sample  pose ̸ .
+	bool bSolveIK;
+	bool bUseBoneMask;
+};
+
+//  frame  հ.
+struct AnimationLODStats
+{
+	UINT CharacterCount;
+	UINT EvaluatedCharacterCount; // clip sample ĳ.
+	UINT EvaluatedBoneCount;	  // sample bone . cross-fade, layer .
+	UINT SkippedIKCount;		  // IK ʿ Ÿ  ǳʶ ĳ.
+	UINT pLevelCounts[AnimationLODLevel_Count];
+};
+
+class AnimationLODManager
+{
+public:
+	AnimationLODManager() = default;
+	~AnimationLODManager() = default;
+
+	void Initialize(const AnimationLODSettings& SETTINGS);
+
+	// ĳ LOD    frame  .  frame 踦 .
+	void BeginFrame();
+	// EYE_POS Ÿ pState . CHARACTER_INDEX sampleϴ frame ĳ͸ ߳ ؼ ϸ .
+	void SelectLOD(const Vector3& EYE_POS, const Vector3& CHARACTER_POS, const UINT CHARACTER_INDEX, AnimationLODState* pState);
+	// update  ĳ  .
+	void AddCharacterStats(const AnimationLODState& STATE, const UINT EVALUATED_BONE_COUNT, const bool bIK_SKIPPED);
+
+	inline const AnimationLODSettings& GetSettings() const { return m_Settings; }
+	inline const AnimationLODStats& GetFrameStats() const { return m_FrameStats; }
+
+private:
+	AnimationLODSettings m_Settings;
+	AnimationLODStats m_FrameStats = {};
+	UINT64 m_FrameCount = 0;
+};
+
+// rest pose ڽ   ̰ skeleton ü MIN_REACH_RATIO ̸ bone(հ,  bone )  bone ID .
+// ̶ θ ڽĺ .  bone ڽĵ .
+void BuildAnimationLODMask(const Skeleton& SKELETON, const float MIN_REACH_RATIO, std::vector<UINT>* pOutBoneIDs);
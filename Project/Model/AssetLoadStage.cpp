@@ -0,0 +1,396 @@
+#include "../pch.h"
+#include "../Graphics/GraphicsUtil.h"
+#include "../Util/Utility.h"
+#include "GeometryGenerator.h"
+#include "Skeleton.h"
+#include "CookedAsset.h"
+#include "AssetLoadStage.h"
+
+static double GetElapsedMilliseconds(const LARGE_INTEGER& BEGIN_TIME)
+{
+	LARGE_INTEGER endTime;
+	LARGE_INTEGER frequency;
+	QueryPerformanceCounter(&endTime);
+	QueryPerformanceFrequency(&frequency);
+
+	return (double)(endTime.QuadPart - BEGIN_TIME.QuadPart) * 1000.0 / (double)frequency.QuadPart;
+}
+
+static std::wstring GetCookedAssetPath(const AssetLoadDesc& DESC)
+{
+	return DESC.BasePath + DESC.FileName.substr(0, DESC.FileName.find_last_of(L'.')) + L".cooked";
+}
+
+HRESULT ReadWholeFile(const std::wstring& PATH, std::vector<BYTE>* pOutData)
+{
+	_ASSERT(pOutData);
+
+	HRESULT hr = S_OK;
+	LARGE_INTEGER fileSize = {};
+	UINT64 readSize = 0;
+
+	HANDLE hFile = CreateFileW(PATH.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		hr = HRESULT_FROM_WIN32(GetLastError());
+		goto LB_RET;
+	}
+
+	if (!GetFileSizeEx(hFile, &fileSize))
+	{
+		hr = HRESULT_FROM_WIN32(GetLastError());
+		goto LB_RET;
+	}
+
+	pOutData->resize((UINT64)fileSize.QuadPart);
+	while (readSize < (UINT64)fileSize.QuadPart)
+	{
+		const UINT64 REMAIN = (UINT64)fileSize.QuadPart - readSize;
+		const DWORD CHUNK_SIZE = (DWORD)(REMAIN < 0x40000000ULL ? REMAIN : 0x40000000ULL);
+		DWORD bytesRead = 0;
+		if (!ReadFile(hFile, pOutData->data() + readSize, CHUNK_SIZE, &bytesRead, nullptr) || bytesRead == 0)
+		{
+			hr = E_FAIL;
+			goto LB_RET;
+		}
+		readSize += bytesRead;
+	}
+
+LB_RET:
+	if (hFile != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(hFile);
+	}
+	if (FAILED(hr))
+	{
+		pOutData->clear();
+	}
+
+	return hr;
+}
+
+HRESULT ReadAssetFiles(AssetLoadData* pData)
+{
+	_ASSERT(pData);
+
+	if (FAILED(pData->Result))
+	{
+		return pData->Result;
+	}
+
+	HRESULT hr = S_OK;
+	const AssetLoadDesc& DESC = pData->Desc;
+	LARGE_INTEGER beginTime;
+	QueryPerformanceCounter(&beginTime);
+
+	//   mesh.   .
+	if (DESC.FileName.empty())
+	{
+		goto LB_RET;
+	}
+
+	//  ϵ ״θ cook ϸ mapؼ а decode, process ǳʶ.
+	if (DESC.Type == AssetType_Character && DESC.bUseCookedAsset)
+	{
+		std::vector<std::wstring> sourceNames(1, DESC.FileName);
+		sourceNames.insert(sourceNames.end(), DESC.ClipNames.begin(), DESC.ClipNames.end());
+		pData->ContentHash = HashCookedAssetSources(DESC.BasePath, sourceNames, 0);
+
+		CookedAsset cookedAsset;
+		if (pData->ContentHash != 0 && cookedAsset.Open(GetCookedAssetPath(DESC), pData->ContentHash))
+		{
+			cookedAsset.ReadMeshInfos(&pData->MeshInfos);
+			if (cookedAsset.ReadAnimationData(&pData->AnimData))
+			{
+				pData->FileReadBytes = cookedAsset.GetFileSize();
+				pData->bFromCookedAsset = true;
+				goto LB_RET;
+			}
+
+			pData->MeshInfos.clear();
+			pData->AnimData = AnimationData();
+		}
+	}
+
+	pData->Files.resize(1 + DESC.ClipNames.size());
+	for (UINT64 i = 0, size = pData->Files.size(); i < size; ++i)
+	{
+		AssetFileData& file = pData->Files[i];
+		file.FileName = (i == 0 ? DESC.FileName : DESC.ClipNames[i - 1]);
+
+		// gltf .bin  ܺ    ãǷ Assimp  а .
+		if (GetFileExtension(file.FileName).compare(L"gltf") == 0)
+		{
+			continue;
+		}
+
+		hr = ReadWholeFile(DESC.BasePath + file.FileName, &file.Data);
+		if (FAILED(hr))
+		{
+			WCHAR szDebugString[256];
+			swprintf_s(szDebugString, 256, L"Failed to read asset file: %s%s\n", DESC.BasePath.c_str(), file.FileName.c_str());
+			OutputDebugStringW(szDebugString);
+			goto LB_RET;
+		}
+		pData->FileReadBytes += file.Data.size();
+	}
+
+LB_RET:
+	pData->pStageTimes[AssetLoadStage_FileRead] = GetElapsedMilliseconds(beginTime);
+	if (FAILED(hr))
+	{
+		pData->Result = hr;
+	}
+
+	return hr;
+}
+
+HRESULT DecodeAsset(AssetLoadData* pData)
+{
+	_ASSERT(pData);
+
+	if (FAILED(pData->Result))
+	{
+		return pData->Result;
+	}
+
+	HRESULT hr = S_OK;
+	AssetLoadDesc& desc = pData->Desc;
+	LARGE_INTEGER beginTime;
+	QueryPerformanceCounter(&beginTime);
+
+	if (pData->bFromCookedAsset)
+	{
+		goto LB_RET;
+	}
+	if (desc.FileName.empty())
+	{
+		pData->MeshInfos.swap(desc.MeshInfos);
+		goto LB_RET;
+	}
+
+	pData->ClipAnimData.resize(desc.ClipNames.size());
+	for (UINT64 i = 0, size = pData->Files.size(); i < size; ++i)
+	{
+		AssetFileData& file = pData->Files[i];
+		const BYTE* pFILE_DATA = (file.Data.empty() ? nullptr : file.Data.data());
+
+		if (i == 0)
+		{
+			hr = pData->MeshLoader.LoadFromMemory(desc.BasePath, file.FileName, pFILE_DATA, file.Data.size(), desc.bRevertNormals);
+		}
+		else
+		{
+			ModelLoader clipLoader;
+			hr = clipLoader.LoadAnimationFromMemory(desc.BasePath, file.FileName, pFILE_DATA, file.Data.size());
+			if (SUCCEEDED(hr))
+			{
+				pData->ClipAnimData[i - 1] = clipLoader.AnimData;
+			}
+		}
+		if (FAILED(hr))
+		{
+			goto LB_RET;
+		}
+
+		// import    ٷ .
+		std::vector<BYTE>().swap(file.Data);
+	}
+
+LB_RET:
+	pData->pStageTimes[AssetLoadStage_Decode] = GetElapsedMilliseconds(beginTime);
+	if (FAILED(hr))
+	{
+		pData->Result = hr;
+	}
+
+	return hr;
+}
+
+HRESULT ProcessAsset(AssetLoadData* pData)
+{
+	_ASSERT(pData);
+
+	if (FAILED(pData->Result))
+	{
+		return pData->Result;
+	}
+
+	HRESULT hr = S_OK;
+	const AssetLoadDesc& DESC = pData->Desc;
+	LARGE_INTEGER beginTime;
+	QueryPerformanceCounter(&beginTime);
+
+	if (pData->bFromCookedAsset || DESC.FileName.empty())
+	{
+		goto LB_RET;
+	}
+
+	// ReadFromFile  ó.
+	{
+		ModelLoader& meshLoader = pData->MeshLoader;
+		meshLoader.OptimizeMeshes();
+		meshLoader.GenerateLODs();
+		meshLoader.UpdateTangents();
+		Normalize(Vector3(0.0f), 1.0f, meshLoader.MeshInfos, meshLoader.AnimData);
+
+		pData->MeshInfos.swap(meshLoader.MeshInfos);
+		pData->AnimData = meshLoader.AnimData;
+		meshLoader.AnimData = AnimationData();
+	}
+
+	if (DESC.Type == AssetType_Character)
+	{
+		AnimationData& animData = pData->AnimData;
+
+		// ִϸ̼ Ŭ. ϸ bone ID  ٸ  Ƿ ĳ skeleton  Ű .
+		Skeleton characterSkeleton;
+		characterSkeleton.Initialize(animData);
+		if (pData->ClipAnimData.size() > 0)
+		{
+			animData.Clips.clear();
+		}
+		for (UINT64 i = 0, size = pData->ClipAnimData.size(); i < size; ++i)
+		{
+			const AnimationData& CLIP_DATA = pData->ClipAnimData[i];
+			const std::wstring& CLIP_NAME = DESC.ClipNames[i];
+
+			Skeleton clipSkeleton;
+			SkeletonRemap remap;
+			clipSkeleton.Initialize(CLIP_DATA);
+			if (CLIP_DATA.Clips.empty() || !BuildSkeletonRemap(clipSkeleton, characterSkeleton, &remap))
+			{
+				WCHAR szDebugString[256];
+				swprintf_s(szDebugString, 256, L"Clip skeleton does not match character: %s\n", CLIP_NAME.c_str());
+				OutputDebugStringW(szDebugString);
+
+				hr = E_FAIL;
+				goto LB_RET;
+			}
+
+			AnimationClip retargetedClip;
+			RetargetClip(CLIP_DATA.Clips[0], clipSkeleton, characterSkeleton, remap, &retargetedClip);
+			retargetedClip.Name.assign(CLIP_NAME.begin(), CLIP_NAME.end());
+			animData.Clips.push_back(retargetedClip);
+		}
+		pData->ClipAnimData.clear();
+
+		//  Ÿ հ,  bone   .
+		BuildAnimationLODMask(characterSkeleton, 0.1f, &animData.LODBoneIDs);
+
+		// root motion ,   · .
+		animData.PrepareClips();
+		if (DESC.bUseCookedAsset && pData->ContentHash != 0)
+		{
+			if (FAILED(WriteCookedAsset(GetCookedAssetPath(DESC), pData->ContentHash, pData->MeshInfos, &animData)))
+			{
+				OutputDebugStringA("Failed to write cooked asset.\n");
+			}
+		}
+	}
+
+LB_RET:
+	pData->pStageTimes[AssetLoadStage_Process] = GetElapsedMilliseconds(beginTime);
+	if (FAILED(hr))
+	{
+		pData->Result = hr;
+	}
+
+	return hr;
+}
+
+HRESULT ReadTextureFile(DecodedTexture* pTexture)
+{
+	_ASSERT(pTexture);
+
+	// EXR DirectXTex Ͽ  .
+	if (FAILED(pTexture->Result) || GetFileExtension(pTexture->FileName).compare(L"exr") == 0)
+	{
+		return pTexture->Result;
+	}
+
+	pTexture->Result = ReadWholeFile(pTexture->FileName, &pTexture->FileData);
+	return pTexture->Result;
+}
+
+HRESULT DecodeTexture(DecodedTexture* pTexture)
+{
+	_ASSERT(pTexture);
+
+	if (FAILED(pTexture->Result))
+	{
+		return pTexture->Result;
+	}
+
+	HRESULT hr = S_OK;
+	pTexture->Format = (pTexture->bUseSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM);
+
+	if (GetFileExtension(pTexture->FileName).compare(L"exr") == 0)
+	{
+		hr = ReadEXRImage(pTexture->FileName.c_str(), pTexture->Image, &pTexture->Width, &pTexture->Height, &pTexture->Format);
+	}
+	else
+	{
+		hr = ReadImageFromMemory(pTexture->FileData.data(), pTexture->FileData.size(), pTexture->Image, &pTexture->Width, &pTexture->Height);
+		std::vector<BYTE>().swap(pTexture->FileData);
+	}
+
+	if (FAILED(hr))
+	{
+		WCHAR szDebugString[256];
+		swprintf_s(szDebugString, 256, L"Failed to decode texture: %s\n", pTexture->FileName.c_str());
+		OutputDebugStringW(szDebugString);
+
+		pTexture->Image.clear();
+	}
+
+	pTexture->Result = hr;
+	return hr;
+}
+
+void CollectTextureFileNames(const std::vector<MeshInfo>& MESH_INFOS, std::vector<std::wstring>* pOutFileNames, std::vector<bool>* pOutUseSRGBs)
+{
+	_ASSERT(pOutFileNames);
+	_ASSERT(pOutUseSRGBs);
+
+	pOutFileNames->clear();
+	pOutUseSRGBs->clear();
+
+	for (UINT64 i = 0, size = MESH_INFOS.size(); i < size; ++i)
+	{
+		const MeshInfo& MESH_INFO = MESH_INFOS[i];
+
+		// Model::Initialize  slot,  sRGB .
+		const std::wstring* ppFILE_NAMES[7] =
+		{
+			&MESH_INFO.szAlbedoTextureFileName, &MESH_INFO.szEmissiveTextureFileName, &MESH_INFO.szNormalTextureFileName, &MESH_INFO.szHeightTextureFileName,
+			&MESH_INFO.szAOTextureFileName, &MESH_INFO.szMetallicTextureFileName, &MESH_INFO.szRoughnessTextureFileName,
+		};
+		const bool pbUSE_SRGBS[7] = { true, true, false, false, false, false, false };
+
+		for (int slot = 0; slot < 7; ++slot)
+		{
+			const std::wstring& FILE_NAME = *ppFILE_NAMES[slot];
+			const bool bUSE_SRGB = pbUSE_SRGBS[slot];
+			if (FILE_NAME.empty())
+			{
+				continue;
+			}
+
+			bool bDuplicated = false;
+			for (UINT64 j = 0, nameCount = pOutFileNames->size(); j < nameCount; ++j)
+			{
+				if ((*pOutFileNames)[j] == FILE_NAME)
+				{
+					bDuplicated = true;
+					break;
+				}
+			}
+			if (!bDuplicated)
+			{
+				pOutFileNames->push_back(FILE_NAME);
+				pOutUseSRGBs->push_back(bUSE_SRGB);
+			}
+		}
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include "MeshInfo.h"
+#include "AnimationData.h"
+#include "ModelLoader.h"
+
+// asset ϳ д ܰ. GPU upload main ,  renderer   忡  .
+// file read:   ޸𸮷. (I/O)
+// decode: Assimp import, ̹ decode. (CPU)
+// process: tangent, normalize, skeleton , root motion, , cook . (CPU)
+enum eAssetLoadStage
+{
+	AssetLoadStage_FileRead = 0,
+	AssetLoadStage_Decode,
+	AssetLoadStage_Process,
+	AssetLoadStage_Upload,
+	AssetLoadStage_Count
+};
+
+enum eAssetType
+{
+	AssetType_Model = 0, // mesh  ϳ. FileName   MeshInfos ״ .
+	AssetType_Character, // mesh + clip ϵ. cook   װ͸ .
+};
+
+struct AssetLoadDesc
+{
+	eAssetType Type = AssetType_Model;
+	std::wstring BasePath;
+	std::wstring FileName;
+	std::vector<std::wstring> ClipNames;
+	std::vector<MeshInfo> MeshInfos; // GeometryGenerator   mesh. ؽ decode .
+	std::string Name;
+	bool bRevertNormals = false;
+	bool bUseCookedAsset = true; // Character.
+};
+
+struct AssetFileData
+{
+	std::wstring FileName;
+	std::vector<BYTE> Data; //   decode   . (gltf  ܺ  )
+};
+
+struct AssetLoadData
+{
+	AssetLoadDesc Desc;
+
+	std::vector<AssetFileData> Files; // [0] mesh,  ClipNames .
+	ModelLoader MeshLoader;			  // decode . process MeshInfos, AnimData ű.
+	std::vector<AnimationData> ClipAnimData;
+
+	std::vector<MeshInfo> MeshInfos;
+	AnimationData AnimData;
+
+	UINT64 ContentHash = 0;
+	UINT64 FileReadBytes = 0;
+	double pStageTimes[AssetLoadStage_Count] = {}; // ms.
+	HRESULT Result = S_OK;
+	bool bFromCookedAsset = false;
+};
+
+//  Լ  ϸ pData->Result . ̹  data ״ .
+HRESULT ReadAssetFiles(AssetLoadData* pData);
+HRESULT DecodeAsset(AssetLoadData* pData);
+HRESULT ProcessAsset(AssetLoadData* pData);
+
+// material ؽ.  asset      decode.
+struct DecodedTexture
+{
+	std::wstring FileName;
+	std::vector<BYTE> FileData;
+	std::vector<UCHAR> Image;
+	int Width = 0;
+	int Height = 0;
+	DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+	bool bUseSRGB = false;
+	HRESULT Result = S_OK;
+};
+
+HRESULT ReadTextureFile(DecodedTexture* pTexture);
+HRESULT DecodeTexture(DecodedTexture* pTexture);
+
+// Model::Initialize д texture  ̸ sRGB . ߺ,  ̸ .
+void CollectTextureFileNames(const std::vector<MeshInfo>& MESH_INFOS, std::vector<std::wstring>* pOutFileNames, std::vector<bool>* pOutUseSRGBs);
+
+//  ü . ų  ϸ .
+HRESULT ReadWholeFile(const std::wstring& PATH, std::vector<BYTE>* pOutData);
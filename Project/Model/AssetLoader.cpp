@@ -0,0 +1,425 @@
+#include "../pch.h"
+#include "SkinnedMeshModel.h"
+#include "AssetLoader.h"
+
+void AssetLoader::Initialize(Renderer* pRenderer, UINT workerThreadCount)
+{
+	_ASSERT(pRenderer);
+	_ASSERT(workerThreadCount > 0 && workerThreadCount <= MAX_ASSET_LOAD_WORKER_COUNT);
+
+	m_pRenderer = pRenderer;
+	m_bShutdown = false;
+	m_PendingJobCount = 0;
+
+	m_WorkerThreadCount = workerThreadCount;
+	m_pWorkerThreads = new std::thread[m_WorkerThreadCount];
+	for (UINT i = 0; i < m_WorkerThreadCount; ++i)
+	{
+		m_pWorkerThreads[i] = std::thread(workerThread, this);
+
+		// render job  core  Ƿ frame о ʰ .
+		SetThreadPriority((HANDLE)m_pWorkerThreads[i].native_handle(), THREAD_PRIORITY_BELOW_NORMAL);
+	}
+}
+
+void AssetLoader::Submit(const AssetLoadDesc& DESC, AssetLoadCallback pfnCallback, void* pUserData)
+{
+	_ASSERT(m_pWorkerThreads);
+
+	AssetLoadJob* pJob = new AssetLoadJob;
+	pJob->Data.Desc = DESC;
+	pJob->pfnCallback = pfnCallback;
+	pJob->pUserData = pUserData;
+	QueryPerformanceCounter(&pJob->SubmitTime);
+
+	m_PendingJobCount.fetch_add(1);
+	pushTask(pJob, nullptr);
+}
+
+void AssetLoader::Update(const UINT MAX_UPLOAD_COUNT)
+{
+	if (m_PendingJobCount.load() == 0)
+	{
+		if (!m_Textures.empty())
+		{
+			releaseTextures();
+		}
+		return;
+	}
+
+	// ؽ decode ٸ asset  frame.   .
+	m_UploadJobs.clear();
+	{
+		std::lock_guard<std::mutex> lock(m_ReadyLock);
+		for (UINT64 i = 0; i < m_ReadyJobs.size() && m_UploadJobs.size() < MAX_UPLOAD_COUNT;)
+		{
+			AssetLoadJob* pJob = m_ReadyJobs[i];
+			if (isReadyToUpload(pJob))
+			{
+				m_UploadJobs.push_back(pJob);
+				m_ReadyJobs.erase(m_ReadyJobs.begin() + i);
+			}
+			else
+			{
+				++i;
+			}
+		}
+	}
+
+	UploadManager* pUploadManager = m_pRenderer->GetUploadManager();
+	if (!m_UploadJobs.empty())
+	{
+		for (UINT64 i = 0, size = m_UploadJobs.size(); i < size; ++i)
+		{
+			uploadJob(m_UploadJobs[i]);
+		}
+
+		// ̹ frame ø asset copy  batch.
+		const UINT64 TICKET = pUploadManager->Flush();
+		for (UINT64 i = 0, size = m_UploadJobs.size(); i < size; ++i)
+		{
+			m_UploadJobs[i]->UploadTicket = TICKET;
+			m_CopyingJobs.push_back(m_UploadJobs[i]);
+		}
+		m_UploadJobs.clear();
+	}
+
+	// copy  asset scene . ticket ø  Ƿ տ.
+	UINT64 completedCount = 0;
+	while (completedCount < m_CopyingJobs.size())
+	{
+		AssetLoadJob* pJob = m_CopyingJobs[completedCount];
+		if (!pUploadManager->IsTicketComplete(pJob->UploadTicket))
+		{
+			break;
+		}
+
+		reportJob(pJob);
+		if (pJob->pfnCallback)
+		{
+			pJob->pfnCallback(pJob, pJob->pUserData);
+		}
+		else if (pJob->pModel)
+		{
+			delete pJob->pModel;
+		}
+
+		delete pJob;
+		m_PendingJobCount.fetch_sub(1);
+		++completedCount;
+	}
+	m_CopyingJobs.erase(m_CopyingJobs.begin(), m_CopyingJobs.begin() + completedCount);
+}
+
+void AssetLoader::Cleanup()
+{
+	if (m_pWorkerThreads)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_TaskLock);
+			m_bShutdown = true;
+		}
+		m_TaskCondition.notify_all();
+
+		for (UINT i = 0; i < m_WorkerThreadCount; ++i)
+		{
+			m_pWorkerThreads[i].join();
+		}
+		delete[] m_pWorkerThreads;
+		m_pWorkerThreads = nullptr;
+	}
+	m_WorkerThreadCount = 0;
+
+	// worker  Ƿ asset queue ƴϸ upload  Ͽ .
+	while (!m_Tasks.empty())
+	{
+		const AssetLoadTask& TASK = m_Tasks.front();
+		if (TASK.pJob)
+		{
+			delete TASK.pJob;
+		}
+		m_Tasks.pop_front();
+	}
+	for (UINT64 i = 0, size = m_ReadyJobs.size(); i < size; ++i)
+	{
+		delete m_ReadyJobs[i];
+	}
+	m_ReadyJobs.clear();
+
+	// copy  resource   .
+	for (UINT64 i = 0, size = m_CopyingJobs.size(); i < size; ++i)
+	{
+		AssetLoadJob* pJob = m_CopyingJobs[i];
+		m_pRenderer->GetUploadManager()->WaitForTicket(pJob->UploadTicket);
+		if (pJob->pModel)
+		{
+			delete pJob->pModel;
+		}
+		delete pJob;
+	}
+	m_CopyingJobs.clear();
+	m_PendingJobCount = 0;
+
+	if (m_pRenderer)
+	{
+		releaseTextures();
+		m_pRenderer = nullptr;
+	}
+}
+
+void AssetLoader::workerThread(AssetLoader* pLoader)
+{
+	while (true)
+	{
+		AssetLoadTask task;
+		{
+			std::unique_lock<std::mutex> lock(pLoader->m_TaskLock);
+			pLoader->m_TaskCondition.wait(lock, [pLoader]() { return !pLoader->m_Tasks.empty() || pLoader->m_bShutdown; });
+			if (pLoader->m_bShutdown)
+			{
+				break;
+			}
+
+			task = pLoader->m_Tasks.front();
+			pLoader->m_Tasks.pop_front();
+		}
+
+		if (task.pJob)
+		{
+			pLoader->runJobStage(task.pJob);
+		}
+		else
+		{
+			pLoader->runTextureStage(task.pTexture);
+		}
+	}
+}
+
+void AssetLoader::pushTask(AssetLoadJob* pJob, LoadingTexture* pTexture)
+{
+	_ASSERT((pJob != nullptr) != (pTexture != nullptr));
+
+	{
+		std::lock_guard<std::mutex> lock(m_TaskLock);
+		m_Tasks.push_back({ pJob, pTexture });
+	}
+	m_TaskCondition.notify_one();
+}
+
+void AssetLoader::runJobStage(AssetLoadJob* pJob)
+{
+	_ASSERT(pJob);
+
+	//  ܰ ڷδ ٷ ؼ main 忡 callback ˸.
+	switch (pJob->Stage)
+	{
+		case AssetLoadStage_FileRead:
+			ReadAssetFiles(&pJob->Data);
+			pJob->Stage = AssetLoadStage_Decode;
+			pushTask(pJob, nullptr);
+			break;
+
+		case AssetLoadStage_Decode:
+			DecodeAsset(&pJob->Data);
+			if (SUCCEEDED(pJob->Data.Result))
+			{
+				// ؽ ̸ ˰ Ǵ  decode ؼ process ġ .
+				claimTextures(pJob);
+			}
+			pJob->Stage = AssetLoadStage_Process;
+			pushTask(pJob, nullptr);
+			break;
+
+		case AssetLoadStage_Process:
+			ProcessAsset(&pJob->Data);
+			pJob->Stage = AssetLoadStage_Upload;
+			{
+				std::lock_guard<std::mutex> lock(m_ReadyLock);
+				m_ReadyJobs.push_back(pJob);
+			}
+			break;
+
+		default:
+			__debugbreak();
+			break;
+	}
+}
+
+void AssetLoader::runTextureStage(LoadingTexture* pTexture)
+{
+	_ASSERT(pTexture);
+
+	switch (pTexture->Stage)
+	{
+		case AssetLoadStage_FileRead:
+			ReadTextureFile(&pTexture->Texture);
+			pTexture->Stage = AssetLoadStage_Decode;
+			pushTask(nullptr, pTexture);
+			break;
+
+		case AssetLoadStage_Decode:
+			DecodeTexture(&pTexture->Texture);
+			pTexture->Stage = AssetLoadStage_Upload;
+			pTexture->bDecoded.store(true, std::memory_order_release);
+			break;
+
+		default:
+			__debugbreak();
+			break;
+	}
+}
+
+void AssetLoader::claimTextures(AssetLoadJob* pJob)
+{
+	_ASSERT(pJob);
+
+	// Ͽ  mesh process  MeshLoader .
+	const AssetLoadData& DATA = pJob->Data;
+	const std::vector<MeshInfo>& MESH_INFOS = (DATA.MeshInfos.empty() ? DATA.MeshLoader.MeshInfos : DATA.MeshInfos);
+
+	std::vector<std::wstring> fileNames;
+	std::vector<bool> useSRGBs;
+	CollectTextureFileNames(MESH_INFOS, &fileNames, &useSRGBs);
+
+	for (UINT64 i = 0, size = fileNames.size(); i < size; ++i)
+	{
+		LoadingTexture* pTexture = nullptr;
+		bool bCreated = false;
+		{
+			std::lock_guard<std::mutex> lock(m_TextureLock);
+			auto iter = m_Textures.find(fileNames[i]);
+			if (iter != m_Textures.end())
+			{
+				pTexture = iter->second;
+			}
+			else
+			{
+				pTexture = new LoadingTexture;
+				pTexture->Texture.FileName = fileNames[i];
+				pTexture->Texture.bUseSRGB = useSRGBs[i];
+				m_Textures[fileNames[i]] = pTexture;
+				bCreated = true;
+			}
+		}
+
+		pJob->Textures.push_back(pTexture);
+		if (bCreated)
+		{
+			pushTask(nullptr, pTexture);
+		}
+	}
+}
+
+bool AssetLoader::isReadyToUpload(const AssetLoadJob* pJOB) const
+{
+	_ASSERT(pJOB);
+
+	for (UINT64 i = 0, size = pJOB->Textures.size(); i < size; ++i)
+	{
+		if (!pJOB->Textures[i]->bDecoded.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AssetLoader::uploadJob(AssetLoadJob* pJob)
+{
+	_ASSERT(m_pRenderer);
+	_ASSERT(pJob);
+
+	AssetLoadData& data = pJob->Data;
+	TextureManager* pTextureManager = m_pRenderer->GetTextureManager();
+
+	LARGE_INTEGER beginTime;
+	LARGE_INTEGER endTime;
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&beginTime);
+
+	if (SUCCEEDED(data.Result))
+	{
+		// decode  ؽĸ  ̸  . Model::Initialize  ̸ ã ϹǷ  ٽ  .
+		for (UINT64 i = 0, size = pJob->Textures.size(); i < size; ++i)
+		{
+			LoadingTexture* pTexture = pJob->Textures[i];
+			DecodedTexture& texture = pTexture->Texture;
+			if (pTexture->pHandle || FAILED(texture.Result) || texture.Image.empty())
+			{
+				continue;
+			}
+
+			pTexture->pHandle = pTextureManager->CreateTextureFromImage(texture.FileName.c_str(), texture.Image.data(), (UINT)texture.Width, (UINT)texture.Height, texture.Format);
+			std::vector<UCHAR>().swap(texture.Image);
+		}
+
+		if (data.Desc.Type == AssetType_Character)
+		{
+			SkinnedMeshModel* pCharacter = new SkinnedMeshModel;
+			pCharacter->Initialize(m_pRenderer, data.MeshInfos, data.AnimData);
+			pJob->pModel = pCharacter;
+		}
+		else
+		{
+			pJob->pModel = new Model;
+			pJob->pModel->Initialize(m_pRenderer, data.MeshInfos);
+		}
+		pJob->pModel->Name = data.Desc.Name;
+	}
+
+	QueryPerformanceCounter(&endTime);
+	data.pStageTimes[AssetLoadStage_Upload] = (double)(endTime.QuadPart - beginTime.QuadPart) * 1000.0 / (double)frequency.QuadPart;
+	pJob->UploadTime = endTime;
+}
+
+void AssetLoader::reportJob(const AssetLoadJob* pJOB)
+{
+	_ASSERT(pJOB);
+
+	const AssetLoadData& DATA = pJOB->Data;
+	const double* pSTAGE_TIMES = DATA.pStageTimes;
+
+	LARGE_INTEGER curTime;
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&curTime);
+
+	// copy GPU ϷḦ Update Ȯ ð frame ݸŭ  .
+	const double COPY_TIME = (double)(curTime.QuadPart - pJOB->UploadTime.QuadPart) * 1000.0 / (double)frequency.QuadPart;
+	const double TOTAL_TIME = (double)(curTime.QuadPart - pJOB->SubmitTime.QuadPart) * 1000.0 / (double)frequency.QuadPart;
+
+	char szDebugString[512];
+	if (SUCCEEDED(DATA.Result))
+	{
+		sprintf_s(szDebugString, 512, "Asset load(%s%s): read %.2f ms (%llu bytes), decode %.2f ms, process %.2f ms, upload %.2f ms, copy %.2f ms, submit to visible %.2f ms\n",
+				  DATA.Desc.Name.c_str(), (DATA.bFromCookedAsset ? ", cooked" : ""), pSTAGE_TIMES[AssetLoadStage_FileRead], DATA.FileReadBytes,
+				  pSTAGE_TIMES[AssetLoadStage_Decode], pSTAGE_TIMES[AssetLoadStage_Process], pSTAGE_TIMES[AssetLoadStage_Upload], COPY_TIME, TOTAL_TIME);
+	}
+	else
+	{
+		sprintf_s(szDebugString, 512, "Failed to load asset(%s): 0x%08x\n", DATA.Desc.Name.c_str(), (UINT)DATA.Result);
+	}
+	OutputDebugStringA(szDebugString);
+}
+
+void AssetLoader::releaseTextures()
+{
+	_ASSERT(m_pRenderer);
+
+	TextureManager* pTextureManager = m_pRenderer->GetTextureManager();
+
+	std::lock_guard<std::mutex> lock(m_TextureLock);
+	for (auto iter = m_Textures.begin(), endIter = m_Textures.end(); iter != endIter; ++iter)
+	{
+		LoadingTexture* pTexture = iter->second;
+		if (pTexture->pHandle)
+		{
+			pTextureManager->DeleteTexture(pTexture->pHandle);
+			pTexture->pHandle = nullptr;
+		}
+		delete pTexture;
+	}
+	m_Textures.clear();
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include "AssetLoadStage.h"
+
+// asset worker 忡 . ܰ ϳ ĥ  queue ڷ ٽ Ƿ
+//  asset file read, decode, process worker ̿  .
+// GPU upload Ϸ callback Update θ main 忡. upload frame  batch copy queue ְ,
+//  ticket   Update callback. graphics queue copy ٸ .
+
+class Model;
+class Renderer;
+struct TextureHandle;
+struct AssetLoadJob;
+
+static const UINT MAX_ASSET_LOAD_WORKER_COUNT = 8;
+
+// pJob->pModel callback .  nullptr.
+typedef void (*AssetLoadCallback)(AssetLoadJob* pJob, void* pUserData);
+
+//  asset   material ؽ. ̸ ϳ.
+struct LoadingTexture
+{
+	DecodedTexture Texture;
+	eAssetLoadStage Stage = AssetLoadStage_FileRead;
+	std::atomic<bool> bDecoded{ false };
+	TextureHandle* pHandle = nullptr; // main 忡.
+};
+
+struct AssetLoadJob
+{
+	AssetLoadData Data;
+	eAssetLoadStage Stage = AssetLoadStage_FileRead; //   ܰ.
+	std::vector<LoadingTexture*> Textures;			 //  decode ڿ upload.
+	AssetLoadCallback pfnCallback = nullptr;
+	void* pUserData = nullptr;
+	Model* pModel = nullptr;
+	UINT64 UploadTicket = 0; //  callback.
+	LARGE_INTEGER SubmitTime;
+	LARGE_INTEGER UploadTime; // upload  ģ ð.
+};
+
+// worker queue ׸.   ϳ .
+struct AssetLoadTask
+{
+	AssetLoadJob* pJob;
+	LoadingTexture* pTexture;
+};
+
+class AssetLoader
+{
+public:
+	AssetLoader() = default;
+	~AssetLoader() { Cleanup(); }
+
+	void Initialize(Renderer* pRenderer, UINT workerThreadCount);
+
+	// main . DESC  .
+	void Submit(const AssetLoadDesc& DESC, AssetLoadCallback pfnCallback, void* pUserData);
+
+	// main . CPU ܰ谡  asset ִ MAX_UPLOAD_COUNT GPU ø callback ȣ.
+	void Update(const UINT MAX_UPLOAD_COUNT);
+
+	//  asset callback  .
+	void Cleanup();
+
+	inline UINT GetPendingCount() const { return (UINT)m_PendingJobCount.load(); }
+
+protected:
+	static void workerThread(AssetLoader* pLoader);
+
+	void pushTask(AssetLoadJob* pJob, LoadingTexture* pTexture);
+	void runJobStage(AssetLoadJob* pJob);
+	void runTextureStage(LoadingTexture* pTexture);
+
+	// ó  ؽĸ queue .  ٸ asset decode   .
+	void claimTextures(AssetLoadJob* pJob);
+
+	bool isReadyToUpload(const AssetLoadJob* pJOB) const;
+	void uploadJob(AssetLoadJob* pJob);
+	void reportJob(const AssetLoadJob* pJOB);
+
+	//   asset  . ؽĴ model ref  .
+	void releaseTextures();
+
+private:
+	Renderer* m_pRenderer = nullptr;
+
+	std::thread* m_pWorkerThreads = nullptr;
+	UINT m_WorkerThreadCount = 0;
+
+	std::mutex m_TaskLock;
+	std::condition_variable m_TaskCondition;
+	std::deque<AssetLoadTask> m_Tasks;
+	bool m_bShutdown = false;
+
+	std::mutex m_ReadyLock;
+	std::vector<AssetLoadJob*> m_ReadyJobs; // process  upload .
+	std::vector<AssetLoadJob*> m_UploadJobs;
+	std::vector<AssetLoadJob*> m_CopyingJobs; // upload ߰ copy queue  ٸ.
+
+	std::mutex m_TextureLock;
+	std::unordered_map<std::wstring, LoadingTexture*> m_Textures;
+
+	std::atomic<long> m_PendingJobCount{ 0 };
+};
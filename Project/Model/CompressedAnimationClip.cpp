@@ -0,0 +1,796 @@
+#include "../pch.h"
+#include "AnimationData.h"
+#include "CompressedAnimationClip.h"
+
+// smallest-three    [-1/sqrt(2), 1/sqrt(2)].
+static const float ROTATION_RANGE = 0.70710678f;
+static const float ROTATION_QUANTIZE_MAX = 32767.0f; // 15bit.
+static const float VECTOR_QUANTIZE_MAX = 65535.0f;	 // 16bit.
+
+// Serialize տ ٴ 迭 ũ,  .
+struct CompressedClipHeader
+{
+	UINT BoneTrackCount;
+	UINT ConstantRotationCount;
+	UINT ConstantVectorCount;
+	UINT RotationTargetCount;
+	UINT VectorTrackCount;
+	UINT RawVectorTargetCount;
+	UINT RotationSampleCount;
+	UINT VectorSampleCount;
+	UINT RawVectorSampleCount;
+	UINT SampleCount;
+	double StartTime;
+	double SampleRate;
+	float MaxRotationError;
+	float MaxTranslationError;
+	float MaxScaleError;
+};
+
+template <typename T>
+static void AppendArray(std::vector<BYTE>* pOut, const std::vector<T>& SRC)
+{
+	const UINT64 OFFSET = pOut->size();
+	const UINT64 SIZE = SRC.size() * sizeof(T);
+	pOut->resize(OFFSET + SIZE);
+	if (SIZE > 0)
+	{
+		memcpy(pOut->data() + OFFSET, SRC.data(), SIZE);
+	}
+}
+
+template <typename T>
+static bool ReadArray(const BYTE** ppSRC, const BYTE* pEND, const UINT COUNT, std::vector<T>* pOut)
+{
+	const UINT64 SIZE = (UINT64)COUNT * sizeof(T);
+	if ((UINT64)(pEND - *ppSRC) < SIZE)
+	{
+		return false;
+	}
+
+	pOut->resize(COUNT);
+	if (SIZE > 0)
+	{
+		memcpy(pOut->data(), *ppSRC, SIZE);
+	}
+	*ppSRC += SIZE;
+	return true;
+}
+
+static bool GetClipTimeRange(const AnimationClip& CLIP, double* pOutStartTime, double* pOutEndTime, UINT* pOutSampleCount)
+{
+	double startTime = DBL_MAX;
+	double endTime = -DBL_MAX;
+	UINT64 maxKeyCount = 1;
+
+	for (UINT64 boneID = 0, totalBone = CLIP.Keys.size(); boneID < totalBone; ++boneID)
+	{
+		const std::vector<AnimationClip::Key>& KEYS = CLIP.Keys[boneID];
+		const UINT64 KEY_SIZE = KEYS.size();
+		if (KEY_SIZE == 0)
+		{
+			return false;
+		}
+		if (KEY_SIZE == 1)
+		{
+			continue;
+		}
+
+		// ð  ʴ track(ð ä  key ) ٽ sample  .
+		for (UINT64 i = 1; i < KEY_SIZE; ++i)
+		{
+			if (KEYS[i].Time <= KEYS[i - 1].Time)
+			{
+				return false;
+			}
+		}
+
+		startTime = (KEYS[0].Time < startTime ? KEYS[0].Time : startTime);
+		endTime = (KEYS[KEY_SIZE - 1].Time > endTime ? KEYS[KEY_SIZE - 1].Time : endTime);
+		maxKeyCount = (KEY_SIZE > maxKeyCount ? KEY_SIZE : maxKeyCount);
+	}
+
+	if (maxKeyCount == 1)
+	{
+		//  track key ϳ. sample ϳ .
+		startTime = 0.0;
+		endTime = 0.0;
+	}
+
+	*pOutStartTime = startTime;
+	*pOutEndTime = endTime;
+	*pOutSampleCount = (UINT)maxKeyCount;
+	return true;
+}
+
+// AnimationData::InterpolateKeyData    key sample.
+static void SampleSourceKeys(const std::vector<AnimationClip::Key>& KEYS, const double TIME, Vector3* pOutPosition, Quaternion* pOutRotation, Vector3* pOutScale)
+{
+	const UINT64 KEY_SIZE = KEYS.size();
+	if (KEY_SIZE == 1)
+	{
+		*pOutPosition = KEYS[0].Position;
+		*pOutRotation = KEYS[0].Rotation;
+		*pOutScale = KEYS[0].Scale;
+		return;
+	}
+
+	UINT64 low = 0;
+	UINT64 high = KEY_SIZE - 2;
+	while (low < high)
+	{
+		UINT64 mid = low + (high - low) / 2;
+		if (TIME < KEYS[mid + 1].Time)
+		{
+			high = mid;
+		}
+		else
+		{
+			low = mid + 1;
+		}
+	}
+
+	const AnimationClip::Key& CUR_KEY = KEYS[low];
+	const AnimationClip::Key& NEXT_KEY = KEYS[low + 1];
+	float factor = (float)((TIME - CUR_KEY.Time) / (NEXT_KEY.Time - CUR_KEY.Time));
+	factor = (factor < 0.0f ? 0.0f : (factor > 1.0f ? 1.0f : factor));
+
+	*pOutPosition = Vector3::Lerp(CUR_KEY.Position, NEXT_KEY.Position, factor);
+	*pOutScale = Vector3::Lerp(CUR_KEY.Scale, NEXT_KEY.Scale, factor);
+	*pOutRotation = Quaternion::Slerp(CUR_KEY.Rotation, NEXT_KEY.Rotation, factor);
+	pOutRotation->Normalize();
+}
+
+// q -q  ȸ̹Ƿ  ʰ .
+static float GetRotationError(const Quaternion& A, const Quaternion& B)
+{
+	const float SIGN = (A.x * B.x + A.y * B.y + A.z * B.z + A.w * B.w < 0.0f ? -1.0f : 1.0f);
+	float error = fabsf(A.x - SIGN * B.x);
+	error = fmaxf(error, fabsf(A.y - SIGN * B.y));
+	error = fmaxf(error, fabsf(A.z - SIGN * B.z));
+	error = fmaxf(error, fabsf(A.w - SIGN * B.w));
+	return error;
+}
+
+static float GetVectorError(const Vector3& A, const Vector3& B)
+{
+	return fmaxf(fabsf(A.x - B.x), fmaxf(fabsf(A.y - B.y), fabsf(A.z - B.z)));
+}
+
+static void EncodeRotation(const Quaternion& ROTATION, UINT16* pDest)
+{
+	float pComponents[4] = { ROTATION.x, ROTATION.y, ROTATION.z, ROTATION.w };
+
+	UINT largestIndex = 0;
+	for (UINT i = 1; i < 4; ++i)
+	{
+		if (fabsf(pComponents[i]) > fabsf(pComponents[largestIndex]))
+		{
+			largestIndex = i;
+		}
+	}
+
+	//  ū   ߸   .
+	const float SIGN = (pComponents[largestIndex] < 0.0f ? -1.0f : 1.0f);
+
+	UINT16 pQuantized[3];
+	for (UINT i = 0, dest = 0; i < 4; ++i)
+	{
+		if (i == largestIndex)
+		{
+			continue;
+		}
+
+		float normalized = (SIGN * pComponents[i] + ROTATION_RANGE) / (2.0f * ROTATION_RANGE);
+		normalized = (normalized < 0.0f ? 0.0f : (normalized > 1.0f ? 1.0f : normalized));
+		pQuantized[dest++] = (UINT16)(normalized * ROTATION_QUANTIZE_MAX + 0.5f);
+	}
+
+	//  ū  index 2bit   ĭ ֻ bit.
+	pDest[0] = (UINT16)(((largestIndex >> 1) << 15) | pQuantized[0]);
+	pDest[1] = (UINT16)(((largestIndex & 1) << 15) | pQuantized[1]);
+	pDest[2] = pQuantized[2];
+}
+
+static inline __m128 SelectPS(const __m128 MASK, const __m128 A, const __m128 B)
+{
+	return _mm_or_ps(_mm_and_ps(MASK, A), _mm_andnot_ps(MASK, B));
+}
+
+// 4 track smallest-three  SoA .
+static void DecodeRotations4(const UINT16* pSRC, const UINT LANE_COUNT, __m128* pOutX, __m128* pOutY, __m128* pOutZ, __m128* pOutW)
+{
+	_ASSERT(LANE_COUNT > 0 && LANE_COUNT <= 4);
+
+	alignas(16) int pA[4] = { 0, };
+	alignas(16) int pB[4] = { 0, };
+	alignas(16) int pC[4] = { 0, };
+	alignas(16) int pLargestIndex[4] = { 0, };
+	for (UINT lane = 0; lane < LANE_COUNT; ++lane)
+	{
+		const UINT16* pLANE = pSRC + lane * 3;
+		pA[lane] = pLANE[0] & 0x7fff;
+		pB[lane] = pLANE[1] & 0x7fff;
+		pC[lane] = pLANE[2];
+		pLargestIndex[lane] = ((pLANE[0] >> 15) << 1) | (pLANE[1] >> 15);
+	}
+
+	const __m128 SCALE = _mm_set1_ps(2.0f * ROTATION_RANGE / ROTATION_QUANTIZE_MAX);
+	const __m128 BIAS = _mm_set1_ps(-ROTATION_RANGE);
+	const __m128 ONE = _mm_set1_ps(1.0f);
+
+	__m128 a = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_load_si128((const __m128i*)pA)), SCALE), BIAS);
+	__m128 b = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_load_si128((const __m128i*)pB)), SCALE), BIAS);
+	__m128 c = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_load_si128((const __m128i*)pC)), SCALE), BIAS);
+
+	__m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+	__m128 largest = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(ONE, sum), _mm_setzero_ps()));
+
+	const __m128i LARGEST_INDEX = _mm_load_si128((const __m128i*)pLargestIndex);
+	const __m128 IS_X = _mm_castsi128_ps(_mm_cmpeq_epi32(LARGEST_INDEX, _mm_set1_epi32(0)));
+	const __m128 IS_Y = _mm_castsi128_ps(_mm_cmpeq_epi32(LARGEST_INDEX, _mm_set1_epi32(1)));
+	const __m128 IS_Z = _mm_castsi128_ps(_mm_cmpeq_epi32(LARGEST_INDEX, _mm_set1_epi32(2)));
+	const __m128 IS_W = _mm_castsi128_ps(_mm_cmpeq_epi32(LARGEST_INDEX, _mm_set1_epi32(3)));
+
+	//   ڸ largest  ְ    ĭ .
+	*pOutX = SelectPS(IS_X, largest, a);
+	*pOutY = SelectPS(IS_X, a, SelectPS(IS_Y, largest, b));
+	*pOutZ = SelectPS(_mm_or_ps(IS_X, IS_Y), b, SelectPS(IS_Z, largest, c));
+	*pOutW = SelectPS(IS_W, largest, c);
+}
+
+static inline void StoreVector3(Vector3* pDest, const __m128 VALUE)
+{
+	_mm_storel_pi((__m64*)pDest, VALUE);
+	_mm_store_ss(&pDest->z, _mm_movehl_ps(VALUE, VALUE));
+}
+
+bool CompressedAnimationClip::Initialize(const AnimationClip& CLIP, const AnimationCompressionSettings& SETTINGS)
+{
+	Cleanup();
+
+	double startTime;
+	double endTime;
+	UINT sampleCount;
+	if (!GetClipTimeRange(CLIP, &startTime, &endTime, &sampleCount))
+	{
+		return false;
+	}
+
+	const UINT BONE_COUNT = (UINT)CLIP.Keys.size();
+	const double SAMPLE_RATE = (sampleCount > 1 ? (double)(sampleCount - 1) / (endTime - startTime) : 0.0);
+
+	//   ٽ sample. [sample][bone].
+	std::vector<Vector3> positions((UINT64)sampleCount * BONE_COUNT);
+	std::vector<Quaternion> rotations((UINT64)sampleCount * BONE_COUNT);
+	std::vector<Vector3> scales((UINT64)sampleCount * BONE_COUNT);
+	for (UINT sample = 0; sample < sampleCount; ++sample)
+	{
+		const double TIME = (sampleCount > 1 ? startTime + (double)sample / SAMPLE_RATE : startTime);
+		for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+		{
+			const UINT64 INDEX = (UINT64)sample * BONE_COUNT + boneID;
+			SampleSourceKeys(CLIP.Keys[boneID], TIME, &positions[INDEX], &rotations[INDEX], &scales[INDEX]);
+		}
+	}
+
+	// track  /  / raw .
+	m_BoneTracks.resize(BONE_COUNT);
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		CompressedBoneTrack& boneTrack = m_BoneTracks[boneID];
+
+		{
+			Quaternion first = rotations[boneID];
+			first.Normalize();
+
+			// ù sample ״ Ƿ Ѱ  ȿ ־ .
+			bool bConstant = true;
+			for (UINT sample = 1; sample < sampleCount; ++sample)
+			{
+				if (GetRotationError(rotations[(UINT64)sample * BONE_COUNT + boneID], first) > SETTINGS.RotationErrorBound * 0.5f)
+				{
+					bConstant = false;
+					break;
+				}
+			}
+
+			if (bConstant)
+			{
+				boneTrack.RotationFormat = CompressedTrackFormat_Constant;
+				boneTrack.RotationIndex = (UINT)m_ConstantRotations.size();
+				m_ConstantRotations.push_back(first);
+			}
+			else
+			{
+				boneTrack.RotationFormat = CompressedTrackFormat_Quantized;
+				boneTrack.RotationIndex = (UINT)m_RotationTargets.size();
+				m_RotationTargets.push_back(boneID);
+			}
+		}
+
+		for (UINT channel = CompressedTrackChannel_Translation; channel <= CompressedTrackChannel_Scale; ++channel)
+		{
+			const std::vector<Vector3>& SAMPLES = (channel == CompressedTrackChannel_Translation ? positions : scales);
+			const float BOUND = (channel == CompressedTrackChannel_Translation ? SETTINGS.TranslationErrorBound : SETTINGS.ScaleErrorBound);
+			BYTE* pFormat = (channel == CompressedTrackChannel_Translation ? &boneTrack.TranslationFormat : &boneTrack.ScaleFormat);
+			UINT* pIndex = (channel == CompressedTrackChannel_Translation ? &boneTrack.TranslationIndex : &boneTrack.ScaleIndex);
+
+			Vector3 minValue = SAMPLES[boneID];
+			Vector3 maxValue = SAMPLES[boneID];
+			for (UINT sample = 1; sample < sampleCount; ++sample)
+			{
+				const Vector3& VALUE = SAMPLES[(UINT64)sample * BONE_COUNT + boneID];
+				minValue = Vector3::Min(minValue, VALUE);
+				maxValue = Vector3::Max(maxValue, VALUE);
+			}
+
+			const Vector3 EXTENT = maxValue - minValue;
+			const float MAX_EXTENT = fmaxf(EXTENT.x, fmaxf(EXTENT.y, EXTENT.z));
+
+			if (MAX_EXTENT <= BOUND)
+			{
+				*pFormat = CompressedTrackFormat_Constant;
+				*pIndex = (UINT)m_ConstantVectors.size();
+				m_ConstantVectors.push_back((minValue + maxValue) * 0.5f);
+			}
+			else if (MAX_EXTENT / VECTOR_QUANTIZE_MAX * 0.5f <= BOUND)
+			{
+				QuantizedVectorTrack track;
+				track.RangeMin[0] = minValue.x;
+				track.RangeMin[1] = minValue.y;
+				track.RangeMin[2] = minValue.z;
+				track.RangeMin[3] = 0.0f;
+				track.RangeScale[0] = EXTENT.x / VECTOR_QUANTIZE_MAX;
+				track.RangeScale[1] = EXTENT.y / VECTOR_QUANTIZE_MAX;
+				track.RangeScale[2] = EXTENT.z / VECTOR_QUANTIZE_MAX;
+				track.RangeScale[3] = 0.0f;
+				track.Target = boneID * 2 + channel;
+
+				*pFormat = CompressedTrackFormat_Quantized;
+				*pIndex = (UINT)m_VectorTracks.size();
+				m_VectorTracks.push_back(track);
+			}
+			else
+			{
+				// 16bitδ  Ѱ踦  ߴ .
+				*pFormat = CompressedTrackFormat_Raw;
+				*pIndex = (UINT)m_RawVectorTargets.size();
+				m_RawVectorTargets.push_back(boneID * 2 + channel);
+			}
+		}
+	}
+
+	// sample track ̾ .
+	const UINT ROTATION_TRACK_COUNT = (UINT)m_RotationTargets.size();
+	const UINT VECTOR_TRACK_COUNT = (UINT)m_VectorTracks.size();
+	const UINT RAW_TRACK_COUNT = (UINT)m_RawVectorTargets.size();
+	m_RotationSamples.resize((UINT64)sampleCount * ROTATION_TRACK_COUNT * 3);
+	m_VectorSamples.resize((UINT64)sampleCount * VECTOR_TRACK_COUNT * 3);
+	m_RawVectorSamples.resize((UINT64)sampleCount * RAW_TRACK_COUNT * 3);
+
+	for (UINT sample = 0; sample < sampleCount; ++sample)
+	{
+		const UINT64 SAMPLE_OFFSET = (UINT64)sample * BONE_COUNT;
+
+		UINT16* pRotationDest = m_RotationSamples.data() + (UINT64)sample * ROTATION_TRACK_COUNT * 3;
+		for (UINT track = 0; track < ROTATION_TRACK_COUNT; ++track)
+		{
+			EncodeRotation(rotations[SAMPLE_OFFSET + m_RotationTargets[track]], pRotationDest + track * 3);
+		}
+
+		UINT16* pVectorDest = m_VectorSamples.data() + (UINT64)sample * VECTOR_TRACK_COUNT * 3;
+		for (UINT track = 0; track < VECTOR_TRACK_COUNT; ++track)
+		{
+			const QuantizedVectorTrack& TRACK = m_VectorTracks[track];
+			const UINT BONE_ID = TRACK.Target >> 1;
+			const Vector3& VALUE = ((TRACK.Target & 1) == CompressedTrackChannel_Translation ? positions : scales)[SAMPLE_OFFSET + BONE_ID];
+			const float pVALUES[3] = { VALUE.x, VALUE.y, VALUE.z };
+
+			for (UINT i = 0; i < 3; ++i)
+			{
+				float normalized = 0.0f;
+				if (TRACK.RangeScale[i] > 0.0f)
+				{
+					normalized = (pVALUES[i] - TRACK.RangeMin[i]) / (TRACK.RangeScale[i] * VECTOR_QUANTIZE_MAX);
+					normalized = (normalized < 0.0f ? 0.0f : (normalized > 1.0f ? 1.0f : normalized));
+				}
+				pVectorDest[track * 3 + i] = (UINT16)(normalized * VECTOR_QUANTIZE_MAX + 0.5f);
+			}
+		}
+
+		float* pRawDest = m_RawVectorSamples.data() + (UINT64)sample * RAW_TRACK_COUNT * 3;
+		for (UINT track = 0; track < RAW_TRACK_COUNT; ++track)
+		{
+			const UINT TARGET = m_RawVectorTargets[track];
+			const Vector3& VALUE = ((TARGET & 1) == CompressedTrackChannel_Translation ? positions : scales)[SAMPLE_OFFSET + (TARGET >> 1)];
+			pRawDest[track * 3] = VALUE.x;
+			pRawDest[track * 3 + 1] = VALUE.y;
+			pRawDest[track * 3 + 2] = VALUE.z;
+		}
+	}
+
+	m_StartTime = startTime;
+	m_SampleRate = SAMPLE_RATE;
+	m_SampleCount = sampleCount;
+
+	if (!validate(CLIP, SETTINGS))
+	{
+		Cleanup();
+		return false;
+	}
+
+	return true;
+}
+
+void CompressedAnimationClip::SamplePose(const float TIME_TICK, Vector3* pOutPositions, Quaternion* pOutRotations, Vector3* pOutScales) const
+{
+	_ASSERT(IsValid());
+	_ASSERT(pOutPositions);
+	_ASSERT(pOutRotations);
+	_ASSERT(pOutScales);
+
+	UINT sample0;
+	UINT sample1;
+	float alpha;
+	findSamples(TIME_TICK, &sample0, &sample1, &alpha);
+	const __m128 ALPHA = _mm_set1_ps(alpha);
+
+	for (UINT64 boneID = 0, totalBone = m_BoneTracks.size(); boneID < totalBone; ++boneID)
+	{
+		const CompressedBoneTrack& TRACK = m_BoneTracks[boneID];
+		if (TRACK.RotationFormat == CompressedTrackFormat_Constant)
+		{
+			pOutRotations[boneID] = m_ConstantRotations[TRACK.RotationIndex];
+		}
+		if (TRACK.TranslationFormat == CompressedTrackFormat_Constant)
+		{
+			pOutPositions[boneID] = m_ConstantVectors[TRACK.TranslationIndex];
+		}
+		if (TRACK.ScaleFormat == CompressedTrackFormat_Constant)
+		{
+			pOutScales[boneID] = m_ConstantVectors[TRACK.ScaleIndex];
+		}
+	}
+
+	// rotation. 4 track.
+	{
+		const UINT TRACK_COUNT = (UINT)m_RotationTargets.size();
+		const UINT16* pSAMPLE0 = m_RotationSamples.data() + (UINT64)sample0 * TRACK_COUNT * 3;
+		const UINT16* pSAMPLE1 = m_RotationSamples.data() + (UINT64)sample1 * TRACK_COUNT * 3;
+
+		for (UINT track = 0; track < TRACK_COUNT; track += 4)
+		{
+			const UINT LANE_COUNT = (TRACK_COUNT - track < 4 ? TRACK_COUNT - track : 4);
+
+			__m128 pRotations[4];
+			interpolateRotations4(pSAMPLE0 + track * 3, pSAMPLE1 + track * 3, LANE_COUNT, ALPHA, pRotations);
+
+			for (UINT lane = 0; lane < LANE_COUNT; ++lane)
+			{
+				_mm_storeu_ps((float*)&pOutRotations[m_RotationTargets[track + lane]], pRotations[lane]);
+			}
+		}
+	}
+
+	// translation, scale.
+	{
+		const UINT TRACK_COUNT = (UINT)m_VectorTracks.size();
+		const UINT16* pSAMPLE0 = m_VectorSamples.data() + (UINT64)sample0 * TRACK_COUNT * 3;
+		const UINT16* pSAMPLE1 = m_VectorSamples.data() + (UINT64)sample1 * TRACK_COUNT * 3;
+
+		for (UINT track = 0; track < TRACK_COUNT; ++track)
+		{
+			const QuantizedVectorTrack& TRACK = m_VectorTracks[track];
+			const __m128 RANGE_MIN = _mm_loadu_ps(TRACK.RangeMin);
+			const __m128 RANGE_SCALE = _mm_loadu_ps(TRACK.RangeScale);
+
+			const UINT16* pVALUE0 = pSAMPLE0 + track * 3;
+			const UINT16* pVALUE1 = pSAMPLE1 + track * 3;
+			__m128 value0 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(pVALUE0[0], pVALUE0[1], pVALUE0[2], 0)), RANGE_SCALE), RANGE_MIN);
+			__m128 value1 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(pVALUE1[0], pVALUE1[1], pVALUE1[2], 0)), RANGE_SCALE), RANGE_MIN);
+			__m128 value = _mm_add_ps(value0, _mm_mul_ps(_mm_sub_ps(value1, value0), ALPHA));
+
+			Vector3* pDest = ((TRACK.Target & 1) == CompressedTrackChannel_Translation ? pOutPositions : pOutScales);
+			StoreVector3(pDest + (TRACK.Target >> 1), value);
+		}
+	}
+
+	{
+		const UINT TRACK_COUNT = (UINT)m_RawVectorTargets.size();
+		const float* pSAMPLE0 = m_RawVectorSamples.data() + (UINT64)sample0 * TRACK_COUNT * 3;
+		const float* pSAMPLE1 = m_RawVectorSamples.data() + (UINT64)sample1 * TRACK_COUNT * 3;
+
+		for (UINT track = 0; track < TRACK_COUNT; ++track)
+		{
+			const UINT TARGET = m_RawVectorTargets[track];
+			const float* pVALUE0 = pSAMPLE0 + track * 3;
+			const float* pVALUE1 = pSAMPLE1 + track * 3;
+			__m128 value0 = _mm_setr_ps(pVALUE0[0], pVALUE0[1], pVALUE0[2], 0.0f);
+			__m128 value1 = _mm_setr_ps(pVALUE1[0], pVALUE1[1], pVALUE1[2], 0.0f);
+			__m128 value = _mm_add_ps(value0, _mm_mul_ps(_mm_sub_ps(value1, value0), ALPHA));
+
+			Vector3* pDest = ((TARGET & 1) == CompressedTrackChannel_Translation ? pOutPositions : pOutScales);
+			StoreVector3(pDest + (TARGET >> 1), value);
+		}
+	}
+}
+
+void CompressedAnimationClip::SampleBone(const int BONE_ID, const float TIME_TICK, Vector3* pOutPosition, Quaternion* pOutRotation, Vector3* pOutScale) const
+{
+	_ASSERT(IsValid());
+	_ASSERT(BONE_ID >= 0 && (UINT64)BONE_ID < m_BoneTracks.size());
+	_ASSERT(pOutPosition);
+	_ASSERT(pOutRotation);
+	_ASSERT(pOutScale);
+
+	UINT sample0;
+	UINT sample1;
+	float alpha;
+	findSamples(TIME_TICK, &sample0, &sample1, &alpha);
+	const __m128 ALPHA = _mm_set1_ps(alpha);
+
+	const CompressedBoneTrack& TRACK = m_BoneTracks[BONE_ID];
+
+	if (TRACK.RotationFormat == CompressedTrackFormat_Constant)
+	{
+		*pOutRotation = m_ConstantRotations[TRACK.RotationIndex];
+	}
+	else
+	{
+		const UINT TRACK_COUNT = (UINT)m_RotationTargets.size();
+		const UINT16* pSAMPLE0 = m_RotationSamples.data() + ((UINT64)sample0 * TRACK_COUNT + TRACK.RotationIndex) * 3;
+		const UINT16* pSAMPLE1 = m_RotationSamples.data() + ((UINT64)sample1 * TRACK_COUNT + TRACK.RotationIndex) * 3;
+
+		__m128 pRotations[4];
+		interpolateRotations4(pSAMPLE0, pSAMPLE1, 1, ALPHA, pRotations);
+		_mm_storeu_ps((float*)pOutRotation, pRotations[0]);
+	}
+
+	StoreVector3(pOutPosition, sampleVectorTrack(TRACK.TranslationFormat, TRACK.TranslationIndex, sample0, sample1, ALPHA));
+	StoreVector3(pOutScale, sampleVectorTrack(TRACK.ScaleFormat, TRACK.ScaleIndex, sample0, sample1, ALPHA));
+}
+
+void CompressedAnimationClip::Cleanup()
+{
+	m_BoneTracks.clear();
+	m_ConstantRotations.clear();
+	m_ConstantVectors.clear();
+	m_RotationTargets.clear();
+	m_VectorTracks.clear();
+	m_RawVectorTargets.clear();
+	m_RotationSamples.clear();
+	m_VectorSamples.clear();
+	m_RawVectorSamples.clear();
+
+	m_StartTime = 0.0;
+	m_SampleRate = 0.0;
+	m_SampleCount = 0;
+
+	m_MaxRotationError = 0.0f;
+	m_MaxTranslationError = 0.0f;
+	m_MaxScaleError = 0.0f;
+}
+
+void CompressedAnimationClip::Serialize(std::vector<BYTE>* pOut) const
+{
+	_ASSERT(pOut);
+
+	CompressedClipHeader header = {};
+	header.BoneTrackCount = (UINT)m_BoneTracks.size();
+	header.ConstantRotationCount = (UINT)m_ConstantRotations.size();
+	header.ConstantVectorCount = (UINT)m_ConstantVectors.size();
+	header.RotationTargetCount = (UINT)m_RotationTargets.size();
+	header.VectorTrackCount = (UINT)m_VectorTracks.size();
+	header.RawVectorTargetCount = (UINT)m_RawVectorTargets.size();
+	header.RotationSampleCount = (UINT)m_RotationSamples.size();
+	header.VectorSampleCount = (UINT)m_VectorSamples.size();
+	header.RawVectorSampleCount = (UINT)m_RawVectorSamples.size();
+	header.SampleCount = m_SampleCount;
+	header.StartTime = m_StartTime;
+	header.SampleRate = m_SampleRate;
+	header.MaxRotationError = m_MaxRotationError;
+	header.MaxTranslationError = m_MaxTranslationError;
+	header.MaxScaleError = m_MaxScaleError;
+
+	const UINT64 OFFSET = pOut->size();
+	pOut->resize(OFFSET + sizeof(CompressedClipHeader));
+	memcpy(pOut->data() + OFFSET, &header, sizeof(CompressedClipHeader));
+
+	AppendArray(pOut, m_BoneTracks);
+	AppendArray(pOut, m_ConstantRotations);
+	AppendArray(pOut, m_ConstantVectors);
+	AppendArray(pOut, m_RotationTargets);
+	AppendArray(pOut, m_VectorTracks);
+	AppendArray(pOut, m_RawVectorTargets);
+	AppendArray(pOut, m_RotationSamples);
+	AppendArray(pOut, m_VectorSamples);
+	AppendArray(pOut, m_RawVectorSamples);
+}
+
+bool CompressedAnimationClip::Deserialize(const BYTE* pSRC, const UINT64 SIZE)
+{
+	_ASSERT(pSRC);
+
+	Cleanup();
+
+	if (SIZE < sizeof(CompressedClipHeader))
+	{
+		return false;
+	}
+
+	CompressedClipHeader header;
+	memcpy(&header, pSRC, sizeof(CompressedClipHeader));
+
+	const BYTE* pCur = pSRC + sizeof(CompressedClipHeader);
+	const BYTE* pEND = pSRC + SIZE;
+	if (!ReadArray(&pCur, pEND, header.BoneTrackCount, &m_BoneTracks) ||
+		!ReadArray(&pCur, pEND, header.ConstantRotationCount, &m_ConstantRotations) ||
+		!ReadArray(&pCur, pEND, header.ConstantVectorCount, &m_ConstantVectors) ||
+		!ReadArray(&pCur, pEND, header.RotationTargetCount, &m_RotationTargets) ||
+		!ReadArray(&pCur, pEND, header.VectorTrackCount, &m_VectorTracks) ||
+		!ReadArray(&pCur, pEND, header.RawVectorTargetCount, &m_RawVectorTargets) ||
+		!ReadArray(&pCur, pEND, header.RotationSampleCount, &m_RotationSamples) ||
+		!ReadArray(&pCur, pEND, header.VectorSampleCount, &m_VectorSamples) ||
+		!ReadArray(&pCur, pEND, header.RawVectorSampleCount, &m_RawVectorSamples) ||
+		pCur != pEND)
+	{
+		Cleanup();
+		return false;
+	}
+
+	m_StartTime = header.StartTime;
+	m_SampleRate = header.SampleRate;
+	m_SampleCount = header.SampleCount;
+	m_MaxRotationError = header.MaxRotationError;
+	m_MaxTranslationError = header.MaxTranslationError;
+	m_MaxScaleError = header.MaxScaleError;
+	return true;
+}
+
+UINT64 CompressedAnimationClip::GetMemorySize() const
+{
+	UINT64 size = sizeof(CompressedAnimationClip);
+	size += m_BoneTracks.capacity() * sizeof(CompressedBoneTrack);
+	size += m_ConstantRotations.capacity() * sizeof(Quaternion);
+	size += m_ConstantVectors.capacity() * sizeof(Vector3);
+	size += m_RotationTargets.capacity() * sizeof(UINT);
+	size += m_VectorTracks.capacity() * sizeof(QuantizedVectorTrack);
+	size += m_RawVectorTargets.capacity() * sizeof(UINT);
+	size += m_RotationSamples.capacity() * sizeof(UINT16);
+	size += m_VectorSamples.capacity() * sizeof(UINT16);
+	size += m_RawVectorSamples.capacity() * sizeof(float);
+	return size;
+}
+
+void CompressedAnimationClip::findSamples(const float TIME_TICK, UINT* pOutSample0, UINT* pOutSample1, float* pOutAlpha) const
+{
+	_ASSERT(pOutSample0);
+	_ASSERT(pOutSample1);
+	_ASSERT(pOutAlpha);
+
+	// ù sample ,  sample Ĵ  sample .
+	const double LAST_SAMPLE = (double)(m_SampleCount - 1);
+	double fSample = ((double)TIME_TICK - m_StartTime) * m_SampleRate;
+	fSample = (fSample < 0.0 ? 0.0 : (fSample > LAST_SAMPLE ? LAST_SAMPLE : fSample));
+
+	const UINT SAMPLE0 = (UINT)fSample;
+	*pOutSample0 = SAMPLE0;
+	*pOutSample1 = (SAMPLE0 + 1 < m_SampleCount ? SAMPLE0 + 1 : SAMPLE0);
+	*pOutAlpha = (float)(fSample - (double)SAMPLE0);
+}
+
+void CompressedAnimationClip::interpolateRotations4(const UINT16* pSRC0, const UINT16* pSRC1, const UINT LANE_COUNT, const __m128 ALPHA, __m128* pOutRotations) const
+{
+	_ASSERT(pOutRotations);
+
+	__m128 x0, y0, z0, w0;
+	__m128 x1, y1, z1, w1;
+	DecodeRotations4(pSRC0, LANE_COUNT, &x0, &y0, &z0, &w0);
+	DecodeRotations4(pSRC1, LANE_COUNT, &x1, &y1, &z1, &w1);
+
+	// ȣ ٸ ª    sample .
+	__m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, x1), _mm_mul_ps(y0, y1)), _mm_add_ps(_mm_mul_ps(z0, z1), _mm_mul_ps(w0, w1)));
+	__m128 flip = _mm_and_ps(dot, _mm_set1_ps(-0.0f));
+	x1 = _mm_xor_ps(x1, flip);
+	y1 = _mm_xor_ps(y1, flip);
+	z1 = _mm_xor_ps(z1, flip);
+	w1 = _mm_xor_ps(w1, flip);
+
+	//  sample ̴  Ƿ nlerp.
+	__m128 x = _mm_add_ps(x0, _mm_mul_ps(_mm_sub_ps(x1, x0), ALPHA));
+	__m128 y = _mm_add_ps(y0, _mm_mul_ps(_mm_sub_ps(y1, y0), ALPHA));
+	__m128 z = _mm_add_ps(z0, _mm_mul_ps(_mm_sub_ps(z1, z0), ALPHA));
+	__m128 w = _mm_add_ps(w0, _mm_mul_ps(_mm_sub_ps(w1, w0), ALPHA));
+
+	__m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w)));
+	__m128 inverseLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSquared));
+	x = _mm_mul_ps(x, inverseLength);
+	y = _mm_mul_ps(y, inverseLength);
+	z = _mm_mul_ps(z, inverseLength);
+	w = _mm_mul_ps(w, inverseLength);
+
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+	pOutRotations[0] = x;
+	pOutRotations[1] = y;
+	pOutRotations[2] = z;
+	pOutRotations[3] = w;
+}
+
+__m128 CompressedAnimationClip::sampleVectorTrack(const BYTE FORMAT, const UINT INDEX, const UINT SAMPLE0, const UINT SAMPLE1, const __m128 ALPHA) const
+{
+	__m128 value0;
+	__m128 value1;
+
+	switch (FORMAT)
+	{
+		case CompressedTrackFormat_Constant:
+		{
+			const Vector3& VALUE = m_ConstantVectors[INDEX];
+			return _mm_setr_ps(VALUE.x, VALUE.y, VALUE.z, 0.0f);
+		}
+
+		case CompressedTrackFormat_Quantized:
+		{
+			const UINT TRACK_COUNT = (UINT)m_VectorTracks.size();
+			const QuantizedVectorTrack& TRACK = m_VectorTracks[INDEX];
+			const __m128 RANGE_MIN = _mm_loadu_ps(TRACK.RangeMin);
+			const __m128 RANGE_SCALE = _mm_loadu_ps(TRACK.RangeScale);
+
+			const UINT16* pVALUE0 = m_VectorSamples.data() + ((UINT64)SAMPLE0 * TRACK_COUNT + INDEX) * 3;
+			const UINT16* pVALUE1 = m_VectorSamples.data() + ((UINT64)SAMPLE1 * TRACK_COUNT + INDEX) * 3;
+			value0 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(pVALUE0[0], pVALUE0[1], pVALUE0[2], 0)), RANGE_SCALE), RANGE_MIN);
+			value1 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(pVALUE1[0], pVALUE1[1], pVALUE1[2], 0)), RANGE_SCALE), RANGE_MIN);
+		}
+		break;
+
+		case CompressedTrackFormat_Raw:
+		{
+			const UINT TRACK_COUNT = (UINT)m_RawVectorTargets.size();
+			const float* pVALUE0 = m_RawVectorSamples.data() + ((UINT64)SAMPLE0 * TRACK_COUNT + INDEX) * 3;
+			const float* pVALUE1 = m_RawVectorSamples.data() + ((UINT64)SAMPLE1 * TRACK_COUNT + INDEX) * 3;
+			value0 = _mm_setr_ps(pVALUE0[0], pVALUE0[1], pVALUE0[2], 0.0f);
+			value1 = _mm_setr_ps(pVALUE1[0], pVALUE1[1], pVALUE1[2], 0.0f);
+		}
+		break;
+
+		default:
+			__debugbreak();
+			return _mm_setzero_ps();
+	}
+
+	return _mm_add_ps(value0, _mm_mul_ps(_mm_sub_ps(value1, value0), ALPHA));
+}
+
+bool CompressedAnimationClip::validate(const AnimationClip& CLIP, const AnimationCompressionSettings& SETTINGS)
+{
+	//   key    .
+	m_MaxRotationError = 0.0f;
+	m_MaxTranslationError = 0.0f;
+	m_MaxScaleError = 0.0f;
+
+	for (UINT64 boneID = 0, totalBone = CLIP.Keys.size(); boneID < totalBone; ++boneID)
+	{
+		const std::vector<AnimationClip::Key>& KEYS = CLIP.Keys[boneID];
+		for (UINT64 i = 0, keySize = KEYS.size(); i < keySize; ++i)
+		{
+			const AnimationClip::Key& KEY = KEYS[i];
+
+			Vector3 position;
+			Quaternion rotation;
+			Vector3 scale;
+			SampleBone((int)boneID, (float)KEY.Time, &position, &rotation, &scale);
+
+			Quaternion keyRotation = KEY.Rotation;
+			keyRotation.Normalize();
+
+			m_MaxRotationError = fmaxf(m_MaxRotationError, GetRotationError(rotation, keyRotation));
+			m_MaxTranslationError = fmaxf(m_MaxTranslationError, GetVectorError(position, KEY.Position));
+			m_MaxScaleError = fmaxf(m_MaxScaleError, GetVectorError(scale, KEY.Scale));
+		}
+	}
+
+	return (m_MaxRotationError <= SETTINGS.RotationErrorBound &&
+			m_MaxTranslationError <= SETTINGS.TranslationErrorBound &&
+			m_MaxScaleError <= SETTINGS.ScaleErrorBound);
+}
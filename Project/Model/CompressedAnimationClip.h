@@ -0,0 +1,116 @@
+#pragma once
+
+#include <vector>
+#include <emmintrin.h>
+#include <directxtk12/SimpleMath.h>
+
+// AnimationClip::Keys bone channel track   clip.
+// -   ʴ track  ϳ .
+// - rotation smallest-three 48bit(д 15bit).
+// - translation, scale track  д 16bit ȭ.  Ѱ踦 Ѵ track float ״ .
+// sample   ٽ ̰ sample  track ̾ ٿ(key-major)   pose  .
+
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Quaternion;
+
+struct AnimationClip;
+
+enum eCompressedTrackFormat
+{
+	CompressedTrackFormat_Constant = 0,
+	CompressedTrackFormat_Quantized,
+	CompressedTrackFormat_Raw,
+};
+
+enum eCompressedTrackChannel
+{
+	CompressedTrackChannel_Translation = 0,
+	CompressedTrackChannel_Scale,
+};
+
+struct AnimationCompressionSettings
+{
+	float RotationErrorBound = 1e-3f;	 // quaternion  .
+	float TranslationErrorBound = 1e-3f; // clip ǥ .
+	float ScaleErrorBound = 1e-4f;
+};
+
+struct CompressedBoneTrack
+{
+	BYTE RotationFormat;
+	BYTE TranslationFormat;
+	BYTE ScaleFormat;
+	// format   迭 /  track / raw track ȣ.
+	UINT RotationIndex;
+	UINT TranslationIndex;
+	UINT ScaleIndex;
+};
+
+//  vector track ϳ.  = RangeMin + q * RangeScale. SSE ٷ е 4ĭ.
+struct QuantizedVectorTrack
+{
+	float RangeMin[4];
+	float RangeScale[4];
+	UINT Target; // boneID * 2 + eCompressedTrackChannel.
+};
+
+class CompressedAnimationClip
+{
+public:
+	CompressedAnimationClip() = default;
+	~CompressedAnimationClip() { Cleanup(); }
+
+	// source key   Ѱ踦  false.   clip  .
+	bool Initialize(const AnimationClip& CLIP, const AnimationCompressionSettings& SETTINGS);
+
+	//  bone   .  迭 GetBoneCount() ũ.
+	void SamplePose(const float TIME_TICK, Vector3* pOutPositions, Quaternion* pOutRotations, Vector3* pOutScales) const;
+	void SampleBone(const int BONE_ID, const float TIME_TICK, Vector3* pOutPosition, Quaternion* pOutRotation, Vector3* pOutScale) const;
+
+	void Cleanup();
+
+	// cooked asset. Serialize pOut ڿ ̾ . Deserialize ũⰡ   false.
+	void Serialize(std::vector<BYTE>* pOut) const;
+	bool Deserialize(const BYTE* pSRC, const UINT64 SIZE);
+
+	UINT64 GetMemorySize() const;
+
+	inline bool IsValid() const { return (m_SampleCount > 0); }
+	inline UINT GetBoneCount() const { return (UINT)m_BoneTracks.size(); }
+	inline UINT GetSampleCount() const { return m_SampleCount; }
+	inline float GetMaxRotationError() const { return m_MaxRotationError; }
+	inline float GetMaxTranslationError() const { return m_MaxTranslationError; }
+	inline float GetMaxScaleError() const { return m_MaxScaleError; }
+
+protected:
+	void findSamples(const float TIME_TICK, UINT* pOutSample0, UINT* pOutSample1, float* pOutAlpha) const;
+
+	//  track ִ 4  sample  nlerp. pOutRotations[lane] (x, y, z, w).
+	void interpolateRotations4(const UINT16* pSRC0, const UINT16* pSRC1, const UINT LANE_COUNT, const __m128 ALPHA, __m128* pOutRotations) const;
+	__m128 sampleVectorTrack(const BYTE FORMAT, const UINT INDEX, const UINT SAMPLE0, const UINT SAMPLE1, const __m128 ALPHA) const;
+
+	bool validate(const AnimationClip& CLIP, const AnimationCompressionSettings& SETTINGS);
+
+private:
+	std::vector<CompressedBoneTrack> m_BoneTracks;
+
+	std::vector<Quaternion> m_ConstantRotations;
+	std::vector<Vector3> m_ConstantVectors;
+
+	std::vector<UINT> m_RotationTargets;		  //  rotation track -> boneID.
+	std::vector<QuantizedVectorTrack> m_VectorTracks;
+	std::vector<UINT> m_RawVectorTargets;		  // raw vector track -> boneID * 2 + channel.
+
+	// [sample][track][3]
+	std::vector<UINT16> m_RotationSamples;
+	std::vector<UINT16> m_VectorSamples;
+	std::vector<float> m_RawVectorSamples;
+
+	double m_StartTime = 0.0;
+	double m_SampleRate = 0.0; // tick sample .
+	UINT m_SampleCount = 0;
+
+	float m_MaxRotationError = 0.0f;
+	float m_MaxTranslationError = 0.0f;
+	float m_MaxScaleError = 0.0f;
+};
@@ -0,0 +1,778 @@
+#include "../pch.h"
+#include "CookedAsset.h"
+
+static const UINT64 HASH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const UINT64 HASH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const UINT64 HASH_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const UINT64 HASH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const UINT64 HASH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+static const UINT64 COOKED_DATA_ALIGNMENT = 16;
+static const UINT COOKED_TEXTURE_SLOT_COUNT = 8;
+static const DWORD COOKED_WRITE_CHUNK_SIZE = 64 * 1024 * 1024;
+
+struct CookedAssetHeader
+{
+	UINT Magic;
+	UINT Version;
+	UINT64 ContentHash;
+	UINT64 FileSize;
+	// ü ũⰡ ٲ hash Ƶ ź.
+	UINT VertexSize;
+	UINT SkinnedVertexSize;
+	UINT KeySize;
+	UINT MeshCount;
+	UINT64 MeshTableOffset;
+	UINT64 AnimationOffset; // 0̸ animation .
+};
+
+struct CookedMeshRecord
+{
+	UINT64 VertexOffset;
+	UINT64 SkinnedVertexOffset;
+	UINT64 IndexOffset;
+	UINT VertexCount;
+	UINT SkinnedVertexCount;
+	UINT IndexCount; // LOD0.  迭 ڿ LOD1 ~  ̾ پ .
+	UINT LODCount;
+	UINT LODIndexCounts[MAX_MESH_LOD_COUNT];
+	UINT Padding;
+	UINT64 TextureNameOffsets[COOKED_TEXTURE_SLOT_COUNT]; // MeshInfo texture ̸ .
+};
+
+struct CookedAnimationRecord
+{
+	Matrix DefaultTransform;
+	Matrix InverseDefaultTransform;
+	float NormalizingScale;
+	UINT BoneCount;
+	UINT ClipCount;
+	UINT LODBoneCount;
+	UINT64 BoneNameOffsetsOffset; // UINT64[BoneCount].  string offset.
+	UINT64 BoneParentsOffset;
+	UINT64 OffsetMatricesOffset;
+	UINT64 InverseOffsetMatricesOffset;
+	UINT64 NodeTransformsOffset;
+	UINT64 LODBoneIDsOffset;
+	UINT64 ClipTableOffset;
+};
+
+struct CookedClipRecord
+{
+	double Duration;
+	double TicksPerSec;
+	double RootMotionDuration;
+	double RootMotionTicksPerSec;
+	UINT64 NameOffset;
+	UINT64 KeyCountsOffset; // UINT[KeyTrackCount].
+	UINT64 KeysOffset;		// bone  ̾  key.
+	UINT64 IKRotationsOffset;
+	UINT64 RootDeltaPositionsOffset;
+	UINT64 RootDeltaYawsOffset;
+	UINT64 CompressedOffset; // CompressedAnimationClip::Serialize . 0̸    clip.
+	UINT64 CompressedSize;
+	int NumChannels;
+	UINT KeyTrackCount;
+	UINT TotalKeyCount;
+	UINT IKRotationCount;
+	UINT RootMotionCount;
+	UINT Padding;
+};
+
+static inline UINT64 RotateLeft64(const UINT64 VALUE, const int SHIFT)
+{
+	return ((VALUE << SHIFT) | (VALUE >> (64 - SHIFT)));
+}
+
+// 8byte   byte ϳ.  avalanche.
+static UINT64 HashBytes(const BYTE* pSRC, const UINT64 SIZE, UINT64 hash)
+{
+	UINT64 i = 0;
+	for (; i + 8 <= SIZE; i += 8)
+	{
+		UINT64 word;
+		memcpy(&word, pSRC + i, sizeof(UINT64));
+		hash ^= RotateLeft64(word * HASH_PRIME64_2, 31) * HASH_PRIME64_1;
+		hash = RotateLeft64(hash, 27) * HASH_PRIME64_1 + HASH_PRIME64_4;
+	}
+	for (; i < SIZE; ++i)
+	{
+		hash ^= pSRC[i] * HASH_PRIME64_5;
+		hash = RotateLeft64(hash, 11) * HASH_PRIME64_1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= HASH_PRIME64_2;
+	hash ^= hash >> 29;
+	hash *= HASH_PRIME64_3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+// б  map.   map  Ƿ .
+static bool MapReadOnlyFile(const std::wstring& PATH, HANDLE* phOutFile, HANDLE* phOutMapping, const BYTE** ppOutData, UINT64* pOutSize)
+{
+	*phOutFile = INVALID_HANDLE_VALUE;
+	*phOutMapping = nullptr;
+	*ppOutData = nullptr;
+	*pOutSize = 0;
+
+	HANDLE hFile = CreateFileW(PATH.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(hFile);
+		return false;
+	}
+
+	HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!hMapping)
+	{
+		CloseHandle(hFile);
+		return false;
+	}
+
+	const BYTE* pData = (const BYTE*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (!pData)
+	{
+		CloseHandle(hMapping);
+		CloseHandle(hFile);
+		return false;
+	}
+
+	*phOutFile = hFile;
+	*phOutMapping = hMapping;
+	*ppOutData = pData;
+	*pOutSize = (UINT64)fileSize.QuadPart;
+	return true;
+}
+
+static void UnmapReadOnlyFile(HANDLE* phFile, HANDLE* phMapping, const BYTE** ppData)
+{
+	if (*ppData)
+	{
+		UnmapViewOfFile(*ppData);
+		*ppData = nullptr;
+	}
+	if (*phMapping)
+	{
+		CloseHandle(*phMapping);
+		*phMapping = nullptr;
+	}
+	if (*phFile != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(*phFile);
+		*phFile = INVALID_HANDLE_VALUE;
+	}
+}
+
+static inline UINT64 AlignOffset(const UINT64 OFFSET)
+{
+	return ((OFFSET + COOKED_DATA_ALIGNMENT - 1) & ~(COOKED_DATA_ALIGNMENT - 1));
+}
+
+// 16byte   ̾ ̰ offset ȯ.  迭 0.
+static UINT64 AppendData(std::vector<BYTE>* pOut, const void* pSRC, const UINT64 SIZE)
+{
+	if (SIZE == 0)
+	{
+		return 0;
+	}
+
+	const UINT64 OFFSET = AlignOffset(pOut->size());
+	pOut->resize(OFFSET + SIZE);
+	memcpy(pOut->data() + OFFSET, pSRC, SIZE);
+	return OFFSET;
+}
+
+template <typename T>
+static UINT64 AppendArray(std::vector<BYTE>* pOut, const std::vector<T>& SRC)
+{
+	return AppendData(pOut, SRC.data(), SRC.size() * sizeof(T));
+}
+
+// [UINT ][...].  ڿ  0 .
+template <typename T>
+static UINT64 AppendString(std::vector<BYTE>* pOut, const std::basic_string<T>& SRC)
+{
+	const UINT LENGTH = (UINT)SRC.size();
+	const UINT64 OFFSET = AppendData(pOut, &LENGTH, sizeof(UINT));
+	const UINT64 SIZE = SRC.size() * sizeof(T);
+	const UINT64 DATA_OFFSET = pOut->size();
+	pOut->resize(DATA_OFFSET + SIZE);
+	if (SIZE > 0)
+	{
+		memcpy(pOut->data() + DATA_OFFSET, SRC.data(), SIZE);
+	}
+	return OFFSET;
+}
+
+template <typename T>
+static inline const T* GetData(const BYTE* pBASE, const UINT64 OFFSET)
+{
+	return (const T*)(pBASE + OFFSET);
+}
+
+UINT64 HashCookedAssetSources(const std::wstring& BASE_PATH, const std::vector<std::wstring>& FILE_NAMES, const UINT64 OPTIONS)
+{
+	UINT64 hash = HashBytes((const BYTE*)&OPTIONS, sizeof(UINT64), COOKED_ASSET_VERSION);
+
+	for (UINT64 i = 0, size = FILE_NAMES.size(); i < size; ++i)
+	{
+		const std::wstring& NAME = FILE_NAMES[i];
+
+		HANDLE hFile;
+		HANDLE hMapping;
+		const BYTE* pData;
+		UINT64 fileSize;
+		if (!MapReadOnlyFile(BASE_PATH + NAME, &hFile, &hMapping, &pData, &fileSize))
+		{
+			return 0;
+		}
+
+		// ̸  clip ID ǹǷ ̸ .
+		hash = HashBytes((const BYTE*)NAME.c_str(), NAME.size() * sizeof(WCHAR), hash);
+		hash = HashBytes((const BYTE*)&fileSize, sizeof(UINT64), hash);
+		hash = HashBytes(pData, fileSize, hash);
+
+		UnmapReadOnlyFile(&hFile, &hMapping, &pData);
+	}
+
+	// 0   .
+	return (hash == 0 ? 1 : hash);
+}
+
+HRESULT WriteCookedAsset(const std::wstring& PATH, const UINT64 CONTENT_HASH, const std::vector<MeshInfo>& MESH_INFOS, const AnimationData* pANIM_DATA)
+{
+	HRESULT hr = S_OK;
+
+	const UINT MESH_COUNT = (UINT)MESH_INFOS.size();
+	const bool bHAS_ANIMATION = (pANIM_DATA && !pANIM_DATA->BoneIDToNames.empty());
+	const UINT CLIP_COUNT = (bHAS_ANIMATION ? (UINT)pANIM_DATA->Clips.size() : 0);
+
+	//  ũ record   ΰ data ڿ .
+	const UINT64 MESH_TABLE_OFFSET = AlignOffset(sizeof(CookedAssetHeader));
+	const UINT64 ANIMATION_OFFSET = AlignOffset(MESH_TABLE_OFFSET + sizeof(CookedMeshRecord) * MESH_COUNT);
+	const UINT64 CLIP_TABLE_OFFSET = AlignOffset(ANIMATION_OFFSET + sizeof(CookedAnimationRecord));
+	const UINT64 RECORD_END = CLIP_TABLE_OFFSET + sizeof(CookedClipRecord) * CLIP_COUNT;
+
+	std::vector<BYTE> fileData(RECORD_END, 0);
+	std::vector<CookedMeshRecord> meshRecords(MESH_COUNT);
+	std::vector<CookedClipRecord> clipRecords(CLIP_COUNT);
+	CookedAnimationRecord animationRecord = {};
+
+	for (UINT i = 0; i < MESH_COUNT; ++i)
+	{
+		const MeshInfo& MESH = MESH_INFOS[i];
+		CookedMeshRecord& record = meshRecords[i];
+		ZeroMemory(&record, sizeof(CookedMeshRecord));
+
+		std::vector<UINT> indices(MESH.Indices);
+		record.LODCount = 1;
+		record.LODIndexCounts[0] = (UINT)MESH.Indices.size();
+		for (UINT64 lod = 0, lodSize = MESH.LODIndices.size(); lod < lodSize && record.LODCount < MAX_MESH_LOD_COUNT; ++lod)
+		{
+			record.LODIndexCounts[record.LODCount] = (UINT)MESH.LODIndices[lod].size();
+			++record.LODCount;
+			indices.insert(indices.end(), MESH.LODIndices[lod].begin(), MESH.LODIndices[lod].end());
+		}
+
+		record.VertexOffset = AppendArray(&fileData, MESH.Vertices);
+		record.SkinnedVertexOffset = AppendArray(&fileData, MESH.SkinnedVertices);
+		record.IndexOffset = AppendArray(&fileData, indices);
+		record.VertexCount = (UINT)MESH.Vertices.size();
+		record.SkinnedVertexCount = (UINT)MESH.SkinnedVertices.size();
+		record.IndexCount = (UINT)MESH.Indices.size();
+
+		const std::wstring* ppTEXTURE_NAMES[COOKED_TEXTURE_SLOT_COUNT] =
+		{
+			&MESH.szAlbedoTextureFileName, &MESH.szEmissiveTextureFileName, &MESH.szNormalTextureFileName, &MESH.szHeightTextureFileName,
+			&MESH.szAOTextureFileName, &MESH.szMetallicTextureFileName, &MESH.szRoughnessTextureFileName, &MESH.szOpacityTextureFileName,
+		};
+		for (UINT slot = 0; slot < COOKED_TEXTURE_SLOT_COUNT; ++slot)
+		{
+			record.TextureNameOffsets[slot] = AppendString(&fileData, *ppTEXTURE_NAMES[slot]);
+		}
+	}
+
+	if (bHAS_ANIMATION)
+	{
+		const UINT BONE_COUNT = (UINT)pANIM_DATA->BoneIDToNames.size();
+		_ASSERT(pANIM_DATA->BoneParents.size() == BONE_COUNT);
+		_ASSERT(pANIM_DATA->OffsetMatrices.size() == BONE_COUNT);
+		_ASSERT(pANIM_DATA->InverseOffsetMatrices.size() == BONE_COUNT);
+		_ASSERT(pANIM_DATA->NodeTransforms.size() == BONE_COUNT);
+
+		std::vector<UINT64> boneNameOffsets(BONE_COUNT);
+		for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+		{
+			boneNameOffsets[boneID] = AppendString(&fileData, pANIM_DATA->BoneIDToNames[boneID]);
+		}
+
+		animationRecord.DefaultTransform = pANIM_DATA->DefaultTransform;
+		animationRecord.InverseDefaultTransform = pANIM_DATA->InverseDefaultTransform;
+		animationRecord.NormalizingScale = pANIM_DATA->NormalizingScale;
+		animationRecord.BoneCount = BONE_COUNT;
+		animationRecord.ClipCount = CLIP_COUNT;
+		animationRecord.LODBoneCount = (UINT)pANIM_DATA->LODBoneIDs.size();
+		animationRecord.BoneNameOffsetsOffset = AppendArray(&fileData, boneNameOffsets);
+		animationRecord.BoneParentsOffset = AppendArray(&fileData, pANIM_DATA->BoneParents);
+		animationRecord.OffsetMatricesOffset = AppendArray(&fileData, pANIM_DATA->OffsetMatrices);
+		animationRecord.InverseOffsetMatricesOffset = AppendArray(&fileData, pANIM_DATA->InverseOffsetMatrices);
+		animationRecord.NodeTransformsOffset = AppendArray(&fileData, pANIM_DATA->NodeTransforms);
+		animationRecord.LODBoneIDsOffset = AppendArray(&fileData, pANIM_DATA->LODBoneIDs);
+		animationRecord.ClipTableOffset = (CLIP_COUNT > 0 ? CLIP_TABLE_OFFSET : 0);
+
+		std::vector<UINT> keyCounts;
+		std::vector<AnimationClip::Key> keys;
+		std::vector<BYTE> compressedData;
+		for (UINT clipID = 0; clipID < CLIP_COUNT; ++clipID)
+		{
+			const AnimationClip& CLIP = pANIM_DATA->Clips[clipID];
+			CookedClipRecord& record = clipRecords[clipID];
+			ZeroMemory(&record, sizeof(CookedClipRecord));
+			_ASSERT(CLIP.bPrepared);
+
+			//  clip root key  .
+			keyCounts.resize(CLIP.Keys.size());
+			keys.clear();
+			for (UINT64 boneID = 0, totalBone = CLIP.Keys.size(); boneID < totalBone; ++boneID)
+			{
+				keyCounts[boneID] = (UINT)CLIP.Keys[boneID].size();
+				keys.insert(keys.end(), CLIP.Keys[boneID].begin(), CLIP.Keys[boneID].end());
+			}
+
+			record.Duration = CLIP.Duration;
+			record.TicksPerSec = CLIP.TicksPerSec;
+			record.RootMotionDuration = CLIP.RootMotion.Duration;
+			record.RootMotionTicksPerSec = CLIP.RootMotion.TicksPerSec;
+			record.NameOffset = AppendString(&fileData, CLIP.Name);
+			record.KeyCountsOffset = AppendArray(&fileData, keyCounts);
+			record.KeysOffset = AppendArray(&fileData, keys);
+			record.IKRotationsOffset = AppendArray(&fileData, CLIP.IKRotations);
+			record.RootDeltaPositionsOffset = AppendArray(&fileData, CLIP.RootMotion.DeltaPositions);
+			record.RootDeltaYawsOffset = AppendArray(&fileData, CLIP.RootMotion.DeltaYaws);
+			record.NumChannels = CLIP.NumChannels;
+			record.KeyTrackCount = (UINT)keyCounts.size();
+			record.TotalKeyCount = (UINT)keys.size();
+			record.IKRotationCount = (UINT)CLIP.IKRotations.size();
+			record.RootMotionCount = (UINT)CLIP.RootMotion.DeltaPositions.size();
+			_ASSERT(CLIP.RootMotion.DeltaYaws.size() == CLIP.RootMotion.DeltaPositions.size());
+
+			if (CLIP.Compressed.IsValid())
+			{
+				compressedData.clear();
+				CLIP.Compressed.Serialize(&compressedData);
+				record.CompressedOffset = AppendArray(&fileData, compressedData);
+				record.CompressedSize = compressedData.size();
+			}
+		}
+	}
+
+	CookedAssetHeader header = {};
+	header.Magic = COOKED_ASSET_MAGIC;
+	header.Version = COOKED_ASSET_VERSION;
+	header.ContentHash = CONTENT_HASH;
+	header.FileSize = fileData.size();
+	header.VertexSize = sizeof(Vertex);
+	header.SkinnedVertexSize = sizeof(SkinnedVertex);
+	header.KeySize = sizeof(AnimationClip::Key);
+	header.MeshCount = MESH_COUNT;
+	header.MeshTableOffset = MESH_TABLE_OFFSET;
+	header.AnimationOffset = (bHAS_ANIMATION ? ANIMATION_OFFSET : 0);
+
+	memcpy(fileData.data(), &header, sizeof(CookedAssetHeader));
+	if (MESH_COUNT > 0)
+	{
+		memcpy(fileData.data() + MESH_TABLE_OFFSET, meshRecords.data(), sizeof(CookedMeshRecord) * MESH_COUNT);
+	}
+	memcpy(fileData.data() + ANIMATION_OFFSET, &animationRecord, sizeof(CookedAnimationRecord));
+	if (CLIP_COUNT > 0)
+	{
+		memcpy(fileData.data() + CLIP_TABLE_OFFSET, clipRecords.data(), sizeof(CookedClipRecord) * CLIP_COUNT);
+	}
+
+	// ӽ Ͽ    ü.
+	const std::wstring TEMP_PATH = PATH + L".tmp";
+	HANDLE hFile = CreateFileW(TEMP_PATH.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		hr = HRESULT_FROM_WIN32(GetLastError());
+		goto LB_RET;
+	}
+
+	for (UINT64 written = 0, total = fileData.size(); written < total;)
+	{
+		const UINT64 REMAIN = total - written;
+		const DWORD CHUNK_SIZE = (REMAIN > COOKED_WRITE_CHUNK_SIZE ? COOKED_WRITE_CHUNK_SIZE : (DWORD)REMAIN);
+		DWORD chunkWritten = 0;
+		if (!WriteFile(hFile, fileData.data() + written, CHUNK_SIZE, &chunkWritten, nullptr) || chunkWritten != CHUNK_SIZE)
+		{
+			hr = HRESULT_FROM_WIN32(GetLastError());
+			CloseHandle(hFile);
+			DeleteFileW(TEMP_PATH.c_str());
+			goto LB_RET;
+		}
+		written += chunkWritten;
+	}
+	CloseHandle(hFile);
+
+	if (!MoveFileExW(TEMP_PATH.c_str(), PATH.c_str(), MOVEFILE_REPLACE_EXISTING))
+	{
+		hr = HRESULT_FROM_WIN32(GetLastError());
+		DeleteFileW(TEMP_PATH.c_str());
+	}
+
+LB_RET:
+	return hr;
+}
+
+bool CookedAsset::Open(const std::wstring& PATH, const UINT64 CONTENT_HASH)
+{
+	Cleanup();
+
+	if (!MapReadOnlyFile(PATH, &m_hFile, &m_hMapping, &m_pData, &m_FileSize))
+	{
+		return false;
+	}
+
+	if (m_FileSize < sizeof(CookedAssetHeader))
+	{
+		Cleanup();
+		return false;
+	}
+
+	const CookedAssetHeader* pHEADER = GetData<CookedAssetHeader>(m_pData, 0);
+	if (pHEADER->Magic != COOKED_ASSET_MAGIC || pHEADER->Version != COOKED_ASSET_VERSION || pHEADER->ContentHash != CONTENT_HASH ||
+		pHEADER->FileSize != m_FileSize || !validate())
+	{
+		Cleanup();
+		return false;
+	}
+
+	return true;
+}
+
+void CookedAsset::Cleanup()
+{
+	UnmapReadOnlyFile(&m_hFile, &m_hMapping, &m_pData);
+	m_FileSize = 0;
+}
+
+CookedMeshView CookedAsset::GetMeshView(const UINT MESH_INDEX) const
+{
+	_ASSERT(m_pData);
+	_ASSERT(MESH_INDEX < GetMeshCount());
+
+	const CookedAssetHeader* pHEADER = GetData<CookedAssetHeader>(m_pData, 0);
+	const CookedMeshRecord& RECORD = GetData<CookedMeshRecord>(m_pData, pHEADER->MeshTableOffset)[MESH_INDEX];
+
+	CookedMeshView view;
+	view.pVertices = (RECORD.VertexCount > 0 ? GetData<Vertex>(m_pData, RECORD.VertexOffset) : nullptr);
+	view.pSkinnedVertices = (RECORD.SkinnedVertexCount > 0 ? GetData<SkinnedVertex>(m_pData, RECORD.SkinnedVertexOffset) : nullptr);
+	view.pIndices = (RECORD.IndexCount > 0 ? GetData<UINT>(m_pData, RECORD.IndexOffset) : nullptr);
+	view.VertexCount = RECORD.VertexCount;
+	view.SkinnedVertexCount = RECORD.SkinnedVertexCount;
+	view.IndexCount = RECORD.IndexCount;
+	view.LODCount = RECORD.LODCount;
+	for (UINT i = 0; i < MAX_MESH_LOD_COUNT; ++i)
+	{
+		view.pLODIndexCounts[i] = (i < RECORD.LODCount ? RECORD.LODIndexCounts[i] : 0);
+	}
+	return view;
+}
+
+void CookedAsset::ReadMeshInfos(std::vector<MeshInfo>* pOutMeshInfos) const
+{
+	_ASSERT(m_pData);
+	_ASSERT(pOutMeshInfos);
+
+	const CookedAssetHeader* pHEADER = GetData<CookedAssetHeader>(m_pData, 0);
+	const CookedMeshRecord* pRECORDS = GetData<CookedMeshRecord>(m_pData, pHEADER->MeshTableOffset);
+
+	pOutMeshInfos->resize(pHEADER->MeshCount);
+	for (UINT i = 0; i < pHEADER->MeshCount; ++i)
+	{
+		const CookedMeshView VIEW = GetMeshView(i);
+		const CookedMeshRecord& RECORD = pRECORDS[i];
+		MeshInfo& meshInfo = (*pOutMeshInfos)[i];
+
+		meshInfo.Vertices.assign(VIEW.pVertices, VIEW.pVertices + VIEW.VertexCount);
+		meshInfo.SkinnedVertices.assign(VIEW.pSkinnedVertices, VIEW.pSkinnedVertices + VIEW.SkinnedVertexCount);
+		meshInfo.Indices.assign(VIEW.pIndices, VIEW.pIndices + VIEW.IndexCount);
+
+		const UINT* pLODIndices = VIEW.pIndices + VIEW.IndexCount;
+		meshInfo.LODIndices.resize(VIEW.LODCount - 1);
+		for (UINT lod = 1; lod < VIEW.LODCount; ++lod)
+		{
+			meshInfo.LODIndices[lod - 1].assign(pLODIndices, pLODIndices + VIEW.pLODIndexCounts[lod]);
+			pLODIndices += VIEW.pLODIndexCounts[lod];
+		}
+
+		std::wstring* ppTextureNames[COOKED_TEXTURE_SLOT_COUNT] =
+		{
+			&meshInfo.szAlbedoTextureFileName, &meshInfo.szEmissiveTextureFileName, &meshInfo.szNormalTextureFileName, &meshInfo.szHeightTextureFileName,
+			&meshInfo.szAOTextureFileName, &meshInfo.szMetallicTextureFileName, &meshInfo.szRoughnessTextureFileName, &meshInfo.szOpacityTextureFileName,
+		};
+		for (UINT slot = 0; slot < COOKED_TEXTURE_SLOT_COUNT; ++slot)
+		{
+			*ppTextureNames[slot] = readWString(RECORD.TextureNameOffsets[slot]);
+		}
+	}
+}
+
+bool CookedAsset::ReadAnimationData(AnimationData* pOutAnimData) const
+{
+	_ASSERT(m_pData);
+	_ASSERT(pOutAnimData);
+
+	if (!HasAnimationData())
+	{
+		return false;
+	}
+
+	const CookedAssetHeader* pHEADER = GetData<CookedAssetHeader>(m_pData, 0);
+	const CookedAnimationRecord& RECORD = *GetData<CookedAnimationRecord>(m_pData, pHEADER->AnimationOffset);
+	const UINT BONE_COUNT = RECORD.BoneCount;
+
+	const UINT64* pBONE_NAME_OFFSETS = GetData<UINT64>(m_pData, RECORD.BoneNameOffsetsOffset);
+	const int* pBONE_PARENTS = GetData<int>(m_pData, RECORD.BoneParentsOffset);
+	const Matrix* pOFFSET_MATRICES = GetData<Matrix>(m_pData, RECORD.OffsetMatricesOffset);
+	const Matrix* pINVERSE_OFFSET_MATRICES = GetData<Matrix>(m_pData, RECORD.InverseOffsetMatricesOffset);
+	const Matrix* pNODE_TRANSFORMS = GetData<Matrix>(m_pData, RECORD.NodeTransformsOffset);
+	const UINT* pLOD_BONE_IDS = GetData<UINT>(m_pData, RECORD.LODBoneIDsOffset);
+
+	pOutAnimData->BoneNameToID.clear();
+	pOutAnimData->BoneIDToNames.resize(BONE_COUNT);
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		pOutAnimData->BoneIDToNames[boneID] = readString(pBONE_NAME_OFFSETS[boneID]);
+		pOutAnimData->BoneNameToID[pOutAnimData->BoneIDToNames[boneID]] = (int)boneID;
+	}
+	pOutAnimData->BoneParents.assign(pBONE_PARENTS, pBONE_PARENTS + BONE_COUNT);
+	pOutAnimData->OffsetMatrices.assign(pOFFSET_MATRICES, pOFFSET_MATRICES + BONE_COUNT);
+	pOutAnimData->InverseOffsetMatrices.assign(pINVERSE_OFFSET_MATRICES, pINVERSE_OFFSET_MATRICES + BONE_COUNT);
+	pOutAnimData->NodeTransforms.assign(pNODE_TRANSFORMS, pNODE_TRANSFORMS + BONE_COUNT);
+	pOutAnimData->BoneTransforms.assign(BONE_COUNT, Matrix());
+	pOutAnimData->LODBoneIDs.assign(pLOD_BONE_IDS, pLOD_BONE_IDS + RECORD.LODBoneCount);
+	pOutAnimData->DefaultTransform = RECORD.DefaultTransform;
+	pOutAnimData->InverseDefaultTransform = RECORD.InverseDefaultTransform;
+	pOutAnimData->NormalizingScale = RECORD.NormalizingScale;
+
+	const CookedClipRecord* pCLIP_RECORDS = GetData<CookedClipRecord>(m_pData, RECORD.ClipTableOffset);
+	pOutAnimData->Clips.clear();
+	pOutAnimData->Clips.resize(RECORD.ClipCount);
+	for (UINT clipID = 0; clipID < RECORD.ClipCount; ++clipID)
+	{
+		const CookedClipRecord& CLIP_RECORD = pCLIP_RECORDS[clipID];
+		AnimationClip& clip = pOutAnimData->Clips[clipID];
+
+		const UINT* pKEY_COUNTS = GetData<UINT>(m_pData, CLIP_RECORD.KeyCountsOffset);
+		const AnimationClip::Key* pKeys = GetData<AnimationClip::Key>(m_pData, CLIP_RECORD.KeysOffset);
+		clip.Keys.resize(CLIP_RECORD.KeyTrackCount);
+		for (UINT boneID = 0; boneID < CLIP_RECORD.KeyTrackCount; ++boneID)
+		{
+			clip.Keys[boneID].assign(pKeys, pKeys + pKEY_COUNTS[boneID]);
+			pKeys += pKEY_COUNTS[boneID];
+		}
+
+		const Quaternion* pIK_ROTATIONS = GetData<Quaternion>(m_pData, CLIP_RECORD.IKRotationsOffset);
+		const Vector3* pROOT_DELTA_POSITIONS = GetData<Vector3>(m_pData, CLIP_RECORD.RootDeltaPositionsOffset);
+		const float* pROOT_DELTA_YAWS = GetData<float>(m_pData, CLIP_RECORD.RootDeltaYawsOffset);
+		clip.IKRotations.assign(pIK_ROTATIONS, pIK_ROTATIONS + CLIP_RECORD.IKRotationCount);
+		clip.RootMotion.DeltaPositions.assign(pROOT_DELTA_POSITIONS, pROOT_DELTA_POSITIONS + CLIP_RECORD.RootMotionCount);
+		clip.RootMotion.DeltaYaws.assign(pROOT_DELTA_YAWS, pROOT_DELTA_YAWS + CLIP_RECORD.RootMotionCount);
+		clip.RootMotion.Duration = CLIP_RECORD.RootMotionDuration;
+		clip.RootMotion.TicksPerSec = CLIP_RECORD.RootMotionTicksPerSec;
+
+		clip.Name = readString(CLIP_RECORD.NameOffset);
+		clip.NumChannels = CLIP_RECORD.NumChannels;
+		clip.Duration = CLIP_RECORD.Duration;
+		clip.TicksPerSec = CLIP_RECORD.TicksPerSec;
+		clip.bPrepared = true;
+
+		if (CLIP_RECORD.CompressedSize > 0 &&
+			!clip.Compressed.Deserialize(GetData<BYTE>(m_pData, CLIP_RECORD.CompressedOffset), CLIP_RECORD.CompressedSize))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool CookedAsset::HasAnimationData() const
+{
+	_ASSERT(m_pData);
+	return (GetData<CookedAssetHeader>(m_pData, 0)->AnimationOffset != 0);
+}
+
+UINT CookedAsset::GetMeshCount() const
+{
+	_ASSERT(m_pData);
+	return GetData<CookedAssetHeader>(m_pData, 0)->MeshCount;
+}
+
+bool CookedAsset::validate() const
+{
+	const CookedAssetHeader* pHEADER = GetData<CookedAssetHeader>(m_pData, 0);
+	if (pHEADER->VertexSize != sizeof(Vertex) || pHEADER->SkinnedVertexSize != sizeof(SkinnedVertex) || pHEADER->KeySize != sizeof(AnimationClip::Key))
+	{
+		return false;
+	}
+
+	if (!isRangeValid(pHEADER->MeshTableOffset, pHEADER->MeshCount, sizeof(CookedMeshRecord)))
+	{
+		return false;
+	}
+
+	const CookedMeshRecord* pMESH_RECORDS = GetData<CookedMeshRecord>(m_pData, pHEADER->MeshTableOffset);
+	for (UINT i = 0; i < pHEADER->MeshCount; ++i)
+	{
+		const CookedMeshRecord& RECORD = pMESH_RECORDS[i];
+		if (RECORD.LODCount == 0 || RECORD.LODCount > MAX_MESH_LOD_COUNT || RECORD.LODIndexCounts[0] != RECORD.IndexCount)
+		{
+			return false;
+		}
+
+		UINT64 totalIndexCount = 0;
+		for (UINT lod = 0; lod < RECORD.LODCount; ++lod)
+		{
+			totalIndexCount += RECORD.LODIndexCounts[lod];
+		}
+		if (!isRangeValid(RECORD.VertexOffset, RECORD.VertexCount, sizeof(Vertex)) ||
+			!isRangeValid(RECORD.SkinnedVertexOffset, RECORD.SkinnedVertexCount, sizeof(SkinnedVertex)) ||
+			!isRangeValid(RECORD.IndexOffset, totalIndexCount, sizeof(UINT)))
+		{
+			return false;
+		}
+		for (UINT slot = 0; slot < COOKED_TEXTURE_SLOT_COUNT; ++slot)
+		{
+			if (!isStringValid(RECORD.TextureNameOffsets[slot], sizeof(WCHAR)))
+			{
+				return false;
+			}
+		}
+	}
+
+	if (pHEADER->AnimationOffset == 0)
+	{
+		return true;
+	}
+	if (!isRangeValid(pHEADER->AnimationOffset, 1, sizeof(CookedAnimationRecord)))
+	{
+		return false;
+	}
+
+	const CookedAnimationRecord& ANIMATION_RECORD = *GetData<CookedAnimationRecord>(m_pData, pHEADER->AnimationOffset);
+	const UINT BONE_COUNT = ANIMATION_RECORD.BoneCount;
+	if (BONE_COUNT == 0 ||
+		!isRangeValid(ANIMATION_RECORD.BoneNameOffsetsOffset, BONE_COUNT, sizeof(UINT64)) ||
+		!isRangeValid(ANIMATION_RECORD.BoneParentsOffset, BONE_COUNT, sizeof(int)) ||
+		!isRangeValid(ANIMATION_RECORD.OffsetMatricesOffset, BONE_COUNT, sizeof(Matrix)) ||
+		!isRangeValid(ANIMATION_RECORD.InverseOffsetMatricesOffset, BONE_COUNT, sizeof(Matrix)) ||
+		!isRangeValid(ANIMATION_RECORD.NodeTransformsOffset, BONE_COUNT, sizeof(Matrix)) ||
+		!isRangeValid(ANIMATION_RECORD.LODBoneIDsOffset, ANIMATION_RECORD.LODBoneCount, sizeof(UINT)) ||
+		!isRangeValid(ANIMATION_RECORD.ClipTableOffset, ANIMATION_RECORD.ClipCount, sizeof(CookedClipRecord)))
+	{
+		return false;
+	}
+
+	const UINT64* pBONE_NAME_OFFSETS = GetData<UINT64>(m_pData, ANIMATION_RECORD.BoneNameOffsetsOffset);
+	const int* pBONE_PARENTS = GetData<int>(m_pData, ANIMATION_RECORD.BoneParentsOffset);
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		// θ ׻  ID.
+		if (pBONE_PARENTS[boneID] < -1 || pBONE_PARENTS[boneID] >= (int)boneID ||
+			!isStringValid(pBONE_NAME_OFFSETS[boneID], sizeof(char)))
+		{
+			return false;
+		}
+	}
+
+	const UINT* pLOD_BONE_IDS = GetData<UINT>(m_pData, ANIMATION_RECORD.LODBoneIDsOffset);
+	for (UINT i = 0; i < ANIMATION_RECORD.LODBoneCount; ++i)
+	{
+		if (pLOD_BONE_IDS[i] >= BONE_COUNT)
+		{
+			return false;
+		}
+	}
+
+	const CookedClipRecord* pCLIP_RECORDS = GetData<CookedClipRecord>(m_pData, ANIMATION_RECORD.ClipTableOffset);
+	for (UINT clipID = 0; clipID < ANIMATION_RECORD.ClipCount; ++clipID)
+	{
+		const CookedClipRecord& RECORD = pCLIP_RECORDS[clipID];
+		if (!isStringValid(RECORD.NameOffset, sizeof(char)) ||
+			RECORD.KeyTrackCount != BONE_COUNT ||
+			(RECORD.IKRotationCount != 0 && RECORD.IKRotationCount != BONE_COUNT) ||
+			!isRangeValid(RECORD.KeyCountsOffset, RECORD.KeyTrackCount, sizeof(UINT)) ||
+			!isRangeValid(RECORD.KeysOffset, RECORD.TotalKeyCount, sizeof(AnimationClip::Key)) ||
+			!isRangeValid(RECORD.IKRotationsOffset, RECORD.IKRotationCount, sizeof(Quaternion)) ||
+			!isRangeValid(RECORD.RootDeltaPositionsOffset, RECORD.RootMotionCount, sizeof(Vector3)) ||
+			!isRangeValid(RECORD.RootDeltaYawsOffset, RECORD.RootMotionCount, sizeof(float)) ||
+			!isRangeValid(RECORD.CompressedOffset, RECORD.CompressedSize, sizeof(BYTE)))
+		{
+			return false;
+		}
+
+		// key      ƾ . root key frame  꿡 Ƿ    .
+		const UINT* pKEY_COUNTS = GetData<UINT>(m_pData, RECORD.KeyCountsOffset);
+		UINT64 totalKeyCount = 0;
+		for (UINT boneID = 0; boneID < RECORD.KeyTrackCount; ++boneID)
+		{
+			totalKeyCount += pKEY_COUNTS[boneID];
+		}
+		if (totalKeyCount != RECORD.TotalKeyCount || pKEY_COUNTS[0] == 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool CookedAsset::isRangeValid(const UINT64 OFFSET, const UINT64 COUNT, const UINT64 ELEMENT_SIZE) const
+{
+	if (COUNT == 0)
+	{
+		return true;
+	}
+	if (OFFSET == 0 || (OFFSET & (COOKED_DATA_ALIGNMENT - 1)) != 0 || OFFSET > m_FileSize || COUNT > (m_FileSize - OFFSET) / ELEMENT_SIZE)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool CookedAsset::isStringValid(const UINT64 OFFSET, const UINT64 CHAR_SIZE) const
+{
+	//  UINT ڿ ٷ ڰ Ƿ  κ  Ȯ  .
+	if (!isRangeValid(OFFSET, 1, sizeof(UINT)))
+	{
+		return false;
+	}
+
+	const UINT64 DATA_OFFSET = OFFSET + sizeof(UINT);
+	const UINT LENGTH = *GetData<UINT>(m_pData, OFFSET);
+	return (LENGTH <= (m_FileSize - DATA_OFFSET) / CHAR_SIZE);
+}
+
+std::wstring CookedAsset::readWString(const UINT64 OFFSET) const
+{
+	const UINT LENGTH = *GetData<UINT>(m_pData, OFFSET);
+	const WCHAR* pCHARS = GetData<WCHAR>(m_pData, OFFSET + sizeof(UINT));
+	return std::wstring(pCHARS, pCHARS + LENGTH);
+}
+
+std::string CookedAsset::readString(const UINT64 OFFSET) const
+{
+	const UINT LENGTH = *GetData<UINT>(m_pData, OFFSET);
+	const char* pCHARS = GetData<char>(m_pData, OFFSET + sizeof(UINT));
+	return std::string(pCHARS, pCHARS + LENGTH);
+}
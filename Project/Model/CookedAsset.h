@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include "MeshInfo.h"
+#include "AnimationData.h"
+
+// import(Assimp, normalize, tangent, retarget, )  mesh, skeleton, clip ״  binary.
+//    mapؼ vertex, index   ٷ Ŵ.
+//    hash  ٸ  Ƿ ٽ cookؾ .
+//
+// [CookedAssetHeader][CookedMeshRecord x MeshCount][CookedAnimationRecord][CookedClipRecord x ClipCount][data ...]
+// data 迭  16byte . offset  ó .
+
+static const UINT COOKED_ASSET_MAGIC = 0x53414B43; // "CKAS"
+static const UINT COOKED_ASSET_VERSION = 3;		   //  ̳ import ó ٲ ø.
+
+//     , ̸ , , OPTIONS  cache key.    0.
+UINT64 HashCookedAssetSources(const std::wstring& BASE_PATH, const std::vector<std::wstring>& FILE_NAMES, const UINT64 OPTIONS);
+
+// pANIM_DATA nullptr . clip PrepareClips  ¿ .
+// ӽ Ͽ   üϹǷ  ص   ״.
+HRESULT WriteCookedAsset(const std::wstring& PATH, const UINT64 CONTENT_HASH, const std::vector<MeshInfo>& MESH_INFOS, const AnimationData* pANIM_DATA);
+
+// map   Ŵ. CookedAsset  ִ ȸ ȿ.
+struct CookedMeshView
+{
+	const Vertex* pVertices;
+	const SkinnedVertex* pSkinnedVertices;
+	const UINT* pIndices; // LOD0 ڿ LOD1 ~  ̾ پ .
+	UINT VertexCount;
+	UINT SkinnedVertexCount;
+	UINT IndexCount;	  // LOD0.
+	UINT LODCount;		  // LOD0 .
+	UINT pLODIndexCounts[MAX_MESH_LOD_COUNT];
+};
+
+class CookedAsset
+{
+public:
+	CookedAsset() = default;
+	~CookedAsset() { Cleanup(); }
+
+	// magic, , hash, ũ,  offset  Ȯ. ϳ Ʋ false.
+	bool Open(const std::wstring& PATH, const UINT64 CONTENT_HASH);
+	void Cleanup();
+
+	CookedMeshView GetMeshView(const UINT MESH_INDEX) const;
+
+	// Model::Initialize MeshInfo Ƿ mesh   .
+	void ReadMeshInfos(std::vector<MeshInfo>* pOutMeshInfos) const;
+	// bone, clip. Keys, IKRotations, root motion,  clip.  clip   false.
+	bool ReadAnimationData(AnimationData* pOutAnimData) const;
+
+	bool HasAnimationData() const;
+	UINT GetMeshCount() const;
+
+	inline bool IsOpened() const { return (m_pData != nullptr); }
+	inline UINT64 GetFileSize() const { return m_FileSize; }
+
+protected:
+	bool validate() const;
+	// 迭 16byte ̾ .
+	bool isRangeValid(const UINT64 OFFSET, const UINT64 COUNT, const UINT64 ELEMENT_SIZE) const;
+	bool isStringValid(const UINT64 OFFSET, const UINT64 CHAR_SIZE) const;
+	std::wstring readWString(const UINT64 OFFSET) const;
+	std::string readString(const UINT64 OFFSET) const;
+
+private:
+	HANDLE m_hFile = INVALID_HANDLE_VALUE;
+	HANDLE m_hMapping = nullptr;
+	const BYTE* m_pData = nullptr;
+	UINT64 m_FileSize = 0;
+};
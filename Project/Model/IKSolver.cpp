@@ -0,0 +1,385 @@
+#include "../pch.h"
+#include "../Util/Utility.h"
+#include "IKSolver.h"
+
+static const float IK_EPSILON = 1e-6f;
+static const float MAX_DLS_ANGLE = 0.5f;
+
+static inline Vector3 NormalizeOr(const Vector3& V, const Vector3& FALLBACK)
+{
+	const float LENGTH = V.Length();
+	return (LENGTH > IK_EPSILON ? V / LENGTH : FALLBACK);
+}
+
+static inline float GetChainLength(const IKChainTask* pTASK, float* pOutLengths)
+{
+	float totalLength = 0.0f;
+	for (UINT i = 0; i + 1 < pTASK->JointCount; ++i)
+	{
+		pOutLengths[i] = (pTASK->Positions[i + 1] - pTASK->Positions[i]).Length();
+		totalLength += pOutLengths[i];
+	}
+	return totalLength;
+}
+
+//  ġ Ǯ  ġ  ȸ ȭ . θ .
+static void ComputeDeltas(const Vector3* pORIGINAL_POSITIONS, const Vector3* pPOSITIONS, const UINT JOINT_COUNT, Quaternion* pOutDeltas)
+{
+	Quaternion parentDelta;
+	for (UINT i = 0; i + 1 < JOINT_COUNT; ++i)
+	{
+		const Vector3 ROTATED_SEGMENT = Vector3::Transform(pORIGINAL_POSITIONS[i + 1] - pORIGINAL_POSITIONS[i], parentDelta);
+		const Vector3 SEGMENT = pPOSITIONS[i + 1] - pPOSITIONS[i];
+		pOutDeltas[i] = Quaternion::Concatenate(RotationBetween(ROTATED_SEGMENT, SEGMENT), parentDelta);
+		parentDelta = pOutDeltas[i];
+	}
+	pOutDeltas[JOINT_COUNT - 1] = parentDelta;
+}
+
+Quaternion RotationBetween(const Vector3& FROM, const Vector3& TO)
+{
+	const float FROM_LENGTH = FROM.Length();
+	const float TO_LENGTH = TO.Length();
+	if (FROM_LENGTH < IK_EPSILON || TO_LENGTH < IK_EPSILON)
+	{
+		return Quaternion();
+	}
+
+	const Vector3 FROM_DIR = FROM / FROM_LENGTH;
+	const Vector3 TO_DIR = TO / TO_LENGTH;
+	const float DOT = FROM_DIR.Dot(TO_DIR);
+
+	// ݴ  ƹ  180.
+	if (DOT < -0.99999f)
+	{
+		Vector3 axis = Vector3::UnitX.Cross(FROM_DIR);
+		if (axis.LengthSquared() < IK_EPSILON)
+		{
+			axis = Vector3::UnitY.Cross(FROM_DIR);
+		}
+		axis.Normalize();
+		return Quaternion(axis, 0.0f);
+	}
+
+	const Vector3 AXIS = FROM_DIR.Cross(TO_DIR);
+	Quaternion ret(AXIS, 1.0f + DOT);
+	ret.Normalize();
+	return ret;
+}
+
+bool SolveTwoBoneIK(IKChainTask* pTask, const IKSolverSettings& SETTINGS)
+{
+	_ASSERT(pTask);
+	_ASSERT(pTask->JointCount == 3);
+
+	const Vector3 ROOT = pTask->Positions[0];
+	const Vector3 MID = pTask->Positions[1];
+	const Vector3 END = pTask->Positions[2];
+	const Vector3 UPPER = MID - ROOT;
+	const Vector3 LOWER = END - MID;
+	const float UPPER_LENGTH = UPPER.Length();
+	const float LOWER_LENGTH = LOWER.Length();
+
+	pTask->IterationCount = 1;
+	for (UINT i = 0; i < 3; ++i)
+	{
+		pTask->Deltas[i] = Quaternion();
+	}
+
+	if (UPPER_LENGTH < IK_EPSILON || LOWER_LENGTH < IK_EPSILON)
+	{
+		pTask->Error = (END - pTask->Target).Length();
+		return false;
+	}
+
+	//    .    pole  鿡 .
+	const float CUR_BEND = acosf(Clamp(UPPER.Dot(LOWER) / (UPPER_LENGTH * LOWER_LENGTH), -1.0f, 1.0f));
+	Vector3 bendAxis = UPPER.Cross(LOWER);
+	if (bendAxis.LengthSquared() < IK_EPSILON * UPPER_LENGTH * LOWER_LENGTH)
+	{
+		bendAxis = UPPER.Cross(pTask->Pole - ROOT);
+		if (bendAxis.LengthSquared() < IK_EPSILON)
+		{
+			bendAxis = UPPER.Cross(fabs(UPPER.x) < 0.9f * UPPER_LENGTH ? Vector3::UnitX : Vector3::UnitY);
+		}
+	}
+	bendAxis.Normalize();
+
+	// |END - ROOT|^2 = a^2 + b^2 + 2ab * cos(bend).
+	const Vector3 TO_TARGET = pTask->Target - ROOT;
+	const float TARGET_DISTANCE = TO_TARGET.Length();
+	float cosBend = (TARGET_DISTANCE * TARGET_DISTANCE - UPPER_LENGTH * UPPER_LENGTH - LOWER_LENGTH * LOWER_LENGTH) / (2.0f * UPPER_LENGTH * LOWER_LENGTH);
+	cosBend = Clamp(cosBend, -1.0f, 1.0f);
+	const float NEW_BEND = Clamp(acosf(cosBend), pTask->MinBend, pTask->MaxBend);
+
+	const Quaternion MID_ROTATION = Quaternion::CreateFromAxisAngle(bendAxis, NEW_BEND - CUR_BEND);
+	const Vector3 BENT_LOWER = Vector3::Transform(LOWER, MID_ROTATION);
+
+	// root  end target .
+	Quaternion rootRotation;
+	if (TARGET_DISTANCE > IK_EPSILON)
+	{
+		rootRotation = RotationBetween(UPPER + BENT_LOWER, TO_TARGET);
+
+		// root-target  Ʋ mid  pole  ϰ .
+		const Vector3 AXIS = TO_TARGET / TARGET_DISTANCE;
+		const Vector3 ROTATED_UPPER = Vector3::Transform(UPPER, rootRotation);
+		const Vector3 TO_POLE = pTask->Pole - ROOT;
+		const Vector3 MID_DIR = ROTATED_UPPER - AXIS * AXIS.Dot(ROTATED_UPPER);
+		const Vector3 POLE_DIR = TO_POLE - AXIS * AXIS.Dot(TO_POLE);
+		if (MID_DIR.LengthSquared() > IK_EPSILON && POLE_DIR.LengthSquared() > IK_EPSILON)
+		{
+			const float TWIST = atan2f(AXIS.Dot(MID_DIR.Cross(POLE_DIR)), MID_DIR.Dot(POLE_DIR));
+			rootRotation = Quaternion::Concatenate(Quaternion::CreateFromAxisAngle(AXIS, TWIST), rootRotation);
+		}
+	}
+
+	pTask->Deltas[0] = rootRotation;
+	pTask->Deltas[1] = Quaternion::Concatenate(rootRotation, MID_ROTATION);
+	pTask->Deltas[2] = pTask->Deltas[1];
+
+	pTask->Positions[1] = ROOT + Vector3::Transform(UPPER, pTask->Deltas[0]);
+	pTask->Positions[2] = pTask->Positions[1] + Vector3::Transform(LOWER, pTask->Deltas[1]);
+	pTask->Error = (pTask->Positions[2] - pTask->Target).Length();
+
+	return (pTask->Error <= SETTINGS.Tolerance * (UPPER_LENGTH + LOWER_LENGTH));
+}
+
+bool SolveFABRIK(IKChainTask* pTask, const IKSolverSettings& SETTINGS)
+{
+	_ASSERT(pTask);
+	_ASSERT(pTask->JointCount >= 2 && pTask->JointCount <= MAX_IK_CHAIN_JOINT);
+
+	const UINT JOINT_COUNT = pTask->JointCount;
+	const UINT LAST = JOINT_COUNT - 1;
+	Vector3* pPositions = pTask->Positions;
+
+	Vector3 pOriginalPositions[MAX_IK_CHAIN_JOINT];
+	float pLengths[MAX_IK_CHAIN_JOINT];
+	for (UINT i = 0; i < JOINT_COUNT; ++i)
+	{
+		pOriginalPositions[i] = pPositions[i];
+	}
+	const float TOTAL_LENGTH = GetChainLength(pTask, pLengths);
+	const float TOLERANCE = SETTINGS.Tolerance * TOTAL_LENGTH;
+
+	const Vector3 ROOT = pPositions[0];
+	const Vector3 TARGET = pTask->Target;
+	UINT iteration = 0;
+
+	if ((TARGET - ROOT).Length() >= TOTAL_LENGTH)
+	{
+		//   target  .
+		const Vector3 DIR = NormalizeOr(TARGET - ROOT, Vector3::UnitY);
+		for (UINT i = 0; i < LAST; ++i)
+		{
+			pPositions[i + 1] = pPositions[i] + DIR * pLengths[i];
+		}
+		iteration = 1;
+	}
+	else
+	{
+		for (; iteration < SETTINGS.MaxFABRIKIteration; ++iteration)
+		{
+			if ((pPositions[LAST] - TARGET).Length() <= TOLERANCE)
+			{
+				break;
+			}
+
+			// end effector -> root.
+			pPositions[LAST] = TARGET;
+			for (UINT i = LAST; i > 0; --i)
+			{
+				const Vector3 DIR = NormalizeOr(pPositions[i - 1] - pPositions[i], pOriginalPositions[i - 1] - pOriginalPositions[i]);
+				pPositions[i - 1] = pPositions[i] + DIR * pLengths[i - 1];
+			}
+
+			// root -> end effector.
+			pPositions[0] = ROOT;
+			for (UINT i = 0; i < LAST; ++i)
+			{
+				const Vector3 DIR = NormalizeOr(pPositions[i + 1] - pPositions[i], pOriginalPositions[i + 1] - pOriginalPositions[i]);
+				pPositions[i + 1] = pPositions[i] + DIR * pLengths[i];
+			}
+		}
+	}
+
+	ComputeDeltas(pOriginalPositions, pPositions, JOINT_COUNT, pTask->Deltas);
+	pTask->Error = (pPositions[LAST] - TARGET).Length();
+	pTask->IterationCount = iteration;
+
+	return (pTask->Error <= TOLERANCE);
+}
+
+bool SolveDLS(IKChainTask* pTask, const IKSolverSettings& SETTINGS)
+{
+	_ASSERT(pTask);
+	_ASSERT(pTask->JointCount >= 2 && pTask->JointCount <= MAX_IK_CHAIN_JOINT);
+
+	const UINT JOINT_COUNT = pTask->JointCount;
+	const UINT LAST = JOINT_COUNT - 1;
+	Vector3* pPositions = pTask->Positions;
+
+	float pLengths[MAX_IK_CHAIN_JOINT];
+	const float TOTAL_LENGTH = GetChainLength(pTask, pLengths);
+	const float TOLERANCE = SETTINGS.Tolerance * TOTAL_LENGTH;
+	const float DAMPING = SETTINGS.DLSDamping * TOTAL_LENGTH;
+	const float MAX_STEP = 0.25f * TOTAL_LENGTH;
+
+	for (UINT i = 0; i < JOINT_COUNT; ++i)
+	{
+		pTask->Deltas[i] = Quaternion();
+	}
+
+	// ݺ   Ƿ(Ư ڼ ó)   ڼ .
+	Vector3 pBestPositions[MAX_IK_CHAIN_JOINT];
+	Quaternion pBestDeltas[MAX_IK_CHAIN_JOINT];
+	float bestError = FLT_MAX;
+
+	UINT iteration = 0;
+	for (; iteration < SETTINGS.MaxDLSIteration; ++iteration)
+	{
+		Vector3 error = pTask->Target - pPositions[LAST];
+		const float ERROR_LENGTH = error.Length();
+		if (ERROR_LENGTH < bestError)
+		{
+			bestError = ERROR_LENGTH;
+			for (UINT i = 0; i < JOINT_COUNT; ++i)
+			{
+				pBestPositions[i] = pPositions[i];
+				pBestDeltas[i] = pTask->Deltas[i];
+			}
+		}
+		if (ERROR_LENGTH <= TOLERANCE)
+		{
+			break;
+		}
+		if (ERROR_LENGTH > MAX_STEP)
+		{
+			error *= MAX_STEP / ERROR_LENGTH;
+		}
+
+		//  3 ȸ.   J * J^T = |r|^2 * I - r * r^T (r:  -> end effector).
+		// (J * J^T + damping^2 * I) * f = error  Ǯ  ȸ J^T * f = r x f.
+		float a00 = DAMPING * DAMPING;
+		float a11 = a00;
+		float a22 = a00;
+		float a01 = 0.0f;
+		float a02 = 0.0f;
+		float a12 = 0.0f;
+		for (UINT i = 0; i < LAST; ++i)
+		{
+			const Vector3 R = pPositions[LAST] - pPositions[i];
+			const float LENGTH_SQUARE = R.LengthSquared();
+			a00 += LENGTH_SQUARE - R.x * R.x;
+			a11 += LENGTH_SQUARE - R.y * R.y;
+			a22 += LENGTH_SQUARE - R.z * R.z;
+			a01 -= R.x * R.y;
+			a02 -= R.x * R.z;
+			a12 -= R.y * R.z;
+		}
+
+		// Ī 3x3 .
+		const float C00 = a11 * a22 - a12 * a12;
+		const float C01 = a02 * a12 - a01 * a22;
+		const float C02 = a01 * a12 - a02 * a11;
+		const float DETERMINANT = a00 * C00 + a01 * C01 + a02 * C02;
+		if (fabs(DETERMINANT) < IK_EPSILON * IK_EPSILON)
+		{
+			break;
+		}
+		const float C11 = a00 * a22 - a02 * a02;
+		const float C12 = a01 * a02 - a00 * a12;
+		const float C22 = a00 * a11 - a01 * a01;
+		const float INVERSE_DETERMINANT = 1.0f / DETERMINANT;
+		const Vector3 F((C00 * error.x + C01 * error.y + C02 * error.z) * INVERSE_DETERMINANT,
+						(C01 * error.x + C11 * error.y + C12 * error.z) * INVERSE_DETERMINANT,
+						(C02 * error.x + C12 * error.y + C22 * error.z) * INVERSE_DETERMINANT);
+
+		// ڽĺ ؾ θ ȸ ڽ ȸ Բ .
+		for (UINT i = LAST; i > 0; --i)
+		{
+			const UINT JOINT = i - 1;
+			const Vector3 OMEGA = (pPositions[LAST] - pPositions[JOINT]).Cross(F);
+			const float ANGLE = OMEGA.Length();
+			if (ANGLE < IK_EPSILON)
+			{
+				continue;
+			}
+
+			const Quaternion ROTATION = Quaternion::CreateFromAxisAngle(OMEGA / ANGLE, fminf(ANGLE, MAX_DLS_ANGLE));
+			for (UINT j = JOINT + 1; j < JOINT_COUNT; ++j)
+			{
+				pPositions[j] = pPositions[JOINT] + Vector3::Transform(pPositions[j] - pPositions[JOINT], ROTATION);
+			}
+			for (UINT j = JOINT; j < JOINT_COUNT; ++j)
+			{
+				pTask->Deltas[j] = Quaternion::Concatenate(ROTATION, pTask->Deltas[j]);
+			}
+		}
+	}
+
+	pTask->Error = (pPositions[LAST] - pTask->Target).Length();
+	if (pTask->Error > bestError)
+	{
+		for (UINT i = 0; i < JOINT_COUNT; ++i)
+		{
+			pPositions[i] = pBestPositions[i];
+			pTask->Deltas[i] = pBestDeltas[i];
+		}
+		pTask->Error = bestError;
+	}
+	pTask->IterationCount = iteration;
+
+	return (pTask->Error <= TOLERANCE);
+}
+
+void SolveIKTasks(IKChainTask* pTasks, const UINT TASK_COUNT, const IKSolverSettings& SETTINGS)
+{
+	_ASSERT(pTasks || TASK_COUNT == 0);
+
+	for (UINT taskIndex = 0; taskIndex < TASK_COUNT; ++taskIndex)
+	{
+		IKChainTask* pTask = &pTasks[taskIndex];
+
+		switch (pTask->SolverType)
+		{
+			case IKSolverType_TwoBone:
+				if (pTask->JointCount == 3)
+				{
+					SolveTwoBoneIK(pTask, SETTINGS);
+					break;
+				}
+				//  3 ƴϸ FABRIK.
+				// fallthrough
+			case IKSolverType_FABRIK:
+			{
+				IKChainTask original = *pTask;
+				if (SolveFABRIK(pTask, SETTINGS))
+				{
+					break;
+				}
+
+				//   ִµ   츸 DLS ٽ Ǯ    .
+				float pLengths[MAX_IK_CHAIN_JOINT];
+				if ((original.Target - original.Positions[0]).Length() < GetChainLength(&original, pLengths))
+				{
+					SolveDLS(&original, SETTINGS);
+					if (original.Error < pTask->Error)
+					{
+						*pTask = original;
+					}
+				}
+				break;
+			}
+
+			case IKSolverType_DLS:
+				SolveDLS(pTask, SETTINGS);
+				break;
+
+			default:
+				__debugbreak();
+				break;
+		}
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <directxtk12/SimpleMath.h>
+
+//  ġ Ǫ IK.  ġ, ȸ  (AnimationData bone )̰
+//    ڼ ߰  ȸ.  ũ 迭 Ƿ Ҵ .
+
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Quaternion;
+
+const UINT MAX_IK_CHAIN_JOINT = 8;
+
+enum eIKSolverType
+{
+	IKSolverType_TwoBone = 0, //  3. ؼ Ǯ mid    .
+	IKSolverType_FABRIK,	  //    .  ϸ DLS ٽ ǯ.
+	IKSolverType_DLS,
+};
+
+struct IKChainTask
+{
+	// Է.
+	Vector3 Positions[MAX_IK_CHAIN_JOINT]; // [0] , [JointCount - 1] end effector.
+	UINT JointCount;
+	Vector3 Target;
+	Vector3 Pole;	// two-bone mid   .
+	float MinBend;	// two-bone mid   (   0) .
+	float MaxBend;
+	eIKSolverType SolverType;
+
+	// . Deltas[i]  i ȸ ȭ(θ ȭ ). Ǯ  Positions  ġ ٲ.
+	Quaternion Deltas[MAX_IK_CHAIN_JOINT];
+	float Error; // end effector target Ÿ.
+	UINT IterationCount;
+};
+
+struct IKSolverSettings
+{
+	float Tolerance = 1e-3f; // chain  .
+	UINT MaxFABRIKIteration = 16;
+	UINT MaxDLSIteration = 32;
+	float DLSDamping = 0.1f;
+};
+
+// ĳ   , ٸ  . task ̹Ƿ job  .
+void SolveIKTasks(IKChainTask* pTasks, const UINT TASK_COUNT, const IKSolverSettings& SETTINGS);
+
+bool SolveTwoBoneIK(IKChainTask* pTask, const IKSolverSettings& SETTINGS);
+bool SolveFABRIK(IKChainTask* pTask, const IKSolverSettings& SETTINGS);
+bool SolveDLS(IKChainTask* pTask, const IKSolverSettings& SETTINGS);
+
+// FROM  TO   ּ ȸ.
+Quaternion RotationBetween(const Vector3& FROM, const Vector3& TO);
@@ -2,6 +2,7 @@
 
 #include "../pch.h"
 #include "../Renderer/TextureManager.h"
+#include "MeshInfo.h"
 
 // Vertex and Index Info
 struct BufferInfo
@@ -24,6 +25,11 @@ struct Material
 	TextureHandle* pMetallic;
 	TextureHandle* pRoughness;
 };
+
+// material table layout. t0 ~ t5(albedo, emissive, normal, ao, metallic, roughness), t6(height).
+static const UINT MATERIAL_DESCRIPTOR_COUNT = 7;
+static const UINT INVALID_MATERIAL_TABLE_INDEX = 0xffffffff;
+
 class Mesh
 {
 public:
@@ -50,6 +56,24 @@ public:
 		Index.pBuffer = nullptr;
 		Index.IndexBufferView = {};
 		Index.Count = 0;
+		LODCount = 1;
+		pLODIndexStarts[0] = 0;
+		pLODIndexCounts[0] = 0;
+	}
+
+	// LEVEL LODCount    ܰ.
+	void GetLODIndexRange(const UINT LEVEL, UINT* pOutStart, UINT* pOutCount) const
+	{
+		if (LEVEL == 0 || LODCount <= 1)
+		{
+			*pOutStart = 0;
+			*pOutCount = Index.Count;
+			return;
+		}
+
+		const UINT LOD = (LEVEL < LODCount ? LEVEL : LODCount - 1);
+		*pOutStart = pLODIndexStarts[LOD];
+		*pOutCount = pLODIndexCounts[LOD];
 	}
 
 public:
@@ -57,6 +81,16 @@ public:
 	BufferInfo Index;
 	Material Material = { nullptr, };
 
+	// index buffer LOD0 ~ LOD(LODCount - 1) index ̾ پ . Index.Count LOD0 .
+	UINT LODCount = 1;
+	UINT pLODIndexStarts[MAX_MESH_LOD_COUNT] = { 0, };
+	UINT pLODIndexCounts[MAX_MESH_LOD_COUNT] = { 0, };
+
+	// persistent material table in shader visible heap. rebuilt by Model::UpdateMaterialTables when Material changes.
+	struct Material BoundMaterial = { nullptr, };
+	UINT MaterialTableIndex = INVALID_MATERIAL_TABLE_INDEX;
+	D3D12_GPU_DESCRIPTOR_HANDLE MaterialTableGPUHandle = { 0, };
+
 	MeshConstant MeshConstantData;
 	MaterialConstant MaterialConstantData;
 };
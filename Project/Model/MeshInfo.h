@@ -4,6 +4,8 @@
 #include <string>
 #include "Vertex.h"
 
+static const UINT MAX_MESH_LOD_COUNT = 5; // LOD0 .
+
 struct MeshInfo
 {
 	std::vector<Vertex> Vertices;
@@ -17,6 +19,7 @@ struct MeshInfo
 	std::wstring szMetallicTextureFileName;
 	std::wstring szRoughnessTextureFileName;
 	std::wstring szOpacityTextureFileName;
+	std::vector<std::vector<UINT>> LODIndices; // LOD1. vertex LOD0(Vertices, SkinnedVertices)  .
 };
 
 #define INIT_MESH_INFO							 \
@@ -32,6 +35,7 @@ static void ReleaseMeshInfo(MeshInfo** ppMeshInfo)
 	(*ppMeshInfo)->Vertices.clear();
 	(*ppMeshInfo)->SkinnedVertices.clear();
 	(*ppMeshInfo)->Indices.clear();
+	(*ppMeshInfo)->LODIndices.clear();
 
 	free(*ppMeshInfo);
 	*ppMeshInfo = nullptr;
@@ -0,0 +1,544 @@
+#include "../pch.h"
+#include <algorithm>
+#include "MeshOptimizer.h"
+
+static const UINT INVALID_INDEX = 0xffffffff;
+static const UINT64 FNV_OFFSET_BASIS = 14695981039346656037ull;
+static const UINT64 FNV_PRIME = 1099511628211ull;
+
+// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation" ⺻ .
+static const UINT FORSYTH_CACHE_SIZE = 32;
+static const float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+static const float FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+static const float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+static const float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+static UINT64 HashBytes(const void* pDATA, const UINT64 SIZE, UINT64 hash)
+{
+	const BYTE* pBYTES = (const BYTE*)pDATA;
+	for (UINT64 i = 0; i < SIZE; ++i)
+	{
+		hash ^= pBYTES[i];
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+// FIFO cache. timestamp ̰ CACHE_SIZE ϸ cache ȿ .
+static UINT CountTriangleMisses(const UINT* pTRIANGLE, std::vector<UINT>& cacheTimestamps, UINT* pTimestamp, const UINT CACHE_SIZE)
+{
+	UINT misses = 0;
+	for (UINT i = 0; i < 3; ++i)
+	{
+		const UINT VERTEX = pTRIANGLE[i];
+		if (*pTimestamp - cacheTimestamps[VERTEX] > CACHE_SIZE)
+		{
+			cacheTimestamps[VERTEX] = (*pTimestamp)++;
+			++misses;
+		}
+	}
+	return misses;
+}
+
+void GetVertexCacheStats(const std::vector<UINT>& INDICES, const UINT VERTEX_COUNT, const UINT CACHE_SIZE, float* pOutACMR, float* pOutATVR)
+{
+	_ASSERT(pOutACMR);
+	_ASSERT(pOutATVR);
+
+	const UINT64 TRIANGLE_COUNT = INDICES.size() / 3;
+	std::vector<UINT> cacheTimestamps(VERTEX_COUNT, 0);
+	UINT timestamp = CACHE_SIZE + 1;
+	UINT64 misses = 0;
+
+	for (UINT64 i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		misses += CountTriangleMisses(&INDICES[i * 3], cacheTimestamps, &timestamp, CACHE_SIZE);
+	}
+
+	*pOutACMR = (TRIANGLE_COUNT == 0 ? 0.0f : (float)misses / (float)TRIANGLE_COUNT);
+	*pOutATVR = (VERTEX_COUNT == 0 ? 0.0f : (float)misses / (float)VERTEX_COUNT);
+}
+
+static bool IsSameVertex(const MeshInfo& MESH_INFO, const bool bSKINNED, const UINT A, const UINT B)
+{
+	if (memcmp(&MESH_INFO.Vertices[A], &MESH_INFO.Vertices[B], sizeof(Vertex)) != 0)
+	{
+		return false;
+	}
+	return (!bSKINNED || memcmp(&MESH_INFO.SkinnedVertices[A], &MESH_INFO.SkinnedVertices[B], sizeof(SkinnedVertex)) == 0);
+}
+
+// byte    vertex .   Ƿ ̹ ó ڸ .
+static UINT WeldVertices(MeshInfo* pMeshInfo)
+{
+	std::vector<Vertex>& vertices = pMeshInfo->Vertices;
+	std::vector<SkinnedVertex>& skinnedVertices = pMeshInfo->SkinnedVertices;
+	std::vector<UINT>& indices = pMeshInfo->Indices;
+	const bool bSKINNED = !skinnedVertices.empty();
+	const UINT VERTEX_COUNT = (UINT)vertices.size();
+
+	UINT tableSize = 1;
+	while (tableSize < VERTEX_COUNT * 2)
+	{
+		tableSize <<= 1;
+	}
+	std::vector<UINT> table(tableSize, INVALID_INDEX); //   index.
+	std::vector<UINT> remap(VERTEX_COUNT);
+	UINT uniqueCount = 0;
+
+	for (UINT i = 0; i < VERTEX_COUNT; ++i)
+	{
+		UINT64 hash = HashBytes(&vertices[i], sizeof(Vertex), FNV_OFFSET_BASIS);
+		if (bSKINNED)
+		{
+			hash = HashBytes(&skinnedVertices[i], sizeof(SkinnedVertex), hash);
+		}
+
+		UINT slot = (UINT)(hash & (tableSize - 1));
+		while (table[slot] != INVALID_INDEX && !IsSameVertex(*pMeshInfo, bSKINNED, table[slot], i))
+		{
+			slot = (slot + 1) & (tableSize - 1);
+		}
+
+		if (table[slot] != INVALID_INDEX)
+		{
+			remap[i] = table[slot];
+			continue;
+		}
+
+		vertices[uniqueCount] = vertices[i];
+		if (bSKINNED)
+		{
+			skinnedVertices[uniqueCount] = skinnedVertices[i];
+		}
+		table[slot] = uniqueCount;
+		remap[i] = uniqueCount;
+		++uniqueCount;
+	}
+
+	vertices.resize(uniqueCount);
+	if (bSKINNED)
+	{
+		skinnedVertices.resize(uniqueCount);
+	}
+	for (UINT64 i = 0, size = indices.size(); i < size; ++i)
+	{
+		indices[i] = remap[indices[i]];
+	}
+
+	return uniqueCount;
+}
+
+//     ﰢ .
+static UINT RemoveDegenerateTriangles(std::vector<UINT>& indices)
+{
+	const UINT64 TRIANGLE_COUNT = indices.size() / 3;
+	UINT64 writeIndex = 0;
+
+	for (UINT64 i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		const UINT A = indices[i * 3];
+		const UINT B = indices[i * 3 + 1];
+		const UINT C = indices[i * 3 + 2];
+		if (A == B || B == C || C == A)
+		{
+			continue;
+		}
+
+		indices[writeIndex++] = A;
+		indices[writeIndex++] = B;
+		indices[writeIndex++] = C;
+	}
+
+	const UINT REMOVED_COUNT = (UINT)(TRIANGLE_COUNT - writeIndex / 3);
+	indices.resize(writeIndex);
+	return REMOVED_COUNT;
+}
+
+static float GetForsythVertexScore(const int CACHE_POSITION, const UINT ACTIVE_TRIANGLE_COUNT)
+{
+	if (ACTIVE_TRIANGLE_COUNT == 0)
+	{
+		return -1.0f;
+	}
+
+	float score = 0.0f;
+	if (CACHE_POSITION >= 0)
+	{
+		if (CACHE_POSITION < 3)
+		{
+			//  ﰢ vertex.  ﰢ        .
+			score = FORSYTH_LAST_TRIANGLE_SCORE;
+		}
+		else
+		{
+			const float SCALER = 1.0f / (float)(FORSYTH_CACHE_SIZE - 3);
+			score = powf(1.0f - (float)(CACHE_POSITION - 3) * SCALER, FORSYTH_CACHE_DECAY_POWER);
+		}
+	}
+
+	//  ﰢ  vertex   .
+	score += FORSYTH_VALENCE_BOOST_SCALE * powf((float)ACTIVE_TRIANGLE_COUNT, -FORSYTH_VALENCE_BOOST_POWER);
+	return score;
+}
+
+// LRU cache ϰ cache  vertex ﰢ      ʷ .
+void OptimizeVertexCache(std::vector<UINT>* pIndices, const UINT VERTEX_COUNT)
+{
+	_ASSERT(pIndices);
+
+	std::vector<UINT>& indices = *pIndices;
+	const UINT TRIANGLE_COUNT = (UINT)(indices.size() / 3);
+
+	// vertex -> ﰢ  .  activeTriangleCounts[v]    ﰢ.
+	std::vector<UINT> activeTriangleCounts(VERTEX_COUNT, 0);
+	for (UINT64 i = 0, size = indices.size(); i < size; ++i)
+	{
+		++activeTriangleCounts[indices[i]];
+	}
+
+	std::vector<UINT> triangleOffsets(VERTEX_COUNT + 1, 0);
+	for (UINT i = 0; i < VERTEX_COUNT; ++i)
+	{
+		triangleOffsets[i + 1] = triangleOffsets[i] + activeTriangleCounts[i];
+	}
+
+	std::vector<UINT> adjacentTriangles(indices.size());
+	std::vector<UINT> fillCounts(VERTEX_COUNT, 0);
+	for (UINT i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		for (UINT j = 0; j < 3; ++j)
+		{
+			const UINT VERTEX = indices[i * 3 + j];
+			adjacentTriangles[triangleOffsets[VERTEX] + fillCounts[VERTEX]++] = i;
+		}
+	}
+
+	std::vector<int> cachePositions(VERTEX_COUNT, -1);
+	std::vector<float> vertexScores(VERTEX_COUNT);
+	for (UINT i = 0; i < VERTEX_COUNT; ++i)
+	{
+		vertexScores[i] = GetForsythVertexScore(-1, activeTriangleCounts[i]);
+	}
+
+	UINT bestTriangle = INVALID_INDEX;
+	float bestScore = -1.0f;
+	for (UINT i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		const float SCORE = vertexScores[indices[i * 3]] + vertexScores[indices[i * 3 + 1]] + vertexScores[indices[i * 3 + 2]];
+		if (SCORE > bestScore)
+		{
+			bestScore = SCORE;
+			bestTriangle = i;
+		}
+	}
+
+	std::vector<BYTE> emitted(TRIANGLE_COUNT, 0);
+	std::vector<UINT> result;
+	result.reserve(indices.size());
+
+	UINT pCache[FORSYTH_CACHE_SIZE + 3];
+	UINT pNewCache[FORSYTH_CACHE_SIZE + 3];
+	UINT cacheCount = 0;
+	UINT deadEndCursor = 0;
+
+	for (UINT emittedCount = 0; emittedCount < TRIANGLE_COUNT; ++emittedCount)
+	{
+		if (bestTriangle == INVALID_INDEX)
+		{
+			// cache ȿ  ﰢ     ﰢ.
+			while (emitted[deadEndCursor])
+			{
+				++deadEndCursor;
+			}
+			bestTriangle = deadEndCursor;
+		}
+
+		emitted[bestTriangle] = 1;
+		const UINT* pTRIANGLE = &indices[bestTriangle * 3];
+		result.push_back(pTRIANGLE[0]);
+		result.push_back(pTRIANGLE[1]);
+		result.push_back(pTRIANGLE[2]);
+
+		UINT newCacheCount = 0;
+		for (UINT i = 0; i < 3; ++i)
+		{
+			pNewCache[newCacheCount++] = pTRIANGLE[i];
+		}
+		for (UINT i = 0; i < cacheCount; ++i)
+		{
+			const UINT VERTEX = pCache[i];
+			if (VERTEX != pTRIANGLE[0] && VERTEX != pTRIANGLE[1] && VERTEX != pTRIANGLE[2])
+			{
+				pNewCache[newCacheCount++] = VERTEX;
+			}
+		}
+
+		for (UINT i = 0; i < 3; ++i)
+		{
+			const UINT VERTEX = pTRIANGLE[i];
+			UINT* pList = &adjacentTriangles[triangleOffsets[VERTEX]];
+			const UINT LAST = activeTriangleCounts[VERTEX] - 1;
+			for (UINT j = 0; j <= LAST; ++j)
+			{
+				if (pList[j] == bestTriangle)
+				{
+					pList[j] = pList[LAST];
+					pList[LAST] = bestTriangle;
+					break;
+				}
+			}
+			--activeTriangleCounts[VERTEX];
+		}
+
+		for (UINT i = 0; i < newCacheCount; ++i)
+		{
+			const UINT VERTEX = pNewCache[i];
+			cachePositions[VERTEX] = (i < FORSYTH_CACHE_SIZE ? (int)i : -1);
+			vertexScores[VERTEX] = GetForsythVertexScore(cachePositions[VERTEX], activeTriangleCounts[VERTEX]);
+		}
+
+		//  ٲ ﰢ cache  vertex  ͻ.
+		bestTriangle = INVALID_INDEX;
+		bestScore = -1.0f;
+		for (UINT i = 0; i < newCacheCount; ++i)
+		{
+			const UINT VERTEX = pNewCache[i];
+			const UINT* pLIST = &adjacentTriangles[triangleOffsets[VERTEX]];
+			for (UINT j = 0, count = activeTriangleCounts[VERTEX]; j < count; ++j)
+			{
+				const UINT TRIANGLE = pLIST[j];
+				const float SCORE = vertexScores[indices[TRIANGLE * 3]] + vertexScores[indices[TRIANGLE * 3 + 1]] + vertexScores[indices[TRIANGLE * 3 + 2]];
+				if (SCORE > bestScore)
+				{
+					bestScore = SCORE;
+					bestTriangle = TRIANGLE;
+				}
+			}
+		}
+
+		cacheCount = (newCacheCount < FORSYTH_CACHE_SIZE ? newCacheCount : FORSYTH_CACHE_SIZE);
+		memcpy(pCache, pNewCache, sizeof(UINT) * cacheCount);
+	}
+
+	indices.swap(result);
+}
+
+// Tipsify(Sander et al. 2007)  cluster .
+// cache   ( vertex  miss) hard .  ȿ cache   ص
+//  ACMR hard cluster  * threshold Ϸ   soft 踦 .
+static void GenerateClusters(const std::vector<UINT>& INDICES, const UINT VERTEX_COUNT, const MeshOptimizeSettings& SETTINGS, std::vector<UINT>* pOutClusterStarts)
+{
+	const UINT TRIANGLE_COUNT = (UINT)(INDICES.size() / 3);
+	const UINT CACHE_SIZE = SETTINGS.CacheSize;
+
+	std::vector<UINT> cacheTimestamps(VERTEX_COUNT, 0);
+	UINT timestamp = CACHE_SIZE + 1;
+
+	std::vector<UINT> hardStarts;
+	for (UINT i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		const UINT MISSES = CountTriangleMisses(&INDICES[i * 3], cacheTimestamps, &timestamp, CACHE_SIZE);
+		if (i == 0 || MISSES == 3)
+		{
+			hardStarts.push_back(i);
+		}
+	}
+	hardStarts.push_back(TRIANGLE_COUNT);
+
+	pOutClusterStarts->clear();
+	for (UINT64 i = 0, hardClusterCount = hardStarts.size() - 1; i < hardClusterCount; ++i)
+	{
+		const UINT START = hardStarts[i];
+		const UINT END = hardStarts[i + 1];
+
+		// hard cluster ü ACMR. cache  ¿ ٽ .
+		timestamp += CACHE_SIZE + 1;
+		UINT clusterMisses = 0;
+		for (UINT j = START; j < END; ++j)
+		{
+			clusterMisses += CountTriangleMisses(&INDICES[j * 3], cacheTimestamps, &timestamp, CACHE_SIZE);
+		}
+		const float CLUSTER_THRESHOLD = SETTINGS.OverdrawThreshold * (float)clusterMisses / (float)(END - START);
+
+		timestamp += CACHE_SIZE + 1;
+		UINT softStart = START;
+		UINT softMisses = 0;
+		pOutClusterStarts->push_back(START);
+		for (UINT j = START; j < END; ++j)
+		{
+			softMisses += CountTriangleMisses(&INDICES[j * 3], cacheTimestamps, &timestamp, CACHE_SIZE);
+
+			const float SOFT_ACMR = (float)softMisses / (float)(j + 1 - softStart);
+			if (j + 1 < END && SOFT_ACMR <= CLUSTER_THRESHOLD)
+			{
+				softStart = j + 1;
+				softMisses = 0;
+				timestamp += CACHE_SIZE + 1;
+				pOutClusterStarts->push_back(softStart);
+			}
+		}
+	}
+}
+
+// cluster ٱ  ͺ ׸  early-z    . cluster   .
+static UINT OptimizeOverdraw(std::vector<UINT>& indices, const std::vector<Vertex>& VERTICES, const MeshOptimizeSettings& SETTINGS)
+{
+	const UINT TRIANGLE_COUNT = (UINT)(indices.size() / 3);
+	const UINT VERTEX_COUNT = (UINT)VERTICES.size();
+
+	std::vector<UINT> clusterStarts;
+	GenerateClusters(indices, VERTEX_COUNT, SETTINGS, &clusterStarts);
+
+	const UINT CLUSTER_COUNT = (UINT)clusterStarts.size();
+	if (CLUSTER_COUNT < 2)
+	{
+		return 0;
+	}
+	clusterStarts.push_back(TRIANGLE_COUNT);
+
+	//   ߽, .
+	std::vector<Vector3> clusterCentroids(CLUSTER_COUNT, Vector3(0.0f));
+	std::vector<Vector3> clusterNormals(CLUSTER_COUNT, Vector3(0.0f));
+	std::vector<float> clusterAreas(CLUSTER_COUNT, 0.0f);
+	Vector3 meshCentroid(0.0f);
+	float meshArea = 0.0f;
+
+	for (UINT i = 0; i < CLUSTER_COUNT; ++i)
+	{
+		for (UINT j = clusterStarts[i], endTriangle = clusterStarts[i + 1]; j < endTriangle; ++j)
+		{
+			const Vector3& P0 = VERTICES[indices[j * 3]].Position;
+			const Vector3& P1 = VERTICES[indices[j * 3 + 1]].Position;
+			const Vector3& P2 = VERTICES[indices[j * 3 + 2]].Position;
+			const Vector3 NORMAL = (P1 - P0).Cross(P2 - P0); // ̴   .
+			const float AREA = NORMAL.Length();
+			const Vector3 CENTROID = (P0 + P1 + P2) / 3.0f;
+
+			clusterCentroids[i] += CENTROID * AREA;
+			clusterNormals[i] += NORMAL;
+			clusterAreas[i] += AREA;
+		}
+
+		meshCentroid += clusterCentroids[i];
+		meshArea += clusterAreas[i];
+	}
+	if (meshArea > 0.0f)
+	{
+		meshCentroid /= meshArea;
+	}
+
+	std::vector<float> sortKeys(CLUSTER_COUNT);
+	std::vector<UINT> clusterOrder(CLUSTER_COUNT);
+	for (UINT i = 0; i < CLUSTER_COUNT; ++i)
+	{
+		Vector3 centroid = (clusterAreas[i] > 0.0f ? clusterCentroids[i] / clusterAreas[i] : meshCentroid);
+		Vector3 normal = clusterNormals[i];
+		normal.Normalize();
+
+		sortKeys[i] = (centroid - meshCentroid).Dot(normal);
+		clusterOrder[i] = i;
+	}
+
+	std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&sortKeys](const UINT A, const UINT B) { return sortKeys[A] > sortKeys[B]; });
+
+	std::vector<UINT> result;
+	result.reserve(indices.size());
+	for (UINT i = 0; i < CLUSTER_COUNT; ++i)
+	{
+		const UINT CLUSTER = clusterOrder[i];
+		result.insert(result.end(), indices.begin() + (UINT64)clusterStarts[CLUSTER] * 3, indices.begin() + (UINT64)clusterStarts[CLUSTER + 1] * 3);
+	}
+
+	// cluster 迡 cache ȿ ʹ   .
+	float acmrBefore;
+	float acmrAfter;
+	float atvr;
+	GetVertexCacheStats(indices, VERTEX_COUNT, SETTINGS.CacheSize, &acmrBefore, &atvr);
+	GetVertexCacheStats(result, VERTEX_COUNT, SETTINGS.CacheSize, &acmrAfter, &atvr);
+	if (acmrAfter > acmrBefore * SETTINGS.OverdrawThreshold)
+	{
+		return 0;
+	}
+
+	indices.swap(result);
+	return CLUSTER_COUNT;
+}
+
+// index buffer ó Ǵ  vertex ġ.  ʴ vertex .
+static void OptimizeVertexFetch(MeshInfo* pMeshInfo)
+{
+	std::vector<Vertex>& vertices = pMeshInfo->Vertices;
+	std::vector<SkinnedVertex>& skinnedVertices = pMeshInfo->SkinnedVertices;
+	std::vector<UINT>& indices = pMeshInfo->Indices;
+	const bool bSKINNED = !skinnedVertices.empty();
+	const UINT VERTEX_COUNT = (UINT)vertices.size();
+
+	std::vector<UINT> remap(VERTEX_COUNT, INVALID_INDEX);
+	UINT newVertexCount = 0;
+	for (UINT64 i = 0, size = indices.size(); i < size; ++i)
+	{
+		UINT& index = indices[i];
+		if (remap[index] == INVALID_INDEX)
+		{
+			remap[index] = newVertexCount++;
+		}
+		index = remap[index];
+	}
+
+	std::vector<Vertex> newVertices(newVertexCount);
+	std::vector<SkinnedVertex> newSkinnedVertices(bSKINNED ? newVertexCount : 0);
+	for (UINT i = 0; i < VERTEX_COUNT; ++i)
+	{
+		const UINT NEW_INDEX = remap[i];
+		if (NEW_INDEX == INVALID_INDEX)
+		{
+			continue;
+		}
+
+		newVertices[NEW_INDEX] = vertices[i];
+		if (bSKINNED)
+		{
+			newSkinnedVertices[NEW_INDEX] = skinnedVertices[i];
+		}
+	}
+
+	vertices.swap(newVertices);
+	skinnedVertices.swap(newSkinnedVertices);
+}
+
+void OptimizeMesh(MeshInfo* pMeshInfo, const MeshOptimizeSettings& SETTINGS, MeshOptimizeReport* pOutReport)
+{
+	_ASSERT(pMeshInfo);
+	_ASSERT(pMeshInfo->Indices.size() % 3 == 0);
+	_ASSERT(pMeshInfo->SkinnedVertices.empty() || pMeshInfo->SkinnedVertices.size() == pMeshInfo->Vertices.size());
+	_ASSERT(pMeshInfo->LODIndices.empty()); // vertex  ٲǷ LOD   .
+
+	std::vector<UINT>& indices = pMeshInfo->Indices;
+
+	MeshOptimizeReport report = {};
+	report.SourceVertexCount = (UINT)pMeshInfo->Vertices.size();
+	GetVertexCacheStats(indices, report.SourceVertexCount, SETTINGS.CacheSize, &report.ACMRBefore, &report.ATVRBefore);
+
+	if (!pMeshInfo->Vertices.empty() && !indices.empty())
+	{
+		WeldVertices(pMeshInfo);
+		report.DegenerateTriangleCount = RemoveDegenerateTriangles(indices);
+
+		OptimizeVertexCache(&indices, (UINT)pMeshInfo->Vertices.size());
+		if (SETTINGS.bOptimizeOverdraw)
+		{
+			report.ClusterCount = OptimizeOverdraw(indices, pMeshInfo->Vertices, SETTINGS);
+		}
+		OptimizeVertexFetch(pMeshInfo);
+	}
+
+	report.WeldedVertexCount = (UINT)pMeshInfo->Vertices.size();
+	report.TriangleCount = (UINT)(indices.size() / 3);
+	GetVertexCacheStats(indices, report.WeldedVertexCount, SETTINGS.CacheSize, &report.ACMRAfter, &report.ATVRAfter);
+
+	if (pOutReport)
+	{
+		*pOutReport = report;
+	}
+}
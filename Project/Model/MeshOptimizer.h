@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+#include "MeshInfo.h"
+
+// import  mesh index, vertex  GPU ° ġ.
+// 1.  vertex (ü byte hash). 2. post-transform cache (Forsyth). 3. overdraw  cluster . 4. vertex fetch  ġ.
+// tangent   ȣ. Vertices SkinnedVertices   Բ ġ.
+
+struct MeshOptimizeSettings
+{
+	UINT CacheSize = 16;		   //  cluster ҿ  FIFO cache ũ.
+	float OverdrawThreshold = 1.05f; // cluster   ACMR     .
+	bool bOptimizeOverdraw = true;
+};
+
+struct MeshOptimizeReport
+{
+	UINT SourceVertexCount;
+	UINT WeldedVertexCount;
+	UINT TriangleCount;
+	UINT DegenerateTriangleCount; //   ŵ ﰢ.
+	UINT ClusterCount;			  // overdraw  .  ʾ 0.
+	float ACMRBefore;			  // ﰢ  cache miss.
+	float ACMRAfter;
+	float ATVRBefore;			  // vertex  cache miss. 1 ּ.
+	float ATVRAfter;
+};
+
+// pOutReport nullptr .
+void OptimizeMesh(MeshInfo* pMeshInfo, const MeshOptimizeSettings& SETTINGS, MeshOptimizeReport* pOutReport);
+
+// index  Forsyth  ġ. vertex ״. LOD indexó vertex buffer ϴ .
+void OptimizeVertexCache(std::vector<UINT>* pIndices, const UINT VERTEX_COUNT);
+
+// FIFO cache 䳻  ACMR, ATVR .
+void GetVertexCacheStats(const std::vector<UINT>& INDICES, const UINT VERTEX_COUNT, const UINT CACHE_SIZE, float* pOutACMR, float* pOutATVR);
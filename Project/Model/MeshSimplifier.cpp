@@ -0,0 +1,779 @@
+#include "../pch.h"
+#include <algorithm>
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+
+static const UINT INVALID_INDEX = 0xffffffff;
+
+enum eSimplifyVertexKind
+{
+	SimplifyVertexKind_Manifold = 0, // .  ̿ε ĥ  .
+	SimplifyVertexKind_Border,		 //  .  edge 󼭸.
+	SimplifyVertexKind_Seam,		 //  ġ attribute ٸ vertex  . seam edge    ű.
+	SimplifyVertexKind_Locked
+};
+
+//  Ÿ   . p^T A p + 2 b^T p + c.
+struct Quadric
+{
+	double A00, A01, A02, A11, A12, A22;
+	double B0, B1, B2;
+	double C;
+	double Weight;
+};
+
+// key(vertex Ǵ ġ) -> ﰢ .
+struct TriangleAdjacency
+{
+	std::vector<UINT> Offsets;
+	std::vector<UINT> Triangles;
+};
+
+struct CollapseCandidate
+{
+	float Cost;
+	UINT From;
+	UINT To;
+	UINT SiblingFrom; // seam ݴ.  INVALID_INDEX.
+	UINT SiblingTo;
+};
+
+struct SimplifyContext
+{
+	const MeshInfo* pMeshInfo;
+	MeshSimplifySettings Settings;
+	UINT VertexCount;
+	bool bSkinned;
+	float Radius;
+	float MaxCost; //  collapse   ū . Ÿ .
+	UINT LockedVertexCount;
+
+	std::vector<UINT> PositionRemap; //  ġ ù vertex.
+	std::vector<UINT> WedgeNext;	 //  ġ vertex  .
+	std::vector<BYTE> Kinds;		 // vertex.  ġ  .
+	std::vector<Quadric> Quadrics;	 // ġ(PositionRemap) .
+	std::vector<UINT> Indices;		 //  ܰ.
+
+	TriangleAdjacency PositionAdjacency;
+	TriangleAdjacency VertexAdjacency;
+	std::vector<CollapseCandidate> Candidates;
+	std::vector<UINT> CollapseRemap;
+	std::vector<BYTE> Locks;
+};
+
+static void MakePlaneQuadric(const Vector3& NORMAL, const float D, const float WEIGHT, Quadric* pOut)
+{
+	const double X = NORMAL.x;
+	const double Y = NORMAL.y;
+	const double Z = NORMAL.z;
+	const double W = WEIGHT;
+
+	pOut->A00 = W * X * X;
+	pOut->A01 = W * X * Y;
+	pOut->A02 = W * X * Z;
+	pOut->A11 = W * Y * Y;
+	pOut->A12 = W * Y * Z;
+	pOut->A22 = W * Z * Z;
+	pOut->B0 = W * X * D;
+	pOut->B1 = W * Y * D;
+	pOut->B2 = W * Z * D;
+	pOut->C = W * (double)D * D;
+	pOut->Weight = W;
+}
+
+static void AddQuadric(Quadric* pDest, const Quadric& SRC)
+{
+	pDest->A00 += SRC.A00;
+	pDest->A01 += SRC.A01;
+	pDest->A02 += SRC.A02;
+	pDest->A11 += SRC.A11;
+	pDest->A12 += SRC.A12;
+	pDest->A22 += SRC.A22;
+	pDest->B0 += SRC.B0;
+	pDest->B1 += SRC.B1;
+	pDest->B2 += SRC.B2;
+	pDest->C += SRC.C;
+	pDest->Weight += SRC.Weight;
+}
+
+//   Ÿ .
+static float EvaluateQuadric(const Quadric& Q, const Vector3& P)
+{
+	const double X = P.x;
+	const double Y = P.y;
+	const double Z = P.z;
+
+	const double ERROR = Q.A00 * X * X + Q.A11 * Y * Y + Q.A22 * Z * Z +
+						 2.0 * (Q.A01 * X * Y + Q.A02 * X * Z + Q.A12 * Y * Z) +
+						 2.0 * (Q.B0 * X + Q.B1 * Y + Q.B2 * Z) + Q.C;
+	if (ERROR <= 0.0 || Q.Weight <= 0.0)
+	{
+		return 0.0f;
+	}
+	return (float)(ERROR / Q.Weight);
+}
+
+//  vertex bone weight ٸ . 0̸  1̸ ġ bone .
+static float GetSkinWeightDistance(const SkinnedVertex& A, const SkinnedVertex& B)
+{
+	float distance = 0.0f;
+
+	for (UINT i = 0; i < 8; ++i)
+	{
+		if (A.BlendWeights[i] <= 0.0f)
+		{
+			continue;
+		}
+
+		float weightB = 0.0f;
+		for (UINT j = 0; j < 8; ++j)
+		{
+			if (B.BlendWeights[j] > 0.0f && B.BoneIndices[j] == A.BoneIndices[i])
+			{
+				weightB += B.BlendWeights[j];
+			}
+		}
+		distance += fabs(A.BlendWeights[i] - weightB);
+	}
+
+	for (UINT i = 0; i < 8; ++i)
+	{
+		if (B.BlendWeights[i] <= 0.0f)
+		{
+			continue;
+		}
+
+		bool bSHARED = false;
+		for (UINT j = 0; j < 8; ++j)
+		{
+			if (A.BlendWeights[j] > 0.0f && A.BoneIndices[j] == B.BoneIndices[i])
+			{
+				bSHARED = true;
+				break;
+			}
+		}
+		if (!bSHARED)
+		{
+			distance += B.BlendWeights[i];
+		}
+	}
+
+	return distance * 0.5f;
+}
+
+static inline UINT GetKey(const UINT* pKEY_MAP, const UINT INDEX)
+{
+	return (pKEY_MAP ? pKEY_MAP[INDEX] : INDEX);
+}
+
+static void BuildAdjacency(const std::vector<UINT>& INDICES, const UINT KEY_COUNT, const UINT* pKEY_MAP, TriangleAdjacency* pOut)
+{
+	const UINT TRIANGLE_COUNT = (UINT)(INDICES.size() / 3);
+
+	pOut->Offsets.assign(KEY_COUNT + 1, 0);
+	for (UINT64 i = 0, size = INDICES.size(); i < size; ++i)
+	{
+		++pOut->Offsets[GetKey(pKEY_MAP, INDICES[i]) + 1];
+	}
+	for (UINT i = 0; i < KEY_COUNT; ++i)
+	{
+		pOut->Offsets[i + 1] += pOut->Offsets[i];
+	}
+
+	pOut->Triangles.resize(INDICES.size());
+	std::vector<UINT> fillCounts(KEY_COUNT, 0);
+	for (UINT i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		for (UINT j = 0; j < 3; ++j)
+		{
+			const UINT KEY = GetKey(pKEY_MAP, INDICES[i * 3 + j]);
+			pOut->Triangles[pOut->Offsets[KEY] + fillCounts[KEY]++] = i;
+		}
+	}
+}
+
+// A, B   ﰢ . 1̸ , 2  edge,  ̸̻ پü.
+static UINT CountSharedTriangles(const TriangleAdjacency& ADJACENCY, const std::vector<UINT>& INDICES, const UINT* pKEY_MAP, const UINT A, const UINT B)
+{
+	UINT count = 0;
+	for (UINT i = ADJACENCY.Offsets[A], end = ADJACENCY.Offsets[A + 1]; i < end; ++i)
+	{
+		const UINT TRIANGLE = ADJACENCY.Triangles[i];
+		for (UINT j = 0; j < 3; ++j)
+		{
+			if (GetKey(pKEY_MAP, INDICES[TRIANGLE * 3 + j]) == B)
+			{
+				++count;
+				break;
+			}
+		}
+	}
+	return count;
+}
+
+static const Vector3& GetPosition(const SimplifyContext& CONTEXT, const UINT VERTEX)
+{
+	return CONTEXT.pMeshInfo->Vertices[VERTEX].Position;
+}
+
+// ġ   vertex  ﰢ .
+static void RemovePositionDegenerates(SimplifyContext* pContext)
+{
+	std::vector<UINT>& indices = pContext->Indices;
+	const UINT* pREMAP = pContext->PositionRemap.data();
+	const UINT64 TRIANGLE_COUNT = indices.size() / 3;
+	UINT64 writeIndex = 0;
+
+	for (UINT64 i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		const UINT A = indices[i * 3];
+		const UINT B = indices[i * 3 + 1];
+		const UINT C = indices[i * 3 + 2];
+		if (pREMAP[A] == pREMAP[B] || pREMAP[B] == pREMAP[C] || pREMAP[C] == pREMAP[A])
+		{
+			continue;
+		}
+
+		indices[writeIndex++] = A;
+		indices[writeIndex++] = B;
+		indices[writeIndex++] = C;
+	}
+	indices.resize(writeIndex);
+}
+
+static void BuildPositionRemap(SimplifyContext* pContext)
+{
+	const std::vector<Vertex>& VERTICES = pContext->pMeshInfo->Vertices;
+	const UINT VERTEX_COUNT = pContext->VertexCount;
+
+	UINT tableSize = 1;
+	while (tableSize < VERTEX_COUNT * 2)
+	{
+		tableSize <<= 1;
+	}
+	std::vector<UINT> table(tableSize, INVALID_INDEX);
+
+	pContext->PositionRemap.resize(VERTEX_COUNT);
+	pContext->WedgeNext.resize(VERTEX_COUNT);
+	for (UINT i = 0; i < VERTEX_COUNT; ++i)
+	{
+		const Vector3& POSITION = VERTICES[i].Position;
+		UINT hash = 2166136261u;
+		const BYTE* pBYTES = (const BYTE*)&POSITION;
+		for (UINT j = 0; j < sizeof(Vector3); ++j)
+		{
+			hash ^= pBYTES[j];
+			hash *= 16777619u;
+		}
+
+		UINT slot = hash & (tableSize - 1);
+		while (table[slot] != INVALID_INDEX && memcmp(&VERTICES[table[slot]].Position, &POSITION, sizeof(Vector3)) != 0)
+		{
+			slot = (slot + 1) & (tableSize - 1);
+		}
+
+		if (table[slot] == INVALID_INDEX)
+		{
+			table[slot] = i;
+			pContext->PositionRemap[i] = i;
+			pContext->WedgeNext[i] = i;
+		}
+		else
+		{
+			//  Ͽ  .
+			const UINT FIRST = table[slot];
+			pContext->PositionRemap[i] = FIRST;
+			pContext->WedgeNext[i] = pContext->WedgeNext[FIRST];
+			pContext->WedgeNext[FIRST] = i;
+		}
+	}
+}
+
+static void ClassifyVertices(SimplifyContext* pContext)
+{
+	const std::vector<UINT>& INDICES = pContext->Indices;
+	const UINT* pREMAP = pContext->PositionRemap.data();
+	const TriangleAdjacency& ADJACENCY = pContext->PositionAdjacency;
+	const UINT VERTEX_COUNT = pContext->VertexCount;
+
+	pContext->Kinds.assign(VERTEX_COUNT, SimplifyVertexKind_Locked);
+	pContext->LockedVertexCount = 0;
+
+	for (UINT i = 0; i < VERTEX_COUNT; ++i)
+	{
+		if (pREMAP[i] != i || ADJACENCY.Offsets[i] == ADJACENCY.Offsets[i + 1])
+		{
+			continue;
+		}
+
+		UINT wedgeCount = 1;
+		for (UINT wedge = pContext->WedgeNext[i]; wedge != i; wedge = pContext->WedgeNext[wedge])
+		{
+			++wedgeCount;
+		}
+
+		UINT borderEdgeCount = 0;
+		bool bNonManifold = false;
+		for (UINT j = ADJACENCY.Offsets[i], end = ADJACENCY.Offsets[i + 1]; j < end; ++j)
+		{
+			const UINT TRIANGLE = ADJACENCY.Triangles[j];
+			for (UINT k = 0; k < 3; ++k)
+			{
+				const UINT OTHER = pREMAP[INDICES[TRIANGLE * 3 + k]];
+				if (OTHER == i)
+				{
+					continue;
+				}
+
+				const UINT SHARED_COUNT = CountSharedTriangles(ADJACENCY, INDICES, pREMAP, i, OTHER);
+				if (SHARED_COUNT == 1)
+				{
+					++borderEdgeCount;
+				}
+				else if (SHARED_COUNT > 2)
+				{
+					bNonManifold = true;
+				}
+			}
+		}
+
+		BYTE kind = SimplifyVertexKind_Locked;
+		if (!bNonManifold)
+		{
+			if (wedgeCount == 1)
+			{
+				kind = (borderEdgeCount == 0 ? SimplifyVertexKind_Manifold : (borderEdgeCount == 2 ? SimplifyVertexKind_Border : SimplifyVertexKind_Locked));
+			}
+			else if (wedgeCount == 2 && borderEdgeCount == 0)
+			{
+				kind = SimplifyVertexKind_Seam;
+			}
+		}
+
+		UINT wedge = i;
+		do
+		{
+			pContext->Kinds[wedge] = kind;
+			wedge = pContext->WedgeNext[wedge];
+		} while (wedge != i);
+
+		if (kind == SimplifyVertexKind_Locked)
+		{
+			++pContext->LockedVertexCount;
+		}
+	}
+}
+
+// 鸶  quadric. , seam edge 鿡        ʰ .
+static void InitQuadrics(SimplifyContext* pContext)
+{
+	const std::vector<UINT>& INDICES = pContext->Indices;
+	const UINT* pREMAP = pContext->PositionRemap.data();
+	const UINT TRIANGLE_COUNT = (UINT)(INDICES.size() / 3);
+
+	pContext->Quadrics.assign(pContext->VertexCount, Quadric());
+	for (UINT i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		const UINT* pTRIANGLE = &INDICES[i * 3];
+		const Vector3& P0 = GetPosition(*pContext, pTRIANGLE[0]);
+		const Vector3& P1 = GetPosition(*pContext, pTRIANGLE[1]);
+		const Vector3& P2 = GetPosition(*pContext, pTRIANGLE[2]);
+
+		Vector3 normal = (P1 - P0).Cross(P2 - P0);
+		const float LENGTH = normal.Length();
+		if (LENGTH <= 0.0f)
+		{
+			continue;
+		}
+		normal /= LENGTH;
+
+		Quadric planeQuadric;
+		MakePlaneQuadric(normal, -normal.Dot(P0), LENGTH * 0.5f, &planeQuadric);
+		for (UINT j = 0; j < 3; ++j)
+		{
+			AddQuadric(&pContext->Quadrics[pREMAP[pTRIANGLE[j]]], planeQuadric);
+		}
+
+		for (UINT j = 0; j < 3; ++j)
+		{
+			const UINT A = pTRIANGLE[j];
+			const UINT B = pTRIANGLE[(j + 1) % 3];
+			if (CountSharedTriangles(pContext->VertexAdjacency, INDICES, nullptr, A, B) != 1)
+			{
+				continue;
+			}
+
+			const Vector3& PA = GetPosition(*pContext, A);
+			const Vector3 EDGE = GetPosition(*pContext, B) - PA;
+			Vector3 borderNormal = EDGE.Cross(normal);
+			borderNormal.Normalize();
+
+			Quadric borderQuadric;
+			MakePlaneQuadric(borderNormal, -borderNormal.Dot(PA), pContext->Settings.BorderWeight * EDGE.LengthSquared(), &borderQuadric);
+			AddQuadric(&pContext->Quadrics[pREMAP[A]], borderQuadric);
+			AddQuadric(&pContext->Quadrics[pREMAP[B]], borderQuadric);
+		}
+	}
+}
+
+static void InitContext(SimplifyContext* pContext, const MeshInfo& MESH_INFO, const std::vector<UINT>& SOURCE_INDICES, const MeshSimplifySettings& SETTINGS)
+{
+	_ASSERT(SOURCE_INDICES.size() % 3 == 0);
+	_ASSERT(MESH_INFO.SkinnedVertices.empty() || MESH_INFO.SkinnedVertices.size() == MESH_INFO.Vertices.size());
+
+	pContext->pMeshInfo = &MESH_INFO;
+	pContext->Settings = SETTINGS;
+	pContext->VertexCount = (UINT)MESH_INFO.Vertices.size();
+	pContext->bSkinned = !MESH_INFO.SkinnedVertices.empty();
+	pContext->MaxCost = 0.0f;
+	pContext->Indices = SOURCE_INDICES;
+
+	BuildPositionRemap(pContext);
+	RemovePositionDegenerates(pContext);
+
+	Vector3 minCorner(FLT_MAX);
+	Vector3 maxCorner(-FLT_MAX);
+	for (UINT64 i = 0, size = pContext->Indices.size(); i < size; ++i)
+	{
+		const Vector3& POSITION = GetPosition(*pContext, pContext->Indices[i]);
+		minCorner = Vector3::Min(minCorner, POSITION);
+		maxCorner = Vector3::Max(maxCorner, POSITION);
+	}
+	pContext->Radius = (pContext->Indices.empty() ? 1.0f : (maxCorner - minCorner).Length() * 0.5f);
+	if (pContext->Radius <= 0.0f)
+	{
+		pContext->Radius = 1.0f;
+	}
+
+	BuildAdjacency(pContext->Indices, pContext->VertexCount, pContext->PositionRemap.data(), &pContext->PositionAdjacency);
+	BuildAdjacency(pContext->Indices, pContext->VertexCount, nullptr, &pContext->VertexAdjacency);
+	ClassifyVertices(pContext);
+	InitQuadrics(pContext);
+}
+
+// FROM TO ĥ    seam ݴ ¦ .
+static bool GetCollapseCost(const SimplifyContext& CONTEXT, const UINT FROM, const UINT TO, CollapseCandidate* pOut)
+{
+	const std::vector<UINT>& INDICES = CONTEXT.Indices;
+	const UINT* pREMAP = CONTEXT.PositionRemap.data();
+	const UINT FROM_POSITION = pREMAP[FROM];
+	const UINT TO_POSITION = pREMAP[TO];
+
+	pOut->SiblingFrom = INVALID_INDEX;
+	pOut->SiblingTo = INVALID_INDEX;
+
+	switch (CONTEXT.Kinds[FROM])
+	{
+		case SimplifyVertexKind_Manifold:
+			break;
+
+		case SimplifyVertexKind_Border:
+			if (CountSharedTriangles(CONTEXT.PositionAdjacency, INDICES, pREMAP, FROM_POSITION, TO_POSITION) != 1)
+			{
+				return false;
+			}
+			break;
+
+		case SimplifyVertexKind_Seam:
+		{
+			if (CONTEXT.Kinds[TO] != SimplifyVertexKind_Seam && CONTEXT.Kinds[TO] != SimplifyVertexKind_Locked)
+			{
+				return false;
+			}
+			//   vertex  (seam)̾ .
+			if (CountSharedTriangles(CONTEXT.VertexAdjacency, INDICES, nullptr, FROM, TO) != 1)
+			{
+				return false;
+			}
+
+			// ݴ vertex  seam  TO ġ ٸ vertex.
+			const UINT SIBLING_FROM = CONTEXT.WedgeNext[FROM];
+			for (UINT wedge = CONTEXT.WedgeNext[TO]; wedge != TO; wedge = CONTEXT.WedgeNext[wedge])
+			{
+				if (CountSharedTriangles(CONTEXT.VertexAdjacency, INDICES, nullptr, SIBLING_FROM, wedge) == 1)
+				{
+					pOut->SiblingFrom = SIBLING_FROM;
+					pOut->SiblingTo = wedge;
+					break;
+				}
+			}
+			if (pOut->SiblingFrom == INVALID_INDEX)
+			{
+				return false;
+			}
+		}
+		break;
+
+		default:
+			return false;
+	}
+
+	Quadric quadric = CONTEXT.Quadrics[FROM_POSITION];
+	AddQuadric(&quadric, CONTEXT.Quadrics[TO_POSITION]);
+
+	const Vertex& FROM_VERTEX = CONTEXT.pMeshInfo->Vertices[FROM];
+	const Vertex& TO_VERTEX = CONTEXT.pMeshInfo->Vertices[TO];
+	const float EDGE_LENGTH_SQUARE = (FROM_VERTEX.Position - TO_VERTEX.Position).LengthSquared();
+
+	float penalty = CONTEXT.Settings.NormalWeight * (1.0f - FROM_VERTEX.Normal.Dot(TO_VERTEX.Normal));
+	if (CONTEXT.bSkinned)
+	{
+		penalty += CONTEXT.Settings.SkinWeight * GetSkinWeightDistance(CONTEXT.pMeshInfo->SkinnedVertices[FROM], CONTEXT.pMeshInfo->SkinnedVertices[TO]);
+	}
+
+	pOut->Cost = EvaluateQuadric(quadric, TO_VERTEX.Position) + EDGE_LENGTH_SQUARE * penalty;
+	pOut->From = FROM;
+	pOut->To = TO;
+	return true;
+}
+
+// FROM ġ TO ġ Ű   ﰢ    ִ.
+static bool IsCollapseFlipping(const SimplifyContext& CONTEXT, const UINT FROM_POSITION, const UINT TO_POSITION)
+{
+	const std::vector<UINT>& INDICES = CONTEXT.Indices;
+	const UINT* pREMAP = CONTEXT.PositionRemap.data();
+	const TriangleAdjacency& ADJACENCY = CONTEXT.PositionAdjacency;
+	const Vector3& NEW_POSITION = GetPosition(CONTEXT, TO_POSITION);
+
+	for (UINT i = ADJACENCY.Offsets[FROM_POSITION], end = ADJACENCY.Offsets[FROM_POSITION + 1]; i < end; ++i)
+	{
+		const UINT* pTRIANGLE = &INDICES[ADJACENCY.Triangles[i] * 3];
+		if (pREMAP[pTRIANGLE[0]] == TO_POSITION || pREMAP[pTRIANGLE[1]] == TO_POSITION || pREMAP[pTRIANGLE[2]] == TO_POSITION)
+		{
+			continue; //  ﰢ.
+		}
+
+		Vector3 pPositions[3];
+		Vector3 cornerNormal;
+		for (UINT j = 0; j < 3; ++j)
+		{
+			pPositions[j] = GetPosition(CONTEXT, pTRIANGLE[j]);
+			cornerNormal += CONTEXT.pMeshInfo->Vertices[pTRIANGLE[j]].Normal;
+		}
+		const Vector3 OLD_NORMAL = (pPositions[1] - pPositions[0]).Cross(pPositions[2] - pPositions[0]);
+
+		for (UINT j = 0; j < 3; ++j)
+		{
+			if (pREMAP[pTRIANGLE[j]] == FROM_POSITION)
+			{
+				pPositions[j] = NEW_POSITION;
+			}
+		}
+		const Vector3 NEW_NORMAL = (pPositions[1] - pPositions[0]).Cross(pPositions[2] - pPositions[0]);
+
+		// 60 Ѱ ư  .  ﰢ    .
+		// pass ŵϸ ݾ ư  vertex normal     Ȯ.
+		if (OLD_NORMAL.Dot(NEW_NORMAL) <= 0.5f * OLD_NORMAL.Length() * NEW_NORMAL.Length() ||
+			(OLD_NORMAL.Dot(cornerNormal) > 0.0f) != (NEW_NORMAL.Dot(cornerNormal) > 0.0f))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//   ġ ʴ collapse     óϴ pass ݺ.
+//  pass ȿ ģ vertex ֺ ᰡ ξ  ˻簡  ġ  ʰ .
+static void SimplifyContextTo(SimplifyContext* pContext, const UINT TARGET_TRIANGLE_COUNT, const float MAX_ERROR)
+{
+	std::vector<UINT>& indices = pContext->Indices;
+	const UINT* pREMAP = pContext->PositionRemap.data();
+	const float MAX_COST = (MAX_ERROR * pContext->Radius) * (MAX_ERROR * pContext->Radius);
+	UINT triangleCount = (UINT)(indices.size() / 3);
+
+	while (triangleCount > TARGET_TRIANGLE_COUNT)
+	{
+		BuildAdjacency(indices, pContext->VertexCount, pREMAP, &pContext->PositionAdjacency);
+		BuildAdjacency(indices, pContext->VertexCount, nullptr, &pContext->VertexAdjacency);
+
+		std::vector<CollapseCandidate>& candidates = pContext->Candidates;
+		candidates.clear();
+		for (UINT i = 0; i < triangleCount; ++i)
+		{
+			for (UINT j = 0; j < 3; ++j)
+			{
+				const UINT A = indices[i * 3 + j];
+				const UINT B = indices[i * 3 + (j + 1) % 3];
+
+				CollapseCandidate forward;
+				CollapseCandidate backward;
+				const bool bFORWARD = GetCollapseCost(*pContext, A, B, &forward);
+				const bool bBACKWARD = GetCollapseCost(*pContext, B, A, &backward);
+				if (bFORWARD && (!bBACKWARD || forward.Cost <= backward.Cost))
+				{
+					candidates.push_back(forward);
+				}
+				else if (bBACKWARD)
+				{
+					candidates.push_back(backward);
+				}
+			}
+		}
+		if (candidates.empty())
+		{
+			break;
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const CollapseCandidate& A, const CollapseCandidate& B) { return A.Cost < B.Cost; });
+
+		std::vector<UINT>& collapseRemap = pContext->CollapseRemap;
+		std::vector<BYTE>& locks = pContext->Locks;
+		collapseRemap.resize(pContext->VertexCount);
+		for (UINT i = 0; i < pContext->VertexCount; ++i)
+		{
+			collapseRemap[i] = i;
+		}
+		locks.assign(pContext->VertexCount, 0);
+
+		UINT collapseCount = 0;
+		for (UINT64 i = 0, size = candidates.size(); i < size && triangleCount > TARGET_TRIANGLE_COUNT; ++i)
+		{
+			const CollapseCandidate& CANDIDATE = candidates[i];
+			if (CANDIDATE.Cost > MAX_COST)
+			{
+				break;
+			}
+
+			const UINT FROM_POSITION = pREMAP[CANDIDATE.From];
+			const UINT TO_POSITION = pREMAP[CANDIDATE.To];
+			if (locks[FROM_POSITION] || locks[TO_POSITION] || IsCollapseFlipping(*pContext, FROM_POSITION, TO_POSITION))
+			{
+				continue;
+			}
+
+			collapseRemap[CANDIDATE.From] = CANDIDATE.To;
+			if (CANDIDATE.SiblingFrom != INVALID_INDEX)
+			{
+				collapseRemap[CANDIDATE.SiblingFrom] = CANDIDATE.SiblingTo;
+			}
+			AddQuadric(&pContext->Quadrics[TO_POSITION], pContext->Quadrics[FROM_POSITION]);
+			pContext->MaxCost = (CANDIDATE.Cost > pContext->MaxCost ? CANDIDATE.Cost : pContext->MaxCost);
+
+			const TriangleAdjacency& ADJACENCY = pContext->PositionAdjacency;
+			for (UINT j = ADJACENCY.Offsets[FROM_POSITION], end = ADJACENCY.Offsets[FROM_POSITION + 1]; j < end; ++j)
+			{
+				const UINT* pTRIANGLE = &indices[ADJACENCY.Triangles[j] * 3];
+				bool bREMOVED = false;
+				for (UINT k = 0; k < 3; ++k)
+				{
+					locks[pREMAP[pTRIANGLE[k]]] = 1;
+					bREMOVED |= (pREMAP[pTRIANGLE[k]] == TO_POSITION);
+				}
+				if (bREMOVED)
+				{
+					--triangleCount;
+				}
+			}
+			++collapseCount;
+		}
+
+		if (collapseCount == 0)
+		{
+			break;
+		}
+
+		for (UINT64 i = 0, size = indices.size(); i < size; ++i)
+		{
+			indices[i] = collapseRemap[indices[i]];
+		}
+		RemovePositionDegenerates(pContext);
+		triangleCount = (UINT)(indices.size() / 3);
+	}
+}
+
+void SimplifyMesh(const MeshInfo& MESH_INFO, const std::vector<UINT>& SOURCE_INDICES, const UINT TARGET_TRIANGLE_COUNT, const MeshSimplifySettings& SETTINGS,
+				  std::vector<UINT>* pOutIndices, MeshSimplifyReport* pOutReport)
+{
+	_ASSERT(pOutIndices);
+
+	SimplifyContext context;
+	InitContext(&context, MESH_INFO, SOURCE_INDICES, SETTINGS);
+	SimplifyContextTo(&context, TARGET_TRIANGLE_COUNT, SETTINGS.MaxError);
+
+	pOutIndices->swap(context.Indices);
+
+	if (pOutReport)
+	{
+		pOutReport->SourceTriangleCount = (UINT)(SOURCE_INDICES.size() / 3);
+		pOutReport->TriangleCount = (UINT)(pOutIndices->size() / 3);
+		pOutReport->LockedVertexCount = context.LockedVertexCount;
+		pOutReport->Error = sqrtf(context.MaxCost) / context.Radius;
+	}
+}
+
+void GenerateMeshLODs(MeshInfo* pMeshInfo, const MeshLODSettings& SETTINGS, MeshLODReport* pOutReport)
+{
+	_ASSERT(pMeshInfo);
+	_ASSERT(SETTINGS.LODCount <= MAX_MESH_LOD_COUNT);
+
+	MeshLODReport report = {};
+	report.LODCount = 1;
+	report.pTriangleCounts[0] = (UINT)(pMeshInfo->Indices.size() / 3);
+
+	pMeshInfo->LODIndices.clear();
+
+	//  ܰ  quadric ̾ ޾  .  ׻ LOD0 .
+	SimplifyContext context;
+	InitContext(&context, *pMeshInfo, pMeshInfo->Indices, SETTINGS.Simplify);
+
+	UINT prevTriangleCount = report.pTriangleCounts[0];
+	for (UINT level = 1; level < SETTINGS.LODCount; ++level)
+	{
+		if (prevTriangleCount <= SETTINGS.MinTriangleCount)
+		{
+			break;
+		}
+
+		const UINT TARGET = (UINT)((float)prevTriangleCount * SETTINGS.TriangleRatio);
+		SimplifyContextTo(&context, (TARGET > SETTINGS.MinTriangleCount ? TARGET : SETTINGS.MinTriangleCount), SETTINGS.pMaxErrors[level]);
+
+		const UINT TRIANGLE_COUNT = (UINT)(context.Indices.size() / 3);
+		if (TRIANGLE_COUNT == 0 || (float)TRIANGLE_COUNT > (float)prevTriangleCount * SETTINGS.MinReduction)
+		{
+			break;
+		}
+
+		pMeshInfo->LODIndices.push_back(context.Indices);
+		OptimizeVertexCache(&pMeshInfo->LODIndices.back(), context.VertexCount);
+
+		report.pTriangleCounts[level] = TRIANGLE_COUNT;
+		report.pErrors[level] = sqrtf(context.MaxCost) / context.Radius;
+		report.LODCount = level + 1;
+		prevTriangleCount = TRIANGLE_COUNT;
+	}
+
+	if (pOutReport)
+	{
+		*pOutReport = report;
+	}
+}
+
+float GetProjectedScreenSize(const Vector3& CENTER, const float RADIUS, const Vector3& EYE_POS, const Matrix& PROJECTION)
+{
+	//  ̸ _34 1,  0. _22   Ÿ.
+	if (PROJECTION._34 == 0.0f)
+	{
+		return RADIUS * PROJECTION._22;
+	}
+
+	const float DISTANCE = (CENTER - EYE_POS).Length();
+	return RADIUS * PROJECTION._22 / (DISTANCE > RADIUS ? DISTANCE : RADIUS);
+}
+
+UINT SelectMeshLOD(const float SCREEN_SIZE, const UINT CURRENT_LEVEL, const UINT LOD_COUNT, const MeshLODSelectSettings& SETTINGS)
+{
+	UINT level = 0;
+	while (level + 1 < LOD_COUNT && SCREEN_SIZE < SETTINGS.pLevelScreenSizes[level + 1])
+	{
+		++level;
+	}
+
+	//   ڼ ܰ ư  踦 Hysteresisŭ  Ѿ .
+	while (level < CURRENT_LEVEL && SCREEN_SIZE < SETTINGS.pLevelScreenSizes[level + 1] * (1.0f + SETTINGS.Hysteresis))
+	{
+		++level;
+	}
+
+	return level;
+}
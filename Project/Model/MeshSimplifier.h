@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include "MeshInfo.h"
+
+// quadric error metric(Garland, Heckbert)  edge collapse LOD index .
+// vertex ̿ vertex ϳ ġ⸸ ϹǷ(half-edge collapse)  LOD LOD0 vertex buffer  .
+// uv, normal seam( ġ ٸ vertex)     󼭸 پ. skinned mesh bone weight ̸ 뿡 .
+
+struct MeshSimplifySettings
+{
+	float MaxError = 0.02f;		// mesh    .  ǥ ﰢ   ĵ .
+	float NormalWeight = 0.5f;	// ġ  vertex normal (1 - cos) * edge ^2 ġ.
+	float SkinWeight = 1.0f;	// bone weight (0 ~ 1) * edge ^2 ġ.
+	float BorderWeight = 10.0f; // , seam     quadric ġ.
+};
+
+struct MeshSimplifyReport
+{
+	UINT SourceTriangleCount;
+	UINT TriangleCount;
+	UINT LockedVertexCount; //  ʴ vertex.  seam  , پü .
+	float Error;			//  .  collapse   ū .
+};
+
+// SOURCE_INDICES(MESH_INFO vertex Ŵ) TARGET_TRIANGLE_COUNT ó . pOutReport nullptr .
+void SimplifyMesh(const MeshInfo& MESH_INFO, const std::vector<UINT>& SOURCE_INDICES, const UINT TARGET_TRIANGLE_COUNT, const MeshSimplifySettings& SETTINGS,
+				  std::vector<UINT>* pOutIndices, MeshSimplifyReport* pOutReport);
+
+struct MeshLODSettings
+{
+	UINT LODCount = MAX_MESH_LOD_COUNT; // LOD0 .
+	float TriangleRatio = 0.5f;			// ܰ踶  ܰ  ǥ ﰢ .
+	float MinReduction = 0.85f;			//  ܰ      ܰ  .
+	UINT MinTriangleCount = 32;
+	// ܰ躰  . Ʒ MeshLODSelectSettings ȭ ũ⿡ 뷫 1 pixel.
+	float pMaxErrors[MAX_MESH_LOD_COUNT] = { 0.0f, 0.005f, 0.01f, 0.02f, 0.04f };
+	MeshSimplifySettings Simplify;
+};
+
+struct MeshLODReport
+{
+	UINT LODCount;
+	UINT pTriangleCounts[MAX_MESH_LOD_COUNT];
+	float pErrors[MAX_MESH_LOD_COUNT]; //  .
+};
+
+// pMeshInfo->LODIndices ٽ ä. LOD0 vertex  ״ ΰ LOD index cache  .
+void GenerateMeshLODs(MeshInfo* pMeshInfo, const MeshLODSettings& SETTINGS, MeshLODReport* pOutReport);
+
+struct MeshLODSelectSettings
+{
+	// ȭ   bounding sphere  ̺  ش ܰ. [0]  .
+	float pLevelScreenSizes[MAX_MESH_LOD_COUNT] = { 0.0f, 0.4f, 0.2f, 0.1f, 0.05f };
+	float Hysteresis = 0.1f; // ڼ ܰ ƿ  躸  ŭ  Ŀ .
+};
+
+// ȭ   sphere  .  ƴϸ Ÿ .
+float GetProjectedScreenSize(const Vector3& CENTER, const float RADIUS, const Vector3& EYE_POS, const Matrix& PROJECTION);
+UINT SelectMeshLOD(const float SCREEN_SIZE, const UINT CURRENT_LEVEL, const UINT LOD_COUNT, const MeshLODSelectSettings& SETTINGS);
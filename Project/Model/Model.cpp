@@ -167,6 +167,8 @@ void Model::Initialize(Renderer* pRenderer, const std::vector<MeshInfo>& MESH_IN
 
 	initBoundingBox(MESH_INFOS);
 	initBoundingSphere(MESH_INFOS);
+
+	UpdateMaterialTables();
 }
 
 void Model::InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH_INFO, Mesh* pNewMesh)
@@ -186,14 +188,7 @@ void Model::InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH_INFO, Mesh
 	BREAK_IF_FAILED(hr);
 	pNewMesh->Vertex.Count = (UINT)MESH_INFO.Vertices.size();
 
-	// Create index buffer.
-	hr = pResourceManager->CreateIndexBuffer(sizeof(UINT),
-											 (UINT)MESH_INFO.Indices.size(),
-											 &pNewMesh->Index.IndexBufferView,
-											 &pNewMesh->Index.pBuffer,
-											 (void*)MESH_INFO.Indices.data());
-	BREAK_IF_FAILED(hr);
-	pNewMesh->Index.Count = (UINT)MESH_INFO.Indices.size();
+	initIndexBuffer(pResourceManager, MESH_INFO, pNewMesh);
 }
 
 void Model::UpdateWorld(const Matrix& WORLD)
@@ -205,6 +200,7 @@ void Model::UpdateWorld(const Matrix& WORLD)
 	// bounding box, sphere ġ Ʈ.
 	BoundingSphere.Center = World.Translation();
 	BoundingBox.Center = BoundingSphere.Center;
+	bIsBoundsDirty = true;
 
 	MeshConstant& boxMeshConstantData = m_pBoundingBoxMesh->MeshConstantData;
 	MeshConstant& sphereMeshConstantData = m_pBoundingSphereMesh->MeshConstantData;
@@ -227,6 +223,113 @@ void Model::UpdateWorld(const Matrix& WORLD)
 	}
 }
 
+UINT Model::GetRenderCost()
+{
+	// draw call ϳ   ﰢ 256  .
+	const UINT DRAW_CALL_COST = 256;
+
+	UINT cost = 0;
+	for (UINT64 i = 0, size = Meshes.size(); i < size; ++i)
+	{
+		UINT indexStart;
+		UINT indexCount;
+		Meshes[i]->GetLODIndexRange(LODLevel, &indexStart, &indexCount);
+		cost += DRAW_CALL_COST + indexCount / 3;
+	}
+
+	// skinning vertex shader  bone  ε尡 ߰ǹǷ ġ .
+	if (ModelType == RenderObjectType_SkinnedType)
+	{
+		cost *= 2;
+	}
+
+	return (cost ? cost : 1);
+}
+
+UINT Model::GetMaterialSortID()
+{
+	if (Meshes.empty())
+	{
+		return 0;
+	}
+
+	// ù mesh texture handle ּҵ  .  texture ̸  .
+	const Material* pMATERIAL = &Meshes[0]->Material;
+	const TextureHandle* const ppTEXTURES[7] =
+	{
+		pMATERIAL->pAlbedo, pMATERIAL->pEmissive, pMATERIAL->pNormal, pMATERIAL->pHeight,
+		pMATERIAL->pAmbientOcclusion, pMATERIAL->pMetallic, pMATERIAL->pRoughness,
+	};
+
+	UINT64 hash = 14695981039346656037ull;
+	for (UINT i = 0; i < 7; ++i)
+	{
+		hash ^= (UINT64)ppTEXTURES[i];
+		hash *= 1099511628211ull;
+	}
+
+	return (UINT)(hash ^ (hash >> 32));
+}
+
+UINT Model::UpdateMaterialTables()
+{
+	_ASSERT(m_pRenderer);
+
+	ResourceManager* pResourceManager = m_pRenderer->GetResourceManager();
+	ShaderVisibleDescriptorHeap* pDescriptorHeap = m_pRenderer->GetShaderVisibleDescriptorHeap();
+	ID3D12Device5* pDevice = m_pRenderer->GetD3DDevice();
+	const UINT CBV_SRV_DESCRIPTOR_SIZE = pResourceManager->CBVSRVUAVDescriptorSize;
+
+	UINT copiedDescriptorCount = 0;
+
+	for (UINT64 i = 0, size = Meshes.size(); i < size; ++i)
+	{
+		Mesh* pCurMesh = Meshes[i];
+		const Material* pMATERIAL = &pCurMesh->Material;
+
+		if (pCurMesh->MaterialTableIndex != INVALID_MATERIAL_TABLE_INDEX && 
+			memcmp(pMATERIAL, &pCurMesh->BoundMaterial, sizeof(Material)) == 0)
+		{
+			continue;
+		}
+
+		//  table GPU а   Ƿ  ʰ  table .
+		if (pCurMesh->MaterialTableIndex != INVALID_MATERIAL_TABLE_INDEX)
+		{
+			pDescriptorHeap->FreePersistentTable(pCurMesh->MaterialTableIndex);
+			pCurMesh->MaterialTableIndex = INVALID_MATERIAL_TABLE_INDEX;
+		}
+
+		D3D12_CPU_DESCRIPTOR_HANDLE cpuTable = {};
+		if (!pDescriptorHeap->AllocPersistentTable(&pCurMesh->MaterialTableIndex, &cpuTable, &pCurMesh->MaterialTableGPUHandle))
+		{
+			__debugbreak();
+			pCurMesh->MaterialTableIndex = INVALID_MATERIAL_TABLE_INDEX;
+			continue;
+		}
+
+		// t0 ~ t5, t6 .  texture null srv ä.
+		const TextureHandle* const ppTEXTURES[MATERIAL_DESCRIPTOR_COUNT] =
+		{
+			pMATERIAL->pAlbedo, pMATERIAL->pEmissive, pMATERIAL->pNormal, pMATERIAL->pAmbientOcclusion,
+			pMATERIAL->pMetallic, pMATERIAL->pRoughness, pMATERIAL->pHeight,
+		};
+
+		CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(cpuTable);
+		for (UINT j = 0; j < MATERIAL_DESCRIPTOR_COUNT; ++j)
+		{
+			const D3D12_CPU_DESCRIPTOR_HANDLE SRC_HANDLE = (ppTEXTURES[j] ? ppTEXTURES[j]->SRVHandle : pResourceManager->NullSRVDescriptor);
+			pDevice->CopyDescriptorsSimple(1, dstHandle, SRC_HANDLE, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+			dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
+		}
+		copiedDescriptorCount += MATERIAL_DESCRIPTOR_COUNT;
+
+		pCurMesh->BoundMaterial = *pMATERIAL;
+	}
+
+	return copiedDescriptorCount;
+}
+
 void Model::Render(eRenderPSOType psoSetting)
 {
 	_ASSERT(m_pRenderer);
@@ -249,7 +352,6 @@ void Model::Render(eRenderPSOType psoSetting)
 	{
 		Mesh* pCurMesh = Meshes[i];
 
-		Material* pMeshMaterialTextures = &pCurMesh->Material;
 		MeshConstant* pMeshConstantData = &pCurMesh->MeshConstantData;
 		MaterialConstant* pMaterialConstantData = &pCurMesh->MaterialConstantData;
 		CBInfo* pMeshCB = pMeshConstantBufferPool->AllocCB();
@@ -269,7 +371,7 @@ void Model::Render(eRenderPSOType psoSetting)
 			case RenderPSOType_ReflectionDefault:
 			case RenderPSOType_ReflectionSkybox:
 			{
-				hr = pDynamicDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 9);
+				hr = pDynamicDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 2);
 				BREAK_IF_FAILED(hr);
 
 				CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(cpuDescriptorTable, 0, CBV_SRV_DESCRIPTOR_SIZE);
@@ -278,80 +380,12 @@ void Model::Render(eRenderPSOType psoSetting)
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMaterialCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t0 ~ t5
-				if (pMeshMaterialTextures->pAlbedo)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAlbedo->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pEmissive)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pEmissive->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pNormal)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pNormal->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pAmbientOcclusion)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAmbientOcclusion->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pMetallic)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pMetallic->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pRoughness)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pRoughness->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t6
-				if (pMeshMaterialTextures->pHeight)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pHeight->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
 
 				pCommandList->SetGraphicsRootDescriptorTable(0, gpuDescriptorTable);
+
+				// t0 ~ t6. ̸   material table ״ .
+				_ASSERT(pCurMesh->MaterialTableIndex != INVALID_MATERIAL_TABLE_INDEX);
+				pCommandList->SetGraphicsRootDescriptorTable(3, pCurMesh->MaterialTableGPUHandle);
 			}
 			break;
 
@@ -380,9 +414,13 @@ void Model::Render(eRenderPSOType psoSetting)
 				break;
 		}
 
+		UINT indexStart;
+		UINT indexCount;
+		pCurMesh->GetLODIndexRange(LODLevel, &indexStart, &indexCount);
+
 		pCommandList->IASetVertexBuffers(0, 1, &pCurMesh->Vertex.VertexBufferView);
 		pCommandList->IASetIndexBuffer(&(pCurMesh->Index.IndexBufferView));
-		pCommandList->DrawIndexedInstanced(pCurMesh->Index.Count, 1, 0, 0, 0);
+		pCommandList->DrawIndexedInstanced(indexCount, 1, indexStart, 0, 0);
 	}
 }
 
@@ -407,7 +445,6 @@ void Model::Render(UINT threadIndex, ID3D12GraphicsCommandList* pCommandList, Dy
 	{
 		Mesh* pCurMesh = Meshes[i];
 
-		Material* pMeshMaterialTextures = &pCurMesh->Material;
 		MeshConstant* pMeshConstantData = &pCurMesh->MeshConstantData;
 		MaterialConstant* pMaterialConstantData = &pCurMesh->MaterialConstantData;
 		CBInfo* pMeshCB = pMeshConstantBufferPool->AllocCB();
@@ -427,7 +464,7 @@ void Model::Render(UINT threadIndex, ID3D12GraphicsCommandList* pCommandList, Dy
 			case RenderPSOType_ReflectionDefault:
 			case RenderPSOType_ReflectionSkybox:
 			{
-				hr = pDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 9);
+				hr = pDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 2);
 				BREAK_IF_FAILED(hr);
 
 				CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(cpuDescriptorTable, 0, CBV_SRV_DESCRIPTOR_SIZE);
@@ -436,80 +473,12 @@ void Model::Render(UINT threadIndex, ID3D12GraphicsCommandList* pCommandList, Dy
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMaterialCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t0 ~ t5
-				if (pMeshMaterialTextures->pAlbedo)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAlbedo->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pEmissive)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pEmissive->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pNormal)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pNormal->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pAmbientOcclusion)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAmbientOcclusion->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pMetallic)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pMetallic->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pRoughness)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pRoughness->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t6
-				if (pMeshMaterialTextures->pHeight)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pHeight->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
 
 				pCommandList->SetGraphicsRootDescriptorTable(0, gpuDescriptorTable);
+
+				// t0 ~ t6. ̸   material table ״ .
+				_ASSERT(pCurMesh->MaterialTableIndex != INVALID_MATERIAL_TABLE_INDEX);
+				pCommandList->SetGraphicsRootDescriptorTable(3, pCurMesh->MaterialTableGPUHandle);
 			}
 			break;
 
@@ -538,9 +507,13 @@ void Model::Render(UINT threadIndex, ID3D12GraphicsCommandList* pCommandList, Dy
 				break;
 		}
 
+		UINT indexStart;
+		UINT indexCount;
+		pCurMesh->GetLODIndexRange(LODLevel, &indexStart, &indexCount);
+
 		pCommandList->IASetVertexBuffers(0, 1, &pCurMesh->Vertex.VertexBufferView);
 		pCommandList->IASetIndexBuffer(&(pCurMesh->Index.IndexBufferView));
-		pCommandList->DrawIndexedInstanced(pCurMesh->Index.Count, 1, 0, 0, 0);
+		pCommandList->DrawIndexedInstanced(indexCount, 1, indexStart, 0, 0);
 	}
 }
 
@@ -664,11 +637,18 @@ void Model::Cleanup()
 	}
 
 	TextureManager* pTextureManager = m_pRenderer->GetTextureManager();
+	ShaderVisibleDescriptorHeap* pDescriptorHeap = m_pRenderer->GetShaderVisibleDescriptorHeap();
 	for (UINT64 i = 0, size = Meshes.size(); i < size; ++i)
 	{
 		Mesh** pMesh = &Meshes[i];
 		Material* pMaterial = &(*pMesh)->Material;
 
+		if ((*pMesh)->MaterialTableIndex != INVALID_MATERIAL_TABLE_INDEX && pDescriptorHeap)
+		{
+			pDescriptorHeap->FreePersistentTable((*pMesh)->MaterialTableIndex);
+			(*pMesh)->MaterialTableIndex = INVALID_MATERIAL_TABLE_INDEX;
+		}
+
 		if (pMaterial->pAlbedo)
 		{
 			pTextureManager->DeleteTexture(pMaterial->pAlbedo);
@@ -711,6 +691,49 @@ void Model::Cleanup()
 	Meshes.clear();
 }
 
+void Model::initIndexBuffer(ResourceManager* pResourceManager, const MeshInfo& MESH_INFO, Mesh* pNewMesh)
+{
+	_ASSERT(pResourceManager);
+	_ASSERT(pNewMesh);
+
+	HRESULT hr = S_OK;
+
+	pNewMesh->LODCount = 1;
+	pNewMesh->pLODIndexStarts[0] = 0;
+	pNewMesh->pLODIndexCounts[0] = (UINT)MESH_INFO.Indices.size();
+
+	if (MESH_INFO.LODIndices.empty())
+	{
+		hr = pResourceManager->CreateIndexBuffer(sizeof(UINT),
+												 (UINT)MESH_INFO.Indices.size(),
+												 &pNewMesh->Index.IndexBufferView,
+												 &pNewMesh->Index.pBuffer,
+												 (void*)MESH_INFO.Indices.data());
+	}
+	else
+	{
+		std::vector<UINT> indices(MESH_INFO.Indices);
+		for (UINT64 i = 0, size = MESH_INFO.LODIndices.size(); i < size && pNewMesh->LODCount < MAX_MESH_LOD_COUNT; ++i)
+		{
+			const std::vector<UINT>& LOD_INDICES = MESH_INFO.LODIndices[i];
+
+			pNewMesh->pLODIndexStarts[pNewMesh->LODCount] = (UINT)indices.size();
+			pNewMesh->pLODIndexCounts[pNewMesh->LODCount] = (UINT)LOD_INDICES.size();
+			++pNewMesh->LODCount;
+
+			indices.insert(indices.end(), LOD_INDICES.begin(), LOD_INDICES.end());
+		}
+
+		hr = pResourceManager->CreateIndexBuffer(sizeof(UINT),
+												 (UINT)indices.size(),
+												 &pNewMesh->Index.IndexBufferView,
+												 &pNewMesh->Index.pBuffer,
+												 (void*)indices.data());
+	}
+	BREAK_IF_FAILED(hr);
+	pNewMesh->Index.Count = (UINT)MESH_INFO.Indices.size();
+}
+
 void Model::initBoundingBox(const std::vector<MeshInfo>& MESH_INFOS)
 {
 	BoundingBox = getBoundingBox(MESH_INFOS[0].Vertices);
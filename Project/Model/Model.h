@@ -22,6 +22,14 @@ public:
 	virtual void InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH_INFO, Mesh* pNewMesh);
 
 	virtual void UpdateWorld(const Matrix& WORLD);
+
+	// render queue load balancing cost. (per draw call overhead + triangle count)
+	UINT GetRenderCost();
+	// render queue state sort key. models sharing the same textures get the same id.
+	UINT GetMaterialSortID();
+	// rebuild persistent material descriptor tables whose textures changed. main thread only.
+	// returns copied descriptor count.
+	UINT UpdateMaterialTables();
 	
 	virtual void Render(eRenderPSOType psoSetting);
 	virtual void Render(UINT threadIndex, ID3D12GraphicsCommandList* pCommandList, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, ResourceManager* pManager, int psoSetting);
@@ -31,6 +39,9 @@ public:
 	virtual void Cleanup();
 
 protected:
+	// LOD index LOD0 ڿ ̾ ٿ index buffer ϳ .
+	void initIndexBuffer(ResourceManager* pResourceManager, const MeshInfo& MESH_INFO, Mesh* pNewMesh);
+
 	void initBoundingBox(const std::vector<MeshInfo>& MESH_INFOS);
 	void initBoundingSphere(const std::vector<MeshInfo>& MESH_INFOS);
 
@@ -50,9 +61,12 @@ public:
 
 	eRenderObjectType ModelType = RenderObjectType_DefaultType;
 
+	UINT LODLevel = 0; // Renderer::selectMeshLODs  frame . mesh  ܰ  ߸.
+
 	bool bIsVisible = true;
 	bool bCastShadow = true;
 	bool bIsPickable = false;
+	bool bIsBoundsDirty = true; // set when world bounds move. cleared by scene BVH refit.
 
 protected:
 	Renderer* m_pRenderer = nullptr;
@@ -8,9 +8,48 @@
 #include <locale>
 #include "../pch.h"
 #include "../Util/Utility.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
 #include "ModelLoader.h"
 
+static const UINT IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices | aiProcess_ConvertToLeftHanded;
+
+static const aiScene* ReadScene(Assimp::Importer* pImporter, const std::string& FILE_PATH, const BYTE* pDATA, const UINT64 SIZE)
+{
+	if (!pDATA)
+	{
+		return pImporter->ReadFile(FILE_PATH, IMPORT_FLAGS);
+	}
+
+	// ޸𸮿   Ȯڷ format .
+	std::string extension;
+	size_t extOffset = FILE_PATH.rfind('.');
+	if (extOffset != std::string::npos)
+	{
+		extension = FILE_PATH.substr(extOffset + 1);
+	}
+	return pImporter->ReadFileFromMemory(pDATA, (size_t)SIZE, IMPORT_FLAGS, extension.c_str());
+}
+
 HRESULT ModelLoader::Load(std::wstring& basePath, std::wstring& fileName, bool _bRevertNormal)
+{
+	HRESULT hr = LoadFromMemory(basePath, fileName, nullptr, 0, _bRevertNormal);
+	if (SUCCEEDED(hr))
+	{
+		OptimizeMeshes();
+		GenerateLODs();
+		UpdateTangents();
+	}
+
+	return hr;
+}
+
+HRESULT ModelLoader::LoadAnimation(std::wstring& basePath, std::wstring& fileName)
+{
+	return LoadAnimationFromMemory(basePath, fileName, nullptr, 0);
+}
+
+HRESULT ModelLoader::LoadFromMemory(std::wstring& basePath, std::wstring& fileName, const BYTE* pDATA, const UINT64 SIZE, bool _bRevertNormal)
 {
 	HRESULT hr = S_OK;
 	
@@ -24,7 +63,7 @@ HRESULT ModelLoader::Load(std::wstring& basePath, std::wstring& fileName, bool _
 	szBasePath = std::string(basePath.begin(), basePath.end());
 
 	Assimp::Importer importer;
-	const aiScene* pSCENE = importer.ReadFile(szBasePath + fileNameA, aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices | aiProcess_ConvertToLeftHanded);
+	const aiScene* pSCENE = ReadScene(&importer, szBasePath + fileNameA, pDATA, SIZE);
 
 	if (pSCENE)
 	{
@@ -56,8 +95,6 @@ HRESULT ModelLoader::Load(std::wstring& basePath, std::wstring& fileName, bool _
 		{
 			readAnimation(pSCENE);
 		}
-
-		updateTangents();
 	}
 	else
 	{
@@ -72,7 +109,7 @@ HRESULT ModelLoader::Load(std::wstring& basePath, std::wstring& fileName, bool _
 	return hr;
 }
 
-HRESULT ModelLoader::LoadAnimation(std::wstring& basePath, std::wstring& fileName)
+HRESULT ModelLoader::LoadAnimationFromMemory(std::wstring& basePath, std::wstring& fileName, const BYTE* pDATA, const UINT64 SIZE)
 {
 	HRESULT hr = S_OK;
 
@@ -80,7 +117,7 @@ HRESULT ModelLoader::LoadAnimation(std::wstring& basePath, std::wstring& fileNam
 	szBasePath = std::string(basePath.begin(), basePath.end());
 
 	Assimp::Importer importer;
-	const aiScene* pSCENE = importer.ReadFile(szBasePath + fileNameA, aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices | aiProcess_ConvertToLeftHanded);
+	const aiScene* pSCENE = ReadScene(&importer, szBasePath + fileNameA, pDATA, SIZE);
 
 	if (pSCENE && pSCENE->HasAnimations())
 	{
@@ -465,7 +502,44 @@ LB_RET:
 	return hr;
 }
 
-void ModelLoader::updateTangents()
+void ModelLoader::OptimizeMeshes()
+{
+	MeshOptimizeSettings settings;
+
+	for (UINT64 i = 0, size = MeshInfos.size(); i < size; ++i)
+	{
+		MeshOptimizeReport report;
+		OptimizeMesh(&MeshInfos[i], settings, &report);
+
+		char szDebugString[256];
+		sprintf_s(szDebugString, 256, "Mesh %llu: %u -> %u vertices, %u triangles (%u degenerate removed), %u clusters. ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+				  i, report.SourceVertexCount, report.WeldedVertexCount, report.TriangleCount, report.DegenerateTriangleCount, report.ClusterCount,
+				  report.ACMRBefore, report.ACMRAfter, report.ATVRBefore, report.ATVRAfter);
+		OutputDebugStringA(szDebugString);
+	}
+}
+
+void ModelLoader::GenerateLODs()
+{
+	MeshLODSettings settings;
+
+	for (UINT64 i = 0, size = MeshInfos.size(); i < size; ++i)
+	{
+		MeshLODReport report;
+		GenerateMeshLODs(&MeshInfos[i], settings, &report);
+
+		char szDebugString[256];
+		int length = sprintf_s(szDebugString, 256, "Mesh %llu: %u LODs.", i, report.LODCount);
+		for (UINT lod = 0; lod < report.LODCount; ++lod)
+		{
+			length += sprintf_s(szDebugString + length, 256 - length, " [%u] %u tris (error %.4f)", lod, report.pTriangleCounts[lod], report.pErrors[lod]);
+		}
+		sprintf_s(szDebugString + length, 256 - length, "\n");
+		OutputDebugStringA(szDebugString);
+	}
+}
+
+void ModelLoader::UpdateTangents()
 {
 	for (UINT64 i = 0, size = MeshInfos.size(); i < size; ++i)
 	{
@@ -18,6 +18,17 @@ public:
 	HRESULT Load(std::wstring& basePath, std::wstring& fileName, bool _bRevertNormal);
 	HRESULT LoadAnimation(std::wstring& basePath, std::wstring& fileName);
 
+	// ̸ о    import. pDATA nullptr̸ Ͽ  .
+	// tangent  Ƿ ʿϸ UpdateTangents  ȣ.
+	HRESULT LoadFromMemory(std::wstring& basePath, std::wstring& fileName, const BYTE* pDATA, const UINT64 SIZE, bool _bRevertNormal);
+	HRESULT LoadAnimationFromMemory(std::wstring& basePath, std::wstring& fileName, const BYTE* pDATA, const UINT64 SIZE);
+
+	// vertex , cache/overdraw  ġ. UpdateTangents  ȣ.
+	void OptimizeMeshes();
+	// mesh LOD index (MeshInfo::LODIndices). OptimizeMeshes  ȣ.
+	void GenerateLODs();
+	void UpdateTangents();
+
 protected:
 	void findDeformingBones(const aiScene* pSCENE);
 	const aiNode* findParent(const aiNode* pNODE);
@@ -30,7 +41,6 @@ protected:
 	void readAnimation(const aiScene* pSCENE);
 	HRESULT readTextureFileName(const aiScene* pSCENE, aiMaterial* pMaterial, aiTextureType type, std::wstring* pDst);
 
-	void updateTangents();
 	void updateBoneIDs(aiNode* pNode, int* pCounter);
 
 	void calculateTangentBitangent(const Vertex& V1, const Vertex& V2, const Vertex& V3, DirectX::XMFLOAT3* pTangent, DirectX::XMFLOAT3* pBitangent);
@@ -0,0 +1,227 @@
+#include "../pch.h"
+#include "AnimationData.h"
+#include "RootMotion.h"
+
+static void SampleRootKey(const std::vector<AnimationClip::Key>& KEYS, const double TICK, Vector3* pOutPosition, Quaternion* pOutRotation)
+{
+	_ASSERT(!KEYS.empty());
+
+	const UINT64 KEY_SIZE = KEYS.size();
+	if (KEY_SIZE == 1 || TICK <= KEYS[0].Time)
+	{
+		*pOutPosition = KEYS[0].Position;
+		*pOutRotation = KEYS[0].Rotation;
+		return;
+	}
+	if (TICK >= KEYS[KEY_SIZE - 1].Time)
+	{
+		*pOutPosition = KEYS[KEY_SIZE - 1].Position;
+		*pOutRotation = KEYS[KEY_SIZE - 1].Rotation;
+		return;
+	}
+
+	// import   ̹Ƿ  Ž .
+	UINT64 low = 0;
+	UINT64 high = KEY_SIZE - 1;
+	while (high - low > 1)
+	{
+		const UINT64 MID = (low + high) / 2;
+		if (KEYS[MID].Time <= TICK)
+		{
+			low = MID;
+		}
+		else
+		{
+			high = MID;
+		}
+	}
+
+	const AnimationClip::Key& CUR_KEY = KEYS[low];
+	const AnimationClip::Key& NEXT_KEY = KEYS[high];
+	const float FACTOR = (float)((TICK - CUR_KEY.Time) / (NEXT_KEY.Time - CUR_KEY.Time));
+
+	*pOutPosition = Vector3::Lerp(CUR_KEY.Position, NEXT_KEY.Position, FACTOR);
+	*pOutRotation = Quaternion::Slerp(CUR_KEY.Rotation, NEXT_KEY.Rotation, FACTOR);
+	pOutRotation->Normalize();
+}
+
+void ExtractRootMotion(const AnimationClip& CLIP, const Matrix& ROOT_TO_MODEL, RootMotionTrack* pOutTrack)
+{
+	_ASSERT(pOutTrack);
+
+	const int ROOT_BONE_ID = 0;
+
+	pOutTrack->DeltaPositions.clear();
+	pOutTrack->DeltaYaws.clear();
+	pOutTrack->Duration = CLIP.Duration;
+	pOutTrack->TicksPerSec = CLIP.TicksPerSec;
+
+	if (CLIP.Keys.empty() || CLIP.Keys[ROOT_BONE_ID].empty() || CLIP.Duration <= 0.0)
+	{
+		return;
+	}
+
+	const std::vector<AnimationClip::Key>& KEYS = CLIP.Keys[ROOT_BONE_ID];
+
+	//  y root θ . ǥ谡  ȯ̸ ȸ ⵵ ݴ.
+	Matrix modelToRoot = ROOT_TO_MODEL.Invert();
+	modelToRoot.Translation(Vector3(0.0f));
+	Vector3 upAxis = Vector3::TransformNormal(Vector3::UnitY, modelToRoot);
+	upAxis.Normalize();
+	const float HANDEDNESS = (ROOT_TO_MODEL.Determinant() < 0.0f ? -1.0f : 1.0f);
+
+	const UINT SEGMENT_COUNT = (UINT)ceil(CLIP.Duration);
+	pOutTrack->DeltaPositions.resize(SEGMENT_COUNT);
+	pOutTrack->DeltaYaws.resize(SEGMENT_COUNT);
+
+	Vector3 prevPosition;
+	Quaternion prevRotation;
+	SampleRootKey(KEYS, 0.0, &prevPosition, &prevRotation);
+
+	for (UINT i = 0; i < SEGMENT_COUNT; ++i)
+	{
+		const double END_TICK = (i + 1 < SEGMENT_COUNT ? (double)(i + 1) : CLIP.Duration);
+
+		Vector3 position;
+		Quaternion rotation;
+		SampleRootKey(KEYS, END_TICK, &position, &rotation);
+
+		Vector3 deltaPosition = Vector3::TransformNormal(position - prevPosition, ROOT_TO_MODEL);
+		deltaPosition.y = 0.0f; // ̴ controller ߷ .
+		pOutTrack->DeltaPositions[i] = deltaPosition;
+
+		// θ  ȸ ȭ rotation * prev^-1 up  ѷ twist.
+		Quaternion inversePrevRotation;
+		prevRotation.Inverse(inversePrevRotation);
+		const Quaternion DELTA = Quaternion::Concatenate(rotation, inversePrevRotation);
+		const float TWIST = DELTA.x * upAxis.x + DELTA.y * upAxis.y + DELTA.z * upAxis.z;
+		float deltaYaw = 2.0f * atan2f(TWIST, DELTA.w);
+		if (deltaYaw > DirectX::XM_PI)
+		{
+			deltaYaw -= DirectX::XM_2PI;
+		}
+		else if (deltaYaw < -DirectX::XM_PI)
+		{
+			deltaYaw += DirectX::XM_2PI;
+		}
+		pOutTrack->DeltaYaws[i] = deltaYaw * HANDEDNESS;
+
+		prevPosition = position;
+		prevRotation = rotation;
+	}
+}
+
+void SampleRootMotion(const RootMotionTrack& TRACK, double startTick, double tickCount, Vector3* pOutDeltaPosition, float* pOutDeltaYaw)
+{
+	_ASSERT(pOutDeltaPosition);
+	_ASSERT(pOutDeltaYaw);
+
+	*pOutDeltaPosition = Vector3(0.0f);
+	*pOutDeltaYaw = 0.0f;
+
+	if (!TRACK.IsValid() || tickCount <= 0.0)
+	{
+		return;
+	}
+
+	const double DURATION = TRACK.Duration;
+	const double EPSILON = 1e-9;
+	const UINT SEGMENT_COUNT = (UINT)TRACK.DeltaPositions.size();
+
+	double tick = fmod(startTick, DURATION);
+	if (tick < 0.0)
+	{
+		tick += DURATION;
+	}
+
+	//  ϳ ġ ŭ .
+	while (tickCount > EPSILON)
+	{
+		UINT segment = (UINT)tick;
+		segment = (segment < SEGMENT_COUNT ? segment : SEGMENT_COUNT - 1);
+
+		const double SEGMENT_START = (double)segment;
+		const double SEGMENT_END = (segment + 1 < SEGMENT_COUNT ? SEGMENT_START + 1.0 : DURATION);
+		const double SEGMENT_LENGTH = SEGMENT_END - SEGMENT_START;
+
+		double taken = SEGMENT_END - tick;
+		taken = (taken < tickCount ? taken : tickCount);
+
+		if (SEGMENT_LENGTH > EPSILON)
+		{
+			const float RATIO = (float)(taken / SEGMENT_LENGTH);
+			*pOutDeltaPosition += TRACK.DeltaPositions[segment] * RATIO;
+			*pOutDeltaYaw += TRACK.DeltaYaws[segment] * RATIO;
+		}
+
+		tick += taken;
+		tickCount -= taken;
+		if (tick >= DURATION - EPSILON)
+		{
+			tick = 0.0;
+		}
+	}
+}
+
+void LocomotionIntegrator::Initialize(const float FIXED_STEP, const UINT MAX_STEP_PER_FRAME, const Vector3& POSITION)
+{
+	_ASSERT(FIXED_STEP > 0.0f);
+	_ASSERT(MAX_STEP_PER_FRAME > 0);
+
+	m_FixedStep = FIXED_STEP;
+	m_MaxStepPerFrame = MAX_STEP_PER_FRAME;
+	m_Accumulator = 0.0f;
+	m_StepCount = 0;
+	m_PrevPosition = POSITION;
+	m_CurPosition = POSITION;
+}
+
+UINT LocomotionIntegrator::BeginFrame(const float DELTA_TIME)
+{
+	m_Accumulator += (DELTA_TIME > 0.0f ? DELTA_TIME : 0.0f);
+
+	UINT stepCount = (UINT)(m_Accumulator / m_FixedStep);
+	if (stepCount > m_MaxStepPerFrame)
+	{
+		stepCount = m_MaxStepPerFrame;
+		m_Accumulator = (float)stepCount * m_FixedStep;
+	}
+	m_Accumulator -= (float)stepCount * m_FixedStep;
+	m_Accumulator = (m_Accumulator > 0.0f ? m_Accumulator : 0.0f);
+
+	return stepCount;
+}
+
+void LocomotionIntegrator::Step(const RootMotionTrack* pTRACK, const Quaternion& ROTATION, Vector3* pOutDisplacement, float* pOutDeltaYaw)
+{
+	_ASSERT(pOutDisplacement);
+	_ASSERT(pOutDeltaYaw);
+
+	*pOutDisplacement = Vector3(0.0f);
+	*pOutDeltaYaw = 0.0f;
+
+	if (pTRACK && pTRACK->IsValid())
+	{
+		// step ȣ ð ٽ ϹǷ frame Ұ   .
+		const double START_TICK = (double)m_StepCount * (double)m_FixedStep * pTRACK->TicksPerSec;
+		const double TICK_COUNT = (double)m_FixedStep * pTRACK->TicksPerSec;
+
+		Vector3 localDelta;
+		SampleRootMotion(*pTRACK, START_TICK, TICK_COUNT, &localDelta, pOutDeltaYaw);
+		*pOutDisplacement = Vector3::Transform(localDelta, ROTATION);
+	}
+
+	++m_StepCount;
+}
+
+void LocomotionIntegrator::EndStep(const Vector3& POSITION)
+{
+	m_PrevPosition = m_CurPosition;
+	m_CurPosition = POSITION;
+}
+
+Vector3 LocomotionIntegrator::GetRenderPosition() const
+{
+	const float ALPHA = m_Accumulator / m_FixedStep;
+	return Vector3::Lerp(m_PrevPosition, m_CurPosition, ALPHA);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <directxtk12/SimpleMath.h>
+#include <vector>
+
+// clip import  root bone ̾  ̵   locomotion .
+// ̵ frame ȣ ƴ϶ ð(tick)θ ϹǷ frame rate .
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Quaternion;
+
+struct AnimationClip;
+
+struct RootMotionTrack
+{
+	// [i] tick i i + 1( Duration) ȭ.  ǥ,  и.
+	std::vector<Vector3> DeltaPositions;
+	std::vector<float> DeltaYaws; // y ȸ(radian).
+	double Duration = 0.0;		  // tick.
+	double TicksPerSec = 0.0;
+
+	inline bool IsValid() const { return !DeltaPositions.empty() && Duration > 0.0 && TicksPerSec > 0.0; }
+};
+
+// CLIP root key(bone 0) tick  ȭ . ROOT_TO_MODEL root θ  ->  .
+// root key   ȣ.
+void ExtractRootMotion(const AnimationClip& CLIP, const Matrix& ROOT_TO_MODEL, RootMotionTrack* pOutTrack);
+
+// START_TICK TICK_COUNTŭ  ȭ. Duration ó ư  .
+void SampleRootMotion(const RootMotionTrack& TRACK, double startTick, double tickCount, Vector3* pOutDeltaPosition, float* pOutDeltaYaw);
+
+//   root motion . ׸   step ġ  ð  .
+class LocomotionIntegrator
+{
+public:
+	LocomotionIntegrator() = default;
+	~LocomotionIntegrator() = default;
+
+	void Initialize(const float FIXED_STEP, const UINT MAX_STEP_PER_FRAME, const Vector3& POSITION);
+
+	// ̹ frame  step . ѵ Ѵ ð   frame  и ʰ .
+	UINT BeginFrame(const float DELTA_TIME);
+
+	// step ϳ world . pTRACK nullptr 0. ROTATION ĳ world ȸ.
+	void Step(const RootMotionTrack* pTRACK, const Quaternion& ROTATION, Vector3* pOutDisplacement, float* pOutDeltaYaw);
+	// controller  Ű ġ step .
+	void EndStep(const Vector3& POSITION);
+
+	// ׸ ġ.  step  step  .
+	Vector3 GetRenderPosition() const;
+
+	inline float GetFixedStep() const { return m_FixedStep; }
+	inline UINT64 GetStepCount() const { return m_StepCount; }
+	inline const Vector3& GetPosition() const { return m_CurPosition; }
+
+private:
+	float m_FixedStep = 1.0f / 60.0f;
+	float m_Accumulator = 0.0f;
+	UINT m_MaxStepPerFrame = 8;
+	UINT64 m_StepCount = 0; // ùķ̼ ð = m_StepCount * m_FixedStep.
+
+	Vector3 m_PrevPosition;
+	Vector3 m_CurPosition;
+};
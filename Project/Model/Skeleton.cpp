@@ -0,0 +1,199 @@
+#include "../pch.h"
+#include "AnimationData.h"
+#include "Skeleton.h"
+
+static std::string GetShortBoneName(const std::string& NAME)
+{
+	const UINT64 POS = NAME.rfind(':');
+	return (POS == std::string::npos ? NAME : NAME.substr(POS + 1));
+}
+
+static Vector3 DivideScale(const Vector3& A, const Vector3& B)
+{
+	const float EPSILON = 1e-6f;
+	return Vector3(fabs(B.x) > EPSILON ? A.x / B.x : 1.0f,
+				   fabs(B.y) > EPSILON ? A.y / B.y : 1.0f,
+				   fabs(B.z) > EPSILON ? A.z / B.z : 1.0f);
+}
+
+void Skeleton::Initialize(const AnimationData& ANIM_DATA)
+{
+	const UINT64 BONE_COUNT = ANIM_DATA.BoneIDToNames.size();
+	_ASSERT(ANIM_DATA.BoneParents.size() == BONE_COUNT);
+	_ASSERT(ANIM_DATA.NodeTransforms.size() == BONE_COUNT);
+
+	BoneNames = ANIM_DATA.BoneIDToNames;
+	BoneParents = ANIM_DATA.BoneParents;
+	RestPositions.resize(BONE_COUNT);
+	RestRotations.resize(BONE_COUNT);
+	RestScales.resize(BONE_COUNT);
+	RestGlobalRotations.resize(BONE_COUNT);
+	TotalBoneLength = 0.0f;
+
+	m_NameToID.clear();
+	m_ShortNameToID.clear();
+
+	for (UINT64 boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		Matrix nodeTransform = ANIM_DATA.NodeTransforms[boneID];
+		nodeTransform.Decompose(RestScales[boneID], RestRotations[boneID], RestPositions[boneID]);
+
+		// updateBoneIDs Ʈ  ID űǷ θ ̹ .
+		const int PARENT_ID = BoneParents[boneID];
+		_ASSERT(PARENT_ID < (int)boneID);
+		if (PARENT_ID >= 0)
+		{
+			RestGlobalRotations[boneID] = Quaternion::Concatenate(RestGlobalRotations[PARENT_ID], RestRotations[boneID]);
+			TotalBoneLength += RestPositions[boneID].Length();
+		}
+		else
+		{
+			RestGlobalRotations[boneID] = RestRotations[boneID];
+		}
+
+		m_NameToID[BoneNames[boneID]] = (int)boneID;
+
+		const std::string SHORT_NAME = GetShortBoneName(BoneNames[boneID]);
+		auto iter = m_ShortNameToID.find(SHORT_NAME);
+		if (iter == m_ShortNameToID.end())
+		{
+			m_ShortNameToID[SHORT_NAME] = (int)boneID;
+		}
+		else
+		{
+			iter->second = -1;
+		}
+	}
+}
+
+int Skeleton::FindBone(const std::string& NAME) const
+{
+	auto iter = m_NameToID.find(NAME);
+	if (iter != m_NameToID.end())
+	{
+		return iter->second;
+	}
+
+	iter = m_ShortNameToID.find(GetShortBoneName(NAME));
+	if (iter != m_ShortNameToID.end())
+	{
+		return iter->second;
+	}
+
+	return -1;
+}
+
+bool BuildSkeletonRemap(const Skeleton& SOURCE, const Skeleton& TARGET, SkeletonRemap* pOutRemap)
+{
+	_ASSERT(pOutRemap);
+
+	const UINT SOURCE_BONE_COUNT = SOURCE.GetBoneCount();
+	const UINT TARGET_BONE_COUNT = TARGET.GetBoneCount();
+
+	pOutRemap->SourceToTarget.assign(SOURCE_BONE_COUNT, -1);
+	pOutRemap->TargetToSource.assign(TARGET_BONE_COUNT, -1);
+	pOutRemap->Corrections.assign(TARGET_BONE_COUNT, Quaternion());
+	pOutRemap->TranslationScale = 1.0f;
+	pOutRemap->MatchedBoneCount = 0;
+
+	float sourceLength = 0.0f;
+	float targetLength = 0.0f;
+	for (UINT targetID = 0; targetID < TARGET_BONE_COUNT; ++targetID)
+	{
+		const int SOURCE_ID = SOURCE.FindBone(TARGET.BoneNames[targetID]);
+		if (SOURCE_ID < 0 || pOutRemap->SourceToTarget[SOURCE_ID] >= 0)
+		{
+			continue;
+		}
+
+		pOutRemap->SourceToTarget[SOURCE_ID] = (int)targetID;
+		pOutRemap->TargetToSource[targetID] = SOURCE_ID;
+		++pOutRemap->MatchedBoneCount;
+
+		// C = target rest global * source rest global^-1 ( ).
+		Quaternion inverseSourceRest;
+		SOURCE.RestGlobalRotations[SOURCE_ID].Inverse(inverseSourceRest);
+		pOutRemap->Corrections[targetID] = Quaternion::Concatenate(inverseSourceRest, TARGET.RestGlobalRotations[targetID]);
+
+		if (TARGET.BoneParents[targetID] >= 0)
+		{
+			sourceLength += SOURCE.RestPositions[SOURCE_ID].Length();
+			targetLength += TARGET.RestPositions[targetID].Length();
+		}
+	}
+
+	if (sourceLength > 1e-6f && targetLength > 1e-6f)
+	{
+		pOutRemap->TranslationScale = targetLength / sourceLength;
+	}
+
+	return (TARGET_BONE_COUNT > 0 && pOutRemap->TargetToSource[0] >= 0);
+}
+
+void RetargetClip(const AnimationClip& SOURCE_CLIP, const Skeleton& SOURCE, const Skeleton& TARGET, const SkeletonRemap& REMAP, AnimationClip* pOutClip)
+{
+	_ASSERT(pOutClip);
+	_ASSERT(REMAP.TargetToSource.size() == TARGET.GetBoneCount());
+	_ASSERT(SOURCE_CLIP.Keys.size() == SOURCE.GetBoneCount());
+
+	const UINT TARGET_BONE_COUNT = TARGET.GetBoneCount();
+
+	pOutClip->Name = SOURCE_CLIP.Name;
+	pOutClip->Duration = SOURCE_CLIP.Duration;
+	pOutClip->TicksPerSec = SOURCE_CLIP.TicksPerSec;
+	pOutClip->NumChannels = (int)REMAP.MatchedBoneCount;
+	pOutClip->Keys.clear();
+	pOutClip->Keys.resize(TARGET_BONE_COUNT);
+	pOutClip->KeyTracks.clear();
+	pOutClip->IKRotations.assign(TARGET_BONE_COUNT, Quaternion());
+
+	for (UINT targetID = 0; targetID < TARGET_BONE_COUNT; ++targetID)
+	{
+		std::vector<AnimationClip::Key>& destKeys = pOutClip->Keys[targetID];
+		const int SOURCE_ID = REMAP.TargetToSource[targetID];
+
+		if (SOURCE_ID < 0 || SOURCE_CLIP.Keys[SOURCE_ID].empty())
+		{
+			AnimationClip::Key key;
+			key.Position = TARGET.RestPositions[targetID];
+			key.Rotation = TARGET.RestRotations[targetID];
+			key.Scale = TARGET.RestScales[targetID];
+			destKeys.push_back(key);
+			continue;
+		}
+
+		const int PARENT_ID = TARGET.BoneParents[targetID];
+		Quaternion inverseParentCorrection;
+		if (PARENT_ID >= 0)
+		{
+			REMAP.Corrections[PARENT_ID].Inverse(inverseParentCorrection);
+		}
+		const Quaternion& CORRECTION = REMAP.Corrections[targetID];
+		const Vector3 SCALE_RATIO = DivideScale(TARGET.RestScales[targetID], SOURCE.RestScales[SOURCE_ID]);
+
+		const std::vector<AnimationClip::Key>& SOURCE_KEYS = SOURCE_CLIP.Keys[SOURCE_ID];
+		destKeys.resize(SOURCE_KEYS.size());
+		for (UINT64 k = 0, keySize = SOURCE_KEYS.size(); k < keySize; ++k)
+		{
+			const AnimationClip::Key& SOURCE_KEY = SOURCE_KEYS[k];
+			AnimationClip::Key& destKey = destKeys[k];
+
+			destKey.Rotation = Quaternion::Concatenate(Quaternion::Concatenate(inverseParentCorrection, SOURCE_KEY.Rotation), CORRECTION);
+			destKey.Rotation.Normalize();
+
+			// root ̵ ü,  target rest ̸ ϰ rest  ŭ ű.
+			if (PARENT_ID < 0)
+			{
+				destKey.Position = SOURCE_KEY.Position * REMAP.TranslationScale;
+			}
+			else
+			{
+				const Vector3 OFFSET = Vector3::Transform(SOURCE_KEY.Position - SOURCE.RestPositions[SOURCE_ID], inverseParentCorrection);
+				destKey.Position = TARGET.RestPositions[targetID] + OFFSET * REMAP.TranslationScale;
+			}
+
+			destKey.Scale = SOURCE_KEY.Scale * SCALE_RATIO;
+			destKey.Time = SOURCE_KEY.Time;
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <directxtk12/SimpleMath.h>
+#include <unordered_map>
+#include <vector>
+#include <string>
+
+// ĳ skeleton asset. ̸ ˻ load  , sample ⼭   bone ID .
+// ٸ FBX  clip SkeletonRemap   Ű   .
+
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Quaternion;
+
+class AnimationData;
+struct AnimationClip;
+
+class Skeleton
+{
+public:
+	Skeleton() = default;
+	~Skeleton() = default;
+
+	// ModelLoader ä bone ̸, θ, node transform .
+	void Initialize(const AnimationData& ANIM_DATA);
+
+	// Ȯ  ̸  namespace(':' )  ̸ ٽ ã.  -1.
+	int FindBone(const std::string& NAME) const;
+
+	inline UINT GetBoneCount() const { return (UINT)BoneNames.size(); }
+
+public:
+	std::vector<std::string> BoneNames;
+	std::vector<int> BoneParents;		   // θ ׻ ڽĺ  ID.
+	std::vector<Vector3> RestPositions;	   // θ  rest ġ.
+	std::vector<Quaternion> RestRotations;
+	std::vector<Vector3> RestScales;
+	std::vector<Quaternion> RestGlobalRotations; // root  rest ȸ.
+	float TotalBoneLength = 0.0f;				 // rest ġ  . skeleton  ũ  .
+
+private:
+	std::unordered_map<std::string, int> m_NameToID;
+	std::unordered_map<std::string, int> m_ShortNameToID; // namespace  ̸. ġ -1.
+};
+
+struct SkeletonRemap
+{
+	std::vector<int> SourceToTarget; //  bone  -1.
+	std::vector<int> TargetToSource;
+	std::vector<Quaternion> Corrections; // target bone.  skeleton rest global ȸ .
+	float TranslationScale = 1.0f;		 // target / source skeleton ũ.
+	UINT MatchedBoneCount = 0;
+};
+
+// ̸ source, target bone   ¦. root   false.
+bool BuildSkeletonRemap(const Skeleton& SOURCE, const Skeleton& TARGET, SkeletonRemap* pOutRemap);
+
+// SOURCE_CLIP track target bone ID  ű rest pose ̸ .
+// ȸ   C(bone) * source * C(parent)^-1. ġ θ   ũ ŭ .
+// source  bone target rest key ϳ ä.
+void RetargetClip(const AnimationClip& SOURCE_CLIP, const Skeleton& SOURCE, const Skeleton& TARGET, const SkeletonRemap& REMAP, AnimationClip* pOutClip);
@@ -2,8 +2,39 @@
 #include "../Renderer/ConstantDataType.h"
 #include "../Model/GeometryGenerator.h"
 #include "../Graphics/GraphicsUtil.h"
+#include "VertexPacking.h"
 #include "SkinnedMeshModel.h"
 
+// skinned vertex  vertex buffer . ġ   mesh constant .
+static void CreatePackedSkinnedVertexBuffer(ResourceManager* pResourceManager, const MeshInfo& MESH_INFO, Mesh* pNewMesh)
+{
+	HRESULT hr = S_OK;
+
+	VertexPackingSettings settings;
+	VertexPackingReport report;
+	std::vector<PackedSkinnedVertex> packedVertices;
+	Vector3 positionScale;
+	Vector3 positionBias;
+	PackSkinnedVertices(MESH_INFO.SkinnedVertices, settings, &packedVertices, &positionScale, &positionBias, &report);
+
+	hr = pResourceManager->CreateVertexBuffer(sizeof(PackedSkinnedVertex),
+											  (UINT)packedVertices.size(),
+											  &pNewMesh->Vertex.VertexBufferView,
+											  &pNewMesh->Vertex.pBuffer,
+											  (void*)packedVertices.data());
+	BREAK_IF_FAILED(hr);
+	pNewMesh->Vertex.Count = (UINT)packedVertices.size();
+	pNewMesh->MeshConstantData.PositionScale = positionScale;
+	pNewMesh->MeshConstantData.PositionBias = positionBias;
+
+	char szDebugString[512];
+	sprintf_s(szDebugString, 512, "Skinned mesh: %u vertices, %llu bytes -> %llu bytes. pruned influences: %u, max error pos: %f, normal: %f deg, tangent: %f deg, uv: %f, weight: %f\n",
+			  pNewMesh->Vertex.Count, report.SourceSize, report.PackedSize, report.PrunedInfluenceCount,
+			  report.MaxPositionError, DirectX::XMConvertToDegrees(report.MaxNormalError), DirectX::XMConvertToDegrees(report.MaxTangentError),
+			  report.MaxTexcoordError, report.MaxBlendWeightError);
+	OutputDebugStringA(szDebugString);
+}
+
 SkinnedMeshModel::SkinnedMeshModel()
 {
 	ModelType = RenderObjectType_SkinnedType;
@@ -35,13 +66,7 @@ void SkinnedMeshModel::InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH
 	// Create vertex buffer.
 	if (MESH_INFO.SkinnedVertices.size() > 0)
 	{
-		hr = pResourceManager->CreateVertexBuffer(sizeof(SkinnedVertex),
-												  (UINT)MESH_INFO.SkinnedVertices.size(),
-												  &pNewMesh->Vertex.VertexBufferView,
-												  &pNewMesh->Vertex.pBuffer,
-												  (void*)MESH_INFO.SkinnedVertices.data());
-		BREAK_IF_FAILED(hr);
-		pNewMesh->Vertex.Count = (UINT)MESH_INFO.SkinnedVertices.size();
+		CreatePackedSkinnedVertexBuffer(pResourceManager, MESH_INFO, pNewMesh);
 	}
 	else
 	{
@@ -54,14 +79,7 @@ void SkinnedMeshModel::InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH
 		pNewMesh->Vertex.Count = (UINT)MESH_INFO.Vertices.size();
 	}
 
-	// Create index buffer.
-	hr = pResourceManager->CreateIndexBuffer(sizeof(UINT),
-											 (UINT)MESH_INFO.Indices.size(),
-											 &pNewMesh->Index.IndexBufferView,
-											 &pNewMesh->Index.pBuffer,
-											 (void*)MESH_INFO.Indices.data());
-	BREAK_IF_FAILED(hr);
-	pNewMesh->Index.Count = (UINT)MESH_INFO.Indices.size();
+	initIndexBuffer(pResourceManager, MESH_INFO, pNewMesh);
 }
 
 void SkinnedMeshModel::InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH_INFO, Mesh** ppNewMesh)
@@ -74,13 +92,7 @@ void SkinnedMeshModel::InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH
 	// Create vertex buffer.
 	if (MESH_INFO.SkinnedVertices.size() > 0)
 	{
-		hr = pResourceManager->CreateVertexBuffer(sizeof(SkinnedVertex),
-												  (UINT)MESH_INFO.SkinnedVertices.size(),
-												  &(*ppNewMesh)->Vertex.VertexBufferView,
-												  &(*ppNewMesh)->Vertex.pBuffer,
-												  (void*)MESH_INFO.SkinnedVertices.data());
-		BREAK_IF_FAILED(hr);
-		(*ppNewMesh)->Vertex.Count = (UINT)MESH_INFO.SkinnedVertices.size();
+		CreatePackedSkinnedVertexBuffer(pResourceManager, MESH_INFO, *ppNewMesh);
 	}
 	else
 	{
@@ -93,14 +105,7 @@ void SkinnedMeshModel::InitMeshBuffers(Renderer* pRenderer, const MeshInfo& MESH
 		(*ppNewMesh)->Vertex.Count = (UINT)MESH_INFO.Vertices.size();
 	}
 
-	// Create index buffer.
-	hr = pResourceManager->CreateIndexBuffer(sizeof(UINT),
-											 (UINT)MESH_INFO.Indices.size(),
-											 &(*ppNewMesh)->Index.IndexBufferView,
-											 &(*ppNewMesh)->Index.pBuffer,
-											 (void*)MESH_INFO.Indices.data());
-	BREAK_IF_FAILED(hr);
-	(*ppNewMesh)->Index.Count = (UINT)MESH_INFO.Indices.size();
+	initIndexBuffer(pResourceManager, MESH_INFO, *ppNewMesh);
 }
 
 void SkinnedMeshModel::InitAnimationData(Renderer* pRenderer, const AnimationData& ANIM_DATA)
@@ -112,29 +117,28 @@ void SkinnedMeshModel::InitAnimationData(Renderer* pRenderer, const AnimationDat
 
 	CharacterAnimationData = ANIM_DATA;
 
-	// ⼭ AnimationClip SkinnedMesh .
-	// ANIM_DATA.Clips[0].Keys.size() ->  .
+	// cooked asset о ̹  .
+	CharacterAnimationData.PrepareClips();
 
-	pBoneTransform = pRenderer->GetTextureManager()->CreateNonImageTexture((UINT)ANIM_DATA.Clips[0].Keys.size(), sizeof(Matrix));
+	_ASSERT(CharacterAnimationData.BoneTransforms.size() == ANIM_DATA.Clips[0].Keys.size());
+	CharacterAnimationData.InitSkinningTransforms();
 
-	// ķ ʱȭ.
-	CD3DX12_RANGE writeRange(0, 0);
-	BYTE* pBoneTransformMem = nullptr;
-	pBoneTransform->pTextureResource->Map(0, &writeRange, (void**)&pBoneTransformMem);
+	// ⼭ AnimationClip SkinnedMesh .
+	// ANIM_DATA.Clips[0].Keys.size() ->  .
 
-	Matrix* pDest = (Matrix*)pBoneTransformMem;
-	for (UINT64 i = 0, size = ANIM_DATA.Clips[0].Keys.size(); i < size; ++i)
+	//  frame  ķ ä .
+	if (!pRenderer->GetSkinningPaletteRing()->AllocPalette((UINT)ANIM_DATA.Clips[0].Keys.size(), &BonePalette))
 	{
-		pDest[i] = Matrix();
+		__debugbreak();
 	}
-
-	pBoneTransform->pTextureResource->Unmap(0, nullptr);
+	m_PaletteFrameIndex = pRenderer->GetFrameIndex();
 }
 
 void SkinnedMeshModel::UpdateWorld(const Matrix& WORLD)
 {
 	World = WORLD;
 	InverseWorldTranspose = WORLD.Invert().Transpose();
+	bIsBoundsDirty = true;
 
 	for (UINT64 i = 0, size = Meshes.size(); i < size; ++i)
 	{
@@ -159,26 +163,17 @@ void SkinnedMeshModel::UpdateAnimation(const int CLIP_ID, const int FRAME, const
 
 	updateChainPosition(CLIP_ID, FRAME);
 
-	// IK .   .
-	if (CLIP_ID == 0)
+	// IK .   ,  target ŵ 츸( ĳʹ LOD ).
+	if (CLIP_ID == 0 && pUpdateInfo->bUpdatedJointParts[JointPart_RightLeg] && pUpdateInfo->bUpdatedJointParts[JointPart_LeftLeg])
 	{
 		solveCharacterIK(CLIP_ID, FRAME, DELTA_TIME, pUpdateInfo);
 	}
 
 	//updateChainPosition(CLIP_ID, FRAME);
 
-	// Update bone transform buffer.
-	BYTE* pBoneTransformMem = nullptr;
-	CD3DX12_RANGE writeRange(0, 0);
-	pBoneTransform->pTextureResource->Map(0, &writeRange, (void**)&pBoneTransformMem);
-
-	Matrix* pDest = (Matrix*)pBoneTransformMem;
-	for (UINT64 i = 0, size = CharacterAnimationData.Clips[CLIP_ID].Keys.size(); i < size; ++i)
-	{
-		pDest[i] = CharacterAnimationData.Get(CLIP_ID, FRAME, (int)i).Transpose();
-	}
-
-	pBoneTransform->pTextureResource->Unmap(0, nullptr);
+	// Update bone transform buffer.  frame  ٷ .
+	m_PaletteFrameIndex = m_pRenderer->GetFrameIndex();
+	CharacterAnimationData.WriteSkinningMatrices(m_pRenderer->GetSkinningPaletteRing()->GetPaletteMemory(BonePalette, m_PaletteFrameIndex));
 
 	updateJointSpheres(CLIP_ID, FRAME);
 }
@@ -210,7 +205,6 @@ void SkinnedMeshModel::Render(eRenderPSOType psoSetting)
 	{
 		Mesh* const pCurMesh = Meshes[i];
 
-		Material* pMeshMaterialTextures = &pCurMesh->Material;
 		MeshConstant* pMeshConstantData = &pCurMesh->MeshConstantData;
 		MaterialConstant* pMaterialConstantData = &pCurMesh->MaterialConstantData;
 		CBInfo* pMeshCB = pMeshConstantBufferPool->AllocCB();
@@ -227,94 +221,26 @@ void SkinnedMeshModel::Render(eRenderPSOType psoSetting)
 			case RenderPSOType_Skinned:
 			case RenderPSOType_ReflectionSkinned:
 			{
-				hr = pDynamicDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 10);
+				hr = pDynamicDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 3);
 				BREAK_IF_FAILED(hr);
 
 				CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(cpuDescriptorTable, 0, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// t7
-				pDevice->CopyDescriptorsSimple(1, dstHandle, pBoneTransform->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+				pDevice->CopyDescriptorsSimple(1, dstHandle, BonePalette.pSRVHandles[m_PaletteFrameIndex], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// b2, b3
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMaterialCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t0 ~ t5
-				if (pMeshMaterialTextures->pAlbedo)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAlbedo->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pEmissive)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pEmissive->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pNormal)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pNormal->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pAmbientOcclusion)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAmbientOcclusion->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pMetallic)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pMetallic->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pRoughness)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pRoughness->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t6
-				if (pMeshMaterialTextures->pHeight)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pHeight->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pResourceManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
 
 				pCommandList->SetGraphicsRootDescriptorTable(0, gpuDescriptorTable);
 
+				// t0 ~ t6. ̸   material table ״ .
+				_ASSERT(pCurMesh->MaterialTableIndex != INVALID_MATERIAL_TABLE_INDEX);
+				pCommandList->SetGraphicsRootDescriptorTable(3, pCurMesh->MaterialTableGPUHandle);
+
 			}
 			break;
 
@@ -328,7 +254,7 @@ void SkinnedMeshModel::Render(eRenderPSOType psoSetting)
 				CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(cpuDescriptorTable, 0, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// t7
-				pDevice->CopyDescriptorsSimple(1, dstHandle, pBoneTransform->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+				pDevice->CopyDescriptorsSimple(1, dstHandle, BonePalette.pSRVHandles[m_PaletteFrameIndex], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// b2, b3
@@ -346,9 +272,13 @@ void SkinnedMeshModel::Render(eRenderPSOType psoSetting)
 				break;
 		}
 
+		UINT indexStart;
+		UINT indexCount;
+		pCurMesh->GetLODIndexRange(LODLevel, &indexStart, &indexCount);
+
 		pCommandList->IASetVertexBuffers(0, 1, &pCurMesh->Vertex.VertexBufferView);
 		pCommandList->IASetIndexBuffer(&pCurMesh->Index.IndexBufferView);
-		pCommandList->DrawIndexedInstanced(pCurMesh->Index.Count, 1, 0, 0, 0);
+		pCommandList->DrawIndexedInstanced(indexCount, 1, indexStart, 0, 0);
 	}
 }
 
@@ -378,7 +308,6 @@ void SkinnedMeshModel::Render(UINT threadIndex, ID3D12GraphicsCommandList* pComm
 	{
 		Mesh* pCurMesh = Meshes[i];
 
-		Material* pMeshMaterialTextures = &pCurMesh->Material;
 		MeshConstant* pMeshConstantData = &pCurMesh->MeshConstantData;
 		MaterialConstant* pMaterialConstantData = &pCurMesh->MaterialConstantData;
 		CBInfo* pMeshCB = pMeshConstantBufferPool->AllocCB();
@@ -396,94 +325,26 @@ void SkinnedMeshModel::Render(UINT threadIndex, ID3D12GraphicsCommandList* pComm
 			case RenderPSOType_Skinned:
 			case RenderPSOType_ReflectionSkinned:
 			{
-				hr = pDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 10);
+				hr = pDescriptorPool->AllocDescriptorTable(&cpuDescriptorTable, &gpuDescriptorTable, 3);
 				BREAK_IF_FAILED(hr);
 
 				CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(cpuDescriptorTable, 0, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// t7
-				pDevice->CopyDescriptorsSimple(1, dstHandle, pBoneTransform->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+				pDevice->CopyDescriptorsSimple(1, dstHandle, BonePalette.pSRVHandles[m_PaletteFrameIndex], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// b2, b3
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 				pDevice->CopyDescriptorsSimple(1, dstHandle, pMaterialCB->CBVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t0 ~ t5
-				if (pMeshMaterialTextures->pAlbedo)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAlbedo->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pEmissive)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pEmissive->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pNormal)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pNormal->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pAmbientOcclusion)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pAmbientOcclusion->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pMetallic)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pMetallic->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				if (pMeshMaterialTextures->pRoughness)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pRoughness->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
-
-				// t6
-				if (pMeshMaterialTextures->pHeight)
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pMeshMaterialTextures->pHeight->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
-				else
-				{
-					pDevice->CopyDescriptorsSimple(1, dstHandle, pManager->NullSRVDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-				}
 
 				pCommandList->SetGraphicsRootDescriptorTable(0, gpuDescriptorTable);
 
+				// t0 ~ t6. ̸   material table ״ .
+				_ASSERT(pCurMesh->MaterialTableIndex != INVALID_MATERIAL_TABLE_INDEX);
+				pCommandList->SetGraphicsRootDescriptorTable(3, pCurMesh->MaterialTableGPUHandle);
+
 			}
 			break;
 
@@ -497,7 +358,7 @@ void SkinnedMeshModel::Render(UINT threadIndex, ID3D12GraphicsCommandList* pComm
 				CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(cpuDescriptorTable, 0, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// t7
-				pDevice->CopyDescriptorsSimple(1, dstHandle, pBoneTransform->SRVHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+				pDevice->CopyDescriptorsSimple(1, dstHandle, BonePalette.pSRVHandles[m_PaletteFrameIndex], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 				dstHandle.Offset(1, CBV_SRV_DESCRIPTOR_SIZE);
 
 				// b2, b3
@@ -515,9 +376,13 @@ void SkinnedMeshModel::Render(UINT threadIndex, ID3D12GraphicsCommandList* pComm
 				break;
 		}
 
+		UINT indexStart;
+		UINT indexCount;
+		pCurMesh->GetLODIndexRange(LODLevel, &indexStart, &indexCount);
+
 		pCommandList->IASetVertexBuffers(0, 1, &pCurMesh->Vertex.VertexBufferView);
 		pCommandList->IASetIndexBuffer(&pCurMesh->Index.IndexBufferView);
-		pCommandList->DrawIndexedInstanced(pCurMesh->Index.Count, 1, 0, 0, 0);
+		pCommandList->DrawIndexedInstanced(indexCount, 1, indexStart, 0, 0);
 	}
 }
 
@@ -805,11 +670,9 @@ void SkinnedMeshModel::Cleanup()
 	pRightFootTarget = nullptr;
 	pLeftFootTarget = nullptr;
 
-	if (pBoneTransform)
+	if (BonePalette.MatrixCount > 0)
 	{
-		TextureManager* pTextureManager = m_pRenderer->GetTextureManager();
-		pTextureManager->DeleteTexture(pBoneTransform);
-		pBoneTransform = nullptr;
+		m_pRenderer->GetSkinningPaletteRing()->FreePalette(&BonePalette);
 	}
 
 	for (int i = 0; i < 4; ++i)
@@ -1119,14 +982,12 @@ void SkinnedMeshModel::updateChainPosition(const int CLIP_ID, const int FRAME)
 
 void SkinnedMeshModel::updateJointSpheres(const int CLIP_ID, const int FRAME)
 {
-	const int ROOT_BONE_ID = 0;
-	const Matrix ROOT_BONE_TRANSFORM = CharacterAnimationData.GetRootBoneTransformWithoutLocalRot(CLIP_ID, FRAME);
-
 	m_pBoundingBoxMesh->MeshConstantData.World = World.Transpose();
 	m_pBoundingSphereMesh->MeshConstantData.World = m_pBoundingBoxMesh->MeshConstantData.World;
 	m_pBoundingCapsuleMesh->MeshConstantData.World = m_pBoundingBoxMesh->MeshConstantData.World;
 	BoundingBox.Center = m_pBoundingBoxMesh->MeshConstantData.World.Transpose().Translation();
 	BoundingSphere.Center = BoundingBox.Center;
+	bIsBoundsDirty = true;
 
 	// update debugging sphere for chain.
 	for (int i = 0; i < 4; ++i)
@@ -1163,63 +1024,24 @@ void SkinnedMeshModel::updateJointSpheres(const int CLIP_ID, const int FRAME)
 
 void SkinnedMeshModel::solveCharacterIK(const int CLIP_ID, const int FRAME, const float DELTA_TIME, JointUpdateInfo* pUpdateInfo)
 {
-	//  ٸ Ѵٰ .
-
-	const int STEP_COUNT = 40;
-	float deltaTime = DELTA_TIME / (float)STEP_COUNT;
-	Vector3 targetPosRightLeg(pUpdateInfo->EndEffectorTargetPoses[JointPart_RightLeg]);
-	Vector3 targetPosLeftLeg(pUpdateInfo->EndEffectorTargetPoses[JointPart_LeftLeg]);
-
-	float rightLegDeltaThetas[12];
-	float leftLegDeltaThetas[12];
-
-	//for (int step = 0; step < STEP_COUNT; ++step)
-	//{
-	//	bool bRightLegContinue = false;
-	//	bool bLeftLegContinue = false;
-	//	bRightLegContinue = RightLeg.SolveIK(&CharacterAnimationData, targetPosRightLeg, rightLegDeltaThetas, CLIP_ID, FRAME, deltaTime, World);
-	//	bLeftLegContinue = LeftLeg.SolveIK(&CharacterAnimationData, targetPosLeftLeg, leftLegDeltaThetas, CLIP_ID, FRAME, deltaTime, World);
-
-	//	/*{
-	//		char szDebugString[256];
-	//		sprintf_s(szDebugString, 256, "right target pos: %f, %f, %f  left target pos: %f, %f, %f\n", 
-	//				  targetPosRightLeg.x, targetPosRightLeg.y, targetPosRightLeg.z,
-	//				  targetPosLeftLeg.x, targetPosLeftLeg.y, targetPosLeftLeg.z);
-	//		OutputDebugStringA(szDebugString);
-	//	}*/
-
-	//	if (!bRightLegContinue && !bLeftLegContinue)
-	//	{
-	//		break;
-	//	}
-
-	//	int deltaIndex = 0;
-	//	// Adjust right and left leg delta thetas.
-	//	for (int i = 0; i < 4; ++i)
-	//	{
-	//		Joint* pRightJoint = &RightLeg.BodyChain[i];
-	//		Joint* pLeftJoint = &LeftLeg.BodyChain[i];
-
-	//		if(bRightLegContinue)
-	//		{
-	//			pRightJoint->ApplyJacobian(rightLegDeltaThetas[deltaIndex], rightLegDeltaThetas[deltaIndex + 1], rightLegDeltaThetas[deltaIndex + 2], &CharacterAnimationData, CLIP_ID, FRAME, World);
-	//		}
-	//		if(bLeftLegContinue)
-	//		{
-	//			pLeftJoint->ApplyJacobian(leftLegDeltaThetas[deltaIndex], leftLegDeltaThetas[deltaIndex + 1], leftLegDeltaThetas[deltaIndex + 2], &CharacterAnimationData, CLIP_ID, FRAME, World);
-	//		}
-	//		deltaIndex += 3;
-	//	}
-
-	//	CharacterAnimationData.UpdateForIK(CLIP_ID, FRAME);
-	//	updateChainPosition(CLIP_ID, FRAME);
-	//}
-
-	RightLeg.SolveIK(&CharacterAnimationData, targetPosRightLeg, rightLegDeltaThetas, CLIP_ID, FRAME, deltaTime, World);
-	LeftLeg.SolveIK(&CharacterAnimationData, targetPosLeftLeg, leftLegDeltaThetas, CLIP_ID, FRAME, deltaTime, World);
+	//  ٸ Ѵٰ . foot target  toe foot .
+	const UINT FOOT_JOINT_INDEX = 2;
+	const Vector3& TARGET_POS_RIGHT_LEG = pUpdateInfo->EndEffectorTargetPoses[JointPart_RightLeg];
+	const Vector3& TARGET_POS_LEFT_LEG = pUpdateInfo->EndEffectorTargetPoses[JointPart_LeftLeg];
+
+	IKChainTask pTasks[2];
+	RightLeg.BuildIKTask(&CharacterAnimationData, TARGET_POS_RIGHT_LEG, World, FOOT_JOINT_INDEX, &pTasks[0]);
+	LeftLeg.BuildIKTask(&CharacterAnimationData, TARGET_POS_LEFT_LEG, World, FOOT_JOINT_INDEX, &pTasks[1]);
+
+	IKSolverSettings settings;
+	SolveIKTasks(pTasks, 2, settings);
+
+	RightLeg.ApplyIKTask(&CharacterAnimationData, CLIP_ID, pTasks[0]);
+	LeftLeg.ApplyIKTask(&CharacterAnimationData, CLIP_ID, pTasks[1]);
+
 	CharacterAnimationData.UpdateForIK(CLIP_ID, FRAME);
 	updateChainPosition(CLIP_ID, FRAME);
 
-	m_pTargetPos1->MeshConstantData.World = Matrix::CreateTranslation(targetPosRightLeg).Transpose();
-	m_pTargetPos2->MeshConstantData.World = Matrix::CreateTranslation(targetPosLeftLeg).Transpose();
+	m_pTargetPos1->MeshConstantData.World = Matrix::CreateTranslation(TARGET_POS_RIGHT_LEG).Transpose();
+	m_pTargetPos2->MeshConstantData.World = Matrix::CreateTranslation(TARGET_POS_LEFT_LEG).Transpose();
 }
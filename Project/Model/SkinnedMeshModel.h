@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Model.h"
+#include "../Renderer/SkinningPaletteRing.h"
 
 class SkinnedMeshModel final : public Model
 {
@@ -54,7 +55,7 @@ protected:
 	void solveCharacterIK(const int CLIP_ID, const int FRAME, const float DELTA_TIME, JointUpdateInfo* pUpdateInfo);
 
 public:
-	TextureHandle* pBoneTransform = nullptr;
+	SkinningPalette BonePalette = { }; // renderer palette ring  .
 	AnimationData CharacterAnimationData;
 
 	DirectX::BoundingSphere RightHandMiddle;
@@ -81,4 +82,5 @@ private:
 	Mesh* m_pBoundingCapsuleMesh = nullptr;
 	Mesh* m_pTargetPos1 = nullptr; // for right foot.
 	Mesh* m_pTargetPos2 = nullptr; // for left foot.
+	UINT m_PaletteFrameIndex = 0; //  bone matrix  frame .
 };
@@ -0,0 +1,241 @@
+#include "../pch.h"
+#include <DirectXPackedVector.h>
+#include "VertexPacking.h"
+
+static const float POSITION_QUANTIZE_MAX = 65535.0f; // 16bit unorm.
+static const float OCTAHEDRON_QUANTIZE_MAX = 32767.0f; // 16bit snorm.
+static const float WEIGHT_QUANTIZE_MAX = 255.0f;	   // 8bit unorm.
+static const UINT MAX_INFLUENCE = 8;
+
+static inline float SignNotZero(const float VALUE)
+{
+	return (VALUE >= 0.0f ? 1.0f : -1.0f);
+}
+
+static inline INT16 QuantizeSnorm(const float VALUE)
+{
+	const float CLAMPED = (VALUE < -1.0f ? -1.0f : (VALUE > 1.0f ? 1.0f : VALUE));
+	return (INT16)roundf(CLAMPED * OCTAHEDRON_QUANTIZE_MAX);
+}
+
+static void EncodeOctahedron(const Vector3& DIRECTION, INT16* pDest)
+{
+	const float L1_NORM = fabs(DIRECTION.x) + fabs(DIRECTION.y) + fabs(DIRECTION.z);
+	if (L1_NORM <= 1e-12f)
+	{
+		pDest[0] = 0;
+		pDest[1] = 0;
+		return;
+	}
+
+	float x = DIRECTION.x / L1_NORM;
+	float y = DIRECTION.y / L1_NORM;
+	if (DIRECTION.z < 0.0f)
+	{
+		// Ʒ ݱ ٱ ﰢ .
+		const float FOLDED_X = (1.0f - fabs(y)) * SignNotZero(x);
+		const float FOLDED_Y = (1.0f - fabs(x)) * SignNotZero(y);
+		x = FOLDED_X;
+		y = FOLDED_Y;
+	}
+
+	pDest[0] = QuantizeSnorm(x);
+	pDest[1] = QuantizeSnorm(y);
+}
+
+// Common.hlsli DecodeOctahedron .
+static Vector3 DecodeOctahedron(const INT16* pSRC)
+{
+	const float X = (pSRC[0] < -32767 ? -1.0f : (float)pSRC[0] / OCTAHEDRON_QUANTIZE_MAX);
+	const float Y = (pSRC[1] < -32767 ? -1.0f : (float)pSRC[1] / OCTAHEDRON_QUANTIZE_MAX);
+
+	Vector3 direction(X, Y, 1.0f - fabs(X) - fabs(Y));
+	const float T = (-direction.z > 0.0f ? -direction.z : 0.0f);
+	direction.x += (direction.x >= 0.0f ? -T : T);
+	direction.y += (direction.y >= 0.0f ? -T : T);
+	direction.Normalize();
+	return direction;
+}
+
+// acos 1 ó float е 0.02  ȭ (0.004) Ŀ. atan2.
+static float GetAngleError(const Vector3& A, const Vector3& B)
+{
+	return atan2f(A.Cross(B).Length(), A.Dot(B));
+}
+
+// ū  MaxInfluenceCount, MinBlendWeight ̸   255 ǵ ȭ.
+static UINT PackBlendWeights(const SkinnedVertex& VERTEX, const VertexPackingSettings& SETTINGS, PackedSkinnedVertex* pDest, float* pOutMaxError)
+{
+	UINT pOrder[MAX_INFLUENCE];
+	UINT influenceCount = 0;
+	float totalWeight = 0.0f;
+	for (UINT i = 0; i < MAX_INFLUENCE; ++i)
+	{
+		if (VERTEX.BlendWeights[i] > 0.0f)
+		{
+			pOrder[influenceCount++] = i;
+			totalWeight += VERTEX.BlendWeights[i];
+		}
+	}
+
+	ZeroMemory(pDest->BlendWeights, sizeof(pDest->BlendWeights));
+	ZeroMemory(pDest->BoneIndices, sizeof(pDest->BoneIndices));
+	*pOutMaxError = 0.0f;
+	if (influenceCount == 0)
+	{
+		return 0;
+	}
+
+	// 8̹Ƿ  .
+	for (UINT i = 1; i < influenceCount; ++i)
+	{
+		const UINT CUR = pOrder[i];
+		UINT j = i;
+		while (j > 0 && VERTEX.BlendWeights[pOrder[j - 1]] < VERTEX.BlendWeights[CUR])
+		{
+			pOrder[j] = pOrder[j - 1];
+			--j;
+		}
+		pOrder[j] = CUR;
+	}
+
+	//  ū weight ׻ .
+	const UINT MAX_COUNT = (SETTINGS.MaxInfluenceCount < MAX_INFLUENCE ? SETTINGS.MaxInfluenceCount : MAX_INFLUENCE);
+	UINT keptCount = 1;
+	float keptWeight = VERTEX.BlendWeights[pOrder[0]];
+	while (keptCount < influenceCount && keptCount < MAX_COUNT && VERTEX.BlendWeights[pOrder[keptCount]] / totalWeight >= SETTINGS.MinBlendWeight)
+	{
+		keptWeight += VERTEX.BlendWeights[pOrder[keptCount]];
+		++keptCount;
+	}
+
+	// ݿø   ū weight Ƽ  Ȯ .
+	int quantizedSum = 0;
+	for (UINT i = 0; i < keptCount; ++i)
+	{
+		const int QUANTIZED = (int)roundf(VERTEX.BlendWeights[pOrder[i]] / keptWeight * WEIGHT_QUANTIZE_MAX);
+		pDest->BlendWeights[i] = (UCHAR)QUANTIZED;
+		pDest->BoneIndices[i] = VERTEX.BoneIndices[pOrder[i]];
+		quantizedSum += QUANTIZED;
+	}
+	pDest->BlendWeights[0] = (UCHAR)((int)pDest->BlendWeights[0] + (int)WEIGHT_QUANTIZE_MAX - quantizedSum);
+
+	//  bone  slot   Ƿ slot  .
+	for (UINT i = 0; i < influenceCount; ++i)
+	{
+		const float SOURCE = VERTEX.BlendWeights[pOrder[i]] / totalWeight;
+		const float PACKED = (i < keptCount ? (float)pDest->BlendWeights[i] / WEIGHT_QUANTIZE_MAX : 0.0f);
+		const float ERROR_VALUE = fabs(SOURCE - PACKED);
+		*pOutMaxError = (ERROR_VALUE > *pOutMaxError ? ERROR_VALUE : *pOutMaxError);
+	}
+
+	//  ߸鼭 ù weight ۾  Ƿ ٽ .
+	// shader 0 ߹Ƿ 0 ȭ slot ڷ  .
+	for (UINT i = 1; i < keptCount; ++i)
+	{
+		const UCHAR WEIGHT = pDest->BlendWeights[i];
+		const UCHAR BONE_INDEX = pDest->BoneIndices[i];
+		UINT j = i;
+		while (j > 0 && pDest->BlendWeights[j - 1] < WEIGHT)
+		{
+			pDest->BlendWeights[j] = pDest->BlendWeights[j - 1];
+			pDest->BoneIndices[j] = pDest->BoneIndices[j - 1];
+			--j;
+		}
+		pDest->BlendWeights[j] = WEIGHT;
+		pDest->BoneIndices[j] = BONE_INDEX;
+	}
+	while (keptCount > 1 && pDest->BlendWeights[keptCount - 1] == 0)
+	{
+		--keptCount;
+		pDest->BoneIndices[keptCount] = 0;
+	}
+
+	return influenceCount - keptCount;
+}
+
+void PackSkinnedVertices(const std::vector<SkinnedVertex>& VERTICES, const VertexPackingSettings& SETTINGS,
+						 std::vector<PackedSkinnedVertex>* pOutVertices, Vector3* pOutPositionScale, Vector3* pOutPositionBias, VertexPackingReport* pOutReport)
+{
+	_ASSERT(pOutVertices);
+	_ASSERT(pOutPositionScale);
+	_ASSERT(pOutPositionBias);
+	_ASSERT(SETTINGS.MaxInfluenceCount == 4 || SETTINGS.MaxInfluenceCount == 8);
+
+	const UINT64 VERTEX_COUNT = VERTICES.size();
+	pOutVertices->resize(VERTEX_COUNT);
+
+	VertexPackingReport report = {};
+	report.SourceSize = VERTEX_COUNT * sizeof(SkinnedVertex);
+	report.PackedSize = VERTEX_COUNT * sizeof(PackedSkinnedVertex);
+
+	Vector3 minPosition(FLT_MAX);
+	Vector3 maxPosition(-FLT_MAX);
+	for (UINT64 i = 0; i < VERTEX_COUNT; ++i)
+	{
+		minPosition = Vector3::Min(minPosition, VERTICES[i].Position);
+		maxPosition = Vector3::Max(maxPosition, VERTICES[i].Position);
+	}
+	if (VERTEX_COUNT == 0)
+	{
+		minPosition = Vector3(0.0f);
+		maxPosition = Vector3(0.0f);
+	}
+
+	//    0̸    0 ϰ biasθ .
+	const Vector3 EXTENT = maxPosition - minPosition;
+	const Vector3 INVERSE_EXTENT(EXTENT.x > 0.0f ? 1.0f / EXTENT.x : 0.0f,
+								 EXTENT.y > 0.0f ? 1.0f / EXTENT.y : 0.0f,
+								 EXTENT.z > 0.0f ? 1.0f / EXTENT.z : 0.0f);
+	*pOutPositionScale = EXTENT;
+	*pOutPositionBias = minPosition;
+
+	for (UINT64 i = 0; i < VERTEX_COUNT; ++i)
+	{
+		const SkinnedVertex& SRC = VERTICES[i];
+		PackedSkinnedVertex& dest = (*pOutVertices)[i];
+
+		const Vector3 NORMALIZED_POSITION = (SRC.Position - minPosition) * INVERSE_EXTENT;
+		dest.Position[0] = (UINT16)roundf(NORMALIZED_POSITION.x * POSITION_QUANTIZE_MAX);
+		dest.Position[1] = (UINT16)roundf(NORMALIZED_POSITION.y * POSITION_QUANTIZE_MAX);
+		dest.Position[2] = (UINT16)roundf(NORMALIZED_POSITION.z * POSITION_QUANTIZE_MAX);
+		dest.Position[3] = 0;
+
+		EncodeOctahedron(SRC.Normal, dest.Normal);
+		EncodeOctahedron(SRC.Tangent, dest.Tangent);
+
+		dest.Texcoord[0] = DirectX::PackedVector::XMConvertFloatToHalf(SRC.Texcoord.x);
+		dest.Texcoord[1] = DirectX::PackedVector::XMConvertFloatToHalf(SRC.Texcoord.y);
+
+		float weightError;
+		report.PrunedInfluenceCount += PackBlendWeights(SRC, SETTINGS, &dest, &weightError);
+		report.MaxBlendWeightError = (weightError > report.MaxBlendWeightError ? weightError : report.MaxBlendWeightError);
+
+		// ؼ  .
+		const Vector3 DECODED_POSITION = Vector3((float)dest.Position[0], (float)dest.Position[1], (float)dest.Position[2]) / POSITION_QUANTIZE_MAX * EXTENT + minPosition;
+		const Vector3 POSITION_DELTA = DECODED_POSITION - SRC.Position;
+		const float POSITION_ERROR = fabs(POSITION_DELTA.x) + fabs(POSITION_DELTA.y) + fabs(POSITION_DELTA.z);
+		report.MaxPositionError = (POSITION_ERROR > report.MaxPositionError ? POSITION_ERROR : report.MaxPositionError);
+
+		if (SRC.Normal.LengthSquared() > 0.0f)
+		{
+			const float NORMAL_ERROR = GetAngleError(SRC.Normal, DecodeOctahedron(dest.Normal));
+			report.MaxNormalError = (NORMAL_ERROR > report.MaxNormalError ? NORMAL_ERROR : report.MaxNormalError);
+		}
+		if (SRC.Tangent.LengthSquared() > 0.0f)
+		{
+			const float TANGENT_ERROR = GetAngleError(SRC.Tangent, DecodeOctahedron(dest.Tangent));
+			report.MaxTangentError = (TANGENT_ERROR > report.MaxTangentError ? TANGENT_ERROR : report.MaxTangentError);
+		}
+
+		const float TEXCOORD_ERROR_X = fabs(DirectX::PackedVector::XMConvertHalfToFloat(dest.Texcoord[0]) - SRC.Texcoord.x);
+		const float TEXCOORD_ERROR_Y = fabs(DirectX::PackedVector::XMConvertHalfToFloat(dest.Texcoord[1]) - SRC.Texcoord.y);
+		const float TEXCOORD_ERROR = (TEXCOORD_ERROR_X > TEXCOORD_ERROR_Y ? TEXCOORD_ERROR_X : TEXCOORD_ERROR_Y);
+		report.MaxTexcoordError = (TEXCOORD_ERROR > report.MaxTexcoordError ? TEXCOORD_ERROR : report.MaxTexcoordError);
+	}
+
+	if (pOutReport)
+	{
+		*pOutReport = report;
+	}
+}
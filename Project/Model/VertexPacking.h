@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include "Vertex.h"
+
+// GPU ø  SkinnedVertex .
+// ġ mesh AABB  16bit unorm, normal/tangent octahedron 16bit snorm, uv half, weight 8bit unorm.
+
+struct PackedSkinnedVertex
+{
+	UINT16 Position[4];	   // R16G16B16A16_UNORM.  Position * PositionScale + PositionBias. w   .
+	INT16 Normal[2];	   // R16G16_SNORM. octahedron.
+	UINT16 Texcoord[2];	   // R16G16_FLOAT.
+	INT16 Tangent[2];	   // R16G16_SNORM. octahedron.
+	UCHAR BlendWeights[8]; // R8G8B8A8_UNORM x 2. ū ,  255. 0  ڴ  0.
+	UCHAR BoneIndices[8];  // R8G8B8A8_UINT x 2.
+};
+static_assert(sizeof(PackedSkinnedVertex) == 36, "input layout in ResourceManager::initShaders must match.");
+
+struct VertexPackingSettings
+{
+	UINT MaxInfluenceCount = 8; // 4 Ǵ 8. Ѵ   ͺ .
+	float MinBlendWeight = 0.01f; // ̺  weight    ٽ ȭ.
+};
+
+//    ִ .
+struct VertexPackingReport
+{
+	UINT64 SourceSize;
+	UINT64 PackedSize;
+	UINT PrunedInfluenceCount;
+	float MaxPositionError; //  ǥ.
+	float MaxNormalError;	// radian.
+	float MaxTangentError;	// radian.
+	float MaxTexcoordError;
+	float MaxBlendWeightError; // ȭ  weight .
+};
+
+// mesh ϳ vertex . ġ   MeshConstant PositionScale, PositionBias.
+// pOutReport nullptr .
+void PackSkinnedVertices(const std::vector<SkinnedVertex>& VERTICES, const VertexPackingSettings& SETTINGS,
+						 std::vector<PackedSkinnedVertex>* pOutVertices, Vector3* pOutPositionScale, Vector3* pOutPositionBias, VertexPackingReport* pOutReport);
@@ -0,0 +1,36 @@
+#include "../pch.h"
+#include "JobCpuDispatcher.h"
+
+void JobCpuDispatcher::Initialize(JobSystem* pJobSystem)
+{
+	_ASSERT(pJobSystem);
+
+	m_pJobSystem = pJobSystem;
+}
+
+void JobCpuDispatcher::WaitForTasks()
+{
+	_ASSERT(m_pJobSystem);
+
+	m_pJobSystem->WaitForCounter(&m_TaskCounter);
+}
+
+void JobCpuDispatcher::submitTask(physx::PxBaseTask& task)
+{
+	_ASSERT(m_pJobSystem);
+
+	// ̾ task   task release() ȿ Ƿ,  job   counter  þ.
+	m_pJobSystem->Submit(physicsTaskJob, &task, &m_TaskCounter);
+}
+
+physx::PxU32 JobCpuDispatcher::getWorkerCount() const
+{
+	return (physx::PxU32)m_pJobSystem->GetWorkerCount();
+}
+
+void JobCpuDispatcher::physicsTaskJob(void* pArg, UINT workerIndex)
+{
+	physx::PxBaseTask* pTask = (physx::PxBaseTask*)pArg;
+	pTask->run();
+	pTask->release();
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "../Util/JobSystem.h"
+
+// PhysX task JobSystem job ϴ dispatcher.
+// PxDefaultCpuDispatcher     render/character job  worker .
+class JobCpuDispatcher : public physx::PxCpuDispatcher
+{
+public:
+	JobCpuDispatcher() = default;
+	virtual ~JobCpuDispatcher() = default;
+
+	void Initialize(JobSystem* pJobSystem);
+
+	// simulate()  task  task ̾  task    job Բ óϸ ٸ.
+	// worker main ϳ̾ fetchResults(true)  ʵ fetchResults  ȣ.
+	void WaitForTasks();
+
+	void submitTask(physx::PxBaseTask& task) override;
+	physx::PxU32 getWorkerCount() const override;
+
+protected:
+	static void physicsTaskJob(void* pArg, UINT workerIndex);
+
+private:
+	JobSystem* m_pJobSystem = nullptr;
+	JobCounter m_TaskCounter;
+};
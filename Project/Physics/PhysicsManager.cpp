@@ -24,9 +24,9 @@ PxFilterFlags PhysicsManager::IgnoreCharacterControllerAndEndEffector(PxFilterOb
 	return PxFilterFlag::eDEFAULT;
 }
 
-void PhysicsManager::Initialize(UINT numThreads)
+void PhysicsManager::Initialize(JobSystem* pJobSystem)
 {
-	_ASSERT(numThreads >= 1);
+	_ASSERT(pJobSystem);
 
 	m_pFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, m_Allocator, m_ErrorCallback);
 	if (!m_pFoundation)
@@ -51,15 +51,11 @@ void PhysicsManager::Initialize(UINT numThreads)
 		__debugbreak();
 	}
 
-	m_pDispatcher = PxDefaultCpuDispatcherCreate(numThreads);
-	if (!m_pDispatcher)
-	{
-		__debugbreak();
-	}
+	m_Dispatcher.Initialize(pJobSystem);
 
 	PxSceneDesc sceneDesc(m_pPhysics->getTolerancesScale());
 	sceneDesc.gravity = m_GRAVITY;
-	sceneDesc.cpuDispatcher = m_pDispatcher;
+	sceneDesc.cpuDispatcher = &m_Dispatcher;
 	// sceneDesc.filterShader = PxDefaultSimulationFilterShader;
 	sceneDesc.filterShader = IgnoreCharacterControllerAndEndEffector;
 
@@ -83,7 +79,7 @@ void PhysicsManager::Initialize(UINT numThreads)
 	}
 #endif
 
-	m_pTaskManager = PxTaskManager::createTaskManager(m_pFoundation->getErrorCallback(), m_pDispatcher);
+	m_pTaskManager = PxTaskManager::createTaskManager(m_pFoundation->getErrorCallback(), &m_Dispatcher);
 	if (!m_pTaskManager)
 	{
 		__debugbreak();
@@ -103,6 +99,7 @@ void PhysicsManager::Update(const float DELTA_TIME)
 	_ASSERT(m_pScene);
 
 	m_pScene->simulate(DELTA_TIME);
+	m_Dispatcher.WaitForTasks();
 	m_pScene->fetchResults(true);
 }
 
@@ -243,7 +240,6 @@ void PhysicsManager::Cleanup()
 		m_pScene = nullptr;
 	}
 	PX_RELEASE(m_pTaskManager);
-	PX_RELEASE(m_pDispatcher);
 	PX_RELEASE(m_pPhysics);
 	if (m_pPVD)
 	{
@@ -2,6 +2,7 @@
 
 #include <physx/cooking/PxCooking.h>
 #include "CollisionGroup.h"
+#include "JobCpuDispatcher.h"
 
 class PhysicsManager
 {
@@ -17,7 +18,8 @@ public:
 	PhysicsManager() = default;
 	~PhysicsManager() { Cleanup(); };
 
-	void Initialize(UINT numThreads = 1);
+	// simulation task pJobSystem worker .
+	void Initialize(JobSystem* pJobSystem);
 
 	void Update(const float DELTA_TIME);
 
@@ -43,6 +45,6 @@ private:
 	physx::PxScene* m_pScene = nullptr;
 	physx::PxPvd* m_pPVD = nullptr;
 	physx::PxTaskManager* m_pTaskManager = nullptr;
-	physx::PxDefaultCpuDispatcher* m_pDispatcher = nullptr;
+	JobCpuDispatcher m_Dispatcher;
 	physx::PxControllerManager* m_pControllerManager = nullptr;
 };
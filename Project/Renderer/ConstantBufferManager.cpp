@@ -15,26 +15,123 @@ UINT64 g_CBSizes[ConstantBufferType_ConstantTypeCount] =
 
 void ConstantBufferManager::Initialize(ID3D12Device* pDevice, UINT maxCBVNum)
 {
+	_ASSERT(pDevice);
+	_ASSERT(maxCBVNum > 0);
+
+	HRESULT hr = S_OK;
+	UINT64 uploadBufferSize = 0;
+
+	m_pDevice = pDevice;
+
 	for (int i = 0; i < ConstantBufferType_ConstantTypeCount; ++i)
 	{
 		UINT CBSize = (g_CBSizes[i] + 255) & ~(255); // aligned.
 		m_ppConstantBufferPool[i] = new ConstantBufferPool;
-		m_ppConstantBufferPool[i]->Initialize(pDevice, (eConstantBufferType)i, CBSize, maxCBVNum);
+		m_ppConstantBufferPool[i]->Initialize(pDevice, this, (eConstantBufferType)i, CBSize, maxCBVNum);
+
+		uploadBufferSize += CBSize;
 	}
+
+	// ó type maxCBVNum    з. ڶ þ.
+	uploadBufferSize *= maxCBVNum;
+	hr = createUploadBuffer(uploadBufferSize);
+	BREAK_IF_FAILED(hr);
 }
 
-void ConstantBufferManager::Reset()
+bool ConstantBufferManager::AllocUploadMemory(UINT size, D3D12_GPU_VIRTUAL_ADDRESS* pOutGPUMemAddr, BYTE** ppOutSystemMemAddr)
 {
-	for (int i = 0; i < ConstantBufferType_ConstantTypeCount; ++i)
+	_ASSERT(m_pUploadBuffer);
+	_ASSERT(pOutGPUMemAddr);
+	_ASSERT(ppOutSystemMemAddr);
+
+	HRESULT hr = S_OK;
+	UINT64 offset = 0;
+
+	if (!m_UploadRing.Alloc(size, CONSTANT_BUFFER_ALIGNMENT, &offset))
 	{
-#ifdef _DEBUG
-		if (m_ppConstantBufferPool[i])
+		//  ۴ ̹ ӱ GPU Ƿ fence   .
+		UINT64 newSize = m_UploadRing.GetCapacity() * 2;
+		while (newSize < (UINT64)size)
 		{
-			m_ppConstantBufferPool[i]->Reset();
+			newSize *= 2;
 		}
-#else
+
+		if (!retireUploadBuffer())
+		{
+			return false;
+		}
+		hr = createUploadBuffer(newSize);
+		if (FAILED(hr))
+		{
+			__debugbreak();
+			return false;
+		}
+
+		if (!m_UploadRing.Alloc(size, CONSTANT_BUFFER_ALIGNMENT, &offset))
+		{
+			__debugbreak();
+			return false;
+		}
+	}
+
+	*pOutGPUMemAddr = m_GPUMemAddr + offset;
+	*ppOutSystemMemAddr = m_pSystemMemAddr + offset;
+	return true;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS ConstantBufferManager::UploadConstant(const void* pDATA, UINT size)
+{
+	_ASSERT(pDATA);
+
+	D3D12_GPU_VIRTUAL_ADDRESS gpuMemAddr = 0;
+	BYTE* pSystemMemAddr = nullptr;
+
+	if (AllocUploadMemory(size, &gpuMemAddr, &pSystemMemAddr))
+	{
+		memcpy(pSystemMemAddr, pDATA, size);
+	}
+
+	return gpuMemAddr;
+}
+
+void ConstantBufferManager::FinishFrame(UINT64 fenceValue)
+{
+	m_UploadRing.FinishFrame(fenceValue);
+
+	for (UINT i = 0; i < m_RetiredBufferCount; ++i)
+	{
+		if (m_pRetiredBuffers[i].FenceValue == 0)
+		{
+			m_pRetiredBuffers[i].FenceValue = fenceValue;
+		}
+	}
+
+	for (int i = 0; i < ConstantBufferType_ConstantTypeCount; ++i)
+	{
 		m_ppConstantBufferPool[i]->Reset();
-#endif
+	}
+}
+
+void ConstantBufferManager::Retire(UINT64 completedFenceValue)
+{
+	m_UploadRing.Retire(completedFenceValue);
+
+	UINT i = 0;
+	while (i < m_RetiredBufferCount)
+	{
+		RetiredUploadBuffer* pRetired = m_pRetiredBuffers + i;
+		if (pRetired->FenceValue == 0 || pRetired->FenceValue > completedFenceValue)
+		{
+			++i;
+			continue;
+		}
+
+		CD3DX12_RANGE writeRange(0, 0);
+		pRetired->pResource->Unmap(0, &writeRange);
+		pRetired->pResource->Release();
+
+		--m_RetiredBufferCount;
+		m_pRetiredBuffers[i] = m_pRetiredBuffers[m_RetiredBufferCount];
 	}
 }
 
@@ -48,6 +145,29 @@ void ConstantBufferManager::Cleanup()
 			m_ppConstantBufferPool[i] = nullptr;
 		}
 	}
+
+	// ȣ  GPU   ¾ .
+	for (UINT i = 0; i < m_RetiredBufferCount; ++i)
+	{
+		CD3DX12_RANGE writeRange(0, 0);
+		m_pRetiredBuffers[i].pResource->Unmap(0, &writeRange);
+		m_pRetiredBuffers[i].pResource->Release();
+	}
+	m_RetiredBufferCount = 0;
+
+	if (m_pUploadBuffer)
+	{
+		CD3DX12_RANGE writeRange(0, 0);
+		m_pUploadBuffer->Unmap(0, &writeRange);
+		m_pSystemMemAddr = nullptr;
+
+		m_pUploadBuffer->Release();
+		m_pUploadBuffer = nullptr;
+	}
+	m_GPUMemAddr = 0;
+	m_UploadRing.Cleanup();
+
+	m_pDevice = nullptr;
 }
 
 ConstantBufferPool* ConstantBufferManager::GetConstantBufferPool(eConstantBufferType type)
@@ -57,3 +177,69 @@ ConstantBufferPool* ConstantBufferManager::GetConstantBufferPool(eConstantBuffer
 
 	return m_ppConstantBufferPool[type];
 }
+
+HRESULT ConstantBufferManager::createUploadBuffer(UINT64 size)
+{
+	_ASSERT(m_pDevice);
+	_ASSERT(!m_pUploadBuffer);
+
+	HRESULT hr = S_OK;
+
+	CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
+	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
+
+	// Create the constant buffer.
+	hr = m_pDevice->CreateCommittedResource(&heapProps,
+											D3D12_HEAP_FLAG_NONE,
+											&bufferDesc,
+											D3D12_RESOURCE_STATE_GENERIC_READ,
+											nullptr,
+											IID_PPV_ARGS(&m_pUploadBuffer));
+	if (FAILED(hr))
+	{
+		goto LB_RET;
+	}
+	m_pUploadBuffer->SetName(L"ConstantUploadRing");
+
+	// Map cpu pointer to gpu cb pointer.    mapping  .
+	{
+		CD3DX12_RANGE writeRange(0, 0);		// We do not intend to read from this resource on the CPU.
+		hr = m_pUploadBuffer->Map(0, &writeRange, (void**)(&m_pSystemMemAddr));
+		if (FAILED(hr))
+		{
+			SAFE_RELEASE(m_pUploadBuffer);
+			goto LB_RET;
+		}
+	}
+	m_GPUMemAddr = m_pUploadBuffer->GetGPUVirtualAddress();
+
+	m_UploadRing.Initialize(size);
+
+LB_RET:
+	return hr;
+}
+
+bool ConstantBufferManager::retireUploadBuffer()
+{
+	if (!m_pUploadBuffer)
+	{
+		return true;
+	}
+
+	if (m_RetiredBufferCount >= MAX_RETIRED_UPLOAD_BUFFER_COUNT)
+	{
+		//   ȿ ̸ŭ þ   .
+		__debugbreak();
+		return false;
+	}
+
+	m_pRetiredBuffers[m_RetiredBufferCount].pResource = m_pUploadBuffer;
+	m_pRetiredBuffers[m_RetiredBufferCount].FenceValue = 0;
+	++m_RetiredBufferCount;
+
+	m_pUploadBuffer = nullptr;
+	m_pSystemMemAddr = nullptr;
+	m_GPUMemAddr = 0;
+
+	return true;
+}
@@ -1,7 +1,14 @@
 #pragma once
 
 #include "ConstantBufferPool.h"
+#include "UploadRingAllocator.h"
 
+static const UINT CONSTANT_BUFFER_ALIGNMENT = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT; // 256.
+static const UINT MAX_RETIRED_UPLOAD_BUFFER_COUNT = 8;
+
+//  constant type ϳ upload ring  . 帶 ϳ.
+//   FinishFrame fence  ϰ,     Retire GPU   ȯ.
+//  ڶ 2 ũ  ۷ ٲٰ  ۴      .
 class ConstantBufferManager
 {
 public:
@@ -10,12 +17,39 @@ public:
 
 	void Initialize(ID3D12Device* pDevice, UINT maxCBVNum);
 
-	void Reset();
+	// 256byte ķ ߶ . root CBV   GPU ּҸ  .
+	bool AllocUploadMemory(UINT size, D3D12_GPU_VIRTUAL_ADDRESS* pOutGPUMemAddr, BYTE** ppOutSystemMemAddr);
+	// descriptor  data ø root CBV GPU ּҸ ȯ.
+	D3D12_GPU_VIRTUAL_ADDRESS UploadConstant(const void* pDATA, UINT size);
+
+	void FinishFrame(UINT64 fenceValue);
+	void Retire(UINT64 completedFenceValue);
 
 	void Cleanup();
 
 	ConstantBufferPool* GetConstantBufferPool(eConstantBufferType type);
+	inline UINT64 GetUploadBufferSize() { return m_UploadRing.GetCapacity(); }
+	inline UINT64 GetUsedUploadSize() { return m_UploadRing.GetUsedSize(); }
+
+protected:
+	HRESULT createUploadBuffer(UINT64 size);
+	bool retireUploadBuffer();
 
 private:
+	struct RetiredUploadBuffer
+	{
+		ID3D12Resource* pResource;
+		UINT64 FenceValue; // 0̸     ӿ  .
+	};
+
+	ID3D12Device* m_pDevice = nullptr;
 	ConstantBufferPool* m_ppConstantBufferPool[ConstantBufferType_ConstantTypeCount] = { nullptr, };
+
+	ID3D12Resource* m_pUploadBuffer = nullptr;
+	BYTE* m_pSystemMemAddr = nullptr;
+	D3D12_GPU_VIRTUAL_ADDRESS m_GPUMemAddr = 0;
+	UploadRingAllocator m_UploadRing;
+
+	RetiredUploadBuffer m_pRetiredBuffers[MAX_RETIRED_UPLOAD_BUFFER_COUNT] = { };
+	UINT m_RetiredBufferCount = 0;
 };
@@ -1,32 +1,20 @@
 #include "../pch.h"
+#include "ConstantBufferManager.h"
 #include "ConstantBufferPool.h"
 
-void ConstantBufferPool::Initialize(ID3D12Device* pDevice, eConstantBufferType type, UINT sizePerCBV, UINT maxCBVNum)
+void ConstantBufferPool::Initialize(ID3D12Device* pDevice, ConstantBufferManager* pManager, eConstantBufferType type, UINT sizePerCBV, UINT maxCBVNum)
 {
 	_ASSERT(pDevice);
+	_ASSERT(pManager);
 	_ASSERT(maxCBVNum > 0);
 
 	HRESULT hr = S_OK;
-	UINT byteWidth = 0;
 
+	m_pDevice = pDevice;
+	m_pManager = pManager;
 	m_ConstantBufferType = type;
 	m_MaxCBVNum = maxCBVNum;
 	m_SizePerCBV = sizePerCBV;
-	byteWidth = sizePerCBV * m_MaxCBVNum;
-
-
-	CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(byteWidth);
-	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
-
-	// Create the constant buffer.
-	hr = pDevice->CreateCommittedResource(&heapProps,
-										  D3D12_HEAP_FLAG_NONE,
-										  &bufferDesc,
-										  D3D12_RESOURCE_STATE_GENERIC_READ,
-										  nullptr,
-										  IID_PPV_ARGS(&m_pResource));
-	BREAK_IF_FAILED(hr);
-	m_pResource->SetName(L"ConstantHeapInConstantBufferPool");
 
 
 	// Create descriptor heap.
@@ -39,47 +27,35 @@ void ConstantBufferPool::Initialize(ID3D12Device* pDevice, eConstantBufferType t
 	BREAK_IF_FAILED(hr);
 
 
-	// Map cpu pointer to gpu cb pointer.
-	CD3DX12_RANGE writeRange(0, 0);		// We do not intend to write from this resource on the CPU.
-	m_pResource->Map(0, &writeRange, (void**)(&m_pSystemMemAddr));
-
-
 	m_pCBContainerList = new CBInfo[m_MaxCBVNum];
+	ZeroMemory(m_pCBContainerList, sizeof(CBInfo) * m_MaxCBVNum);
 
-
-	// Create CBVs.
-	D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
-	cbvDesc.BufferLocation = m_pResource->GetGPUVirtualAddress();
-	cbvDesc.SizeInBytes = m_SizePerCBV;
-
-	BYTE* pSystemMemPtr = m_pSystemMemAddr;
 	CD3DX12_CPU_DESCRIPTOR_HANDLE heapHandle(m_pCBVHeap->GetCPUDescriptorHandleForHeapStart());
-
 	UINT descriptorSize = pDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 	for (UINT i = 0; i < m_MaxCBVNum; ++i)
 	{
-		pDevice->CreateConstantBufferView(&cbvDesc, heapHandle);
-
 		m_pCBContainerList[i].CBVHandle = heapHandle;
-		m_pCBContainerList[i].GPUMemAddr = cbvDesc.BufferLocation;
-		m_pCBContainerList[i].pSystemMemAddr = pSystemMemPtr;
-
 		heapHandle.Offset(1, descriptorSize);
-		cbvDesc.BufferLocation += m_SizePerCBV;
-		pSystemMemPtr += m_SizePerCBV;
 	}
 }
 
 CBInfo* ConstantBufferPool::AllocCB()
 {
-	CBInfo* pCB = nullptr;
+	CBInfo* pCB = m_pCBContainerList + (m_AllocatedCBVNum % m_MaxCBVNum);
 
-	if (m_AllocatedCBVNum >= m_MaxCBVNum)
+	if (!m_pManager->AllocUploadMemory(m_SizePerCBV, &pCB->GPUMemAddr, &pCB->pSystemMemAddr))
 	{
+		pCB = nullptr;
 		goto LB_RETURN;
 	}
 
-	pCB = m_pCBContainerList + m_AllocatedCBVNum;
+	// Create CBV.
+	{
+		D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
+		cbvDesc.BufferLocation = pCB->GPUMemAddr;
+		cbvDesc.SizeInBytes = m_SizePerCBV;
+		m_pDevice->CreateConstantBufferView(&cbvDesc, pCB->CBVHandle);
+	}
 	++m_AllocatedCBVNum;
 
 LB_RETURN:
@@ -98,13 +74,7 @@ void ConstantBufferPool::Cleanup()
 		m_pCBContainerList = nullptr;
 	}
 	SAFE_RELEASE(m_pCBVHeap);
-	if (m_pResource)
-	{
-		CD3DX12_RANGE writeRange(0, 0);
-		m_pResource->Unmap(0, &writeRange);
-		m_pSystemMemAddr = nullptr;
 
-		m_pResource->Release();
-		m_pResource = nullptr;
-	}
+	m_pManager = nullptr;
+	m_pDevice = nullptr;
 }
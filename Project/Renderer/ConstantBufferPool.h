@@ -1,9 +1,11 @@
 #pragma once
 
+class ConstantBufferManager;
+
 struct CBInfo
 {
 	D3D12_CPU_DESCRIPTOR_HANDLE CBVHandle;
-	D3D12_GPU_VIRTUAL_ADDRESS GPUMemAddr;
+	D3D12_GPU_VIRTUAL_ADDRESS GPUMemAddr; // root CBV ٷ ѱ  .
 	BYTE* pSystemMemAddr;
 };
 class ConstantBufferPool
@@ -12,19 +14,23 @@ public:
 	ConstantBufferPool() = default;
 	~ConstantBufferPool() { Cleanup(); }
 
-	void Initialize(ID3D12Device* pDevice, eConstantBufferType type, UINT sizePerCBV, UINT maxCBVNum);
+	void Initialize(ID3D12Device* pDevice, ConstantBufferManager* pManager, eConstantBufferType type, UINT sizePerCBV, UINT maxCBVNum);
 
+	// ޸𸮴 manager upload ring ߶ .
+	// CBV shader  ʴ heap  ȣڰ ٷ  Ƿ, maxCBVNum  slot  .
 	CBInfo* AllocCB();
 
 	inline void Reset() { m_AllocatedCBVNum = 0; }
 
 	void Cleanup();
 
+	inline UINT GetAllocatedCBVNum() { return m_AllocatedCBVNum; }
+
 private:
+	ID3D12Device* m_pDevice = nullptr;
+	ConstantBufferManager* m_pManager = nullptr;
 	CBInfo* m_pCBContainerList = nullptr;
 	ID3D12DescriptorHeap* m_pCBVHeap = nullptr;
-	ID3D12Resource* m_pResource = nullptr;
-	BYTE* m_pSystemMemAddr = nullptr;
 
 	eConstantBufferType m_ConstantBufferType = ConstantBufferType_ConstantTypeCount;
 	UINT m_SizePerCBV = 0;
@@ -25,6 +25,10 @@ ALIGN(16) struct MeshConstant
 	float HeightScale = 0.0f;
 	float WindTrunk = 0.0f;
 	float WindLeaves = 0.0f;
+	Vector3 PositionScale = Vector3(1.0f); //  skinned vertex ġ .
+	float Dummy0 = 0.0f;
+	Vector3 PositionBias = Vector3(0.0f);
+	float Dummy1 = 0.0f;
 };
 ALIGN(16) struct MaterialConstant
 {
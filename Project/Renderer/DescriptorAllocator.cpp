@@ -28,10 +28,12 @@ UINT DescriptorAllocator::AllocDescriptorHandle(D3D12_CPU_DESCRIPTOR_HANDLE* pOu
 {
 	_ASSERT(pOutCPUHandle);
 
-	UINT index = m_IndexCreator.Alloc();
-	if (index == -1)
+	ULONG index;
+	if (!m_IndexCreator.Alloc(&index))
 	{
 		__debugbreak();
+		pOutCPUHandle->ptr = 0;
+		return (UINT)INDEX_CREATOR_INVALID_INDEX;
 	}
 
 	CD3DX12_CPU_DESCRIPTOR_HANDLE DescriptorHandle(m_pHeap->GetCPUDescriptorHandleForHeapStart(), index, m_DescriptorSize);
@@ -0,0 +1,85 @@
+#include "../pch.h"
+#include "DescriptorTableRetireQueue.h"
+
+void DescriptorTableRetireQueue::Initialize(UINT maxTableCount)
+{
+	_ASSERT(maxTableCount > 0);
+
+	m_MaxTableCount = maxTableCount;
+	m_pRetiredTables = (RetiredDescriptorTable*)malloc(sizeof(RetiredDescriptorTable) * m_MaxTableCount);
+	ZeroMemory(m_pRetiredTables, sizeof(RetiredDescriptorTable) * m_MaxTableCount);
+	m_FirstRetiredTable = 0;
+	m_RetiredTableCount = 0;
+}
+
+void DescriptorTableRetireQueue::Push(UINT tableIndex)
+{
+	_ASSERT(tableIndex < m_MaxTableCount);
+	_ASSERT(m_RetiredTableCount < m_MaxTableCount);
+
+	RetiredDescriptorTable* pRetired = m_pRetiredTables + (m_FirstRetiredTable + m_RetiredTableCount) % m_MaxTableCount;
+	pRetired->FenceValue = 0;
+	pRetired->TableIndex = tableIndex;
+	++m_RetiredTableCount;
+}
+
+void DescriptorTableRetireQueue::FinishFrame(UINT64 fenceValue)
+{
+	_ASSERT(fenceValue != 0);
+
+	// ڿ    ͸ ã .
+	for (UINT i = m_RetiredTableCount; i > 0; --i)
+	{
+		RetiredDescriptorTable* pRetired = m_pRetiredTables + (m_FirstRetiredTable + i - 1) % m_MaxTableCount;
+		if (pRetired->FenceValue != 0)
+		{
+			break;
+		}
+		pRetired->FenceValue = fenceValue;
+	}
+}
+
+void DescriptorTableRetireQueue::Retire(UINT64 completedFenceValue, IndexCreator* pIndexCreator)
+{
+	_ASSERT(pIndexCreator);
+
+	while (m_RetiredTableCount > 0)
+	{
+		RetiredDescriptorTable* pRetired = m_pRetiredTables + m_FirstRetiredTable;
+		if (pRetired->FenceValue == 0 || pRetired->FenceValue > completedFenceValue)
+		{
+			break;
+		}
+
+		pIndexCreator->Free(pRetired->TableIndex);
+
+		m_FirstRetiredTable = (m_FirstRetiredTable + 1) % m_MaxTableCount;
+		--m_RetiredTableCount;
+	}
+}
+
+void DescriptorTableRetireQueue::RetireAll(IndexCreator* pIndexCreator)
+{
+	_ASSERT(pIndexCreator);
+
+	while (m_RetiredTableCount > 0)
+	{
+		pIndexCreator->Free(m_pRetiredTables[m_FirstRetiredTable].TableIndex);
+		m_FirstRetiredTable = (m_FirstRetiredTable + 1) % m_MaxTableCount;
+		--m_RetiredTableCount;
+	}
+}
+
+void DescriptorTableRetireQueue::Cleanup()
+{
+	_ASSERT(m_RetiredTableCount == 0);
+
+	if (m_pRetiredTables)
+	{
+		free(m_pRetiredTables);
+		m_pRetiredTables = nullptr;
+	}
+	m_MaxTableCount = 0;
+	m_FirstRetiredTable = 0;
+	m_RetiredTableCount = 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../Util/IndexCreator.h"
+
+// Free descriptor table index GPU     δ ring. device  ܵ  .
+// Push  index FinishFrame fence  ݰ,
+// Retire GPU  fence տ IndexCreator ȯ.
+
+struct RetiredDescriptorTable
+{
+	UINT64 FenceValue; // 0̸  frame  .
+	UINT TableIndex;
+};
+
+class DescriptorTableRetireQueue
+{
+public:
+	DescriptorTableRetireQueue() = default;
+	~DescriptorTableRetireQueue() { Cleanup(); }
+
+	// Ҵ table    Ƿ maxTableCount ũ .
+	void Initialize(UINT maxTableCount);
+
+	void Push(UINT tableIndex);
+
+	// ݱ Push index fenceValue .
+	void FinishFrame(UINT64 fenceValue);
+	// completedFenceValue Ϸ  index pIndexCreator ȯ.
+	void Retire(UINT64 completedFenceValue, IndexCreator* pIndexCreator);
+	//  ó GPU idle  fence   ȯ.
+	void RetireAll(IndexCreator* pIndexCreator);
+
+	void Cleanup();
+
+	inline UINT GetPendingCount() { return m_RetiredTableCount; }
+
+private:
+	RetiredDescriptorTable* m_pRetiredTables = nullptr;
+	UINT m_MaxTableCount = 0;
+	UINT m_FirstRetiredTable = 0;
+	UINT m_RetiredTableCount = 0;
+};
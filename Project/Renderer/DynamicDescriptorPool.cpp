@@ -1,4 +1,5 @@
 #include "../pch.h"
+#include "ShaderVisibleDescriptorHeap.h"
 #include "DynamicDescriptorPool.h"
 
 void DynamicDescriptorPool::Initialize(ID3D12Device5* pDevice, UINT maxDescriptorCount)
@@ -23,6 +24,22 @@ void DynamicDescriptorPool::Initialize(ID3D12Device5* pDevice, UINT maxDescripto
 	m_GPUDescriptorHandle = m_pDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
 }
 
+void DynamicDescriptorPool::Initialize(ID3D12Device5* pDevice, ShaderVisibleDescriptorHeap* pSharedHeap, UINT rangeIndex)
+{
+	_ASSERT(pDevice);
+	_ASSERT(pSharedHeap);
+
+	m_pDevice = pDevice;
+	m_MaxDescriptorCount = pSharedHeap->GetDescriptorCountPerDynamicRange();
+	m_CBVSRVUAVDescriptorSize = m_pDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+	// Cleanup Ȱ Releaseϵ   .
+	m_pDescriptorHeap = pSharedHeap->GetDescriptorHeap();
+	m_pDescriptorHeap->AddRef();
+
+	pSharedHeap->GetDynamicRange(rangeIndex, &m_CPUDescriptorHandle, &m_GPUDescriptorHandle);
+}
+
 HRESULT DynamicDescriptorPool::AllocDescriptorTable(D3D12_CPU_DESCRIPTOR_HANDLE* pOutCPUDescriptor, D3D12_GPU_DESCRIPTOR_HANDLE* pOutGPUDescriptorHandle, UINT descriptorCount)
 {
 	if (m_AllocatedDescriptorCount + (UINT64)descriptorCount > m_MaxDescriptorCount)
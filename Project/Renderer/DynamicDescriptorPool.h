@@ -1,5 +1,7 @@
 #pragma once
 
+class ShaderVisibleDescriptorHeap;
+
 class DynamicDescriptorPool
 {
 public:
@@ -7,6 +9,8 @@ public:
 	~DynamicDescriptorPool() { Cleanup(); }
 
 	void Initialize(ID3D12Device5* pDevice, UINT maxDescriptorCount);
+	// heap   ʰ  shader visible heap rangeIndex°  .
+	void Initialize(ID3D12Device5* pDevice, ShaderVisibleDescriptorHeap* pSharedHeap, UINT rangeIndex);
 
 	HRESULT AllocDescriptorTable(D3D12_CPU_DESCRIPTOR_HANDLE* pOutCPUDescriptor, D3D12_GPU_DESCRIPTOR_HANDLE* pOutGPUDescriptorHandle, UINT descriptorCount);
 
@@ -15,6 +19,8 @@ public:
 	void Cleanup();
 
 	inline ID3D12DescriptorHeap* GetDescriptorHeap() { return m_pDescriptorHeap; }
+	// Reset  Ҵ descriptor . Ҵ descriptor  CopyDescriptorsSimple ä.
+	inline UINT GetAllocatedDescriptorCount() { return (UINT)m_AllocatedDescriptorCount; }
 
 private:
 	ID3D12Device* m_pDevice = nullptr;
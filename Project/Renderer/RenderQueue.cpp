@@ -4,10 +4,14 @@
 #include "../Model/SkinnedMeshModel.h"
 #include "RenderQueue.h"
 
-void RenderQueue::Initialize(UINT maxItemCount)
+void RenderQueue::Initialize(UINT maxItemCount, int renderPass)
 {
 	_ASSERT(maxItemCount > 0);
 
+	m_RenderPass = renderPass;
+	// post processing filter   ̹Ƿ  .
+	m_bSortItems = (renderPass != RenderPass_MainRender);
+
 	m_MaxBufferSize = sizeof(RenderItem) * maxItemCount;
 	m_pBuffer = (BYTE*)malloc(m_MaxBufferSize);
 #ifdef _DEBUG
@@ -17,6 +21,20 @@ void RenderQueue::Initialize(UINT maxItemCount)
 	}
 #endif
 	ZeroMemory(m_pBuffer, m_MaxBufferSize);
+
+	m_pSortedBuffer = (BYTE*)malloc(m_MaxBufferSize);
+	m_pSortKeys = (UINT64*)malloc(sizeof(UINT64) * maxItemCount * 2);
+	m_pSortIndices = (UINT*)malloc(sizeof(UINT) * maxItemCount * 2);
+#ifdef _DEBUG
+	if (!m_pSortedBuffer || !m_pSortKeys || !m_pSortIndices)
+	{
+		__debugbreak();
+	}
+#endif
+
+	// item ϳ chunk ϳ ִ.   ε .
+	m_pChunkStartIndices = (UINT*)malloc(sizeof(UINT) * (maxItemCount + 1));
+	ZeroMemory(m_pChunkStartIndices, sizeof(UINT) * (maxItemCount + 1));
 }
 
 bool RenderQueue::Add(const RenderItem* pItem)
@@ -31,9 +49,26 @@ bool RenderQueue::Add(const RenderItem* pItem)
 
 	// allocated and return.
 	{
-		BYTE* pDest = m_pBuffer + m_AllocatedSize;
+		RenderItem* pDest = (RenderItem*)(m_pBuffer + m_AllocatedSize);
 		memcpy(pDest, pItem, sizeof(RenderItem));
+
+		UINT materialID = 0;
+		switch (pItem->ModelType)
+		{
+			case RenderObjectType_DefaultType:
+			case RenderObjectType_SkinnedType:
+			case RenderObjectType_SkyboxType:
+			case RenderObjectType_MirrorType:
+				materialID = ((Model*)pItem->pObjectHandle)->GetMaterialSortID();
+				break;
+
+			default:
+				break;
+		}
+		pDest->SortKey = MakeRenderSortKey(m_RenderPass, pItem->SortLayer, pItem->PSOType, materialID, pItem->Depth);
+
 		m_AllocatedSize += sizeof(RenderItem);
+		m_TotalCost += pItem->Cost;
 		++m_RenderObjectCount;
 		bRet = true;
 	}
@@ -42,35 +77,75 @@ LB_RETURN:
 	return bRet;
 }
 
-UINT RenderQueue::Process(UINT threadIndex, ID3D12CommandQueue* pCommandQueue, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList)
+void RenderQueue::Prepare(UINT workerCount)
+{
+	_ASSERT(workerCount > 0 && workerCount <= MAX_RENDER_THREAD_COUNT);
+
+	if (m_bSortItems)
+	{
+		sortItems();
+	}
+
+	//  4  chunk ư ǥ  .
+	//   尡  chunk Ƿ ſ item   常 ʾ .
+	const UINT CHUNKS_PER_WORKER = 4;
+	UINT targetCost = m_TotalCost / (workerCount * CHUNKS_PER_WORKER);
+	if (targetCost == 0)
+	{
+		targetCost = 1;
+	}
+
+	const RenderItem* pItems = (const RenderItem*)m_pBuffer;
+	UINT accumulatedCost = 0;
+	m_ChunkCount = 0;
+	for (UINT i = 0; i < m_RenderObjectCount; ++i)
+	{
+		if (accumulatedCost == 0)
+		{
+			m_pChunkStartIndices[m_ChunkCount] = i;
+			++m_ChunkCount;
+		}
+
+		accumulatedCost += pItems[i].Cost;
+		if (accumulatedCost >= targetCost)
+		{
+			accumulatedCost = 0;
+		}
+	}
+	m_pChunkStartIndices[m_ChunkCount] = m_RenderObjectCount;
+
+	m_NextChunkIndex = 0;
+	ZeroMemory(m_pProcessedCosts, sizeof(m_pProcessedCosts));
+	ZeroMemory(m_pStateBindCounts, sizeof(m_pStateBindCounts));
+}
+
+UINT RenderQueue::Process(UINT threadIndex, RenderQueueCommandLists* pOutCommandLists, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList)
 {
 	_ASSERT(threadIndex >= 0 && threadIndex < MAX_RENDER_THREAD_COUNT);
-	_ASSERT(pCommandQueue);
+	_ASSERT(pOutCommandLists);
 	_ASSERT(pCommandListPool);
 	_ASSERT(pManager);
 	_ASSERT(pDescriptorPool);
 	_ASSERT(pConstantBufferManager);
 
-	ID3D12GraphicsCommandList* ppCommandLists[64] = { };
-	int commandListCount = 0;
+	const UINT FIRST_COMMAND_LIST_INDEX = pOutCommandLists->Count;
 
 	ID3D12GraphicsCommandList* pCommandList = nullptr;
 	int processedCount = 0;
 	int processedPerCommandList = 0;
 	const RenderItem* pRenderItem = nullptr;
+	RenderQueueCursor cursor = { 0, 0, 0 };
+	ID3D12GraphicsCommandList* pBoundCommandList = nullptr;
+	int boundPSOType = -1;
 
-	while (pRenderItem = dispatch())
+	while (pRenderItem = dispatch(&cursor))
 	{
 		pCommandList = pCommandListPool->GetCurrentCommandList();
 
-		ID3D12DescriptorHeap* ppDescriptorHeaps[2] =
+		if (updateBoundState(threadIndex, pCommandList, pDescriptorPool, pManager, pRenderItem, &pBoundCommandList, &boundPSOType))
 		{
-			pDescriptorPool->GetDescriptorHeap(),
-			pManager->m_pSamplerHeap,
-		};
-		pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
-
-		pManager->SetCommonState(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, pRenderItem->PSOType);
+			pManager->SetCommonState(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, pRenderItem->PSOType);
+		}
 		switch (pRenderItem->ModelType)
 		{
 			case RenderObjectType_DefaultType:
@@ -100,49 +175,51 @@ UINT RenderQueue::Process(UINT threadIndex, ID3D12CommandQueue* pCommandQueue, C
 		if (processedPerCommandList > processCountPerCommandList)
 		{
 			pCommandListPool->Close();
-			ppCommandLists[commandListCount] = pCommandList;
-			++commandListCount;
+			_ASSERT(pOutCommandLists->Count < MAX_RENDER_QUEUE_COMMAND_LIST_COUNT);
+			pOutCommandLists->ppCommandLists[pOutCommandLists->Count] = pCommandList;
+			++pOutCommandLists->Count;
 			pCommandList = nullptr;
 			processedPerCommandList = 0;
+			pBoundCommandList = nullptr;
 		}
 	}
 
 	if (processedPerCommandList)
 	{
 		pCommandListPool->Close();
-		ppCommandLists[commandListCount] = pCommandList;
-		++commandListCount;
+		_ASSERT(pOutCommandLists->Count < MAX_RENDER_QUEUE_COMMAND_LIST_COUNT);
+		pOutCommandLists->ppCommandLists[pOutCommandLists->Count] = pCommandList;
+		++pOutCommandLists->Count;
 		pCommandList = nullptr;
 		processedPerCommandList = 0;
 	}
-	if (commandListCount)
-	{
-		pCommandQueue->ExecuteCommandLists(commandListCount, (ID3D12CommandList**)ppCommandLists);
-	}
-	
-	m_RenderObjectCount = 0;
-	return commandListCount;
+
+	m_pProcessedCosts[threadIndex] += cursor.ProcessedCost;
+	return pOutCommandLists->Count - FIRST_COMMAND_LIST_INDEX;
 }
 
-UINT RenderQueue::ProcessLight(UINT threadIndex, ID3D12CommandQueue* pCommandQueue, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList)
+UINT RenderQueue::ProcessLight(UINT threadIndex, RenderQueueCommandLists* pOutCommandLists, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList)
 {
 	_ASSERT(threadIndex >= 0 && threadIndex < MAX_RENDER_THREAD_COUNT);
-	_ASSERT(pCommandQueue);
+	_ASSERT(pOutCommandLists);
 	_ASSERT(pCommandListPool);
 	_ASSERT(pManager);
 	_ASSERT(pDescriptorPool);
 	_ASSERT(pConstantBufferManager);
 
-	ID3D12GraphicsCommandList* ppCommandLists[64] = { };
-	int commandListCount = 0;
+	const UINT FIRST_COMMAND_LIST_INDEX = pOutCommandLists->Count;
 
 	ID3D12GraphicsCommandList* pCommandList = nullptr;
 	int processedCount = 0;
 	int processedPerCommandList = 0;
 	const RenderItem* pRenderItem = nullptr;
-	ConstantBufferPool* pLightConstantBufferPool = pConstantBufferManager->GetConstantBufferPool(ConstantBufferType_ShadowConstant);
+	RenderQueueCursor cursor = { 0, 0, 0 };
+	ID3D12GraphicsCommandList* pBoundCommandList = nullptr;
+	int boundPSOType = -1;
+	Light* pBoundLight = nullptr;
+	ID3D12GraphicsCommandList* pLightBoundCommandList = nullptr;
 
-	while (pRenderItem = dispatch())
+	while (pRenderItem = dispatch(&cursor))
 	{
 		pCommandList = pCommandListPool->GetCurrentCommandList();
 
@@ -151,36 +228,29 @@ UINT RenderQueue::ProcessLight(UINT threadIndex, ID3D12CommandQueue* pCommandQue
 		CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle;
 		ID3D12Resource* pDepthStencilResource = nullptr;
 
-		ID3D12DescriptorHeap* ppDescriptorHeaps[2] =
-		{
-			pDescriptorPool->GetDescriptorHeap(),
-			pManager->m_pSamplerHeap,
-		};
-		pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
-
-		CBInfo* pLightCB = pLightConstantBufferPool->AllocCB();
+		// root CBVθ Ƿ descriptor  ring ٷ ø.
 		ShadowConstant* pShadowConstantData = pCurLight->LightShadowMap.GetShadowConstantBufferDataForGSPtr();
+		D3D12_GPU_VIRTUAL_ADDRESS lightConstantAddr = pConstantBufferManager->UploadConstant(pShadowConstantData, sizeof(ShadowConstant));
 
-		// Upload constant buffer(mesh, material).
-		BYTE* pLightCBConstMem = pLightCB->pSystemMemAddr;
-		memcpy(pLightCBConstMem, &pShadowConstantData, sizeof(ShadowConstant));
-
-		pManager->SetCommonState(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, pRenderItem->PSOType);
+		if (updateBoundState(threadIndex, pCommandList, pDescriptorPool, pManager, pRenderItem, &pBoundCommandList, &boundPSOType))
+		{
+			pManager->SetCommonState(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, pRenderItem->PSOType);
+		}
 		switch (pCurLight->Property.LightType & (LIGHT_DIRECTIONAL | LIGHT_POINT | LIGHT_SPOT))
 		{
 			case LIGHT_DIRECTIONAL:
 				pShadowBuffer = pCurLight->LightShadowMap.GetDirectionalLightShadowBufferPtr();
-				pCommandList->SetGraphicsRootConstantBufferView(1, pLightCB->GPUMemAddr);
+				pCommandList->SetGraphicsRootConstantBufferView(1, lightConstantAddr);
 				break;
 
 			case LIGHT_POINT:
 				pShadowBuffer = pCurLight->LightShadowMap.GetPointLightShadowBufferPtr();
-				pCommandList->SetGraphicsRootConstantBufferView(1, pLightCB->GPUMemAddr);
+				pCommandList->SetGraphicsRootConstantBufferView(1, lightConstantAddr);
 				break;
 
 			case LIGHT_SPOT:
 				pShadowBuffer = pCurLight->LightShadowMap.GetSpotLightShadowBufferPtr();
-				pCommandList->SetGraphicsRootConstantBufferView(1, pLightCB->GPUMemAddr);
+				pCommandList->SetGraphicsRootConstantBufferView(1, lightConstantAddr);
 				break;
 
 			default:
@@ -190,8 +260,14 @@ UINT RenderQueue::ProcessLight(UINT threadIndex, ID3D12CommandQueue* pCommandQue
 		dsvHandle = pShadowBuffer->DSVHandle;
 		pDepthStencilResource = pShadowBuffer->pTextureResource;
 
-		pCurLight->LightShadowMap.SetViewportsAndScissorRect(pCommandList);
-		pCommandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
+		// light  ĵǾ Ƿ light ٲ  render target ٽ .
+		if (pCurLight != pBoundLight || pCommandList != pLightBoundCommandList)
+		{
+			pCurLight->LightShadowMap.SetViewportsAndScissorRect(pCommandList);
+			pCommandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
+			pBoundLight = pCurLight;
+			pLightBoundCommandList = pCommandList;
+		}
 
 		switch (pRenderItem->ModelType)
 		{
@@ -222,48 +298,48 @@ UINT RenderQueue::ProcessLight(UINT threadIndex, ID3D12CommandQueue* pCommandQue
 		if (processedPerCommandList > processCountPerCommandList)
 		{
 			pCommandListPool->Close();
-			ppCommandLists[commandListCount] = pCommandList;
-			++commandListCount;
+			_ASSERT(pOutCommandLists->Count < MAX_RENDER_QUEUE_COMMAND_LIST_COUNT);
+			pOutCommandLists->ppCommandLists[pOutCommandLists->Count] = pCommandList;
+			++pOutCommandLists->Count;
 			pCommandList = nullptr;
 			processedPerCommandList = 0;
+			pBoundCommandList = nullptr;
+			pLightBoundCommandList = nullptr;
 		}
 	}
 
 	if (processedPerCommandList)
 	{
 		pCommandListPool->Close();
-		ppCommandLists[commandListCount] = pCommandList;
-		++commandListCount;
+		_ASSERT(pOutCommandLists->Count < MAX_RENDER_QUEUE_COMMAND_LIST_COUNT);
+		pOutCommandLists->ppCommandLists[pOutCommandLists->Count] = pCommandList;
+		++pOutCommandLists->Count;
 		pCommandList = nullptr;
 		processedPerCommandList = 0;
 	}
-	if (commandListCount)
-	{
-		pCommandQueue->ExecuteCommandLists(commandListCount, (ID3D12CommandList**)ppCommandLists);
-	}
 
-	m_RenderObjectCount = 0;
-	return commandListCount;
+	m_pProcessedCosts[threadIndex] += cursor.ProcessedCost;
+	return pOutCommandLists->Count - FIRST_COMMAND_LIST_INDEX;
 }
 
-UINT RenderQueue::ProcessPostProcessing(UINT threadIndex, ID3D12CommandQueue* pCommandQueue, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList)
+UINT RenderQueue::ProcessPostProcessing(UINT threadIndex, RenderQueueCommandLists* pOutCommandLists, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList)
 {
 	_ASSERT(threadIndex >= 0 && threadIndex < MAX_RENDER_THREAD_COUNT);
-	_ASSERT(pCommandQueue);
+	_ASSERT(pOutCommandLists);
 	_ASSERT(pCommandListPool);
 	_ASSERT(pManager);
 	_ASSERT(pDescriptorPool);
 	_ASSERT(pConstantBufferManager);
 
-	ID3D12GraphicsCommandList* ppCommandLists[64] = { };
-	int commandListCount = 0;
+	const UINT FIRST_COMMAND_LIST_INDEX = pOutCommandLists->Count;
 
 	ID3D12GraphicsCommandList* pCommandList = nullptr;
 	int processedCount = 0;
 	int processedPerCommandList = 0;
 	const RenderItem* pRenderItem = nullptr;
+	RenderQueueCursor cursor = { 0, 0, 0 };
 
-	while (pRenderItem = dispatch())
+	while (pRenderItem = dispatch(&cursor))
 	{
 		pCommandList = pCommandListPool->GetCurrentCommandList();
 
@@ -291,8 +367,9 @@ UINT RenderQueue::ProcessPostProcessing(UINT threadIndex, ID3D12CommandQueue* pC
 		if (processedPerCommandList > processCountPerCommandList)
 		{
 			pCommandListPool->Close();
-			ppCommandLists[commandListCount] = pCommandList;
-			++commandListCount;
+			_ASSERT(pOutCommandLists->Count < MAX_RENDER_QUEUE_COMMAND_LIST_COUNT);
+			pOutCommandLists->ppCommandLists[pOutCommandLists->Count] = pCommandList;
+			++pOutCommandLists->Count;
 			pCommandList = nullptr;
 			processedPerCommandList = 0;
 		}
@@ -301,24 +378,24 @@ UINT RenderQueue::ProcessPostProcessing(UINT threadIndex, ID3D12CommandQueue* pC
 	if (processedPerCommandList)
 	{
 		pCommandListPool->Close();
-		ppCommandLists[commandListCount] = pCommandList;
-		++commandListCount;
+		_ASSERT(pOutCommandLists->Count < MAX_RENDER_QUEUE_COMMAND_LIST_COUNT);
+		pOutCommandLists->ppCommandLists[pOutCommandLists->Count] = pCommandList;
+		++pOutCommandLists->Count;
 		pCommandList = nullptr;
 		processedPerCommandList = 0;
 	}
-	if (commandListCount)
-	{
-		pCommandQueue->ExecuteCommandLists(commandListCount, (ID3D12CommandList**)ppCommandLists);
-	}
 
-	m_RenderObjectCount = 0;
-	return commandListCount;
+	m_pProcessedCosts[threadIndex] += cursor.ProcessedCost;
+	return pOutCommandLists->Count - FIRST_COMMAND_LIST_INDEX;
 }
 
 void RenderQueue::Reset()
 {
 	m_AllocatedSize = 0;
-	m_ReadBufferPos = 0;
+	m_RenderObjectCount = 0;
+	m_TotalCost = 0;
+	m_ChunkCount = 0;
+	m_NextChunkIndex = 0;
 }
 
 void RenderQueue::Cleanup()
@@ -328,23 +405,166 @@ void RenderQueue::Cleanup()
 		free(m_pBuffer);
 		m_pBuffer = nullptr;
 	}
+	if (m_pChunkStartIndices)
+	{
+		free(m_pChunkStartIndices);
+		m_pChunkStartIndices = nullptr;
+	}
+	if (m_pSortedBuffer)
+	{
+		free(m_pSortedBuffer);
+		m_pSortedBuffer = nullptr;
+	}
+	if (m_pSortKeys)
+	{
+		free(m_pSortKeys);
+		m_pSortKeys = nullptr;
+	}
+	if (m_pSortIndices)
+	{
+		free(m_pSortIndices);
+		m_pSortIndices = nullptr;
+	}
 	m_MaxBufferSize = 0;
 	m_AllocatedSize = 0;
-	m_ReadBufferPos = 0;
 	m_RenderObjectCount = 0;
+	m_TotalCost = 0;
+	m_ChunkCount = 0;
+	m_NextChunkIndex = 0;
 }
 
-const RenderItem* RenderQueue::dispatch()
+float RenderQueue::GetImbalance(UINT workerCount)
 {
-	const RenderItem* pItem = nullptr;
-	if (m_ReadBufferPos + sizeof(RenderItem) > m_AllocatedSize)
+	_ASSERT(workerCount > 0 && workerCount <= MAX_RENDER_THREAD_COUNT);
+
+	UINT maxCost = 0;
+	UINT totalCost = 0;
+	for (UINT i = 0; i < workerCount; ++i)
 	{
-		goto LB_RETURN;
+		totalCost += m_pProcessedCosts[i];
+		if (m_pProcessedCosts[i] > maxCost)
+		{
+			maxCost = m_pProcessedCosts[i];
+		}
+	}
+
+	if (!totalCost)
+	{
+		return 1.0f;
 	}
+	return (float)maxCost * (float)workerCount / (float)totalCost;
+}
 
-	pItem = (const RenderItem*)(m_pBuffer + m_ReadBufferPos);
-	m_ReadBufferPos += sizeof(RenderItem);
+void RenderQueue::GetStateBindCounts(RenderStateBindCounts* pOutCounts)
+{
+	_ASSERT(pOutCounts);
+
+	ZeroMemory(pOutCounts, sizeof(RenderStateBindCounts));
+	for (UINT i = 0; i < MAX_RENDER_THREAD_COUNT; ++i)
+	{
+		const RenderStateBindCounts* pCOUNTS = m_pStateBindCounts + i;
+		pOutCounts->IssuedPipelineStates += pCOUNTS->IssuedPipelineStates;
+		pOutCounts->AvoidedPipelineStates += pCOUNTS->AvoidedPipelineStates;
+		pOutCounts->IssuedRootSignatures += pCOUNTS->IssuedRootSignatures;
+		pOutCounts->AvoidedRootSignatures += pCOUNTS->AvoidedRootSignatures;
+		pOutCounts->IssuedDescriptorHeaps += pCOUNTS->IssuedDescriptorHeaps;
+		pOutCounts->AvoidedDescriptorHeaps += pCOUNTS->AvoidedDescriptorHeaps;
+	}
+}
+
+const RenderItem* RenderQueue::dispatch(RenderQueueCursor* pCursor)
+{
+	_ASSERT(pCursor);
+
+	//  ִ chunk   atomic cursor  chunk .  尡 ÿ ȣ .
+	if (pCursor->CurItemIndex >= pCursor->EndItemIndex)
+	{
+		UINT chunkIndex = (UINT)(_InterlockedIncrement(&m_NextChunkIndex) - 1);
+		if (chunkIndex >= m_ChunkCount)
+		{
+			return nullptr;
+		}
+
+		pCursor->CurItemIndex = m_pChunkStartIndices[chunkIndex];
+		pCursor->EndItemIndex = m_pChunkStartIndices[chunkIndex + 1];
+	}
+
+	const RenderItem* pItem = (const RenderItem*)m_pBuffer + pCursor->CurItemIndex;
+	++pCursor->CurItemIndex;
+	pCursor->ProcessedCost += pItem->Cost;
 
-LB_RETURN:
 	return pItem;
 }
+
+void RenderQueue::sortItems()
+{
+	if (m_RenderObjectCount < 2)
+	{
+		return;
+	}
+
+	const RenderItem* pSRC_ITEMS = (const RenderItem*)m_pBuffer;
+	RenderItem* pDestItems = (RenderItem*)m_pSortedBuffer;
+	UINT64* pKeys = m_pSortKeys;
+	UINT* pIndices = m_pSortIndices;
+	const UINT MAX_ITEM_COUNT = m_MaxBufferSize / sizeof(RenderItem);
+
+	for (UINT i = 0; i < m_RenderObjectCount; ++i)
+	{
+		pKeys[i] = pSRC_ITEMS[i].SortKey;
+		pIndices[i] = i;
+	}
+	RadixSortKeys(pKeys, pIndices, pKeys + MAX_ITEM_COUNT, pIndices + MAX_ITEM_COUNT, m_RenderObjectCount);
+
+	for (UINT i = 0; i < m_RenderObjectCount; ++i)
+	{
+		pDestItems[i] = pSRC_ITEMS[pIndices[i]];
+	}
+
+	BYTE* pTemp = m_pBuffer;
+	m_pBuffer = m_pSortedBuffer;
+	m_pSortedBuffer = pTemp;
+}
+
+bool RenderQueue::updateBoundState(UINT threadIndex, ID3D12GraphicsCommandList* pCommandList, DynamicDescriptorPool* pDescriptorPool, ResourceManager* pManager, const RenderItem* pRenderItem, ID3D12GraphicsCommandList** ppBoundCommandList, int* pBoundPSOType)
+{
+	_ASSERT(pCommandList);
+	_ASSERT(pRenderItem);
+	_ASSERT(ppBoundCommandList);
+	_ASSERT(pBoundPSOType);
+
+	RenderStateBindCounts* pCounts = m_pStateBindCounts + threadIndex;
+
+	//  command list ƹ µ Ƿ heap ٽ .
+	if (*ppBoundCommandList != pCommandList)
+	{
+		ID3D12DescriptorHeap* ppDescriptorHeaps[2] =
+		{
+			pDescriptorPool->GetDescriptorHeap(),
+			pManager->m_pSamplerHeap,
+		};
+		pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
+
+		*ppBoundCommandList = pCommandList;
+		*pBoundPSOType = -1;
+		++pCounts->IssuedDescriptorHeaps;
+	}
+	else
+	{
+		++pCounts->AvoidedDescriptorHeaps;
+	}
+
+	//  PSO root signature, PSO,  descriptor table  ״ ȿ.
+	//  table (global/light constant, shadow map )    ٲ .
+	if (*pBoundPSOType == (int)pRenderItem->PSOType)
+	{
+		++pCounts->AvoidedPipelineStates;
+		++pCounts->AvoidedRootSignatures;
+		return false;
+	}
+
+	*pBoundPSOType = pRenderItem->PSOType;
+	++pCounts->IssuedPipelineStates;
+	++pCounts->IssuedRootSignatures;
+	return true;
+}
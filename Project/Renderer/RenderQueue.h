@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ResourceManager.h"
+#include "RenderSortKey.h"
 
 class ResourceManager;
 
@@ -11,6 +12,37 @@ struct RenderItem
 	void* pObjectHandle;
 	void* pLight; // for shadow pass.
 	void* pFilter;
+	UINT Cost; // load balancing  . Model::GetRenderCost().
+	UINT SortLayer; // pass ȿ   ϴ . shadow pass light index.
+	float Depth; // view  Ÿ .   ȿ ʺ ׸.
+	UINT64 SortKey; // Add ä.
+};
+
+// 庰 ̹ ӿ  ȣ    п    .
+struct RenderStateBindCounts
+{
+	UINT IssuedPipelineStates;
+	UINT AvoidedPipelineStates;
+	UINT IssuedRootSignatures;
+	UINT AvoidedRootSignatures;
+	UINT IssuedDescriptorHeaps;
+	UINT AvoidedDescriptorHeaps;
+};
+
+// Process ϰ  command list. queue  ȣ  pass   .
+static const UINT MAX_RENDER_QUEUE_COMMAND_LIST_COUNT = 64;
+struct RenderQueueCommandLists
+{
+	ID3D12GraphicsCommandList* ppCommandLists[MAX_RENDER_QUEUE_COMMAND_LIST_COUNT];
+	UINT Count;
+};
+
+//  尡 ϳ queue  ó   尡  ִ б ġ.
+struct RenderQueueCursor
+{
+	UINT CurItemIndex;
+	UINT EndItemIndex;
+	UINT ProcessedCost;
 };
 
 class RenderQueue
@@ -19,25 +51,53 @@ public:
 	RenderQueue() = default;
 	~RenderQueue() { Cleanup(); }
 
-	void Initialize(UINT maxItemCount);
+	void Initialize(UINT maxItemCount, int renderPass);
 
 	bool Add(const RenderItem* pItem);
 
-	UINT Process(UINT threadIndex, ID3D12CommandQueue* pCommandQueue, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList);
-	UINT ProcessLight(UINT threadIndex, ID3D12CommandQueue* pCommandQueue, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList);
-	UINT ProcessPostProcessing(UINT threadIndex, ID3D12CommandQueue* pCommandQueue, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList);
+	// ó  main 忡 ȣ. sort key      chunk .
+	// chunk  ̹Ƿ    ¸  item ̾ ް .
+	void Prepare(UINT workerCount);
+
+	//  command list ݾƼ pOutCommandLists ڿ .  Ƿ  pass ÿ   .
+	UINT Process(UINT threadIndex, RenderQueueCommandLists* pOutCommandLists, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList);
+	UINT ProcessLight(UINT threadIndex, RenderQueueCommandLists* pOutCommandLists, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList);
+	UINT ProcessPostProcessing(UINT threadIndex, RenderQueueCommandLists* pOutCommandLists, CommandListPool* pCommandListPool, ResourceManager* pManager, DynamicDescriptorPool* pDescriptorPool, ConstantBufferManager* pConstantBufferManager, int processCountPerCommandList);
 
 	void Reset();
 
 	void Cleanup();
 
+	// ̹  庰 ó  max / . 1.0̸  յ.
+	float GetImbalance(UINT workerCount);
+	inline UINT GetProcessedCost(UINT threadIndex) { return m_pProcessedCosts[threadIndex]; }
+	inline UINT GetRenderObjectCount() { return m_RenderObjectCount; }
+	//   .
+	void GetStateBindCounts(RenderStateBindCounts* pOutCounts);
+
 protected:
-	const RenderItem* dispatch();
+	const RenderItem* dispatch(RenderQueueCursor* pCursor);
+	void sortItems();
+	// command list ٲ descriptor heap ɰ, SetCommonState ʿϸ true. ȣ/  .
+	bool updateBoundState(UINT threadIndex, ID3D12GraphicsCommandList* pCommandList, DynamicDescriptorPool* pDescriptorPool, ResourceManager* pManager, const RenderItem* pRenderItem, ID3D12GraphicsCommandList** ppBoundCommandList, int* pBoundPSOType);
 	
 private:
 	BYTE* m_pBuffer = nullptr;
+	BYTE* m_pSortedBuffer = nullptr;
+	UINT64* m_pSortKeys = nullptr;		// key 2 ũ.   radix sort scratch.
+	UINT* m_pSortIndices = nullptr;		// index 2 ũ.
+	int m_RenderPass = 0;
+	bool m_bSortItems = false;
 	UINT m_MaxBufferSize = 0;
 	UINT m_AllocatedSize = 0;
-	UINT m_ReadBufferPos = 0;
 	UINT m_RenderObjectCount = 0;
+	UINT m_TotalCost = 0;
+
+	// chunk i [m_pChunkStartIndices[i], m_pChunkStartIndices[i + 1])  item .
+	UINT* m_pChunkStartIndices = nullptr;
+	UINT m_ChunkCount = 0;
+	volatile LONG m_NextChunkIndex = 0;
+
+	UINT m_pProcessedCosts[MAX_RENDER_THREAD_COUNT] = { 0, };
+	RenderStateBindCounts m_pStateBindCounts[MAX_RENDER_THREAD_COUNT] = { };
 };
@@ -0,0 +1,152 @@
+#include "../pch.h"
+#include "RenderSortKey.h"
+
+eRootSignatureGroup GetRootSignatureGroup(int psoType)
+{
+	switch (psoType)
+	{
+		case RenderPSOType_Default:
+		case RenderPSOType_Skybox:
+		case RenderPSOType_MirrorBlend:
+		case RenderPSOType_ReflectionDefault:
+		case RenderPSOType_ReflectionSkybox:
+			return RootSignatureGroup_Default;
+
+		case RenderPSOType_Skinned:
+		case RenderPSOType_ReflectionSkinned:
+			return RootSignatureGroup_Skinned;
+
+		case RenderPSOType_StencilMask:
+		case RenderPSOType_DepthOnlyDefault:
+			return RootSignatureGroup_DepthOnly;
+
+		case RenderPSOType_DepthOnlySkinned:
+			return RootSignatureGroup_DepthOnlySkinned;
+
+		case RenderPSOType_DepthOnlyCubeDefault:
+		case RenderPSOType_DepthOnlyCascadeDefault:
+			return RootSignatureGroup_DepthOnlyAround;
+
+		case RenderPSOType_DepthOnlyCubeSkinned:
+		case RenderPSOType_DepthOnlyCascadeSkinned:
+			return RootSignatureGroup_DepthOnlyAroundSkinned;
+
+		case RenderPSOType_Sampling:
+		case RenderPSOType_BloomDown:
+		case RenderPSOType_BloomUp:
+			return RootSignatureGroup_Sampling;
+
+		case RenderPSOType_Combine:
+			return RootSignatureGroup_Combine;
+
+		case RenderPSOType_Wire:
+			return RootSignatureGroup_Wire;
+
+		default:
+			__debugbreak();
+			break;
+	}
+
+	return RootSignatureGroup_Default;
+}
+
+UINT64 MakeRenderSortKey(UINT renderPass, UINT layer, int psoType, UINT materialID, float depth)
+{
+	const UINT64 PASS_MASK = (1ull << RENDER_SORT_KEY_PASS_BITS) - 1;
+	const UINT64 LAYER_MASK = (1ull << RENDER_SORT_KEY_LAYER_BITS) - 1;
+	const UINT64 ROOT_SIGNATURE_MASK = (1ull << RENDER_SORT_KEY_ROOT_SIGNATURE_BITS) - 1;
+	const UINT64 PSO_MASK = (1ull << RENDER_SORT_KEY_PSO_BITS) - 1;
+	const UINT64 MATERIAL_MASK = (1ull << RENDER_SORT_KEY_MATERIAL_BITS) - 1;
+
+	//  NaN  .
+	UINT depthBits = 0;
+	if (depth > 0.0f)
+	{
+		memcpy(&depthBits, &depth, sizeof(float));
+		depthBits >>= (32 - RENDER_SORT_KEY_DEPTH_BITS);
+	}
+
+	UINT64 key = (UINT64)renderPass & PASS_MASK;
+	key = (key << RENDER_SORT_KEY_LAYER_BITS) | ((UINT64)layer & LAYER_MASK);
+	key = (key << RENDER_SORT_KEY_ROOT_SIGNATURE_BITS) | ((UINT64)GetRootSignatureGroup(psoType) & ROOT_SIGNATURE_MASK);
+	key = (key << RENDER_SORT_KEY_PSO_BITS) | ((UINT64)psoType & PSO_MASK);
+	key = (key << RENDER_SORT_KEY_MATERIAL_BITS) | ((UINT64)materialID & MATERIAL_MASK);
+	key = (key << RENDER_SORT_KEY_DEPTH_BITS) | (UINT64)depthBits;
+
+	return key;
+}
+
+void RadixSortKeys(UINT64* pKeys, UINT* pValues, UINT64* pScratchKeys, UINT* pScratchValues, UINT count)
+{
+	_ASSERT(pKeys);
+	_ASSERT(pValues);
+	_ASSERT(pScratchKeys);
+	_ASSERT(pScratchValues);
+
+	const UINT DIGIT_COUNT = sizeof(UINT64);
+	const UINT BUCKET_COUNT = 256;
+
+	if (count < 2)
+	{
+		return;
+	}
+
+	//   ȸ 8ڸ ׷  .
+	UINT ppHistograms[DIGIT_COUNT][BUCKET_COUNT];
+	ZeroMemory(ppHistograms, sizeof(ppHistograms));
+	for (UINT i = 0; i < count; ++i)
+	{
+		UINT64 key = pKeys[i];
+		for (UINT digit = 0; digit < DIGIT_COUNT; ++digit)
+		{
+			++ppHistograms[digit][(key >> (digit * 8)) & 0xff];
+		}
+	}
+
+	UINT64* pSrcKeys = pKeys;
+	UINT* pSrcValues = pValues;
+	UINT64* pDestKeys = pScratchKeys;
+	UINT* pDestValues = pScratchValues;
+
+	for (UINT digit = 0; digit < DIGIT_COUNT; ++digit)
+	{
+		UINT* pHistogram = ppHistograms[digit];
+		const UINT SHIFT = digit * 8;
+
+		//  key  bucket̸  ٲ .
+		if (pHistogram[(pSrcKeys[0] >> SHIFT) & 0xff] == count)
+		{
+			continue;
+		}
+
+		UINT offset = 0;
+		for (UINT bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+		{
+			UINT bucketCount = pHistogram[bucket];
+			pHistogram[bucket] = offset;
+			offset += bucketCount;
+		}
+
+		for (UINT i = 0; i < count; ++i)
+		{
+			UINT64 key = pSrcKeys[i];
+			UINT destIndex = pHistogram[(key >> SHIFT) & 0xff]++;
+			pDestKeys[destIndex] = key;
+			pDestValues[destIndex] = pSrcValues[i];
+		}
+
+		UINT64* pTempKeys = pSrcKeys;
+		pSrcKeys = pDestKeys;
+		pDestKeys = pTempKeys;
+
+		UINT* pTempValues = pSrcValues;
+		pSrcValues = pDestValues;
+		pDestValues = pTempValues;
+	}
+
+	if (pSrcKeys != pKeys)
+	{
+		memcpy(pKeys, pSrcKeys, sizeof(UINT64) * count);
+		memcpy(pValues, pSrcValues, sizeof(UINT) * count);
+	}
+}
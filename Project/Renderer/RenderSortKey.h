@@ -0,0 +1,36 @@
+#pragma once
+
+// render queue  Ű radix sort. D3D   CPU ܵ  .
+//  bit pass | layer | root signature | PSO | material | depth  
+//    ¸  item ӵǵ .
+
+enum eRootSignatureGroup
+{
+	RootSignatureGroup_Default = 0,
+	RootSignatureGroup_Skinned,
+	RootSignatureGroup_DepthOnly,
+	RootSignatureGroup_DepthOnlySkinned,
+	RootSignatureGroup_DepthOnlyAround,
+	RootSignatureGroup_DepthOnlyAroundSkinned,
+	RootSignatureGroup_Sampling,
+	RootSignatureGroup_Combine,
+	RootSignatureGroup_Wire,
+	RootSignatureGroup_Count,
+};
+
+static const UINT RENDER_SORT_KEY_PASS_BITS = 4;
+static const UINT RENDER_SORT_KEY_LAYER_BITS = 4;
+static const UINT RENDER_SORT_KEY_ROOT_SIGNATURE_BITS = 4;
+static const UINT RENDER_SORT_KEY_PSO_BITS = 8;
+static const UINT RENDER_SORT_KEY_MATERIAL_BITS = 20;
+static const UINT RENDER_SORT_KEY_DEPTH_BITS = 24;
+
+// ResourceManager::SetCommonState PSO ϴ root signature .
+eRootSignatureGroup GetRootSignatureGroup(int psoType);
+
+// depth 0 ̻.  float bit ǥ ũ  Ƿ  24bit ߶ .
+UINT64 MakeRenderSortKey(UINT renderPass, UINT layer, int psoType, UINT materialID, float depth);
+
+// pKeys  stable LSD radix sort(8bit ). pValues   ̵.
+// scratch count ũ ̻.  key  byte ڸ ǳʶ.  pKeys/pValues .
+void RadixSortKeys(UINT64* pKeys, UINT* pValues, UINT64* pScratchKeys, UINT* pScratchValues, UINT count);
@@ -4,38 +4,43 @@
 
 class Renderer;
 
-UINT WINAPI RenderThread(void* pArg)
+void RenderPassJob(void* pArg, UINT workerIndex)
 {
-	RenderThreadDesc* pDesc = (RenderThreadDesc*)pArg;
+	RenderJobDesc* pDesc = (RenderJobDesc*)pArg;
 	Renderer* pRenderer = pDesc->pRenderer;
 	ResourceManager* pManager = pDesc->pResourceManager;
-	UINT threadIndex = pDesc->ThreadIndex;
-	const HANDLE* phEventList = pDesc->hEventList;
 
-	while (true)
+	switch (pDesc->RenderPass)
 	{
-		int eventIndex = WaitForMultipleObjects(RenderThreadEventType_Count, phEventList, FALSE, INFINITE);
+		case RenderPass_Shadow:
+		case RenderPass_Object:
+		case RenderPass_Mirror:
+		case RenderPass_Collider:
+		case RenderPass_MainRender:
+			pRenderer->ProcessByThread(workerIndex, pDesc->QueueIndex, pManager, pDesc->RenderPass);
+			break;
 
-		switch (eventIndex)
-		{
-			case RenderThreadEventType_Shadow:
-			case RenderThreadEventType_Object:
-			case RenderThreadEventType_Mirror:
-			case RenderThreadEventType_Collider:
-			case RenderThreadEventType_MainRender:
-				pRenderer->ProcessByThread(threadIndex, pManager, eventIndex);
-				break;
+		default:
+			__debugbreak();
+			break;
+	}
+}
 
-			case RenderThreadEventType_Desctroy:
-				goto LB_EXIT;
+void RenderStageJob(void* pArg, UINT workerIndex)
+{
+	RenderJobDesc* pDesc = (RenderJobDesc*)pArg;
+	Renderer* pRenderer = pDesc->pRenderer;
 
-			default:
-				__debugbreak();
-				break;
-		}
-	}
+	switch (pDesc->RenderJobStage)
+	{
+		case RenderJobStage_ShadowBarrier:
+		case RenderJobStage_MirrorStencil:
+		case RenderJobStage_MirrorBlendAndPost:
+			pRenderer->ProcessRenderStage(workerIndex, pDesc->RenderJobStage);
+			break;
 
-LB_EXIT:
-	_endthreadex(0);
-	return 0;
+		default:
+			__debugbreak();
+			break;
+	}
 }
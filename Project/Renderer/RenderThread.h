@@ -2,13 +2,15 @@
 
 #include "../Graphics/EnumType.h"
 
-struct RenderThreadDesc
+// job system ѱ render job .
+struct RenderJobDesc
 {
 	Renderer* pRenderer;
 	ResourceManager* pResourceManager;
-	UINT ThreadIndex;
-	HANDLE hThread;
-	HANDLE hEventList[RenderThreadEventType_Count];
+	UINT QueueIndex;
+	int RenderPass;
+	int RenderJobStage;
 };
 
-UINT WINAPI RenderThread(void* pArg);
+void RenderPassJob(void* pArg, UINT workerIndex);
+void RenderStageJob(void* pArg, UINT workerIndex);
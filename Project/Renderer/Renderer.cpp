@@ -85,6 +85,19 @@ void Renderer::Update(const float DELTA_TIME)
 
 void Renderer::Render()
 {
+	//  frame    resource copy. ٷ ׸Ƿ graphics queue GPU ٸ.
+	//  Flush ticket ٸ. AssetLoader streaming batch IsTicketComplete Ȯ ڿ scene Ƿ graphics queue  .
+	if (m_pUploadManager->GetPendingCopyCount() > 0)
+	{
+		const UINT64 UPLOAD_TICKET = m_pUploadManager->Flush();
+		m_pUploadManager->WaitOnQueue(m_pCommandQueue, UPLOAD_TICKET);
+	}
+	m_pUploadManager->Retire();
+
+	updateMaterialTables();
+	cullScene();
+	selectMeshLODs();
+
 	beginRender();
 
 	renderShadowmap();
@@ -98,20 +111,26 @@ void Renderer::Render()
 	present();
 }
 
-void Renderer::ProcessByThread(UINT threadIndex, ResourceManager* pManager, int renderPass)
+void Renderer::ProcessByThread(UINT threadIndex, UINT queueIndex, ResourceManager* pManager, int renderPass)
 {
 	_ASSERT(threadIndex >= 0 && threadIndex < m_RenderThreadCount);
+	_ASSERT(queueIndex >= 0 && queueIndex < m_RenderThreadCount);
 	_ASSERT(pManager);
 
-	ID3D12CommandQueue* pCommandQueue = m_pCommandQueue;
+	// pass queue  job ϸ chunk   .
+	// command list/descriptor/constant buffer pool    worker  .
+	// ⼭ ϰ ݱ⸸ .  stage job pass  .
+	RenderQueue* pRenderQueue = m_ppRenderQueue[renderPass];
+	RenderQueueCommandLists* pRecordedCommandLists = &m_ppRecordedCommandLists[renderPass][queueIndex];
+
 	CommandListPool* pCommandListPool = m_pppCommandListPool[m_FrameIndex][threadIndex];
 	DynamicDescriptorPool* pDescriptorPool = m_pppDescriptorPool[m_FrameIndex][threadIndex];
-	ConstantBufferManager* pConstantBufferManager = m_pppConstantBufferManager[m_FrameIndex][threadIndex];
+	ConstantBufferManager* pConstantBufferManager = m_ppConstantBufferManager[threadIndex];
 
 	switch (renderPass)
 	{
 		case RenderPass_Shadow:
-			m_pppRenderQueue[renderPass][threadIndex]->ProcessLight(threadIndex, pCommandQueue, pCommandListPool, pManager, pDescriptorPool, pConstantBufferManager, 100);
+			pRenderQueue->ProcessLight(threadIndex, pRecordedCommandLists, pCommandListPool, pManager, pDescriptorPool, pConstantBufferManager, 100);
 			break;
 
 		case RenderPass_Object:
@@ -125,7 +144,7 @@ void Renderer::ProcessByThread(UINT threadIndex, ResourceManager* pManager, int
 			pCommandList->RSSetViewports(1, &m_ScreenViewport);
 			pCommandList->RSSetScissorRects(1, &m_ScissorRect);
 			pCommandList->OMSetRenderTargets(1, &floatBufferRtvHandle, FALSE, &dsvHandle);
-			m_pppRenderQueue[renderPass][threadIndex]->Process(threadIndex, pCommandQueue, pCommandListPool, pManager, pDescriptorPool, pConstantBufferManager, 100);
+			pRenderQueue->Process(threadIndex, pRecordedCommandLists, pCommandListPool, pManager, pDescriptorPool, pConstantBufferManager, 100);
 		}
 		break;
 
@@ -133,11 +152,121 @@ void Renderer::ProcessByThread(UINT threadIndex, ResourceManager* pManager, int
 			__debugbreak();
 			break;
 	}
+}
+
+void Renderer::ProcessRenderStage(UINT threadIndex, int renderJobStage)
+{
+	_ASSERT(threadIndex >= 0 && threadIndex < m_RenderThreadCount);
+
+	CommandListPool* pCommandListPool = m_pppCommandListPool[m_FrameIndex][threadIndex];
+	DynamicDescriptorPool* pDescriptorPool = m_pppDescriptorPool[m_FrameIndex][threadIndex];
+	ConstantBufferManager* pConstantBufferManager = m_ppConstantBufferManager[threadIndex];
+	ID3D12DescriptorHeap* pRTVHeap = m_pRTVAllocator->GetDescriptorHeap();
+	ID3D12DescriptorHeap* pDSVHeap = m_pDSVAllocator->GetDescriptorHeap();
+	ID3D12DescriptorHeap* ppDescriptorHeaps[2] =
+	{
+		pDescriptorPool->GetDescriptorHeap(),
+		m_pResourceManager->m_pSamplerHeap,
+	};
 
-	long curActiveThreadCount = _InterlockedDecrement(&m_pActiveThreadCounts[renderPass]);
-	if (curActiveThreadCount == 0)
+	switch (renderJobStage)
 	{
-		SetEvent(m_phCompletedEvents[renderPass]);
+		case RenderJobStage_ShadowBarrier:
+		{
+			executeRecordedCommandLists(RenderPass_Shadow);
+
+			const int TOTAL_LIGHT_TYPE = LIGHT_DIRECTIONAL | LIGHT_POINT | LIGHT_SPOT;
+			ID3D12GraphicsCommandList* pCommandList = pCommandListPool->GetCurrentCommandList();
+
+			for (int i = 0; i < MAX_LIGHTS; ++i)
+			{
+				CD3DX12_RESOURCE_BARRIER barrier;
+				Light* pCurLight = &(*m_pLights)[i];
+
+				switch (pCurLight->Property.LightType & TOTAL_LIGHT_TYPE)
+				{
+					case LIGHT_DIRECTIONAL:
+						barrier = CD3DX12_RESOURCE_BARRIER::Transition(pCurLight->LightShadowMap.GetDirectionalLightShadowBufferPtr()->pTextureResource, D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_GENERIC_READ);
+						break;
+
+					case LIGHT_POINT:
+						barrier = CD3DX12_RESOURCE_BARRIER::Transition(pCurLight->LightShadowMap.GetPointLightShadowBufferPtr()->pTextureResource, D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_GENERIC_READ);
+						break;
+
+					case LIGHT_SPOT:
+						barrier = CD3DX12_RESOURCE_BARRIER::Transition(pCurLight->LightShadowMap.GetSpotLightShadowBufferPtr()->pTextureResource, D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_GENERIC_READ);
+						break;
+
+					default:
+						__debugbreak();
+						break;
+				}
+
+				pCommandList->ResourceBarrier(1, &barrier);
+			}
+			pCommandListPool->ClosedAndExecute(m_pCommandQueue);
+		}
+		break;
+
+		case RenderJobStage_MirrorStencil:
+		{
+			executeRecordedCommandLists(RenderPass_Object);
+
+			ID3D12GraphicsCommandList* pCommandList = pCommandListPool->GetCurrentCommandList();
+			CD3DX12_CPU_DESCRIPTOR_HANDLE floatBufferRtvHandle(pRTVHeap->GetCPUDescriptorHandleForHeapStart(), m_FloatBufferRTVOffset, m_pResourceManager->RTVDescriptorSize);
+			CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle(pDSVHeap->GetCPUDescriptorHandleForHeapStart());
+
+			m_pPostProcessor->SetViewportsAndScissorRects(pCommandList);
+			pCommandList->OMSetRenderTargets(1, &floatBufferRtvHandle, FALSE, &dsvHandle);
+			pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
+			m_pResourceManager->SetCommonState(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, RenderPSOType_StencilMask);
+			// ٴ(ſ) 񵿱 εǹǷ    .
+			if (m_pMirror)
+			{
+				m_pMirror->Render(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, m_pResourceManager, RenderPSOType_StencilMask);
+			}
+
+			pCommandListPool->ClosedAndExecute(m_pCommandQueue);
+		}
+		break;
+
+		case RenderJobStage_MirrorBlendAndPost:
+		{
+			executeRecordedCommandLists(RenderPass_Mirror);
+
+			// mirror blend process.
+			ID3D12GraphicsCommandList* pCommandList = pCommandListPool->GetCurrentCommandList();
+			CD3DX12_CPU_DESCRIPTOR_HANDLE floatBufferRtvHandle(pRTVHeap->GetCPUDescriptorHandleForHeapStart(), m_FloatBufferRTVOffset, m_pResourceManager->RTVDescriptorSize);
+			CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle(pDSVHeap->GetCPUDescriptorHandleForHeapStart());
+
+			m_pPostProcessor->SetViewportsAndScissorRects(pCommandList);
+			pCommandList->OMSetRenderTargets(1, &floatBufferRtvHandle, FALSE, &dsvHandle);
+			pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
+			m_pResourceManager->SetCommonState(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, RenderPSOType_MirrorBlend);
+			if (m_pMirror)
+			{
+				m_pMirror->Render(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, m_pResourceManager, RenderPSOType_MirrorBlend);
+			}
+
+			const CD3DX12_RESOURCE_BARRIER BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(m_pFloatBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_COMMON);
+			pCommandList->ResourceBarrier(1, &BARRIER);
+
+			pCommandListPool->ClosedAndExecute(m_pCommandQueue);
+
+			// postprocessing pass.
+			pCommandList = pCommandListPool->GetCurrentCommandList();
+			pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
+			m_pPostProcessor->Render(threadIndex, pCommandList, pDescriptorPool, pConstantBufferManager, m_pResourceManager, m_FrameIndex);
+
+			const CD3DX12_RESOURCE_BARRIER RTV_AFTER_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(m_pRenderTargets[m_FrameIndex], D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_PRESENT);
+			pCommandList->ResourceBarrier(1, &RTV_AFTER_BARRIER);
+			pCommandListPool->ClosedAndExecute(m_pCommandQueue);
+		}
+		break;
+
+		default:
+			__debugbreak();
+			break;
 	}
 }
 
@@ -166,42 +295,22 @@ void Renderer::Cleanup()
 	{
 		WaitForFenceValue(m_LastFenceValues[i]);
 	}
-
-#ifdef USE_MULTI_THREAD
-
-	if (m_pThreadDescList)
-	{
-		for (UINT i = 0; i < m_RenderThreadCount; ++i)
-		{
-			SetEvent(m_pThreadDescList[i].hEventList[RenderThreadEventType_Desctroy]);
-
-			WaitForSingleObject(m_pThreadDescList[i].hThread, INFINITE);
-			CloseHandle(m_pThreadDescList[i].hThread);
-			m_pThreadDescList[i].hThread = nullptr;
-
-			for (UINT j = 0; j < RenderThreadEventType_Count; ++j)
-			{
-				CloseHandle(m_pThreadDescList[i].hEventList[j]);
-				m_pThreadDescList[i].hEventList[j] = nullptr;
-			}
-		}
-
-		delete[] m_pThreadDescList;
-		m_pThreadDescList = nullptr;
-	}
-	for (UINT i = 0; i < RenderPass_RenderPassCount; ++i)
+	if (m_pUploadManager)
 	{
-		CloseHandle(m_phCompletedEvents[i]);
-		m_phCompletedEvents[i] = nullptr;
+		m_pUploadManager->WaitForTicket(m_pUploadManager->GetLastTicket());
 	}
 
-#endif
-
+	// physics scene job system dispatcher Ƿ  .
 	if (m_pPhysicsManager)
 	{
 		delete m_pPhysicsManager;
 		m_pPhysicsManager = nullptr;
 	}
+	if (m_pJobSystem)
+	{
+		delete m_pJobSystem;
+		m_pJobSystem = nullptr;
+	}
 	if (m_pPostProcessor)
 	{
 		delete m_pPostProcessor;
@@ -215,6 +324,19 @@ void Renderer::Cleanup()
 	CD3DX12_CPU_DESCRIPTOR_HANDLE nullSRV(m_pResourceManager->NullSRVDescriptor);
 	m_pSRVUAVAllocator->FreeDescriptorHandle(nullSRV);
 
+	m_SceneBVH.Cleanup();
+	if (m_pCullingVisibility)
+	{
+		free(m_pCullingVisibility);
+		m_pCullingVisibility = nullptr;
+	}
+	if (m_ppSceneBVHObjects)
+	{
+		free(m_ppSceneBVHObjects);
+		m_ppSceneBVHObjects = nullptr;
+	}
+	m_CullingObjectCapacity = 0;
+
 	m_pRenderObjects = nullptr;
 	m_pLights = nullptr;
 	m_pLightSpheres = nullptr;
@@ -252,6 +374,11 @@ void Renderer::Cleanup()
 		delete m_pResourceManager;
 		m_pResourceManager = nullptr;
 	}
+	if (m_pUploadManager)
+	{
+		delete m_pUploadManager;
+		m_pUploadManager = nullptr;
+	}
 
 	for (UINT i = 0; i < SWAP_CHAIN_FRAME_COUNT; ++i)
 	{
@@ -267,22 +394,32 @@ void Renderer::Cleanup()
 				delete m_pppDescriptorPool[i][j];
 				m_pppDescriptorPool[i][j] = nullptr;
 			}
-			if (m_pppConstantBufferManager[i][j])
-			{
-				delete m_pppConstantBufferManager[i][j];
-				m_pppConstantBufferManager[i][j] = nullptr;
-			}
 		}
 	}
+	if (m_pShaderVisibleHeap)
+	{
+		delete m_pShaderVisibleHeap;
+		m_pShaderVisibleHeap = nullptr;
+	}
+	for (UINT i = 0; i < MAX_RENDER_THREAD_COUNT; ++i)
+	{
+		if (m_ppConstantBufferManager[i])
+		{
+			delete m_ppConstantBufferManager[i];
+			m_ppConstantBufferManager[i] = nullptr;
+		}
+	}
+	if (m_pSkinningPaletteRing)
+	{
+		delete m_pSkinningPaletteRing;
+		m_pSkinningPaletteRing = nullptr;
+	}
 	for (int i = 0; i < RenderPass_RenderPassCount; ++i)
 	{
-		for (UINT j = 0; j < MAX_RENDER_THREAD_COUNT; ++j)
+		if (m_ppRenderQueue[i])
 		{
-			if (m_pppRenderQueue[i][j])
-			{
-				delete m_pppRenderQueue[i][j];
-				m_pppRenderQueue[i][j] = nullptr;
-			}
+			delete m_ppRenderQueue[i];
+			m_ppRenderQueue[i] = nullptr;
 		}
 	}
 
@@ -463,13 +600,13 @@ LRESULT Renderer::MsgProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 ConstantBufferManager* Renderer::GetConstantBufferPool(UINT threadIndex)
 {
 	_ASSERT(threadIndex >= 0 && threadIndex < m_RenderThreadCount);
-	return m_pppConstantBufferManager[m_FrameIndex][threadIndex];
+	return m_ppConstantBufferManager[threadIndex];
 }
 
 ConstantBufferManager* Renderer::GetConstantBufferManager(UINT threadIndex)
 {
 	_ASSERT(threadIndex >= 0 && threadIndex < m_RenderThreadCount);
-	return m_pppConstantBufferManager[m_FrameIndex][threadIndex];
+	return m_ppConstantBufferManager[threadIndex];
 }
 
 DynamicDescriptorPool* Renderer::GetDynamicDescriptorPool(UINT threadIndex)
@@ -661,13 +798,14 @@ LB_EXIT:
 	{
 		for (int i = 0; i < RenderPass_RenderPassCount; ++i)
 		{
-			for (UINT j = 0; j < MAX_RENDER_THREAD_COUNT; ++j)
-			{
-				m_pppRenderQueue[i][j] = new RenderQueue;
-				m_pppRenderQueue[i][j]->Initialize(8192);
-			}
+			m_ppRenderQueue[i] = new RenderQueue;
+			m_ppRenderQueue[i]->Initialize(8192, i);
 		}
 
+		//  1024 material table,  frame x thread 4096 descriptor pool .
+		m_pShaderVisibleHeap = new ShaderVisibleDescriptorHeap;
+		m_pShaderVisibleHeap->Initialize(m_pDevice, 1024, MATERIAL_DESCRIPTOR_COUNT, SWAP_CHAIN_FRAME_COUNT * m_RenderThreadCount, 4096);
+
 		for (UINT i = 0; i < SWAP_CHAIN_FRAME_COUNT; i++)
 		{
 			for (UINT j = 0; j < m_RenderThreadCount; j++)
@@ -676,12 +814,15 @@ LB_EXIT:
 				m_pppCommandListPool[i][j]->Initialize(m_pDevice, D3D12_COMMAND_LIST_TYPE_DIRECT, 256);
 
 				m_pppDescriptorPool[i][j] = new DynamicDescriptorPool;
-				m_pppDescriptorPool[i][j]->Initialize(m_pDevice, 4096);
-
-				m_pppConstantBufferManager[i][j] = new ConstantBufferManager;
-				m_pppConstantBufferManager[i][j]->Initialize(m_pDevice, 4096);
+				m_pppDescriptorPool[i][j]->Initialize(m_pDevice, m_pShaderVisibleHeap, i * m_RenderThreadCount + j);
 			}
 		}
+
+		for (UINT i = 0; i < m_RenderThreadCount; ++i)
+		{
+			m_ppConstantBufferManager[i] = new ConstantBufferManager;
+			m_ppConstantBufferManager[i]->Initialize(m_pDevice, 4096);
+		}
 	}
 
 	// create fence
@@ -693,6 +834,9 @@ LB_EXIT:
 		m_hFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
 	}
 
+	m_pUploadManager = new UploadManager;
+	m_pUploadManager->Initialize(m_pDevice, UPLOAD_STAGING_SIZE);
+
 	m_pResourceManager = new ResourceManager;
 	m_pResourceManager->Initialize(this);
 
@@ -708,16 +852,12 @@ LB_EXIT:
 	m_pSRVUAVAllocator = new DescriptorAllocator;
 	m_pSRVUAVAllocator->Initialize(m_pDevice, 4096, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-#ifdef USE_MULTI_THREAD
-	// create thread and event
-	{
-		initRenderThreadPool(m_RenderThreadCount);
-		for (int i = 0; i < RenderPass_RenderPassCount; ++i)
-		{
-			m_phCompletedEvents[i] = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-		}
-	}
-#endif
+	// Ӵ 4096 matrix. bone 65 ĳ  60 .
+	m_pSkinningPaletteRing = new SkinningPaletteRing;
+	m_pSkinningPaletteRing->Initialize(m_pDevice, m_pSRVUAVAllocator, 4096);
+
+	// create job system
+	initJobSystem(m_RenderThreadCount);
 
 	SAFE_RELEASE(pDebugController);
 	SAFE_RELEASE(pFactory5);
@@ -727,7 +867,7 @@ LB_EXIT:
 void Renderer::initPhysics()
 {
 	m_pPhysicsManager = new PhysicsManager;
-	m_pPhysicsManager->Initialize(m_RenderThreadCount);
+	m_pPhysicsManager->Initialize(m_pJobSystem);
 }
 
 void Renderer::initScene()
@@ -745,23 +885,34 @@ void Renderer::initScene()
 	}*/
 }
 
-void Renderer::initRenderThreadPool(UINT renderThreadCount)
+void Renderer::initJobSystem(UINT workerCount)
 {
-	m_pThreadDescList = new RenderThreadDesc[renderThreadCount];
-	ZeroMemory(m_pThreadDescList, sizeof(RenderThreadDesc) * renderThreadCount);
+	_ASSERT(workerCount > 0 && workerCount <= MAX_RENDER_THREAD_COUNT);
+
+	// main 嵵 worker ϹǷ (workerCount - 1) 常 .
+	m_pJobSystem = new JobSystem;
+	m_pJobSystem->Initialize(workerCount - 1, 4096);
 
-	for (UINT i = 0; i < renderThreadCount; ++i)
+	for (int i = 0; i < RenderPass_RenderPassCount; ++i)
 	{
-		for (int j = 0; j < RenderThreadEventType_Count; ++j)
+		for (UINT j = 0; j < MAX_RENDER_THREAD_COUNT; ++j)
 		{
-			m_pThreadDescList[i].hEventList[j] = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+			RenderJobDesc* pDesc = &m_pRenderPassJobDescs[i][j];
+			pDesc->pRenderer = this;
+			pDesc->pResourceManager = m_pResourceManager;
+			pDesc->QueueIndex = j;
+			pDesc->RenderPass = i;
+			pDesc->RenderJobStage = -1;
 		}
-
-		m_pThreadDescList[i].pRenderer = this;
-		m_pThreadDescList[i].pResourceManager = m_pResourceManager;
-		m_pThreadDescList[i].ThreadIndex = i;
-		UINT threadID = 0;
-		m_pThreadDescList[i].hThread = (HANDLE)_beginthreadex(nullptr, 0, RenderThread, m_pThreadDescList + i, 0, &threadID);
+	}
+	for (int i = 0; i < RenderJobStage_Count; ++i)
+	{
+		RenderJobDesc* pDesc = &m_pRenderStageJobDescs[i];
+		pDesc->pRenderer = this;
+		pDesc->pResourceManager = m_pResourceManager;
+		pDesc->QueueIndex = 0;
+		pDesc->RenderPass = -1;
+		pDesc->RenderJobStage = i;
 	}
 }
 
@@ -983,6 +1134,205 @@ void Renderer::cleanShaderResources()
 	SAFE_RELEASE(m_pPrevBuffer);
 }
 
+void Renderer::updateSceneBVH()
+{
+	const UINT OBJECT_COUNT = (UINT)m_pRenderObjects->size();
+	bool bRebuild = (OBJECT_COUNT != m_SceneBVH.GetObjectCount());
+
+	if (OBJECT_COUNT > m_CullingObjectCapacity)
+	{
+		// ü  þ 2辿 ٽ .
+		UINT newCapacity = (m_CullingObjectCapacity ? m_CullingObjectCapacity : 64);
+		while (newCapacity < OBJECT_COUNT)
+		{
+			newCapacity *= 2;
+		}
+
+		m_SceneBVH.Cleanup();
+		m_SceneBVH.Initialize(newCapacity);
+
+		if (m_pCullingVisibility)
+		{
+			free(m_pCullingVisibility);
+		}
+		m_pCullingVisibility = (BYTE*)malloc(newCapacity * CULLING_VIEW_COUNT);
+		ZeroMemory(m_pCullingVisibility, newCapacity * CULLING_VIEW_COUNT);
+
+		if (m_ppSceneBVHObjects)
+		{
+			free(m_ppSceneBVHObjects);
+		}
+		m_ppSceneBVHObjects = (Model**)malloc(sizeof(Model*) * newCapacity);
+		ZeroMemory(m_ppSceneBVHObjects, sizeof(Model*) * newCapacity);
+
+		m_CullingObjectCapacity = newCapacity;
+		bRebuild = true;
+	}
+
+	//  Ƶ  ü/ġ index ٸ ü ŰǷ ٽ build.
+	if (!bRebuild)
+	{
+		for (UINT i = 0; i < OBJECT_COUNT; ++i)
+		{
+			if (m_ppSceneBVHObjects[i] != (*m_pRenderObjects)[i])
+			{
+				bRebuild = true;
+				break;
+			}
+		}
+	}
+
+	// UpdateWorld  𵨸 refit. ż Ʈ ǰ  ٽ build.
+	if (!bRebuild)
+	{
+		SceneBounds bounds;
+		for (UINT i = 0; i < OBJECT_COUNT; ++i)
+		{
+			Model* pCurModel = (*m_pRenderObjects)[i];
+			if (!pCurModel->bIsBoundsDirty)
+			{
+				continue;
+			}
+
+			getSceneBounds(pCurModel, &bounds);
+			m_SceneBVH.Refit(i, bounds);
+			pCurModel->bIsBoundsDirty = false;
+		}
+
+		bRebuild = m_SceneBVH.NeedsRebuild();
+	}
+
+	if (bRebuild)
+	{
+		SceneBounds bounds;
+		for (UINT i = 0; i < OBJECT_COUNT; ++i)
+		{
+			Model* pCurModel = (*m_pRenderObjects)[i];
+
+			getSceneBounds(pCurModel, &bounds);
+			m_SceneBVH.SetObjectBounds(i, bounds);
+			m_ppSceneBVHObjects[i] = pCurModel;
+			pCurModel->bIsBoundsDirty = false;
+		}
+		m_SceneBVH.Build(OBJECT_COUNT);
+	}
+}
+
+void Renderer::getSceneBounds(Model* pModel, SceneBounds* pOutBounds)
+{
+	_ASSERT(pModel);
+	_ASSERT(pOutBounds);
+
+	// bounding volume local ũ⿡ world translation ݿǾ Ƿ, world ȸ/ ݿ  Ű.
+	// picking local  ״ ˻ϹǷ   .
+	const Matrix& WORLD = pModel->World;
+	const Vector3 EXTENTS(pModel->BoundingBox.Extents);
+
+	float maxScale = Max(Vector3(WORLD._11, WORLD._12, WORLD._13).Length(), Max(Vector3(WORLD._21, WORLD._22, WORLD._23).Length(), Vector3(WORLD._31, WORLD._32, WORLD._33).Length()));
+	pOutBounds->Center = pModel->BoundingSphere.Center;
+	pOutBounds->Radius = pModel->BoundingSphere.Radius * Max(maxScale, 1.0f);
+	pOutBounds->Extents = Vector3(fabsf(WORLD._11) * EXTENTS.x + fabsf(WORLD._21) * EXTENTS.y + fabsf(WORLD._31) * EXTENTS.z,
+								  fabsf(WORLD._12) * EXTENTS.x + fabsf(WORLD._22) * EXTENTS.y + fabsf(WORLD._32) * EXTENTS.z,
+								  fabsf(WORLD._13) * EXTENTS.x + fabsf(WORLD._23) * EXTENTS.y + fabsf(WORLD._33) * EXTENTS.z);
+}
+
+void Renderer::updateMaterialTables()
+{
+	// worker  model ÿ ׸  Ƿ render  main thread ٲ material ٽ .
+	m_MaterialDescriptorCopyCount = 0;
+
+	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
+	{
+		m_MaterialDescriptorCopyCount += (*m_pRenderObjects)[i]->UpdateMaterialTables();
+	}
+	if (m_pMirror)
+	{
+		m_MaterialDescriptorCopyCount += m_pMirror->UpdateMaterialTables();
+	}
+}
+
+void Renderer::cullScene()
+{
+	updateSceneBVH();
+
+	const UINT OBJECT_COUNT = (UINT)m_pRenderObjects->size();
+	const Matrix VIEW = m_Camera.GetView();
+	const Matrix PROJECTION = m_Camera.GetProjection();
+	Frustum pFrustums[MAX_CULLING_FRUSTUM_COUNT];
+
+	ExtractFrustumPlanes(VIEW * PROJECTION, &pFrustums[0]);
+	m_pVisibleObjectCounts[CullingView_Camera] = m_SceneBVH.QueryFrustum(pFrustums, 1, m_pCullingVisibility + CullingView_Camera * m_CullingObjectCapacity);
+
+	// ݻ ü ݻ   view projection ˻.
+	UINT mirrorFrustumCount = 0;
+	if (m_pMirror)
+	{
+		ExtractFrustumPlanes(Matrix::CreateReflection(*m_pMirrorPlane) * VIEW * PROJECTION, &pFrustums[0]);
+		mirrorFrustumCount = 1;
+	}
+	m_pVisibleObjectCounts[CullingView_Mirror] = m_SceneBVH.QueryFrustum(pFrustums, mirrorFrustumCount, m_pCullingVisibility + CullingView_Mirror * m_CullingObjectCapacity);
+
+	//  shadow caster. cascade  ϳ ġ ׸.
+	// point light  Ÿ  ü   ü   Ƿ  sphere .
+	for (int i = 0; i < MAX_LIGHTS; ++i)
+	{
+		Light* pLight = &(*m_pLights)[i];
+		ShadowMap* pShadowMap = &pLight->LightShadowMap;
+		BYTE* pCasterVisibility = m_pCullingVisibility + (CullingView_Light + i) * m_CullingObjectCapacity;
+		UINT frustumCount = ((pLight->Property.LightType & LIGHT_SHADOW) ? pShadowMap->GetShadowFrustumCount() : 0);
+
+		if (frustumCount && (pLight->Property.LightType & LIGHT_POINT))
+		{
+			m_pVisibleObjectCounts[CullingView_Light + i] = m_SceneBVH.QuerySphere(pLight->Property.Position, pLight->Property.FallOffEnd, pCasterVisibility);
+		}
+		else
+		{
+			m_pVisibleObjectCounts[CullingView_Light + i] = m_SceneBVH.QueryFrustum(pShadowMap->GetShadowFrustums(), frustumCount, pCasterVisibility);
+		}
+	}
+
+	// skybox ׻ ׸.
+	for (UINT i = 0; i < OBJECT_COUNT; ++i)
+	{
+		if ((*m_pRenderObjects)[i]->ModelType != RenderObjectType_SkyboxType)
+		{
+			continue;
+		}
+
+		for (int view = CullingView_Camera; view <= CullingView_Mirror; ++view)
+		{
+			BYTE* pVisibility = m_pCullingVisibility + view * m_CullingObjectCapacity;
+			if (!pVisibility[i])
+			{
+				pVisibility[i] = 1;
+				++m_pVisibleObjectCounts[view];
+			}
+		}
+	}
+}
+
+void Renderer::selectMeshLODs()
+{
+	// ȭ ̶ shadow caster ׷  Ƿ  ü  .
+	const Vector3 EYE_POSITION = m_Camera.GetEyePos();
+	const Matrix PROJECTION = m_Camera.GetProjection();
+	SceneBounds bounds;
+
+	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
+	{
+		Model* pCurModel = (*m_pRenderObjects)[i];
+		if (pCurModel->ModelType == RenderObjectType_SkyboxType)
+		{
+			continue;
+		}
+
+		getSceneBounds(pCurModel, &bounds);
+
+		const float SCREEN_SIZE = GetProjectedScreenSize(bounds.Center, bounds.Radius, EYE_POSITION, PROJECTION);
+		pCurModel->LODLevel = SelectMeshLOD(SCREEN_SIZE, pCurModel->LODLevel, MAX_MESH_LOD_COUNT, m_MeshLODSelectSettings);
+	}
+}
+
 void Renderer::beginRender()
 {
 	HRESULT hr = S_OK;
@@ -1066,13 +1416,14 @@ void Renderer::renderShadowmap()
 		pCommandList->ResourceBarrier(1, &barrier);
 
 		// register object to render queue.
-		m_CurThreadIndex = 0;
+		RenderQueue* pRenderQue = m_ppRenderQueue[RenderPass_Shadow];
+		const BYTE* pCASTER_VISIBILITY = getCullingVisibility(CullingView_Light + i);
+		const UINT LIGHT_INDEX = (UINT)i;
 		for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
 		{
-			RenderQueue* pRenderQue = m_pppRenderQueue[RenderPass_Shadow][m_CurThreadIndex];
 			Model* pModel = (*m_pRenderObjects)[i];
 
-			if (!pModel->bIsVisible || !pModel->bCastShadow)
+			if (!pModel->bIsVisible || !pModel->bCastShadow || !pCASTER_VISIBILITY[i])
 			{
 				continue;
 			}
@@ -1083,6 +1434,9 @@ void Renderer::renderShadowmap()
 			item.pLight = (void*)pCurLight;
 			item.pFilter = nullptr;
 			item.PSOType = renderPSO;
+			item.Cost = pModel->GetRenderCost();
+			item.SortLayer = LIGHT_INDEX;
+			item.Depth = (Vector3(pModel->BoundingSphere.Center) - pCurLight->Property.Position).LengthSquared();
 
 			if (pModel->ModelType == RenderObjectType_SkinnedType)
 			{
@@ -1093,7 +1447,6 @@ void Renderer::renderShadowmap()
 			{
 				__debugbreak();
 			}
-			++m_CurThreadIndex;
 		}
 	}
 
@@ -1103,7 +1456,7 @@ void Renderer::renderShadowmap()
 
 	for (int i = 0; i < MAX_LIGHTS; ++i)
 	{
-		(*m_pLights)[i].RenderShadowMap(m_pRenderObjects);
+		(*m_pLights)[i].RenderShadowMap(m_pRenderObjects, getCullingVisibility(CullingView_Light + i));
 	}
 
 #endif
@@ -1114,13 +1467,14 @@ void Renderer::renderObject()
 #ifdef USE_MULTI_THREAD
 
 	// register obejct to render queue.
-	m_CurThreadIndex = 0;
+	RenderQueue* pRenderQue = m_ppRenderQueue[RenderPass_Object];
+	const Vector3 EYE_POSITION = m_Camera.GetEyePos();
+	const BYTE* pVISIBILITY = getCullingVisibility(CullingView_Camera);
 	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
 	{
-		RenderQueue* pRenderQue = m_pppRenderQueue[RenderPass_Object][m_CurThreadIndex];
 		Model* pCurModel = (*m_pRenderObjects)[i];
 
-		if (!pCurModel->bIsVisible)
+		if (!pCurModel->bIsVisible || !pVISIBILITY[i])
 		{
 			continue;
 		}
@@ -1130,6 +1484,9 @@ void Renderer::renderObject()
 		item.pObjectHandle = (void*)pCurModel;
 		item.pLight = nullptr;
 		item.pFilter = nullptr;
+		item.Cost = pCurModel->GetRenderCost();
+		item.SortLayer = 0;
+		item.Depth = (Vector3(pCurModel->BoundingSphere.Center) - EYE_POSITION).LengthSquared();
 
 		switch (pCurModel->ModelType)
 		{
@@ -1153,7 +1510,6 @@ void Renderer::renderObject()
 		{
 			__debugbreak();
 		}
-		++m_CurThreadIndex;
 	}
 
 #else
@@ -1183,11 +1539,12 @@ void Renderer::renderObject()
 	pCommandList->RSSetScissorRects(1, &m_ScissorRect);
 	pCommandList->OMSetRenderTargets(1, &floatRtvHandle, FALSE, &dsvHandle);
 
+	const BYTE* pVISIBILITY = getCullingVisibility(CullingView_Camera);
 	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
 	{
 		Model* pCurModel = (*m_pRenderObjects)[i];
 
-		if (!pCurModel->bIsVisible)
+		if (!pCurModel->bIsVisible || !pVISIBILITY[i])
 		{
 			continue;
 		}
@@ -1230,13 +1587,14 @@ void Renderer::renderMirror()
 #ifdef USE_MULTI_THREAD
 
 	// register object to render queue.
-	m_CurThreadIndex = 0;
+	RenderQueue* pRenderQue = m_ppRenderQueue[RenderPass_Mirror];
+	const Vector3 EYE_POSITION = m_Camera.GetEyePos();
+	const BYTE* pVISIBILITY = getCullingVisibility(CullingView_Mirror);
 	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
 	{
-		RenderQueue* pRenderQue = m_pppRenderQueue[RenderPass_Mirror][m_CurThreadIndex];
 		Model* pCurModel = (*m_pRenderObjects)[i];
 
-		if (!pCurModel->bIsVisible)
+		if (!pCurModel->bIsVisible || !pVISIBILITY[i])
 		{
 			continue;
 		}
@@ -1246,6 +1604,9 @@ void Renderer::renderMirror()
 		item.pObjectHandle = (void*)pCurModel;
 		item.pLight = nullptr;
 		item.pFilter = nullptr;
+		item.Cost = pCurModel->GetRenderCost();
+		item.SortLayer = 0;
+		item.Depth = (Vector3(pCurModel->BoundingSphere.Center) - EYE_POSITION).LengthSquared();
 
 		switch (pCurModel->ModelType)
 		{
@@ -1269,7 +1630,6 @@ void Renderer::renderMirror()
 		{
 			__debugbreak();
 		}
-		++m_CurThreadIndex;
 	}
 
 #else
@@ -1280,11 +1640,12 @@ void Renderer::renderMirror()
 	m_pMirror->Render(RenderPSOType_StencilMask);
 
 	// ſ ġ ݻ ü .
+	const BYTE* pVISIBILITY = getCullingVisibility(CullingView_Mirror);
 	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
 	{
 		Model* pCurModel = (*m_pRenderObjects)[i];
 
-		if (!pCurModel->bIsVisible)
+		if (!pCurModel->bIsVisible || !pVISIBILITY[i])
 		{
 			continue;
 		}
@@ -1333,75 +1694,17 @@ void Renderer::renderObjectBoundingModel()
 	
 #ifdef USE_MULTI_THREAD
 
-	// register object to render queue.
-	m_CurThreadIndex = 0;
-	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
-	{
-		RenderQueue* pRenderQue = m_pppRenderQueue[RenderPass_Mirror][m_CurThreadIndex];
-		Model* pCurModel = (*m_pRenderObjects)[i];
-
-		if (!pCurModel->bIsVisible)
-		{
-			continue;
-		}
-
-		RenderItem item;
-		item.ModelType = (eRenderObjectType)pCurModel->ModelType;
-		item.pObjectHandle = (void*)pCurModel;
-		item.pLight = nullptr;
-		item.pFilter = nullptr;
-
-		switch (pCurModel->ModelType)
-		{
-			case RenderObjectType_DefaultType:
-				item.PSOType = RenderPSOType_ReflectionDefault;
-				break;
-
-			case RenderObjectType_SkinnedType:
-				item.PSOType = RenderPSOType_ReflectionSkinned;
-				break;
-
-			case RenderObjectType_SkyboxType:
-				item.PSOType = RenderPSOType_ReflectionSkybox;
-				break;
-
-			default:
-				break;
-		}
-
-		//m_pResourceManager->SetCommonState(RenderPSOType_Wire);
-		//switch (pCurModel->ModelType)
-		//{
-		//	case RenderObjectType_DefaultType:
-		//		// pCurModel->RenderBoundingSphere(RenderPSOType_Wire);
-		//		break;
-
-		//	case RenderObjectType_SkinnedType:
-		//	{
-		//		SkinnedMeshModel* pCharacter = (SkinnedMeshModel*)pCurModel;
-		//		pCharacter->RenderBoundingCapsule(RenderPSOType_Wire);
-		//		pCharacter->RenderJointSphere(RenderPSOType_Wire);
-		//	}
-		//	break;
-
-		//	default:
-		//		break;
-		//}
-
-		if (!pRenderQue->Add(&item))
-		{
-			__debugbreak();
-		}
-		++m_CurThreadIndex;
-	}
+	// collider pass endRender job graph Ƿ queue  .
+	// wire  ǥô   ο ׸.
 
 #else
 
+	const BYTE* pVISIBILITY = getCullingVisibility(CullingView_Camera);
 	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
 	{
 		Model* pCurModel = (*m_pRenderObjects)[i];
 
-		if (!pCurModel->bIsVisible)
+		if (!pCurModel->bIsVisible || !pVISIBILITY[i])
 		{
 			continue;
 		}
@@ -1504,138 +1807,36 @@ void Renderer::endRender()
 {
 #ifdef USE_MULTI_THREAD
 
-	CommandListPool* pCommandListPool = m_pppCommandListPool[m_FrameIndex][0];
-	for (int i = 0; i < RenderPass_RenderPassCount; ++i)
-	{
-		m_pActiveThreadCounts[i] = m_RenderThreadCount;
-	}
-
-	// shadow pass.
-	for (UINT i = 0; i < m_RenderThreadCount; ++i)
-	{
-		SetEvent(m_pThreadDescList[i].hEventList[RenderThreadEventType_Shadow]);
-	}
-	WaitForSingleObject(m_phCompletedEvents[RenderPass_Shadow], INFINITE);
-	
-	const int TOTAL_LIGHT_TYPE = LIGHT_DIRECTIONAL | LIGHT_POINT | LIGHT_SPOT;
-	// resource barrier.
-	for (int i = 0; i < MAX_LIGHTS; ++i)
-	{
-		CD3DX12_RESOURCE_BARRIER barrier;
-		ID3D12GraphicsCommandList* pCommandList = pCommandListPool->GetCurrentCommandList();
-		Light* pCurLight = &(*m_pLights)[i];
-
-		switch (pCurLight->Property.LightType & TOTAL_LIGHT_TYPE)
-		{
-			case LIGHT_DIRECTIONAL:
-				barrier = CD3DX12_RESOURCE_BARRIER::Transition(pCurLight->LightShadowMap.GetDirectionalLightShadowBufferPtr()->pTextureResource, D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_GENERIC_READ);
-				break;
-
-			case LIGHT_POINT:
-				barrier = CD3DX12_RESOURCE_BARRIER::Transition(pCurLight->LightShadowMap.GetPointLightShadowBufferPtr()->pTextureResource, D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_GENERIC_READ);
-				break;
-
-			case LIGHT_SPOT:
-				barrier = CD3DX12_RESOURCE_BARRIER::Transition(pCurLight->LightShadowMap.GetSpotLightShadowBufferPtr()->pTextureResource, D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_GENERIC_READ);
-				break;
-
-			default:
-				__debugbreak();
-				break;
-		}
+	// shadow, object, mirror pass  job    ÿ ϰ command list ݾƵα⸸ .
+	//  stage job  : [shadow , barrier] -> [object , mirror stencil] -> [mirror , blend/postprocess].
+	// stage job ڱ ϷḦ  pass  counter ϹǷ,  stage  counter ϳ
+	// "pass  Ϸ" " stage  Ϸ" Բ ٸ. main 嵵 job óϸ鼭  stage ٸ.
+	JobCounter* pCounters = m_pRenderJobCounters;
 
-		pCommandList->ResourceBarrier(1, &barrier);
-	}
-	pCommandListPool->ClosedAndExecute(m_pCommandQueue);
-
-	// default render pass.
-	for (UINT i = 0; i < m_RenderThreadCount; ++i)
+	for (int i = 0; i < RenderPass_RenderPassCount; ++i)
 	{
-		SetEvent(m_pThreadDescList[i].hEventList[RenderThreadEventType_Object]);
+		m_ppRenderQueue[i]->Prepare(m_RenderThreadCount);
 	}
-	WaitForSingleObject(m_phCompletedEvents[RenderPass_Object], INFINITE);
 
-	// mirror pass.
-	// stencil process.
-	ID3D12DescriptorHeap* pRTVHeap = m_pRTVAllocator->GetDescriptorHeap();
-	ID3D12DescriptorHeap* pDSVHeap = m_pDSVAllocator->GetDescriptorHeap();
-	{
-		ID3D12GraphicsCommandList* pCommandList = pCommandListPool->GetCurrentCommandList();
-		DynamicDescriptorPool* pDescriptorPool = m_pppDescriptorPool[m_FrameIndex][0];
-		ConstantBufferManager* pConstantBufferManager = m_pppConstantBufferManager[m_FrameIndex][0];
-		
-		
-		ID3D12DescriptorHeap* ppDescriptorHeaps[2] =
-		{
-			pDescriptorPool->GetDescriptorHeap(),
-			m_pResourceManager->m_pSamplerHeap,
-		};
-		CD3DX12_CPU_DESCRIPTOR_HANDLE floatBufferRtvHandle(pRTVHeap->GetCPUDescriptorHandleForHeapStart(), m_FloatBufferRTVOffset, m_pResourceManager->RTVDescriptorSize);
-		CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle(pDSVHeap->GetCPUDescriptorHandleForHeapStart());
-		
-		m_pPostProcessor->SetViewportsAndScissorRects(pCommandList);
-		pCommandList->OMSetRenderTargets(1, &floatBufferRtvHandle, FALSE, &dsvHandle);
-		pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
-		m_pResourceManager->SetCommonState(0, pCommandList, pDescriptorPool, pConstantBufferManager, RenderPSOType_StencilMask);
-		m_pMirror->Render(0, pCommandList, pDescriptorPool, pConstantBufferManager, m_pResourceManager, RenderPSOType_StencilMask);
-		
-		pCommandListPool->ClosedAndExecute(m_pCommandQueue);
-	}
 	for (UINT i = 0; i < m_RenderThreadCount; ++i)
 	{
-		SetEvent(m_pThreadDescList[i].hEventList[RenderThreadEventType_Mirror]);
+		m_pJobSystem->Submit(RenderPassJob, &m_pRenderPassJobDescs[RenderPass_Shadow][i], &pCounters[RenderJobStage_Shadow]);
+		m_pJobSystem->Submit(RenderPassJob, &m_pRenderPassJobDescs[RenderPass_Object][i], &pCounters[RenderJobStage_Object]);
+		m_pJobSystem->Submit(RenderPassJob, &m_pRenderPassJobDescs[RenderPass_Mirror][i], &pCounters[RenderJobStage_Mirror]);
 	}
-	WaitForSingleObject(m_phCompletedEvents[RenderPass_Mirror], INFINITE);
-	// mirror blend process.
-	{
-		ID3D12GraphicsCommandList* pCommandList = pCommandListPool->GetCurrentCommandList();
-		DynamicDescriptorPool* pDescriptorPool = m_pppDescriptorPool[m_FrameIndex][0];
-		ConstantBufferManager* pConstantBufferManager = m_pppConstantBufferManager[m_FrameIndex][0];
-		ID3D12DescriptorHeap* ppDescriptorHeaps[2] =
-		{
-			pDescriptorPool->GetDescriptorHeap(),
-			m_pResourceManager->m_pSamplerHeap,
-		};
-		CD3DX12_CPU_DESCRIPTOR_HANDLE floatBufferRtvHandle(pRTVHeap->GetCPUDescriptorHandleForHeapStart(), m_FloatBufferRTVOffset, m_pResourceManager->RTVDescriptorSize);
-		CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle(pDSVHeap->GetCPUDescriptorHandleForHeapStart());
-
-		m_pPostProcessor->SetViewportsAndScissorRects(pCommandList);
-		pCommandList->OMSetRenderTargets(1, &floatBufferRtvHandle, FALSE, &dsvHandle);
-		pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
-		m_pResourceManager->SetCommonState(0, pCommandList, pDescriptorPool, pConstantBufferManager, RenderPSOType_MirrorBlend);
-		m_pMirror->Render(0, pCommandList, pDescriptorPool, pConstantBufferManager, m_pResourceManager, RenderPSOType_MirrorBlend);
-		
-		const CD3DX12_RESOURCE_BARRIER BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(m_pFloatBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_COMMON);
-		pCommandList->ResourceBarrier(1, &BARRIER);
 
-		pCommandListPool->ClosedAndExecute(m_pCommandQueue);
-	}
+	// stage job  job   ڿ ־ . ׷ counter  ߿ 0 Ǿ stage  Ǵ  .
+	m_pJobSystem->Submit(RenderStageJob, &m_pRenderStageJobDescs[RenderJobStage_ShadowBarrier], &pCounters[RenderJobStage_Object], &pCounters[RenderJobStage_Shadow]);
+	m_pJobSystem->Submit(RenderStageJob, &m_pRenderStageJobDescs[RenderJobStage_MirrorStencil], &pCounters[RenderJobStage_Mirror], &pCounters[RenderJobStage_Object]);
+	m_pJobSystem->Submit(RenderStageJob, &m_pRenderStageJobDescs[RenderJobStage_MirrorBlendAndPost], &pCounters[RenderJobStage_MirrorBlendAndPost], &pCounters[RenderJobStage_Mirror]);
 
-	// postprocessing pass.
-	{
-		ID3D12GraphicsCommandList* pCommandList = pCommandListPool->GetCurrentCommandList();
-		DynamicDescriptorPool* pDescriptorPool = m_pppDescriptorPool[m_FrameIndex][0];
-		ConstantBufferManager* pConstantBufferManager = m_pppConstantBufferManager[m_FrameIndex][0];
-		ID3D12DescriptorHeap* ppDescriptorHeaps[2] =
-		{
-			pDescriptorPool->GetDescriptorHeap(),
-			m_pResourceManager->m_pSamplerHeap,
-		};
-		
-		pCommandList->SetDescriptorHeaps(2, ppDescriptorHeaps);
-		m_pPostProcessor->Render(0, pCommandList, pDescriptorPool, pConstantBufferManager, m_pResourceManager, m_FrameIndex);
-	
-		const CD3DX12_RESOURCE_BARRIER RTV_AFTER_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(m_pRenderTargets[m_FrameIndex], D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_PRESENT);
-		pCommandList->ResourceBarrier(1, &RTV_AFTER_BARRIER);
-		pCommandListPool->ClosedAndExecute(m_pCommandQueue);
-	}
+	m_pJobSystem->WaitForCounter(&pCounters[RenderJobStage_MirrorBlendAndPost]);
 
 	for (int i = 0; i < RenderPass_RenderPassCount; ++i)
 	{
-		for (UINT j = 0; j < m_RenderThreadCount; ++j)
-		{
-			m_pppRenderQueue[i][j]->Reset();
-		}
+		m_pRenderPassImbalances[i] = m_ppRenderQueue[i]->GetImbalance(m_RenderThreadCount);
+		m_ppRenderQueue[i]->GetStateBindCounts(&m_pRenderPassStateBindCounts[i]);
+		m_ppRenderQueue[i]->Reset();
 	}
 	
 #else
@@ -1650,9 +1851,23 @@ void Renderer::endRender()
 #endif
 }
 
+void Renderer::executeRecordedCommandLists(int renderPass)
+{
+	// job ȣ    ٰ  Ӹ   .
+	for (UINT i = 0; i < m_RenderThreadCount; ++i)
+	{
+		RenderQueueCommandLists* pCommandLists = &m_ppRecordedCommandLists[renderPass][i];
+		if (pCommandLists->Count)
+		{
+			m_pCommandQueue->ExecuteCommandLists(pCommandLists->Count, (ID3D12CommandList**)pCommandLists->ppCommandLists);
+			pCommandLists->Count = 0;
+		}
+	}
+}
+
 void Renderer::present()
 {
-	Fence();
+	const UINT64 FRAME_FENCE_VALUE = Fence();
 
 	UINT syncInterval = 1;	  // VSync On
 	// UINT syncInterval = 0;  // VSync Off
@@ -1669,23 +1884,38 @@ void Renderer::present()
 		__debugbreak();
 	}
 
+	// ̹ frame descriptor pool  CopyDescriptorsSimple ä.
+	m_DescriptorCopyCount = m_MaterialDescriptorCopyCount;
+	for (UINT i = 0; i < m_RenderThreadCount; ++i)
+	{
+		m_DescriptorCopyCount += m_pppDescriptorPool[m_FrameIndex][i]->GetAllocatedDescriptorCount();
+	}
+
 	// for next frame.
 	UINT nextFrameIndex = m_pSwapChain->GetCurrentBackBufferIndex();
 	WaitForFenceValue(m_LastFenceValues[nextFrameIndex]);
 
+	// ̹  constant  ݰ GPU   ȯ.
+	const UINT64 COMPLETED_FENCE_VALUE = m_pFence->GetCompletedValue();
+	for (UINT i = 0; i < m_RenderThreadCount; ++i)
+	{
+		m_ppConstantBufferManager[i]->FinishFrame(FRAME_FENCE_VALUE);
+		m_ppConstantBufferManager[i]->Retire(COMPLETED_FENCE_VALUE);
+	}
+	m_pShaderVisibleHeap->FinishFrame(FRAME_FENCE_VALUE);
+	m_pShaderVisibleHeap->Retire(COMPLETED_FENCE_VALUE);
+
 #ifdef USE_MULTI_THREAD
 
 	for (UINT i = 0; i < m_RenderThreadCount; ++i)
 	{
 		m_pppCommandListPool[nextFrameIndex][i]->Reset();
-		m_pppConstantBufferManager[nextFrameIndex][i]->Reset();
 		m_pppDescriptorPool[nextFrameIndex][i]->Reset();
 	}
 
 #else
 
 	m_pppCommandListPool[nextFrameIndex][0]->Reset();
-	m_pppConstantBufferManager[nextFrameIndex][0]->Reset();
 	m_pppDescriptorPool[nextFrameIndex][0]->Reset();
 
 #endif
@@ -1956,9 +2186,19 @@ Model* Renderer::pickClosest(const DirectX::SimpleMath::Ray& PICKING_RAY, float*
 	*pMinDist = 1e5f;
 	Model* pMinModel = nullptr;
 
-	for (UINT64 i = 0, size = m_pRenderObjects->size(); i < size; ++i)
+	// BVH  sphere  ĺ     ˻.
+	updateSceneBVH();
+
+	std::vector<UINT> candidates(m_SceneBVH.GetObjectCount());
+	UINT candidateCount = 0;
+	if (!candidates.empty())
 	{
-		Model* pCurModel = (*m_pRenderObjects)[i];
+		candidateCount = m_SceneBVH.QueryRay(PICKING_RAY.position, PICKING_RAY.direction, *pMinDist, candidates.data(), (UINT)candidates.size());
+	}
+
+	for (UINT candidate = 0; candidate < candidateCount; ++candidate)
+	{
+		Model* pCurModel = (*m_pRenderObjects)[candidates[candidate]];
 		float dist = 0.0f;
 
 		switch (pCurModel->ModelType)
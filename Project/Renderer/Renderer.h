@@ -6,15 +6,23 @@
 #include "ConstantBufferManager.h"
 #include "DescriptorAllocator.h"
 #include "DynamicDescriptorPool.h"
+#include "ShaderVisibleDescriptorHeap.h"
+#include "SkinningPaletteRing.h"
+#include "UploadManager.h"
 #include "../Util/KnM.h"
+#include "../Graphics/SceneBVH.h"
 #include "../Graphics/Light.h"
 #include "../Model/Model.h"
+#include "../Model/MeshSimplifier.h"
 #include "RenderThread.h"
 #include "ResourceManager.h"
 #include "../Model/SkinnedMeshModel.h"
 #include "../Physics/PhysicsManager.h"
 #include "../Graphics/PostProcessor.h"
 #include "../Renderer/Timer.h"
+#include "../Util/JobSystem.h"
+
+static const UINT CULLING_VIEW_COUNT = CullingView_Light + MAX_LIGHTS;
 
 class Renderer
 {
@@ -43,7 +51,8 @@ public:
 	void Update(const float DELTA_TIME);
 
 	void Render();
-	void ProcessByThread(UINT threadIndex, ResourceManager* pManager, int renderPass);
+	void ProcessByThread(UINT threadIndex, UINT queueIndex, ResourceManager* pManager, int renderPass);
+	void ProcessRenderStage(UINT threadIndex, int renderJobStage);
 
 	UINT64 Fence();
 	void WaitForFenceValue(UINT64 expectedFenceValue);
@@ -57,11 +66,21 @@ public:
 	inline ID3D12GraphicsCommandList* GetCommandList() { return m_pppCommandListPool[m_FrameIndex][0]->GetCurrentCommandList(); }
 
 	inline ResourceManager* GetResourceManager() { return m_pResourceManager; }
+	inline UploadManager* GetUploadManager() { return m_pUploadManager; }
 	inline PhysicsManager* GetPhysicsManager() { return m_pPhysicsManager; }
 	inline DescriptorAllocator* GetRTVAllocator() { return m_pRTVAllocator; }
 	inline DescriptorAllocator* GetDSVAllocator() { return m_pDSVAllocator; }
 	inline DescriptorAllocator* GetSRVUAVAllocator() { return m_pSRVUAVAllocator; }
+	inline ShaderVisibleDescriptorHeap* GetShaderVisibleDescriptorHeap() { return m_pShaderVisibleHeap; }
+	inline SkinningPaletteRing* GetSkinningPaletteRing() { return m_pSkinningPaletteRing; }
+	inline UINT GetFrameIndex() { return m_FrameIndex; }
 	inline TextureManager* GetTextureManager() { return m_pTextureManager; }
+	inline JobSystem* GetJobSystem() { return m_pJobSystem; }
+	inline Camera* GetCamera() { return &m_Camera; }
+	inline float GetRenderPassImbalance(int renderPass) { return m_pRenderPassImbalances[renderPass]; }
+	inline const RenderStateBindCounts* GetRenderPassStateBindCounts(int renderPass) { return &m_pRenderPassStateBindCounts[renderPass]; }
+	inline UINT GetVisibleObjectCount(int cullingView) { return m_pVisibleObjectCounts[cullingView]; }
+	inline UINT GetDescriptorCopyCount() { return m_DescriptorCopyCount; }
 	ConstantBufferManager* GetConstantBufferPool(UINT threadIndex = 0);
 	ConstantBufferManager* GetConstantBufferManager(UINT threadIndex = 0);
 	DynamicDescriptorPool* GetDynamicDescriptorPool(UINT threadIndex = 0);
@@ -75,7 +94,7 @@ protected:
 	void initDirect3D();
 	void initPhysics();
 	void initScene();
-	void initRenderThreadPool(UINT renderThreadCount);
+	void initJobSystem(UINT workerCount);
 	void initRenderTargets();
 	void initDepthStencils();
 	void initShaderResources();
@@ -84,6 +103,13 @@ protected:
 	void cleanDepthStencils();
 	void cleanShaderResources();
 
+	void updateSceneBVH();
+	void getSceneBounds(Model* pModel, SceneBounds* pOutBounds);
+	void updateMaterialTables();
+	void cullScene();
+	void selectMeshLODs();
+	inline const BYTE* getCullingVisibility(int cullingView) { return m_pCullingVisibility + cullingView * m_CullingObjectCapacity; }
+
 	void beginRender();
 	void renderShadowmap();
 	void renderObject();
@@ -91,6 +117,7 @@ protected:
 	void renderObjectBoundingModel();
 	void postProcess();
 	void endRender();
+	void executeRecordedCommandLists(int renderPass);
 	void present();
 
 	void updateGlobalConstants(const float DELTA_TIME);
@@ -152,19 +179,37 @@ private:
 	ID3D12CommandQueue* m_pCommandQueue = nullptr;
 
 	// for multi-thread ////////////////////////
-	RenderQueue* m_pppRenderQueue[RenderPass_RenderPassCount][MAX_RENDER_THREAD_COUNT] = { nullptr, };
+	RenderQueue* m_ppRenderQueue[RenderPass_RenderPassCount] = { nullptr, }; // pass ϳ  尡  ó.
 	CommandListPool* m_pppCommandListPool[SWAP_CHAIN_FRAME_COUNT][MAX_RENDER_THREAD_COUNT] = { nullptr, };
+	ShaderVisibleDescriptorHeap* m_pShaderVisibleHeap = nullptr; // material table  descriptor pool   heap.
 	DynamicDescriptorPool* m_pppDescriptorPool[SWAP_CHAIN_FRAME_COUNT][MAX_RENDER_THREAD_COUNT] = { nullptr, };
-	ConstantBufferManager* m_pppConstantBufferManager[SWAP_CHAIN_FRAME_COUNT][MAX_RENDER_THREAD_COUNT] = { nullptr, };
-	RenderThreadDesc* m_pThreadDescList = nullptr;
-	UINT m_RenderThreadCount = 0;
-	UINT m_CurThreadIndex = 0; // render queue յϰ ֱ  ε.
-
-	long volatile m_pActiveThreadCounts[RenderPass_RenderPassCount] = { 0, };
-	HANDLE m_phCompletedEvents[RenderPass_RenderPassCount] = { nullptr, };
+	ConstantBufferManager* m_ppConstantBufferManager[MAX_RENDER_THREAD_COUNT] = { nullptr, }; //    fence ȯ.
+	SkinningPaletteRing* m_pSkinningPaletteRing = nullptr; //  ĳ bone matrix. frame    .
+	UINT m_RenderThreadCount = 0; // main  . job system worker index 1:1 .
+	float m_pRenderPassImbalances[RenderPass_RenderPassCount] = { 0.0f, };
+	RenderStateBindCounts m_pRenderPassStateBindCounts[RenderPass_RenderPassCount] = { };
+	UINT m_MaterialDescriptorCopyCount = 0;
+	UINT m_DescriptorCopyCount = 0; //  frame  descriptor .
+
+	JobSystem* m_pJobSystem = nullptr;
+	RenderJobDesc m_pRenderPassJobDescs[RenderPass_RenderPassCount][MAX_RENDER_THREAD_COUNT] = { };
+	RenderJobDesc m_pRenderStageJobDescs[RenderJobStage_Count] = { };
+	JobCounter m_pRenderJobCounters[RenderJobStage_Count];
+	RenderQueueCommandLists m_ppRecordedCommandLists[RenderPass_RenderPassCount][MAX_RENDER_THREAD_COUNT] = { }; // pass job ݾƵ command list. stage job .
 	/////////////////////////////////////////////
 
+	// culling. view m_pRenderObjects   visibility 迭 .
+	SceneBVH m_SceneBVH;
+	BYTE* m_pCullingVisibility = nullptr;
+	Model** m_ppSceneBVHObjects = nullptr; //  build  ü. index   Ű Ȯο.
+	UINT m_CullingObjectCapacity = 0;
+	UINT m_pVisibleObjectCounts[CULLING_VIEW_COUNT] = { 0, };
+
+	// mesh LOD. camera  ȭ ũ  shadow, mirror pass  ܰ踦 .
+	MeshLODSelectSettings m_MeshLODSelectSettings;
+
 	// main resources.
+	UploadManager* m_pUploadManager = nullptr; //  buffer, texture ʱ data. copy queue.
 	ResourceManager* m_pResourceManager = nullptr;
 	TextureManager* m_pTextureManager = nullptr;
 	DescriptorAllocator* m_pRTVAllocator = nullptr;
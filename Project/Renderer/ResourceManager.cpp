@@ -10,31 +10,13 @@ void ResourceManager::Initialize(Renderer* pRenderer)
 	m_pRenderer = pRenderer;
 	m_pDevice = pRenderer->GetD3DDevice();
 	m_pCommandQueue = pRenderer->GetCommandQueue();
+	m_pUploadManager = pRenderer->GetUploadManager();
 
 	RTVDescriptorSize = m_pDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
 	DSVDescriptorSize = m_pDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
 	CBVSRVUAVDescriptorSize = m_pDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 	SamplerDescriptorSize = m_pDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
 
-	{
-		HRESULT hr = S_OK;
-		WCHAR szDebugName[256] = { 0, };
-
-		hr = m_pDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_pCommandAllocator));
-		BREAK_IF_FAILED(hr);
-		swprintf_s(szDebugName, 256, L"CommandAllocatorInResourceManager");
-		m_pCommandAllocator->SetName(szDebugName);
-
-		hr = m_pDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_pCommandAllocator, nullptr, IID_PPV_ARGS(&m_pCommandList));
-		BREAK_IF_FAILED(hr);
-		swprintf_s(szDebugName, 256, L"CommandListInResourceManager");
-		m_pCommandList->SetName(szDebugName);
-
-		// Command lists are created in the recording state, but there is nothing
-		// to record yet. The main loop expects it to be closed, so close it now.
-		m_pCommandList->Close();
-	}
-
 	initSamplers();
 	initRasterizerStateDescs();
 	initBlendStateDescs();
@@ -45,18 +27,16 @@ void ResourceManager::Initialize(Renderer* pRenderer)
 
 HRESULT ResourceManager::CreateVertexBuffer(UINT sizePerVertex, UINT numVertex, D3D12_VERTEX_BUFFER_VIEW* pOutVertexBufferView, ID3D12Resource** ppOutBuffer, void* pInitData)
 {
-	_ASSERT(m_pRenderer);
 	_ASSERT(m_pDevice);
-	_ASSERT(m_pCommandQueue);
+	_ASSERT(m_pUploadManager);
 
 	HRESULT hr = S_OK;
 
 	D3D12_VERTEX_BUFFER_VIEW vertexBufferView = {};
 	ID3D12Resource* pVertexBuffer = nullptr;
-	ID3D12Resource* pUploadBuffer = nullptr;
 	UINT vertexBufferSize = sizePerVertex * numVertex;
 
-	// create vertexbuffer for rendering
+	// create vertexbuffer for rendering. COMMON  copy queue ٷ .
 	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
 	CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(vertexBufferSize);
 	hr = m_pDevice->CreateCommittedResource(&heapProps,
@@ -69,50 +49,10 @@ HRESULT ResourceManager::CreateVertexBuffer(UINT sizePerVertex, UINT numVertex,
 	
 	if (pInitData)
 	{
-		hr = m_pCommandAllocator->Reset();
-		BREAK_IF_FAILED(hr);
-
-		hr = m_pCommandList->Reset(m_pCommandAllocator, nullptr);
-		BREAK_IF_FAILED(hr);
-
-		heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-		resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(vertexBufferSize);
-		hr = m_pDevice->CreateCommittedResource(&heapProps,
-												D3D12_HEAP_FLAG_NONE,
-												&resourceDesc,
-												D3D12_RESOURCE_STATE_COMMON,
-												nullptr,
-												IID_PPV_ARGS(&pUploadBuffer));
-		BREAK_IF_FAILED(hr);
-		pUploadBuffer->SetName(L"tempVertexUploader");
-
-		UINT8* pVertexDataBegin = nullptr;
-		CD3DX12_RANGE readRange(0, 0);
-
-		hr = pUploadBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pVertexDataBegin));
+		hr = m_pUploadManager->UploadBuffer(pVertexBuffer, 0, pInitData, vertexBufferSize);
 		BREAK_IF_FAILED(hr);
-
-		memcpy(pVertexDataBegin, pInitData, vertexBufferSize);
-		pUploadBuffer->Unmap(0, nullptr);
-
-		const CD3DX12_RESOURCE_BARRIER BEFORE_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(pVertexBuffer, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST);
-		const CD3DX12_RESOURCE_BARRIER AFTER_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(pVertexBuffer, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
-		m_pCommandList->ResourceBarrier(1, &BEFORE_BARRIER);
-		m_pCommandList->CopyBufferRegion(pVertexBuffer, 0, pUploadBuffer, 0, vertexBufferSize);
-		m_pCommandList->ResourceBarrier(1, &AFTER_BARRIER);
-
-		m_pCommandList->Close();
-
-		ID3D12CommandList* ppCommandLists[1] = { m_pCommandList };
-		m_pCommandQueue->ExecuteCommandLists(1, ppCommandLists);
-
-		UINT64 lastFenceValue = m_pRenderer->Fence();
-		m_pRenderer->WaitForFenceValue(lastFenceValue);
-
-		SAFE_RELEASE(pUploadBuffer);
 	}
 
-
 	// Initialize the vertex buffer view.
 	vertexBufferView.BufferLocation = pVertexBuffer->GetGPUVirtualAddress();
 	vertexBufferView.StrideInBytes = sizePerVertex;
@@ -127,13 +67,12 @@ HRESULT ResourceManager::CreateVertexBuffer(UINT sizePerVertex, UINT numVertex,
 HRESULT ResourceManager::CreateIndexBuffer(UINT sizePerIndex, UINT numIndex, D3D12_INDEX_BUFFER_VIEW* pOutIndexBufferView, ID3D12Resource** ppOutBuffer, void* pInitData)
 {
 	_ASSERT(m_pDevice);
-	_ASSERT(m_pCommandQueue);
+	_ASSERT(m_pUploadManager);
 
 	HRESULT hr = S_OK;
 
 	D3D12_INDEX_BUFFER_VIEW indexBufferView = {};
 	ID3D12Resource* pIndexBuffer = nullptr;
-	ID3D12Resource* pUploadBuffer = nullptr;
 	UINT indexBufferSize = sizePerIndex * numIndex;
 
 	// create vertexbuffer for rendering
@@ -149,50 +88,10 @@ HRESULT ResourceManager::CreateIndexBuffer(UINT sizePerIndex, UINT numIndex, D3D
 
 	if (pInitData)
 	{
-		hr = m_pCommandAllocator->Reset();
-		BREAK_IF_FAILED(hr);
-
-		hr = m_pCommandList->Reset(m_pCommandAllocator, nullptr);
+		hr = m_pUploadManager->UploadBuffer(pIndexBuffer, 0, pInitData, indexBufferSize);
 		BREAK_IF_FAILED(hr);
-
-		heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-		resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(indexBufferSize);
-		hr = m_pDevice->CreateCommittedResource(&heapProps,
-												D3D12_HEAP_FLAG_NONE,
-												&resourceDesc,
-												D3D12_RESOURCE_STATE_COMMON,
-												nullptr,
-												IID_PPV_ARGS(&pUploadBuffer));
-		BREAK_IF_FAILED(hr);
-		pUploadBuffer->SetName(L"tempIndexUploader");
-
-		UINT8* pIndexDataBegin = nullptr;
-		CD3DX12_RANGE readRange(0, 0);
-
-		hr = pUploadBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pIndexDataBegin));
-		BREAK_IF_FAILED(hr);
-
-		memcpy(pIndexDataBegin, pInitData, indexBufferSize);
-		pUploadBuffer->Unmap(0, nullptr);
-
-		const CD3DX12_RESOURCE_BARRIER BEFORE_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(pIndexBuffer, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST);
-		const CD3DX12_RESOURCE_BARRIER AFTER_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(pIndexBuffer, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
-		m_pCommandList->ResourceBarrier(1, &BEFORE_BARRIER);
-		m_pCommandList->CopyBufferRegion(pIndexBuffer, 0, pUploadBuffer, 0, indexBufferSize);
-		m_pCommandList->ResourceBarrier(1, &AFTER_BARRIER);
-
-		m_pCommandList->Close();
-
-		ID3D12CommandList* ppCommandLists[1] = { m_pCommandList };
-		m_pCommandQueue->ExecuteCommandLists(1, ppCommandLists);
-
-		UINT64 lastFenceValue = m_pRenderer->Fence();
-		m_pRenderer->WaitForFenceValue(lastFenceValue);
-
-		SAFE_RELEASE(pUploadBuffer);
 	}
 
-
 	// Initialize the vertex buffer view.
 	indexBufferView.BufferLocation = pIndexBuffer->GetGPUVirtualAddress();
 	indexBufferView.SizeInBytes = indexBufferSize;
@@ -225,6 +124,18 @@ HRESULT ResourceManager::CreateTextureFromFile(ID3D12Resource** ppOutResource, D
 	}
 	BREAK_IF_FAILED(hr);
 
+	hr = CreateTextureFromImage(ppOutResource, pOutDesc, image.data(), (UINT)width, (UINT)height, pixelFormat);
+
+	return hr;
+}
+
+HRESULT ResourceManager::CreateTextureFromImage(ID3D12Resource** ppOutResource, D3D12_RESOURCE_DESC* pOutDesc, const BYTE* pImage, UINT width, UINT height, DXGI_FORMAT format)
+{
+	_ASSERT(m_pDevice);
+	_ASSERT(m_pUploadManager);
+	_ASSERT(pImage);
+
+	HRESULT hr = S_OK;
 
 	ID3D12Resource* pResource = nullptr;
 	D3D12_RESOURCE_DESC textureDesc;
@@ -234,67 +145,30 @@ HRESULT ResourceManager::CreateTextureFromFile(ID3D12Resource** ppOutResource, D
 	textureDesc.Height = height;
 	textureDesc.DepthOrArraySize = 1;
 	textureDesc.MipLevels = 1;
-	textureDesc.Format = pixelFormat;
+	textureDesc.Format = format;
 	textureDesc.SampleDesc.Count = 1;
 	textureDesc.SampleDesc.Quality = 0;
 	textureDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
 	textureDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
+	// copy queue Ƿ COMMON. ׸   ٸ · ٲ ʿ .
 	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
-	D3D12_RESOURCE_STATES curState = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-
 	hr = m_pDevice->CreateCommittedResource(&heapProps,
 											D3D12_HEAP_FLAG_NONE,
 											&textureDesc,
-											curState,
+											D3D12_RESOURCE_STATE_COMMON,
 											nullptr,
 											IID_PPV_ARGS(&pResource));
 	BREAK_IF_FAILED(hr);
 	pResource->SetName(L"TextureResource");
 
-
-	ID3D12Resource* pUploadResource = nullptr;
-	BYTE* pMappedPtr = nullptr;
-	UINT64 pixelSize = GetPixelSize(textureDesc.Format);
-	UINT num2DSubresources = textureDesc.DepthOrArraySize * textureDesc.MipLevels;
-	UINT64 uploadBufferSize = GetRequiredIntermediateSize(pResource, 0, num2DSubresources);
-
-	D3D12_RESOURCE_DESC desc = pResource->GetDesc();
-	D3D12_PLACED_SUBRESOURCE_FOOTPRINT footPrint;
-	UINT rows = 0;
-	UINT64 rowSize = 0;
-	UINT64 totalBytes = 0;
-	CD3DX12_RESOURCE_DESC uploadResourceDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadBufferSize);
-
-	m_pDevice->GetCopyableFootprints(&desc, 0, 1, 0, &footPrint, &rows, &rowSize, &totalBytes);
-	heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
-	hr = m_pDevice->CreateCommittedResource(&heapProps,
-											D3D12_HEAP_FLAG_NONE,
-											&uploadResourceDesc,
-											D3D12_RESOURCE_STATE_GENERIC_READ,
-											nullptr,
-											IID_PPV_ARGS(&pUploadResource));
-	BREAK_IF_FAILED(hr);
-	pUploadResource->SetName(L"TextureUploader");
-
-	CD3DX12_RANGE writeRange(0, 0);
-	hr = pUploadResource->Map(0, &writeRange, (void**)(&pMappedPtr));
+	D3D12_SUBRESOURCE_DATA subresourceData;
+	subresourceData.pData = pImage;
+	subresourceData.RowPitch = (LONG_PTR)(width * GetPixelSize(format));
+	subresourceData.SlicePitch = subresourceData.RowPitch * height;
+	hr = m_pUploadManager->UploadTexture(pResource, 0, 1, &subresourceData);
 	BREAK_IF_FAILED(hr);
 
-	const BYTE* pSrc = image.data();
-	BYTE* pDest = pMappedPtr;
-	for (int i = 0; i < width; ++i)
-	{
-		memcpy(pDest, pSrc, width * pixelSize);
-		pSrc += (width * pixelSize);
-		pDest += footPrint.Footprint.RowPitch;
-	}
-
-	pUploadResource->Unmap(0, nullptr);
-	UpdateTexture(pResource, pUploadResource, &curState);
-
-	SAFE_RELEASE(pUploadResource);
-
 	*ppOutResource = pResource;
 	*pOutDesc = textureDesc;
 
@@ -303,16 +177,21 @@ HRESULT ResourceManager::CreateTextureFromFile(ID3D12Resource** ppOutResource, D
 
 HRESULT ResourceManager::CreateTextureCubeFromFile(ID3D12Resource** ppOutResource, D3D12_RESOURCE_DESC* pOutDesc, const WCHAR* pszFileName)
 {
+	_ASSERT(m_pDevice);
+	_ASSERT(m_pUploadManager);
+
 	HRESULT hr = S_OK;
+	std::unique_ptr<uint8_t[]> ddsData;
+	std::vector<D3D12_SUBRESOURCE_DATA> subresources;
 
-	hr = ReadDDSImage(m_pDevice, m_pCommandQueue, pszFileName, ppOutResource);
+	hr = ReadDDSImage(m_pDevice, pszFileName, ppOutResource, ddsData, subresources);
 	BREAK_IF_FAILED(hr);
-	(*ppOutResource)->SetName(L"TextureResource");
 
-	*pOutDesc = (*ppOutResource)->GetDesc();
+	//  6 x mip ü  . ddsData staging   ص .
+	hr = m_pUploadManager->UploadTexture(*ppOutResource, 0, (UINT)subresources.size(), subresources.data());
+	BREAK_IF_FAILED(hr);
 
-	UINT64 lastFenceValue = m_pRenderer->Fence();
-	m_pRenderer->WaitForFenceValue(lastFenceValue);
+	*pOutDesc = (*ppOutResource)->GetDesc();
 
 	return hr;
 }
@@ -371,11 +250,11 @@ HRESULT ResourceManager::CreateTexturePair(ID3D12Resource** ppOutResource, ID3D1
 HRESULT ResourceManager::CreateTexture(ID3D12Resource** ppOutResource, UINT width, UINT height, DXGI_FORMAT format, const BYTE* pInitImage)
 {
 	_ASSERT(m_pDevice);
+	_ASSERT(m_pUploadManager);
 
 	HRESULT hr = S_OK;
 
 	ID3D12Resource* pTextureResource = nullptr;
-	ID3D12Resource* pUploadBuffer = nullptr;
 
 	D3D12_RESOURCE_DESC textureDesc;
 	textureDesc.MipLevels = 1;
@@ -390,10 +269,11 @@ HRESULT ResourceManager::CreateTexture(ID3D12Resource** ppOutResource, UINT widt
 
 	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
 
+	// ʱ ̹ copy queue øǷ COMMON.
 	hr = m_pDevice->CreateCommittedResource(&heapProps,
 											D3D12_HEAP_FLAG_NONE,
 											&textureDesc,
-											D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE,
+											(pInitImage ? D3D12_RESOURCE_STATE_COMMON : D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE),
 											nullptr,
 											IID_PPV_ARGS(&pTextureResource));
 	BREAK_IF_FAILED(hr);
@@ -401,49 +281,12 @@ HRESULT ResourceManager::CreateTexture(ID3D12Resource** ppOutResource, UINT widt
 
 	if (pInitImage)
 	{
-		D3D12_RESOURCE_DESC desc = pTextureResource->GetDesc();
-		D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
-		UINT rows = 0;
-		UINT64 rowSize = 0;
-		UINT64 totalBytes = 0;
-
-		m_pDevice->GetCopyableFootprints(&desc, 0, 1, 0, &footprint, &rows, &rowSize, &totalBytes);
-
-		BYTE* pMappedPtr = nullptr;
-		CD3DX12_RANGE writeRange(0, 0);
-
-		UINT64 uploadBufferSize = GetRequiredIntermediateSize(pTextureResource, 0, 1);
-		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
-		CD3DX12_RESOURCE_DESC uploadResourceDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadBufferSize);
-
-		hr = m_pDevice->CreateCommittedResource(&heapProps,
-												D3D12_HEAP_FLAG_NONE,
-												&uploadResourceDesc,
-												D3D12_RESOURCE_STATE_GENERIC_READ,
-												nullptr,
-												IID_PPV_ARGS(&pUploadBuffer));
-		BREAK_IF_FAILED(hr);
-		pUploadBuffer->SetName(L"TextureUploader");
-
-		hr = pUploadBuffer->Map(0, &writeRange, reinterpret_cast<void**>(&pMappedPtr));
+		D3D12_SUBRESOURCE_DATA subresourceData;
+		subresourceData.pData = pInitImage;
+		subresourceData.RowPitch = (LONG_PTR)width * 4;
+		subresourceData.SlicePitch = subresourceData.RowPitch * height;
+		hr = m_pUploadManager->UploadTexture(pTextureResource, 0, 1, &subresourceData);
 		BREAK_IF_FAILED(hr);
-
-		const BYTE* pSrc = pInitImage;
-		BYTE* pDest = pMappedPtr;
-		for (UINT y = 0; y < height; ++y)
-		{
-			memcpy(pDest, pSrc, width * 4);
-			pSrc += (width * 4);
-			pDest += footprint.Footprint.RowPitch;
-		}
-		// Unmap
-		pUploadBuffer->Unmap(0, nullptr);
-
-		// D3D12_RESOURCE_STATES curState = D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE;
-		D3D12_RESOURCE_STATES curState = D3D12_RESOURCE_STATE_GENERIC_READ;
-		UpdateTexture(pTextureResource, pUploadBuffer, &curState);
-
-		SAFE_RELEASE(pUploadBuffer);
 	}
 	*ppOutResource = pTextureResource;
 
@@ -490,68 +333,9 @@ HRESULT ResourceManager::CreateNonImageUploadTexture(ID3D12Resource** ppOutResou
 	return hr;
 }
 
-HRESULT ResourceManager::UpdateTexture(ID3D12Resource* pDestResource, ID3D12Resource* pSrcResource, D3D12_RESOURCE_STATES* pOriginalState)
-{
-	_ASSERT(m_pRenderer);
-	_ASSERT(m_pDevice);
-
-	HRESULT hr = S_OK;
-
-	const UINT MAX_SUB_RESOURCE_NUM = 32;
-	D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint[MAX_SUB_RESOURCE_NUM] = {};
-	UINT rows[MAX_SUB_RESOURCE_NUM] = {};
-	UINT64 rowSize[MAX_SUB_RESOURCE_NUM] = {};
-	UINT64 totalBytes = 0;
-
-	D3D12_RESOURCE_DESC Desc = pDestResource->GetDesc();
-	if (Desc.MipLevels > (UINT)_countof(footprint))
-	{
-		__debugbreak();
-	}
-
-	m_pDevice->GetCopyableFootprints(&Desc, 0, Desc.MipLevels, 0, footprint, rows, rowSize, &totalBytes);
-
-	hr = m_pCommandAllocator->Reset();
-	BREAK_IF_FAILED(hr);
-
-	hr = m_pCommandList->Reset(m_pCommandAllocator, nullptr);
-	BREAK_IF_FAILED(hr);
-
-	const CD3DX12_RESOURCE_BARRIER BEFORE_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(pDestResource, *pOriginalState, D3D12_RESOURCE_STATE_COPY_DEST);
-	const CD3DX12_RESOURCE_BARRIER AFTER_BARRIER = CD3DX12_RESOURCE_BARRIER::Transition(pDestResource, D3D12_RESOURCE_STATE_COPY_DEST, *pOriginalState);
-	
-	m_pCommandList->ResourceBarrier(1, &BEFORE_BARRIER);
-	for (UINT i = 0; i < Desc.MipLevels; ++i)
-	{
-		D3D12_TEXTURE_COPY_LOCATION	destLocation;
-		destLocation.PlacedFootprint = footprint[i];
-		destLocation.pResource = pDestResource;
-		destLocation.SubresourceIndex = i;
-		destLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
-
-		D3D12_TEXTURE_COPY_LOCATION	srcLocation;
-		srcLocation.PlacedFootprint = footprint[i];
-		srcLocation.pResource = pSrcResource;
-		srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
-
-		m_pCommandList->CopyTextureRegion(&destLocation, 0, 0, 0, &srcLocation, nullptr);
-	}
-	m_pCommandList->ResourceBarrier(1, &AFTER_BARRIER);
-	m_pCommandList->Close();
-
-	ID3D12CommandList* ppCommandLists[1] = { m_pCommandList };
-	m_pCommandQueue->ExecuteCommandLists(1, ppCommandLists);
-
-	UINT64 lastFenceValue = m_pRenderer->Fence();
-	m_pRenderer->WaitForFenceValue(lastFenceValue);
-
-	return hr;
-}
-
 void ResourceManager::Cleanup()
 {
-	SAFE_RELEASE(m_pCommandAllocator);
-	SAFE_RELEASE(m_pCommandList);
+	m_pUploadManager = nullptr;
 
 	m_pGlobalConstantData = nullptr;
 	m_pLightConstantData = nullptr;
@@ -1694,20 +1478,24 @@ void ResourceManager::initPipelineStates()
 	commonResourceRanges[3].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 4, 13); // t13 ~ t16
 	commonResourceRanges[4].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, 8, 0); // s0 ~ s7
 
+	// material table. ShaderVisibleDescriptorHeap mesh    ΰ ״ .
+	CD3DX12_DESCRIPTOR_RANGE materialResourceRanges[2];
+	materialResourceRanges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 6, 0); // t0 ~ t5
+	materialResourceRanges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 6); // t6
+
 	CD3DX12_ROOT_SIGNATURE_DESC rootSignatureDesc;
 	ID3DBlob* pSignature = nullptr;
 	ID3DBlob* pError = nullptr;
 
 	{
-		CD3DX12_DESCRIPTOR_RANGE perDefaultObjectResourceRanges[3];
+		CD3DX12_DESCRIPTOR_RANGE perDefaultObjectResourceRanges[1];
 		perDefaultObjectResourceRanges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 2, 2); // b2, b3
-		perDefaultObjectResourceRanges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 6, 0); // t0 ~ t5
-		perDefaultObjectResourceRanges[2].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 6); // t6
 
-		CD3DX12_ROOT_PARAMETER rootParameters[3];
-		rootParameters[0].InitAsDescriptorTable(3, perDefaultObjectResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
+		CD3DX12_ROOT_PARAMETER rootParameters[4];
+		rootParameters[0].InitAsDescriptorTable(1, perDefaultObjectResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
 		rootParameters[1].InitAsDescriptorTable(4, commonResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
 		rootParameters[2].InitAsDescriptorTable(1, &commonResourceRanges[4], D3D12_SHADER_VISIBILITY_ALL);
+		rootParameters[3].InitAsDescriptorTable(2, materialResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
 
 		rootSignatureDesc.Init(_countof(rootParameters), rootParameters, 0, nullptr, D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
@@ -1731,16 +1519,15 @@ void ResourceManager::initPipelineStates()
 	}
 
 	{
-		CD3DX12_DESCRIPTOR_RANGE perSkinnedObjectResourceRanges[4];
+		CD3DX12_DESCRIPTOR_RANGE perSkinnedObjectResourceRanges[2];
 		perSkinnedObjectResourceRanges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 7); // t7
 		perSkinnedObjectResourceRanges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 2, 2); // b2, b3
-		perSkinnedObjectResourceRanges[2].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 6, 0); // t0 ~ t5
-		perSkinnedObjectResourceRanges[3].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 6); // t6
 
-		CD3DX12_ROOT_PARAMETER rootParameter[3];
-		rootParameter[0].InitAsDescriptorTable(4, perSkinnedObjectResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
+		CD3DX12_ROOT_PARAMETER rootParameter[4];
+		rootParameter[0].InitAsDescriptorTable(2, perSkinnedObjectResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
 		rootParameter[1].InitAsDescriptorTable(4, commonResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
 		rootParameter[2].InitAsDescriptorTable(1, &commonResourceRanges[4], D3D12_SHADER_VISIBILITY_ALL);
+		rootParameter[3].InitAsDescriptorTable(2, materialResourceRanges, D3D12_SHADER_VISIBILITY_ALL);
 
 		rootSignatureDesc.Init(_countof(rootParameter), rootParameter, 0, nullptr, D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
@@ -2394,16 +2181,17 @@ void ResourceManager::initShaders()
 		{"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
 		{"TANGENT", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 32, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
 	};
+	// PackedSkinnedVertex.
 	D3D12_INPUT_ELEMENT_DESC skinncedDescs[] =
 	{
-		{"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-		{"NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-		{"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-		{"TANGENT", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 32, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-		{"BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 44, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-		{"BLENDWEIGHT", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 60, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-		{"BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT, 0, 76, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-		{"BLENDINDICES", 1, DXGI_FORMAT_R8G8B8A8_UINT, 0, 80, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, 8, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"TANGENT", 0, DXGI_FORMAT_R16G16_SNORM, 0, 16, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"BLENDWEIGHT", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 20, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"BLENDWEIGHT", 1, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT, 0, 28, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+		{"BLENDINDICES", 1, DXGI_FORMAT_R8G8B8A8_UINT, 0, 32, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
 	};
 	D3D12_INPUT_ELEMENT_DESC skyboxDescs[] =
 	{
@@ -1,5 +1,9 @@
 #pragma once
 
+static const UINT SWAP_CHAIN_FRAME_COUNT = 2;
+static const UINT MAX_RENDER_THREAD_COUNT = 6;
+static const UINT MAX_DESCRIPTOR_NUM = 1024;
+
 #include <ctype.h>
 #include "CommandListPool.h"
 #include "DynamicDescriptorPool.h"
@@ -9,12 +13,9 @@
 struct TextureHandle;
 class ConstantBuffer;
 class TextureManager;
+class UploadManager;
 class Renderer;
 
-static const UINT SWAP_CHAIN_FRAME_COUNT = 2;
-static const UINT MAX_RENDER_THREAD_COUNT = 6;
-static const UINT MAX_DESCRIPTOR_NUM = 1024;
-
 class ResourceManager
 {
 public:
@@ -33,17 +34,19 @@ public:
 
 	void Initialize(Renderer* pRenderer);
 
+	// ʱ data UploadManager ױ⸸ .  Flush  GPU Ƿ graphics queue   ticket ٷ .
+	// (Renderer::Render frame ۿ   ϰ graphics queue ٸ .)
 	HRESULT CreateVertexBuffer(UINT sizePerVertex, UINT numVertex, D3D12_VERTEX_BUFFER_VIEW* pOutVertexBufferView, ID3D12Resource** ppOutBuffer, void* pInitData);
 	HRESULT CreateIndexBuffer(UINT sizePerIndex, UINT numIndex, D3D12_INDEX_BUFFER_VIEW* pOutIndexBufferView, ID3D12Resource** ppOutBuffer, void* pInitData);
 	
 	HRESULT CreateTextureFromFile(ID3D12Resource** ppOutResource, D3D12_RESOURCE_DESC* pOutDesc, const WCHAR* pszFileName, bool bUseSRGB);
+	// ̹ decode ̹. row    pImage upload.
+	HRESULT CreateTextureFromImage(ID3D12Resource** ppOutResource, D3D12_RESOURCE_DESC* pOutDesc, const BYTE* pImage, UINT width, UINT height, DXGI_FORMAT format);
 	HRESULT CreateTextureCubeFromFile(ID3D12Resource** ppOutResource, D3D12_RESOURCE_DESC* pOutDesc, const WCHAR* pszFileName);
 	HRESULT CreateTexturePair(ID3D12Resource** ppOutResource, ID3D12Resource** ppOutUploadBuffer, UINT width, UINT height, DXGI_FORMAT format);
 	HRESULT CreateTexture(ID3D12Resource** ppOutResource, UINT width, UINT height, DXGI_FORMAT format, const BYTE* pInitImage);
 	HRESULT CreateNonImageUploadTexture(ID3D12Resource** ppOutResource, UINT numElement, UINT elementSize);
 
-	HRESULT UpdateTexture(ID3D12Resource* pDestResource, ID3D12Resource* pSrcResource, D3D12_RESOURCE_STATES* pOriginalState);
-
 	void Cleanup();
 
 	void SetGlobalConstants(GlobalConstant* pGlobal, LightConstant* pLight, GlobalConstant* pReflection);
@@ -79,8 +82,7 @@ private:
 
 	ID3D12Device5* m_pDevice = nullptr;
 	ID3D12CommandQueue* m_pCommandQueue = nullptr;
-	ID3D12CommandAllocator* m_pCommandAllocator = nullptr;
-	ID3D12GraphicsCommandList* m_pCommandList = nullptr;
+	UploadManager* m_pUploadManager = nullptr;
 
 	// root signature.
 	ID3D12RootSignature* m_pDefaultRootSignature = nullptr;
@@ -0,0 +1,104 @@
+#include "../pch.h"
+#include "ShaderVisibleDescriptorHeap.h"
+
+void ShaderVisibleDescriptorHeap::Initialize(ID3D12Device5* pDevice, UINT maxTableCount, UINT descriptorCountPerTable, UINT dynamicRangeCount, UINT descriptorCountPerDynamicRange)
+{
+	_ASSERT(pDevice);
+	_ASSERT(maxTableCount > 0);
+	_ASSERT(descriptorCountPerTable > 0);
+	_ASSERT(dynamicRangeCount > 0);
+	_ASSERT(descriptorCountPerDynamicRange > 0);
+
+	HRESULT hr = S_OK;
+
+	m_pDevice = pDevice;
+	m_pDevice->AddRef();
+
+	m_MaxTableCount = maxTableCount;
+	m_DescriptorCountPerTable = descriptorCountPerTable;
+	m_DynamicRangeCount = dynamicRangeCount;
+	m_DescriptorCountPerDynamicRange = descriptorCountPerDynamicRange;
+	m_DescriptorSize = m_pDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+	D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+	heapDesc.NumDescriptors = m_MaxTableCount * m_DescriptorCountPerTable + m_DynamicRangeCount * m_DescriptorCountPerDynamicRange;
+	heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+	heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+	hr = m_pDevice->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_pHeap));
+	BREAK_IF_FAILED(hr);
+	m_pHeap->SetName(L"ShaderVisibleDescriptorHeap");
+
+	m_TableIndexCreator.Initialize(m_MaxTableCount);
+
+	m_RetireQueue.Initialize(m_MaxTableCount);
+}
+
+bool ShaderVisibleDescriptorHeap::AllocPersistentTable(UINT* pOutTableIndex, D3D12_CPU_DESCRIPTOR_HANDLE* pOutCPUHandle, D3D12_GPU_DESCRIPTOR_HANDLE* pOutGPUHandle)
+{
+	_ASSERT(pOutTableIndex);
+	_ASSERT(pOutCPUHandle);
+	_ASSERT(pOutGPUHandle);
+
+	ULONG index;
+	if (!m_TableIndexCreator.Alloc(&index))
+	{
+		return false;
+	}
+
+	const UINT OFFSET = (UINT)index * m_DescriptorCountPerTable;
+	*pOutTableIndex = (UINT)index;
+	*pOutCPUHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(m_pHeap->GetCPUDescriptorHandleForHeapStart(), OFFSET, m_DescriptorSize);
+	*pOutGPUHandle = CD3DX12_GPU_DESCRIPTOR_HANDLE(m_pHeap->GetGPUDescriptorHandleForHeapStart(), OFFSET, m_DescriptorSize);
+
+	return true;
+}
+
+void ShaderVisibleDescriptorHeap::FreePersistentTable(UINT tableIndex)
+{
+	m_RetireQueue.Push(tableIndex);
+}
+
+void ShaderVisibleDescriptorHeap::FinishFrame(UINT64 fenceValue)
+{
+	m_RetireQueue.FinishFrame(fenceValue);
+}
+
+void ShaderVisibleDescriptorHeap::Retire(UINT64 completedFenceValue)
+{
+	m_RetireQueue.Retire(completedFenceValue, &m_TableIndexCreator);
+}
+
+void ShaderVisibleDescriptorHeap::GetDynamicRange(UINT rangeIndex, D3D12_CPU_DESCRIPTOR_HANDLE* pOutCPUHandle, D3D12_GPU_DESCRIPTOR_HANDLE* pOutGPUHandle)
+{
+	_ASSERT(rangeIndex < m_DynamicRangeCount);
+	_ASSERT(pOutCPUHandle);
+	_ASSERT(pOutGPUHandle);
+
+	const UINT OFFSET = m_MaxTableCount * m_DescriptorCountPerTable + rangeIndex * m_DescriptorCountPerDynamicRange;
+	*pOutCPUHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(m_pHeap->GetCPUDescriptorHandleForHeapStart(), OFFSET, m_DescriptorSize);
+	*pOutGPUHandle = CD3DX12_GPU_DESCRIPTOR_HANDLE(m_pHeap->GetGPUDescriptorHandleForHeapStart(), OFFSET, m_DescriptorSize);
+}
+
+void ShaderVisibleDescriptorHeap::Cleanup()
+{
+	//   GPU idle̹Ƿ   table  ȯ.
+	m_RetireQueue.RetireAll(&m_TableIndexCreator);
+	m_RetireQueue.Cleanup();
+
+#ifdef _DEBUG
+	if (m_MaxTableCount > 0)
+	{
+		m_TableIndexCreator.Check();
+	}
+#endif
+	m_TableIndexCreator.Clear();
+
+	m_MaxTableCount = 0;
+	m_DescriptorCountPerTable = 0;
+	m_DynamicRangeCount = 0;
+	m_DescriptorCountPerDynamicRange = 0;
+	m_DescriptorSize = 0;
+
+	SAFE_RELEASE(m_pHeap);
+	SAFE_RELEASE(m_pDevice);
+}
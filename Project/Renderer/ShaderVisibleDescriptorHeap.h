@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../Util/IndexCreator.h"
+#include "DescriptorTableRetireQueue.h"
+
+//  command list   ϳ shader visible CBV/SRV/UAV heap.
+//  material tableó    ΰ   persistent table ,
+//  DynamicDescriptorPool ϳ  ִ per-frame .
+// heap ϳ̹Ƿ SetDescriptorHeaps  ٲ .
+
+class ShaderVisibleDescriptorHeap
+{
+public:
+	ShaderVisibleDescriptorHeap() = default;
+	~ShaderVisibleDescriptorHeap() { Cleanup(); }
+
+	void Initialize(ID3D12Device5* pDevice, UINT maxTableCount, UINT descriptorCountPerTable, UINT dynamicRangeCount, UINT descriptorCountPerDynamicRange);
+
+	// table ũ  .  table  false.
+	bool AllocPersistentTable(UINT* pOutTableIndex, D3D12_CPU_DESCRIPTOR_HANDLE* pOutCPUHandle, D3D12_GPU_DESCRIPTOR_HANDLE* pOutGPUHandle);
+	// GPU  а   Ƿ ٷ ȯ ʰ FinishFrame, Retire  ȯ. main thread .
+	void FreePersistentTable(UINT tableIndex);
+
+	// ݱ Free table fenceValue .
+	void FinishFrame(UINT64 fenceValue);
+	// completedFenceValue Ϸ  table ȯ.
+	void Retire(UINT64 completedFenceValue);
+
+	void GetDynamicRange(UINT rangeIndex, D3D12_CPU_DESCRIPTOR_HANDLE* pOutCPUHandle, D3D12_GPU_DESCRIPTOR_HANDLE* pOutGPUHandle);
+
+	void Cleanup();
+
+	inline ID3D12DescriptorHeap* GetDescriptorHeap() { return m_pHeap; }
+	inline UINT GetDescriptorCountPerDynamicRange() { return m_DescriptorCountPerDynamicRange; }
+	inline UINT GetAllocatedTableCount() { return (UINT)m_TableIndexCreator.GetAllocatedCount(); }
+
+private:
+	ID3D12Device5* m_pDevice = nullptr;
+	ID3D12DescriptorHeap* m_pHeap = nullptr;
+	IndexCreator m_TableIndexCreator;
+	UINT m_DescriptorSize = 0;
+
+	UINT m_MaxTableCount = 0;
+	UINT m_DescriptorCountPerTable = 0;
+	UINT m_DynamicRangeCount = 0;
+	UINT m_DescriptorCountPerDynamicRange = 0;
+
+	// ȯ   table.
+	DescriptorTableRetireQueue m_RetireQueue;
+};
@@ -0,0 +1,98 @@
+#include "../pch.h"
+#include "SkinningPaletteAllocator.h"
+
+void SkinningPaletteAllocator::Initialize(UINT matrixCountPerFrame, UINT frameCount)
+{
+	_ASSERT(matrixCountPerFrame > 0);
+	_ASSERT(frameCount > 0);
+
+	m_MatrixCountPerFrame = matrixCountPerFrame;
+	m_FrameCount = frameCount;
+	m_UsedMatrixCount = 0;
+
+	m_FreeRanges.clear();
+	m_FreeRanges.push_back({ 0, matrixCountPerFrame });
+}
+
+bool SkinningPaletteAllocator::Alloc(UINT matrixCount, UINT* pOutOffset)
+{
+	_ASSERT(pOutOffset);
+
+	if (matrixCount == 0)
+	{
+		return false;
+	}
+
+	for (UINT64 i = 0, size = m_FreeRanges.size(); i < size; ++i)
+	{
+		SkinningPaletteRange& range = m_FreeRanges[i];
+		if (range.Count < matrixCount)
+		{
+			continue;
+		}
+
+		*pOutOffset = range.Offset;
+		range.Offset += matrixCount;
+		range.Count -= matrixCount;
+		if (range.Count == 0)
+		{
+			m_FreeRanges.erase(m_FreeRanges.begin() + i);
+		}
+		m_UsedMatrixCount += matrixCount;
+
+		return true;
+	}
+
+	return false;
+}
+
+void SkinningPaletteAllocator::Free(UINT offset, UINT matrixCount)
+{
+	_ASSERT(matrixCount > 0);
+	_ASSERT(offset + matrixCount <= m_MatrixCountPerFrame);
+	_ASSERT(m_UsedMatrixCount >= matrixCount);
+
+	// offset ڿ ִ ù  .
+	UINT64 next = 0;
+	const UINT64 RANGE_COUNT = m_FreeRanges.size();
+	while (next < RANGE_COUNT && m_FreeRanges[next].Offset < offset)
+	{
+		++next;
+	}
+
+	//  ȯ ˻.
+	_ASSERT(next == RANGE_COUNT || offset + matrixCount <= m_FreeRanges[next].Offset);
+	_ASSERT(next == 0 || m_FreeRanges[next - 1].Offset + m_FreeRanges[next - 1].Count <= offset);
+
+	bool bMergePrev = (next > 0 && m_FreeRanges[next - 1].Offset + m_FreeRanges[next - 1].Count == offset);
+	bool bMergeNext = (next < RANGE_COUNT && offset + matrixCount == m_FreeRanges[next].Offset);
+
+	if (bMergePrev && bMergeNext)
+	{
+		m_FreeRanges[next - 1].Count += matrixCount + m_FreeRanges[next].Count;
+		m_FreeRanges.erase(m_FreeRanges.begin() + next);
+	}
+	else if (bMergePrev)
+	{
+		m_FreeRanges[next - 1].Count += matrixCount;
+	}
+	else if (bMergeNext)
+	{
+		m_FreeRanges[next].Offset = offset;
+		m_FreeRanges[next].Count += matrixCount;
+	}
+	else
+	{
+		m_FreeRanges.insert(m_FreeRanges.begin() + next, { offset, matrixCount });
+	}
+
+	m_UsedMatrixCount -= matrixCount;
+}
+
+void SkinningPaletteAllocator::Cleanup()
+{
+	m_FreeRanges.clear();
+	m_MatrixCountPerFrame = 0;
+	m_FrameCount = 0;
+	m_UsedMatrixCount = 0;
+}
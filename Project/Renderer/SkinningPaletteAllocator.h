@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+// skinning palette ring  frame  ȿ ĳͺ matrix   ִ Ҵ.
+// offset 길 ϹǷ device  ܵ  .
+//  frame   ġ Ƿ,  ġ frame * capacity + offset.
+
+struct SkinningPaletteRange
+{
+	UINT Offset;
+	UINT Count;
+};
+
+class SkinningPaletteAllocator
+{
+public:
+	SkinningPaletteAllocator() = default;
+	~SkinningPaletteAllocator() { Cleanup(); }
+
+	void Initialize(UINT matrixCountPerFrame, UINT frameCount);
+
+	// տ ó ´   ߶ .     false.
+	bool Alloc(UINT matrixCount, UINT* pOutOffset);
+	// ̿   ħ. GPU  ̻    ȣ.
+	void Free(UINT offset, UINT matrixCount);
+
+	// buffer ó  matrix ġ. SRV FirstElement ״ .
+	inline UINT GetElementOffset(UINT frameIndex, UINT offset) { _ASSERT(frameIndex < m_FrameCount); return frameIndex * m_MatrixCountPerFrame + offset; }
+
+	void Cleanup();
+
+	inline UINT GetMatrixCountPerFrame() { return m_MatrixCountPerFrame; }
+	inline UINT GetFrameCount() { return m_FrameCount; }
+	inline UINT GetUsedMatrixCount() { return m_UsedMatrixCount; }
+	inline UINT GetFreeRangeCount() { return (UINT)m_FreeRanges.size(); }
+
+private:
+	std::vector<SkinningPaletteRange> m_FreeRanges; // offset  .
+	UINT m_MatrixCountPerFrame = 0;
+	UINT m_FrameCount = 0;
+	UINT m_UsedMatrixCount = 0;
+};
@@ -0,0 +1,117 @@
+#include "../pch.h"
+#include "DescriptorAllocator.h"
+#include "SkinningPaletteRing.h"
+
+void SkinningPaletteRing::Initialize(ID3D12Device5* pDevice, DescriptorAllocator* pSRVAllocator, UINT matrixCountPerFrame)
+{
+	_ASSERT(pDevice);
+	_ASSERT(pSRVAllocator);
+	_ASSERT(matrixCountPerFrame > 0);
+
+	HRESULT hr = S_OK;
+
+	m_pDevice = pDevice;
+	m_pSRVAllocator = pSRVAllocator;
+	m_Allocator.Initialize(matrixCountPerFrame, SWAP_CHAIN_FRAME_COUNT);
+
+	const UINT64 BUFFER_SIZE = (UINT64)matrixCountPerFrame * SWAP_CHAIN_FRAME_COUNT * sizeof(Matrix);
+	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
+	CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(BUFFER_SIZE);
+
+	hr = m_pDevice->CreateCommittedResource(&heapProps,
+											D3D12_HEAP_FLAG_NONE,
+											&resourceDesc,
+											D3D12_RESOURCE_STATE_GENERIC_READ,
+											nullptr,
+											IID_PPV_ARGS(&m_pUploadBuffer));
+	BREAK_IF_FAILED(hr);
+	m_pUploadBuffer->SetName(L"SkinningPaletteRing");
+
+	//   map  . CPU ⸸ .
+	CD3DX12_RANGE readRange(0, 0);
+	hr = m_pUploadBuffer->Map(0, &readRange, (void**)&m_pSystemMemAddr);
+	BREAK_IF_FAILED(hr);
+}
+
+bool SkinningPaletteRing::AllocPalette(UINT matrixCount, SkinningPalette* pOutPalette)
+{
+	_ASSERT(m_pUploadBuffer);
+	_ASSERT(pOutPalette);
+
+	UINT offset = 0;
+	if (!m_Allocator.Alloc(matrixCount, &offset))
+	{
+		return false;
+	}
+
+	pOutPalette->Offset = offset;
+	pOutPalette->MatrixCount = matrixCount;
+
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+	srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	srvDesc.Buffer.NumElements = matrixCount;
+	srvDesc.Buffer.StructureByteStride = sizeof(Matrix);
+	srvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
+
+	for (UINT i = 0; i < SWAP_CHAIN_FRAME_COUNT; ++i)
+	{
+		m_pSRVAllocator->AllocDescriptorHandle(&pOutPalette->pSRVHandles[i]);
+		_ASSERT(pOutPalette->pSRVHandles[i].ptr);
+
+		srvDesc.Buffer.FirstElement = m_Allocator.GetElementOffset(i, offset);
+		m_pDevice->CreateShaderResourceView(m_pUploadBuffer, &srvDesc, pOutPalette->pSRVHandles[i]);
+
+		Matrix* pDest = GetPaletteMemory(*pOutPalette, i);
+		for (UINT j = 0; j < matrixCount; ++j)
+		{
+			pDest[j] = Matrix();
+		}
+	}
+
+	return true;
+}
+
+void SkinningPaletteRing::FreePalette(SkinningPalette* pPalette)
+{
+	_ASSERT(pPalette);
+
+	if (pPalette->MatrixCount == 0)
+	{
+		return;
+	}
+
+	for (UINT i = 0; i < SWAP_CHAIN_FRAME_COUNT; ++i)
+	{
+		m_pSRVAllocator->FreeDescriptorHandle(pPalette->pSRVHandles[i]);
+	}
+	m_Allocator.Free(pPalette->Offset, pPalette->MatrixCount);
+
+	ZeroMemory(pPalette, sizeof(SkinningPalette));
+}
+
+Matrix* SkinningPaletteRing::GetPaletteMemory(const SkinningPalette& PALETTE, UINT frameIndex)
+{
+	_ASSERT(m_pSystemMemAddr);
+	_ASSERT(PALETTE.Offset + PALETTE.MatrixCount <= m_Allocator.GetMatrixCountPerFrame());
+
+	return m_pSystemMemAddr + m_Allocator.GetElementOffset(frameIndex, PALETTE.Offset);
+}
+
+void SkinningPaletteRing::Cleanup()
+{
+	//   ִٸ ĳ  .
+	_ASSERT(m_Allocator.GetUsedMatrixCount() == 0);
+
+	if (m_pUploadBuffer && m_pSystemMemAddr)
+	{
+		m_pUploadBuffer->Unmap(0, nullptr);
+	}
+	m_pSystemMemAddr = nullptr;
+	SAFE_RELEASE(m_pUploadBuffer);
+
+	m_Allocator.Cleanup();
+	m_pSRVAllocator = nullptr;
+	m_pDevice = nullptr;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <directxtk12/SimpleMath.h>
+#include "ResourceManager.h"
+#include "SkinningPaletteAllocator.h"
+
+//  skinned ĳ bone matrix  ϳ upload buffer.
+// SWAP_CHAIN_FRAME_COUNT frame    map  .
+// ĳʹ   offset  ,  frame     .
+//  frame  present fence ٸ ̹Ƿ GPU а  .
+
+using DirectX::SimpleMath::Matrix;
+
+class DescriptorAllocator;
+
+struct SkinningPalette
+{
+	UINT Offset;
+	UINT MatrixCount;
+	D3D12_CPU_DESCRIPTOR_HANDLE pSRVHandles[SWAP_CHAIN_FRAME_COUNT]; // frame  FirstElement ٸ SRV.
+};
+
+class SkinningPaletteRing
+{
+public:
+	SkinningPaletteRing() = default;
+	~SkinningPaletteRing() { Cleanup(); }
+
+	void Initialize(ID3D12Device5* pDevice, DescriptorAllocator* pSRVAllocator, UINT matrixCountPerFrame);
+
+	//  SRV   frame  ķ ä.  ڶ false.
+	bool AllocPalette(UINT matrixCount, SkinningPalette* pOutPalette);
+	// GPU  ̻    ȣ.
+	void FreePalette(SkinningPalette* pPalette);
+
+	Matrix* GetPaletteMemory(const SkinningPalette& PALETTE, UINT frameIndex);
+
+	void Cleanup();
+
+	inline SkinningPaletteAllocator* GetAllocator() { return &m_Allocator; }
+
+private:
+	ID3D12Device5* m_pDevice = nullptr;
+	DescriptorAllocator* m_pSRVAllocator = nullptr;
+
+	ID3D12Resource* m_pUploadBuffer = nullptr;
+	Matrix* m_pSystemMemAddr = nullptr;
+	SkinningPaletteAllocator m_Allocator;
+};
@@ -11,7 +11,7 @@ void TextureManager::Initialize(Renderer* pRenderer, UINT maxBucketNum, UINT max
 	m_pResourceManager = pRenderer->GetResourceManager();
 
 	m_pHashTable = new HashTable;
-	m_pHashTable->Initialize(maxBucketNum, _MAX_PATH, maxFileNum);
+	m_pHashTable->Initialize(maxBucketNum, _MAX_PATH * sizeof(WCHAR), maxFileNum);
 }
 
 TextureHandle* TextureManager::CreateTextureFromFile(const WCHAR* pszFileName, bool bUseSRGB)
@@ -73,6 +73,66 @@ TextureHandle* TextureManager::CreateTextureFromFile(const WCHAR* pszFileName, b
 	return pTextureHandle;
 }
 
+TextureHandle* TextureManager::CreateTextureFromImage(const WCHAR* pszFileName, const BYTE* pImage, UINT width, UINT height, DXGI_FORMAT format)
+{
+	_ASSERT(m_pRenderer);
+	_ASSERT(m_pResourceManager);
+	_ASSERT(pszFileName);
+	_ASSERT(pImage);
+
+	ID3D12Device* pDevice = m_pRenderer->GetD3DDevice();
+	DescriptorAllocator* pSRVDescriptorAllocator = m_pRenderer->GetSRVUAVAllocator();
+
+	ID3D12Resource* pTextureResource = nullptr;
+	D3D12_CPU_DESCRIPTOR_HANDLE srvHandle;
+	D3D12_RESOURCE_DESC desc;
+	TextureHandle* pTextureHandle = nullptr;
+
+	UINT fileNameLen = (UINT)wcslen(pszFileName);
+	UINT keySize = fileNameLen * sizeof(WCHAR);
+	if (m_pHashTable->Select((void**)&pTextureHandle, 1, pszFileName, keySize))
+	{
+		++pTextureHandle->RefCount;
+	}
+	else
+	{
+		HRESULT hr = m_pResourceManager->CreateTextureFromImage(&pTextureResource, &desc, pImage, width, height, format);
+		if (SUCCEEDED(hr))
+		{
+			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+			srvDesc.Format = desc.Format;
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+			srvDesc.Texture2D.MipLevels = desc.MipLevels;
+
+			if (pSRVDescriptorAllocator->AllocDescriptorHandle(&srvHandle))
+			{
+				pDevice->CreateShaderResourceView(pTextureResource, &srvDesc, srvHandle);
+
+				pTextureHandle = allocTextureHandle();
+				pTextureHandle->pTextureResource = pTextureResource;
+				pTextureHandle->bFromFile = true;
+				pTextureHandle->SRVHandle = srvHandle;
+				pTextureHandle->GPUHandle = pTextureResource->GetGPUVirtualAddress();
+
+				pTextureHandle->pSearchHandle = m_pHashTable->Insert((void*)pTextureHandle, pszFileName, keySize);
+				if (!pTextureHandle->pSearchHandle)
+				{
+					__debugbreak();
+				}
+
+			}
+			else
+			{
+				pTextureResource->Release();
+				pTextureResource = nullptr;
+			}
+		}
+	}
+
+	return pTextureHandle;
+}
+
 TextureHandle* TextureManager::CreateTexturFromDDSFile(const WCHAR* pszFileName, bool bIsCube)
 {
 	_ASSERT(m_pRenderer);
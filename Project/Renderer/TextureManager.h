@@ -30,6 +30,8 @@ public:
 	void Initialize(Renderer* pRenderer, UINT maxBucketNum, UINT maxFileNum);
 
 	TextureHandle* CreateTextureFromFile(const WCHAR* pszFileName, bool bUseSRGB);
+	// ٸ 忡 decode  ̹ pszFileName .   ̸ CreateTextureFromFile decode  .
+	TextureHandle* CreateTextureFromImage(const WCHAR* pszFileName, const BYTE* pImage, UINT width, UINT height, DXGI_FORMAT format);
 	TextureHandle* CreateTexturFromDDSFile(const WCHAR* pszFileName, bool bIsCube);
 	TextureHandle* CreateDynamicTexture(UINT width, UINT height);
 	TextureHandle* CreateImmutableTexture(UINT widht, UINT height, DXGI_FORMAT format, const BYTE* pInitImage);
@@ -0,0 +1,384 @@
+#include "../pch.h"
+#include "UploadManager.h"
+
+void UploadManager::Initialize(ID3D12Device5* pDevice, UINT64 stagingSize)
+{
+	_ASSERT(pDevice);
+	_ASSERT(stagingSize > 0);
+
+	HRESULT hr = S_OK;
+
+	m_pDevice = pDevice;
+
+	D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+	queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+	queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+	hr = m_pDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&m_pCopyQueue));
+	BREAK_IF_FAILED(hr);
+	m_pCopyQueue->SetName(L"UploadCopyQueue");
+
+	for (UINT i = 0; i < MAX_UPLOAD_BATCH_COUNT; ++i)
+	{
+		hr = m_pDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&m_ppCommandAllocators[i]));
+		BREAK_IF_FAILED(hr);
+	}
+
+	hr = m_pDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, m_ppCommandAllocators[0], nullptr, IID_PPV_ARGS(&m_pCommandList));
+	BREAK_IF_FAILED(hr);
+	m_pCommandList->SetName(L"UploadCommandList");
+	m_pCommandList->Close();
+
+	hr = m_pDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_pFence));
+	BREAK_IF_FAILED(hr);
+	m_hFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	m_FenceValue = 0;
+
+	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
+	CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(stagingSize);
+	hr = m_pDevice->CreateCommittedResource(&heapProps,
+											D3D12_HEAP_FLAG_NONE,
+											&resourceDesc,
+											D3D12_RESOURCE_STATE_GENERIC_READ,
+											nullptr,
+											IID_PPV_ARGS(&m_pStagingBuffer));
+	BREAK_IF_FAILED(hr);
+	m_pStagingBuffer->SetName(L"UploadStagingRing");
+
+	//   map  . CPU ⸸ .
+	CD3DX12_RANGE readRange(0, 0);
+	hr = m_pStagingBuffer->Map(0, &readRange, (void**)&m_pStagingMemAddr);
+	BREAK_IF_FAILED(hr);
+
+	m_StagingRing.Initialize(stagingSize);
+}
+
+HRESULT UploadManager::UploadBuffer(ID3D12Resource* pDestBuffer, UINT64 destOffset, const void* pDATA, UINT64 size)
+{
+	_ASSERT(m_pCopyQueue);
+	_ASSERT(pDestBuffer);
+	_ASSERT(pDATA);
+
+	HRESULT hr = S_OK;
+
+	ID3D12Resource* pStagingBuffer = nullptr;
+	UINT64 stagingOffset = 0;
+	BYTE* pStagingMemAddr = nullptr;
+
+	hr = allocStaging(size, 16, &pStagingBuffer, &stagingOffset, &pStagingMemAddr);
+	if (FAILED(hr))
+	{
+		goto LB_RET;
+	}
+	memcpy(pStagingMemAddr, pDATA, size);
+
+	hr = beginBatch();
+	if (FAILED(hr))
+	{
+		goto LB_RET;
+	}
+
+	m_pCommandList->CopyBufferRegion(pDestBuffer, destOffset, pStagingBuffer, stagingOffset, size);
+	++m_PendingCopyCount;
+
+LB_RET:
+	return hr;
+}
+
+HRESULT UploadManager::UploadTexture(ID3D12Resource* pDestTexture, UINT firstSubresource, UINT numSubresources, const D3D12_SUBRESOURCE_DATA* pSUBRESOURCES)
+{
+	_ASSERT(m_pCopyQueue);
+	_ASSERT(pDestTexture);
+	_ASSERT(pSUBRESOURCES);
+	_ASSERT(numSubresources > 0);
+
+	HRESULT hr = S_OK;
+
+	ID3D12Resource* pStagingBuffer = nullptr;
+	UINT64 stagingOffset = 0;
+	BYTE* pStagingMemAddr = nullptr;
+	UINT64 totalBytes = 0;
+
+	D3D12_RESOURCE_DESC desc = pDestTexture->GetDesc();
+	m_Footprints.resize(numSubresources);
+	m_RowCounts.resize(numSubresources);
+	m_RowSizes.resize(numSubresources);
+	m_pDevice->GetCopyableFootprints(&desc, firstSubresource, numSubresources, 0, m_Footprints.data(), m_RowCounts.data(), m_RowSizes.data(), &totalBytes);
+
+	hr = allocStaging(totalBytes, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, &pStagingBuffer, &stagingOffset, &pStagingMemAddr);
+	if (FAILED(hr))
+	{
+		goto LB_RET;
+	}
+
+	hr = beginBatch();
+	if (FAILED(hr))
+	{
+		goto LB_RET;
+	}
+
+	for (UINT i = 0; i < numSubresources; ++i)
+	{
+		// footprint offset 0 . staging  ۵ 512byte ̹Ƿ ص  .
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint = m_Footprints[i];
+		D3D12_MEMCPY_DEST destData = { pStagingMemAddr + footprint.Offset, footprint.Footprint.RowPitch, (SIZE_T)footprint.Footprint.RowPitch * m_RowCounts[i] };
+		MemcpySubresource(&destData, &pSUBRESOURCES[i], (SIZE_T)m_RowSizes[i], m_RowCounts[i], footprint.Footprint.Depth);
+
+		footprint.Offset += stagingOffset;
+		CD3DX12_TEXTURE_COPY_LOCATION destLocation(pDestTexture, firstSubresource + i);
+		CD3DX12_TEXTURE_COPY_LOCATION srcLocation(pStagingBuffer, footprint);
+		m_pCommandList->CopyTextureRegion(&destLocation, 0, 0, 0, &srcLocation, nullptr);
+	}
+	++m_PendingCopyCount;
+
+LB_RET:
+	return hr;
+}
+
+UINT64 UploadManager::Flush()
+{
+	_ASSERT(m_pCopyQueue);
+
+	if (!m_bRecording)
+	{
+		return m_FenceValue;
+	}
+
+	m_pCommandList->Close();
+
+	ID3D12CommandList* ppCommandLists[1] = { m_pCommandList };
+	m_pCopyQueue->ExecuteCommandLists(1, ppCommandLists);
+
+	++m_FenceValue;
+	m_pCopyQueue->Signal(m_pFence, m_FenceValue);
+
+	m_RetireQueue.FinishBatch(m_FenceValue);
+	m_StagingRing.FinishFrame(m_FenceValue);
+
+	m_PendingCopyCount = 0;
+	m_bRecording = false;
+
+	return m_FenceValue;
+}
+
+bool UploadManager::IsTicketComplete(UINT64 ticket)
+{
+	_ASSERT(m_pFence);
+	return (m_pFence->GetCompletedValue() >= ticket);
+}
+
+void UploadManager::WaitForTicket(UINT64 ticket)
+{
+	_ASSERT(m_pFence);
+	_ASSERT(ticket <= m_FenceValue);
+
+	if (m_pFence->GetCompletedValue() < ticket)
+	{
+		m_pFence->SetEventOnCompletion(ticket, m_hFenceEvent);
+		WaitForSingleObject(m_hFenceEvent, INFINITE);
+	}
+}
+
+void UploadManager::WaitOnQueue(ID3D12CommandQueue* pQueue, UINT64 ticket)
+{
+	_ASSERT(pQueue);
+	_ASSERT(m_pFence);
+
+	if (ticket == 0)
+	{
+		return;
+	}
+	pQueue->Wait(m_pFence, ticket);
+}
+
+void UploadManager::Retire()
+{
+	if (!m_pFence)
+	{
+		return;
+	}
+
+	const UINT64 COMPLETED_FENCE_VALUE = m_pFence->GetCompletedValue();
+	m_StagingRing.Retire(COMPLETED_FENCE_VALUE);
+
+	ID3D12Resource* pLargeBuffer = nullptr;
+	while ((pLargeBuffer = m_RetireQueue.PopCompletedLargeBuffer(COMPLETED_FENCE_VALUE)) != nullptr)
+	{
+		pLargeBuffer->Unmap(0, nullptr);
+		pLargeBuffer->Release();
+	}
+}
+
+void UploadManager::Cleanup()
+{
+	//   copy .  resource ̹   .
+	if (m_bRecording)
+	{
+		m_pCommandList->Close();
+		m_bRecording = false;
+	}
+	m_PendingCopyCount = 0;
+
+	if (m_pFence)
+	{
+		WaitForTicket(m_FenceValue);
+		Retire();
+	}
+
+	//   batch  ӽ buffer.
+	ID3D12Resource* pLargeBuffer = nullptr;
+	while ((pLargeBuffer = m_RetireQueue.PopLargeBuffer()) != nullptr)
+	{
+		pLargeBuffer->Unmap(0, nullptr);
+		pLargeBuffer->Release();
+	}
+	m_RetireQueue.Cleanup();
+
+	if (m_pStagingBuffer && m_pStagingMemAddr)
+	{
+		m_pStagingBuffer->Unmap(0, nullptr);
+	}
+	m_pStagingMemAddr = nullptr;
+	SAFE_RELEASE(m_pStagingBuffer);
+	m_StagingRing.Cleanup();
+
+	if (m_hFenceEvent)
+	{
+		CloseHandle(m_hFenceEvent);
+		m_hFenceEvent = nullptr;
+	}
+	m_FenceValue = 0;
+	SAFE_RELEASE(m_pFence);
+
+	SAFE_RELEASE(m_pCommandList);
+	for (UINT i = 0; i < MAX_UPLOAD_BATCH_COUNT; ++i)
+	{
+		SAFE_RELEASE(m_ppCommandAllocators[i]);
+	}
+	SAFE_RELEASE(m_pCopyQueue);
+
+	m_pDevice = nullptr;
+}
+
+HRESULT UploadManager::allocStaging(UINT64 size, UINT64 alignment, ID3D12Resource** ppOutBuffer, UINT64* pOutOffset, BYTE** ppOutSystemMemAddr)
+{
+	_ASSERT(ppOutBuffer);
+	_ASSERT(pOutOffset);
+	_ASSERT(ppOutSystemMemAddr);
+
+	HRESULT hr = S_OK;
+	UINT64 offset = 0;
+
+	if (size > m_StagingRing.GetCapacity())
+	{
+		hr = createLargeBuffer(size, ppOutBuffer, ppOutSystemMemAddr);
+		*pOutOffset = 0;
+		goto LB_RET;
+	}
+
+	if (!m_StagingRing.Alloc(size, alignment, &offset))
+	{
+		//  .  copy ϰ    ٸ  ó .
+		Flush();
+		WaitForTicket(m_FenceValue);
+		Retire();
+
+		if (!m_StagingRing.Alloc(size, alignment, &offset))
+		{
+			__debugbreak();
+			hr = E_OUTOFMEMORY;
+			goto LB_RET;
+		}
+	}
+
+	*ppOutBuffer = m_pStagingBuffer;
+	*pOutOffset = offset;
+	*ppOutSystemMemAddr = m_pStagingMemAddr + offset;
+
+LB_RET:
+	return hr;
+}
+
+HRESULT UploadManager::createLargeBuffer(UINT64 size, ID3D12Resource** ppOutBuffer, BYTE** ppOutSystemMemAddr)
+{
+	HRESULT hr = S_OK;
+	ID3D12Resource* pBuffer = nullptr;
+	BYTE* pSystemMemAddr = nullptr;
+
+	if (m_RetireQueue.GetLargeBufferCount() >= MAX_LARGE_UPLOAD_BUFFER_COUNT)
+	{
+		Flush();
+		WaitForTicket(m_FenceValue);
+		Retire();
+	}
+
+	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
+	CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
+	hr = m_pDevice->CreateCommittedResource(&heapProps,
+											D3D12_HEAP_FLAG_NONE,
+											&resourceDesc,
+											D3D12_RESOURCE_STATE_GENERIC_READ,
+											nullptr,
+											IID_PPV_ARGS(&pBuffer));
+	if (FAILED(hr))
+	{
+		goto LB_RET;
+	}
+	pBuffer->SetName(L"LargeUploadBuffer");
+
+	{
+		CD3DX12_RANGE readRange(0, 0);
+		hr = pBuffer->Map(0, &readRange, (void**)&pSystemMemAddr);
+		if (FAILED(hr))
+		{
+			SAFE_RELEASE(pBuffer);
+			goto LB_RET;
+		}
+	}
+
+	if (!m_RetireQueue.PushLargeBuffer(pBuffer))
+	{
+		//  á տ Flushϰ ٷ Ƿ  .
+		__debugbreak();
+		pBuffer->Unmap(0, nullptr);
+		SAFE_RELEASE(pBuffer);
+		hr = E_OUTOFMEMORY;
+		goto LB_RET;
+	}
+
+	*ppOutBuffer = pBuffer;
+	*ppOutSystemMemAddr = pSystemMemAddr;
+
+LB_RET:
+	return hr;
+}
+
+HRESULT UploadManager::beginBatch()
+{
+	HRESULT hr = S_OK;
+
+	if (m_bRecording)
+	{
+		goto LB_RET;
+	}
+
+	{
+		// allocator  Ƿ  allocator  batch  reset .
+		ID3D12CommandAllocator* pCommandAllocator = m_ppCommandAllocators[m_RetireQueue.GetCurBatchIndex()];
+		WaitForTicket(m_RetireQueue.GetCurBatchTicket());
+
+		hr = pCommandAllocator->Reset();
+		if (FAILED(hr))
+		{
+			goto LB_RET;
+		}
+		hr = m_pCommandList->Reset(pCommandAllocator, nullptr);
+		if (FAILED(hr))
+		{
+			goto LB_RET;
+		}
+	}
+	m_bRecording = true;
+
+LB_RET:
+	return hr;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+#include "UploadRetireQueue.h"
+#include "UploadRingAllocator.h"
+
+//  buffer, texture ʱ data copy queue ø.
+// data  map   staging ring ϰ copy ɸ ׾ . Flush   ϰ copy fence  ticket .
+// staging  ticket   Retire ȯ. (UploadRingAllocator)
+// batch allocator  ring ū ӽ buffer ticket . (UploadRetireQueue)
+//  resource COMMON(Ǵ COPY_DEST) ·  . copy queue  resource  COMMON ư,
+// graphics queue   Ϲ vertex/index buffer, SRV ° .
+// main 忡 .
+
+static const UINT64 UPLOAD_STAGING_SIZE = 32 * 1024 * 1024;
+
+class UploadManager
+{
+public:
+	UploadManager() = default;
+	~UploadManager() { Cleanup(); }
+
+	void Initialize(ID3D12Device5* pDevice, UINT64 stagingSize);
+
+	HRESULT UploadBuffer(ID3D12Resource* pDestBuffer, UINT64 destOffset, const void* pDATA, UINT64 size);
+	HRESULT UploadTexture(ID3D12Resource* pDestTexture, UINT firstSubresource, UINT numSubresources, const D3D12_SUBRESOURCE_DATA* pSUBRESOURCES);
+
+	//  copy ϰ ticket ȯ.     ticket.
+	UINT64 Flush();
+
+	bool IsTicketComplete(UINT64 ticket);
+	// CPU . , staging  .
+	void WaitForTicket(UINT64 ticket);
+	// GPU . pQueue   ticket copy   .
+	void WaitOnQueue(ID3D12CommandQueue* pQueue, UINT64 ticket);
+
+	// GPU  staging  ӽ buffer ȯ. frame.
+	void Retire();
+
+	void Cleanup();
+
+	inline UINT GetPendingCopyCount() { return m_PendingCopyCount; }
+	inline UINT64 GetLastTicket() { return m_FenceValue; }
+	inline UINT64 GetUsedStagingSize() { return m_StagingRing.GetUsedSize(); }
+
+protected:
+	// ring ū data  copy  upload buffer  batch  .
+	HRESULT allocStaging(UINT64 size, UINT64 alignment, ID3D12Resource** ppOutBuffer, UINT64* pOutOffset, BYTE** ppOutSystemMemAddr);
+	HRESULT createLargeBuffer(UINT64 size, ID3D12Resource** ppOutBuffer, BYTE** ppOutSystemMemAddr);
+	HRESULT beginBatch();
+
+private:
+	ID3D12Device5* m_pDevice = nullptr;
+	ID3D12CommandQueue* m_pCopyQueue = nullptr;
+	ID3D12GraphicsCommandList* m_pCommandList = nullptr;
+
+	ID3D12CommandAllocator* m_ppCommandAllocators[MAX_UPLOAD_BATCH_COUNT] = { };
+	UINT m_PendingCopyCount = 0;
+	bool m_bRecording = false;
+
+	ID3D12Fence* m_pFence = nullptr;
+	HANDLE m_hFenceEvent = nullptr;
+	UINT64 m_FenceValue = 0;
+
+	ID3D12Resource* m_pStagingBuffer = nullptr;
+	BYTE* m_pStagingMemAddr = nullptr;
+	UploadRingAllocator m_StagingRing;
+
+	UploadRetireQueue m_RetireQueue;
+
+	// UploadTexture  footprint ӽ .
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> m_Footprints;
+	std::vector<UINT> m_RowCounts;
+	std::vector<UINT64> m_RowSizes;
+};
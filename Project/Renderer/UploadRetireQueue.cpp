@@ -0,0 +1,75 @@
+#include "../pch.h"
+#include "UploadRetireQueue.h"
+
+void UploadRetireQueue::FinishBatch(UINT64 ticket)
+{
+	_ASSERT(ticket > m_pBatchTickets[(m_CurBatchIndex + MAX_UPLOAD_BATCH_COUNT - 1) % MAX_UPLOAD_BATCH_COUNT]);
+
+	m_pBatchTickets[m_CurBatchIndex] = ticket;
+	m_CurBatchIndex = (m_CurBatchIndex + 1) % MAX_UPLOAD_BATCH_COUNT;
+
+	for (UINT i = 0; i < m_LargeBufferCount; ++i)
+	{
+		if (m_pLargeBuffers[i].Ticket == 0)
+		{
+			m_pLargeBuffers[i].Ticket = ticket;
+		}
+	}
+}
+
+bool UploadRetireQueue::PushLargeBuffer(ID3D12Resource* pResource)
+{
+	_ASSERT(pResource);
+
+	if (m_LargeBufferCount >= MAX_LARGE_UPLOAD_BUFFER_COUNT)
+	{
+		return false;
+	}
+
+	m_pLargeBuffers[m_LargeBufferCount].pResource = pResource;
+	m_pLargeBuffers[m_LargeBufferCount].Ticket = 0;
+	++m_LargeBufferCount;
+	return true;
+}
+
+ID3D12Resource* UploadRetireQueue::PopCompletedLargeBuffer(UINT64 completedTicket)
+{
+	for (UINT i = 0; i < m_LargeBufferCount; ++i)
+	{
+		LargeUploadBuffer* pLarge = m_pLargeBuffers + i;
+		if (pLarge->Ticket == 0 || pLarge->Ticket > completedTicket)
+		{
+			continue;
+		}
+
+		ID3D12Resource* pResource = pLarge->pResource;
+		--m_LargeBufferCount;
+		m_pLargeBuffers[i] = m_pLargeBuffers[m_LargeBufferCount];
+		return pResource;
+	}
+	return nullptr;
+}
+
+ID3D12Resource* UploadRetireQueue::PopLargeBuffer()
+{
+	if (m_LargeBufferCount == 0)
+	{
+		return nullptr;
+	}
+
+	--m_LargeBufferCount;
+	return m_pLargeBuffers[m_LargeBufferCount].pResource;
+}
+
+void UploadRetireQueue::Cleanup()
+{
+	// buffer  UploadManager PopLargeBuffer  .
+	_ASSERT(m_LargeBufferCount == 0);
+
+	for (UINT i = 0; i < MAX_UPLOAD_BATCH_COUNT; ++i)
+	{
+		m_pBatchTickets[i] = 0;
+	}
+	m_CurBatchIndex = 0;
+	m_LargeBufferCount = 0;
+}
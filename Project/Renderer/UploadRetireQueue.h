@@ -0,0 +1,48 @@
+#pragma once
+
+// UploadManager copy batch allocator  ring ū ӽ upload buffer ticket(copy fence ) . device  ܵ  .
+// allocator buffer UploadManager  ϸ, ⼭ index, pointer ticket ٷ.
+// FinishBatch   batch ׵ ߰ buffer ticket ݰ, GPU  ticket buffer  .
+
+struct ID3D12Resource;
+
+static const UINT MAX_UPLOAD_BATCH_COUNT = 4;
+static const UINT MAX_LARGE_UPLOAD_BUFFER_COUNT = 8;
+
+struct LargeUploadBuffer
+{
+	ID3D12Resource* pResource;
+	UINT64 Ticket; // 0̸    batch  .
+};
+
+class UploadRetireQueue
+{
+public:
+	UploadRetireQueue() = default;
+	~UploadRetireQueue() { Cleanup(); }
+
+	//  batch  allocator.  allocator   batch ticket  reset .
+	inline UINT GetCurBatchIndex() { return m_CurBatchIndex; }
+	inline UINT64 GetCurBatchTicket() { return m_pBatchTickets[m_CurBatchIndex]; }
+
+	//   batch    buffer ticket ݰ  allocator Ѿ.
+	void FinishBatch(UINT64 ticket);
+
+	//  á false.  batch ϰ ٸ   .
+	bool PushLargeBuffer(ID3D12Resource* pResource);
+	// completedTicket Ϸ  buffer ϳ .  nullptr.
+	ID3D12Resource* PopCompletedLargeBuffer(UINT64 completedTicket);
+	//  ó GPU idle  ticket  ϳ .  nullptr.
+	ID3D12Resource* PopLargeBuffer();
+
+	void Cleanup();
+
+	inline UINT GetLargeBufferCount() { return m_LargeBufferCount; }
+
+private:
+	UINT64 m_pBatchTickets[MAX_UPLOAD_BATCH_COUNT] = { };
+	UINT m_CurBatchIndex = 0;
+
+	LargeUploadBuffer m_pLargeBuffers[MAX_LARGE_UPLOAD_BUFFER_COUNT] = { };
+	UINT m_LargeBufferCount = 0;
+};
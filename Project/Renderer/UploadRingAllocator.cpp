@@ -0,0 +1,132 @@
+#include "../pch.h"
+#include "UploadRingAllocator.h"
+
+void UploadRingAllocator::Initialize(UINT64 capacity)
+{
+	_ASSERT(capacity > 0);
+
+	m_Capacity = capacity;
+	m_Head = 0;
+	m_Tail = 0;
+	m_UsedSize = 0;
+	m_CurFrameSize = 0;
+	m_FirstFrame = 0;
+	m_FrameCount = 0;
+}
+
+bool UploadRingAllocator::Alloc(UINT64 size, UINT64 alignment, UINT64* pOutOffset)
+{
+	_ASSERT(pOutOffset);
+	_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	if (size == 0 || size > m_Capacity)
+	{
+		return false;
+	}
+
+	//   ó .
+	if (m_UsedSize == 0)
+	{
+		m_Head = 0;
+		m_Tail = 0;
+	}
+
+	UINT64 offset = (m_Tail + alignment - 1) & ~(alignment - 1);
+	UINT64 consumedSize = 0;
+
+	if (m_UsedSize > 0 && (m_Tail % m_Capacity) == m_Head)
+	{
+		//  .
+		return false;
+	}
+
+	if (m_Tail >= m_Head)
+	{
+		//    [head, tail).  ڶ   0.
+		if (offset + size <= m_Capacity)
+		{
+			consumedSize = offset + size - m_Tail;
+		}
+		else if (size <= m_Head)
+		{
+			offset = 0;
+			consumedSize = (m_Capacity - m_Tail) + size;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// ̹   .   [tail, head).
+		if (offset + size > m_Head)
+		{
+			return false;
+		}
+		consumedSize = offset + size - m_Tail;
+	}
+
+	m_Tail = offset + size;
+	m_UsedSize += consumedSize;
+	m_CurFrameSize += consumedSize;
+	*pOutOffset = offset;
+
+	return true;
+}
+
+void UploadRingAllocator::FinishFrame(UINT64 fenceValue)
+{
+	if (m_FrameCount > 0)
+	{
+		//  fence   ݰų  ĭ ڶ   ħ. ȯ ʾ  .
+		UploadRingFrame* pLastFrame = m_pFrames + (m_FirstFrame + m_FrameCount - 1) % MAX_UPLOAD_RING_FRAME_COUNT;
+		if (pLastFrame->FenceValue == fenceValue || m_FrameCount == MAX_UPLOAD_RING_FRAME_COUNT)
+		{
+			pLastFrame->FenceValue = fenceValue;
+			pLastFrame->Size += m_CurFrameSize;
+			m_CurFrameSize = 0;
+			return;
+		}
+	}
+
+	if (m_CurFrameSize == 0)
+	{
+		return;
+	}
+
+	UploadRingFrame* pFrame = m_pFrames + (m_FirstFrame + m_FrameCount) % MAX_UPLOAD_RING_FRAME_COUNT;
+	pFrame->FenceValue = fenceValue;
+	pFrame->Size = m_CurFrameSize;
+	++m_FrameCount;
+	m_CurFrameSize = 0;
+}
+
+void UploadRingAllocator::Retire(UINT64 completedFenceValue)
+{
+	while (m_FrameCount > 0)
+	{
+		UploadRingFrame* pFrame = m_pFrames + m_FirstFrame;
+		if (pFrame->FenceValue > completedFenceValue)
+		{
+			break;
+		}
+
+		m_Head = (m_Head + pFrame->Size) % m_Capacity;
+		m_UsedSize -= pFrame->Size;
+
+		m_FirstFrame = (m_FirstFrame + 1) % MAX_UPLOAD_RING_FRAME_COUNT;
+		--m_FrameCount;
+	}
+}
+
+void UploadRingAllocator::Cleanup()
+{
+	m_Capacity = 0;
+	m_Head = 0;
+	m_Tail = 0;
+	m_UsedSize = 0;
+	m_CurFrameSize = 0;
+	m_FirstFrame = 0;
+	m_FrameCount = 0;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+// upload buffer  offset ϴ ring Ҵ. device  ܵ  .
+//    Alloc  FinishFrame fence  ݰ,
+// Retire GPU  fence  տ ȯ.
+
+static const UINT MAX_UPLOAD_RING_FRAME_COUNT = 16;
+
+struct UploadRingFrame
+{
+	UINT64 FenceValue;
+	UINT64 Size; // κ wrap   .
+};
+
+class UploadRingAllocator
+{
+public:
+	UploadRingAllocator() = default;
+	~UploadRingAllocator() { Cleanup(); }
+
+	void Initialize(UINT64 capacity);
+
+	// alignment 2 ŵ.     false.
+	bool Alloc(UINT64 size, UINT64 alignment, UINT64* pOutOffset);
+
+	// ݱ Alloc  fenceValue .
+	void FinishFrame(UINT64 fenceValue);
+	// completedFenceValue Ϸ   ȯ.
+	void Retire(UINT64 completedFenceValue);
+
+	void Cleanup();
+
+	inline UINT64 GetCapacity() { return m_Capacity; }
+	inline UINT64 GetUsedSize() { return m_UsedSize; }
+	inline UINT GetPendingFrameCount() { return m_FrameCount; }
+
+private:
+	UINT64 m_Capacity = 0;
+	UINT64 m_Head = 0; //      .
+	UINT64 m_Tail = 0; //  Ҵ ġ. capacity  0  ǹ.
+	UINT64 m_UsedSize = 0;
+	UINT64 m_CurFrameSize = 0;
+
+	UploadRingFrame m_pFrames[MAX_UPLOAD_RING_FRAME_COUNT] = { };
+	UINT m_FirstFrame = 0;
+	UINT m_FrameCount = 0;
+};
@@ -77,6 +77,10 @@ cbuffer MeshConstants : register(b2)
     float g_HeightScale;
     float g_WindTrunk;
     float g_WindLeaves;
+    float3 g_PositionScale; //  skinned vertex ġ . Position * g_PositionScale + g_PositionBias.
+    float dummy3;
+    float3 g_PositionBias;
+    float dummy4;
 };
 cbuffer MaterialConstants : register(b3)
 {
@@ -105,20 +109,28 @@ StructuredBuffer<matrix> g_BoneTransforms : register(t7);
 //};
 #endif
 
+#ifdef SKINNED
+// PackedSkinnedVertex(Model/VertexPacking.h).
 struct VertexShaderInput
 {
-    float3 ModelPosition : POSITION; // ǥ ġ position
-    float3 ModelNormal : NORMAL; //  ǥ normal    
+    float4 QuantizedPosition : POSITION; // unorm. g_PositionScale, g_PositionBias .
+    float2 OctNormal : NORMAL; // snorm octahedron.
     float2 Texcoord : TEXCOORD;
-    float3 ModelTangent : TANGENT;
-    
-#ifdef SKINNED
-    float4 BoneWeights0 : BLENDWEIGHT0;
+    float2 OctTangent : TANGENT; // snorm octahedron.
+    float4 BoneWeights0 : BLENDWEIGHT0; // ū ,  1.
     float4 BoneWeights1 : BLENDWEIGHT1;
     uint4 BoneIndices0 : BLENDINDICES0;
     uint4 BoneIndices1 : BLENDINDICES1;
-#endif
 };
+#else
+struct VertexShaderInput
+{
+    float3 ModelPosition : POSITION; // ǥ ġ position
+    float3 ModelNormal : NORMAL; //  ǥ normal    
+    float2 Texcoord : TEXCOORD;
+    float3 ModelTangent : TANGENT;
+};
+#endif
 struct PixelShaderInput
 {
     float4 ProjectedPosition : SV_POSITION; // Screen position
@@ -129,4 +141,112 @@ struct PixelShaderInput
     float3 ModelPosition : POSITION1; // Volume casting 
 };
 
+#ifdef SKINNED
+float3 DecodeOctahedron(float2 encoded)
+{
+    float3 direction = float3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+    float t = saturate(-direction.z);
+    direction.xy += (direction.xy >= 0.0f) ? -t : t;
+    return normalize(direction);
+}
+
+float3 DecodeSkinnedPosition(VertexShaderInput input)
+{
+    return input.QuantizedPosition.xyz * g_PositionScale + g_PositionBias;
+}
+
+// Uniform Scaling .
+// (float3x3)boneTransforms ĳ Translation .
+// weight ū  Ǿ Ƿ 0  .
+void SkinVertex(VertexShaderInput input, out float3 modelPos, out float3 modelNormal, out float3 modelTangent)
+{
+    float weights[8] = 
+    {
+        input.BoneWeights0.x,
+        input.BoneWeights0.y,
+        input.BoneWeights0.z,
+        input.BoneWeights0.w,
+        input.BoneWeights1.x,
+        input.BoneWeights1.y,
+        input.BoneWeights1.z,
+        input.BoneWeights1.w,
+    };
+    uint indices[8] = 
+    {
+        input.BoneIndices0.x,
+        input.BoneIndices0.y,
+        input.BoneIndices0.z,
+        input.BoneIndices0.w,
+        input.BoneIndices1.x,
+        input.BoneIndices1.y,
+        input.BoneIndices1.z,
+        input.BoneIndices1.w,
+    };
+
+    float3 position = DecodeSkinnedPosition(input);
+    float3 normal = DecodeOctahedron(input.OctNormal);
+    float3 tangent = DecodeOctahedron(input.OctTangent);
+
+    modelPos = float3(0.0f, 0.0f, 0.0f);
+    modelNormal = float3(0.0f, 0.0f, 0.0f);
+    modelTangent = float3(0.0f, 0.0f, 0.0f);
+
+    [loop]
+    for (int i = 0; i < 8; ++i)
+    {
+        if (weights[i] == 0.0f)
+        {
+            break;
+        }
+        
+        modelPos += weights[i] * mul(float4(position, 1.0f), g_BoneTransforms[indices[i]]).xyz;
+        modelNormal += weights[i] * mul(normal, (float3x3)g_BoneTransforms[indices[i]]);
+        modelTangent += weights[i] * mul(tangent, (float3x3)g_BoneTransforms[indices[i]]);
+    }
+}
+
+// depth pass. position .
+float3 SkinPosition(VertexShaderInput input)
+{
+    float weights[8] = 
+    {
+        input.BoneWeights0.x,
+        input.BoneWeights0.y,
+        input.BoneWeights0.z,
+        input.BoneWeights0.w,
+        input.BoneWeights1.x,
+        input.BoneWeights1.y,
+        input.BoneWeights1.z,
+        input.BoneWeights1.w,
+    };
+    uint indices[8] = 
+    {
+        input.BoneIndices0.x,
+        input.BoneIndices0.y,
+        input.BoneIndices0.z,
+        input.BoneIndices0.w,
+        input.BoneIndices1.x,
+        input.BoneIndices1.y,
+        input.BoneIndices1.z,
+        input.BoneIndices1.w,
+    };
+
+    float3 position = DecodeSkinnedPosition(input);
+    float3 modelPos = float3(0.0f, 0.0f, 0.0f);
+
+    [loop]
+    for (int i = 0; i < 8; ++i)
+    {
+        if (weights[i] == 0.0f)
+        {
+            break;
+        }
+        
+        modelPos += weights[i] * mul(float4(position, 1.0f), g_BoneTransforms[indices[i]]).xyz;
+    }
+
+    return modelPos;
+}
+#endif
+
 #endif
\ No newline at end of file
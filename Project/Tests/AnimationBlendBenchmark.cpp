@@ -0,0 +1,137 @@
+#include "../pch.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// ĳʹ N-way(1, 2, 4, 8 layer) blend ð.
+// 1) BlendPoses/AddPoses(SSE) bone scalar . ¦ layer override, Ȧ layer ü mask  additive.
+// 2) AnimationData::Update ü(base clip + cross-fade + N layer ø blend, local/model ȯ).
+
+static const UINT MAX_LAYER_COUNT = 8;
+
+static void RunPoseBlend(UINT characterCount, UINT layerCount, UINT repeatCount)
+{
+	const UINT64 BONE_COUNT = HUMANOID_BONE_COUNT;
+	UINT seed = 3;
+
+	std::vector<AnimationPose> characters(characterCount);
+	for (AnimationPose& pose : characters)
+	{
+		MakeRandomPose(&pose, BONE_COUNT, &seed);
+	}
+	std::vector<AnimationPose> sources(MAX_LAYER_COUNT + 1);
+	for (AnimationPose& pose : sources)
+	{
+		MakeRandomPose(&pose, BONE_COUNT, &seed);
+	}
+	std::vector<float> upperBodyWeights(BONE_COUNT);
+	for (UINT64 boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		upperBodyWeights[boneID] = (boneID >= BONE_COUNT / 2 ? 1.0f : 0.0f);
+	}
+
+	std::vector<AnimationPose> scalarCharacters = characters;
+
+	TestTimer timer;
+	for (UINT r = 0; r < repeatCount; ++r)
+	{
+		for (AnimationPose& pose : characters)
+		{
+			for (UINT layer = 0; layer < layerCount; ++layer)
+			{
+				if (layer & 1)
+				{
+					AddPoses(&pose, sources[layer], sources[layer + 1], 0.3f, upperBodyWeights.data(), BONE_COUNT);
+				}
+				else
+				{
+					BlendPoses(&pose, sources[layer], 0.5f, nullptr, BONE_COUNT);
+				}
+			}
+		}
+	}
+	const double SIMD_US = timer.GetElapsedMS() * 1000.0 / ((double)repeatCount * characterCount);
+
+	timer.Reset();
+	for (UINT r = 0; r < repeatCount; ++r)
+	{
+		for (AnimationPose& pose : scalarCharacters)
+		{
+			for (UINT layer = 0; layer < layerCount; ++layer)
+			{
+				if (layer & 1)
+				{
+					AddPosesScalar(&pose, sources[layer], sources[layer + 1], 0.3f, upperBodyWeights.data(), BONE_COUNT);
+				}
+				else
+				{
+					BlendPosesScalar(&pose, sources[layer], 0.5f, nullptr, BONE_COUNT);
+				}
+			}
+		}
+	}
+	const double SCALAR_US = timer.GetElapsedMS() * 1000.0 / ((double)repeatCount * characterCount);
+
+	printf("%5u characters  %u layers  SIMD %7.3f us/char  scalar %7.3f us/char  %5.2fx\n",
+		   characterCount, layerCount, SIMD_US, SCALAR_US, SCALAR_US / SIMD_US);
+}
+
+static void RunUpdate(UINT characterCount, UINT layerCount, UINT frameCount)
+{
+	std::vector<AnimationData> characters(characterCount);
+	for (UINT c = 0; c < characterCount; ++c)
+	{
+		AnimationData& character = characters[c];
+		InitHumanoidAnimationData(&character, MAX_LAYER_COUNT + 2, 121, 40 + c % 8);
+		for (UINT layer = 0; layer < layerCount; ++layer)
+		{
+			const UINT LAYER_INDEX = character.AddLayer((int)layer + 2, ((layer & 1) ? AnimationLayerMode_Additive : AnimationLayerMode_Override), 0.4f);
+			if (layer & 1)
+			{
+				// spine Ʒ(ü).
+				character.SetLayerBoneMask(LAYER_INDEX, 1, 1.0f);
+			}
+		}
+	}
+
+	AnimationLODState lod = { };
+	lod.UpdateInterval = 1;
+	lod.bEvaluate = true;
+
+	TestTimer timer;
+	for (UINT frame = 0; frame < frameCount; ++frame)
+	{
+		// 0.5ʸ clip 0, 1  cross-fade   ̵.
+		const int CLIP_ID = (int)((frame / 30) & 1);
+		for (AnimationData& character : characters)
+		{
+			character.SetLOD(lod);
+			character.Update(CLIP_ID, (int)frame, 1.0f / 60.0f);
+		}
+	}
+	const double FRAME_MS = timer.GetElapsedMS() / frameCount;
+
+	printf("%5u characters  %u layers  Update %8.3f ms/frame  %7.3f us/char\n",
+		   characterCount, layerCount, FRAME_MS, FRAME_MS * 1000.0 / characterCount);
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT CHARACTER_COUNT = (bSmoke ? 10 : 1000);
+	const UINT REPEAT_COUNT = (bSmoke ? 1 : 20);
+	const UINT FRAME_COUNT = (bSmoke ? 2 : 60);
+
+	printf("%u bones per character\n", HUMANOID_BONE_COUNT);
+	const UINT pLayerCounts[] = { 1, 2, 4, MAX_LAYER_COUNT };
+	for (UINT layerCount : pLayerCounts)
+	{
+		RunPoseBlend(CHARACTER_COUNT, layerCount, REPEAT_COUNT);
+	}
+	for (UINT layerCount : { 0u, 1u, 2u, 4u, MAX_LAYER_COUNT })
+	{
+		RunUpdate(CHARACTER_COUNT / 10, layerCount, FRAME_COUNT);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
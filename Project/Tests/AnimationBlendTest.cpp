@@ -0,0 +1,134 @@
+#include "../pch.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// BlendPoses/AddPoses(SSE, 4 bone) bone scalar  .
+// bone  4  ƴ   lane, mask 0 bone , weight 0/1 踦 .
+
+static const float POSE_EPSILON = 2e-6f;
+
+static float RotationError(const Quaternion& A, const Quaternion& B)
+{
+	// q -q  ȸ.
+	return 1.0f - fabsf(A.Dot(B));
+}
+
+static float VectorError(const Vector3& A, const Vector3& B)
+{
+	return fmaxf(fabsf(A.x - B.x), fmaxf(fabsf(A.y - B.y), fabsf(A.z - B.z)));
+}
+
+static int ComparePoses(const AnimationPose& EXPECTED, const AnimationPose& ACTUAL, UINT64 boneCount)
+{
+	for (UINT64 boneID = 0; boneID < boneCount; ++boneID)
+	{
+		TEST_CHECK(VectorError(EXPECTED.Positions[boneID], ACTUAL.Positions[boneID]) <= POSE_EPSILON);
+		TEST_CHECK(VectorError(EXPECTED.Scales[boneID], ACTUAL.Scales[boneID]) <= POSE_EPSILON);
+		TEST_CHECK(RotationError(EXPECTED.Rotations[boneID], ACTUAL.Rotations[boneID]) <= POSE_EPSILON);
+	}
+	return 0;
+}
+
+static int TestMatchesScalar()
+{
+	UINT seed = 5;
+	const UINT64 pBoneCounts[] = { 1, 2, 3, 4, 5, 7, 8, 61, HUMANOID_BONE_COUNT };
+	for (UINT64 boneCount : pBoneCounts)
+	{
+		for (UINT trial = 0; trial < 50; ++trial)
+		{
+			AnimationPose base;
+			AnimationPose src;
+			AnimationPose reference;
+			MakeRandomPose(&base, boneCount, &seed);
+			MakeRandomPose(&src, boneCount, &seed);
+			MakeRandomPose(&reference, boneCount, &seed);
+
+			//  0. 4  ü 0  ⵵  .
+			std::vector<float> boneWeights(boneCount);
+			for (UINT64 boneID = 0; boneID < boneCount; ++boneID)
+			{
+				boneWeights[boneID] = ((boneID / 4 + trial) % 2 == 0 ? 0.0f : NextAnimationRandomFloat(&seed, 0.0f, 1.0f));
+			}
+			const float WEIGHT = NextAnimationRandomFloat(&seed, 0.05f, 1.0f);
+			const float* pBoneWeights = (trial % 3 == 0 ? nullptr : boneWeights.data());
+
+			AnimationPose expected = base;
+			AnimationPose actual = base;
+			BlendPosesScalar(&expected, src, WEIGHT, pBoneWeights, boneCount);
+			BlendPoses(&actual, src, WEIGHT, pBoneWeights, boneCount);
+			if (ComparePoses(expected, actual, boneCount))
+			{
+				fprintf(stderr, "BlendPoses, %llu bones, trial %u\n", boneCount, trial);
+				return 1;
+			}
+
+			expected = base;
+			actual = base;
+			AddPosesScalar(&expected, src, reference, WEIGHT, pBoneWeights, boneCount);
+			AddPoses(&actual, src, reference, WEIGHT, pBoneWeights, boneCount);
+			if (ComparePoses(expected, actual, boneCount))
+			{
+				fprintf(stderr, "AddPoses, %llu bones, trial %u\n", boneCount, trial);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+static int TestWeightBounds()
+{
+	UINT seed = 11;
+	const UINT64 BONE_COUNT = 13;
+	AnimationPose base;
+	AnimationPose src;
+	MakeRandomPose(&base, BONE_COUNT, &seed);
+	MakeRandomPose(&src, BONE_COUNT, &seed);
+
+	// weight 0 ƹ͵ ٲ .
+	AnimationPose pose = base;
+	BlendPoses(&pose, src, 0.0f, nullptr, BONE_COUNT);
+	AddPoses(&pose, src, base, 0.0f, nullptr, BONE_COUNT);
+	TEST_CHECK(pose.Positions == base.Positions);
+	TEST_CHECK(memcmp(pose.Rotations.data(), base.Rotations.data(), sizeof(Quaternion) * BONE_COUNT) == 0);
+
+	// mask  0̾ .
+	std::vector<float> zeroWeights(BONE_COUNT, 0.0f);
+	BlendPoses(&pose, src, 1.0f, zeroWeights.data(), BONE_COUNT);
+	TEST_CHECK(memcmp(pose.Rotations.data(), base.Rotations.data(), sizeof(Quaternion) * BONE_COUNT) == 0);
+
+	// weight 1 override src.
+	BlendPoses(&pose, src, 1.0f, nullptr, BONE_COUNT);
+	if (ComparePoses(src, pose, BONE_COUNT))
+	{
+		return 1;
+	}
+
+	//  pose weight 1 ϸ src, ڱ ڽ  ϸ ״.
+	pose = base;
+	AddPoses(&pose, src, base, 1.0f, nullptr, BONE_COUNT);
+	if (ComparePoses(src, pose, BONE_COUNT))
+	{
+		return 1;
+	}
+	pose = base;
+	AddPoses(&pose, src, src, 0.7f, nullptr, BONE_COUNT);
+	if (ComparePoses(base, pose, BONE_COUNT))
+	{
+		return 1;
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestMatchesScalar() || TestWeightBounds())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("AnimationBlendTest passed\n");
+	return 0;
+}
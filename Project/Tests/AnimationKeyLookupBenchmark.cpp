@@ -0,0 +1,168 @@
+#include "../pch.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// ĳ 100 x bone 65 x key 1000 clip AnimationData::findIndex
+//   Ž(Ź key 0) frame ð . /ұ , / seek.
+// key ʹ  clip   ĳ͸ KeyTracks(cursor)  .
+// δ ĳ͸ clip ϹǷ cache Ȳ ̺ .
+
+static const UINT CHARACTER_COUNT = 100;
+static const UINT BONE_COUNT = 65;
+static const UINT KEY_COUNT = 1000;
+
+class BenchmarkAnimationData : public AnimationData
+{
+public:
+	using AnimationData::findIndex;
+};
+
+//   AnimationData::findIndex.
+static UINT FindIndexLinear(const std::vector<AnimationClip::Key>& KEYS, const float ANIMATION_TIME_TICK)
+{
+	for (UINT64 i = 0, end = KEYS.size() - 1; i < end; ++i)
+	{
+		if (ANIMATION_TIME_TICK < (float)KEYS[i + 1].Time)
+		{
+			return (UINT)i;
+		}
+	}
+	return 0;
+}
+
+struct LookupResult
+{
+	double LinearMS;
+	double LookupMS;
+	double InterpolateMS;
+	UINT64 MismatchCount;
+};
+
+// bSeek̸  frame  ð. ƴϸ 60Hz ϴ  ó.
+static LookupResult RunCase(bool bUniform, bool bSeek, UINT frameCount)
+{
+	BenchmarkAnimationData animationData;
+	animationData.Clips.resize(1);
+	AnimationClip* pClip = &animationData.Clips[0];
+	MakeRandomClip(pClip, BONE_COUNT, KEY_COUNT, bUniform, 2024);
+	pClip->InitKeyTracks();
+
+	const float LAST_KEY_TIME = (float)pClip->Keys[0][KEY_COUNT - 1].Time;
+	const float DELTA_TICK = (float)pClip->TicksPerSec / 60.0f;
+
+	std::vector<std::vector<AnimationClip::KeyTrack>> characterTracks(CHARACTER_COUNT, pClip->KeyTracks);
+	std::vector<float> startTimes(CHARACTER_COUNT);
+	UINT seed = 5;
+	for (UINT c = 0; c < CHARACTER_COUNT; ++c)
+	{
+		startTimes[c] = NextAnimationRandomFloat(&seed, 0.0f, LAST_KEY_TIME);
+	}
+
+	// frame f ĳ c ð.    ð   seed .
+	std::vector<float> times((size_t)frameCount * CHARACTER_COUNT);
+	for (UINT f = 0; f < frameCount; ++f)
+	{
+		for (UINT c = 0; c < CHARACTER_COUNT; ++c)
+		{
+			float time = (bSeek ? NextAnimationRandomFloat(&seed, 0.0f, LAST_KEY_TIME) : fmodf(startTimes[c] + DELTA_TICK * (float)f, LAST_KEY_TIME));
+			times[(size_t)f * CHARACTER_COUNT + c] = time;
+		}
+	}
+
+	LookupResult result = {};
+	volatile UINT sink = 0;
+
+	TestTimer timer;
+	for (UINT f = 0; f < frameCount; ++f)
+	{
+		for (UINT c = 0; c < CHARACTER_COUNT; ++c)
+		{
+			const float TIME = times[(size_t)f * CHARACTER_COUNT + c];
+			for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+			{
+				sink += FindIndexLinear(pClip->Keys[boneID], TIME);
+			}
+		}
+	}
+	result.LinearMS = timer.GetElapsedMS() / frameCount;
+
+	timer.Reset();
+	for (UINT f = 0; f < frameCount; ++f)
+	{
+		for (UINT c = 0; c < CHARACTER_COUNT; ++c)
+		{
+			const float TIME = times[(size_t)f * CHARACTER_COUNT + c];
+			pClip->KeyTracks.swap(characterTracks[c]);
+			for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+			{
+				sink += animationData.findIndex(pClip, (int)boneID, TIME);
+			}
+			pClip->KeyTracks.swap(characterTracks[c]);
+		}
+	}
+	result.LookupMS = timer.GetElapsedMS() / frameCount;
+
+	Vector3 position;
+	Quaternion rotation;
+	Vector3 scale;
+	timer.Reset();
+	for (UINT f = 0; f < frameCount; ++f)
+	{
+		for (UINT c = 0; c < CHARACTER_COUNT; ++c)
+		{
+			const float TIME = times[(size_t)f * CHARACTER_COUNT + c];
+			pClip->KeyTracks.swap(characterTracks[c]);
+			for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+			{
+				animationData.InterpolateKeyData(&position, &rotation, &scale, pClip, (int)boneID, TIME);
+			}
+			pClip->KeyTracks.swap(characterTracks[c]);
+		}
+	}
+	result.InterpolateMS = timer.GetElapsedMS() / frameCount;
+	sink += (UINT)position.x;
+
+	//  key    Ž  index .  keyʹ   0 ִ  ģ κ.
+	for (UINT f = 0; f < frameCount; ++f)
+	{
+		for (UINT c = 0; c < CHARACTER_COUNT; ++c)
+		{
+			const float TIME = times[(size_t)f * CHARACTER_COUNT + c];
+			if (TIME >= LAST_KEY_TIME)
+			{
+				continue;
+			}
+			pClip->KeyTracks.swap(characterTracks[c]);
+			for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+			{
+				if (animationData.findIndex(pClip, (int)boneID, TIME) != FindIndexLinear(pClip->Keys[boneID], TIME))
+				{
+					++result.MismatchCount;
+				}
+			}
+			pClip->KeyTracks.swap(characterTracks[c]);
+		}
+	}
+
+	return result;
+}
+
+int main(int argc, char** argv)
+{
+	const UINT FRAME_COUNT = (IsSmokeRun(argc, argv) ? 3 : 300);
+
+	printf("%u characters x %u bones x %u keys, per frame\n", CHARACTER_COUNT, BONE_COUNT, KEY_COUNT);
+	for (UINT i = 0; i < 4; ++i)
+	{
+		const bool bUniform = (i < 2);
+		const bool bSeek = (i % 2 == 1);
+		LookupResult result = RunCase(bUniform, bSeek, FRAME_COUNT);
+		printf("%-11s %-8s linear %8.3f ms  findIndex %7.3f ms  %6.1fx  |  InterpolateKeyData %7.3f ms\n",
+			   (bUniform ? "uniform" : "non-uniform"), (bSeek ? "seek" : "playback"),
+			   result.LinearMS, result.LookupMS, result.LinearMS / result.LookupMS, result.InterpolateMS);
+		TEST_CHECK(result.MismatchCount == 0);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,119 @@
+#include "../pch.h"
+#include "../Model/AnimationLOD.h"
+#include "../Model/Skeleton.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// ī޶ ֺ 40m  humanoid  App::Updateó BeginFrame -> SelectLOD -> SetLOD + Update -> AddCharacterStats .
+// LOD (  frame,  sample)  Ͱ frame ð, sample bone , ǳʶ IK  .
+
+static const UINT CLIP_KEY_COUNT = 121;
+static const float CROWD_HALF_EXTENT = 40.0f;
+
+struct CrowdFrameStats
+{
+	double FrameMS;
+	double EvaluatedBoneCount;
+	double SkippedIKCount;
+	AnimationLODStats LastFrame;
+};
+
+static void InitCrowd(std::vector<AnimationData>* pCharacters, UINT characterCount)
+{
+	pCharacters->resize(characterCount);
+	UINT seed = 3;
+	for (UINT c = 0; c < characterCount; ++c)
+	{
+		AnimationData& character = (*pCharacters)[c];
+		InitHumanoidAnimationData(&character, 1, CLIP_KEY_COUNT, 17 + c % 8);
+		character.TimeSinceLoaded = (double)(c % 97) * 0.037;
+		character.Position = Vector3(NextAnimationRandomFloat(&seed, -CROWD_HALF_EXTENT, CROWD_HALF_EXTENT), 0.0f, NextAnimationRandomFloat(&seed, -CROWD_HALF_EXTENT, CROWD_HALF_EXTENT));
+
+		// AssetLoadStageó skeleton LOD mask .
+		Skeleton skeleton;
+		skeleton.Initialize(character);
+		BuildAnimationLODMask(skeleton, 0.1f, &character.LODBoneIDs);
+	}
+}
+
+static CrowdFrameStats RunCrowd(UINT characterCount, bool bUseLOD, UINT frameCount)
+{
+	const UINT WARMUP_FRAME_COUNT = 4;
+
+	std::vector<AnimationData> characters;
+	InitCrowd(&characters, characterCount);
+	std::vector<AnimationLODState> states(characterCount, AnimationLODState{});
+
+	AnimationLODManager manager;
+	manager.Initialize(AnimationLODSettings());
+
+	CrowdFrameStats result = {};
+	for (UINT frame = 0; frame < WARMUP_FRAME_COUNT + frameCount; ++frame)
+	{
+		manager.BeginFrame();
+		for (UINT i = 0; i < characterCount; ++i)
+		{
+			if (bUseLOD)
+			{
+				manager.SelectLOD(Vector3(0.0f), characters[i].Position, i, &states[i]);
+			}
+			else
+			{
+				states[i] = { AnimationLODLevel_Full, 1, true, true, false };
+			}
+			characters[i].SetLOD(states[i]);
+		}
+
+		TestTimer timer;
+		for (UINT i = 0; i < characterCount; ++i)
+		{
+			characters[i].Update(0, (int)frame, 1.0f / 60.0f);
+		}
+		const double ELAPSED_MS = timer.GetElapsedMS();
+
+		for (UINT i = 0; i < characterCount; ++i)
+		{
+			manager.AddCharacterStats(states[i], characters[i].GetEvaluatedBoneCount(), !states[i].bSolveIK);
+		}
+
+		if (frame >= WARMUP_FRAME_COUNT)
+		{
+			const AnimationLODStats& STATS = manager.GetFrameStats();
+			result.FrameMS += ELAPSED_MS;
+			result.EvaluatedBoneCount += STATS.EvaluatedBoneCount;
+			result.SkippedIKCount += STATS.SkippedIKCount;
+			result.LastFrame = STATS;
+		}
+	}
+	result.FrameMS /= frameCount;
+	result.EvaluatedBoneCount /= frameCount;
+	result.SkippedIKCount /= frameCount;
+	return result;
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT FRAME_COUNT = (bSmoke ? 8 : 240);
+
+	printf("characters  mode  ms/frame  bones/frame  IK skipped/frame  sampled chars  full/half/quarter\n");
+	const UINT pCharacterCounts[] = { 100, 1000 };
+	for (UINT characterCount : pCharacterCounts)
+	{
+		if (bSmoke && characterCount > 100)
+		{
+			continue;
+		}
+
+		for (UINT mode = 0; mode < 2; ++mode)
+		{
+			const CrowdFrameStats STATS = RunCrowd(characterCount, mode == 1, FRAME_COUNT);
+			printf("%10u  %-4s  %8.3f  %11.0f  %16.0f  %13u  %u/%u/%u\n", characterCount, (mode == 1 ? "LOD" : "full"),
+				   STATS.FrameMS, STATS.EvaluatedBoneCount, STATS.SkippedIKCount, STATS.LastFrame.EvaluatedCharacterCount,
+				   STATS.LastFrame.pLevelCounts[0], STATS.LastFrame.pLevelCounts[1], STATS.LastFrame.pLevelCounts[2]);
+		}
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,263 @@
+#include "../pch.h"
+#include "../Model/AnimationLOD.h"
+#include "../Model/Skeleton.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// AnimationLODManager ܰ ð AnimationData LOD  Ȯ.
+// - mask: θ ׻ , , հ  , ȴٸ .
+// - ܰ: Ÿ , hysteresis, sample frame л.
+// - : 2/4 frame sampleص  frame sample  ġ ũ ٸ ʰ frame ̿ Ƣ .
+
+static const UINT CLIP_KEY_COUNT = 61;
+static const float FRAME_TIME = 1.0f / 60.0f;
+
+static int TestLODMask()
+{
+	AnimationData animData;
+	InitHumanoidAnimationData(&animData, 1, 2, 1);
+	Skeleton skeleton;
+	skeleton.Initialize(animData);
+
+	std::vector<UINT> boneIDs;
+	BuildAnimationLODMask(skeleton, 0.1f, &boneIDs);
+	TEST_CHECK(!boneIDs.empty() && boneIDs.size() < HUMANOID_BONE_COUNT);
+	TEST_CHECK(boneIDs[0] == 0);
+
+	std::vector<BYTE> bInMask(skeleton.GetBoneCount(), 0);
+	for (UINT64 i = 0; i < boneIDs.size(); ++i)
+	{
+		TEST_CHECK(i == 0 || boneIDs[i] > boneIDs[i - 1]);
+		const int PARENT_ID = skeleton.BoneParents[boneIDs[i]];
+		TEST_CHECK(PARENT_ID < 0 || bInMask[PARENT_ID]);
+		bInMask[boneIDs[i]] = 1;
+	}
+
+	const char* ppKEPT[] = { "Hips", "Spine2", "Head", "LeftForeArm", "RightHand", "LeftFoot", "RightLeg" };
+	for (const char* pNAME : ppKEPT)
+	{
+		TEST_CHECK(bInMask[skeleton.FindBone(pNAME)]);
+	}
+	const char* ppDROPPED[] = { "LeftHandIndex1", "RightHandThumb4", "LeftHandPinky2" };
+	for (const char* pNAME : ppDROPPED)
+	{
+		TEST_CHECK(!bInMask[skeleton.FindBone(pNAME)]);
+	}
+
+	//  0̸ , 1  root.
+	BuildAnimationLODMask(skeleton, 0.0f, &boneIDs);
+	TEST_CHECK(boneIDs.size() == HUMANOID_BONE_COUNT);
+	BuildAnimationLODMask(skeleton, 1.1f, &boneIDs);
+	TEST_CHECK(boneIDs.size() == 1 && boneIDs[0] == 0);
+	return 0;
+}
+
+// ־  迡 ٷ,   Hysteresisŭ  ; ܰ谡 .
+static int TestLevelSelection()
+{
+	AnimationLODManager manager;
+	manager.Initialize(AnimationLODSettings());
+
+	struct LevelCase
+	{
+		float Distance;
+		UINT Level;
+		bool bSolveIK;
+		bool bUseBoneMask;
+	};
+	const LevelCase pCASES[] = {
+		{ 5.0f, AnimationLODLevel_Full, true, false },
+		{ 7.9f, AnimationLODLevel_Full, false, false },
+		{ 8.0f, AnimationLODLevel_Half, false, false },
+		{ 7.5f, AnimationLODLevel_Half, false, false },	   // hysteresis .
+		{ 6.9f, AnimationLODLevel_Full, false, false },
+		{ 19.0f, AnimationLODLevel_Half, false, true },
+		{ 20.5f, AnimationLODLevel_Quarter, false, true },
+		{ 19.5f, AnimationLODLevel_Quarter, false, true },
+		{ 18.9f, AnimationLODLevel_Half, false, true },
+		{ 3.0f, AnimationLODLevel_Full, true, false },	   //  frame  ܰ赵 .
+		{ 100.0f, AnimationLODLevel_Quarter, false, true },
+	};
+
+	AnimationLODState state = {};
+	for (const LevelCase& CASE : pCASES)
+	{
+		manager.BeginFrame();
+		manager.SelectLOD(Vector3(1.0f, 2.0f, 3.0f), Vector3(1.0f + CASE.Distance, 2.0f, 3.0f), 0, &state);
+		TEST_CHECK(state.Level == CASE.Level);
+		TEST_CHECK(state.UpdateInterval == (1u << CASE.Level));
+		TEST_CHECK(state.bSolveIK == CASE.bSolveIK);
+		TEST_CHECK(state.bUseBoneMask == CASE.bUseBoneMask);
+	}
+
+	// ʱȭ  ܰ  ϰ.
+	state.Level = 0xFFFFFFFF;
+	manager.SelectLOD(Vector3(0.0f), Vector3(10.0f, 0.0f, 0.0f), 0, &state);
+	TEST_CHECK(state.Level == AnimationLODLevel_Half);
+	return 0;
+}
+
+//  ܰ ĳ͵ sample frame  ,  interval Ȯ  .
+static int TestEvaluateStagger()
+{
+	const UINT CHARACTER_COUNT = 1000;
+	AnimationLODManager manager;
+	manager.Initialize(AnimationLODSettings());
+
+	const float pDISTANCES[] = { 10.0f, 30.0f };
+	for (float distance : pDISTANCES)
+	{
+		std::vector<AnimationLODState> states(CHARACTER_COUNT, AnimationLODState{});
+		std::vector<UINT> lastEvaluatedFrames(CHARACTER_COUNT, 0xFFFFFFFF);
+		for (UINT frame = 0; frame < 16; ++frame)
+		{
+			manager.BeginFrame();
+			UINT evaluatedCount = 0;
+			for (UINT i = 0; i < CHARACTER_COUNT; ++i)
+			{
+				manager.SelectLOD(Vector3(0.0f), Vector3(0.0f, 0.0f, distance), i, &states[i]);
+				if (!states[i].bEvaluate)
+				{
+					continue;
+				}
+				++evaluatedCount;
+				TEST_CHECK(lastEvaluatedFrames[i] == 0xFFFFFFFF || frame - lastEvaluatedFrames[i] == states[i].UpdateInterval);
+				lastEvaluatedFrames[i] = frame;
+			}
+			TEST_CHECK(evaluatedCount == CHARACTER_COUNT / states[0].UpdateInterval);
+		}
+	}
+	return 0;
+}
+
+static int TestFrameStats()
+{
+	AnimationLODManager manager;
+	manager.Initialize(AnimationLODSettings());
+	manager.BeginFrame();
+
+	AnimationLODState state = {};
+	state.Level = AnimationLODLevel_Half;
+	manager.AddCharacterStats(state, 0, true);
+	manager.AddCharacterStats(state, 40, true);
+	state.Level = AnimationLODLevel_Full;
+	manager.AddCharacterStats(state, 65, false);
+
+	const AnimationLODStats& STATS = manager.GetFrameStats();
+	TEST_CHECK(STATS.CharacterCount == 3);
+	TEST_CHECK(STATS.EvaluatedCharacterCount == 2);
+	TEST_CHECK(STATS.EvaluatedBoneCount == 105);
+	TEST_CHECK(STATS.SkippedIKCount == 2);
+	TEST_CHECK(STATS.pLevelCounts[0] == 1 && STATS.pLevelCounts[1] == 2 && STATS.pLevelCounts[2] == 0);
+
+	manager.BeginFrame();
+	TEST_CHECK(manager.GetFrameStats().CharacterCount == 0 && manager.GetFrameStats().EvaluatedBoneCount == 0);
+	return 0;
+}
+
+static float GetMaxJointDistance(const std::vector<Matrix>& A, const std::vector<Matrix>& B)
+{
+	float maxDistance = 0.0f;
+	for (UINT64 i = 0, size = A.size(); i < size; ++i)
+	{
+		maxDistance = fmaxf(maxDistance, (A[i].Translation() - B[i].Translation()).Length());
+	}
+	return maxDistance;
+}
+
+// interval sample ĳ͸  frame sample ĳͿ  .  ġ ̴ cm.
+static int TestInterpolation()
+{
+	const UINT pINTERVALS[] = { 2, 4 };
+	for (UINT interval : pINTERVALS)
+	{
+		AnimationData reference;
+		AnimationData character;
+		InitHumanoidAnimationData(&reference, 1, CLIP_KEY_COUNT, 5);
+		InitHumanoidAnimationData(&character, 1, CLIP_KEY_COUNT, 5);
+
+		AnimationLODState fullLOD = {};
+		fullLOD.UpdateInterval = 1;
+		fullLOD.bEvaluate = true;
+		reference.SetLOD(fullLOD);
+
+		float maxError = 0.0f;
+		float maxReferenceStep = 0.0f;
+		float maxStep = 0.0f;
+		std::vector<Matrix> prevReference;
+		std::vector<Matrix> prevTransforms;
+		for (UINT frame = 0; frame < 600; ++frame)
+		{
+			AnimationLODState lod = {};
+			lod.Level = (interval == 2 ? AnimationLODLevel_Half : AnimationLODLevel_Quarter);
+			lod.UpdateInterval = interval;
+			lod.bEvaluate = (frame % interval == 0);
+			character.SetLOD(lod);
+
+			reference.Update(0, (int)frame, FRAME_TIME);
+			character.Update(0, (int)frame, FRAME_TIME);
+			TEST_CHECK(reference.GetEvaluatedBoneCount() == HUMANOID_BONE_COUNT);
+			TEST_CHECK(character.GetEvaluatedBoneCount() == (lod.bEvaluate ? HUMANOID_BONE_COUNT : 0));
+
+			maxError = fmaxf(maxError, GetMaxJointDistance(reference.BoneTransforms, character.BoneTransforms));
+			if (frame > 0)
+			{
+				maxReferenceStep = fmaxf(maxReferenceStep, GetMaxJointDistance(prevReference, reference.BoneTransforms));
+				maxStep = fmaxf(maxStep, GetMaxJointDistance(prevTransforms, character.BoneTransforms));
+			}
+			prevReference = reference.BoneTransforms;
+			prevTransforms = character.BoneTransforms;
+		}
+
+		//  pose sample ʰ 󰡹Ƿ ̴ frame  ŭ  .
+		TEST_CHECK(maxError <= maxReferenceStep * (float)interval);
+		//  frame   frame sample  ũ  .
+		TEST_CHECK(maxStep <= maxReferenceStep * 1.5f);
+	}
+	return 0;
+}
+
+// bone mask Ѹ mask bone sample. mask bone   sample Ͱ .
+static int TestBoneMask()
+{
+	AnimationData reference;
+	AnimationData character;
+	InitHumanoidAnimationData(&reference, 1, CLIP_KEY_COUNT, 9);
+	InitHumanoidAnimationData(&character, 1, CLIP_KEY_COUNT, 9);
+	Skeleton skeleton;
+	skeleton.Initialize(character);
+	BuildAnimationLODMask(skeleton, 0.1f, &character.LODBoneIDs);
+
+	AnimationLODState lod = {};
+	lod.UpdateInterval = 1;
+	lod.bEvaluate = true;
+	reference.SetLOD(lod);
+	lod.bUseBoneMask = true;
+	character.SetLOD(lod);
+
+	for (UINT frame = 0; frame < 120; ++frame)
+	{
+		reference.Update(0, (int)frame, FRAME_TIME);
+		character.Update(0, (int)frame, FRAME_TIME);
+
+		// ó   mask  bone ä ϹǷ .
+		TEST_CHECK(character.GetEvaluatedBoneCount() == (frame == 0 ? HUMANOID_BONE_COUNT : (UINT)character.LODBoneIDs.size()));
+		for (UINT boneID : character.LODBoneIDs)
+		{
+			TEST_CHECK((reference.BoneTransforms[boneID].Translation() - character.BoneTransforms[boneID].Translation()).Length() <= 1e-3f);
+		}
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestLODMask() || TestLevelSelection() || TestEvaluateStagger() || TestFrameStats() || TestInterpolation() || TestBoneMask())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("AnimationLODTest passed\n");
+	return 0;
+}
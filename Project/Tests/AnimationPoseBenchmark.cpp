@@ -0,0 +1,78 @@
+#include "../pch.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// pose -> bone palette ð. SSE(buildLocalTransforms + buildModelTransforms + WriteSkinningMatrices)
+// ó bone SimpleMath  ϰ Get(...).Transpose()  .
+// ĳ 1(cache  ) Ͱ  ٸ 1000.
+
+class PoseBenchmarkAnimationData : public AnimationData
+{
+public:
+	using AnimationData::buildLocalTransforms;
+	using AnimationData::buildModelTransforms;
+	using AnimationData::m_Pose;
+};
+
+static void RunCharacters(UINT characterCount, UINT repeatCount)
+{
+	std::vector<PoseBenchmarkAnimationData> characters(characterCount);
+	UINT seed = 9;
+	for (PoseBenchmarkAnimationData& character : characters)
+	{
+		InitHumanoidAnimationData(&character, 1, 2, seed);
+		character.m_Pose.Resize(HUMANOID_BONE_COUNT);
+		for (UINT boneID = 0; boneID < HUMANOID_BONE_COUNT; ++boneID)
+		{
+			character.m_Pose.Positions[boneID] = character.Clips[0].Keys[boneID][0].Position;
+			character.m_Pose.Rotations[boneID] = MakeRandomRotation(&seed, 1.0f);
+		}
+	}
+
+	Matrix* pPalettes = (Matrix*)_aligned_malloc(sizeof(Matrix) * HUMANOID_BONE_COUNT * characterCount, 16);
+	std::vector<Matrix> scalarTransforms;
+
+	TestTimer timer;
+	for (UINT r = 0; r < repeatCount; ++r)
+	{
+		for (UINT c = 0; c < characterCount; ++c)
+		{
+			PoseBenchmarkAnimationData& character = characters[c];
+			character.buildLocalTransforms();
+			character.buildModelTransforms();
+			character.WriteSkinningMatrices(pPalettes + (UINT64)c * HUMANOID_BONE_COUNT);
+		}
+	}
+	const double SIMD_MS = timer.GetElapsedMS() / repeatCount;
+
+	timer.Reset();
+	for (UINT r = 0; r < repeatCount; ++r)
+	{
+		for (UINT c = 0; c < characterCount; ++c)
+		{
+			PoseBenchmarkAnimationData& character = characters[c];
+			BuildModelTransformsScalar(character.m_Pose, character.BoneParents, &character.BoneTransforms);
+			Matrix* pPalette = pPalettes + (UINT64)c * HUMANOID_BONE_COUNT;
+			for (UINT boneID = 0; boneID < HUMANOID_BONE_COUNT; ++boneID)
+			{
+				pPalette[boneID] = character.Get(0, 0, (int)boneID).Transpose();
+			}
+		}
+	}
+	const double SCALAR_MS = timer.GetElapsedMS() / repeatCount;
+	_aligned_free(pPalettes);
+
+	printf("%5u characters x %u bones  scalar %8.3f ms  SSE %8.3f ms  (%.1fx)  |  per character %6.2f us -> %5.2f us\n",
+		   characterCount, HUMANOID_BONE_COUNT, SCALAR_MS, SIMD_MS, SCALAR_MS / SIMD_MS,
+		   SCALAR_MS * 1000.0 / characterCount, SIMD_MS * 1000.0 / characterCount);
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	RunCharacters(1, (bSmoke ? 1 : 20000));
+	RunCharacters((bSmoke ? 10 : 1000), (bSmoke ? 1 : 50));
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,122 @@
+#include "../pch.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// AnimationData::buildLocalTransforms / buildModelTransforms(SSE) WriteSkinningMatrices
+// bone SimpleMath  ϴ  ο .
+
+class PoseTestAnimationData : public AnimationData
+{
+public:
+	using AnimationData::buildLocalTransforms;
+	using AnimationData::buildModelTransforms;
+	using AnimationData::m_Pose;
+};
+
+//   ϸ SSE  scalar  ulp . Ŀ  ū (ּ 1) .
+static const float RELATIVE_TOLERANCE = 6e-8f;
+
+static float GetMaxRelativeDifference(const Matrix& A, const Matrix& REFERENCE)
+{
+	float maxMagnitude = 1.0f;
+	for (UINT i = 0; i < 16; ++i)
+	{
+		maxMagnitude = fmaxf(maxMagnitude, fabsf((&REFERENCE._11)[i]));
+	}
+	float maxDifference = 0.0f;
+	for (UINT i = 0; i < 16; ++i)
+	{
+		maxDifference = fmaxf(maxDifference, fabsf((&A._11)[i] - (&REFERENCE._11)[i]));
+	}
+	return maxDifference / maxMagnitude;
+}
+
+//  TRS( scale ) ְ  ܰ踸 . 4   ʴ bone  Ȯ.
+static int TestBuildTransforms()
+{
+	PoseTestAnimationData animationData;
+	InitHumanoidAnimationData(&animationData, 1, 30, 1);
+
+	const UINT pBoneCounts[] = { HUMANOID_BONE_COUNT, 1, 2, 3, 5 };
+	UINT seed = 77;
+	for (UINT boneCount : pBoneCounts)
+	{
+		animationData.BoneParents.resize(boneCount);
+		animationData.BoneTransforms.resize(boneCount);
+		animationData.m_Pose.Resize(boneCount);
+
+		for (UINT trial = 0; trial < 200; ++trial)
+		{
+			for (UINT boneID = 0; boneID < boneCount; ++boneID)
+			{
+				animationData.m_Pose.Positions[boneID] = Vector3(NextAnimationRandomFloat(&seed, -50.0f, 50.0f), NextAnimationRandomFloat(&seed, -50.0f, 50.0f), NextAnimationRandomFloat(&seed, -50.0f, 50.0f));
+				animationData.m_Pose.Rotations[boneID] = MakeRandomRotation(&seed, DirectX::XM_PI);
+				animationData.m_Pose.Scales[boneID] = Vector3(NextAnimationRandomFloat(&seed, 0.5f, 2.0f), NextAnimationRandomFloat(&seed, 0.5f, 2.0f), NextAnimationRandomFloat(&seed, 0.5f, 2.0f));
+			}
+			animationData.buildLocalTransforms();
+			animationData.buildModelTransforms();
+
+			std::vector<Matrix> reference;
+			BuildModelTransformsScalar(animationData.m_Pose, animationData.BoneParents, &reference);
+			for (UINT boneID = 0; boneID < boneCount; ++boneID)
+			{
+				TEST_CHECK(GetMaxRelativeDifference(animationData.BoneTransforms[boneID], reference[boneID]) <= RELATIVE_TOLERANCE);
+			}
+		}
+	}
+	return 0;
+}
+
+// Update ü   palette .    scalar ʹ RELATIVE_TOLERANCE .
+// Get() prefix, suffix ̸  ʰ ʺ ϹǷ  1 ó 2 ulp .
+static int TestSkinningPalette()
+{
+	const float GET_TOLERANCE = 2.5e-7f;
+
+	PoseTestAnimationData animationData;
+	InitHumanoidAnimationData(&animationData, 1, 121, 5);
+	const UINT BONE_COUNT = (UINT)animationData.BoneTransforms.size();
+
+	Matrix* pPalette = (Matrix*)_aligned_malloc(sizeof(Matrix) * BONE_COUNT, 16);
+	const Matrix SUFFIX = animationData.InverseOffsetMatrices[0] * animationData.DefaultTransform;
+	float maxDifference = 0.0f;
+	for (UINT frame = 0; frame < 120; ++frame)
+	{
+		animationData.Update(0, (int)frame, 1.0f / 60.0f);
+
+		std::vector<Matrix> reference;
+		BuildModelTransformsScalar(animationData.m_Pose, animationData.BoneParents, &reference);
+
+		animationData.WriteSkinningMatrices(pPalette);
+		for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+		{
+			TEST_CHECK(GetMaxRelativeDifference(animationData.BoneTransforms[boneID], reference[boneID]) <= RELATIVE_TOLERANCE);
+
+			const Matrix PREFIX = animationData.InverseDefaultTransform * animationData.OffsetMatrices[boneID];
+			TEST_CHECK(GetMaxRelativeDifference(pPalette[boneID], (PREFIX * animationData.BoneTransforms[boneID] * SUFFIX).Transpose()) <= RELATIVE_TOLERANCE);
+
+			const Matrix EXPECTED = animationData.Get(0, (int)frame, (int)boneID).Transpose();
+			for (UINT i = 0; i < 16; ++i)
+			{
+				maxDifference = fmaxf(maxDifference, fabsf((&pPalette[boneID]._11)[i] - (&EXPECTED._11)[i]));
+			}
+		}
+	}
+	_aligned_free(pPalette);
+
+	printf("max palette difference from Get().Transpose(): %.1e\n", maxDifference);
+	TEST_CHECK(maxDifference <= GET_TOLERANCE);
+	return 0;
+}
+
+int main()
+{
+	if (TestBuildTransforms() || TestSkinningPalette())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("AnimationPoseTest passed\n");
+	return 0;
+}
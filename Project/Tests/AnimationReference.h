@@ -0,0 +1,275 @@
+#pragma once
+
+// ִϸ̼ ׽Ʈ/ġũ . ռ clip .
+
+#include "../Model/AnimationData.h"
+#include <string>
+#include <vector>
+
+inline UINT NextAnimationRandom(UINT* pSeed)
+{
+	*pSeed = *pSeed * 1664525 + 1013904223;
+	return (*pSeed >> 8);
+}
+
+inline float NextAnimationRandomFloat(UINT* pSeed, float minValue, float maxValue)
+{
+	return minValue + (maxValue - minValue) * (float)(NextAnimationRandom(pSeed) & 0xffff) / 65535.0f;
+}
+
+inline Quaternion MakeRandomRotation(UINT* pSeed, float maxAngle)
+{
+	Vector3 axis(NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f));
+	axis.Normalize();
+	if (axis.LengthSquared() == 0.0f)
+	{
+		axis = Vector3::UnitY;
+	}
+	return Quaternion::CreateFromAxisAngle(axis, NextAnimationRandomFloat(pSeed, -maxAngle, maxAngle));
+}
+
+// bone õõ  ȸ  ̵. bUniform false key ð    ƴϰ .
+inline void MakeRandomClip(AnimationClip* pOutClip, UINT boneCount, UINT keyCount, bool bUniform, UINT seed)
+{
+	_ASSERT(keyCount >= 2);
+
+	pOutClip->Name = "Synthetic";
+	pOutClip->NumChannels = (int)boneCount;
+	pOutClip->Duration = (double)(keyCount - 1);
+	pOutClip->TicksPerSec = 30.0;
+	pOutClip->Keys.resize(boneCount);
+	pOutClip->IKRotations.assign(boneCount, Quaternion());
+
+	for (UINT boneID = 0; boneID < boneCount; ++boneID)
+	{
+		std::vector<AnimationClip::Key>& keys = pOutClip->Keys[boneID];
+		keys.resize(keyCount);
+
+		Vector3 axis(NextAnimationRandomFloat(&seed, -1.0f, 1.0f), NextAnimationRandomFloat(&seed, -1.0f, 1.0f), NextAnimationRandomFloat(&seed, 0.1f, 1.0f));
+		axis.Normalize();
+		const float PHASE = NextAnimationRandomFloat(&seed, 0.0f, DirectX::XM_2PI);
+		const float AMPLITUDE = NextAnimationRandomFloat(&seed, 0.1f, 0.8f);
+		const Vector3 OFFSET(NextAnimationRandomFloat(&seed, -5.0f, 5.0f), NextAnimationRandomFloat(&seed, 5.0f, 15.0f), NextAnimationRandomFloat(&seed, -5.0f, 5.0f));
+
+		for (UINT i = 0; i < keyCount; ++i)
+		{
+			AnimationClip::Key& key = keys[i];
+			key.Time = (double)i;
+			if (!bUniform && i > 0 && i < keyCount - 1)
+			{
+				key.Time += (double)NextAnimationRandomFloat(&seed, -0.3f, 0.3f);
+			}
+
+			const float ANGLE = AMPLITUDE * sinf(PHASE + (float)key.Time * 0.1f);
+			key.Rotation = Quaternion::CreateFromAxisAngle(axis, ANGLE);
+			key.Position = OFFSET + Vector3(0.1f * sinf((float)key.Time * 0.05f), 0.0f, 0.0f);
+			key.Scale = Vector3(1.0f);
+		}
+	}
+}
+
+//  format    clip. key ϳ bone, ȸ  bone,
+// ȣ  quaternion key, 16bit δ  Ѱ踦  ߴ root ̵(raw track).
+inline void MakeMixedTrackClip(AnimationClip* pOutClip, UINT boneCount, UINT keyCount, UINT seed)
+{
+	MakeRandomClip(pOutClip, boneCount, keyCount, true, seed);
+
+	for (UINT boneID = 0; boneID < boneCount; ++boneID)
+	{
+		std::vector<AnimationClip::Key>& keys = pOutClip->Keys[boneID];
+		if (boneID % 13 == 5)
+		{
+			keys.resize(1);
+			continue;
+		}
+		for (UINT i = 0; i < keyCount; ++i)
+		{
+			AnimationClip::Key& key = keys[i];
+			if (boneID == 0)
+			{
+				key.Position = Vector3(4.0f * (float)i, 90.0f + sinf((float)i * 0.2f), 0.0f);
+			}
+			if (boneID % 7 == 3)
+			{
+				key.Rotation = Quaternion::CreateFromAxisAngle(Vector3::UnitX, 0.4f);
+			}
+			if (boneID % 5 == 1 && i % 2 == 1)
+			{
+				key.Rotation = -key.Rotation;
+			}
+		}
+	}
+}
+
+static const UINT HUMANOID_BONE_COUNT = 65;
+
+// Mixamo  65 bone humanoid. θ ׻ ڽĺ  ID. rest ġ θ , cm .
+inline void MakeHumanoidBones(std::vector<std::string>* pOutNames, std::vector<int>* pOutParents, std::vector<Vector3>* pOutRestPositions)
+{
+	pOutNames->clear();
+	pOutParents->clear();
+	pOutRestPositions->clear();
+
+	auto addBone = [&](const std::string& NAME, int parentID, const Vector3& REST_POSITION)
+	{
+		pOutNames->push_back("mixamorig:" + NAME);
+		pOutParents->push_back(parentID);
+		pOutRestPositions->push_back(REST_POSITION);
+		return (int)pOutNames->size() - 1;
+	};
+
+	const int HIPS = addBone("Hips", -1, Vector3(0.0f, 100.0f, 0.0f));
+	const int SPINE = addBone("Spine", HIPS, Vector3(0.0f, 10.0f, 0.0f));
+	const int SPINE1 = addBone("Spine1", SPINE, Vector3(0.0f, 12.0f, 0.0f));
+	const int SPINE2 = addBone("Spine2", SPINE1, Vector3(0.0f, 13.0f, 0.0f));
+	const int NECK = addBone("Neck", SPINE2, Vector3(0.0f, 15.0f, 0.0f));
+	const int HEAD = addBone("Head", NECK, Vector3(0.0f, 9.0f, 0.0f));
+	addBone("HeadTop_End", HEAD, Vector3(0.0f, 18.0f, 0.0f));
+
+	const char* ppSIDES[2] = { "Left", "Right" };
+	const char* ppFINGERS[5] = { "Thumb", "Index", "Middle", "Ring", "Pinky" };
+	for (UINT side = 0; side < 2; ++side)
+	{
+		const std::string SIDE = ppSIDES[side];
+		const float SIGN = (side == 0 ? 1.0f : -1.0f);
+		const int SHOULDER = addBone(SIDE + "Shoulder", SPINE2, Vector3(6.0f * SIGN, 12.0f, 0.0f));
+		const int ARM = addBone(SIDE + "Arm", SHOULDER, Vector3(12.0f * SIGN, 0.0f, 0.0f));
+		const int FORE_ARM = addBone(SIDE + "ForeArm", ARM, Vector3(27.0f * SIGN, 0.0f, 0.0f));
+		const int HAND = addBone(SIDE + "Hand", FORE_ARM, Vector3(26.0f * SIGN, 0.0f, 0.0f));
+		for (UINT finger = 0; finger < 5; ++finger)
+		{
+			const std::string NAME = SIDE + "Hand" + ppFINGERS[finger];
+			int boneID = addBone(NAME + "1", HAND, Vector3(3.0f * SIGN, 0.0f, ((float)finger - 2.0f) * 2.0f));
+			boneID = addBone(NAME + "2", boneID, Vector3(3.5f * SIGN, 0.0f, 0.0f));
+			boneID = addBone(NAME + "3", boneID, Vector3(2.5f * SIGN, 0.0f, 0.0f));
+			addBone(NAME + "4", boneID, Vector3(2.0f * SIGN, 0.0f, 0.0f));
+		}
+	}
+	for (UINT side = 0; side < 2; ++side)
+	{
+		const std::string SIDE = ppSIDES[side];
+		const float SIGN = (side == 0 ? 1.0f : -1.0f);
+		const int UP_LEG = addBone(SIDE + "UpLeg", HIPS, Vector3(9.0f * SIGN, -6.0f, 0.0f));
+		const int LEG = addBone(SIDE + "Leg", UP_LEG, Vector3(0.0f, -42.0f, 0.0f));
+		const int FOOT = addBone(SIDE + "Foot", LEG, Vector3(0.0f, -41.0f, 0.0f));
+		const int TOE_BASE = addBone(SIDE + "ToeBase", FOOT, Vector3(0.0f, -7.0f, 12.0f));
+		addBone(SIDE + "Toe_End", TOE_BASE, Vector3(0.0f, 0.0f, 6.0f));
+	}
+	_ASSERT(pOutNames->size() == HUMANOID_BONE_COUNT);
+}
+
+// ModelLoader ä ó humanoid AnimationData . clip rest ġ ó 鸮 ռ key.
+// bind pose rest pose, DefaultTransform Ű 180cm [-1, 1].
+inline void InitHumanoidAnimationData(AnimationData* pOutData, UINT clipCount, UINT keyCount, UINT seed)
+{
+	std::vector<Vector3> restPositions;
+	MakeHumanoidBones(&pOutData->BoneIDToNames, &pOutData->BoneParents, &restPositions);
+	const UINT BONE_COUNT = (UINT)pOutData->BoneIDToNames.size();
+
+	pOutData->BoneNameToID.clear();
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		pOutData->BoneNameToID[pOutData->BoneIDToNames[boneID]] = (int)boneID;
+	}
+
+	std::vector<Vector3> bindPositions(BONE_COUNT);
+	pOutData->OffsetMatrices.resize(BONE_COUNT);
+	pOutData->InverseOffsetMatrices.resize(BONE_COUNT);
+	pOutData->NodeTransforms.resize(BONE_COUNT);
+	pOutData->BoneTransforms.assign(BONE_COUNT, Matrix());
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		const int PARENT_ID = pOutData->BoneParents[boneID];
+		bindPositions[boneID] = restPositions[boneID] + (PARENT_ID >= 0 ? bindPositions[PARENT_ID] : Vector3(0.0f));
+		pOutData->OffsetMatrices[boneID] = Matrix::CreateTranslation(-bindPositions[boneID]);
+		pOutData->InverseOffsetMatrices[boneID] = Matrix::CreateTranslation(bindPositions[boneID]);
+		pOutData->NodeTransforms[boneID] = Matrix::CreateTranslation(restPositions[boneID]);
+	}
+	pOutData->DefaultTransform = Matrix::CreateTranslation(Vector3(0.0f, -90.0f, 0.0f)) * Matrix::CreateScale(1.0f / 90.0f);
+	pOutData->InverseDefaultTransform = pOutData->DefaultTransform.Invert();
+
+	pOutData->Clips.resize(clipCount);
+	for (UINT clipID = 0; clipID < clipCount; ++clipID)
+	{
+		AnimationClip& clip = pOutData->Clips[clipID];
+		MakeRandomClip(&clip, BONE_COUNT, keyCount, true, seed + clipID * 7919);
+		for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+		{
+			for (AnimationClip::Key& key : clip.Keys[boneID])
+			{
+				key.Position = restPositions[boneID] + (key.Position - Vector3(0.0f, 10.0f, 0.0f)) * 0.05f;
+			}
+		}
+		clip.InitKeyTracks();
+	}
+	pOutData->InitSkinningTransforms();
+}
+
+//  ó bone SimpleMath ķ Scale * Rotation * Translation, θ  .
+inline void BuildModelTransformsScalar(const AnimationPose& POSE, const std::vector<int>& PARENTS, std::vector<Matrix>* pOutTransforms)
+{
+	const UINT64 BONE_COUNT = PARENTS.size();
+	pOutTransforms->resize(BONE_COUNT);
+	for (UINT64 boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		Matrix local = Matrix::CreateScale(POSE.Scales[boneID]) * Matrix::CreateFromQuaternion(POSE.Rotations[boneID]) * Matrix::CreateTranslation(POSE.Positions[boneID]);
+		const int PARENT_ID = PARENTS[boneID];
+		(*pOutTransforms)[boneID] = (PARENT_ID >= 0 ? local * (*pOutTransforms)[PARENT_ID] : local);
+	}
+}
+
+// BlendPoses/AddPoses bone scalar . SimpleMath  bone.
+inline Quaternion NlerpShortestScalar(const Quaternion& FROM, const Quaternion& TO, float weight)
+{
+	const Quaternion TARGET = (FROM.Dot(TO) < 0.0f ? -TO : TO);
+	Quaternion result = Quaternion::Lerp(FROM, TARGET, weight);
+	result.Normalize();
+	return result;
+}
+
+inline void BlendPosesScalar(AnimationPose* pDest, const AnimationPose& SRC, float weight, const float* pBoneWeights, UINT64 boneCount)
+{
+	for (UINT64 boneID = 0; boneID < boneCount; ++boneID)
+	{
+		const float W = weight * (pBoneWeights ? pBoneWeights[boneID] : 1.0f);
+		if (W <= 0.0f)
+		{
+			continue;
+		}
+		pDest->Positions[boneID] = Vector3::Lerp(pDest->Positions[boneID], SRC.Positions[boneID], W);
+		pDest->Scales[boneID] = Vector3::Lerp(pDest->Scales[boneID], SRC.Scales[boneID], W);
+		pDest->Rotations[boneID] = NlerpShortestScalar(pDest->Rotations[boneID], SRC.Rotations[boneID], W);
+	}
+}
+
+inline void AddPosesScalar(AnimationPose* pDest, const AnimationPose& SRC, const AnimationPose& REFERENCE, float weight, const float* pBoneWeights, UINT64 boneCount)
+{
+	for (UINT64 boneID = 0; boneID < boneCount; ++boneID)
+	{
+		const float W = weight * (pBoneWeights ? pBoneWeights[boneID] : 1.0f);
+		if (W <= 0.0f)
+		{
+			continue;
+		}
+		pDest->Positions[boneID] += (SRC.Positions[boneID] - REFERENCE.Positions[boneID]) * W;
+		pDest->Scales[boneID] += (SRC.Scales[boneID] - REFERENCE.Scales[boneID]) * W;
+
+		Quaternion inverseReference = REFERENCE.Rotations[boneID];
+		inverseReference.Conjugate();
+		const Quaternion DELTA = Quaternion::Concatenate(inverseReference, SRC.Rotations[boneID]);
+		Quaternion rotation = Quaternion::Concatenate(pDest->Rotations[boneID], NlerpShortestScalar(Quaternion::Identity, DELTA, W));
+		rotation.Normalize();
+		pDest->Rotations[boneID] = rotation;
+	}
+}
+
+inline void MakeRandomPose(AnimationPose* pOutPose, UINT64 boneCount, UINT* pSeed)
+{
+	pOutPose->Resize(boneCount);
+	for (UINT64 boneID = 0; boneID < boneCount; ++boneID)
+	{
+		pOutPose->Positions[boneID] = Vector3(NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f));
+		pOutPose->Scales[boneID] = Vector3(NextAnimationRandomFloat(pSeed, 0.9f, 1.1f), NextAnimationRandomFloat(pSeed, 0.9f, 1.1f), NextAnimationRandomFloat(pSeed, 0.9f, 1.1f));
+		pOutPose->Rotations[boneID] = MakeRandomRotation(pSeed, 3.14159265f);
+	}
+}
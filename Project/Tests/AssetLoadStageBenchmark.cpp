@@ -0,0 +1,275 @@
+#include "../pch.h"
+#include "../Model/AnimationLOD.h"
+#include "../Model/CookedAsset.h"
+#include "../Model/Skeleton.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <filesystem>
+#include <vector>
+
+//  ϳ character asset AssetLoadStage ܰ躰  ð .
+// - cook (ó ): file read( hash + cook  Ȯ +  б) -> process(clip retarget, LOD mask, PrepareClips) -> cook .
+// - cook ( ): file read( hash + cook  map + MeshInfo, AnimationData ). decode, process ǳʶ.
+// decode(Assimp) upload(D3D12) headless    .   FBX ũ  byte hash, б 븸 䳻.
+// ĳø   Ƿ file read  page cache ö  ð.
+
+static const WCHAR* pszASSET_FOLDER = L"AssetLoadStageBenchmarkAssets/";
+static const UINT CLIP_KEY_COUNT = 121; // 30fps 4.
+
+struct BenchmarkAsset
+{
+	std::wstring FileName;
+	std::vector<std::wstring> ClipNames;
+	std::vector<MeshInfo> MeshInfos;			 // decode  .
+	AnimationData AnimData;
+	std::vector<AnimationData> ClipAnimData;	 // clip ϸ decode  .
+};
+
+struct AssetStageTimes
+{
+	double ColdReadMS;
+	double ProcessMS;
+	double CookWriteMS;
+	double WarmReadMS;
+	UINT64 SourceBytes;
+	UINT64 CookedBytes;
+};
+
+static std::wstring GetCookedPath(const BenchmarkAsset& ASSET)
+{
+	return std::wstring(pszASSET_FOLDER) + ASSET.FileName.substr(0, ASSET.FileName.find_last_of(L'.')) + L".cooked";
+}
+
+static bool WriteRandomFile(const std::wstring& PATH, UINT64 size, UINT seed)
+{
+	std::vector<BYTE> data(size);
+	for (BYTE& value : data)
+	{
+		value = (BYTE)NextAnimationRandom(&seed);
+	}
+
+	FILE* pFile = fopen(ConvertTestPathToUTF8(PATH.c_str()).c_str(), "wb");
+	if (!pFile)
+	{
+		return false;
+	}
+	const bool bWRITTEN = (fwrite(data.data(), 1, data.size(), pFile) == data.size());
+	fclose(pFile);
+	return bWRITTEN;
+}
+
+// ReadWholeFileó  ü ޸𸮷.
+static UINT64 ReadSourceFile(const std::wstring& PATH, std::vector<BYTE>* pOutData)
+{
+	FILE* pFile = fopen(ConvertTestPathToUTF8(PATH.c_str()).c_str(), "rb");
+	if (!pFile)
+	{
+		return 0;
+	}
+	fseek(pFile, 0, SEEK_END);
+	pOutData->resize((UINT64)ftell(pFile));
+	fseek(pFile, 0, SEEK_SET);
+	const UINT64 READ_SIZE = fread(pOutData->data(), 1, pOutData->size(), pFile);
+	fclose(pFile);
+	return READ_SIZE;
+}
+
+static void MakeSkinnedMesh(MeshInfo* pOutMesh, UINT vertexCount, UINT* pSeed)
+{
+	pOutMesh->SkinnedVertices.resize(vertexCount);
+	for (SkinnedVertex& vertex : pOutMesh->SkinnedVertices)
+	{
+		vertex.Position = Vector3(NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f));
+		vertex.Normal = Vector3(0.0f, 1.0f, 0.0f);
+		vertex.Texcoord = Vector2(NextAnimationRandomFloat(pSeed, 0.0f, 1.0f), NextAnimationRandomFloat(pSeed, 0.0f, 1.0f));
+		vertex.Tangent = Vector3(1.0f, 0.0f, 0.0f);
+		for (UINT i = 0; i < 4; ++i)
+		{
+			vertex.BlendWeights[i] = 0.25f;
+			vertex.BoneIndices[i] = (UCHAR)(NextAnimationRandom(pSeed) % HUMANOID_BONE_COUNT);
+		}
+	}
+	pOutMesh->Indices.resize(vertexCount * 3);
+	for (UINT& index : pOutMesh->Indices)
+	{
+		index = NextAnimationRandom(pSeed) % vertexCount;
+	}
+	pOutMesh->szAlbedoTextureFileName = L"./Assets/Character_Diffuse.png";
+	pOutMesh->szNormalTextureFileName = L"./Assets/Character_Normal.png";
+}
+
+//  ũ Remy.fbx( 3MB) Mixamo clip fbx( 0.5MB) .
+static bool InitFolder(std::vector<BenchmarkAsset>* pAssets, UINT assetCount, UINT vertexCount)
+{
+	std::filesystem::remove_all(ConvertTestPathToUTF8(pszASSET_FOLDER));
+	std::filesystem::create_directory(ConvertTestPathToUTF8(pszASSET_FOLDER));
+
+	pAssets->resize(assetCount);
+	for (UINT a = 0; a < assetCount; ++a)
+	{
+		BenchmarkAsset& asset = (*pAssets)[a];
+		UINT seed = 11 + a;
+		const UINT CLIP_COUNT = 4 + a % 5;
+
+		asset.FileName = L"Character" + std::to_wstring(a) + L".fbx";
+		if (!WriteRandomFile(pszASSET_FOLDER + asset.FileName, vertexCount * 150, seed))
+		{
+			return false;
+		}
+
+		asset.MeshInfos.resize(2);
+		MakeSkinnedMesh(&asset.MeshInfos[0], vertexCount, &seed);
+		MakeSkinnedMesh(&asset.MeshInfos[1], vertexCount / 4, &seed);
+		InitHumanoidAnimationData(&asset.AnimData, 0, CLIP_KEY_COUNT, seed);
+
+		asset.ClipNames.resize(CLIP_COUNT);
+		asset.ClipAnimData.resize(CLIP_COUNT);
+		for (UINT c = 0; c < CLIP_COUNT; ++c)
+		{
+			asset.ClipNames[c] = L"Character" + std::to_wstring(a) + L"_Clip" + std::to_wstring(c) + L".fbx";
+			if (!WriteRandomFile(pszASSET_FOLDER + asset.ClipNames[c], 512 * 1024, seed + c))
+			{
+				return false;
+			}
+			InitHumanoidAnimationData(&asset.ClipAnimData[c], 1, CLIP_KEY_COUNT, seed * 31 + c);
+		}
+	}
+	return true;
+}
+
+static UINT64 HashAssetSources(const BenchmarkAsset& ASSET)
+{
+	std::vector<std::wstring> sourceNames(1, ASSET.FileName);
+	sourceNames.insert(sourceNames.end(), ASSET.ClipNames.begin(), ASSET.ClipNames.end());
+	return HashCookedAssetSources(pszASSET_FOLDER, sourceNames, 0);
+}
+
+// ProcessAsset character κа  .
+static bool ProcessCharacter(const BenchmarkAsset& ASSET, AnimationData* pOutAnimData)
+{
+	*pOutAnimData = ASSET.AnimData;
+
+	Skeleton characterSkeleton;
+	characterSkeleton.Initialize(*pOutAnimData);
+	pOutAnimData->Clips.clear();
+	for (UINT64 i = 0, size = ASSET.ClipAnimData.size(); i < size; ++i)
+	{
+		const AnimationData& CLIP_DATA = ASSET.ClipAnimData[i];
+
+		Skeleton clipSkeleton;
+		SkeletonRemap remap;
+		clipSkeleton.Initialize(CLIP_DATA);
+		if (CLIP_DATA.Clips.empty() || !BuildSkeletonRemap(clipSkeleton, characterSkeleton, &remap))
+		{
+			return false;
+		}
+
+		AnimationClip retargetedClip;
+		RetargetClip(CLIP_DATA.Clips[0], clipSkeleton, characterSkeleton, remap, &retargetedClip);
+		retargetedClip.Name.assign(ASSET.ClipNames[i].begin(), ASSET.ClipNames[i].end());
+		pOutAnimData->Clips.push_back(retargetedClip);
+	}
+
+	BuildAnimationLODMask(characterSkeleton, 0.1f, &pOutAnimData->LODBoneIDs);
+	pOutAnimData->PrepareClips();
+	return true;
+}
+
+static bool RunAsset(const BenchmarkAsset& ASSET, AssetStageTimes* pOutTimes)
+{
+	*pOutTimes = {};
+	const std::wstring COOKED_PATH = GetCookedPath(ASSET);
+
+	// ó . cook  Ƿ   .
+	UINT64 contentHash = 0;
+	{
+		TestTimer timer;
+		contentHash = HashAssetSources(ASSET);
+		CookedAsset cookedAsset;
+		if (contentHash == 0 || cookedAsset.Open(COOKED_PATH, contentHash))
+		{
+			return false;
+		}
+
+		std::vector<BYTE> data;
+		pOutTimes->SourceBytes = ReadSourceFile(pszASSET_FOLDER + ASSET.FileName, &data);
+		for (const std::wstring& CLIP_NAME : ASSET.ClipNames)
+		{
+			pOutTimes->SourceBytes += ReadSourceFile(pszASSET_FOLDER + CLIP_NAME, &data);
+		}
+		pOutTimes->ColdReadMS = timer.GetElapsedMS();
+	}
+
+	AnimationData animData;
+	{
+		TestTimer timer;
+		if (!ProcessCharacter(ASSET, &animData))
+		{
+			return false;
+		}
+		pOutTimes->ProcessMS = timer.GetElapsedMS();
+	}
+	{
+		TestTimer timer;
+		if (FAILED(WriteCookedAsset(COOKED_PATH, contentHash, ASSET.MeshInfos, &animData)))
+		{
+			return false;
+		}
+		pOutTimes->CookWriteMS = timer.GetElapsedMS();
+	}
+
+	//  . cook ϸ .
+	{
+		TestTimer timer;
+		std::vector<MeshInfo> meshInfos;
+		AnimationData cookedAnimData;
+		CookedAsset cookedAsset;
+		if (!cookedAsset.Open(COOKED_PATH, HashAssetSources(ASSET)))
+		{
+			return false;
+		}
+		cookedAsset.ReadMeshInfos(&meshInfos);
+		if (!cookedAsset.ReadAnimationData(&cookedAnimData) || cookedAnimData.Clips.size() != ASSET.ClipNames.size())
+		{
+			return false;
+		}
+		pOutTimes->WarmReadMS = timer.GetElapsedMS();
+		pOutTimes->CookedBytes = cookedAsset.GetFileSize();
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT ASSET_COUNT = (bSmoke ? 2 : 8);
+	const UINT VERTEX_COUNT = (bSmoke ? 2000 : 20000);
+
+	std::vector<BenchmarkAsset> assets;
+	TEST_CHECK(InitFolder(&assets, ASSET_COUNT, VERTEX_COUNT));
+
+	printf("asset  clips  source MB  cooked MB  | read(src) ms  process ms  cook write ms  | read(cooked) ms\n");
+	AssetStageTimes total = {};
+	for (UINT a = 0; a < ASSET_COUNT; ++a)
+	{
+		AssetStageTimes times;
+		TEST_CHECK(RunAsset(assets[a], &times));
+		printf("%5u  %5u  %9.2f  %9.2f  | %12.3f  %10.3f  %13.3f  | %15.3f\n", a, (UINT)assets[a].ClipNames.size(),
+			   (double)times.SourceBytes / (1024.0 * 1024.0), (double)times.CookedBytes / (1024.0 * 1024.0),
+			   times.ColdReadMS, times.ProcessMS, times.CookWriteMS, times.WarmReadMS);
+
+		total.ColdReadMS += times.ColdReadMS;
+		total.ProcessMS += times.ProcessMS;
+		total.CookWriteMS += times.CookWriteMS;
+		total.WarmReadMS += times.WarmReadMS;
+		total.SourceBytes += times.SourceBytes;
+		total.CookedBytes += times.CookedBytes;
+	}
+	printf("total  %5s  %9.2f  %9.2f  | %12.3f  %10.3f  %13.3f  | %15.3f\n", "",
+		   (double)total.SourceBytes / (1024.0 * 1024.0), (double)total.CookedBytes / (1024.0 * 1024.0),
+		   total.ColdReadMS, total.ProcessMS, total.CookWriteMS, total.WarmReadMS);
+
+	std::filesystem::remove_all(ConvertTestPathToUTF8(pszASSET_FOLDER));
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
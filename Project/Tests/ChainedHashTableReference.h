@@ -0,0 +1,214 @@
+#pragma once
+
+// user-001  chained HashTable(baseline Util/HashTable) 纻. HashTableBenchmark  .
+// bucket  , bucket LinkedList, Ű 4byte   bucket   . ̸ ٲٰ  ״.
+
+#include "../Util/LinkedList.h"
+
+struct ChainedBucket
+{
+	ListElem* pBucketLinkHead;
+	ListElem* pBucketLinkTail;
+	UINT LinkNum;
+};
+struct ChainedBucketItem
+{
+	const void* pItem;
+	ChainedBucket* pBucket;
+	ListElem SortLink;
+	UINT Size;
+	char pKeyData[1];
+};
+class ChainedHashTable
+{
+public:
+	ChainedHashTable() = default;
+	~ChainedHashTable() { Cleanup(); };
+
+	void Initialize(UINT maxBucketNum, UINT maxKeySize, UINT bucketNum)
+	{
+		_ASSERT(maxBucketNum > 0);
+		_ASSERT(maxKeySize > 0);
+		_ASSERT(bucketNum > 0);
+
+		m_MaxBucketNum = maxBucketNum;
+		m_MaxKeyDataSize = maxKeySize;
+
+		m_pBucketTable = new ChainedBucket[maxBucketNum];
+		ZeroMemory(m_pBucketTable, sizeof(ChainedBucket) * maxBucketNum);
+	}
+
+	UINT Select(void** ppItemList, UINT maxItemNum, const void* pKeyData, UINT size)
+	{
+		_ASSERT(ppItemList);
+		_ASSERT(pKeyData);
+
+		UINT selectedItemNum = 0;
+		UINT index = createKey(pKeyData, size, m_MaxBucketNum);
+		ChainedBucket* pBucket = m_pBucketTable + index;
+
+		ListElem* pCurBucket = pBucket->pBucketLinkHead;
+		ChainedBucketItem* pBucketItem;
+
+		while (pCurBucket)
+		{
+			if (!maxItemNum)
+			{
+				break;
+			}
+
+			pBucketItem = (ChainedBucketItem*)pCurBucket->pItem;
+
+			if (pBucketItem->Size != size)
+			{
+				goto LB_NEXT;
+			}
+			if (memcmp(pBucketItem->pKeyData, pKeyData, size))
+			{
+				goto LB_NEXT;
+			}
+
+			--maxItemNum;
+
+			ppItemList[selectedItemNum] = (void*)pBucketItem->pItem;
+			++selectedItemNum;
+
+		LB_NEXT:
+			pCurBucket = pCurBucket->pNext;
+		}
+
+		return selectedItemNum;
+	}
+
+	void* Insert(const void* pItem, const void* pKeyData, UINT size)
+	{
+		_ASSERT(pItem);
+		_ASSERT(pKeyData);
+
+		void* pSearchHandle = nullptr;
+
+		if (size > m_MaxKeyDataSize)
+		{
+			__debugbreak();
+		}
+
+		UINT bucketMemSize = (UINT)(sizeof(ChainedBucketItem) - sizeof(char)) + m_MaxKeyDataSize;
+		ChainedBucketItem* pBucketItem = (ChainedBucketItem*)malloc(bucketMemSize);
+
+		UINT index = createKey(pKeyData, size, m_MaxBucketNum);
+		ChainedBucket* pBucket = m_pBucketTable + index;
+
+		pBucketItem->pItem = pItem;
+		pBucketItem->Size = size;
+		pBucketItem->pBucket = pBucket;
+		pBucketItem->SortLink.pPrev = nullptr;
+		pBucketItem->SortLink.pNext = nullptr;
+		pBucketItem->SortLink.pItem = pBucketItem;
+		pBucket->LinkNum++;
+
+		memcpy(pBucketItem->pKeyData, pKeyData, size);
+
+		LinkElemIntoListFIFO(&pBucket->pBucketLinkHead, &pBucket->pBucketLinkTail, &pBucketItem->SortLink);
+
+		++m_ItemNum;
+		pSearchHandle = pBucketItem;
+
+		return pSearchHandle;
+	}
+
+	void Delete(const void* pSearchHandle)
+	{
+		_ASSERT(pSearchHandle);
+
+		ChainedBucketItem* pBucketItem = (ChainedBucketItem*)pSearchHandle;
+		ChainedBucket* pBucket = pBucketItem->pBucket;
+
+		UnLinkElemFromList(&pBucket->pBucketLinkHead, &pBucket->pBucketLinkTail, &pBucketItem->SortLink);
+		--(pBucket->LinkNum);
+
+		free(pBucketItem);
+		--m_ItemNum;
+	}
+
+	void DeleteAll()
+	{
+		ChainedBucketItem* pBucketItem;
+		for (UINT i = 0; i < m_MaxBucketNum; ++i)
+		{
+			while (m_pBucketTable[i].pBucketLinkHead)
+			{
+				pBucketItem = (ChainedBucketItem*)m_pBucketTable[i].pBucketLinkHead->pItem;
+				Delete(pBucketItem);
+			}
+		}
+	}
+
+	void Cleanup()
+	{
+		resourceCheck();
+
+		DeleteAll();
+		if (m_pBucketTable)
+		{
+			delete[] m_pBucketTable;
+			m_pBucketTable = nullptr;
+		}
+	}
+
+	inline UINT GetItemNum() { return m_ItemNum; }
+
+protected:
+	UINT createKey(const void* pData, UINT size, UINT bucketNum)
+	{
+		UINT keyData = 0;
+
+		const char* pEntry = (char*)pData;
+		if (size & 0x00000001)
+		{
+			keyData += (UINT)(*(BYTE*)pEntry);
+			++pEntry;
+			--size;
+		}
+		if (!size)
+		{
+			goto LB_RETURN;
+		}
+
+		if (size & 0x00000002)
+		{
+			keyData += (UINT)(*(USHORT*)pEntry);
+			pEntry += 2;
+			size -= 2;
+		}
+		if (!size)
+		{
+			goto LB_RETURN;
+		}
+
+		size = (size >> 2);
+
+		for (UINT i = 0; i < size; ++i)
+		{
+			keyData += *(UINT*)pEntry;
+			pEntry += 4;
+		}
+
+	LB_RETURN:
+		UINT index = keyData % bucketNum;
+		return index;
+	}
+
+	void resourceCheck()
+	{
+		if (m_ItemNum)
+		{
+			__debugbreak();
+		}
+	}
+
+private:
+	ChainedBucket* m_pBucketTable = nullptr;
+	UINT m_MaxBucketNum = 0;
+	UINT m_MaxKeyDataSize = 0;
+	UINT m_ItemNum = 0;
+};
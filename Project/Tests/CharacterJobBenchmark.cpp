@@ -0,0 +1,170 @@
+#include "../pch.h"
+#include "../Util/JobSystem.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// App::runCharacterJobs/characterPoseJob  (SplitRange    SetLOD + Update)
+// ĳ  100~2000, worker 1..8 frame pose  ð .
+// job   palette  忡 ʷ  Ͱ bit  ƾ .
+
+static const UINT MAX_BENCHMARK_JOB_COUNT = MAX_JOB_WORKER_COUNT * JOB_RANGE_PER_WORKER;
+static const UINT CLIP_KEY_COUNT = 121;
+
+struct CharacterBenchmarkJobDesc
+{
+	AnimationData* pCharacters;
+	UINT* pUpdateCounts;
+	UINT FirstCharacter;
+	UINT CharacterCount;
+	int Frame;
+	float DeltaTime;
+};
+
+static void UpdateCharacter(AnimationData* pCharacter, int frame, float deltaTime)
+{
+	AnimationLODState lod = { };
+	lod.UpdateInterval = 1;
+	lod.bEvaluate = true;
+	pCharacter->SetLOD(lod);
+	pCharacter->Update(0, frame, deltaTime);
+}
+
+static void CharacterPoseJob(void* pArg, UINT workerIndex)
+{
+	CharacterBenchmarkJobDesc* pDesc = (CharacterBenchmarkJobDesc*)pArg;
+	for (UINT i = pDesc->FirstCharacter, end = pDesc->FirstCharacter + pDesc->CharacterCount; i < end; ++i)
+	{
+		UpdateCharacter(&pDesc->pCharacters[i], pDesc->Frame, pDesc->DeltaTime);
+		++pDesc->pUpdateCounts[i];
+	}
+}
+
+static void InitCharacters(std::vector<AnimationData>* pCharacters, UINT characterCount)
+{
+	pCharacters->resize(characterCount);
+	for (UINT c = 0; c < characterCount; ++c)
+	{
+		InitHumanoidAnimationData(&(*pCharacters)[c], 1, CLIP_KEY_COUNT, 17 + c % 8);
+		// ĳ͸ ٸ  .
+		(*pCharacters)[c].TimeSinceLoaded = (double)(c % 97) * 0.037;
+	}
+}
+
+static double MeasureSerialFrameMS(std::vector<AnimationData>* pCharacters, UINT frameCount)
+{
+	TestTimer timer;
+	for (UINT frame = 0; frame < frameCount; ++frame)
+	{
+		for (AnimationData& character : *pCharacters)
+		{
+			UpdateCharacter(&character, (int)frame, 1.0f / 60.0f);
+		}
+	}
+	return timer.GetElapsedMS() / frameCount;
+}
+
+static double MeasureJobFrameMS(std::vector<AnimationData>* pCharacters, UINT workerCount, UINT frameCount, int* pOutError)
+{
+	const UINT CHARACTER_COUNT = (UINT)pCharacters->size();
+	std::vector<UINT> updateCounts(CHARACTER_COUNT, 0);
+
+	JobCounter counter;
+	JobSystem jobSystem;
+	jobSystem.Initialize(workerCount - 1, MAX_BENCHMARK_JOB_COUNT);
+
+	JobRange pRanges[MAX_BENCHMARK_JOB_COUNT];
+	CharacterBenchmarkJobDesc pDescs[MAX_BENCHMARK_JOB_COUNT];
+
+	TestTimer timer;
+	for (UINT frame = 0; frame < frameCount; ++frame)
+	{
+		const UINT JOB_COUNT = jobSystem.SplitRange(CHARACTER_COUNT, MAX_BENCHMARK_JOB_COUNT, pRanges);
+		for (UINT i = 0; i < JOB_COUNT; ++i)
+		{
+			CharacterBenchmarkJobDesc* pDesc = &pDescs[i];
+			pDesc->pCharacters = pCharacters->data();
+			pDesc->pUpdateCounts = updateCounts.data();
+			pDesc->FirstCharacter = pRanges[i].First;
+			pDesc->CharacterCount = pRanges[i].Count;
+			pDesc->Frame = (int)frame;
+			pDesc->DeltaTime = 1.0f / 60.0f;
+			jobSystem.Submit(CharacterPoseJob, pDesc, &counter);
+		}
+		jobSystem.WaitForCounter(&counter);
+	}
+	const double FRAME_MS = timer.GetElapsedMS() / frameCount;
+
+	//  ĳͰ frame Ȯ  .
+	*pOutError = 0;
+	for (UINT count : updateCounts)
+	{
+		if (count != frameCount)
+		{
+			fprintf(stderr, "character updated %u times in %u frames\n", count, frameCount);
+			*pOutError = 1;
+			break;
+		}
+	}
+	return FRAME_MS;
+}
+
+static int ComparePalettes(std::vector<AnimationData>* pExpected, std::vector<AnimationData>* pActual)
+{
+	std::vector<Matrix> expectedPalette(HUMANOID_BONE_COUNT);
+	std::vector<Matrix> actualPalette(HUMANOID_BONE_COUNT);
+	for (UINT c = 0, size = (UINT)pExpected->size(); c < size; ++c)
+	{
+		(*pExpected)[c].WriteSkinningMatrices(expectedPalette.data());
+		(*pActual)[c].WriteSkinningMatrices(actualPalette.data());
+		TEST_CHECK(memcmp(expectedPalette.data(), actualPalette.data(), sizeof(Matrix) * HUMANOID_BONE_COUNT) == 0);
+	}
+	return 0;
+}
+
+static int RunCharacters(UINT characterCount, UINT frameCount)
+{
+	std::vector<AnimationData> serialCharacters;
+	InitCharacters(&serialCharacters, characterCount);
+	const double SERIAL_MS = MeasureSerialFrameMS(&serialCharacters, frameCount);
+	printf("%5u characters  serial %8.3f ms/frame\n", characterCount, SERIAL_MS);
+
+	double baseFrameMS = 0.0;
+	for (UINT workerCount = 1; workerCount <= 8; ++workerCount)
+	{
+		std::vector<AnimationData> characters;
+		InitCharacters(&characters, characterCount);
+
+		int error = 0;
+		const double FRAME_MS = MeasureJobFrameMS(&characters, workerCount, frameCount, &error);
+		if (error || ComparePalettes(&serialCharacters, &characters))
+		{
+			fprintf(stderr, "%u characters, %u workers\n", characterCount, workerCount);
+			return 1;
+		}
+		if (workerCount == 1)
+		{
+			baseFrameMS = FRAME_MS;
+		}
+		printf("      workers %u  %8.3f ms/frame  speedup %5.2fx\n", workerCount, FRAME_MS, baseFrameMS / FRAME_MS);
+	}
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT FRAME_COUNT = (bSmoke ? 2 : 60);
+
+	printf("%u bones, %u keys per track, hardware threads %u\n", HUMANOID_BONE_COUNT, CLIP_KEY_COUNT, std::thread::hardware_concurrency());
+	const UINT pCharacterCounts[] = { 100, 500, 2000 };
+	for (UINT characterCount : pCharacterCounts)
+	{
+		if (RunCharacters(bSmoke ? characterCount / 10 : characterCount, FRAME_COUNT))
+		{
+			return 1;
+		}
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
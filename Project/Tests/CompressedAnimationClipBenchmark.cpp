@@ -0,0 +1,110 @@
+#include "../pch.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// 65 bone clip   ޸, , ü pose sample ð.
+//  key 迭 InterpolateKeyData bone ,  SamplePose  .
+
+static float GetRotationDifference(const Quaternion& A, const Quaternion& B)
+{
+	const float SIGN = (A.Dot(B) < 0.0f ? -1.0f : 1.0f);
+	return fmaxf(fmaxf(fabsf(A.x - SIGN * B.x), fabsf(A.y - SIGN * B.y)), fmaxf(fabsf(A.z - SIGN * B.z), fabsf(A.w - SIGN * B.w)));
+}
+
+static float GetVectorDifference(const Vector3& A, const Vector3& B)
+{
+	return fmaxf(fmaxf(fabsf(A.x - B.x), fabsf(A.y - B.y)), fabsf(A.z - B.z));
+}
+
+static int RunClip(UINT keyCount, UINT poseCount)
+{
+	const UINT BONE_COUNT = 65;
+
+	AnimationData animationData;
+	animationData.Clips.resize(1);
+	AnimationClip* pClip = &animationData.Clips[0];
+	MakeMixedTrackClip(pClip, BONE_COUNT, keyCount, 7);
+	pClip->InitKeyTracks();
+
+	UINT64 keyDataSize = 0;
+	for (const std::vector<AnimationClip::Key>& KEYS : pClip->Keys)
+	{
+		keyDataSize += sizeof(KEYS) + KEYS.capacity() * sizeof(AnimationClip::Key);
+	}
+
+	CompressedAnimationClip compressed;
+	TestTimer timer;
+	TEST_CHECK(compressed.Initialize(*pClip, AnimationCompressionSettings()));
+	const double COMPRESS_MS = timer.GetElapsedMS();
+
+	std::vector<Vector3> positions(BONE_COUNT);
+	std::vector<Quaternion> rotations(BONE_COUNT);
+	std::vector<Vector3> scales(BONE_COUNT);
+	std::vector<Vector3> sourcePositions(BONE_COUNT);
+	std::vector<Quaternion> sourceRotations(BONE_COUNT);
+	std::vector<Vector3> sourceScales(BONE_COUNT);
+
+	// key   ð   .
+	float maxRotationError = 0.0f;
+	float maxTranslationError = 0.0f;
+	UINT seed = 3;
+	for (UINT i = 0; i < 1000; ++i)
+	{
+		const float TIME = NextAnimationRandomFloat(&seed, 0.0f, (float)(keyCount - 1));
+		compressed.SamplePose(TIME, positions.data(), rotations.data(), scales.data());
+		for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+		{
+			animationData.InterpolateKeyData(&sourcePositions[boneID], &sourceRotations[boneID], &sourceScales[boneID], pClip, (int)boneID, TIME);
+			maxRotationError = fmaxf(maxRotationError, GetRotationDifference(rotations[boneID], sourceRotations[boneID]));
+			maxTranslationError = fmaxf(maxTranslationError, GetVectorDifference(positions[boneID], sourcePositions[boneID]));
+		}
+	}
+
+	// 60Hz ó  .
+	const float DELTA_TICK = (float)pClip->TicksPerSec / 60.0f;
+	const float LAST_TIME = (float)(keyCount - 1);
+	volatile float sink = 0.0f;
+	timer.Reset();
+	for (UINT i = 0; i < poseCount; ++i)
+	{
+		const float TIME = fmodf(DELTA_TICK * (float)i, LAST_TIME);
+		for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+		{
+			animationData.InterpolateKeyData(&sourcePositions[boneID], &sourceRotations[boneID], &sourceScales[boneID], pClip, (int)boneID, TIME);
+		}
+		sink += sourceRotations[3].w;
+	}
+	const double SOURCE_US = timer.GetElapsedMS() * 1000.0 / poseCount;
+
+	timer.Reset();
+	for (UINT i = 0; i < poseCount; ++i)
+	{
+		const float TIME = fmodf(DELTA_TICK * (float)i, LAST_TIME);
+		compressed.SamplePose(TIME, positions.data(), rotations.data(), scales.data());
+		sink += rotations[3].w;
+	}
+	const double COMPRESSED_US = timer.GetElapsedMS() * 1000.0 / poseCount;
+
+	printf("%4u keys  memory %8llu -> %7llu bytes (%4.1fx)  compress %7.2f ms  |  max error at keys rot %.1e pos %.1e, between keys rot %.1e pos %.1e  |  pose %6.2f us -> %5.2f us (%.1fx)\n",
+		   keyCount, keyDataSize, compressed.GetMemorySize(), (double)keyDataSize / (double)compressed.GetMemorySize(), COMPRESS_MS,
+		   compressed.GetMaxRotationError(), compressed.GetMaxTranslationError(), maxRotationError, maxTranslationError,
+		   SOURCE_US, COMPRESSED_US, SOURCE_US / COMPRESSED_US);
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	const UINT POSE_COUNT = (IsSmokeRun(argc, argv) ? 10 : 20000);
+
+	const UINT pKeyCounts[] = { 121, 1000 };
+	for (UINT keyCount : pKeyCounts)
+	{
+		if (RunClip(keyCount, POSE_COUNT))
+		{
+			return 1;
+		}
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,164 @@
+#include "../pch.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+static float GetRotationDifference(const Quaternion& A, const Quaternion& B)
+{
+	const float SIGN = (A.Dot(B) < 0.0f ? -1.0f : 1.0f);
+	return fmaxf(fmaxf(fabsf(A.x - SIGN * B.x), fabsf(A.y - SIGN * B.y)), fmaxf(fabsf(A.z - SIGN * B.z), fabsf(A.w - SIGN * B.w)));
+}
+
+static float GetVectorDifference(const Vector3& A, const Vector3& B)
+{
+	return fmaxf(fmaxf(fabsf(A.x - B.x), fabsf(A.y - B.y)), fabsf(A.z - B.z));
+}
+
+// key   Ѱ , key ̿  key (InterpolateKeyData) ؾ .
+static int TestErrorBounds()
+{
+	const UINT BONE_COUNT = 65;
+	const UINT KEY_COUNT = 121;
+
+	AnimationData animationData;
+	animationData.Clips.resize(1);
+	AnimationClip* pClip = &animationData.Clips[0];
+	MakeMixedTrackClip(pClip, BONE_COUNT, KEY_COUNT, 7);
+
+	AnimationCompressionSettings settings;
+	CompressedAnimationClip compressed;
+	TEST_CHECK(compressed.Initialize(*pClip, settings));
+	TEST_CHECK(compressed.GetBoneCount() == BONE_COUNT);
+	TEST_CHECK(compressed.GetSampleCount() == KEY_COUNT);
+	TEST_CHECK(compressed.GetMaxRotationError() <= settings.RotationErrorBound);
+	TEST_CHECK(compressed.GetMaxTranslationError() <= settings.TranslationErrorBound);
+	TEST_CHECK(compressed.GetMaxScaleError() <= settings.ScaleErrorBound);
+
+	Vector3 position;
+	Quaternion rotation;
+	Vector3 scale;
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		for (const AnimationClip::Key& KEY : pClip->Keys[boneID])
+		{
+			compressed.SampleBone((int)boneID, (float)KEY.Time, &position, &rotation, &scale);
+			TEST_CHECK(GetRotationDifference(rotation, KEY.Rotation) <= settings.RotationErrorBound);
+			TEST_CHECK(GetVectorDifference(position, KEY.Position) <= settings.TranslationErrorBound);
+			TEST_CHECK(GetVectorDifference(scale, KEY.Scale) <= settings.ScaleErrorBound);
+		}
+	}
+
+	// key ̴  slerp,  nlerp   .   ð  key .
+	std::vector<Vector3> positions(BONE_COUNT);
+	std::vector<Quaternion> rotations(BONE_COUNT);
+	std::vector<Vector3> scales(BONE_COUNT);
+	float maxRotationError = 0.0f;
+	float maxTranslationError = 0.0f;
+	UINT seed = 11;
+	for (UINT i = 0; i < 2000; ++i)
+	{
+		const float TIME = NextAnimationRandomFloat(&seed, -2.0f, (float)KEY_COUNT + 1.0f);
+		compressed.SamplePose(TIME, positions.data(), rotations.data(), scales.data());
+		for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+		{
+			// SampleBone SamplePose  .
+			compressed.SampleBone((int)boneID, TIME, &position, &rotation, &scale);
+			TEST_CHECK(GetRotationDifference(rotation, rotations[boneID]) <= 1e-6f);
+			TEST_CHECK(GetVectorDifference(position, positions[boneID]) <= 1e-5f);
+			TEST_CHECK(GetVectorDifference(scale, scales[boneID]) <= 1e-6f);
+
+			Vector3 sourcePosition;
+			Quaternion sourceRotation;
+			Vector3 sourceScale;
+			animationData.InterpolateKeyData(&sourcePosition, &sourceRotation, &sourceScale, pClip, (int)boneID, TIME);
+			maxRotationError = fmaxf(maxRotationError, GetRotationDifference(rotations[boneID], sourceRotation));
+			maxTranslationError = fmaxf(maxTranslationError, GetVectorDifference(positions[boneID], sourcePosition));
+		}
+	}
+	TEST_CHECK(maxRotationError <= 2.0f * settings.RotationErrorBound);
+	TEST_CHECK(maxTranslationError <= 2.0f * settings.TranslationErrorBound);
+	return 0;
+}
+
+//  Ѱ踦  ߸  ־ . ð ä  key(FBX loader ⺻) ź.
+static int TestReject()
+{
+	AnimationClip clip;
+	MakeMixedTrackClip(&clip, 20, 30, 3);
+
+	AnimationCompressionSettings settings;
+	CompressedAnimationClip compressed;
+	TEST_CHECK(compressed.Initialize(clip, settings));
+
+	settings.RotationErrorBound = 1e-7f;
+	TEST_CHECK(!compressed.Initialize(clip, settings));
+	TEST_CHECK(!compressed.IsValid());
+
+	AnimationClip zeroTimeClip = clip;
+	for (std::vector<AnimationClip::Key>& keys : zeroTimeClip.Keys)
+	{
+		for (AnimationClip::Key& key : keys)
+		{
+			key.Time = 0.0;
+		}
+	}
+	TEST_CHECK(!compressed.Initialize(zeroTimeClip, AnimationCompressionSettings()));
+	TEST_CHECK(!compressed.IsValid());
+
+	AnimationClip emptyTrackClip = clip;
+	emptyTrackClip.Keys[3].clear();
+	TEST_CHECK(!compressed.Initialize(emptyTrackClip, AnimationCompressionSettings()));
+	return 0;
+}
+
+// cooked asset  ȭ.   , ߸ų  byte ź.
+static int TestSerialize()
+{
+	const UINT BONE_COUNT = 65;
+	AnimationClip clip;
+	MakeMixedTrackClip(&clip, BONE_COUNT, 60, 21);
+
+	CompressedAnimationClip compressed;
+	TEST_CHECK(compressed.Initialize(clip, AnimationCompressionSettings()));
+
+	std::vector<BYTE> data(3, 0xcd);
+	compressed.Serialize(&data);
+
+	CompressedAnimationClip loaded;
+	TEST_CHECK(loaded.Deserialize(data.data() + 3, data.size() - 3));
+	TEST_CHECK(loaded.GetSampleCount() == compressed.GetSampleCount());
+	TEST_CHECK(loaded.GetMaxRotationError() == compressed.GetMaxRotationError());
+
+	std::vector<Vector3> positions(BONE_COUNT);
+	std::vector<Quaternion> rotations(BONE_COUNT);
+	std::vector<Vector3> scales(BONE_COUNT);
+	std::vector<Vector3> loadedPositions(BONE_COUNT);
+	std::vector<Quaternion> loadedRotations(BONE_COUNT);
+	std::vector<Vector3> loadedScales(BONE_COUNT);
+	for (float time = 0.0f; time < 60.0f; time += 0.37f)
+	{
+		compressed.SamplePose(time, positions.data(), rotations.data(), scales.data());
+		loaded.SamplePose(time, loadedPositions.data(), loadedRotations.data(), loadedScales.data());
+		TEST_CHECK(!memcmp(positions.data(), loadedPositions.data(), sizeof(Vector3) * BONE_COUNT));
+		TEST_CHECK(!memcmp(rotations.data(), loadedRotations.data(), sizeof(Quaternion) * BONE_COUNT));
+		TEST_CHECK(!memcmp(scales.data(), loadedScales.data(), sizeof(Vector3) * BONE_COUNT));
+	}
+
+	TEST_CHECK(!loaded.Deserialize(data.data() + 3, data.size() - 4));
+	TEST_CHECK(!loaded.IsValid());
+	data.push_back(0);
+	TEST_CHECK(!loaded.Deserialize(data.data() + 3, data.size() - 3));
+	TEST_CHECK(!loaded.Deserialize(data.data(), 8));
+	return 0;
+}
+
+int main()
+{
+	if (TestErrorBounds() || TestReject() || TestSerialize())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("CompressedAnimationClipTest passed\n");
+	return 0;
+}
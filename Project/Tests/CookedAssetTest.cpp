@@ -0,0 +1,343 @@
+#include "../pch.h"
+#include "../Model/CookedAsset.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// WriteCookedAsset -> CookedAsset::Open պ   źθ TestFileApi.h(mmap) Ȯ.
+// - պ: mesh, LOD index, texture ̸, skeleton, clip(, ), root motion ״.  AnimationData pose bit  .
+// - ź: hash, magic, , ũⰡ ٸų ߸ ,  ,  .
+// - ջ: record  byte ϳ ٲ㵵 crash  źϰų  ȿ .
+
+static const WCHAR* pszCOOKED_PATH = L"CookedAssetTest.cooked";
+static const WCHAR* pszCORRUPT_PATH = L"CookedAssetTest.corrupt.cooked";
+static const UINT64 CONTENT_HASH = 0x0123456789ABCDEFULL;
+static const UINT CORRUPT_BYTE_COUNT = 2048; // header, mesh/animation/clip record  .
+
+static bool WriteTestFile(const WCHAR* pszPath, const std::vector<BYTE>& DATA)
+{
+	FILE* pFile = fopen(ConvertTestPathToUTF8(pszPath).c_str(), "wb");
+	if (!pFile)
+	{
+		return false;
+	}
+	const bool bWRITTEN = (DATA.empty() || fwrite(DATA.data(), 1, DATA.size(), pFile) == DATA.size());
+	fclose(pFile);
+	return bWRITTEN;
+}
+
+static bool ReadTestFile(const WCHAR* pszPath, std::vector<BYTE>* pOutData)
+{
+	FILE* pFile = fopen(ConvertTestPathToUTF8(pszPath).c_str(), "rb");
+	if (!pFile)
+	{
+		return false;
+	}
+	fseek(pFile, 0, SEEK_END);
+	pOutData->resize((UINT64)ftell(pFile));
+	fseek(pFile, 0, SEEK_SET);
+	const bool bREAD = (fread(pOutData->data(), 1, pOutData->size(), pFile) == pOutData->size());
+	fclose(pFile);
+	return bREAD;
+}
+
+// skinned mesh 2(ϳ LOD 2ܰ), static mesh 1,  mesh 1.
+static void MakeTestMeshes(std::vector<MeshInfo>* pOutMeshes)
+{
+	UINT seed = 3;
+	pOutMeshes->clear();
+	pOutMeshes->resize(4);
+
+	const UINT pSKINNED_VERTEX_COUNTS[2] = { 2400, 900 };
+	for (UINT m = 0; m < 2; ++m)
+	{
+		MeshInfo& mesh = (*pOutMeshes)[m];
+		mesh.SkinnedVertices.resize(pSKINNED_VERTEX_COUNTS[m]);
+		for (SkinnedVertex& vertex : mesh.SkinnedVertices)
+		{
+			vertex.Position = Vector3(NextAnimationRandomFloat(&seed, -1.0f, 1.0f), NextAnimationRandomFloat(&seed, -1.0f, 1.0f), NextAnimationRandomFloat(&seed, -1.0f, 1.0f));
+			vertex.Normal = Vector3(0.0f, 1.0f, 0.0f);
+			vertex.Texcoord = Vector2(NextAnimationRandomFloat(&seed, 0.0f, 1.0f), NextAnimationRandomFloat(&seed, 0.0f, 1.0f));
+			vertex.Tangent = Vector3(1.0f, 0.0f, 0.0f);
+			for (UINT i = 0; i < 8; ++i)
+			{
+				vertex.BlendWeights[i] = NextAnimationRandomFloat(&seed, 0.0f, 1.0f);
+				vertex.BoneIndices[i] = (UCHAR)(NextAnimationRandom(&seed) % HUMANOID_BONE_COUNT);
+			}
+		}
+		mesh.Indices.resize(pSKINNED_VERTEX_COUNTS[m] * 3);
+		for (UINT& index : mesh.Indices)
+		{
+			index = NextAnimationRandom(&seed) % pSKINNED_VERTEX_COUNTS[m];
+		}
+		mesh.szAlbedoTextureFileName = L"./Assets/Remy_Body_Diffuse_" + std::to_wstring(m) + L".png";
+		mesh.szNormalTextureFileName = L"./Assets/\uB178\uBA40.png" /*  */;
+	}
+	(*pOutMeshes)[0].LODIndices.resize(2);
+	(*pOutMeshes)[0].LODIndices[0].assign((*pOutMeshes)[0].Indices.begin(), (*pOutMeshes)[0].Indices.begin() + 3600);
+	(*pOutMeshes)[0].LODIndices[1].assign((*pOutMeshes)[0].Indices.begin(), (*pOutMeshes)[0].Indices.begin() + 900);
+
+	MeshInfo& staticMesh = (*pOutMeshes)[2];
+	staticMesh.Vertices.resize(100);
+	for (Vertex& vertex : staticMesh.Vertices)
+	{
+		vertex.Position = Vector3(NextAnimationRandomFloat(&seed, -1.0f, 1.0f));
+	}
+	staticMesh.Indices = { 0, 1, 2, 2, 1, 3 };
+	staticMesh.szOpacityTextureFileName = L"opacity.dds";
+}
+
+//  clip 2,   clip 1(PrepareClips  bPrepared ǥ).
+static void MakeTestAnimationData(AnimationData* pOutAnimData)
+{
+	InitHumanoidAnimationData(pOutAnimData, 3, 31, 41);
+	pOutAnimData->NormalizingScale = 1.0f / 90.0f;
+	pOutAnimData->LODBoneIDs = { 0, 1, 2, 3, 4, 5, 7, 8, 9 };
+	for (UINT clipID = 0; clipID < 3; ++clipID)
+	{
+		AnimationClip& clip = pOutAnimData->Clips[clipID];
+		clip.Name = "Clip" + std::to_string(clipID) + ".fbx";
+		clip.IKRotations.assign(HUMANOID_BONE_COUNT, Quaternion());
+	}
+	pOutAnimData->Clips[2].bPrepared = true;
+	pOutAnimData->PrepareClips();
+}
+
+static int CheckMeshes(const std::vector<MeshInfo>& EXPECTED, const std::vector<MeshInfo>& LOADED)
+{
+	TEST_CHECK(EXPECTED.size() == LOADED.size());
+	for (UINT64 i = 0; i < EXPECTED.size(); ++i)
+	{
+		const MeshInfo& A = EXPECTED[i];
+		const MeshInfo& B = LOADED[i];
+		TEST_CHECK(A.Vertices.size() == B.Vertices.size() && A.SkinnedVertices.size() == B.SkinnedVertices.size());
+		TEST_CHECK(A.Vertices.empty() || memcmp(A.Vertices.data(), B.Vertices.data(), A.Vertices.size() * sizeof(Vertex)) == 0);
+		TEST_CHECK(A.SkinnedVertices.empty() || memcmp(A.SkinnedVertices.data(), B.SkinnedVertices.data(), A.SkinnedVertices.size() * sizeof(SkinnedVertex)) == 0);
+		TEST_CHECK(A.Indices == B.Indices);
+		TEST_CHECK(A.LODIndices == B.LODIndices);
+		TEST_CHECK(A.szAlbedoTextureFileName == B.szAlbedoTextureFileName && A.szNormalTextureFileName == B.szNormalTextureFileName);
+		TEST_CHECK(A.szOpacityTextureFileName == B.szOpacityTextureFileName && A.szEmissiveTextureFileName == B.szEmissiveTextureFileName);
+	}
+	return 0;
+}
+
+static int CheckAnimationData(const AnimationData& EXPECTED, const AnimationData& LOADED)
+{
+	const UINT64 BONE_COUNT = EXPECTED.BoneIDToNames.size();
+	TEST_CHECK(EXPECTED.BoneIDToNames == LOADED.BoneIDToNames && EXPECTED.BoneNameToID == LOADED.BoneNameToID);
+	TEST_CHECK(EXPECTED.BoneParents == LOADED.BoneParents && EXPECTED.LODBoneIDs == LOADED.LODBoneIDs);
+	TEST_CHECK(memcmp(EXPECTED.OffsetMatrices.data(), LOADED.OffsetMatrices.data(), BONE_COUNT * sizeof(Matrix)) == 0);
+	TEST_CHECK(memcmp(EXPECTED.InverseOffsetMatrices.data(), LOADED.InverseOffsetMatrices.data(), BONE_COUNT * sizeof(Matrix)) == 0);
+	TEST_CHECK(memcmp(EXPECTED.NodeTransforms.data(), LOADED.NodeTransforms.data(), BONE_COUNT * sizeof(Matrix)) == 0);
+	TEST_CHECK(EXPECTED.DefaultTransform == LOADED.DefaultTransform && EXPECTED.InverseDefaultTransform == LOADED.InverseDefaultTransform);
+	TEST_CHECK(EXPECTED.NormalizingScale == LOADED.NormalizingScale && LOADED.BoneTransforms.size() == BONE_COUNT);
+
+	TEST_CHECK(EXPECTED.Clips.size() == LOADED.Clips.size());
+	for (UINT64 clipID = 0; clipID < EXPECTED.Clips.size(); ++clipID)
+	{
+		const AnimationClip& A = EXPECTED.Clips[clipID];
+		const AnimationClip& B = LOADED.Clips[clipID];
+		TEST_CHECK(A.Name == B.Name && A.NumChannels == B.NumChannels && A.Duration == B.Duration && A.TicksPerSec == B.TicksPerSec);
+		TEST_CHECK(B.bPrepared);
+		TEST_CHECK(A.Keys.size() == B.Keys.size());
+		for (UINT64 boneID = 0; boneID < A.Keys.size(); ++boneID)
+		{
+			TEST_CHECK(A.Keys[boneID].size() == B.Keys[boneID].size());
+			TEST_CHECK(A.Keys[boneID].empty() || memcmp(A.Keys[boneID].data(), B.Keys[boneID].data(), A.Keys[boneID].size() * sizeof(AnimationClip::Key)) == 0);
+		}
+		TEST_CHECK(A.IKRotations.size() == B.IKRotations.size());
+		TEST_CHECK(A.RootMotion.DeltaPositions.size() == B.RootMotion.DeltaPositions.size() && A.RootMotion.DeltaYaws == B.RootMotion.DeltaYaws);
+		TEST_CHECK(A.RootMotion.Duration == B.RootMotion.Duration && A.RootMotion.TicksPerSec == B.RootMotion.TicksPerSec);
+
+		TEST_CHECK(A.Compressed.IsValid() == B.Compressed.IsValid());
+		std::vector<BYTE> expectedCompressed;
+		std::vector<BYTE> loadedCompressed;
+		A.Compressed.Serialize(&expectedCompressed);
+		B.Compressed.Serialize(&loadedCompressed);
+		TEST_CHECK(expectedCompressed == loadedCompressed);
+	}
+	return 0;
+}
+
+static int TestRoundTrip()
+{
+	std::vector<MeshInfo> meshes;
+	MakeTestMeshes(&meshes);
+	AnimationData animData;
+	MakeTestAnimationData(&animData);
+	TEST_CHECK(animData.Clips[0].Compressed.IsValid() && !animData.Clips[2].Compressed.IsValid());
+
+	TEST_CHECK(SUCCEEDED(WriteCookedAsset(pszCOOKED_PATH, CONTENT_HASH, meshes, &animData)));
+	// ӽ   .
+	TEST_CHECK(access("CookedAssetTest.cooked.tmp", F_OK) != 0);
+
+	CookedAsset asset;
+	TEST_CHECK(asset.Open(pszCOOKED_PATH, CONTENT_HASH));
+	TEST_CHECK(asset.GetMeshCount() == meshes.size() && asset.HasAnimationData());
+
+	// view map     Ű 16byte .
+	for (UINT i = 0; i < asset.GetMeshCount(); ++i)
+	{
+		const CookedMeshView VIEW = asset.GetMeshView(i);
+		TEST_CHECK(VIEW.VertexCount == meshes[i].Vertices.size() && VIEW.SkinnedVertexCount == meshes[i].SkinnedVertices.size());
+		TEST_CHECK(VIEW.IndexCount == meshes[i].Indices.size() && VIEW.LODCount == 1 + meshes[i].LODIndices.size());
+		TEST_CHECK(VIEW.SkinnedVertexCount == 0 || ((UINT64)VIEW.pSkinnedVertices & 15) == 0);
+		TEST_CHECK(VIEW.VertexCount == 0 || ((UINT64)VIEW.pVertices & 15) == 0);
+		TEST_CHECK(VIEW.IndexCount == 0 || memcmp(VIEW.pIndices, meshes[i].Indices.data(), VIEW.IndexCount * sizeof(UINT)) == 0);
+		for (UINT lod = 1; lod < VIEW.LODCount; ++lod)
+		{
+			TEST_CHECK(VIEW.pLODIndexCounts[lod] == meshes[i].LODIndices[lod - 1].size());
+		}
+	}
+
+	std::vector<MeshInfo> loadedMeshes;
+	asset.ReadMeshInfos(&loadedMeshes);
+	if (CheckMeshes(meshes, loadedMeshes))
+	{
+		return 1;
+	}
+
+	AnimationData loadedAnimData;
+	TEST_CHECK(asset.ReadAnimationData(&loadedAnimData));
+	if (CheckAnimationData(animData, loadedAnimData))
+	{
+		return 1;
+	}
+
+	//  clip  pose  bit  ƾ .
+	loadedAnimData.InitSkinningTransforms();
+	for (int clipID = 0; clipID < 3; ++clipID)
+	{
+		for (UINT frame = 0; frame < 40; ++frame)
+		{
+			animData.Update(clipID, (int)frame, 1.0f / 30.0f);
+			loadedAnimData.Update(clipID, (int)frame, 1.0f / 30.0f);
+			TEST_CHECK(memcmp(animData.BoneTransforms.data(), loadedAnimData.BoneTransforms.data(), HUMANOID_BONE_COUNT * sizeof(Matrix)) == 0);
+		}
+	}
+
+	// animation  asset.
+	asset.Cleanup();
+	TEST_CHECK(!asset.IsOpened());
+	TEST_CHECK(SUCCEEDED(WriteCookedAsset(pszCORRUPT_PATH, CONTENT_HASH, meshes, nullptr)));
+	TEST_CHECK(asset.Open(pszCORRUPT_PATH, CONTENT_HASH));
+	TEST_CHECK(!asset.HasAnimationData() && !asset.ReadAnimationData(&loadedAnimData));
+	return 0;
+}
+
+static int TestReject()
+{
+	std::vector<BYTE> file;
+	TEST_CHECK(ReadTestFile(pszCOOKED_PATH, &file));
+	CookedAsset asset;
+
+	TEST_CHECK(!asset.Open(pszCOOKED_PATH, CONTENT_HASH ^ 1));
+	TEST_CHECK(!asset.IsOpened());
+	TEST_CHECK(!asset.Open(L"CookedAssetTest.missing.cooked", CONTENT_HASH));
+
+	// ߸ , header  ,  , ڿ byte  .
+	const UINT64 pSIZES[] = { file.size() - 100, 16, 0, file.size() + 1 };
+	for (UINT64 size : pSIZES)
+	{
+		std::vector<BYTE> resized(file);
+		resized.resize(size, 0);
+		TEST_CHECK(WriteTestFile(pszCORRUPT_PATH, resized));
+		TEST_CHECK(!asset.Open(pszCORRUPT_PATH, CONTENT_HASH));
+	}
+
+	// magic, .
+	for (UINT64 offset = 0; offset < 8; offset += 4)
+	{
+		std::vector<BYTE> corrupted(file);
+		corrupted[offset] ^= 1;
+		TEST_CHECK(WriteTestFile(pszCORRUPT_PATH, corrupted));
+		TEST_CHECK(!asset.Open(pszCORRUPT_PATH, CONTENT_HASH));
+	}
+
+	//  Open ڿ ٽ   .
+	TEST_CHECK(asset.Open(pszCOOKED_PATH, CONTENT_HASH));
+	return 0;
+}
+
+// record  byte  ٲ  .   о     ( crash).
+static int TestCorruption()
+{
+	std::vector<BYTE> file;
+	TEST_CHECK(ReadTestFile(pszCOOKED_PATH, &file));
+	TEST_CHECK(file.size() > CORRUPT_BYTE_COUNT);
+
+	UINT rejectedCount = 0;
+	UINT acceptedCount = 0;
+	for (UINT offset = 0; offset < CORRUPT_BYTE_COUNT; ++offset)
+	{
+		const BYTE ORIGINAL = file[offset];
+		file[offset] = ORIGINAL ^ 0x5A;
+		TEST_CHECK(WriteTestFile(pszCORRUPT_PATH, file));
+		file[offset] = ORIGINAL;
+
+		CookedAsset asset;
+		if (!asset.Open(pszCORRUPT_PATH, CONTENT_HASH))
+		{
+			++rejectedCount;
+			continue;
+		}
+		++acceptedCount;
+
+		for (UINT i = 0; i < asset.GetMeshCount(); ++i)
+		{
+			asset.GetMeshView(i);
+		}
+		std::vector<MeshInfo> meshes;
+		asset.ReadMeshInfos(&meshes);
+		AnimationData animData;
+		asset.ReadAnimationData(&animData);
+	}
+	// offset,  ִ byte κ źεǾ .
+	TEST_CHECK(rejectedCount > CORRUPT_BYTE_COUNT / 4);
+	printf("corrupted %u bytes: %u rejected, %u accepted and read in range\n", CORRUPT_BYTE_COUNT, rejectedCount, acceptedCount);
+	return 0;
+}
+
+//   , ̸ , option ٲ hash ٲ.   0.
+static int TestSourceHash()
+{
+	std::vector<BYTE> source(100000);
+	UINT seed = 5;
+	for (BYTE& value : source)
+	{
+		value = (BYTE)NextAnimationRandom(&seed);
+	}
+	TEST_CHECK(WriteTestFile(L"CookedAssetTest.source0.bin", source));
+	source.resize(12345);
+	TEST_CHECK(WriteTestFile(L"CookedAssetTest.source1.bin", source));
+
+	const std::vector<std::wstring> NAMES = { L"CookedAssetTest.source0.bin", L"CookedAssetTest.source1.bin" };
+	const UINT64 HASH = HashCookedAssetSources(L"./", NAMES, 0);
+	TEST_CHECK(HASH != 0);
+	TEST_CHECK(HashCookedAssetSources(L"./", NAMES, 0) == HASH);
+	TEST_CHECK(HashCookedAssetSources(L"./", { NAMES[1], NAMES[0] }, 0) != HASH);
+	TEST_CHECK(HashCookedAssetSources(L"./", NAMES, 1) != HASH);
+	TEST_CHECK(HashCookedAssetSources(L"./", { L"CookedAssetTest.missing.bin" }, 0) == 0);
+
+	source[777] ^= 1;
+	TEST_CHECK(WriteTestFile(L"CookedAssetTest.source1.bin", source));
+	TEST_CHECK(HashCookedAssetSources(L"./", NAMES, 0) != HASH);
+
+	DeleteFileW(L"CookedAssetTest.source0.bin");
+	DeleteFileW(L"CookedAssetTest.source1.bin");
+	return 0;
+}
+
+int main()
+{
+	const int RESULT = (TestRoundTrip() || TestReject() || TestCorruption() || TestSourceHash());
+	DeleteFileW(pszCOOKED_PATH);
+	DeleteFileW(pszCORRUPT_PATH);
+	if (RESULT)
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("CookedAssetTest passed\n");
+	return 0;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// FrustumCuller/SceneBVH ׽Ʈ scalar    .
+// İ   FrustumCuller::CullRange  ؼ  bit  ƾ .
+
+#include "../Graphics/FrustumCuller.h"
+
+struct CullingBounds
+{
+	Vector3 Center;
+	float Radius;
+	Vector3 Extents;
+};
+
+inline bool IsInsideFrustumScalar(const CullingBounds& BOUNDS, const Frustum& FRUSTUM)
+{
+	for (UINT p = 0; p < FRUSTUM_PLANE_COUNT; ++p)
+	{
+		const Vector4& PLANE = FRUSTUM.Planes[p];
+		float distance = (PLANE.x * BOUNDS.Center.x + PLANE.y * BOUNDS.Center.y) + (PLANE.z * BOUNDS.Center.z + PLANE.w);
+		float boxRadius = (fabsf(PLANE.x) * BOUNDS.Extents.x + fabsf(PLANE.y) * BOUNDS.Extents.y) + fabsf(PLANE.z) * BOUNDS.Extents.z;
+		if (!(distance >= -BOUNDS.Radius) || !(distance + boxRadius >= 0.0f))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+inline UINT CullScalar(const CullingBounds* pBOUNDS, UINT count, const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility)
+{
+	UINT visibleCount = 0;
+	for (UINT i = 0; i < count; ++i)
+	{
+		BYTE bVisible = 0;
+		for (UINT f = 0; f < frustumCount && !bVisible; ++f)
+		{
+			bVisible = (IsInsideFrustumScalar(pBOUNDS[i], pFRUSTUMS[f]) ? 1 : 0);
+		}
+		pOutVisibility[i] = bVisible;
+		visibleCount += bVisible;
+	}
+	return visibleCount;
+}
+
+// LH  (Camera  D3D clip z [0, w]). yaw  view ؼ ȯ.
+inline Matrix MakeViewProjection(const Vector3& EYE, float yaw, float fovY, float aspect, float nearZ, float farZ)
+{
+	const Matrix VIEW = Matrix::CreateTranslation(-EYE) * Matrix::CreateRotationY(-yaw);
+
+	const float Y_SCALE = 1.0f / tanf(fovY * 0.5f);
+	Matrix projection(Y_SCALE / aspect, 0.0f, 0.0f, 0.0f,
+					  0.0f, Y_SCALE, 0.0f, 0.0f,
+					  0.0f, 0.0f, farZ / (farZ - nearZ), 1.0f,
+					  0.0f, 0.0f, -nearZ * farZ / (farZ - nearZ), 0.0f);
+	return VIEW * projection;
+}
+
+inline UINT NextCullingRandom(UINT* pSeed)
+{
+	*pSeed = *pSeed * 1664525 + 1013904223;
+	return (*pSeed >> 8);
+}
+
+inline float NextCullingRandomFloat(UINT* pSeed, float minValue, float maxValue)
+{
+	return minValue + (maxValue - minValue) * (float)(NextCullingRandom(pSeed) & 0xffff) / 65535.0f;
+}
+
+// worldSize ũ ü ȿ  bounds. extents sphere ȿ  radius .
+inline void MakeRandomBounds(CullingBounds* pOutBounds, UINT count, float worldSize, UINT seed)
+{
+	for (UINT i = 0; i < count; ++i)
+	{
+		CullingBounds& bounds = pOutBounds[i];
+		bounds.Center = Vector3(NextCullingRandomFloat(&seed, -worldSize, worldSize), NextCullingRandomFloat(&seed, -worldSize * 0.1f, worldSize * 0.1f), NextCullingRandomFloat(&seed, -worldSize, worldSize));
+		bounds.Radius = NextCullingRandomFloat(&seed, 0.2f, 5.0f);
+		const float MAX_EXTENT = bounds.Radius * 0.57735f;
+		bounds.Extents = Vector3(NextCullingRandomFloat(&seed, 0.05f, MAX_EXTENT), NextCullingRandomFloat(&seed, 0.05f, MAX_EXTENT), NextCullingRandomFloat(&seed, 0.05f, MAX_EXTENT));
+	}
+}
@@ -0,0 +1,235 @@
+#include "../pch.h"
+#include "../Renderer/DescriptorTableRetireQueue.h"
+#include "TestCommon.h"
+#include <vector>
+
+// Free frame fence    table ٽ ҴǸ  .
+static int TestFreeWaitsForFence()
+{
+	const UINT MAX_TABLE_COUNT = 4;
+	IndexCreator tableIndexCreator;
+	tableIndexCreator.Initialize(MAX_TABLE_COUNT);
+	DescriptorTableRetireQueue retireQueue;
+	retireQueue.Initialize(MAX_TABLE_COUNT);
+
+	ULONG pTables[MAX_TABLE_COUNT];
+	for (UINT i = 0; i < MAX_TABLE_COUNT; ++i)
+	{
+		TEST_CHECK(tableIndexCreator.Alloc(&pTables[i]));
+	}
+
+	retireQueue.Push(pTables[1]);
+
+	//  frame  ʾǷ fence   ȯ .
+	retireQueue.Retire(0xffffffffffffffffull, &tableIndexCreator);
+	TEST_CHECK(retireQueue.GetPendingCount() == 1);
+	TEST_CHECK(tableIndexCreator.GetAllocatedCount() == MAX_TABLE_COUNT);
+
+	retireQueue.FinishFrame(5);
+	retireQueue.Retire(4, &tableIndexCreator);
+	TEST_CHECK(retireQueue.GetPendingCount() == 1);
+	TEST_CHECK(tableIndexCreator.GetAllocatedCount() == MAX_TABLE_COUNT);
+
+	retireQueue.Retire(5, &tableIndexCreator);
+	TEST_CHECK(retireQueue.GetPendingCount() == 0);
+	TEST_CHECK(tableIndexCreator.GetAllocatedCount() == MAX_TABLE_COUNT - 1);
+
+	ULONG index;
+	TEST_CHECK(tableIndexCreator.Alloc(&index) && index == pTables[1]);
+
+	for (UINT i = 0; i < MAX_TABLE_COUNT; ++i)
+	{
+		tableIndexCreator.Free(pTables[i]);
+	}
+	return 0;
+}
+
+// FinishFrame Ŀ Free table  fence ƴ϶  FinishFrame fence ٸ.
+static int TestFreeAfterFinishFrame()
+{
+	const UINT MAX_TABLE_COUNT = 8;
+	IndexCreator tableIndexCreator;
+	tableIndexCreator.Initialize(MAX_TABLE_COUNT);
+	DescriptorTableRetireQueue retireQueue;
+	retireQueue.Initialize(MAX_TABLE_COUNT);
+
+	ULONG pTables[MAX_TABLE_COUNT];
+	for (UINT i = 0; i < MAX_TABLE_COUNT; ++i)
+	{
+		TEST_CHECK(tableIndexCreator.Alloc(&pTables[i]));
+	}
+
+	retireQueue.Push(pTables[0]);
+	retireQueue.Push(pTables[1]);
+	retireQueue.FinishFrame(1);
+	retireQueue.Push(pTables[2]);
+
+	// ̹  ׸ ٽ FinishFrame ҷ fence ٲ .
+	retireQueue.FinishFrame(2);
+	retireQueue.Push(pTables[3]);
+
+	retireQueue.Retire(1, &tableIndexCreator);
+	TEST_CHECK(retireQueue.GetPendingCount() == 2);
+	TEST_CHECK(tableIndexCreator.GetAllocatedCount() == MAX_TABLE_COUNT - 2);
+
+	// pTables[3] frame  ʾǷ .
+	retireQueue.Retire(2, &tableIndexCreator);
+	TEST_CHECK(retireQueue.GetPendingCount() == 1);
+	TEST_CHECK(tableIndexCreator.GetAllocatedCount() == MAX_TABLE_COUNT - 3);
+
+	retireQueue.FinishFrame(3);
+	retireQueue.Retire(3, &tableIndexCreator);
+	TEST_CHECK(retireQueue.GetPendingCount() == 0);
+
+	// Free  free-list տ ̹Ƿ  ȯ ͺ ٽ .
+	ULONG index;
+	TEST_CHECK(tableIndexCreator.Alloc(&index) && index == pTables[3]);
+	TEST_CHECK(tableIndexCreator.Alloc(&index) && index == pTables[2]);
+
+	for (UINT i = 0; i < MAX_TABLE_COUNT; ++i)
+	{
+		if (i != 0 && i != 1)
+		{
+			tableIndexCreator.Free(pTables[i]);
+		}
+	}
+	return 0;
+}
+
+//  table Freeص ring ġ ʾƾ ϰ,   Ƶ  Ǿ .
+static int TestFullRing()
+{
+	const UINT MAX_TABLE_COUNT = 5;
+	IndexCreator tableIndexCreator;
+	tableIndexCreator.Initialize(MAX_TABLE_COUNT);
+	DescriptorTableRetireQueue retireQueue;
+	retireQueue.Initialize(MAX_TABLE_COUNT);
+
+	UINT64 fenceValue = 0;
+	for (UINT round = 0; round < 7; ++round)
+	{
+		ULONG pTables[MAX_TABLE_COUNT];
+		for (UINT i = 0; i < MAX_TABLE_COUNT; ++i)
+		{
+			TEST_CHECK(tableIndexCreator.Alloc(&pTables[i]));
+		}
+		ULONG index;
+		TEST_CHECK(!tableIndexCreator.Alloc(&index));
+
+		//  frame 2 Free.
+		for (UINT i = 0; i < MAX_TABLE_COUNT; ++i)
+		{
+			retireQueue.Push(pTables[i]);
+			if (i % 2 == 1)
+			{
+				retireQueue.FinishFrame(++fenceValue);
+			}
+		}
+		retireQueue.FinishFrame(++fenceValue);
+		TEST_CHECK(retireQueue.GetPendingCount() == MAX_TABLE_COUNT);
+
+		const UINT64 LAST_FENCE = fenceValue;
+		retireQueue.Retire(LAST_FENCE - 2, &tableIndexCreator);
+		TEST_CHECK(tableIndexCreator.GetAllocatedCount() == MAX_TABLE_COUNT - 2);
+		retireQueue.Retire(LAST_FENCE - 1, &tableIndexCreator);
+		TEST_CHECK(tableIndexCreator.GetAllocatedCount() == MAX_TABLE_COUNT - 4);
+		retireQueue.Retire(LAST_FENCE, &tableIndexCreator);
+		TEST_CHECK(tableIndexCreator.GetAllocatedCount() == 0);
+		TEST_CHECK(retireQueue.GetPendingCount() == 0);
+	}
+	return 0;
+}
+
+// Rendereró CPU GPU  frame ռ  Ȳ. ȯ table ݵ  fence  ̾ .
+static int TestRandomFrames()
+{
+	const UINT MAX_TABLE_COUNT = 64;
+	const UINT64 PENDING_FENCE = 0xffffffffffffffffull;
+
+	UINT seed = 17;
+	for (UINT trial = 0; trial < 50; ++trial)
+	{
+		IndexCreator tableIndexCreator;
+		tableIndexCreator.Initialize(MAX_TABLE_COUNT);
+		DescriptorTableRetireQueue retireQueue;
+		retireQueue.Initialize(MAX_TABLE_COUNT);
+
+		// table  Free frame fence.   0.
+		std::vector<UINT64> freeFences(MAX_TABLE_COUNT, 0);
+		std::vector<ULONG> liveTables;
+
+		UINT64 fenceValue = 0;
+		UINT64 completedFenceValue = 0;
+		for (UINT frame = 0; frame < 2000; ++frame)
+		{
+			seed = seed * 1664525 + 1013904223;
+			const UINT OPERATION_COUNT = (seed >> 8) % 8;
+			for (UINT i = 0; i < OPERATION_COUNT; ++i)
+			{
+				seed = seed * 1664525 + 1013904223;
+				if ((seed >> 8) % 2 == 0)
+				{
+					ULONG index;
+					if (tableIndexCreator.Alloc(&index))
+					{
+						// GPU   table ٽ   .
+						TEST_CHECK(freeFences[index] != PENDING_FENCE && freeFences[index] <= completedFenceValue);
+						freeFences[index] = 0;
+						liveTables.push_back(index);
+					}
+				}
+				else if (!liveTables.empty())
+				{
+					const UINT LIVE_INDEX = (seed >> 12) % (UINT)liveTables.size();
+					const ULONG TABLE_INDEX = liveTables[LIVE_INDEX];
+					liveTables[LIVE_INDEX] = liveTables.back();
+					liveTables.pop_back();
+
+					freeFences[TABLE_INDEX] = PENDING_FENCE;
+					retireQueue.Push(TABLE_INDEX);
+				}
+			}
+
+			// Renderer::Render  FinishFrame/Retire . GPU 0~3 frame .
+			++fenceValue;
+			for (UINT64& freeFence : freeFences)
+			{
+				if (freeFence == PENDING_FENCE)
+				{
+					freeFence = fenceValue;
+				}
+			}
+			retireQueue.FinishFrame(fenceValue);
+
+			seed = seed * 1664525 + 1013904223;
+			const UINT64 GPU_LAG = (seed >> 8) % 4;
+			if (fenceValue > GPU_LAG && fenceValue - GPU_LAG > completedFenceValue)
+			{
+				completedFenceValue = fenceValue - GPU_LAG;
+			}
+			retireQueue.Retire(completedFenceValue, &tableIndexCreator);
+
+			TEST_CHECK(tableIndexCreator.GetAllocatedCount() == liveTables.size() + retireQueue.GetPendingCount());
+		}
+
+		for (ULONG index : liveTables)
+		{
+			tableIndexCreator.Free(index);
+		}
+		retireQueue.RetireAll(&tableIndexCreator);
+		TEST_CHECK(tableIndexCreator.GetAllocatedCount() == 0);
+		tableIndexCreator.Check();
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestFreeWaitsForFence() || TestFreeAfterFinishFrame() || TestFullRing() || TestRandomFrames())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("DescriptorTableRetireQueueTest passed\n");
+	return 0;
+}
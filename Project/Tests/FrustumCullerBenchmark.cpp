@@ -0,0 +1,72 @@
+#include "../pch.h"
+#include "../Graphics/FrustumCuller.h"
+#include "CullingReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// 100k ü SoA + SSE(FrustumCuller) AoS scalar  cullingؼ .
+// camera ϳ point light cube 6  .
+
+static double MeasureSIMD(FrustumCuller* pCuller, const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility, UINT repeatCount, UINT* pOutVisibleCount)
+{
+	TestTimer timer;
+	for (UINT i = 0; i < repeatCount; ++i)
+	{
+		*pOutVisibleCount = pCuller->Cull(pFRUSTUMS, frustumCount, pOutVisibility);
+	}
+	return timer.GetElapsedMS() / repeatCount;
+}
+
+static double MeasureScalar(const CullingBounds* pBOUNDS, UINT objectCount, const Frustum* pFRUSTUMS, UINT frustumCount, BYTE* pOutVisibility, UINT repeatCount, UINT* pOutVisibleCount)
+{
+	TestTimer timer;
+	for (UINT i = 0; i < repeatCount; ++i)
+	{
+		*pOutVisibleCount = CullScalar(pBOUNDS, objectCount, pFRUSTUMS, frustumCount, pOutVisibility);
+	}
+	return timer.GetElapsedMS() / repeatCount;
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT OBJECT_COUNT = (bSmoke ? 1000 : 100000);
+	const UINT REPEAT_COUNT = (bSmoke ? 2 : 200);
+
+	std::vector<CullingBounds> bounds(OBJECT_COUNT);
+	MakeRandomBounds(bounds.data(), OBJECT_COUNT, 200.0f, 12345);
+
+	FrustumCuller culler;
+	culler.Initialize(OBJECT_COUNT);
+	for (const CullingBounds& BOUNDS : bounds)
+	{
+		culler.AddBounds(BOUNDS.Center, BOUNDS.Radius, BOUNDS.Extents);
+	}
+
+	Frustum pFrustums[MAX_CULLING_FRUSTUM_COUNT];
+	for (UINT f = 0; f < MAX_CULLING_FRUSTUM_COUNT; ++f)
+	{
+		ExtractFrustumPlanes(MakeViewProjection(Vector3(0.0f, 1.0f, 0.0f), DirectX::XM_PIDIV2 * f, DirectX::XM_PIDIV2, 1.0f, 0.1f, 60.0f), &pFrustums[f]);
+	}
+
+	std::vector<BYTE> visibility(OBJECT_COUNT);
+	printf("%u objects\n", OBJECT_COUNT);
+
+	const UINT pFrustumCounts[] = { 1, MAX_CULLING_FRUSTUM_COUNT };
+	for (UINT frustumCount : pFrustumCounts)
+	{
+		UINT simdVisibleCount = 0;
+		UINT scalarVisibleCount = 0;
+		double simdMS = MeasureSIMD(&culler, pFrustums, frustumCount, visibility.data(), REPEAT_COUNT, &simdVisibleCount);
+		double scalarMS = MeasureScalar(bounds.data(), OBJECT_COUNT, pFrustums, frustumCount, visibility.data(), REPEAT_COUNT, &scalarVisibleCount);
+		TEST_CHECK(simdVisibleCount == scalarVisibleCount);
+
+		printf("frustums %u  visible %6u  SoA SSE %7.3f ms (%5.2f ns/object)   AoS scalar %7.3f ms (%5.2f ns/object)   %4.2fx\n",
+			   frustumCount, simdVisibleCount,
+			   simdMS, simdMS * 1e6 / OBJECT_COUNT,
+			   scalarMS, scalarMS * 1e6 / OBJECT_COUNT,
+			   scalarMS / simdMS);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
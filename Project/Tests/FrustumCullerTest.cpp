@@ -0,0 +1,97 @@
+#include "../pch.h"
+#include "../Graphics/FrustumCuller.h"
+#include "CullingReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// LH  , view  . ˷ ġ bounds  Ȯ.
+static int TestKnownCases()
+{
+	Frustum frustum;
+	ExtractFrustumPlanes(MakeViewProjection(Vector3(0.0f), 0.0f, DirectX::XM_PIDIV2, 1.0f, 1.0f, 100.0f), &frustum);
+
+	FrustumCuller culler;
+	culler.Initialize(6);
+	culler.AddBounds(Vector3(0.0f, 0.0f, 10.0f), 1.0f, Vector3(0.5f)); // .
+	culler.AddBounds(Vector3(0.0f, 0.0f, -10.0f), 1.0f, Vector3(0.5f)); // .
+	culler.AddBounds(Vector3(12.0f, 0.0f, 10.0f), 1.0f, Vector3(0.5f)); //  .
+	culler.AddBounds(Vector3(10.5f, 0.0f, 10.0f), 1.0f, Vector3(0.5f)); //  鿡 ħ.
+	culler.AddBounds(Vector3(0.0f, 0.0f, 150.0f), 1.0f, Vector3(0.5f)); // far .
+
+	BYTE pVisibility[8];
+	TEST_CHECK(culler.Cull(&frustum, 1, pVisibility) == 2);
+	TEST_CHECK(pVisibility[0] == 1 && pVisibility[1] == 0 && pVisibility[2] == 0 && pVisibility[3] == 1 && pVisibility[4] == 0);
+
+	// frustum    .
+	TEST_CHECK(culler.Cull(&frustum, 0, pVisibility) == 0);
+	TEST_CHECK(pVisibility[0] == 0 && pVisibility[3] == 0);
+	return 0;
+}
+
+//  鿡 SSE  scalar   bit  ƾ . 4  ƴ  .
+static int TestMatchesScalar()
+{
+	const UINT OBJECT_COUNT = 100003;
+
+	std::vector<CullingBounds> bounds(OBJECT_COUNT);
+	MakeRandomBounds(bounds.data(), OBJECT_COUNT, 200.0f, 12345);
+
+	FrustumCuller culler;
+	culler.Initialize(OBJECT_COUNT);
+	for (const CullingBounds& BOUNDS : bounds)
+	{
+		culler.AddBounds(BOUNDS.Center, BOUNDS.Radius, BOUNDS.Extents);
+	}
+
+	// point light cube mapó 6 frustum.
+	Frustum pFrustums[MAX_CULLING_FRUSTUM_COUNT];
+	for (UINT f = 0; f < MAX_CULLING_FRUSTUM_COUNT; ++f)
+	{
+		ExtractFrustumPlanes(MakeViewProjection(Vector3(3.0f * f, 1.0f, -2.0f * f), 0.7f * f, DirectX::XM_PIDIV2 * 0.8f, 1.6f, 0.1f, 150.0f), &pFrustums[f]);
+	}
+
+	std::vector<BYTE> simdVisibility(OBJECT_COUNT, 0xcd);
+	std::vector<BYTE> scalarVisibility(OBJECT_COUNT, 0xcd);
+	const UINT pFrustumCounts[] = { 1, 2, MAX_CULLING_FRUSTUM_COUNT };
+	for (UINT frustumCount : pFrustumCounts)
+	{
+		UINT simdCount = culler.Cull(pFrustums, frustumCount, simdVisibility.data());
+		UINT scalarCount = CullScalar(bounds.data(), OBJECT_COUNT, pFrustums, frustumCount, scalarVisibility.data());
+		TEST_CHECK(simdCount == scalarCount);
+		TEST_CHECK(simdCount > 0 && simdCount < OBJECT_COUNT);
+		TEST_CHECK(simdVisibility == scalarVisibility);
+	}
+
+	// CullRange   ǵ帮 ʾƾ .
+	UINT seed = 777;
+	for (UINT i = 0; i < 200; ++i)
+	{
+		UINT start = NextCullingRandom(&seed) % OBJECT_COUNT;
+		UINT count = NextCullingRandom(&seed) % (OBJECT_COUNT - start + 1);
+		std::fill(simdVisibility.begin(), simdVisibility.end(), 0xcd);
+
+		UINT rangeCount = culler.CullRange(start, count, pFrustums, 1, simdVisibility.data());
+		UINT scalarCount = CullScalar(bounds.data() + start, count, pFrustums, 1, scalarVisibility.data());
+		TEST_CHECK(rangeCount == scalarCount);
+		TEST_CHECK(!memcmp(simdVisibility.data() + start, scalarVisibility.data(), count));
+		for (UINT k = 0; k < OBJECT_COUNT; ++k)
+		{
+			if (k < start || k >= start + count)
+			{
+				TEST_CHECK(simdVisibility[k] == 0xcd);
+			}
+		}
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestKnownCases() || TestMatchesScalar())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("FrustumCullerTest passed\n");
+	return 0;
+}
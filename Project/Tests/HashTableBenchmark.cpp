@@ -0,0 +1,149 @@
+#include "../pch.h"
+#include "../Util/HashTable.h"
+#include "ChainedHashTableReference.h"
+#include "TestCommon.h"
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ؽó  100k Insert/Select(hit, miss)/Delete+Insert  .
+//  ٲٱ  chained HashTable(ChainedHashTableReference.h)̰,  (1024 bucket) ʱȭ. std::unordered_map<std::string> Բ ǥ.
+
+static std::vector<std::string> MakePaths(UINT count, UINT seed)
+{
+	static const char* ppDirs[] = { "Assets/Textures/Character/", "Assets/Textures/Environment/Props/", "Assets/Models/Zelda/textures/", "Assets/Textures/Skybox/PBR/" };
+	static const char* ppSuffix[] = { "_albedo.dds", "_normal.dds", "_roughness.dds", "_ao.dds", "_emissive.dds" };
+
+	std::mt19937 rng(seed);
+	std::vector<std::string> paths(count);
+	for (UINT i = 0; i < count; ++i)
+	{
+		std::string path = std::string("C:/Project/") + ppDirs[rng() % 4] + "material_" + std::to_string(i) + ppSuffix[rng() % 5];
+
+		// TextureManager  WCHAR(2byte) θ Ű .
+		std::string wideKey(path.size() * 2, '\0');
+		for (size_t c = 0; c < path.size(); ++c)
+		{
+			wideKey[c * 2] = path[c];
+		}
+		paths[i] = wideKey;
+	}
+	return paths;
+}
+
+// HashTable ChainedHashTable API Ƿ   .
+template <typename Table>
+static int RunTable(const std::vector<std::string>& PATHS, const std::vector<std::string>& MISS_PATHS, double* pOutMS, size_t* pCheckSum)
+{
+	const UINT PATH_NUM = (UINT)PATHS.size();
+
+	Table table;
+	table.Initialize(1024, 1040, 1024);
+	std::vector<void*> searchHandles(PATH_NUM);
+
+	TestTimer timer;
+	for (UINT i = 0; i < PATH_NUM; ++i)
+	{
+		searchHandles[i] = table.Insert((void*)(size_t)(i + 1), PATHS[i].data(), (UINT)PATHS[i].size());
+	}
+	pOutMS[0] += timer.GetElapsedMS();
+
+	timer.Reset();
+	for (UINT i = 0; i < PATH_NUM; ++i)
+	{
+		void* pItem = nullptr;
+		*pCheckSum += table.Select(&pItem, 1, PATHS[i].data(), (UINT)PATHS[i].size());
+		*pCheckSum += (size_t)pItem;
+	}
+	pOutMS[1] += timer.GetElapsedMS();
+
+	timer.Reset();
+	for (UINT i = 0; i < PATH_NUM; ++i)
+	{
+		void* pItem = nullptr;
+		*pCheckSum += table.Select(&pItem, 1, MISS_PATHS[i].data(), (UINT)MISS_PATHS[i].size());
+	}
+	pOutMS[2] += timer.GetElapsedMS();
+
+	timer.Reset();
+	for (UINT i = 0; i < PATH_NUM; ++i)
+	{
+		table.Delete(searchHandles[i]);
+		searchHandles[i] = table.Insert((void*)(size_t)(i + 1), PATHS[i].data(), (UINT)PATHS[i].size());
+	}
+	pOutMS[3] += timer.GetElapsedMS();
+
+	TEST_CHECK(table.GetItemNum() == PATH_NUM);
+	table.DeleteAll();
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	const UINT PATH_NUM = (IsSmokeRun(argc, argv) ? 1000 : 100000);
+	const UINT REPEAT_NUM = (IsSmokeRun(argc, argv) ? 1 : 5);
+
+	std::vector<std::string> paths = MakePaths(PATH_NUM, 1);
+	std::vector<std::string> missPaths = MakePaths(PATH_NUM, 2);
+	for (UINT i = 0; i < PATH_NUM; ++i)
+	{
+		missPaths[i][0] = 'D';
+	}
+
+	double pChainedMS[4] = {};
+	double pTableMS[4] = {};
+	double pMapMS[4] = {};
+	size_t checkSum = 0;
+	for (UINT repeat = 0; repeat < REPEAT_NUM; ++repeat)
+	{
+		if (RunTable<ChainedHashTable>(paths, missPaths, pChainedMS, &checkSum) || RunTable<HashTable>(paths, missPaths, pTableMS, &checkSum))
+		{
+			return 1;
+		}
+
+		std::unordered_map<std::string, void*> map;
+		map.reserve(1024);
+
+		TestTimer timer;
+		for (UINT i = 0; i < PATH_NUM; ++i)
+		{
+			map.emplace(paths[i], (void*)(size_t)(i + 1));
+		}
+		pMapMS[0] += timer.GetElapsedMS();
+
+		timer.Reset();
+		for (UINT i = 0; i < PATH_NUM; ++i)
+		{
+			auto found = map.find(paths[i]);
+			checkSum += (size_t)found->second + 1;
+		}
+		pMapMS[1] += timer.GetElapsedMS();
+
+		timer.Reset();
+		for (UINT i = 0; i < PATH_NUM; ++i)
+		{
+			checkSum += map.count(missPaths[i]);
+		}
+		pMapMS[2] += timer.GetElapsedMS();
+
+		timer.Reset();
+		for (UINT i = 0; i < PATH_NUM; ++i)
+		{
+			map.erase(paths[i]);
+			map.emplace(paths[i], (void*)(size_t)(i + 1));
+		}
+		pMapMS[3] += timer.GetElapsedMS();
+	}
+
+	static const char* ppNames[] = { "insert", "select hit", "select miss", "delete+insert" };
+	const double OP_NUM = (double)PATH_NUM * REPEAT_NUM;
+	printf("%u paths, %u repeats (checksum %zu)\n", PATH_NUM, REPEAT_NUM, checkSum);
+	printf("%-14s %16s %16s %16s\n", "ns/op", "chained(before)", "HashTable", "unordered_map");
+	for (UINT i = 0; i < 4; ++i)
+	{
+		printf("%-14s %16.1f %16.1f %16.1f\n", ppNames[i], pChainedMS[i] * 1e6 / OP_NUM, pTableMS[i] * 1e6 / OP_NUM, pMapMS[i] * 1e6 / OP_NUM);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
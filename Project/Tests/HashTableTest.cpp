@@ -0,0 +1,132 @@
+#include "../pch.h"
+#include "../Util/HashTable.h"
+#include "TestCommon.h"
+#include <map>
+#include <random>
+#include <string>
+
+// std::map  Insert/Select/Delete    .
+static int TestAgainstReference()
+{
+	HashTable table;
+	table.Initialize(64, 1024, 16);
+
+	std::mt19937 rng(1);
+	std::map<std::string, std::pair<void*, size_t>> reference;
+	for (UINT i = 0; i < 200000; ++i)
+	{
+		std::string key = "C:/Assets/Textures/" + std::to_string(rng() % 5000) + (rng() % 2 ? std::string(rng() % 200, 'x') : std::string());
+
+		void* ppItems[4];
+		UINT selectedNum = table.Select(ppItems, 4, key.data(), (UINT)key.size());
+		auto found = reference.find(key);
+		TEST_CHECK((found != reference.end()) == (selectedNum == 1));
+
+		if (found == reference.end())
+		{
+			size_t value = i + 1;
+			void* pSearchHandle = table.Insert((void*)value, key.data(), (UINT)key.size());
+			TEST_CHECK(pSearchHandle);
+			reference[key] = { pSearchHandle, value };
+		}
+		else
+		{
+			TEST_CHECK((size_t)ppItems[0] == found->second.second);
+			if (rng() % 2)
+			{
+				table.Delete(found->second.first);
+				reference.erase(found);
+			}
+		}
+	}
+	TEST_CHECK(table.GetItemNum() == reference.size());
+
+	table.DeleteAll();
+	TEST_CHECK(table.GetItemNum() == 0);
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
+
+static int TestOversizedKey()
+{
+	HashTable table;
+	table.Initialize(16, 64, 16);
+
+	char pKey[65] = {};
+	int debugBreakCount = g_DebugBreakCount;
+	TEST_CHECK(table.Insert((void*)1, pKey, 65) == nullptr);
+	TEST_CHECK(g_DebugBreakCount == debugBreakCount + 1);
+	TEST_CHECK(table.GetItemNum() == 0);
+	g_DebugBreakCount = debugBreakCount;
+
+	TEST_CHECK(table.Insert((void*)1, pKey, 64) != nullptr);
+	table.DeleteAll();
+	return 0;
+}
+
+// ׸ ϳ  ִ   Ű ݺ üص arena  ִ Ű ũ⿡ ؾ .
+static int TestLongKeyReuse()
+{
+	const UINT MAX_KEY_SIZE = 1040;
+
+	HashTable table;
+	table.Initialize(64, MAX_KEY_SIZE, 64);
+
+	std::string pinnedKey(100, 'p');
+	TEST_CHECK(table.Insert((void*)1, pinnedKey.data(), (UINT)pinnedKey.size()));
+
+	std::mt19937 rng(7);
+	void* ppLive[32] = {};
+	std::string pLiveKeys[32];
+	UINT maxArenaSize = 0;
+	for (UINT i = 0; i < 100000; ++i)
+	{
+		UINT slot = rng() % 32;
+		if (ppLive[slot])
+		{
+			table.Delete(ppLive[slot]);
+		}
+
+		//  size class(1024byte ̻) .
+		UINT keySize = HASH_TABLE_INLINE_KEY_SIZE + 1 + rng() % (MAX_KEY_SIZE - HASH_TABLE_INLINE_KEY_SIZE);
+		pLiveKeys[slot] = std::to_string(i);
+		pLiveKeys[slot].resize(keySize, (char)('a' + slot % 26));
+		ppLive[slot] = table.Insert((void*)(size_t)(i + 2), pLiveKeys[slot].data(), keySize);
+		TEST_CHECK(ppLive[slot]);
+
+		if (table.GetKeyArenaSize() > maxArenaSize)
+		{
+			maxArenaSize = table.GetKeyArenaSize();
+		}
+	}
+
+	//   100000 Ű  arena ׿  MB .
+	const UINT MAX_LIVE_KEY_SIZE = 33 * (MAX_KEY_SIZE + HASH_TABLE_KEY_ARENA_ALIGN);
+	printf("long key arena: max %u bytes, live bound %u bytes\n", maxArenaSize, MAX_LIVE_KEY_SIZE);
+	TEST_CHECK(maxArenaSize <= 4 * MAX_LIVE_KEY_SIZE + 2 * HASH_TABLE_KEY_ARENA_CHUNK_SIZE);
+
+	for (UINT i = 0; i < 32; ++i)
+	{
+		void* pItem = nullptr;
+		TEST_CHECK(table.Select(&pItem, 1, pLiveKeys[i].data(), (UINT)pLiveKeys[i].size()) == 1);
+		table.Delete(ppLive[i]);
+	}
+
+	void* pItem = nullptr;
+	TEST_CHECK(table.Select(&pItem, 1, pinnedKey.data(), (UINT)pinnedKey.size()) == 1);
+	TEST_CHECK(pItem == (void*)1);
+
+	table.DeleteAll();
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
+
+int main()
+{
+	if (TestAgainstReference() || TestOversizedKey() || TestLongKeyReuse())
+	{
+		return 1;
+	}
+	printf("HashTableTest passed\n");
+	return 0;
+}
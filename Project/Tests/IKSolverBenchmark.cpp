@@ -0,0 +1,134 @@
+#include "../pch.h"
+#include "../Model/IKSolver.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// solver Ȯ ó.
+// Ȯ:   ִ  target tolerance  , /ִ (chain  ),  ݺ .
+// ó: ĳ N x ȴٸ 4 SolveIKTasks  . ٸó Ʒ  chain   target.
+
+static const char* GetSolverName(eIKSolverType solverType)
+{
+	switch (solverType)
+	{
+		case IKSolverType_TwoBone:
+			return "two-bone";
+		case IKSolverType_FABRIK:
+			return "FABRIK";
+		case IKSolverType_DLS:
+			return "DLS";
+		default:
+			return "?";
+	}
+}
+
+static UINT GetLimbJointCount(eIKSolverType solverType)
+{
+	return (solverType == IKSolverType_TwoBone ? 3 : 4);
+}
+
+// Ʒ  limb. target chain  60~95% Ÿ, ü Ʒ.
+static float MakeLimb(IKChainTask* pTask, eIKSolverType solverType, UINT* pSeed)
+{
+	const UINT JOINT_COUNT = GetLimbJointCount(solverType);
+	pTask->JointCount = JOINT_COUNT;
+	pTask->SolverType = solverType;
+	pTask->MinBend = 0.0f;
+	pTask->MaxBend = DirectX::XM_PI;
+
+	float chainLength = 0.0f;
+	pTask->Positions[0] = Vector3(NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), 1.0f, NextAnimationRandomFloat(pSeed, -1.0f, 1.0f));
+	for (UINT i = 1; i < JOINT_COUNT; ++i)
+	{
+		Vector3 dir(NextAnimationRandomFloat(pSeed, -0.3f, 0.3f), -1.0f, NextAnimationRandomFloat(pSeed, -0.3f, 0.3f));
+		dir.Normalize();
+		pTask->Positions[i] = pTask->Positions[i - 1] + dir * 0.5f;
+		chainLength += 0.5f;
+	}
+	pTask->Pole = pTask->Positions[1] + Vector3(0.0f, 0.0f, 1.0f);
+
+	Vector3 toTarget(NextAnimationRandomFloat(pSeed, -0.5f, 0.5f), -1.0f, NextAnimationRandomFloat(pSeed, -0.5f, 0.5f));
+	toTarget.Normalize();
+	pTask->Target = pTask->Positions[0] + toTarget * chainLength * NextAnimationRandomFloat(pSeed, 0.6f, 0.95f);
+	return chainLength;
+}
+
+static void MeasureAccuracy(eIKSolverType solverType, UINT trialCount)
+{
+	const IKSolverSettings SETTINGS;
+	UINT seed = 101;
+
+	std::vector<IKChainTask> tasks(trialCount);
+	std::vector<float> chainLengths(trialCount);
+	for (UINT i = 0; i < trialCount; ++i)
+	{
+		chainLengths[i] = MakeLimb(&tasks[i], solverType, &seed);
+	}
+	SolveIKTasks(tasks.data(), trialCount, SETTINGS);
+
+	UINT reachedCount = 0;
+	double errorSum = 0.0;
+	float maxError = 0.0f;
+	double iterationSum = 0.0;
+	for (UINT i = 0; i < trialCount; ++i)
+	{
+		const float RELATIVE_ERROR = tasks[i].Error / chainLengths[i];
+		reachedCount += (RELATIVE_ERROR <= SETTINGS.Tolerance * 1.001f ? 1 : 0);
+		errorSum += RELATIVE_ERROR;
+		maxError = fmaxf(maxError, RELATIVE_ERROR);
+		iterationSum += tasks[i].IterationCount;
+	}
+	printf("%-8s %u joints  reached %6u/%6u  mean error %.2e  max error %.2e  mean iterations %5.2f\n",
+		   GetSolverName(solverType), GetLimbJointCount(solverType), reachedCount, trialCount, errorSum / trialCount, maxError, iterationSum / trialCount);
+}
+
+static void MeasureThroughput(eIKSolverType solverType, UINT characterCount, UINT repeatCount)
+{
+	const IKSolverSettings SETTINGS;
+	const UINT TASK_COUNT = characterCount * 4;
+	UINT seed = 7;
+
+	std::vector<IKChainTask> sourceTasks(TASK_COUNT);
+	for (IKChainTask& task : sourceTasks)
+	{
+		MakeLimb(&task, solverType, &seed);
+	}
+	std::vector<IKChainTask> tasks(TASK_COUNT);
+
+	// Ź  ڼ ٽ Ǯ .  ð    ȸ .
+	double bestMS = 1e30;
+	for (UINT r = 0; r < repeatCount; ++r)
+	{
+		tasks = sourceTasks;
+		TestTimer timer;
+		SolveIKTasks(tasks.data(), TASK_COUNT, SETTINGS);
+		const double ELAPSED_MS = timer.GetElapsedMS();
+		bestMS = (ELAPSED_MS < bestMS ? ELAPSED_MS : bestMS);
+	}
+	printf("%-8s %5u characters x 4 limbs  %8.3f ms  %6.3f us/limb\n", GetSolverName(solverType), characterCount, bestMS, bestMS * 1000.0 / TASK_COUNT);
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT TRIAL_COUNT = (bSmoke ? 100 : 100000);
+	const UINT REPEAT_COUNT = (bSmoke ? 1 : 10);
+
+	const eIKSolverType pSolverTypes[] = { IKSolverType_TwoBone, IKSolverType_FABRIK, IKSolverType_DLS };
+	for (eIKSolverType solverType : pSolverTypes)
+	{
+		MeasureAccuracy(solverType, TRIAL_COUNT);
+	}
+
+	const UINT pCharacterCounts[] = { 100, 1000 };
+	for (UINT characterCount : pCharacterCounts)
+	{
+		for (eIKSolverType solverType : pSolverTypes)
+		{
+			MeasureThroughput(solverType, (bSmoke ? characterCount / 10 : characterCount), REPEAT_COUNT);
+		}
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,204 @@
+#include "../pch.h"
+#include "../Model/IKSolver.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+
+//  chain target  solver Ȯ  ϰ Ȯ.
+// -  target tolerance(chain  )   .
+// - root ,  ̴ ״, Error end effector target Ÿ.
+// - Deltas[i]   i  Ǯ   i Ǿ (ApplyIKTask ϴ ).
+
+static const UINT TRIAL_COUNT = 5000;
+static const float SHAPE_EPSILON = 1e-4f; // chain  .
+
+struct IKAccuracyStats
+{
+	UINT ReachedCount;
+	UINT TrialCount;
+	float MaxError;
+};
+
+static Vector3 RandomDirection(UINT* pSeed)
+{
+	Vector3 dir;
+	do
+	{
+		dir = Vector3(NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f));
+	} while (dir.LengthSquared() < 0.01f || dir.LengthSquared() > 1.0f);
+	dir.Normalize();
+	return dir;
+}
+
+//   0.3~1,  ִ 90 . target root chain  MIN_REACH~MAX_REACH Ÿ.
+static float MakeRandomChain(IKChainTask* pTask, UINT jointCount, eIKSolverType solverType, float minReach, float maxReach, UINT* pSeed)
+{
+	pTask->JointCount = jointCount;
+	pTask->SolverType = solverType;
+	pTask->MinBend = 0.0f;
+	pTask->MaxBend = DirectX::XM_PI;
+
+	Vector3 dir = RandomDirection(pSeed);
+	pTask->Positions[0] = Vector3(NextAnimationRandomFloat(pSeed, -5.0f, 5.0f), NextAnimationRandomFloat(pSeed, 0.0f, 2.0f), NextAnimationRandomFloat(pSeed, -5.0f, 5.0f));
+	float chainLength = 0.0f;
+	for (UINT i = 1; i < jointCount; ++i)
+	{
+		const float LENGTH = NextAnimationRandomFloat(pSeed, 0.3f, 1.0f);
+		pTask->Positions[i] = pTask->Positions[i - 1] + dir * LENGTH;
+		chainLength += LENGTH;
+		dir = Vector3::Transform(dir, MakeRandomRotation(pSeed, DirectX::XM_PIDIV2));
+	}
+	pTask->Pole = pTask->Positions[1] + RandomDirection(pSeed) * 0.5f;
+	pTask->Target = pTask->Positions[0] + RandomDirection(pSeed) * chainLength * NextAnimationRandomFloat(pSeed, minReach, maxReach);
+	return chainLength;
+}
+
+static int CheckChainShape(const IKChainTask& ORIGINAL, const IKChainTask& SOLVED, float chainLength)
+{
+	const float EPSILON = SHAPE_EPSILON * chainLength;
+	TEST_CHECK((SOLVED.Positions[0] - ORIGINAL.Positions[0]).Length() <= EPSILON);
+
+	const UINT LAST = SOLVED.JointCount - 1;
+	TEST_CHECK(fabsf(SOLVED.Error - (SOLVED.Positions[LAST] - SOLVED.Target).Length()) <= EPSILON);
+
+	for (UINT i = 0; i < LAST; ++i)
+	{
+		const Vector3 ORIGINAL_SEGMENT = ORIGINAL.Positions[i + 1] - ORIGINAL.Positions[i];
+		const Vector3 SOLVED_SEGMENT = SOLVED.Positions[i + 1] - SOLVED.Positions[i];
+		TEST_CHECK(fabsf(ORIGINAL_SEGMENT.Length() - SOLVED_SEGMENT.Length()) <= EPSILON);
+		TEST_CHECK((Vector3::Transform(ORIGINAL_SEGMENT, SOLVED.Deltas[i]) - SOLVED_SEGMENT).Length() <= EPSILON);
+	}
+	// end effector   ȸ ״ .
+	TEST_CHECK(memcmp(&SOLVED.Deltas[LAST], &SOLVED.Deltas[LAST - 1], sizeof(Quaternion)) == 0);
+	return 0;
+}
+
+static int RunReachableTrials(eIKSolverType solverType, UINT minJointCount, UINT maxJointCount, IKAccuracyStats* pOutStats)
+{
+	const IKSolverSettings SETTINGS;
+	UINT seed = 17 + (UINT)solverType;
+
+	pOutStats->ReachedCount = 0;
+	pOutStats->TrialCount = 0;
+	pOutStats->MaxError = 0.0f;
+	for (UINT trial = 0; trial < TRIAL_COUNT; ++trial)
+	{
+		const UINT JOINT_COUNT = minJointCount + trial % (maxJointCount - minJointCount + 1);
+		IKChainTask task;
+		const float CHAIN_LENGTH = MakeRandomChain(&task, JOINT_COUNT, solverType, 0.1f, 0.9f, &seed);
+
+		//     պ  root ó(2 *    - chain  )   .
+		float longestSegment = 0.0f;
+		for (UINT i = 0; i + 1 < JOINT_COUNT; ++i)
+		{
+			longestSegment = fmaxf(longestSegment, (task.Positions[i + 1] - task.Positions[i]).Length());
+		}
+		if ((task.Target - task.Positions[0]).Length() <= (2.0f * longestSegment - CHAIN_LENGTH) + 0.01f * CHAIN_LENGTH)
+		{
+			continue;
+		}
+
+		const IKChainTask ORIGINAL = task;
+		SolveIKTasks(&task, 1, SETTINGS);
+		if (CheckChainShape(ORIGINAL, task, CHAIN_LENGTH))
+		{
+			fprintf(stderr, "solver %d, trial %u, %u joints\n", (int)solverType, trial, JOINT_COUNT);
+			return 1;
+		}
+
+		// Ǯ  ־ ʾƾ .
+		TEST_CHECK(task.Error <= (ORIGINAL.Target - ORIGINAL.Positions[JOINT_COUNT - 1]).Length() + SHAPE_EPSILON * CHAIN_LENGTH);
+
+		const float RELATIVE_ERROR = task.Error / CHAIN_LENGTH;
+		++pOutStats->TrialCount;
+		pOutStats->ReachedCount += (RELATIVE_ERROR <= SETTINGS.Tolerance * 1.001f ? 1 : 0);
+		pOutStats->MaxError = fmaxf(pOutStats->MaxError, RELATIVE_ERROR);
+	}
+	return 0;
+}
+
+static int TestReachable()
+{
+	IKAccuracyStats stats;
+
+	// two-bone ؼ̹Ƿ  ƾ .
+	if (RunReachableTrials(IKSolverType_TwoBone, 3, 3, &stats))
+	{
+		return 1;
+	}
+	TEST_CHECK(stats.ReachedCount == stats.TrialCount);
+	TEST_CHECK(stats.MaxError <= IKSolverSettings().Tolerance * 1.001f);
+
+	// FABRIK( ϸ DLS ٽ ǯ).
+	if (RunReachableTrials(IKSolverType_FABRIK, 3, MAX_IK_CHAIN_JOINT, &stats))
+	{
+		return 1;
+	}
+	TEST_CHECK(stats.ReachedCount * 1000 >= stats.TrialCount * 995);
+
+	// DLS ܵ.    chain root   ϴ target Ư ڼ 32 ȿ  ⵵ .
+	if (RunReachableTrials(IKSolverType_DLS, 3, MAX_IK_CHAIN_JOINT, &stats))
+	{
+		return 1;
+	}
+	TEST_CHECK(stats.ReachedCount * 1000 >= stats.TrialCount * 995);
+	TEST_CHECK(stats.MaxError <= 0.5f);
+	return 0;
+}
+
+//  ʴ target target  . Error (target Ÿ - chain ).
+static int TestUnreachable()
+{
+	const IKSolverSettings SETTINGS;
+	UINT seed = 23;
+	for (UINT trial = 0; trial < 500; ++trial)
+	{
+		const eIKSolverType SOLVER_TYPE = (trial & 1 ? IKSolverType_TwoBone : IKSolverType_FABRIK);
+		IKChainTask task;
+		const float CHAIN_LENGTH = MakeRandomChain(&task, (SOLVER_TYPE == IKSolverType_TwoBone ? 3 : 2 + trial % (MAX_IK_CHAIN_JOINT - 1)), SOLVER_TYPE, 1.05f, 3.0f, &seed);
+
+		const IKChainTask ORIGINAL = task;
+		SolveIKTasks(&task, 1, SETTINGS);
+		if (CheckChainShape(ORIGINAL, task, CHAIN_LENGTH))
+		{
+			return 1;
+		}
+
+		const Vector3 TO_TARGET = task.Target - task.Positions[0];
+		TEST_CHECK(fabsf(task.Error - (TO_TARGET.Length() - CHAIN_LENGTH)) <= SHAPE_EPSILON * CHAIN_LENGTH);
+		const Vector3 TO_END = task.Positions[task.JointCount - 1] - task.Positions[0];
+		TEST_CHECK(fabsf(TO_END.Length() - CHAIN_LENGTH) <= SHAPE_EPSILON * CHAIN_LENGTH);
+	}
+	return 0;
+}
+
+// two-bone mid    [MinBend, MaxBend] .
+static int TestTwoBoneBendLimit()
+{
+	const IKSolverSettings SETTINGS;
+	UINT seed = 29;
+	for (UINT trial = 0; trial < 1000; ++trial)
+	{
+		IKChainTask task;
+		MakeRandomChain(&task, 3, IKSolverType_TwoBone, 0.05f, 1.0f, &seed);
+		task.MinBend = NextAnimationRandomFloat(&seed, 0.0f, 0.5f);
+		task.MaxBend = NextAnimationRandomFloat(&seed, 1.0f, 2.5f);
+		SolveIKTasks(&task, 1, SETTINGS);
+
+		const Vector3 UPPER = task.Positions[1] - task.Positions[0];
+		const Vector3 LOWER = task.Positions[2] - task.Positions[1];
+		const float BEND = acosf(fmaxf(-1.0f, fminf(1.0f, UPPER.Dot(LOWER) / (UPPER.Length() * LOWER.Length()))));
+		TEST_CHECK(BEND >= task.MinBend - 1e-3f && BEND <= task.MaxBend + 1e-3f);
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestReachable() || TestUnreachable() || TestTwoBoneBendLimit())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("IKSolverTest passed\n");
+	return 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+// HEADLESS_TEST  DirectXMath PackedVector κ .
+// ׽Ʈϴ   half ȯ . ó   ¦ ݿø.
+
+#include <stdint.h>
+#include <string.h>
+
+namespace DirectX
+{
+	namespace PackedVector
+	{
+		typedef uint16_t HALF;
+
+		inline HALF XMConvertFloatToHalf(float value)
+		{
+			const uint32_t F32_INFINITY = 255u << 23;
+			const uint32_t F16_MAX = (127u + 16u) << 23;			   //  ̻ half Ѵ.
+			const uint32_t DENORM_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+			uint32_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			const uint32_t SIGN = bits & 0x80000000u;
+			bits ^= SIGN;
+
+			uint32_t result;
+			if (bits >= F16_MAX)
+			{
+				result = (bits > F32_INFINITY ? 0x7E00u : 0x7C00u);
+			}
+			else if (bits < (113u << 23))
+			{
+				// half  . ؼ ݿø FPU ñ.
+				float magic;
+				memcpy(&magic, &DENORM_MAGIC, sizeof(magic));
+				float shifted;
+				memcpy(&shifted, &bits, sizeof(shifted));
+				shifted += magic;
+				memcpy(&result, &shifted, sizeof(result));
+				result -= DENORM_MAGIC;
+			}
+			else
+			{
+				const uint32_t MANTISSA_ODD = (bits >> 13) & 1u;
+				bits += ((uint32_t)(15 - 127) << 23) + 0xFFFu;
+				bits += MANTISSA_ODD;
+				result = bits >> 13;
+			}
+			return (HALF)(result | (SIGN >> 16));
+		}
+
+		inline float XMConvertHalfToFloat(HALF value)
+		{
+			const uint32_t SIGN = (uint32_t)(value & 0x8000u) << 16;
+			const uint32_t EXPONENT = (value >> 10) & 0x1Fu;
+			const uint32_t MANTISSA = value & 0x3FFu;
+
+			float result;
+			if (EXPONENT == 0)
+			{
+				result = (float)MANTISSA * (1.0f / 16777216.0f); // 2^-24
+				return (SIGN ? -result : result);
+			}
+
+			const uint32_t BITS = SIGN | (EXPONENT == 31 ? (0xFFu << 23) : ((EXPONENT + 112u) << 23)) | (MANTISSA << 13);
+			memcpy(&result, &BITS, sizeof(result));
+			return result;
+		}
+	}
+}
@@ -0,0 +1,444 @@
+#pragma once
+
+// HEADLESS_TEST  DirectXTK SimpleMath κ .
+// ׽Ʈϴ   ͸ . Ծ  (row-vector, v * M).
+
+#include <math.h>
+#include <string.h>
+
+namespace DirectX
+{
+	const float XM_PI = 3.141592654f;
+	const float XM_2PI = 6.283185307f;
+	const float XM_PIDIV2 = 1.570796327f;
+
+	namespace SimpleMath
+	{
+		struct Matrix;
+		struct Quaternion;
+
+		struct Vector2
+		{
+			float x;
+			float y;
+
+			Vector2() : x(0.0f), y(0.0f) { }
+			explicit Vector2(float value) : x(value), y(value) { }
+			Vector2(float _x, float _y) : x(_x), y(_y) { }
+		};
+
+		struct Vector3
+		{
+			float x;
+			float y;
+			float z;
+
+			Vector3() : x(0.0f), y(0.0f), z(0.0f) { }
+			explicit Vector3(float value) : x(value), y(value), z(value) { }
+			Vector3(float _x, float _y, float _z) : x(_x), y(_y), z(_z) { }
+
+			inline Vector3 operator-() const { return Vector3(-x, -y, -z); }
+			inline Vector3 operator+(const Vector3& V) const { return Vector3(x + V.x, y + V.y, z + V.z); }
+			inline Vector3 operator-(const Vector3& V) const { return Vector3(x - V.x, y - V.y, z - V.z); }
+			inline Vector3 operator*(const Vector3& V) const { return Vector3(x * V.x, y * V.y, z * V.z); }
+			inline Vector3 operator*(float s) const { return Vector3(x * s, y * s, z * s); }
+			inline Vector3 operator/(float s) const { return Vector3(x / s, y / s, z / s); }
+			inline Vector3& operator+=(const Vector3& V) { x += V.x; y += V.y; z += V.z; return *this; }
+			inline Vector3& operator-=(const Vector3& V) { x -= V.x; y -= V.y; z -= V.z; return *this; }
+			inline Vector3& operator*=(float s) { x *= s; y *= s; z *= s; return *this; }
+			inline Vector3& operator/=(float s) { x /= s; y /= s; z /= s; return *this; }
+			inline bool operator==(const Vector3& V) const { return (x == V.x && y == V.y && z == V.z); }
+			inline bool operator!=(const Vector3& V) const { return !(*this == V); }
+
+			inline float Length() const { return sqrtf(x * x + y * y + z * z); }
+			inline float LengthSquared() const { return x * x + y * y + z * z; }
+			inline float Dot(const Vector3& V) const { return x * V.x + y * V.y + z * V.z; }
+			inline Vector3 Cross(const Vector3& V) const { return Vector3(y * V.z - z * V.y, z * V.x - x * V.z, x * V.y - y * V.x); }
+			inline void Normalize()
+			{
+				float length = Length();
+				if (length > 0.0f)
+				{
+					*this /= length;
+				}
+			}
+			inline void Normalize(Vector3& result) const
+			{
+				result = *this;
+				result.Normalize();
+			}
+
+			static inline float Distance(const Vector3& V1, const Vector3& V2) { return (V2 - V1).Length(); }
+			static inline float DistanceSquared(const Vector3& V1, const Vector3& V2) { return (V2 - V1).LengthSquared(); }
+			static inline Vector3 Min(const Vector3& V1, const Vector3& V2) { return Vector3(fminf(V1.x, V2.x), fminf(V1.y, V2.y), fminf(V1.z, V2.z)); }
+			static inline Vector3 Max(const Vector3& V1, const Vector3& V2) { return Vector3(fmaxf(V1.x, V2.x), fmaxf(V1.y, V2.y), fmaxf(V1.z, V2.z)); }
+			static inline Vector3 Lerp(const Vector3& V1, const Vector3& V2, float t) { return V1 + (V2 - V1) * t; }
+
+			static Vector3 Transform(const Vector3& V, const Matrix& M);
+			static Vector3 Transform(const Vector3& V, const Quaternion& Q);
+			static Vector3 TransformNormal(const Vector3& V, const Matrix& M);
+
+			static const Vector3 Zero;
+			static const Vector3 One;
+			static const Vector3 UnitX;
+			static const Vector3 UnitY;
+			static const Vector3 UnitZ;
+		};
+		inline const Vector3 Vector3::Zero(0.0f, 0.0f, 0.0f);
+		inline const Vector3 Vector3::One(1.0f, 1.0f, 1.0f);
+		inline const Vector3 Vector3::UnitX(1.0f, 0.0f, 0.0f);
+		inline const Vector3 Vector3::UnitY(0.0f, 1.0f, 0.0f);
+		inline const Vector3 Vector3::UnitZ(0.0f, 0.0f, 1.0f);
+
+		inline Vector3 operator*(float s, const Vector3& V) { return V * s; }
+
+		struct Vector4
+		{
+			float x;
+			float y;
+			float z;
+			float w;
+
+			Vector4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) { }
+			Vector4(float _x, float _y, float _z, float _w) : x(_x), y(_y), z(_z), w(_w) { }
+			Vector4(const Vector3& V, float _w) : x(V.x), y(V.y), z(V.z), w(_w) { }
+
+			inline Vector4 operator+(const Vector4& V) const { return Vector4(x + V.x, y + V.y, z + V.z, w + V.w); }
+			inline Vector4 operator-(const Vector4& V) const { return Vector4(x - V.x, y - V.y, z - V.z, w - V.w); }
+			inline Vector4 operator*(float s) const { return Vector4(x * s, y * s, z * s, w * s); }
+			inline Vector4& operator*=(float s) { x *= s; y *= s; z *= s; w *= s; return *this; }
+			inline Vector4& operator/=(float s) { x /= s; y /= s; z /= s; w /= s; return *this; }
+
+			inline float Dot(const Vector4& V) const { return x * V.x + y * V.y + z * V.z + w * V.w; }
+		};
+
+		// Concatenate(q1, q2) q2  q1 ȸ. operator*(q1, q2) q1  q2 ȸ.
+		struct Quaternion
+		{
+			float x;
+			float y;
+			float z;
+			float w;
+
+			Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) { }
+			Quaternion(float _x, float _y, float _z, float _w) : x(_x), y(_y), z(_z), w(_w) { }
+			Quaternion(const Vector3& V, float _w) : x(V.x), y(V.y), z(V.z), w(_w) { }
+
+			inline Quaternion operator-() const { return Quaternion(-x, -y, -z, -w); }
+			inline Quaternion operator+(const Quaternion& Q) const { return Quaternion(x + Q.x, y + Q.y, z + Q.z, w + Q.w); }
+			inline Quaternion operator-(const Quaternion& Q) const { return Quaternion(x - Q.x, y - Q.y, z - Q.z, w - Q.w); }
+			inline Quaternion operator*(float s) const { return Quaternion(x * s, y * s, z * s, w * s); }
+			inline Quaternion operator*(const Quaternion& Q) const { return Concatenate(Q, *this); }
+			inline Quaternion& operator*=(const Quaternion& Q) { *this = *this * Q; return *this; }
+			inline bool operator==(const Quaternion& Q) const { return (x == Q.x && y == Q.y && z == Q.z && w == Q.w); }
+			inline bool operator!=(const Quaternion& Q) const { return !(*this == Q); }
+
+			inline float Length() const { return sqrtf(LengthSquared()); }
+			inline float LengthSquared() const { return x * x + y * y + z * z + w * w; }
+			inline float Dot(const Quaternion& Q) const { return x * Q.x + y * Q.y + z * Q.z + w * Q.w; }
+			inline void Normalize()
+			{
+				float length = Length();
+				if (length > 0.0f)
+				{
+					x /= length;
+					y /= length;
+					z /= length;
+					w /= length;
+				}
+			}
+			inline void Normalize(Quaternion& result) const
+			{
+				result = *this;
+				result.Normalize();
+			}
+			inline void Conjugate() { x = -x; y = -y; z = -z; }
+			inline void Inverse(Quaternion& result) const
+			{
+				float lengthSquare = LengthSquared();
+				result = Quaternion(-x / lengthSquare, -y / lengthSquare, -z / lengthSquare, w / lengthSquare);
+			}
+
+			static inline Quaternion Concatenate(const Quaternion& Q1, const Quaternion& Q2)
+			{
+				return Quaternion(Q1.w * Q2.x + Q1.x * Q2.w + Q1.y * Q2.z - Q1.z * Q2.y,
+								  Q1.w * Q2.y - Q1.x * Q2.z + Q1.y * Q2.w + Q1.z * Q2.x,
+								  Q1.w * Q2.z + Q1.x * Q2.y - Q1.y * Q2.x + Q1.z * Q2.w,
+								  Q1.w * Q2.w - Q1.x * Q2.x - Q1.y * Q2.y - Q1.z * Q2.z);
+			}
+			static inline Quaternion CreateFromAxisAngle(const Vector3& AXIS, float angle)
+			{
+				float sinHalf = sinf(angle * 0.5f);
+				return Quaternion(AXIS.x * sinHalf, AXIS.y * sinHalf, AXIS.z * sinHalf, cosf(angle * 0.5f));
+			}
+			static Quaternion CreateFromRotationMatrix(const Matrix& M);
+			static inline Quaternion Lerp(const Quaternion& Q1, const Quaternion& Q2, float t)
+			{
+				Quaternion result = (Q1.Dot(Q2) >= 0.0f ? Q1 * (1.0f - t) + Q2 * t : Q1 * (1.0f - t) - Q2 * t);
+				result.Normalize();
+				return result;
+			}
+			// XMQuaternionSlerp    ̸  .
+			static inline Quaternion Slerp(const Quaternion& Q1, const Quaternion& Q2, float t)
+			{
+				float cosOmega = Q1.Dot(Q2);
+				float sign = (cosOmega < 0.0f ? -1.0f : 1.0f);
+				cosOmega *= sign;
+
+				float scale0 = 1.0f - t;
+				float scale1 = t;
+				if (1.0f - cosOmega > 1.0e-6f)
+				{
+					float sinOmega = sqrtf(1.0f - cosOmega * cosOmega);
+					float omega = atan2f(sinOmega, cosOmega);
+					scale0 = sinf(scale0 * omega) / sinOmega;
+					scale1 = sinf(scale1 * omega) / sinOmega;
+				}
+				return Q1 * scale0 + Q2 * (scale1 * sign);
+			}
+
+			static const Quaternion Identity;
+		};
+		inline const Quaternion Quaternion::Identity;
+
+		struct Matrix
+		{
+			union
+			{
+				struct
+				{
+					float _11, _12, _13, _14;
+					float _21, _22, _23, _24;
+					float _31, _32, _33, _34;
+					float _41, _42, _43, _44;
+				};
+				float m[4][4];
+			};
+
+			Matrix() : _11(1.0f), _12(0.0f), _13(0.0f), _14(0.0f),
+					   _21(0.0f), _22(1.0f), _23(0.0f), _24(0.0f),
+					   _31(0.0f), _32(0.0f), _33(1.0f), _34(0.0f),
+					   _41(0.0f), _42(0.0f), _43(0.0f), _44(1.0f) { }
+			Matrix(float m00, float m01, float m02, float m03,
+				   float m10, float m11, float m12, float m13,
+				   float m20, float m21, float m22, float m23,
+				   float m30, float m31, float m32, float m33)
+				: _11(m00), _12(m01), _13(m02), _14(m03),
+				  _21(m10), _22(m11), _23(m12), _24(m13),
+				  _31(m20), _32(m21), _33(m22), _34(m23),
+				  _41(m30), _42(m31), _43(m32), _44(m33) { }
+
+			inline Matrix operator*(const Matrix& M) const
+			{
+				Matrix result;
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 4; ++column)
+					{
+						result.m[row][column] = m[row][0] * M.m[0][column] + m[row][1] * M.m[1][column] + m[row][2] * M.m[2][column] + m[row][3] * M.m[3][column];
+					}
+				}
+				return result;
+			}
+			inline Matrix& operator*=(const Matrix& M) { *this = *this * M; return *this; }
+
+			inline bool operator==(const Matrix& M) const { return (memcmp(m, M.m, sizeof(m)) == 0); }
+			inline bool operator!=(const Matrix& M) const { return !(*this == M); }
+
+			inline Vector3 Translation() const { return Vector3(_41, _42, _43); }
+			inline void Translation(const Vector3& V) { _41 = V.x; _42 = V.y; _43 = V.z; }
+
+			inline Matrix Transpose() const
+			{
+				return Matrix(_11, _21, _31, _41,
+							  _12, _22, _32, _42,
+							  _13, _23, _33, _43,
+							  _14, _24, _34, _44);
+			}
+			inline void Transpose(Matrix& result) const { result = Transpose(); }
+
+			inline float Determinant() const
+			{
+				float s0 = _11 * _22 - _21 * _12;
+				float s1 = _11 * _23 - _21 * _13;
+				float s2 = _11 * _24 - _21 * _14;
+				float s3 = _12 * _23 - _22 * _13;
+				float s4 = _12 * _24 - _22 * _14;
+				float s5 = _13 * _24 - _23 * _14;
+				float c5 = _33 * _44 - _43 * _34;
+				float c4 = _32 * _44 - _42 * _34;
+				float c3 = _32 * _43 - _42 * _33;
+				float c2 = _31 * _44 - _41 * _34;
+				float c1 = _31 * _43 - _41 * _33;
+				float c0 = _31 * _42 - _41 * _32;
+				return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+			}
+
+			// μ . Ư ̸  .
+			inline Matrix Invert() const
+			{
+				const float* pM = &m[0][0];
+				float pInv[16];
+				pInv[0] = pM[5] * pM[10] * pM[15] - pM[5] * pM[11] * pM[14] - pM[9] * pM[6] * pM[15] + pM[9] * pM[7] * pM[14] + pM[13] * pM[6] * pM[11] - pM[13] * pM[7] * pM[10];
+				pInv[4] = -pM[4] * pM[10] * pM[15] + pM[4] * pM[11] * pM[14] + pM[8] * pM[6] * pM[15] - pM[8] * pM[7] * pM[14] - pM[12] * pM[6] * pM[11] + pM[12] * pM[7] * pM[10];
+				pInv[8] = pM[4] * pM[9] * pM[15] - pM[4] * pM[11] * pM[13] - pM[8] * pM[5] * pM[15] + pM[8] * pM[7] * pM[13] + pM[12] * pM[5] * pM[11] - pM[12] * pM[7] * pM[9];
+				pInv[12] = -pM[4] * pM[9] * pM[14] + pM[4] * pM[10] * pM[13] + pM[8] * pM[5] * pM[14] - pM[8] * pM[6] * pM[13] - pM[12] * pM[5] * pM[10] + pM[12] * pM[6] * pM[9];
+				pInv[1] = -pM[1] * pM[10] * pM[15] + pM[1] * pM[11] * pM[14] + pM[9] * pM[2] * pM[15] - pM[9] * pM[3] * pM[14] - pM[13] * pM[2] * pM[11] + pM[13] * pM[3] * pM[10];
+				pInv[5] = pM[0] * pM[10] * pM[15] - pM[0] * pM[11] * pM[14] - pM[8] * pM[2] * pM[15] + pM[8] * pM[3] * pM[14] + pM[12] * pM[2] * pM[11] - pM[12] * pM[3] * pM[10];
+				pInv[9] = -pM[0] * pM[9] * pM[15] + pM[0] * pM[11] * pM[13] + pM[8] * pM[1] * pM[15] - pM[8] * pM[3] * pM[13] - pM[12] * pM[1] * pM[11] + pM[12] * pM[3] * pM[9];
+				pInv[13] = pM[0] * pM[9] * pM[14] - pM[0] * pM[10] * pM[13] - pM[8] * pM[1] * pM[14] + pM[8] * pM[2] * pM[13] + pM[12] * pM[1] * pM[10] - pM[12] * pM[2] * pM[9];
+				pInv[2] = pM[1] * pM[6] * pM[15] - pM[1] * pM[7] * pM[14] - pM[5] * pM[2] * pM[15] + pM[5] * pM[3] * pM[14] + pM[13] * pM[2] * pM[7] - pM[13] * pM[3] * pM[6];
+				pInv[6] = -pM[0] * pM[6] * pM[15] + pM[0] * pM[7] * pM[14] + pM[4] * pM[2] * pM[15] - pM[4] * pM[3] * pM[14] - pM[12] * pM[2] * pM[7] + pM[12] * pM[3] * pM[6];
+				pInv[10] = pM[0] * pM[5] * pM[15] - pM[0] * pM[7] * pM[13] - pM[4] * pM[1] * pM[15] + pM[4] * pM[3] * pM[13] + pM[12] * pM[1] * pM[7] - pM[12] * pM[3] * pM[5];
+				pInv[14] = -pM[0] * pM[5] * pM[14] + pM[0] * pM[6] * pM[13] + pM[4] * pM[1] * pM[14] - pM[4] * pM[2] * pM[13] - pM[12] * pM[1] * pM[6] + pM[12] * pM[2] * pM[5];
+				pInv[3] = -pM[1] * pM[6] * pM[11] + pM[1] * pM[7] * pM[10] + pM[5] * pM[2] * pM[11] - pM[5] * pM[3] * pM[10] - pM[9] * pM[2] * pM[7] + pM[9] * pM[3] * pM[6];
+				pInv[7] = pM[0] * pM[6] * pM[11] - pM[0] * pM[7] * pM[10] - pM[4] * pM[2] * pM[11] + pM[4] * pM[3] * pM[10] + pM[8] * pM[2] * pM[7] - pM[8] * pM[3] * pM[6];
+				pInv[11] = -pM[0] * pM[5] * pM[11] + pM[0] * pM[7] * pM[9] + pM[4] * pM[1] * pM[11] - pM[4] * pM[3] * pM[9] - pM[8] * pM[1] * pM[7] + pM[8] * pM[3] * pM[5];
+				pInv[15] = pM[0] * pM[5] * pM[10] - pM[0] * pM[6] * pM[9] - pM[4] * pM[1] * pM[10] + pM[4] * pM[2] * pM[9] + pM[8] * pM[1] * pM[6] - pM[8] * pM[2] * pM[5];
+
+				float determinant = pM[0] * pInv[0] + pM[1] * pInv[4] + pM[2] * pInv[8] + pM[3] * pInv[12];
+				Matrix result;
+				if (determinant == 0.0f)
+				{
+					return result;
+				}
+				for (int i = 0; i < 16; ++i)
+				{
+					(&result.m[0][0])[i] = pInv[i] / determinant;
+				}
+				return result;
+			}
+			inline void Invert(Matrix& result) const { result = Invert(); }
+
+			// scale   .  scale x  .
+			inline bool Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const
+			{
+				translation = Translation();
+				Vector3 pRows[3] = { Vector3(_11, _12, _13), Vector3(_21, _22, _23), Vector3(_31, _32, _33) };
+				scale = Vector3(pRows[0].Length(), pRows[1].Length(), pRows[2].Length());
+				if (scale.x == 0.0f || scale.y == 0.0f || scale.z == 0.0f)
+				{
+					rotation = Quaternion();
+					return false;
+				}
+				if (pRows[0].Dot(pRows[1].Cross(pRows[2])) < 0.0f)
+				{
+					scale.x = -scale.x;
+				}
+				pRows[0] /= scale.x;
+				pRows[1] /= scale.y;
+				pRows[2] /= scale.z;
+
+				Matrix rotationMatrix;
+				rotationMatrix._11 = pRows[0].x; rotationMatrix._12 = pRows[0].y; rotationMatrix._13 = pRows[0].z;
+				rotationMatrix._21 = pRows[1].x; rotationMatrix._22 = pRows[1].y; rotationMatrix._23 = pRows[1].z;
+				rotationMatrix._31 = pRows[2].x; rotationMatrix._32 = pRows[2].y; rotationMatrix._33 = pRows[2].z;
+				rotation = Quaternion::CreateFromRotationMatrix(rotationMatrix);
+				return true;
+			}
+
+			static inline Matrix CreateTranslation(const Vector3& POSITION)
+			{
+				Matrix result;
+				result.Translation(POSITION);
+				return result;
+			}
+			static inline Matrix CreateScale(float scale)
+			{
+				Matrix result;
+				result._11 = scale;
+				result._22 = scale;
+				result._33 = scale;
+				return result;
+			}
+			static inline Matrix CreateScale(const Vector3& SCALES)
+			{
+				Matrix result;
+				result._11 = SCALES.x;
+				result._22 = SCALES.y;
+				result._33 = SCALES.z;
+				return result;
+			}
+			static inline Matrix CreateFromQuaternion(const Quaternion& Q)
+			{
+				Matrix result;
+				result._11 = 1.0f - 2.0f * (Q.y * Q.y + Q.z * Q.z);
+				result._12 = 2.0f * (Q.x * Q.y + Q.z * Q.w);
+				result._13 = 2.0f * (Q.x * Q.z - Q.y * Q.w);
+				result._21 = 2.0f * (Q.x * Q.y - Q.z * Q.w);
+				result._22 = 1.0f - 2.0f * (Q.x * Q.x + Q.z * Q.z);
+				result._23 = 2.0f * (Q.y * Q.z + Q.x * Q.w);
+				result._31 = 2.0f * (Q.x * Q.z + Q.y * Q.w);
+				result._32 = 2.0f * (Q.y * Q.z - Q.x * Q.w);
+				result._33 = 1.0f - 2.0f * (Q.x * Q.x + Q.y * Q.y);
+				return result;
+			}
+			static inline Matrix CreateRotationX(float radians)
+			{
+				Matrix result;
+				float sinAngle = sinf(radians);
+				float cosAngle = cosf(radians);
+				result._22 = cosAngle;
+				result._23 = sinAngle;
+				result._32 = -sinAngle;
+				result._33 = cosAngle;
+				return result;
+			}
+			static inline Matrix CreateRotationY(float radians)
+			{
+				Matrix result;
+				float sinAngle = sinf(radians);
+				float cosAngle = cosf(radians);
+				result._11 = cosAngle;
+				result._13 = -sinAngle;
+				result._31 = sinAngle;
+				result._33 = cosAngle;
+				return result;
+			}
+
+			static const Matrix Identity;
+		};
+		inline const Matrix Matrix::Identity;
+
+		inline Vector3 Vector3::Transform(const Vector3& V, const Matrix& M)
+		{
+			return Vector3(V.x * M._11 + V.y * M._21 + V.z * M._31 + M._41,
+						   V.x * M._12 + V.y * M._22 + V.z * M._32 + M._42,
+						   V.x * M._13 + V.y * M._23 + V.z * M._33 + M._43);
+		}
+		inline Vector3 Vector3::Transform(const Vector3& V, const Quaternion& Q)
+		{
+			Quaternion conjugate(-Q.x, -Q.y, -Q.z, Q.w);
+			Quaternion result = Quaternion::Concatenate(Quaternion::Concatenate(Q, Quaternion(V, 0.0f)), conjugate);
+			return Vector3(result.x, result.y, result.z);
+		}
+		inline Vector3 Vector3::TransformNormal(const Vector3& V, const Matrix& M)
+		{
+			return Vector3(V.x * M._11 + V.y * M._21 + V.z * M._31,
+						   V.x * M._12 + V.y * M._22 + V.z * M._32,
+						   V.x * M._13 + V.y * M._23 + V.z * M._33);
+		}
+	
+		inline Quaternion Quaternion::CreateFromRotationMatrix(const Matrix& M)
+		{
+			float trace = M._11 + M._22 + M._33;
+			if (trace > 0.0f)
+			{
+				float s = 0.5f / sqrtf(trace + 1.0f);
+				return Quaternion((M._23 - M._32) * s, (M._31 - M._13) * s, (M._12 - M._21) * s, 0.25f / s);
+			}
+			if (M._11 > M._22 && M._11 > M._33)
+			{
+				float s = 2.0f * sqrtf(1.0f + M._11 - M._22 - M._33);
+				return Quaternion(0.25f * s, (M._21 + M._12) / s, (M._31 + M._13) / s, (M._23 - M._32) / s);
+			}
+			if (M._22 > M._33)
+			{
+				float s = 2.0f * sqrtf(1.0f + M._22 - M._11 - M._33);
+				return Quaternion((M._21 + M._12) / s, 0.25f * s, (M._32 + M._23) / s, (M._31 - M._13) / s);
+			}
+			float s = 2.0f * sqrtf(1.0f + M._33 - M._11 - M._22);
+			return Quaternion((M._31 + M._13) / s, (M._32 + M._23) / s, 0.25f * s, (M._12 - M._21) / s);
+		}
+	}
+}
@@ -0,0 +1,97 @@
+#include "../pch.h"
+#include "../Util/IndexCreator.h"
+#include "TestCommon.h"
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//   ÷ Alloc/Free  ó .  std::mutex ȣ free list.
+
+class MutexIndexCreator
+{
+public:
+	void Initialize(ULONG num)
+	{
+		m_FreeIndices.resize(num);
+		for (ULONG i = 0; i < num; ++i)
+		{
+			m_FreeIndices[i] = num - 1 - i;
+		}
+	}
+	bool Alloc(ULONG* pOutIndex)
+	{
+		std::lock_guard<std::mutex> lock(m_Lock);
+		if (m_FreeIndices.empty())
+		{
+			return false;
+		}
+		*pOutIndex = m_FreeIndices.back();
+		m_FreeIndices.pop_back();
+		return true;
+	}
+	void Free(ULONG index)
+	{
+		std::lock_guard<std::mutex> lock(m_Lock);
+		m_FreeIndices.push_back(index);
+	}
+
+private:
+	std::mutex m_Lock;
+	std::vector<ULONG> m_FreeIndices;
+};
+
+template <typename T>
+static void AllocFreeWorker(T* pIndexCreator, UINT pairCount)
+{
+	//   4 Ҵٰ  head   list θ Բ ġ .
+	ULONG pIndices[4];
+	for (UINT i = 0; i < pairCount; i += 4)
+	{
+		UINT heldCount = 0;
+		for (UINT k = 0; k < 4; ++k)
+		{
+			if (pIndexCreator->Alloc(pIndices + heldCount))
+			{
+				++heldCount;
+			}
+		}
+		for (UINT k = 0; k < heldCount; ++k)
+		{
+			pIndexCreator->Free(pIndices[k]);
+		}
+	}
+}
+
+template <typename T>
+static double MeasureMopsPerSecond(UINT threadCount, UINT pairCount)
+{
+	T indexCreator;
+	indexCreator.Initialize(1024);
+
+	TestTimer timer;
+	std::vector<std::thread> threads;
+	for (UINT t = 0; t < threadCount; ++t)
+	{
+		threads.emplace_back(AllocFreeWorker<T>, &indexCreator, pairCount);
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	return (double)threadCount * pairCount / (timer.GetElapsedMS() * 1000.0);
+}
+
+int main(int argc, char** argv)
+{
+	const UINT PAIR_COUNT = (IsSmokeRun(argc, argv) ? 10000 : 2000000);
+
+	printf("%u alloc/free pairs per thread, hardware threads %u\n", PAIR_COUNT, std::thread::hardware_concurrency());
+	for (UINT threadCount = 1; threadCount <= 16; threadCount *= 2)
+	{
+		double lockFree = MeasureMopsPerSecond<IndexCreator>(threadCount, PAIR_COUNT);
+		double mutex = MeasureMopsPerSecond<MutexIndexCreator>(threadCount, PAIR_COUNT);
+		printf("threads %2u  IndexCreator %7.2f Mops/s   mutex free list %7.2f Mops/s\n", threadCount, lockFree, mutex);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,128 @@
+#include "../pch.h"
+#include "../Util/IndexCreator.h"
+#include "TestCommon.h"
+#include <thread>
+#include <vector>
+
+static int TestSingleThread()
+{
+	IndexCreator indexCreator;
+	indexCreator.Initialize(100);
+
+	std::vector<bool> bUsed(100, false);
+	for (UINT i = 0; i < 100; ++i)
+	{
+		ULONG index;
+		TEST_CHECK(indexCreator.Alloc(&index));
+		TEST_CHECK(index < 100 && !bUsed[index]);
+		bUsed[index] = true;
+	}
+
+	ULONG index;
+	TEST_CHECK(!indexCreator.Alloc(&index));
+	TEST_CHECK(index == INDEX_CREATOR_INVALID_INDEX);
+	TEST_CHECK(indexCreator.GetAllocatedCount() == 100);
+
+	//   ε free list ǵ帮 ʰ õǾ .
+	int debugBreakCount = g_DebugBreakCount;
+	indexCreator.Free(100);
+	indexCreator.Free(0xfffffffe);
+	TEST_CHECK(g_DebugBreakCount == debugBreakCount + 2);
+	TEST_CHECK(indexCreator.GetAllocatedCount() == 100);
+	TEST_CHECK(!indexCreator.Alloc(&index));
+	g_DebugBreakCount = debugBreakCount;
+
+	for (ULONG i = 0; i < 100; ++i)
+	{
+		indexCreator.Free(i);
+	}
+	TEST_CHECK(indexCreator.GetAllocatedCount() == 0);
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
+
+static void StressWorker(IndexCreator* pIndexCreator, std::atomic<int>* pOwners, std::atomic<bool>* pbDuplicated, UINT seed, UINT operationCount)
+{
+	std::vector<ULONG> heldIndices;
+	for (UINT i = 0; i < operationCount; ++i)
+	{
+		seed = seed * 1664525 + 1013904223;
+
+		ULONG index;
+		if ((seed >> 16) % 3 != 0 && pIndexCreator->Alloc(&index))
+		{
+			if (pOwners[index].fetch_add(1) != 0)
+			{
+				*pbDuplicated = true;
+			}
+			heldIndices.push_back(index);
+		}
+		else if (!heldIndices.empty())
+		{
+			index = heldIndices.back();
+			heldIndices.pop_back();
+			pOwners[index].fetch_sub(1);
+			pIndexCreator->Free(index);
+		}
+	}
+
+	for (ULONG index : heldIndices)
+	{
+		pOwners[index].fetch_sub(1);
+		pIndexCreator->Free(index);
+	}
+}
+
+//  尡 Alloc/Free  ȣ.  ε ÿ   ҴǸ .
+static int TestMultiThreadStress()
+{
+	const UINT THREAD_COUNT = 8;
+	const UINT INDEX_COUNT = 256;
+	const UINT OPERATION_COUNT = 200000;
+
+	IndexCreator indexCreator;
+	indexCreator.Initialize(INDEX_COUNT);
+
+	std::vector<std::atomic<int>> owners(INDEX_COUNT);
+	std::atomic<bool> bDuplicated{ false };
+	std::vector<std::thread> threads;
+	for (UINT t = 0; t < THREAD_COUNT; ++t)
+	{
+		threads.emplace_back(StressWorker, &indexCreator, owners.data(), &bDuplicated, t * 7919 + 1, OPERATION_COUNT);
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	TEST_CHECK(!bDuplicated);
+	TEST_CHECK(indexCreator.GetAllocatedCount() == 0);
+
+	// free list  ʾҴٸ  ε Ȯ   ٽ   .
+	std::vector<bool> bUsed(INDEX_COUNT, false);
+	ULONG index;
+	UINT allocatedCount = 0;
+	while (indexCreator.Alloc(&index))
+	{
+		TEST_CHECK(index < INDEX_COUNT && !bUsed[index]);
+		bUsed[index] = true;
+		++allocatedCount;
+	}
+	TEST_CHECK(allocatedCount == INDEX_COUNT);
+	for (ULONG i = 0; i < INDEX_COUNT; ++i)
+	{
+		indexCreator.Free(i);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
+
+int main()
+{
+	if (TestSingleThread() || TestMultiThreadStress())
+	{
+		return 1;
+	}
+	printf("IndexCreatorTest passed\n");
+	return 0;
+}
@@ -0,0 +1,83 @@
+#include "../pch.h"
+#include "../Util/JobSystem.h"
+#include "TestCommon.h"
+
+// Renderer::endRender  frame worker  1..8  frame ð Ȯ强 .
+// pass RECORD_JOB_COUNT  job ÿ , stage job pass  ̾.
+
+static const UINT RENDER_PASS_COUNT = 3;
+static const UINT RECORD_JOB_COUNT = 32;
+
+static UINT s_WorkIterationCount = 20000;
+static std::atomic<UINT> s_Sink{ 0 };
+
+static void RecordJob(void* pArg, UINT workerIndex)
+{
+	// command list     .
+	UINT value = (UINT)(size_t)pArg;
+	for (UINT i = 0; i < s_WorkIterationCount; ++i)
+	{
+		value = value * 1664525 + 1013904223;
+	}
+	s_Sink.fetch_add(value, std::memory_order_relaxed);
+}
+
+static void SubmitStageJob(void* pArg, UINT workerIndex)
+{
+	// queue  ª  .
+	UINT value = (UINT)(size_t)pArg;
+	for (UINT i = 0; i < s_WorkIterationCount / 10; ++i)
+	{
+		value = value * 1664525 + 1013904223;
+	}
+	s_Sink.fetch_add(value, std::memory_order_relaxed);
+}
+
+static double MeasureFrameMS(UINT workerCount, UINT frameCount)
+{
+	JobCounter pCounters[RENDER_PASS_COUNT + 1];
+	JobSystem jobSystem;
+	jobSystem.Initialize(workerCount - 1, 1024);
+
+	TestTimer timer;
+	for (UINT frame = 0; frame < frameCount; ++frame)
+	{
+		for (UINT i = 0; i < RECORD_JOB_COUNT; ++i)
+		{
+			for (UINT pass = 0; pass < RENDER_PASS_COUNT; ++pass)
+			{
+				jobSystem.Submit(RecordJob, (void*)(size_t)(i + pass), &pCounters[pass]);
+			}
+		}
+		for (UINT pass = 0; pass < RENDER_PASS_COUNT; ++pass)
+		{
+			jobSystem.Submit(SubmitStageJob, (void*)(size_t)pass, &pCounters[pass + 1], &pCounters[pass]);
+		}
+		jobSystem.WaitForCounter(&pCounters[RENDER_PASS_COUNT]);
+	}
+	return timer.GetElapsedMS() / frameCount;
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT FRAME_COUNT = (bSmoke ? 5 : 500);
+	if (bSmoke)
+	{
+		s_WorkIterationCount = 1000;
+	}
+
+	printf("%u passes x %u record jobs per frame, hardware threads %u\n", RENDER_PASS_COUNT, RECORD_JOB_COUNT, std::thread::hardware_concurrency());
+	double baseFrameMS = 0.0;
+	for (UINT workerCount = 1; workerCount <= 8; ++workerCount)
+	{
+		double frameMS = MeasureFrameMS(workerCount, FRAME_COUNT);
+		if (workerCount == 1)
+		{
+			baseFrameMS = frameMS;
+		}
+		printf("workers %u  %7.3f ms/frame  speedup %5.2fx\n", workerCount, frameMS, baseFrameMS / frameMS);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
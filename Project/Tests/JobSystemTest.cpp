@@ -0,0 +1,246 @@
+#include "../pch.h"
+#include "../Util/JobSystem.h"
+#include "TestCommon.h"
+#include <new>
+
+static std::atomic<long> s_FirstCount{ 0 };
+static std::atomic<long> s_SecondCount{ 0 };
+static std::atomic<bool> s_bOrderBroken{ false };
+
+static void FirstJob(void* pArg, UINT workerIndex)
+{
+	volatile UINT sum = 0;
+	for (UINT i = 0; i < 2000; ++i)
+	{
+		sum += i;
+	}
+	s_FirstCount.fetch_add(1);
+}
+
+static void SecondJob(void* pArg, UINT workerIndex)
+{
+	const long FIRST_JOB_COUNT = (long)(size_t)pArg;
+	if (s_FirstCount.load() != FIRST_JOB_COUNT)
+	{
+		s_bOrderBroken = true;
+	}
+	s_SecondCount.fetch_add(1);
+}
+
+// pDependency 0 Ǳ  job  ʾƾ . pool(64)  ־ pool  ε ħ.
+// firstCounter ٸ ʰ  frame .  finishJob  frame  job  Ǯ  .
+static int TestDependency(UINT workerThreadCount)
+{
+	JobCounter firstCounter;
+	JobCounter secondCounter;
+	JobSystem jobSystem;
+	jobSystem.Initialize(workerThreadCount, 64);
+
+	for (UINT frame = 0; frame < 100; ++frame)
+	{
+		s_FirstCount = 0;
+		s_SecondCount = 0;
+
+		for (UINT i = 0; i < 200; ++i)
+		{
+			jobSystem.Submit(FirstJob, nullptr, &firstCounter);
+		}
+		for (UINT i = 0; i < 50; ++i)
+		{
+			jobSystem.Submit(SecondJob, (void*)(size_t)200, &secondCounter, &firstCounter);
+		}
+		jobSystem.WaitForCounter(&secondCounter);
+
+		TEST_CHECK(s_SecondCount.load() == 50);
+		TEST_CHECK(!s_bOrderBroken);
+	}
+	return 0;
+}
+
+// Renderer::endRender  graph. pass  job   ÿ ,
+// stage job ڱ ϷḦ  pass  counter  pass  .
+static const UINT RENDER_PASS_COUNT = 3;
+static const UINT RECORD_JOB_COUNT = 6;
+
+struct RenderGraphFrame
+{
+	std::atomic<UINT> pRecordedCounts[RENDER_PASS_COUNT];
+	std::atomic<UINT> SubmitSequence;
+	UINT pSubmittedPasses[RENDER_PASS_COUNT];
+	UINT pRecordedAtSubmit[RENDER_PASS_COUNT];
+};
+struct RenderGraphJobArg
+{
+	RenderGraphFrame* pFrame;
+	UINT Pass;
+};
+
+static void RecordJob(void* pArg, UINT workerIndex)
+{
+	RenderGraphJobArg* pJobArg = (RenderGraphJobArg*)pArg;
+	volatile UINT sum = 0;
+	for (UINT i = 0; i < 5000; ++i)
+	{
+		sum += i;
+	}
+	pJobArg->pFrame->pRecordedCounts[pJobArg->Pass].fetch_add(1);
+}
+
+static void SubmitStageJob(void* pArg, UINT workerIndex)
+{
+	RenderGraphJobArg* pJobArg = (RenderGraphJobArg*)pArg;
+	RenderGraphFrame* pFrame = pJobArg->pFrame;
+	UINT sequence = pFrame->SubmitSequence.fetch_add(1);
+	pFrame->pSubmittedPasses[sequence] = pJobArg->Pass;
+	pFrame->pRecordedAtSubmit[sequence] = pFrame->pRecordedCounts[pJobArg->Pass].load();
+}
+
+static int TestRenderGraph(UINT workerThreadCount)
+{
+	// counter 0~2: pass , 3:  stage.
+	JobCounter pCounters[RENDER_PASS_COUNT + 1];
+	RenderGraphFrame frame;
+	RenderGraphJobArg pArgs[RENDER_PASS_COUNT] = { { &frame, 0 }, { &frame, 1 }, { &frame, 2 } };
+	JobSystem jobSystem;
+	jobSystem.Initialize(workerThreadCount, 256);
+
+	for (UINT frameIndex = 0; frameIndex < 200; ++frameIndex)
+	{
+		for (UINT pass = 0; pass < RENDER_PASS_COUNT; ++pass)
+		{
+			frame.pRecordedCounts[pass] = 0;
+		}
+		frame.SubmitSequence = 0;
+
+		for (UINT i = 0; i < RECORD_JOB_COUNT; ++i)
+		{
+			for (UINT pass = 0; pass < RENDER_PASS_COUNT; ++pass)
+			{
+				jobSystem.Submit(RecordJob, &pArgs[pass], &pCounters[pass]);
+			}
+		}
+		for (UINT pass = 0; pass < RENDER_PASS_COUNT; ++pass)
+		{
+			jobSystem.Submit(SubmitStageJob, &pArgs[pass], &pCounters[pass + 1], &pCounters[pass]);
+		}
+		jobSystem.WaitForCounter(&pCounters[RENDER_PASS_COUNT]);
+
+		TEST_CHECK(frame.SubmitSequence.load() == RENDER_PASS_COUNT);
+		for (UINT i = 0; i < RENDER_PASS_COUNT; ++i)
+		{
+			TEST_CHECK(frame.pSubmittedPasses[i] == i);
+			TEST_CHECK(frame.pRecordedAtSubmit[i] == RECORD_JOB_COUNT);
+		}
+	}
+	return 0;
+}
+
+// WaitForCounter ȯϸ counter ٷ   ־ .  counter ڸ Ἥ
+// finishJob  ڿ counter ǵ帮 lock̳    .
+static int TestCounterLifetime(UINT workerThreadCount)
+{
+	JobSystem jobSystem;
+	jobSystem.Initialize(workerThreadCount, 64);
+
+	alignas(JobCounter) BYTE pFirstStorage[sizeof(JobCounter)];
+	alignas(JobCounter) BYTE pSecondStorage[sizeof(JobCounter)];
+	for (UINT frame = 0; frame < 2000; ++frame)
+	{
+		JobCounter* pFirstCounter = new (pFirstStorage) JobCounter;
+		JobCounter* pSecondCounter = new (pSecondStorage) JobCounter;
+		s_FirstCount = 0;
+		s_SecondCount = 0;
+
+		const UINT FIRST_JOB_COUNT = 1 + frame % 8;
+		for (UINT i = 0; i < FIRST_JOB_COUNT; ++i)
+		{
+			jobSystem.Submit(FirstJob, nullptr, pFirstCounter);
+		}
+		jobSystem.Submit(SecondJob, (void*)(size_t)FIRST_JOB_COUNT, pSecondCounter, pFirstCounter);
+		jobSystem.WaitForCounter(pSecondCounter);
+
+		TEST_CHECK(s_SecondCount.load() == 1);
+		TEST_CHECK(!s_bOrderBroken);
+
+		pFirstCounter->~JobCounter();
+		pSecondCounter->~JobCounter();
+		memset(pFirstStorage, 0xDD, sizeof(pFirstStorage));
+		memset(pSecondStorage, 0xDD, sizeof(pSecondStorage));
+	}
+	return 0;
+}
+
+// deque(JOB_DEQUE_SIZE)   Submit 忡 ٷ .
+static int TestDequeOverflow()
+{
+	JobCounter counter;
+	JobSystem jobSystem;
+	jobSystem.Initialize(0, JOB_DEQUE_SIZE * 2);
+
+	s_FirstCount = 0;
+	for (UINT i = 0; i < JOB_DEQUE_SIZE + 100; ++i)
+	{
+		jobSystem.Submit(FirstJob, nullptr, &counter);
+	}
+	TEST_CHECK(s_FirstCount.load() == 100);
+
+	jobSystem.WaitForCounter(&counter);
+	TEST_CHECK(s_FirstCount.load() == (long)JOB_DEQUE_SIZE + 100);
+	return 0;
+}
+
+//     ̰, ũ ̴ 1 ,  worker  ִ   ʾƾ .
+static int TestSplitRange(UINT workerThreadCount)
+{
+	JobSystem jobSystem;
+	jobSystem.Initialize(workerThreadCount, 64);
+
+	const UINT MAX_RANGE_COUNT = 64;
+	JobRange pRanges[MAX_RANGE_COUNT];
+	TEST_CHECK(jobSystem.SplitRange(0, MAX_RANGE_COUNT, pRanges) == 0);
+
+	const UINT pItemCounts[] = { 1, 3, 31, 32, 33, 100, 1000, 2047 };
+	const UINT pMaxRangeCounts[] = { 1, 7, MAX_RANGE_COUNT };
+	for (UINT itemCount : pItemCounts)
+	{
+		for (UINT maxRangeCount : pMaxRangeCounts)
+		{
+			const UINT RANGE_COUNT = jobSystem.SplitRange(itemCount, maxRangeCount, pRanges);
+			TEST_CHECK(RANGE_COUNT > 0);
+			TEST_CHECK(RANGE_COUNT <= maxRangeCount && RANGE_COUNT <= itemCount);
+			TEST_CHECK(RANGE_COUNT <= jobSystem.GetWorkerCount() * JOB_RANGE_PER_WORKER);
+
+			UINT next = 0;
+			for (UINT i = 0; i < RANGE_COUNT; ++i)
+			{
+				TEST_CHECK(pRanges[i].First == next);
+				TEST_CHECK(pRanges[i].Count > 0);
+				TEST_CHECK(pRanges[i].Count - pRanges[RANGE_COUNT - 1].Count <= 1);
+				next += pRanges[i].Count;
+			}
+			TEST_CHECK(next == itemCount);
+		}
+	}
+	return 0;
+}
+
+int main()
+{
+	const UINT pWorkerThreadCounts[] = { 0, 1, 3, 7 };
+	for (UINT workerThreadCount : pWorkerThreadCounts)
+	{
+		if (TestDependency(workerThreadCount) || TestRenderGraph(workerThreadCount) || TestCounterLifetime(workerThreadCount) || TestSplitRange(workerThreadCount))
+		{
+			fprintf(stderr, "failed with %u worker threads\n", workerThreadCount);
+			return 1;
+		}
+	}
+	if (TestDequeOverflow())
+	{
+		return 1;
+	}
+
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("JobSystemTest passed\n");
+	return 0;
+}
@@ -0,0 +1,146 @@
+#include "../pch.h"
+#include "../Model/MeshOptimizer.h"
+#include "MeshReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// OptimizeMesh  vertex , ACMR/ATVR(16ĭ FIFO), FIFO ٽ ȯϴ vertex  ȭ ð.
+// FBX/Assimp importó 𼭸 vertex   mesh, ﰢ   mesh .
+// ȭ ڿ ﰢ (vertex ,  ) ״ Ȯ.
+
+typedef std::vector<BYTE> TriangleKey;
+
+// ﰢ  vertex byte.   ϰ byte   vertex .
+static void BuildTriangleKeys(const MeshInfo& MESH, std::vector<TriangleKey>* pOutKeys)
+{
+	const bool bSKINNED = !MESH.SkinnedVertices.empty();
+	const UINT64 VERTEX_SIZE = (bSKINNED ? sizeof(SkinnedVertex) : sizeof(Vertex));
+
+	pOutKeys->resize(MESH.Indices.size() / 3);
+	for (UINT64 t = 0, size = pOutKeys->size(); t < size; ++t)
+	{
+		const BYTE* ppVERTICES[3];
+		for (UINT corner = 0; corner < 3; ++corner)
+		{
+			const UINT INDEX = MESH.Indices[t * 3 + corner];
+			ppVERTICES[corner] = (bSKINNED ? (const BYTE*)&MESH.SkinnedVertices[INDEX] : (const BYTE*)&MESH.Vertices[INDEX]);
+		}
+
+		UINT first = 0;
+		for (UINT corner = 1; corner < 3; ++corner)
+		{
+			if (memcmp(ppVERTICES[corner], ppVERTICES[first], VERTEX_SIZE) < 0)
+			{
+				first = corner;
+			}
+		}
+
+		TriangleKey& key = (*pOutKeys)[t];
+		key.resize(VERTEX_SIZE * 3);
+		for (UINT corner = 0; corner < 3; ++corner)
+		{
+			memcpy(key.data() + VERTEX_SIZE * corner, ppVERTICES[(first + corner) % 3], VERTEX_SIZE);
+		}
+	}
+	std::sort(pOutKeys->begin(), pOutKeys->end());
+}
+
+static int RunMesh(const char* pszName, MeshInfo mesh)
+{
+	const UINT CACHE_SIZE = 16;
+
+	std::vector<TriangleKey> keysBefore;
+	BuildTriangleKeys(mesh, &keysBefore);
+
+	MeshOptimizeSettings settings;
+	MeshOptimizeReport report;
+	TestTimer timer;
+	OptimizeMesh(&mesh, settings, &report);
+	const double ELAPSED_MS = timer.GetElapsedMS();
+
+	std::vector<TriangleKey> keysAfter;
+	BuildTriangleKeys(mesh, &keysAfter);
+	TEST_CHECK(keysBefore == keysAfter);
+	TEST_CHECK(mesh.SkinnedVertices.empty() || mesh.SkinnedVertices.size() == mesh.Vertices.size());
+	for (UINT index : mesh.Indices)
+	{
+		TEST_CHECK(index < mesh.Vertices.size());
+	}
+
+	float acmr;
+	float atvr;
+	GetVertexCacheStats(mesh.Indices, (UINT)mesh.Vertices.size(), CACHE_SIZE, &acmr, &atvr);
+	TEST_CHECK(fabsf(acmr - report.ACMRAfter) < 1e-5f);
+	TEST_CHECK(report.ACMRAfter <= report.ACMRBefore);
+
+	printf("%-28s  %7u -> %7u  %7u  %.3f -> %.3f  %.3f -> %.3f  %8.0f -> %7.0f  %8.2f\n", pszName,
+		   report.SourceVertexCount, report.WeldedVertexCount, report.TriangleCount,
+		   report.ACMRBefore, report.ACMRAfter, report.ATVRBefore, report.ATVRAfter,
+		   report.ACMRBefore * report.TriangleCount, report.ACMRAfter * report.TriangleCount, ELAPSED_MS);
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT SCALE = (bSmoke ? 4 : 1);
+	const Vector3 BODY_SCALE(0.35f, 1.0f, 0.22f);
+
+	printf("mesh                          vertices (before -> after)  tris  ACMR             ATVR             transformed verts     ms\n");
+	{
+		MeshInfo mesh;
+		MakeTestSphere(&mesh, 64 / SCALE, 64 / SCALE, Vector3(1.0f));
+		if (RunMesh("sphere 64x64", mesh))
+		{
+			return 1;
+		}
+		ShuffleMeshTriangles(&mesh, 3);
+		if (RunMesh("sphere 64x64 shuffled", mesh))
+		{
+			return 1;
+		}
+		MakeTestSphere(&mesh, 64 / SCALE, 64 / SCALE, Vector3(1.0f));
+		UnshareMeshVertices(&mesh);
+		if (RunMesh("sphere 64x64 unshared", mesh))
+		{
+			return 1;
+		}
+	}
+	{
+		MeshInfo mesh;
+		MakeTestGrid(&mesh, 128 / SCALE, 128 / SCALE);
+		if (RunMesh("grid 128x128", mesh))
+		{
+			return 1;
+		}
+		ShuffleMeshTriangles(&mesh, 5);
+		if (RunMesh("grid 128x128 shuffled", mesh))
+		{
+			return 1;
+		}
+	}
+	{
+		MeshInfo mesh;
+		MakeTestSphere(&mesh, 96 / SCALE, 96 / SCALE, BODY_SCALE);
+		SkinTestMesh(&mesh);
+		UnshareMeshVertices(&mesh);
+		ShuffleMeshTriangles(&mesh, 7);
+		if (RunMesh("skinned body 96x96 unshared", mesh))
+		{
+			return 1;
+		}
+	}
+	if (!bSmoke)
+	{
+		MeshInfo mesh;
+		MakeTestSphere(&mesh, 400, 400, Vector3(1.0f));
+		UnshareMeshVertices(&mesh);
+		ShuffleMeshTriangles(&mesh, 11);
+		if (RunMesh("sphere 400x400 unshared", mesh))
+		{
+			return 1;
+		}
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+// mesh ȭ/LOD ׽Ʈ ġũ . GeometryGenerator  ġ ռ mesh.
+
+#include "../Model/MeshInfo.h"
+#include <algorithm>
+#include <vector>
+
+inline UINT NextMeshRandom(UINT* pSeed)
+{
+	*pSeed = *pSeed * 1664525 + 1013904223;
+	return (*pSeed >> 8);
+}
+
+// MakeSphere  ġ. 浵 0 uv seam  ְ  slice vertex ϳ . SCALE Ÿü.
+inline void MakeTestSphere(MeshInfo* pOutMesh, const UINT NUM_SLICES, const UINT NUM_STACKS, const Vector3& SCALE)
+{
+	const float PI = 3.14159265f;
+
+	pOutMesh->Vertices.resize((NUM_STACKS + 1) * (NUM_SLICES + 1));
+	for (UINT j = 0; j <= NUM_STACKS; ++j)
+	{
+		for (UINT i = 0; i <= NUM_SLICES; ++i)
+		{
+			const float PHI = PI * (float)j / (float)NUM_STACKS;
+			const float THETA = -2.0f * PI * (float)(i % NUM_SLICES) / (float)NUM_SLICES;
+
+			Vector3 position(sinf(PHI) * cosf(THETA), -cosf(PHI), sinf(PHI) * sinf(THETA));
+			if (j == 0 || j == NUM_STACKS)
+			{
+				position = Vector3(0.0f, position.y, 0.0f);
+			}
+
+			Vertex& vertex = pOutMesh->Vertices[j * (NUM_SLICES + 1) + i];
+			vertex = {};
+			vertex.Position = position * SCALE;
+			vertex.Normal = Vector3(position.x / SCALE.x, position.y / SCALE.y, position.z / SCALE.z);
+			vertex.Normal.Normalize();
+			vertex.Texcoord = Vector2((float)i / (float)NUM_SLICES, 1.0f - (float)j / (float)NUM_STACKS);
+		}
+	}
+
+	pOutMesh->Indices.clear();
+	for (UINT j = 0; j < NUM_STACKS; ++j)
+	{
+		const UINT OFFSET = (NUM_SLICES + 1) * j;
+		for (UINT i = 0; i < NUM_SLICES; ++i)
+		{
+			const UINT pQUAD[6] = { OFFSET + i, OFFSET + i + NUM_SLICES + 1, OFFSET + i + NUM_SLICES + 2, OFFSET + i, OFFSET + i + NUM_SLICES + 2, OFFSET + i + 1 };
+			pOutMesh->Indices.insert(pOutMesh->Indices.end(), pQUAD, pQUAD + 6);
+		}
+	}
+}
+
+// MakeSquareGrid  ġ z  .    .
+inline void MakeTestGrid(MeshInfo* pOutMesh, const UINT NUM_SLICES, const UINT NUM_STACKS)
+{
+	pOutMesh->Vertices.resize((NUM_STACKS + 1) * (NUM_SLICES + 1));
+	for (UINT j = 0; j <= NUM_STACKS; ++j)
+	{
+		for (UINT i = 0; i <= NUM_SLICES; ++i)
+		{
+			const float X = -1.0f + 2.0f * (float)i / (float)NUM_SLICES;
+			const float Y = 1.0f - 2.0f * (float)j / (float)NUM_STACKS;
+
+			Vertex& vertex = pOutMesh->Vertices[j * (NUM_SLICES + 1) + i];
+			vertex = {};
+			vertex.Position = Vector3(X, Y, 0.05f * sinf(3.0f * X) * cosf(2.0f * Y));
+			vertex.Normal = Vector3(0.0f, 0.0f, -1.0f);
+			vertex.Texcoord = Vector2((float)i / (float)NUM_SLICES, (float)j / (float)NUM_STACKS);
+		}
+	}
+
+	pOutMesh->Indices.clear();
+	for (UINT j = 0; j < NUM_STACKS; ++j)
+	{
+		for (UINT i = 0; i < NUM_SLICES; ++i)
+		{
+			const UINT A = (NUM_SLICES + 1) * j + i;
+			const UINT C = A + NUM_SLICES + 1;
+			const UINT pQUAD[6] = { A, A + 1, C, C, A + 1, C + 1 };
+			pOutMesh->Indices.insert(pOutMesh->Indices.end(), pQUAD, pQUAD + 6);
+		}
+	}
+}
+
+//  1,  2 .  MakeCylinderó seam  ְ, Ѳ hard edge  vertex  .
+inline void MakeTestCylinder(MeshInfo* pOutMesh, const UINT NUM_SLICES, const UINT NUM_STACKS)
+{
+	const float PI = 3.14159265f;
+
+	pOutMesh->Vertices.clear();
+	pOutMesh->Indices.clear();
+	for (UINT j = 0; j <= NUM_STACKS; ++j)
+	{
+		for (UINT i = 0; i <= NUM_SLICES; ++i)
+		{
+			const float THETA = -2.0f * PI * (float)(i % NUM_SLICES) / (float)NUM_SLICES;
+
+			Vertex vertex = {};
+			vertex.Position = Vector3(cosf(THETA), -1.0f + 2.0f * (float)j / (float)NUM_STACKS, sinf(THETA));
+			vertex.Normal = Vector3(cosf(THETA), 0.0f, sinf(THETA));
+			vertex.Texcoord = Vector2((float)i / (float)NUM_SLICES, 1.0f - (float)j / (float)NUM_STACKS);
+			pOutMesh->Vertices.push_back(vertex);
+		}
+	}
+	for (UINT j = 0; j < NUM_STACKS; ++j)
+	{
+		const UINT OFFSET = (NUM_SLICES + 1) * j;
+		for (UINT i = 0; i < NUM_SLICES; ++i)
+		{
+			const UINT pQUAD[6] = { OFFSET + i, OFFSET + i + NUM_SLICES + 1, OFFSET + i + NUM_SLICES + 2, OFFSET + i, OFFSET + i + NUM_SLICES + 2, OFFSET + i + 1 };
+			pOutMesh->Indices.insert(pOutMesh->Indices.end(), pQUAD, pQUAD + 6);
+		}
+	}
+
+	for (UINT cap = 0; cap < 2; ++cap)
+	{
+		const float Y = (cap ? 1.0f : -1.0f);
+		const UINT BASE = (UINT)pOutMesh->Vertices.size();
+
+		Vertex center = {};
+		center.Position = Vector3(0.0f, Y, 0.0f);
+		center.Normal = Vector3(0.0f, Y, 0.0f);
+		center.Texcoord = Vector2(0.5f, 0.5f);
+		pOutMesh->Vertices.push_back(center);
+		for (UINT i = 0; i < NUM_SLICES; ++i)
+		{
+			const float THETA = -2.0f * PI * (float)i / (float)NUM_SLICES;
+
+			Vertex vertex = center;
+			vertex.Position = Vector3(cosf(THETA), Y, sinf(THETA));
+			vertex.Texcoord = Vector2(0.5f + 0.5f * cosf(THETA), 0.5f + 0.5f * sinf(THETA));
+			pOutMesh->Vertices.push_back(vertex);
+		}
+		for (UINT i = 0; i < NUM_SLICES; ++i)
+		{
+			const UINT A = BASE + 1 + i;
+			const UINT B = BASE + 1 + (i + 1) % NUM_SLICES;
+			const UINT pTRIANGLE[3] = { BASE, (cap ? B : A), (cap ? A : B) };
+			pOutMesh->Indices.insert(pOutMesh->Indices.end(), pTRIANGLE, pTRIANGLE + 3);
+		}
+	}
+}
+
+// (y -1 ~ 1)  bone 5.  ó 30%  bone .
+inline void SkinTestMesh(MeshInfo* pMesh)
+{
+	pMesh->SkinnedVertices.resize(pMesh->Vertices.size());
+	for (UINT64 i = 0, size = pMesh->Vertices.size(); i < size; ++i)
+	{
+		const Vertex& VERTEX = pMesh->Vertices[i];
+		SkinnedVertex& skinnedVertex = pMesh->SkinnedVertices[i];
+		skinnedVertex = SkinnedVertex();
+		skinnedVertex.Position = VERTEX.Position;
+		skinnedVertex.Normal = VERTEX.Normal;
+		skinnedVertex.Texcoord = VERTEX.Texcoord;
+
+		const float BONE_POSITION = (VERTEX.Position.y + 1.0f) * 0.5f * 4.0f;
+		const int BONE_INDEX = std::min(3, std::max(0, (int)BONE_POSITION));
+		const float BLEND = std::min(1.0f, std::max(0.0f, (BONE_POSITION - (float)BONE_INDEX - 0.35f) / 0.3f));
+		skinnedVertex.BoneIndices[0] = (UCHAR)BONE_INDEX;
+		skinnedVertex.BlendWeights[0] = 1.0f - BLEND;
+		skinnedVertex.BoneIndices[1] = (UCHAR)(BONE_INDEX + 1);
+		skinnedVertex.BlendWeights[1] = BLEND;
+	}
+}
+
+// 𼭸 vertex  . FBX importó  vertex  .
+inline void UnshareMeshVertices(MeshInfo* pMesh)
+{
+	std::vector<Vertex> vertices;
+	std::vector<SkinnedVertex> skinnedVertices;
+	vertices.reserve(pMesh->Indices.size());
+	for (UINT& index : pMesh->Indices)
+	{
+		vertices.push_back(pMesh->Vertices[index]);
+		if (!pMesh->SkinnedVertices.empty())
+		{
+			skinnedVertices.push_back(pMesh->SkinnedVertices[index]);
+		}
+		index = (UINT)vertices.size() - 1;
+	}
+	pMesh->Vertices.swap(vertices);
+	pMesh->SkinnedVertices.swap(skinnedVertices);
+}
+
+// ﰢ  . ﰢ  index () ״.
+inline void ShuffleMeshTriangles(MeshInfo* pMesh, UINT seed)
+{
+	const UINT TRIANGLE_COUNT = (UINT)(pMesh->Indices.size() / 3);
+	std::vector<UINT> order(TRIANGLE_COUNT);
+	for (UINT i = 0; i < TRIANGLE_COUNT; ++i)
+	{
+		order[i] = i;
+	}
+	for (UINT i = TRIANGLE_COUNT; i > 1; --i)
+	{
+		std::swap(order[i - 1], order[NextMeshRandom(&seed) % i]);
+	}
+
+	std::vector<UINT> indices;
+	indices.reserve(pMesh->Indices.size());
+	for (UINT triangle : order)
+	{
+		indices.insert(indices.end(), pMesh->Indices.begin() + triangle * 3, pMesh->Indices.begin() + triangle * 3 + 3);
+	}
+	pMesh->Indices.swap(indices);
+}
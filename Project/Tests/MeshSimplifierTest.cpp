@@ -0,0 +1,401 @@
+#include "../pch.h"
+#include "../Model/MeshOptimizer.h"
+#include "../Model/MeshSimplifier.h"
+#include "MeshReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// GenerateMeshLODs import (OptimizeMesh )  ռ mesh Ȯ.
+// - LOD ﰢ MinReduction ̻ ٰ, LOD0 vertex buffer Ŵ.
+// - LOD0 vertex LOD ǥ Ÿ( ) ܰ躰   2 .     .
+// -  ﰢ, uv seam ǳʴ ﰢ .  (grid) ܰ .
+// - SelectMeshLOD ־ ܰ谡 Ŀ,   hysteresisŭ ʰ ƿ.
+
+static const UINT SURFACE_SAMPLE_COUNT = 1500;
+
+struct LODCheckResult
+{
+	UINT LODCount;
+	UINT pTriangleCounts[MAX_MESH_LOD_COUNT];
+	float pSurfaceErrors[MAX_MESH_LOD_COUNT];
+	float pBoundsErrors[MAX_MESH_LOD_COUNT];
+	UINT FlippedCount;
+	UINT SeamCrossingCount;
+	double ElapsedMS;
+};
+
+static float GetPointTriangleDistance(const Vector3& P, const Vector3& A, const Vector3& B, const Vector3& C)
+{
+	// Ericson, Real-Time Collision Detection 5.1.5.
+	const Vector3 AB = B - A;
+	const Vector3 AC = C - A;
+	const Vector3 AP = P - A;
+	const float D1 = AB.Dot(AP);
+	const float D2 = AC.Dot(AP);
+	if (D1 <= 0.0f && D2 <= 0.0f)
+	{
+		return (P - A).Length();
+	}
+
+	const Vector3 BP = P - B;
+	const float D3 = AB.Dot(BP);
+	const float D4 = AC.Dot(BP);
+	if (D3 >= 0.0f && D4 <= D3)
+	{
+		return (P - B).Length();
+	}
+
+	const float VC = D1 * D4 - D3 * D2;
+	if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+	{
+		return (P - (A + AB * (D1 / (D1 - D3)))).Length();
+	}
+
+	const Vector3 CP = P - C;
+	const float D5 = AB.Dot(CP);
+	const float D6 = AC.Dot(CP);
+	if (D6 >= 0.0f && D5 <= D6)
+	{
+		return (P - C).Length();
+	}
+
+	const float VB = D5 * D2 - D1 * D6;
+	if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+	{
+		return (P - (A + AC * (D2 / (D2 - D6)))).Length();
+	}
+
+	const float VA = D3 * D6 - D5 * D4;
+	if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+	{
+		return (P - (B + (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6))))).Length();
+	}
+
+	const float DENOM = 1.0f / (VA + VB + VC);
+	return (P - (A + AB * (VB * DENOM) + AC * (VC * DENOM))).Length();
+}
+
+// LOD0 vertex ǥ LOD ǥ   Ÿ.
+static float GetSurfaceError(const MeshInfo& MESH, const std::vector<UINT>& LOD_INDICES)
+{
+	const UINT64 VERTEX_COUNT = MESH.Vertices.size();
+	const UINT64 STEP = (VERTEX_COUNT > SURFACE_SAMPLE_COUNT ? VERTEX_COUNT / SURFACE_SAMPLE_COUNT : 1);
+
+	float maxDistance = 0.0f;
+	for (UINT64 i = 0; i < VERTEX_COUNT; i += STEP)
+	{
+		float distance = FLT_MAX;
+		for (UINT64 t = 0, size = LOD_INDICES.size(); t < size; t += 3)
+		{
+			distance = std::min(distance, GetPointTriangleDistance(MESH.Vertices[i].Position, MESH.Vertices[LOD_INDICES[t]].Position,
+																   MESH.Vertices[LOD_INDICES[t + 1]].Position, MESH.Vertices[LOD_INDICES[t + 2]].Position));
+		}
+		maxDistance = std::max(maxDistance, distance);
+	}
+	return maxDistance;
+}
+
+//  normal  vertex normal  . Ѳó normal (y)  uv ̶ seam ˻翡 .
+static void CountBadTriangles(const MeshInfo& MESH, const std::vector<UINT>& INDICES, const float ORIENTATION, UINT* pFlippedCount, UINT* pSeamCrossingCount)
+{
+	for (UINT64 t = 0, size = INDICES.size(); t < size; t += 3)
+	{
+		const Vertex& A = MESH.Vertices[INDICES[t]];
+		const Vertex& B = MESH.Vertices[INDICES[t + 1]];
+		const Vertex& C = MESH.Vertices[INDICES[t + 2]];
+
+		const Vector3 FACE_NORMAL = (B.Position - A.Position).Cross(C.Position - A.Position);
+		if (FACE_NORMAL.Dot(A.Normal + B.Normal + C.Normal) * ORIENTATION < 0.0f)
+		{
+			++(*pFlippedCount);
+		}
+
+		const bool bCAP = (fabsf(A.Normal.y) > 0.99f && fabsf(B.Normal.y) > 0.99f && fabsf(C.Normal.y) > 0.99f);
+		const float U_SPAN = std::max({ A.Texcoord.x, B.Texcoord.x, C.Texcoord.x }) - std::min({ A.Texcoord.x, B.Texcoord.x, C.Texcoord.x });
+		if (!bCAP && U_SPAN > 0.5f)
+		{
+			++(*pSeamCrossingCount);
+		}
+	}
+}
+
+static void GetIndexedBounds(const MeshInfo& MESH, const std::vector<UINT>& INDICES, Vector3* pOutMin, Vector3* pOutMax)
+{
+	*pOutMin = Vector3(FLT_MAX);
+	*pOutMax = Vector3(-FLT_MAX);
+	for (UINT index : INDICES)
+	{
+		*pOutMin = Vector3::Min(*pOutMin, MESH.Vertices[index].Position);
+		*pOutMax = Vector3::Max(*pOutMax, MESH.Vertices[index].Position);
+	}
+}
+
+static int RunLODChain(const char* pszName, MeshInfo mesh, const MeshLODSettings& SETTINGS, LODCheckResult* pOutResult)
+{
+	*pOutResult = {};
+
+	OptimizeMesh(&mesh, MeshOptimizeSettings(), nullptr);
+
+	Vector3 minBounds;
+	Vector3 maxBounds;
+	GetIndexedBounds(mesh, mesh.Indices, &minBounds, &maxBounds);
+	const float RADIUS = (maxBounds - minBounds).Length() * 0.5f;
+
+	MeshLODReport report;
+	TestTimer timer;
+	GenerateMeshLODs(&mesh, SETTINGS, &report);
+	pOutResult->ElapsedMS = timer.GetElapsedMS();
+
+	TEST_CHECK(report.LODCount >= 1 && report.LODCount <= SETTINGS.LODCount);
+	TEST_CHECK(report.LODCount == mesh.LODIndices.size() + 1);
+	TEST_CHECK(report.pTriangleCounts[0] * 3 == mesh.Indices.size());
+	pOutResult->LODCount = report.LODCount;
+
+	// LOD0 .  ﰢ   ݴ.
+	float orientation = 0.0f;
+	for (UINT64 t = 0, size = mesh.Indices.size(); t < size; t += 3)
+	{
+		const Vertex& A = mesh.Vertices[mesh.Indices[t]];
+		const Vertex& B = mesh.Vertices[mesh.Indices[t + 1]];
+		const Vertex& C = mesh.Vertices[mesh.Indices[t + 2]];
+		const float DOT = (B.Position - A.Position).Cross(C.Position - A.Position).Dot(A.Normal + B.Normal + C.Normal);
+		orientation += (DOT > 0.0f ? 1.0f : (DOT < 0.0f ? -1.0f : 0.0f));
+	}
+	orientation = (orientation >= 0.0f ? 1.0f : -1.0f);
+
+	for (UINT level = 0; level < report.LODCount; ++level)
+	{
+		const std::vector<UINT>& INDICES = (level == 0 ? mesh.Indices : mesh.LODIndices[level - 1]);
+		TEST_CHECK(INDICES.size() % 3 == 0);
+		TEST_CHECK(report.pTriangleCounts[level] * 3 == INDICES.size());
+		for (UINT index : INDICES)
+		{
+			TEST_CHECK(index < mesh.Vertices.size());
+		}
+		pOutResult->pTriangleCounts[level] = report.pTriangleCounts[level];
+
+		CountBadTriangles(mesh, INDICES, orientation, &pOutResult->FlippedCount, &pOutResult->SeamCrossingCount);
+		if (level == 0)
+		{
+			continue;
+		}
+
+		TEST_CHECK((float)report.pTriangleCounts[level] <= (float)report.pTriangleCounts[level - 1] * SETTINGS.MinReduction);
+		TEST_CHECK(report.pErrors[level] <= SETTINGS.pMaxErrors[level] * 1.0001f);
+
+		Vector3 lodMin;
+		Vector3 lodMax;
+		GetIndexedBounds(mesh, INDICES, &lodMin, &lodMax);
+		pOutResult->pBoundsErrors[level] = std::max((lodMin - minBounds).Length(), (lodMax - maxBounds).Length()) / RADIUS;
+		pOutResult->pSurfaceErrors[level] = GetSurfaceError(mesh, INDICES) / RADIUS;
+		TEST_CHECK(pOutResult->pSurfaceErrors[level] <= SETTINGS.pMaxErrors[level] * 2.0f);
+	}
+
+	printf("%-28s %6u tris %6.1f ms:", pszName, report.pTriangleCounts[0], pOutResult->ElapsedMS);
+	for (UINT level = 1; level < report.LODCount; ++level)
+	{
+		printf("  %u (err %.4f, bounds %.4f)", report.pTriangleCounts[level], pOutResult->pSurfaceErrors[level], pOutResult->pBoundsErrors[level]);
+	}
+	printf("\n");
+
+	TEST_CHECK(pOutResult->FlippedCount == 0);
+	TEST_CHECK(pOutResult->SeamCrossingCount == 0);
+	return 0;
+}
+
+static int TestLODChains()
+{
+	const MeshLODSettings SETTINGS;
+	const Vector3 BODY_SCALE(0.35f, 1.0f, 0.22f);
+	LODCheckResult result;
+
+	//     ܰ谡 ǥ () .
+	MeshInfo mesh;
+	MakeTestSphere(&mesh, 64, 64, Vector3(1.0f));
+	if (RunLODChain("sphere 64x64", mesh, SETTINGS, &result))
+	{
+		return 1;
+	}
+	TEST_CHECK(result.LODCount == MAX_MESH_LOD_COUNT);
+	for (UINT level = 1; level < result.LODCount; ++level)
+	{
+		TEST_CHECK(result.pTriangleCounts[level] * 2 <= result.pTriangleCounts[level - 1] + 1);
+	}
+
+	mesh = MeshInfo();
+	MakeTestSphere(&mesh, 128, 96, Vector3(1.0f));
+	if (RunLODChain("sphere 128x96", mesh, SETTINGS, &result))
+	{
+		return 1;
+	}
+	TEST_CHECK(result.LODCount == MAX_MESH_LOD_COUNT);
+
+	//   ܰ 󼭸 پ.
+	mesh = MeshInfo();
+	MakeTestGrid(&mesh, 96, 96);
+	if (RunLODChain("wavy grid 96x96", mesh, SETTINGS, &result))
+	{
+		return 1;
+	}
+	TEST_CHECK(result.LODCount == MAX_MESH_LOD_COUNT);
+	for (UINT level = 1; level < result.LODCount; ++level)
+	{
+		TEST_CHECK(result.pBoundsErrors[level] <= 1e-5f);
+	}
+
+	//  Ѳ  hard edge( ġ, ٸ normal) seam.
+	mesh = MeshInfo();
+	MakeTestCylinder(&mesh, 64, 32);
+	if (RunLODChain("cylinder 64x32 + caps", mesh, SETTINGS, &result))
+	{
+		return 1;
+	}
+	TEST_CHECK(result.LODCount >= 3);
+	for (UINT level = 1; level < result.LODCount; ++level)
+	{
+		TEST_CHECK(result.pBoundsErrors[level] <= 1e-5f);
+	}
+
+	//  Ѱ ȿ     mesh LOD0.
+	mesh = MeshInfo();
+	MakeTestSphere(&mesh, 16, 12, Vector3(1.0f));
+	if (RunLODChain("sphere 16x12", mesh, SETTINGS, &result))
+	{
+		return 1;
+	}
+	TEST_CHECK(result.LODCount == 1);
+
+	// FBX import . OptimizeMesh   skinned vertex  .
+	mesh = MeshInfo();
+	MakeTestSphere(&mesh, 96, 96, BODY_SCALE);
+	SkinTestMesh(&mesh);
+	UnshareMeshVertices(&mesh);
+	if (RunLODChain("skinned body 96x96 unshared", mesh, SETTINGS, &result))
+	{
+		return 1;
+	}
+	TEST_CHECK(result.LODCount == MAX_MESH_LOD_COUNT);
+	return 0;
+}
+
+// bone weight  .  mesh weight ̴ 谡   ó vertex  ħ.
+static int TestSkinWeightCost()
+{
+	const Vector3 BODY_SCALE(0.35f, 1.0f, 0.22f);
+	const UINT TARGET_TRIANGLE_COUNT = 1200;
+
+	MeshInfo skinned;
+	MakeTestSphere(&skinned, 64, 64, BODY_SCALE);
+	SkinTestMesh(&skinned);
+	MeshInfo oneBone = skinned;
+	for (SkinnedVertex& vertex : oneBone.SkinnedVertices)
+	{
+		vertex.BoneIndices[0] = 0;
+		vertex.BlendWeights[0] = 1.0f;
+		vertex.BoneIndices[1] = 0;
+		vertex.BlendWeights[1] = 0.0f;
+	}
+
+	MeshSimplifySettings settings;
+	settings.MaxError = 1.0f;
+
+	std::vector<UINT> skinnedIndices;
+	std::vector<UINT> oneBoneIndices;
+	MeshSimplifyReport skinnedReport;
+	MeshSimplifyReport oneBoneReport;
+	SimplifyMesh(skinned, skinned.Indices, TARGET_TRIANGLE_COUNT, settings, &skinnedIndices, &skinnedReport);
+	SimplifyMesh(oneBone, oneBone.Indices, TARGET_TRIANGLE_COUNT, settings, &oneBoneIndices, &oneBoneReport);
+
+	TEST_CHECK(skinnedReport.SourceTriangleCount == skinned.Indices.size() / 3);
+	TEST_CHECK(skinnedReport.TriangleCount * 3 == skinnedIndices.size());
+	TEST_CHECK(oneBoneReport.TriangleCount * 3 == oneBoneIndices.size());
+	TEST_CHECK(skinnedReport.TriangleCount <= TARGET_TRIANGLE_COUNT + 2);
+	TEST_CHECK(oneBoneReport.TriangleCount <= TARGET_TRIANGLE_COUNT + 2);
+
+	// weight ٸ  vertex մ edge  . ̴  vertex ϹǷ skin      .
+	UINT pBlendedCounts[2] = {};
+	const std::vector<UINT>* ppINDICES[2] = { &skinnedIndices, &oneBoneIndices };
+	for (UINT m = 0; m < 2; ++m)
+	{
+		for (UINT index : *ppINDICES[m])
+		{
+			const float WEIGHT = skinned.SkinnedVertices[index].BlendWeights[0];
+			if (WEIGHT > 0.01f && WEIGHT < 0.99f)
+			{
+				++pBlendedCounts[m];
+			}
+		}
+	}
+	printf("skin cost: %u tris, %.4f error, blended corners %u vs %u without skin weights\n",
+		   skinnedReport.TriangleCount, skinnedReport.Error, pBlendedCounts[0], pBlendedCounts[1]);
+	TEST_CHECK(pBlendedCounts[0] > pBlendedCounts[1]);
+	return 0;
+}
+
+static int TestSelectLOD()
+{
+	const MeshLODSelectSettings SETTINGS;
+	const UINT LOD_COUNT = MAX_MESH_LOD_COUNT;
+
+	//  60 (XMMatrixPerspectiveFovLH). GetProjectedScreenSize _22, _34 .
+	const float FOCAL = 1.0f / tanf(DirectX::XM_PI / 6.0f);
+	Matrix projection = Matrix();
+	projection._11 = FOCAL * 9.0f / 16.0f;
+	projection._22 = FOCAL;
+	projection._33 = 1.0f;
+	projection._34 = 1.0f;
+	projection._44 = 0.0f;
+	TEST_CHECK(fabsf(GetProjectedScreenSize(Vector3(0.0f, 0.0f, -10.0f), 1.0f, Vector3(0.0f), projection) - FOCAL / 10.0f) < 1e-6f);
+	// ī޶ sphere ̸ Ÿ  .
+	TEST_CHECK(fabsf(GetProjectedScreenSize(Vector3(0.0f), 2.0f, Vector3(0.5f, 0.0f, 0.0f), projection) - FOCAL) < 1e-6f);
+
+	Matrix orthographic = Matrix();
+	orthographic._11 = 2.0f / 20.0f;
+	orthographic._22 = 2.0f / 20.0f;
+	TEST_CHECK(GetProjectedScreenSize(Vector3(0.0f, 0.0f, -5.0f), 1.0f, Vector3(0.0f), orthographic) == GetProjectedScreenSize(Vector3(0.0f, 0.0f, -80.0f), 1.0f, Vector3(0.0f), orthographic));
+
+	// ־ ܰ谡  .    ܰ.
+	UINT level = 0;
+	std::vector<UINT> outwardLevels;
+	std::vector<float> distances;
+	for (float distance = 2.0f; distance < 100.0f; distance *= 1.05f)
+	{
+		const UINT NEXT_LEVEL = SelectMeshLOD(GetProjectedScreenSize(Vector3(0.0f, 0.0f, -distance), 1.0f, Vector3(0.0f), projection), level, LOD_COUNT, SETTINGS);
+		TEST_CHECK(NEXT_LEVEL >= level);
+		level = NEXT_LEVEL;
+		outwardLevels.push_back(level);
+		distances.push_back(distance);
+	}
+	TEST_CHECK(outwardLevels.front() == 0 && outwardLevels.back() == LOD_COUNT - 1);
+
+	// ٽ    Ÿ ų   ܰ(ū level).
+	for (UINT64 i = distances.size(); i > 0; --i)
+	{
+		const UINT NEXT_LEVEL = SelectMeshLOD(GetProjectedScreenSize(Vector3(0.0f, 0.0f, -distances[i - 1]), 1.0f, Vector3(0.0f), projection), level, LOD_COUNT, SETTINGS);
+		TEST_CHECK(NEXT_LEVEL <= level);
+		TEST_CHECK(NEXT_LEVEL >= outwardLevels[i - 1]);
+		level = NEXT_LEVEL;
+	}
+	TEST_CHECK(level == 0);
+
+	//  ٷ . ó̸ ܰ 1 , ܰ 2  hysteresis ̶ 2 .
+	const float BOUNDARY = SETTINGS.pLevelScreenSizes[2];
+	TEST_CHECK(SelectMeshLOD(BOUNDARY * 1.05f, 0, LOD_COUNT, SETTINGS) == 1);
+	TEST_CHECK(SelectMeshLOD(BOUNDARY * 1.05f, 2, LOD_COUNT, SETTINGS) == 2);
+	TEST_CHECK(SelectMeshLOD(BOUNDARY * (1.0f + SETTINGS.Hysteresis) * 1.01f, 2, LOD_COUNT, SETTINGS) == 1);
+	// LOD  mesh ִ ܰ.
+	TEST_CHECK(SelectMeshLOD(0.001f, 0, 2, SETTINGS) == 1);
+	TEST_CHECK(SelectMeshLOD(0.001f, 0, 1, SETTINGS) == 0);
+	return 0;
+}
+
+int main()
+{
+	if (TestLODChains() || TestSkinWeightCost() || TestSelectLOD())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("MeshSimplifierTest passed\n");
+	return 0;
+}
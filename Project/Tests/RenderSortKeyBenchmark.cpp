@@ -0,0 +1,156 @@
+#include "../pch.h"
+#include "../Renderer/RenderSortKey.h"
+#include "TestCommon.h"
+#include <algorithm>
+#include <vector>
+
+// RenderQueue  (scene ) ״ ׸  sort key  
+// root signature/PSO/material  Ƚ, ׸ radix sort std::sort ð .
+
+struct BenchmarkItem
+{
+	UINT Layer;
+	int PSOType;
+	UINT MaterialID;
+	float Depth;
+};
+struct StateChangeCounts
+{
+	UINT RootSignature;
+	UINT PSO;
+	UINT Material;
+};
+
+static UINT NextRandom(UINT* pSeed)
+{
+	*pSeed = *pSeed * 1664525 + 1013904223;
+	return (*pSeed >> 8);
+}
+
+// object pass: default/skinned . shadow pass: light layer ٸ cascade/cube depth-only PSO.
+static void MakeItems(std::vector<BenchmarkItem>* pOutItems, UINT count, UINT materialCount, bool bShadowPass, UINT seed)
+{
+	pOutItems->resize(count);
+	for (UINT i = 0; i < count; ++i)
+	{
+		BenchmarkItem& item = (*pOutItems)[i];
+		bool bSkinned = (NextRandom(&seed) % 4 == 0);
+		if (bShadowPass)
+		{
+			item.Layer = NextRandom(&seed) % 3;
+			bool bCascade = (item.Layer == 0);
+			item.PSOType = (bCascade ? (bSkinned ? RenderPSOType_DepthOnlyCascadeSkinned : RenderPSOType_DepthOnlyCascadeDefault) : (bSkinned ? RenderPSOType_DepthOnlyCubeSkinned : RenderPSOType_DepthOnlyCubeDefault));
+			item.MaterialID = 0;
+		}
+		else
+		{
+			item.Layer = 0;
+			item.PSOType = (bSkinned ? RenderPSOType_Skinned : RenderPSOType_Default);
+			// material sort id hash .  material   ̵ ġħ.
+			UINT materialIndex = (NextRandom(&seed) % materialCount) * (NextRandom(&seed) % materialCount) / materialCount;
+			item.MaterialID = (materialIndex * 2654435761u) >> 12;
+		}
+		item.Depth = (float)(NextRandom(&seed) % 100000) * 0.01f;
+	}
+}
+
+static StateChangeCounts CountStateChanges(const std::vector<BenchmarkItem>& ITEMS, const UINT* pORDER)
+{
+	StateChangeCounts counts = { 0, 0, 0 };
+	int boundRootSignature = -1;
+	int boundPSO = -1;
+	UINT boundLayer = 0xffffffff;
+	UINT boundMaterial = 0xffffffff;
+	for (UINT i = 0, size = (UINT)ITEMS.size(); i < size; ++i)
+	{
+		const BenchmarkItem& ITEM = ITEMS[pORDER[i]];
+		int rootSignature = GetRootSignatureGroup(ITEM.PSOType);
+		if (rootSignature != boundRootSignature)
+		{
+			++counts.RootSignature;
+			boundRootSignature = rootSignature;
+		}
+		// shadow render target light ٲ ٽ Ƿ PSO ٽ .
+		if (ITEM.PSOType != boundPSO || ITEM.Layer != boundLayer)
+		{
+			++counts.PSO;
+			boundPSO = ITEM.PSOType;
+			boundLayer = ITEM.Layer;
+		}
+		if (ITEM.MaterialID != boundMaterial)
+		{
+			++counts.Material;
+			boundMaterial = ITEM.MaterialID;
+		}
+	}
+	return counts;
+}
+
+static void RunQueue(const char* pszName, UINT itemCount, bool bShadowPass, UINT repeatCount)
+{
+	std::vector<BenchmarkItem> items;
+	MakeItems(&items, itemCount, 200, bShadowPass, 31337);
+	const UINT RENDER_PASS = (bShadowPass ? RenderPass_Shadow : RenderPass_Object);
+
+	std::vector<UINT64> keys(itemCount * 2);
+	std::vector<UINT> indices(itemCount * 2);
+	std::vector<std::pair<UINT64, UINT>> pairs(itemCount);
+
+	// RenderQueue::Add key  + Prepare radix sort.
+	TestTimer timer;
+	for (UINT r = 0; r < repeatCount; ++r)
+	{
+		for (UINT i = 0; i < itemCount; ++i)
+		{
+			const BenchmarkItem& ITEM = items[i];
+			keys[i] = MakeRenderSortKey(RENDER_PASS, ITEM.Layer, ITEM.PSOType, ITEM.MaterialID, ITEM.Depth);
+			indices[i] = i;
+		}
+		RadixSortKeys(keys.data(), indices.data(), keys.data() + itemCount, indices.data() + itemCount, itemCount);
+	}
+	const double RADIX_MS = timer.GetElapsedMS() / repeatCount;
+
+	timer.Reset();
+	for (UINT r = 0; r < repeatCount; ++r)
+	{
+		for (UINT i = 0; i < itemCount; ++i)
+		{
+			const BenchmarkItem& ITEM = items[i];
+			pairs[i].first = MakeRenderSortKey(RENDER_PASS, ITEM.Layer, ITEM.PSOType, ITEM.MaterialID, ITEM.Depth);
+			pairs[i].second = i;
+		}
+		std::sort(pairs.begin(), pairs.end());
+	}
+	const double STD_SORT_MS = timer.GetElapsedMS() / repeatCount;
+
+	std::vector<UINT> submissionOrder(itemCount);
+	for (UINT i = 0; i < itemCount; ++i)
+	{
+		submissionOrder[i] = i;
+	}
+	StateChangeCounts unsorted = CountStateChanges(items, submissionOrder.data());
+	StateChangeCounts sorted = CountStateChanges(items, indices.data());
+
+	printf("%-7s %6u items  radix %7.3f ms (%5.1f ns/item)  std::sort %7.3f ms  |  root sig %5u -> %3u  PSO %5u -> %3u  material %5u -> %3u\n",
+		   pszName, itemCount,
+		   RADIX_MS, RADIX_MS * 1e6 / itemCount, STD_SORT_MS,
+		   unsorted.RootSignature, sorted.RootSignature,
+		   unsorted.PSO, sorted.PSO,
+		   unsorted.Material, sorted.Material);
+}
+
+int main(int argc, char** argv)
+{
+	const bool bSmoke = IsSmokeRun(argc, argv);
+	const UINT REPEAT_COUNT = (bSmoke ? 1 : 200);
+
+	// RenderQueue pass ִ 8192.
+	const UINT pItemCounts[] = { 1024, 8192 };
+	for (UINT itemCount : pItemCounts)
+	{
+		RunQueue("object", itemCount, false, REPEAT_COUNT);
+		RunQueue("shadow", itemCount, true, REPEAT_COUNT);
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
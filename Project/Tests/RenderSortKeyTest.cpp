@@ -0,0 +1,116 @@
+#include "../pch.h"
+#include "../Renderer/RenderSortKey.h"
+#include "TestCommon.h"
+#include <algorithm>
+#include <vector>
+
+static UINT64 NextRandom(UINT64* pSeed)
+{
+	*pSeed = *pSeed * 6364136223846793005ull + 1442695040888963407ull;
+	return (*pSeed >> 11);
+}
+
+//  field  field ׻  񱳵Ǿ .
+static int TestFieldOrder()
+{
+	TEST_CHECK(MakeRenderSortKey(0, 0, RenderPSOType_Default, 0, 1.0f) < MakeRenderSortKey(0, 0, RenderPSOType_Default, 0, 2.0f));
+	TEST_CHECK(MakeRenderSortKey(0, 0, RenderPSOType_Default, 0, 1000.0f) < MakeRenderSortKey(0, 0, RenderPSOType_Default, 1, 0.5f));
+	TEST_CHECK(MakeRenderSortKey(0, 0, RenderPSOType_Default, 0xfffff, 1000.0f) < MakeRenderSortKey(0, 0, RenderPSOType_Skybox, 0, 0.5f));
+	TEST_CHECK(MakeRenderSortKey(0, 0, RenderPSOType_Wire, 0xfffff, 1000.0f) < MakeRenderSortKey(0, 1, RenderPSOType_Default, 0, 0.5f));
+	TEST_CHECK(MakeRenderSortKey(0, 15, RenderPSOType_Wire, 0xfffff, 1000.0f) < MakeRenderSortKey(1, 0, RenderPSOType_Default, 0, 0.5f));
+
+	// root signature PSO . Skybox(Default ׷) Skinned .
+	TEST_CHECK(MakeRenderSortKey(0, 0, RenderPSOType_Skybox, 0, 0.0f) < MakeRenderSortKey(0, 0, RenderPSOType_Skinned, 0, 0.0f));
+
+	// /NaN depth  .
+	TEST_CHECK(MakeRenderSortKey(0, 0, RenderPSOType_Default, 0, -5.0f) == MakeRenderSortKey(0, 0, RenderPSOType_Default, 0, 0.0f));
+	TEST_CHECK(MakeRenderSortKey(0, 0, RenderPSOType_Default, 0, nanf("")) == MakeRenderSortKey(0, 0, RenderPSOType_Default, 0, 0.0f));
+	return 0;
+}
+
+// radix sort  std::stable_sort ƾ .  key Է  .
+static int CheckSortMatchesStableSort(const std::vector<UINT64>& KEYS)
+{
+	const UINT COUNT = (UINT)KEYS.size();
+
+	// 0  ȿ ͸ ѱ⵵ ϳ  .
+	std::vector<UINT64> keys(KEYS);
+	keys.push_back(0);
+	std::vector<UINT> values(COUNT + 1);
+	for (UINT i = 0; i < COUNT; ++i)
+	{
+		values[i] = i;
+	}
+	std::vector<UINT64> scratchKeys(COUNT + 1);
+	std::vector<UINT> scratchValues(COUNT + 1);
+	RadixSortKeys(keys.data(), values.data(), scratchKeys.data(), scratchValues.data(), COUNT);
+
+	std::vector<UINT> referenceValues(COUNT);
+	for (UINT i = 0; i < COUNT; ++i)
+	{
+		referenceValues[i] = i;
+	}
+	std::stable_sort(referenceValues.begin(), referenceValues.end(), [&KEYS](UINT a, UINT b) { return KEYS[a] < KEYS[b]; });
+
+	for (UINT i = 0; i < COUNT; ++i)
+	{
+		TEST_CHECK(values[i] == referenceValues[i]);
+		TEST_CHECK(keys[i] == KEYS[referenceValues[i]]);
+	}
+	return 0;
+}
+
+static int TestRadixSort()
+{
+	UINT64 seed = 1;
+
+	// Ϲ render key.
+	std::vector<UINT64> keys(200000);
+	for (UINT64& key : keys)
+	{
+		key = MakeRenderSortKey(1, (UINT)(NextRandom(&seed) % 3), (int)(NextRandom(&seed) % RenderPSOType_PipelineStateCount), (UINT)NextRandom(&seed), (float)(NextRandom(&seed) % 100000) * 0.01f);
+	}
+	if (CheckSortMatchesStableSort(keys))
+	{
+		return 1;
+	}
+
+	// 64bit ü . 8ڸ    scratch ƴ  迭 ƾ .
+	for (UINT64& key : keys)
+	{
+		key = NextRandom(&seed) ^ (NextRandom(&seed) << 40);
+	}
+	if (CheckSortMatchesStableSort(keys))
+	{
+		return 1;
+	}
+
+	// ߺ  key. Ȧ  ڸ ǳʶپ scratch ʿ  쵵 .
+	for (UINT64& key : keys)
+	{
+		key = (NextRandom(&seed) % 7) << 16;
+	}
+	if (CheckSortMatchesStableSort(keys))
+	{
+		return 1;
+	}
+
+	//   key, 0, 1.
+	std::fill(keys.begin(), keys.end(), 0x1234ull);
+	if (CheckSortMatchesStableSort(keys) || CheckSortMatchesStableSort(std::vector<UINT64>()) || CheckSortMatchesStableSort(std::vector<UINT64>(1, 5)))
+	{
+		return 1;
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestFieldOrder() || TestRadixSort())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("RenderSortKeyTest passed\n");
+	return 0;
+}
@@ -0,0 +1,244 @@
+#include "../pch.h"
+#include "../Model/RootMotion.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+
+// ExtractRootMotion/SampleRootMotion/LocomotionIntegrator device  Ȯ.
+// locomotion frame rate(30, 60, 144Hz,  frame ð)   step  bit   ġ .
+
+static const float FIXED_STEP = 1.0f / 60.0f;
+static const UINT64 LOCOMOTION_STEP_COUNT = 10000;
+
+// z-up, cm  sourceó root θ  ->   100  + x -90.
+static Matrix GetRootToModel()
+{
+	return Matrix::CreateScale(0.01f) * Matrix::CreateRotationX(-DirectX::XM_PIDIV2);
+}
+
+//  ׸ ȴ root. source xy  ̵, z .  key  ƴ tick.
+static void MakeWalkClip(AnimationClip* pOutClip)
+{
+	pOutClip->Duration = 30.5;
+	pOutClip->TicksPerSec = 30.0;
+	pOutClip->Keys.assign(1, std::vector<AnimationClip::Key>());
+	for (UINT i = 0; i <= 30; ++i)
+	{
+		const double TICK = (i < 30 ? (double)i : 30.5);
+		const float ANGLE = (float)TICK * 0.05f;
+
+		AnimationClip::Key key;
+		key.Time = TICK;
+		key.Position = Vector3(300.0f * sinf(ANGLE), 300.0f * (1.0f - cosf(ANGLE)), 90.0f + 5.0f * sinf((float)TICK));
+		key.Rotation = Quaternion::CreateFromAxisAngle(Vector3::UnitZ, ANGLE);
+		pOutClip->Keys[0].push_back(key);
+	}
+}
+
+static int TestExtract()
+{
+	AnimationClip clip;
+	MakeWalkClip(&clip);
+	const Matrix ROOT_TO_MODEL = GetRootToModel();
+
+	RootMotionTrack track;
+	ExtractRootMotion(clip, ROOT_TO_MODEL, &track);
+	TEST_CHECK(track.IsValid());
+	TEST_CHECK(track.DeltaPositions.size() == 31 && track.DeltaYaws.size() == 31);
+
+	//    = ó  key   . ̴ .
+	Vector3 positionSum;
+	float yawSum = 0.0f;
+	for (UINT64 i = 0; i < track.DeltaPositions.size(); ++i)
+	{
+		TEST_CHECK(track.DeltaPositions[i].y == 0.0f);
+		positionSum += track.DeltaPositions[i];
+		yawSum += track.DeltaYaws[i];
+	}
+	Vector3 expected = Vector3::TransformNormal(clip.Keys[0].back().Position - clip.Keys[0][0].Position, ROOT_TO_MODEL);
+	expected.y = 0.0f;
+	TEST_CHECK((positionSum - expected).Length() <= 1e-5f);
+	// source z ȸ  y ȸ.
+	TEST_CHECK(fabsf(fabsf(yawSum) - 30.5f * 0.05f) <= 1e-5f);
+
+	// key ų ̰ 0̸  track.
+	AnimationClip emptyClip;
+	emptyClip.Duration = 10.0;
+	emptyClip.TicksPerSec = 30.0;
+	ExtractRootMotion(emptyClip, ROOT_TO_MODEL, &track);
+	TEST_CHECK(!track.IsValid());
+	return 0;
+}
+
+//   sample Ͱ ߰  sample  ƾ . Duration  ó ̾ .
+static int TestSampleSplit()
+{
+	AnimationClip clip;
+	MakeWalkClip(&clip);
+	RootMotionTrack track;
+	ExtractRootMotion(clip, GetRootToModel(), &track);
+
+	const double pStartTicks[] = { 0.0, 3.3, 29.9, 30.4, -2.0 };
+	const double pPieceCounts[] = { 1.0, 7.0, 73.0 };
+	for (double startTick : pStartTicks)
+	{
+		Vector3 wholeDelta;
+		float wholeYaw;
+		SampleRootMotion(track, startTick, 50.0, &wholeDelta, &wholeYaw);
+
+		for (double pieceCount : pPieceCounts)
+		{
+			Vector3 sumDelta;
+			float sumYaw = 0.0f;
+			for (UINT i = 0; i < (UINT)pieceCount; ++i)
+			{
+				Vector3 delta;
+				float yaw;
+				SampleRootMotion(track, startTick + 50.0 * i / pieceCount, 50.0 / pieceCount, &delta, &yaw);
+				sumDelta += delta;
+				sumYaw += yaw;
+			}
+			TEST_CHECK((wholeDelta - sumDelta).Length() <= 1e-4f);
+			TEST_CHECK(fabsf(wholeYaw - sumYaw) <= 1e-5f);
+		}
+	}
+
+	//  (Duration)  ġ  ü .
+	Vector3 cycleDelta;
+	float cycleYaw;
+	SampleRootMotion(track, 0.0, track.Duration, &cycleDelta, &cycleYaw);
+	Vector3 shiftedDelta;
+	float shiftedYaw;
+	SampleRootMotion(track, 12.25, track.Duration, &shiftedDelta, &shiftedYaw);
+	TEST_CHECK((cycleDelta - shiftedDelta).Length() <= 1e-4f);
+	TEST_CHECK(fabsf(cycleYaw - shiftedYaw) <= 1e-5f);
+	return 0;
+}
+
+enum eFrameTiming
+{
+	FrameTiming_30Hz = 0,
+	FrameTiming_60Hz,
+	FrameTiming_144Hz,
+	FrameTiming_Jitter, // 2~90ms .
+	FrameTiming_Count,
+};
+
+// App::updateLocomotionó step  ϰ yaw ĳ͸ .
+static void RunLocomotion(const RootMotionTrack& TRACK, eFrameTiming timing, Vector3* pOutPosition, Quaternion* pOutRotation, float* pOutMaxRenderSpeed)
+{
+	LocomotionIntegrator locomotion;
+	locomotion.Initialize(FIXED_STEP, 8, Vector3(1.0f, 2.0f, 3.0f));
+
+	Vector3 position(1.0f, 2.0f, 3.0f);
+	Quaternion rotation = Quaternion::CreateFromAxisAngle(Vector3::UnitY, 0.7f);
+	Vector3 prevRenderPosition = locomotion.GetRenderPosition();
+	float maxRenderSpeed = 0.0f;
+	UINT seed = 77;
+	while (locomotion.GetStepCount() < LOCOMOTION_STEP_COUNT)
+	{
+		float deltaTime;
+		switch (timing)
+		{
+			case FrameTiming_30Hz:
+				deltaTime = 1.0f / 30.0f;
+				break;
+			case FrameTiming_60Hz:
+				deltaTime = 1.0f / 60.0f;
+				break;
+			case FrameTiming_144Hz:
+				deltaTime = 1.0f / 144.0f;
+				break;
+			default:
+				deltaTime = NextAnimationRandomFloat(&seed, 0.002f, 0.09f);
+				break;
+		}
+
+		const UINT STEP_COUNT = locomotion.BeginFrame(deltaTime);
+		for (UINT step = 0; step < STEP_COUNT && locomotion.GetStepCount() < LOCOMOTION_STEP_COUNT; ++step)
+		{
+			Vector3 displacement;
+			float deltaYaw;
+			locomotion.Step(&TRACK, rotation, &displacement, &deltaYaw);
+			position += displacement;
+			rotation = Quaternion::Concatenate(Quaternion::CreateFromAxisAngle(Vector3::UnitY, deltaYaw), rotation);
+			locomotion.EndStep(position);
+		}
+
+		const Vector3 RENDER_POSITION = locomotion.GetRenderPosition();
+		maxRenderSpeed = fmaxf(maxRenderSpeed, (RENDER_POSITION - prevRenderPosition).Length() / deltaTime);
+		prevRenderPosition = RENDER_POSITION;
+	}
+
+	*pOutPosition = locomotion.GetPosition();
+	*pOutRotation = rotation;
+	*pOutMaxRenderSpeed = maxRenderSpeed;
+}
+
+static int TestFrameRateIndependence()
+{
+	AnimationClip clip;
+	MakeWalkClip(&clip);
+	RootMotionTrack track;
+	ExtractRootMotion(clip, GetRootToModel(), &track);
+
+	// step ϳ ִ ̵ ӵ. ׸ ġ ̺  Ƥ .
+	float maxStepSpeed = 0.0f;
+	for (UINT64 i = 0; i < track.DeltaPositions.size(); ++i)
+	{
+		maxStepSpeed = fmaxf(maxStepSpeed, track.DeltaPositions[i].Length() * (float)track.TicksPerSec);
+	}
+
+	Vector3 referencePosition;
+	Quaternion referenceRotation;
+	float maxRenderSpeed;
+	RunLocomotion(track, FrameTiming_30Hz, &referencePosition, &referenceRotation, &maxRenderSpeed);
+	TEST_CHECK(maxRenderSpeed <= maxStepSpeed * 1.01f);
+	//  .
+	TEST_CHECK((referencePosition - Vector3(1.0f, 2.0f, 3.0f)).Length() > 1.0f);
+
+	for (int timing = FrameTiming_60Hz; timing < FrameTiming_Count; ++timing)
+	{
+		Vector3 position;
+		Quaternion rotation;
+		RunLocomotion(track, (eFrameTiming)timing, &position, &rotation, &maxRenderSpeed);
+		TEST_CHECK(memcmp(&position, &referencePosition, sizeof(Vector3)) == 0);
+		TEST_CHECK(memcmp(&rotation, &referenceRotation, sizeof(Quaternion)) == 0);
+
+		//  frame ѵ(8 step) Ѵ frame ð Ƿ ӵ  .
+		if (timing != FrameTiming_Jitter)
+		{
+			TEST_CHECK(maxRenderSpeed <= maxStepSpeed * 1.01f);
+		}
+	}
+	return 0;
+}
+
+//  frame ѵŭ stepϰ  ð .
+static int TestStepLimit()
+{
+	LocomotionIntegrator locomotion;
+	locomotion.Initialize(FIXED_STEP, 8, Vector3());
+	TEST_CHECK(locomotion.BeginFrame(1.0f) == 8);
+	TEST_CHECK(locomotion.BeginFrame(FIXED_STEP) == 1);
+	TEST_CHECK(locomotion.BeginFrame(0.0f) == 0);
+	TEST_CHECK(locomotion.BeginFrame(-1.0f) == 0);
+
+	// track   0 step  .
+	Vector3 displacement(1.0f);
+	float deltaYaw = 1.0f;
+	locomotion.Step(nullptr, Quaternion(), &displacement, &deltaYaw);
+	TEST_CHECK(displacement == Vector3(0.0f) && deltaYaw == 0.0f);
+	TEST_CHECK(locomotion.GetStepCount() == 1);
+	return 0;
+}
+
+int main()
+{
+	if (TestExtract() || TestSampleSplit() || TestFrameRateIndependence() || TestStepLimit())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("RootMotionTest passed\n");
+	return 0;
+}
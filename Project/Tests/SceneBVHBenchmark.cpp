@@ -0,0 +1,90 @@
+#include "../pch.h"
+#include "../Graphics/SceneBVH.h"
+#include "CullingReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+// ü  10k~1M SceneBVH build/refit/query ð ü ü SIMD ˻ϴ FrustumCuller .
+// ü е  ϰ( ũ⸦ ø) camera frustum ϳ query.
+
+static void RunScene(UINT objectCount, UINT repeatCount)
+{
+	const float WORLD_SIZE = 200.0f * cbrtf((float)objectCount / 10000.0f);
+
+	std::vector<CullingBounds> bounds(objectCount);
+	MakeRandomBounds(bounds.data(), objectCount, WORLD_SIZE, 12345);
+
+	Frustum frustum;
+	ExtractFrustumPlanes(MakeViewProjection(Vector3(0.0f, 2.0f, 0.0f), 0.3f, DirectX::XM_PIDIV2, 16.0f / 9.0f, 0.1f, 150.0f), &frustum);
+
+	SceneBVH bvh;
+	bvh.Initialize(objectCount);
+	FrustumCuller flatCuller;
+	flatCuller.Initialize(objectCount);
+	for (const CullingBounds& BOUNDS : bounds)
+	{
+		SceneBounds sceneBounds;
+		sceneBounds.Center = BOUNDS.Center;
+		sceneBounds.Radius = BOUNDS.Radius;
+		sceneBounds.Extents = BOUNDS.Extents;
+		bvh.SetObjectBounds((UINT)(&BOUNDS - bounds.data()), sceneBounds);
+		flatCuller.AddBounds(BOUNDS.Center, BOUNDS.Radius, BOUNDS.Extents);
+	}
+
+	TestTimer timer;
+	bvh.Build(objectCount);
+	const double BUILD_MS = timer.GetElapsedMS();
+
+	// 1% ݾ ̴ .
+	UINT seed = 7;
+	timer.Reset();
+	for (UINT i = 0; i < objectCount / 100; ++i)
+	{
+		UINT objectIndex = NextCullingRandom(&seed) % objectCount;
+		SceneBounds sceneBounds;
+		sceneBounds.Center = bounds[objectIndex].Center + Vector3(NextCullingRandomFloat(&seed, -0.5f, 0.5f), 0.0f, NextCullingRandomFloat(&seed, -0.5f, 0.5f));
+		sceneBounds.Radius = bounds[objectIndex].Radius;
+		sceneBounds.Extents = bounds[objectIndex].Extents;
+		bvh.Refit(objectIndex, sceneBounds);
+		flatCuller.SetBounds(objectIndex, sceneBounds.Center, sceneBounds.Radius, sceneBounds.Extents);
+	}
+	const double REFIT_MS = timer.GetElapsedMS();
+
+	std::vector<BYTE> visibility(objectCount);
+	UINT bvhVisibleCount = 0;
+	timer.Reset();
+	for (UINT i = 0; i < repeatCount; ++i)
+	{
+		bvhVisibleCount = bvh.QueryFrustum(&frustum, 1, visibility.data());
+	}
+	const double BVH_QUERY_MS = timer.GetElapsedMS() / repeatCount;
+
+	UINT flatVisibleCount = 0;
+	timer.Reset();
+	for (UINT i = 0; i < repeatCount; ++i)
+	{
+		flatVisibleCount = flatCuller.Cull(&frustum, 1, visibility.data());
+	}
+	const double FLAT_QUERY_MS = timer.GetElapsedMS() / repeatCount;
+
+	printf("%8u objects  build %8.2f ms  refit 1%% %6.3f ms  visible %5u/%5u  bvh query %7.3f ms  flat SIMD %7.3f ms  %6.1fx\n",
+		   objectCount, BUILD_MS, REFIT_MS, bvhVisibleCount, flatVisibleCount, BVH_QUERY_MS, FLAT_QUERY_MS, FLAT_QUERY_MS / BVH_QUERY_MS);
+}
+
+int main(int argc, char** argv)
+{
+	if (IsSmokeRun(argc, argv))
+	{
+		RunScene(10000, 1);
+	}
+	else
+	{
+		const UINT pObjectCounts[] = { 10000, 100000, 1000000 };
+		for (UINT objectCount : pObjectCounts)
+		{
+			RunScene(objectCount, 20);
+		}
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	return 0;
+}
@@ -0,0 +1,153 @@
+#include "../pch.h"
+#include "../Graphics/SceneBVH.h"
+#include "CullingReference.h"
+#include "TestCommon.h"
+#include <algorithm>
+#include <vector>
+
+static SceneBounds ToSceneBounds(const CullingBounds& BOUNDS)
+{
+	SceneBounds sceneBounds;
+	sceneBounds.Center = BOUNDS.Center;
+	sceneBounds.Radius = BOUNDS.Radius;
+	sceneBounds.Extents = BOUNDS.Extents;
+	return sceneBounds;
+}
+
+static float SquaredDistanceToBoxReference(const Vector3& POINT, const Vector3& MIN, const Vector3& MAX)
+{
+	const Vector3 CLAMPED = Vector3::Max(MIN, Vector3::Min(POINT, MAX));
+	return Vector3::DistanceSquared(POINT, CLAMPED);
+}
+
+// ü ü ȸϴ   BVH query  .
+static int CheckQueries(SceneBVH* pBVH, const std::vector<CullingBounds>& BOUNDS, const Frustum* pFRUSTUMS, UINT* pSeed)
+{
+	const UINT OBJECT_COUNT = (UINT)BOUNDS.size();
+	std::vector<BYTE> bvhVisibility(OBJECT_COUNT);
+	std::vector<BYTE> referenceVisibility(OBJECT_COUNT);
+
+	const UINT pFrustumCounts[] = { 1, MAX_CULLING_FRUSTUM_COUNT };
+	for (UINT frustumCount : pFrustumCounts)
+	{
+		UINT bvhCount = pBVH->QueryFrustum(pFRUSTUMS, frustumCount, bvhVisibility.data());
+		UINT referenceCount = CullScalar(BOUNDS.data(), OBJECT_COUNT, pFRUSTUMS, frustumCount, referenceVisibility.data());
+		TEST_CHECK(bvhCount == referenceCount);
+		TEST_CHECK(bvhVisibility == referenceVisibility);
+	}
+
+	// point light ó sphere query. sphere, AABB    .
+	const Vector3 SPHERE_CENTER(NextCullingRandomFloat(pSeed, -100.0f, 100.0f), 0.0f, NextCullingRandomFloat(pSeed, -100.0f, 100.0f));
+	const float SPHERE_RADIUS = 30.0f;
+	UINT bvhCount = pBVH->QuerySphere(SPHERE_CENTER, SPHERE_RADIUS, bvhVisibility.data());
+	UINT referenceCount = 0;
+	for (UINT i = 0; i < OBJECT_COUNT; ++i)
+	{
+		const CullingBounds& B = BOUNDS[i];
+		const float RADIUS_SUM = B.Radius + SPHERE_RADIUS;
+		bool bHit = (Vector3::DistanceSquared(B.Center, SPHERE_CENTER) <= RADIUS_SUM * RADIUS_SUM &&
+					 SquaredDistanceToBoxReference(SPHERE_CENTER, B.Center - B.Extents, B.Center + B.Extents) <= SPHERE_RADIUS * SPHERE_RADIUS);
+		TEST_CHECK(bvhVisibility[i] == (bHit ? 1 : 0));
+		referenceCount += (bHit ? 1 : 0);
+	}
+	TEST_CHECK(bvhCount == referenceCount);
+
+	// picking ray.  sphere  ü  ƾ .
+	const Vector3 RAY_ORIGIN(-250.0f, NextCullingRandomFloat(pSeed, -5.0f, 5.0f), NextCullingRandomFloat(pSeed, -50.0f, 50.0f));
+	const Vector3 RAY_DIRECTION(1.0f, 0.01f, NextCullingRandomFloat(pSeed, -0.2f, 0.2f));
+	std::vector<UINT> bvhHits(OBJECT_COUNT);
+	bvhHits.resize(pBVH->QueryRay(RAY_ORIGIN, RAY_DIRECTION, 1e5f, bvhHits.data(), OBJECT_COUNT));
+
+	std::vector<UINT> referenceHits;
+	const float DIRECTION_LENGTH_SQUARE = RAY_DIRECTION.LengthSquared();
+	for (UINT i = 0; i < OBJECT_COUNT; ++i)
+	{
+		const CullingBounds& B = BOUNDS[i];
+		const Vector3 M = RAY_ORIGIN - B.Center;
+		float b = M.Dot(RAY_DIRECTION);
+		float c = M.LengthSquared() - B.Radius * B.Radius;
+		if ((c > 0.0f && b > 0.0f) || b * b - DIRECTION_LENGTH_SQUARE * c < 0.0f)
+		{
+			continue;
+		}
+		referenceHits.push_back(i);
+	}
+	std::sort(bvhHits.begin(), bvhHits.end());
+	TEST_CHECK(bvhHits == referenceHits);
+	return 0;
+}
+
+static int TestBuildRefitRebuild()
+{
+	const UINT OBJECT_COUNT = 20000;
+
+	std::vector<CullingBounds> bounds(OBJECT_COUNT);
+	MakeRandomBounds(bounds.data(), OBJECT_COUNT, 200.0f, 4242);
+
+	Frustum pFrustums[MAX_CULLING_FRUSTUM_COUNT];
+	for (UINT f = 0; f < MAX_CULLING_FRUSTUM_COUNT; ++f)
+	{
+		ExtractFrustumPlanes(MakeViewProjection(Vector3(10.0f * f, 2.0f, -5.0f), 1.1f * f, DirectX::XM_PIDIV2, 1.0f, 0.1f, 120.0f), &pFrustums[f]);
+	}
+
+	SceneBVH bvh;
+	bvh.Initialize(OBJECT_COUNT);
+	for (UINT i = 0; i < OBJECT_COUNT; ++i)
+	{
+		bvh.SetObjectBounds(i, ToSceneBounds(bounds[i]));
+	}
+	bvh.Build(OBJECT_COUNT);
+	TEST_CHECK(bvh.GetObjectCount() == OBJECT_COUNT);
+	TEST_CHECK(!bvh.NeedsRebuild());
+
+	UINT seed = 99;
+	if (CheckQueries(&bvh, bounds, pFrustums, &seed))
+	{
+		return 1;
+	}
+
+	//   5% ̸ refit.     ƾ ϰ,   rebuild ûؾ .
+	bool bRebuildRequested = false;
+	for (UINT frame = 0; frame < 40; ++frame)
+	{
+		for (UINT i = 0; i < OBJECT_COUNT / 20; ++i)
+		{
+			UINT objectIndex = NextCullingRandom(&seed) % OBJECT_COUNT;
+			bounds[objectIndex].Center += Vector3(NextCullingRandomFloat(&seed, -20.0f, 20.0f), NextCullingRandomFloat(&seed, -20.0f, 20.0f), NextCullingRandomFloat(&seed, -20.0f, 20.0f));
+			bvh.Refit(objectIndex, ToSceneBounds(bounds[objectIndex]));
+		}
+		if (CheckQueries(&bvh, bounds, pFrustums, &seed))
+		{
+			fprintf(stderr, "after refit frame %u\n", frame);
+			return 1;
+		}
+
+		if (bvh.NeedsRebuild())
+		{
+			bRebuildRequested = true;
+			for (UINT i = 0; i < OBJECT_COUNT; ++i)
+			{
+				bvh.SetObjectBounds(i, ToSceneBounds(bounds[i]));
+			}
+			bvh.Build(OBJECT_COUNT);
+			TEST_CHECK(!bvh.NeedsRebuild());
+			if (CheckQueries(&bvh, bounds, pFrustums, &seed))
+			{
+				return 1;
+			}
+		}
+	}
+	TEST_CHECK(bRebuildRequested);
+	return 0;
+}
+
+int main()
+{
+	if (TestBuildRefitRebuild())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("SceneBVHTest passed\n");
+	return 0;
+}
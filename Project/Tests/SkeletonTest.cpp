@@ -0,0 +1,323 @@
+#include "../pch.h"
+#include "../Model/Skeleton.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <algorithm>
+
+//  ( ,  )  (rest ȸ), ũ, bone ID , ̸ namespace ٸ  skeleton.
+// source clip target Ű  bone ̴ ȸ(   global ȸ) ƾ ϰ,
+//  target rest  + source rest  * ũ ̾ .
+
+static const UINT TREE_BONE_COUNT = 40;
+static const UINT CLIP_KEY_COUNT = 5;
+static const float TARGET_SCALE = 1.3f;
+static const float ROTATION_EPSILON = 2e-7f; // 1 - |dot|.
+static const float POSITION_EPSILON = 1e-5f;
+
+//  .   ID  skeleton ٸ.
+struct BoneTree
+{
+	std::vector<std::vector<UINT>> Children;
+	std::vector<int> Parents;
+	std::vector<Vector3> Offsets;			// θ ̴ frame  .
+	std::vector<Quaternion> PoseRotations;	// θ  ̴ rest ȸ.
+	std::vector<Quaternion> GlobalPoses;	// root .
+};
+
+static float RotationError(const Quaternion& A, const Quaternion& B)
+{
+	return 1.0f - fminf(1.0f, fabsf(A.Dot(B)));
+}
+
+static Quaternion Inverse(const Quaternion& Q)
+{
+	Quaternion inverse;
+	Q.Inverse(inverse);
+	return inverse;
+}
+
+static void MakeBoneTree(BoneTree* pOutTree, UINT* pSeed)
+{
+	pOutTree->Children.assign(TREE_BONE_COUNT, std::vector<UINT>());
+	pOutTree->Parents.assign(TREE_BONE_COUNT, -1);
+	pOutTree->Offsets.resize(TREE_BONE_COUNT);
+	pOutTree->PoseRotations.resize(TREE_BONE_COUNT);
+	pOutTree->GlobalPoses.resize(TREE_BONE_COUNT);
+	for (UINT bone = 0; bone < TREE_BONE_COUNT; ++bone)
+	{
+		if (bone > 0)
+		{
+			const UINT PARENT = NextAnimationRandom(pSeed) % bone;
+			pOutTree->Parents[bone] = (int)PARENT;
+			pOutTree->Children[PARENT].push_back(bone);
+		}
+		pOutTree->Offsets[bone] = Vector3(NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f));
+		pOutTree->PoseRotations[bone] = MakeRandomRotation(pSeed, 1.0f);
+
+		const int PARENT_ID = pOutTree->Parents[bone];
+		pOutTree->GlobalPoses[bone] = (PARENT_ID < 0 ? pOutTree->PoseRotations[bone] : Quaternion::Concatenate(pOutTree->GlobalPoses[PARENT_ID], pOutTree->PoseRotations[bone]));
+	}
+}
+
+// Ʈ (θ ) ID ű rest node transform ä.
+// rest global ȸ = ̴ ȸ *  .
+static void BuildAnimationData(const BoneTree& TREE, const std::vector<Quaternion>& JOINT_ORIENTS, const std::string& NAME_PREFIX, bool bReverseChildren, float scale,
+							   AnimationData* pOutData, std::vector<int>* pOutBoneToID)
+{
+	pOutData->BoneIDToNames.assign(TREE_BONE_COUNT, "");
+	pOutData->BoneParents.assign(TREE_BONE_COUNT, -1);
+	pOutData->NodeTransforms.assign(TREE_BONE_COUNT, Matrix());
+	pOutBoneToID->assign(TREE_BONE_COUNT, -1);
+
+	std::vector<UINT> stack(1, 0);
+	int nextID = 0;
+	while (!stack.empty())
+	{
+		const UINT BONE = stack.back();
+		stack.pop_back();
+
+		const int ID = nextID++;
+		const int PARENT = TREE.Parents[BONE];
+		(*pOutBoneToID)[BONE] = ID;
+		pOutData->BoneIDToNames[ID] = NAME_PREFIX + "Bone" + std::to_string(BONE);
+		pOutData->BoneParents[ID] = (PARENT < 0 ? -1 : (*pOutBoneToID)[PARENT]);
+
+		const Quaternion GLOBAL_REST = Quaternion::Concatenate(TREE.GlobalPoses[BONE], JOINT_ORIENTS[BONE]);
+		Quaternion localRest = GLOBAL_REST;
+		Vector3 localPosition(0.0f, scale, 0.0f);
+		if (PARENT >= 0)
+		{
+			const Quaternion INVERSE_PARENT_REST = Inverse(Quaternion::Concatenate(TREE.GlobalPoses[PARENT], JOINT_ORIENTS[PARENT]));
+			localRest = Quaternion::Concatenate(INVERSE_PARENT_REST, GLOBAL_REST);
+			localPosition = Vector3::Transform(Vector3::Transform(TREE.Offsets[BONE], TREE.GlobalPoses[PARENT]), INVERSE_PARENT_REST) * scale;
+		}
+		pOutData->NodeTransforms[ID] = Matrix::CreateFromQuaternion(localRest) * Matrix::CreateTranslation(localPosition);
+
+		//  켱.   ID  ٲ.
+		std::vector<UINT> children = TREE.Children[BONE];
+		if (!bReverseChildren)
+		{
+			std::reverse(children.begin(), children.end());
+		}
+		stack.insert(stack.end(), children.begin(), children.end());
+	}
+	_ASSERT(nextID == (int)TREE_BONE_COUNT);
+}
+
+// rest ó  ̴ clip.
+static void MakeSourceClip(const Skeleton& SOURCE, AnimationClip* pOutClip, UINT* pSeed)
+{
+	const UINT BONE_COUNT = SOURCE.GetBoneCount();
+	pOutClip->Name = "retarget";
+	pOutClip->Duration = CLIP_KEY_COUNT - 1;
+	pOutClip->TicksPerSec = 30.0;
+	pOutClip->Keys.assign(BONE_COUNT, std::vector<AnimationClip::Key>());
+	for (UINT boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		for (UINT k = 0; k < CLIP_KEY_COUNT; ++k)
+		{
+			AnimationClip::Key key;
+			key.Rotation = Quaternion::Concatenate(SOURCE.RestRotations[boneID], MakeRandomRotation(pSeed, 1.0f));
+			key.Position = SOURCE.RestPositions[boneID] + Vector3(NextAnimationRandomFloat(pSeed, -0.05f, 0.05f), NextAnimationRandomFloat(pSeed, -0.05f, 0.05f), NextAnimationRandomFloat(pSeed, -0.05f, 0.05f));
+			key.Time = (double)k;
+			pOutClip->Keys[boneID].push_back(key);
+		}
+	}
+}
+
+// key K global ȸ, ġ.
+static void AccumulateKey(const AnimationClip& CLIP, const std::vector<int>& PARENTS, UINT k, std::vector<Quaternion>* pOutRotations, std::vector<Vector3>* pOutPositions)
+{
+	const UINT64 BONE_COUNT = PARENTS.size();
+	pOutRotations->resize(BONE_COUNT);
+	pOutPositions->resize(BONE_COUNT);
+	for (UINT64 boneID = 0; boneID < BONE_COUNT; ++boneID)
+	{
+		const AnimationClip::Key& KEY = CLIP.Keys[boneID][k];
+		const int PARENT_ID = PARENTS[boneID];
+		if (PARENT_ID < 0)
+		{
+			(*pOutRotations)[boneID] = KEY.Rotation;
+			(*pOutPositions)[boneID] = KEY.Position;
+		}
+		else
+		{
+			(*pOutRotations)[boneID] = Quaternion::Concatenate((*pOutRotations)[PARENT_ID], KEY.Rotation);
+			(*pOutPositions)[boneID] = (*pOutPositions)[PARENT_ID] + Vector3::Transform(KEY.Position, (*pOutRotations)[PARENT_ID]);
+		}
+	}
+}
+
+static int TestFindBone()
+{
+	AnimationData data;
+	data.BoneIDToNames = { "mixamorig:Hips", "mixamorig:Spine", "a:Hand", "b:Hand" };
+	data.BoneParents = { -1, 0, 1, 1 };
+	data.NodeTransforms.assign(4, Matrix());
+
+	Skeleton skeleton;
+	skeleton.Initialize(data);
+	TEST_CHECK(skeleton.FindBone("mixamorig:Spine") == 1);
+	// namespace ޶ ':'  ̸ ã.
+	TEST_CHECK(skeleton.FindBone("Spine") == 1);
+	TEST_CHECK(skeleton.FindBone("other:mixamorig:Hips") == 0);
+	// Ȯ ̸ ã, ª ̸ ġ  ã.
+	TEST_CHECK(skeleton.FindBone("b:Hand") == 3);
+	TEST_CHECK(skeleton.FindBone("Hand") == -1);
+	TEST_CHECK(skeleton.FindBone("Head") == -1);
+	return 0;
+}
+
+static int TestRetarget()
+{
+	UINT seed = 3;
+	BoneTree tree;
+	MakeBoneTree(&tree, &seed);
+
+	std::vector<Quaternion> sourceOrients(TREE_BONE_COUNT);
+	std::vector<Quaternion> targetOrients(TREE_BONE_COUNT);
+	for (UINT bone = 0; bone < TREE_BONE_COUNT; ++bone)
+	{
+		sourceOrients[bone] = MakeRandomRotation(&seed, DirectX::XM_PI);
+		targetOrients[bone] = MakeRandomRotation(&seed, DirectX::XM_PI);
+	}
+
+	AnimationData sourceData;
+	AnimationData targetData;
+	std::vector<int> sourceIDs;
+	std::vector<int> targetIDs;
+	BuildAnimationData(tree, sourceOrients, "mixamorig:", false, 1.0f, &sourceData, &sourceIDs);
+	BuildAnimationData(tree, targetOrients, "mixamorig:mixamorig:", true, TARGET_SCALE, &targetData, &targetIDs);
+
+	Skeleton source;
+	Skeleton target;
+	source.Initialize(sourceData);
+	target.Initialize(targetData);
+
+	SkeletonRemap remap;
+	TEST_CHECK(BuildSkeletonRemap(source, target, &remap));
+	TEST_CHECK(remap.MatchedBoneCount == TREE_BONE_COUNT);
+	TEST_CHECK(fabsf(remap.TranslationScale - TARGET_SCALE) <= 1e-4f);
+	for (UINT bone = 0; bone < TREE_BONE_COUNT; ++bone)
+	{
+		TEST_CHECK(remap.SourceToTarget[sourceIDs[bone]] == targetIDs[bone]);
+		TEST_CHECK(remap.TargetToSource[targetIDs[bone]] == sourceIDs[bone]);
+	}
+
+	AnimationClip sourceClip;
+	MakeSourceClip(source, &sourceClip, &seed);
+	AnimationClip targetClip;
+	RetargetClip(sourceClip, source, target, remap, &targetClip);
+	TEST_CHECK(targetClip.Keys.size() == TREE_BONE_COUNT);
+	TEST_CHECK(targetClip.NumChannels == (int)TREE_BONE_COUNT);
+
+	float maxRotationError = 0.0f;
+	float maxPositionError = 0.0f;
+	for (UINT k = 0; k < CLIP_KEY_COUNT; ++k)
+	{
+		std::vector<Quaternion> sourceRotations;
+		std::vector<Quaternion> targetRotations;
+		std::vector<Vector3> sourcePositions;
+		std::vector<Vector3> targetPositions;
+		AccumulateKey(sourceClip, source.BoneParents, k, &sourceRotations, &sourcePositions);
+		AccumulateKey(targetClip, target.BoneParents, k, &targetRotations, &targetPositions);
+
+		for (UINT bone = 0; bone < TREE_BONE_COUNT; ++bone)
+		{
+			const int SOURCE_ID = sourceIDs[bone];
+			const int TARGET_ID = targetIDs[bone];
+
+			//     ȸ.
+			const Quaternion SOURCE_VISUAL = Quaternion::Concatenate(sourceRotations[SOURCE_ID], Inverse(sourceOrients[bone]));
+			const Quaternion TARGET_VISUAL = Quaternion::Concatenate(targetRotations[TARGET_ID], Inverse(targetOrients[bone]));
+			maxRotationError = fmaxf(maxRotationError, RotationError(SOURCE_VISUAL, TARGET_VISUAL));
+
+			const int PARENT = tree.Parents[bone];
+			if (PARENT >= 0)
+			{
+				const Vector3 SOURCE_BONE = sourcePositions[SOURCE_ID] - sourcePositions[sourceIDs[PARENT]];
+				const Vector3 TARGET_BONE = targetPositions[TARGET_ID] - targetPositions[targetIDs[PARENT]];
+				const Vector3 REST_BONE = Vector3::Transform(tree.Offsets[bone], tree.GlobalPoses[PARENT]);
+				const Vector3 EXPECTED = REST_BONE * TARGET_SCALE + (SOURCE_BONE - REST_BONE) * remap.TranslationScale;
+				maxPositionError = fmaxf(maxPositionError, (TARGET_BONE - EXPECTED).Length());
+			}
+		}
+	}
+	TEST_CHECK(maxRotationError <= ROTATION_EPSILON);
+	TEST_CHECK(maxPositionError <= POSITION_EPSILON);
+
+	//  skeleton̸ key ״.
+	SkeletonRemap identityRemap;
+	TEST_CHECK(BuildSkeletonRemap(source, source, &identityRemap));
+	TEST_CHECK(identityRemap.TranslationScale == 1.0f);
+	AnimationClip sameClip;
+	RetargetClip(sourceClip, source, source, identityRemap, &sameClip);
+	for (UINT boneID = 0; boneID < TREE_BONE_COUNT; ++boneID)
+	{
+		TEST_CHECK(sameClip.Keys[boneID].size() == CLIP_KEY_COUNT);
+		for (UINT k = 0; k < CLIP_KEY_COUNT; ++k)
+		{
+			const AnimationClip::Key& EXPECTED = sourceClip.Keys[boneID][k];
+			const AnimationClip::Key& ACTUAL = sameClip.Keys[boneID][k];
+			TEST_CHECK(RotationError(EXPECTED.Rotation, ACTUAL.Rotation) <= ROTATION_EPSILON);
+			TEST_CHECK((EXPECTED.Position - ACTUAL.Position).Length() <= POSITION_EPSILON);
+			TEST_CHECK(EXPECTED.Scale == ACTUAL.Scale);
+			TEST_CHECK(EXPECTED.Time == ACTUAL.Time);
+		}
+	}
+	return 0;
+}
+
+// source  target bone rest key ϳ. root  remap .
+static int TestMissingBones()
+{
+	AnimationData sourceData;
+	sourceData.BoneIDToNames = { "Hips", "Spine" };
+	sourceData.BoneParents = { -1, 0 };
+	sourceData.NodeTransforms = { Matrix::CreateTranslation(Vector3(0.0f, 1.0f, 0.0f)), Matrix::CreateTranslation(Vector3(0.0f, 0.2f, 0.0f)) };
+
+	AnimationData targetData;
+	targetData.BoneIDToNames = { "x:Hips", "x:Spine", "x:Tail" };
+	targetData.BoneParents = { -1, 0, 0 };
+	targetData.NodeTransforms = { Matrix::CreateTranslation(Vector3(0.0f, 1.0f, 0.0f)), Matrix::CreateTranslation(Vector3(0.0f, 0.2f, 0.0f)),
+								  Matrix::CreateFromQuaternion(Quaternion::CreateFromAxisAngle(Vector3::UnitX, 0.5f)) * Matrix::CreateTranslation(Vector3(0.0f, 0.0f, -0.3f)) };
+
+	Skeleton source;
+	Skeleton target;
+	source.Initialize(sourceData);
+	target.Initialize(targetData);
+
+	SkeletonRemap remap;
+	TEST_CHECK(BuildSkeletonRemap(source, target, &remap));
+	TEST_CHECK(remap.MatchedBoneCount == 2);
+	TEST_CHECK(remap.TargetToSource[2] == -1);
+
+	UINT seed = 8;
+	AnimationClip sourceClip;
+	MakeSourceClip(source, &sourceClip, &seed);
+	AnimationClip targetClip;
+	RetargetClip(sourceClip, source, target, remap, &targetClip);
+	TEST_CHECK(targetClip.NumChannels == 2);
+	TEST_CHECK(targetClip.Keys[1].size() == CLIP_KEY_COUNT);
+	TEST_CHECK(targetClip.Keys[2].size() == 1);
+	TEST_CHECK(RotationError(targetClip.Keys[2][0].Rotation, target.RestRotations[2]) <= ROTATION_EPSILON);
+	TEST_CHECK((targetClip.Keys[2][0].Position - target.RestPositions[2]).Length() <= POSITION_EPSILON);
+
+	// ̸    root .
+	targetData.BoneIDToNames = { "Pelvis", "Chest", "Tail" };
+	target.Initialize(targetData);
+	TEST_CHECK(!BuildSkeletonRemap(source, target, &remap));
+	TEST_CHECK(remap.MatchedBoneCount == 0);
+	return 0;
+}
+
+int main()
+{
+	if (TestFindBone() || TestRetarget() || TestMissingBones())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("SkeletonTest passed\n");
+	return 0;
+}
@@ -0,0 +1,169 @@
+#include "../pch.h"
+#include "../Renderer/SkinningPaletteAllocator.h"
+#include "TestCommon.h"
+#include <vector>
+
+static int TestInvalidSize()
+{
+	SkinningPaletteAllocator allocator;
+	allocator.Initialize(256, 3);
+
+	UINT offset;
+	TEST_CHECK(!allocator.Alloc(0, &offset));
+	TEST_CHECK(!allocator.Alloc(257, &offset));
+	TEST_CHECK(allocator.GetUsedMatrixCount() == 0);
+
+	TEST_CHECK(allocator.Alloc(256, &offset) && offset == 0);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 0);
+	TEST_CHECK(!allocator.Alloc(1, &offset));
+
+	// frame  capacity .
+	TEST_CHECK(allocator.GetElementOffset(0, 10) == 10);
+	TEST_CHECK(allocator.GetElementOffset(2, 10) == 2 * 256 + 10);
+	return 0;
+}
+
+// տ ó ´ . ڿ   ´  ־  ڸ.
+static int TestFirstFit()
+{
+	SkinningPaletteAllocator allocator;
+	allocator.Initialize(1000, 1);
+
+	UINT pOffsets[5];
+	for (UINT i = 0; i < 5; ++i)
+	{
+		TEST_CHECK(allocator.Alloc(100, &pOffsets[i]) && pOffsets[i] == i * 100);
+	}
+
+	// [100, 200)  [300, 400)  ,   [500, 1000).
+	allocator.Free(pOffsets[1], 100);
+	allocator.Free(pOffsets[3], 100);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 3);
+
+	UINT offset;
+	TEST_CHECK(allocator.Alloc(60, &offset) && offset == 100);
+	TEST_CHECK(allocator.Alloc(60, &offset) && offset == 300);
+	TEST_CHECK(allocator.Alloc(40, &offset) && offset == 160);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 2);
+	TEST_CHECK(allocator.Alloc(200, &offset) && offset == 500);
+	TEST_CHECK(allocator.GetUsedMatrixCount() == 300 + 60 + 60 + 40 + 200);
+	return 0;
+}
+
+// ȯ  , ,    .
+static int TestMerge()
+{
+	SkinningPaletteAllocator allocator;
+	allocator.Initialize(500, 1);
+
+	UINT pOffsets[5];
+	for (UINT i = 0; i < 5; ++i)
+	{
+		TEST_CHECK(allocator.Alloc(100, &pOffsets[i]));
+	}
+	TEST_CHECK(allocator.GetFreeRangeCount() == 0);
+
+	// ̿ .
+	allocator.Free(pOffsets[1], 100);
+	allocator.Free(pOffsets[3], 100);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 2);
+
+	// ʰ  [100, 400) ϳ.
+	allocator.Free(pOffsets[2], 100);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 1);
+	UINT offset;
+	TEST_CHECK(allocator.Alloc(300, &offset) && offset == 100);
+	allocator.Free(100, 300);
+
+	//   ħ.
+	allocator.Free(pOffsets[0], 100);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 1);
+	//   ħ.  ȯϸ óó  .
+	allocator.Free(pOffsets[4], 100);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 1);
+	TEST_CHECK(allocator.GetUsedMatrixCount() == 0);
+	TEST_CHECK(allocator.Alloc(500, &offset) && offset == 0);
+	return 0;
+}
+
+struct LivePalette
+{
+	UINT Offset;
+	UINT Count;
+};
+
+//  Alloc/Free 200k.  ִ  ġ ʰ 뷮 հ ƾ .  ȯϸ  .
+static int TestRandom()
+{
+	const UINT CAPACITY = 4096;
+	SkinningPaletteAllocator allocator;
+	allocator.Initialize(CAPACITY, 3);
+
+	std::vector<LivePalette> livePalettes;
+	std::vector<BYTE> usedMatrices(CAPACITY, 0);
+	UINT usedCount = 0;
+	UINT failCount = 0;
+	UINT seed = 1;
+	for (UINT step = 0; step < 200000; ++step)
+	{
+		seed = seed * 1664525 + 1013904223;
+		if (livePalettes.empty() || (seed >> 16) % 2)
+		{
+			// ĳ bone  .
+			const UINT COUNT = 1 + (seed >> 8) % 130;
+			UINT offset;
+			if (!allocator.Alloc(COUNT, &offset))
+			{
+				++failCount;
+				continue;
+			}
+			TEST_CHECK(offset + COUNT <= CAPACITY);
+			for (UINT i = offset; i < offset + COUNT; ++i)
+			{
+				TEST_CHECK(usedMatrices[i] == 0);
+				usedMatrices[i] = 1;
+			}
+			livePalettes.push_back({ offset, COUNT });
+			usedCount += COUNT;
+		}
+		else
+		{
+			const UINT INDEX = (seed >> 8) % (UINT)livePalettes.size();
+			const LivePalette PALETTE = livePalettes[INDEX];
+			livePalettes[INDEX] = livePalettes.back();
+			livePalettes.pop_back();
+
+			for (UINT i = PALETTE.Offset; i < PALETTE.Offset + PALETTE.Count; ++i)
+			{
+				usedMatrices[i] = 0;
+			}
+			allocator.Free(PALETTE.Offset, PALETTE.Count);
+			usedCount -= PALETTE.Count;
+		}
+		TEST_CHECK(allocator.GetUsedMatrixCount() == usedCount);
+	}
+	//   쵵 ľ .
+	TEST_CHECK(failCount > 0);
+
+	for (const LivePalette& PALETTE : livePalettes)
+	{
+		allocator.Free(PALETTE.Offset, PALETTE.Count);
+	}
+	TEST_CHECK(allocator.GetUsedMatrixCount() == 0);
+	TEST_CHECK(allocator.GetFreeRangeCount() == 1);
+
+	UINT offset;
+	TEST_CHECK(allocator.Alloc(CAPACITY, &offset) && offset == 0);
+	return 0;
+}
+
+int main()
+{
+	if (TestInvalidSize() || TestFirstFit() || TestMerge() || TestRandom())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("SkinningPaletteAllocatorTest passed\n");
+	return 0;
+}
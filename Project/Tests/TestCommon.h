@@ -0,0 +1,39 @@
+#pragma once
+
+// ׽Ʈ/ġũ  .
+
+#include <chrono>
+
+#define TEST_CHECK(expr)																\
+		if (!(expr))																	\
+		{																				\
+			fprintf(stderr, "%s(%d): check failed: %s\n", __FILE__, __LINE__, #expr);	\
+			return 1;																	\
+		}
+
+#define TEST_CHECK_NO_DEBUG_BREAK() TEST_CHECK(g_DebugBreakCount == 0)
+
+class TestTimer
+{
+public:
+	TestTimer() { Reset(); }
+
+	inline void Reset() { m_Start = std::chrono::steady_clock::now(); }
+	inline double GetElapsedMS() { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Start).count(); }
+
+private:
+	std::chrono::steady_clock::time_point m_Start;
+};
+
+// ġũ ctest "--smoke" ũ⸦ ٿ  ڵ尡  ʰԸ Ȯ.
+inline bool IsSmokeRun(int argc, char** argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "--smoke"))
+		{
+			return true;
+		}
+	}
+	return false;
+}
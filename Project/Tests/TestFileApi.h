@@ -0,0 +1,305 @@
+#pragma once
+
+// HEADLESS_TEST  Win32  API κ . CookedAssetó  mapϴ   ͸ .
+// CreateFileMapping/MapViewOfFile mmap, δ UTF-8 ٲ POSIX ȣ.
+// HANDLE fd  TestFileHandle. mapping handle fd dup  handle    .
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+typedef wchar_t WCHAR;
+typedef int32_t HRESULT;
+typedef void* HANDLE;
+
+#define S_OK ((HRESULT)0)
+#define E_FAIL ((HRESULT)0x80004005)
+#define E_OUTOFMEMORY ((HRESULT)0x8007000E)
+#define E_INVALIDARG ((HRESULT)0x80070057)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+#define HRESULT_FROM_WIN32(x) ((HRESULT)(x) <= 0 ? (HRESULT)(x) : (HRESULT)(((x) & 0x0000FFFF) | 0x80070000))
+
+#define ERROR_FILE_NOT_FOUND 2L
+#define ERROR_ACCESS_DENIED 5L
+#define ERROR_GEN_FAILURE 31L
+#define ERROR_FILE_EXISTS 80L
+
+#define INVALID_HANDLE_VALUE ((HANDLE)(intptr_t)-1)
+#define GENERIC_READ 0x80000000L
+#define GENERIC_WRITE 0x40000000L
+#define FILE_SHARE_READ 0x00000001
+#define CREATE_NEW 1
+#define CREATE_ALWAYS 2
+#define OPEN_EXISTING 3
+#define OPEN_ALWAYS 4
+#define FILE_ATTRIBUTE_NORMAL 0x00000080
+#define FILE_FLAG_SEQUENTIAL_SCAN 0x08000000
+#define PAGE_READONLY 0x02
+#define FILE_MAP_READ 0x0004
+#define MOVEFILE_REPLACE_EXISTING 0x00000001
+
+union LARGE_INTEGER
+{
+	LONG64 QuadPart;
+};
+
+struct TestFileHandle
+{
+	int FD;
+};
+
+//   Win32  ڵ. errno ٲ.
+inline thread_local DWORD g_TestLastError = 0;
+
+inline DWORD GetLastError()
+{
+	return g_TestLastError;
+}
+
+inline void SetTestLastErrorFromErrno()
+{
+	switch (errno)
+	{
+		case ENOENT:
+			g_TestLastError = ERROR_FILE_NOT_FOUND;
+			break;
+		case EACCES:
+		case EPERM:
+			g_TestLastError = ERROR_ACCESS_DENIED;
+			break;
+		case EEXIST:
+			g_TestLastError = ERROR_FILE_EXISTS;
+			break;
+		default:
+			g_TestLastError = ERROR_GEN_FAILURE;
+			break;
+	}
+}
+
+// wchar_t UTF-32.
+inline std::string ConvertTestPathToUTF8(const WCHAR* pszPath)
+{
+	std::string result;
+	for (const WCHAR* pCH = pszPath; *pCH; ++pCH)
+	{
+		const uint32_t CODE = (uint32_t)*pCH;
+		if (CODE < 0x80)
+		{
+			result.push_back((char)CODE);
+		}
+		else if (CODE < 0x800)
+		{
+			result.push_back((char)(0xC0 | (CODE >> 6)));
+			result.push_back((char)(0x80 | (CODE & 0x3F)));
+		}
+		else if (CODE < 0x10000)
+		{
+			result.push_back((char)(0xE0 | (CODE >> 12)));
+			result.push_back((char)(0x80 | ((CODE >> 6) & 0x3F)));
+			result.push_back((char)(0x80 | (CODE & 0x3F)));
+		}
+		else
+		{
+			result.push_back((char)(0xF0 | (CODE >> 18)));
+			result.push_back((char)(0x80 | ((CODE >> 12) & 0x3F)));
+			result.push_back((char)(0x80 | ((CODE >> 6) & 0x3F)));
+			result.push_back((char)(0x80 | (CODE & 0x3F)));
+		}
+	}
+	return result;
+}
+
+inline HANDLE CreateTestFileHandle(int fd)
+{
+	TestFileHandle* pHandle = new TestFileHandle;
+	pHandle->FD = fd;
+	return (HANDLE)pHandle;
+}
+
+inline int GetTestFileDescriptor(HANDLE hFile)
+{
+	return ((TestFileHandle*)hFile)->FD;
+}
+
+//  , Ӽ, flag .
+inline HANDLE CreateFileW(const WCHAR* pszFileName, DWORD desiredAccess, DWORD shareMode, void* pSecurityAttributes, DWORD creationDisposition, DWORD flagsAndAttributes, HANDLE hTemplateFile)
+{
+	int flags = 0;
+	if ((desiredAccess & GENERIC_READ) && (desiredAccess & GENERIC_WRITE))
+	{
+		flags = O_RDWR;
+	}
+	else
+	{
+		flags = ((desiredAccess & GENERIC_WRITE) ? O_WRONLY : O_RDONLY);
+	}
+
+	switch (creationDisposition)
+	{
+		case CREATE_NEW:
+			flags |= O_CREAT | O_EXCL;
+			break;
+		case CREATE_ALWAYS:
+			flags |= O_CREAT | O_TRUNC;
+			break;
+		case OPEN_ALWAYS:
+			flags |= O_CREAT;
+			break;
+		default:
+			break;
+	}
+
+	const int FD = open(ConvertTestPathToUTF8(pszFileName).c_str(), flags | O_CLOEXEC, 0644);
+	if (FD < 0)
+	{
+		SetTestLastErrorFromErrno();
+		return INVALID_HANDLE_VALUE;
+	}
+	return CreateTestFileHandle(FD);
+}
+
+inline BOOL GetFileSizeEx(HANDLE hFile, LARGE_INTEGER* pFileSize)
+{
+	struct stat fileStat;
+	if (fstat(GetTestFileDescriptor(hFile), &fileStat) != 0)
+	{
+		SetTestLastErrorFromErrno();
+		return FALSE;
+	}
+	pFileSize->QuadPart = (LONG64)fileStat.st_size;
+	return TRUE;
+}
+
+inline BOOL WriteFile(HANDLE hFile, const void* pBuffer, DWORD numberOfBytesToWrite, DWORD* pNumberOfBytesWritten, void* pOverlapped)
+{
+	const BYTE* pSRC = (const BYTE*)pBuffer;
+	DWORD written = 0;
+	while (written < numberOfBytesToWrite)
+	{
+		const ssize_t RESULT = write(GetTestFileDescriptor(hFile), pSRC + written, numberOfBytesToWrite - written);
+		if (RESULT < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			SetTestLastErrorFromErrno();
+			*pNumberOfBytesWritten = written;
+			return FALSE;
+		}
+		written += (DWORD)RESULT;
+	}
+	*pNumberOfBytesWritten = written;
+	return TRUE;
+}
+
+// ũ 0( ü) .  map MapViewOfFile.
+inline HANDLE CreateFileMappingW(HANDLE hFile, void* pAttributes, DWORD protect, DWORD maximumSizeHigh, DWORD maximumSizeLow, const WCHAR* pszName)
+{
+	_ASSERT(protect == PAGE_READONLY && maximumSizeHigh == 0 && maximumSizeLow == 0);
+
+	const int FD = fcntl(GetTestFileDescriptor(hFile), F_DUPFD_CLOEXEC, 0);
+	if (FD < 0)
+	{
+		SetTestLastErrorFromErrno();
+		return nullptr;
+	}
+	return CreateTestFileHandle(FD);
+}
+
+// munmap ũⰡ ʿϹǷ map ּҺ .
+inline std::mutex g_TestMappedViewLock;
+inline std::unordered_map<const void*, size_t> g_TestMappedViewSizes;
+
+inline void* MapViewOfFile(HANDLE hFileMapping, DWORD desiredAccess, DWORD fileOffsetHigh, DWORD fileOffsetLow, size_t numberOfBytesToMap)
+{
+	_ASSERT(desiredAccess == FILE_MAP_READ && fileOffsetHigh == 0 && fileOffsetLow == 0);
+
+	const int FD = GetTestFileDescriptor(hFileMapping);
+	size_t size = numberOfBytesToMap;
+	if (size == 0)
+	{
+		struct stat fileStat;
+		if (fstat(FD, &fileStat) != 0)
+		{
+			SetTestLastErrorFromErrno();
+			return nullptr;
+		}
+		size = (size_t)fileStat.st_size;
+	}
+
+	void* pView = mmap(nullptr, size, PROT_READ, MAP_SHARED, FD, 0);
+	if (pView == MAP_FAILED)
+	{
+		SetTestLastErrorFromErrno();
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(g_TestMappedViewLock);
+	g_TestMappedViewSizes[pView] = size;
+	return pView;
+}
+
+inline BOOL UnmapViewOfFile(const void* pBaseAddress)
+{
+	size_t size;
+	{
+		std::lock_guard<std::mutex> lock(g_TestMappedViewLock);
+		auto iter = g_TestMappedViewSizes.find(pBaseAddress);
+		if (iter == g_TestMappedViewSizes.end())
+		{
+			g_TestLastError = ERROR_GEN_FAILURE;
+			return FALSE;
+		}
+		size = iter->second;
+		g_TestMappedViewSizes.erase(iter);
+	}
+	return (munmap((void*)pBaseAddress, size) == 0 ? TRUE : FALSE);
+}
+
+inline BOOL CloseHandle(HANDLE hObject)
+{
+	if (hObject == nullptr || hObject == INVALID_HANDLE_VALUE)
+	{
+		g_TestLastError = ERROR_GEN_FAILURE;
+		return FALSE;
+	}
+
+	TestFileHandle* pHandle = (TestFileHandle*)hObject;
+	const int RESULT = close(pHandle->FD);
+	delete pHandle;
+	return (RESULT == 0 ? TRUE : FALSE);
+}
+
+inline BOOL MoveFileExW(const WCHAR* pszExistingFileName, const WCHAR* pszNewFileName, DWORD flags)
+{
+	const std::string NEW_PATH = ConvertTestPathToUTF8(pszNewFileName);
+	if (!(flags & MOVEFILE_REPLACE_EXISTING) && access(NEW_PATH.c_str(), F_OK) == 0)
+	{
+		g_TestLastError = ERROR_FILE_EXISTS;
+		return FALSE;
+	}
+	if (rename(ConvertTestPathToUTF8(pszExistingFileName).c_str(), NEW_PATH.c_str()) != 0)
+	{
+		SetTestLastErrorFromErrno();
+		return FALSE;
+	}
+	return TRUE;
+}
+
+inline BOOL DeleteFileW(const WCHAR* pszFileName)
+{
+	if (unlink(ConvertTestPathToUTF8(pszFileName).c_str()) != 0)
+	{
+		SetTestLastErrorFromErrno();
+		return FALSE;
+	}
+	return TRUE;
+}
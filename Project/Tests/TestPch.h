@@ -0,0 +1,72 @@
+#pragma once
+
+// HEADLESS_TEST  pch ü. Win32 Ÿ/ũ  ÷    ͸ .
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+
+typedef unsigned char BYTE;
+typedef unsigned char UCHAR;
+typedef short INT16;
+typedef unsigned short UINT16;
+typedef unsigned short USHORT;
+typedef int INT;
+typedef unsigned int UINT;
+typedef int32_t LONG;
+typedef uint32_t ULONG;
+typedef uint32_t DWORD;
+typedef long long LONG64;
+typedef unsigned long long UINT64; // Win32  %llu .
+typedef int BOOL;
+
+#ifndef TRUE
+#define TRUE 1
+#define FALSE 0
+#endif
+
+// Release  ˻簡  ʵ assert   ó.
+inline void TestAssertFailed(const char* pszExpr, const char* pszFile, int line)
+{
+	fprintf(stderr, "%s(%d): assertion failed: %s\n", pszFile, line, pszExpr);
+	abort();
+}
+#define _ASSERT(expr) ((expr) ? (void)0 : TestAssertFailed(#expr, __FILE__, __LINE__))
+
+// __debugbreak ߴ ʰ Ƚ .  ׽Ʈ  Ƚ ˻.
+inline int g_DebugBreakCount = 0;
+#define __debugbreak() (++g_DebugBreakCount)
+
+#define ZeroMemory(p, size) memset((p), 0, (size))
+#define sprintf_s snprintf
+
+// debugger   stderr.
+inline void OutputDebugStringA(const char* pszString)
+{
+	fputs(pszString, stderr);
+}
+
+// aligned_alloc size alignment  .
+inline void* _aligned_malloc(size_t size, size_t alignment)
+{
+	return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+inline void _aligned_free(void* pMemory)
+{
+	free(pMemory);
+}
+
+inline UINT64 _rotl64(UINT64 value, int shift)
+{
+	shift &= 63;
+	return (shift ? (value << shift) | (value >> (64 - shift)) : value);
+}
+
+// CreateFileW, CreateFileMappingW   API.
+#include "TestFileApi.h"
+
+//  pchó  enum ⼭ .
+#include "../Graphics/EnumType.h"
@@ -0,0 +1,178 @@
+#include "../pch.h"
+#include "../Renderer/UploadRetireQueue.h"
+#include "TestCommon.h"
+#include <vector>
+
+//  resource  Ƿ и Ǵ ¥ pointer.
+static ID3D12Resource* FakeResource(UINT id)
+{
+	return (ID3D12Resource*)(size_t)(0x1000 + id * 16);
+}
+
+// allocator   ,    allocator  allocator   batch ticket ٷ .
+static int TestBatchRotation()
+{
+	UploadRetireQueue retireQueue;
+	for (UINT i = 0; i < MAX_UPLOAD_BATCH_COUNT; ++i)
+	{
+		TEST_CHECK(retireQueue.GetCurBatchIndex() == i);
+		TEST_CHECK(retireQueue.GetCurBatchTicket() == 0);
+		retireQueue.FinishBatch(10 + i);
+	}
+	for (UINT i = 0; i < MAX_UPLOAD_BATCH_COUNT * 2; ++i)
+	{
+		TEST_CHECK(retireQueue.GetCurBatchIndex() == i % MAX_UPLOAD_BATCH_COUNT);
+		TEST_CHECK(retireQueue.GetCurBatchTicket() == 10 + i);
+		retireQueue.FinishBatch(10 + MAX_UPLOAD_BATCH_COUNT + i);
+	}
+
+	retireQueue.Cleanup();
+	TEST_CHECK(retireQueue.GetCurBatchIndex() == 0);
+	TEST_CHECK(retireQueue.GetCurBatchTicket() == 0);
+	return 0;
+}
+
+// buffer ڱⰡ  batch ǰ  ticket     .
+static int TestLargeBufferWaitsForTicket()
+{
+	UploadRetireQueue retireQueue;
+	TEST_CHECK(retireQueue.PushLargeBuffer(FakeResource(0)));
+
+	//  batch  ʾǷ ticket  .
+	TEST_CHECK(retireQueue.PopCompletedLargeBuffer(0xffffffffffffffffull) == nullptr);
+
+	retireQueue.FinishBatch(5);
+	TEST_CHECK(retireQueue.PushLargeBuffer(FakeResource(1)));
+	TEST_CHECK(retireQueue.PopCompletedLargeBuffer(4) == nullptr);
+
+	// FakeResource(1)  batch ̹Ƿ ticket 5δ  .
+	TEST_CHECK(retireQueue.PopCompletedLargeBuffer(5) == FakeResource(0));
+	TEST_CHECK(retireQueue.PopCompletedLargeBuffer(5) == nullptr);
+	TEST_CHECK(retireQueue.GetLargeBufferCount() == 1);
+
+	retireQueue.FinishBatch(6);
+	TEST_CHECK(retireQueue.PopCompletedLargeBuffer(5) == nullptr);
+	TEST_CHECK(retireQueue.PopCompletedLargeBuffer(6) == FakeResource(1));
+	TEST_CHECK(retireQueue.GetLargeBufferCount() == 0);
+	return 0;
+}
+
+//   Push ϰ,     buffer    ־ .
+static int TestLargeBufferFull()
+{
+	UploadRetireQueue retireQueue;
+	for (UINT i = 0; i < MAX_LARGE_UPLOAD_BUFFER_COUNT; ++i)
+	{
+		TEST_CHECK(retireQueue.PushLargeBuffer(FakeResource(i)));
+		if (i == MAX_LARGE_UPLOAD_BUFFER_COUNT / 2)
+		{
+			retireQueue.FinishBatch(1);
+		}
+	}
+	TEST_CHECK(!retireQueue.PushLargeBuffer(FakeResource(MAX_LARGE_UPLOAD_BUFFER_COUNT)));
+
+	UINT poppedMask = 0;
+	ID3D12Resource* pResource = nullptr;
+	while ((pResource = retireQueue.PopLargeBuffer()) != nullptr)
+	{
+		const UINT ID = (UINT)(((size_t)pResource - 0x1000) / 16);
+		TEST_CHECK(ID < MAX_LARGE_UPLOAD_BUFFER_COUNT);
+		TEST_CHECK((poppedMask & (1 << ID)) == 0);
+		poppedMask |= (1 << ID);
+	}
+	TEST_CHECK(poppedMask == (1 << MAX_LARGE_UPLOAD_BUFFER_COUNT) - 1);
+	TEST_CHECK(retireQueue.GetLargeBufferCount() == 0);
+	return 0;
+}
+
+// UploadManageró Push, FinishBatch, ʰ  completed ticket Retire .  buffer  , ticket  ڿ ; .
+static int TestRandom()
+{
+	struct LiveBuffer
+	{
+		UINT Id;
+		UINT64 Ticket;
+	};
+
+	UploadRetireQueue retireQueue;
+	std::vector<LiveBuffer> liveBuffers;
+	UINT seed = 1;
+	UINT nextId = 0;
+	UINT64 ticket = 0;
+	UINT64 completedTicket = 0;
+	UINT poppedCount = 0;
+
+	for (UINT step = 0; step < 20000; ++step)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const UINT ACTION = (seed >> 8) % 4;
+		if (ACTION == 0 && retireQueue.GetLargeBufferCount() < MAX_LARGE_UPLOAD_BUFFER_COUNT)
+		{
+			TEST_CHECK(retireQueue.PushLargeBuffer(FakeResource(nextId)));
+			liveBuffers.push_back({ nextId, 0 });
+			++nextId;
+		}
+		else if (ACTION == 1)
+		{
+			retireQueue.FinishBatch(++ticket);
+			for (LiveBuffer& buffer : liveBuffers)
+			{
+				if (buffer.Ticket == 0)
+				{
+					buffer.Ticket = ticket;
+				}
+			}
+		}
+		else if (ACTION == 2 && completedTicket < ticket)
+		{
+			++completedTicket;
+		}
+		else
+		{
+			ID3D12Resource* pResource = nullptr;
+			while ((pResource = retireQueue.PopCompletedLargeBuffer(completedTicket)) != nullptr)
+			{
+				const UINT ID = (UINT)(((size_t)pResource - 0x1000) / 16);
+				bool bFound = false;
+				for (UINT64 i = 0, size = liveBuffers.size(); i < size; ++i)
+				{
+					if (liveBuffers[i].Id != ID)
+					{
+						continue;
+					}
+					TEST_CHECK(liveBuffers[i].Ticket != 0 && liveBuffers[i].Ticket <= completedTicket);
+					liveBuffers.erase(liveBuffers.begin() + i);
+					bFound = true;
+					break;
+				}
+				TEST_CHECK(bFound);
+				++poppedCount;
+			}
+			for (const LiveBuffer& BUFFER : liveBuffers)
+			{
+				TEST_CHECK(BUFFER.Ticket == 0 || BUFFER.Ticket > completedTicket);
+			}
+		}
+		TEST_CHECK(retireQueue.GetLargeBufferCount() == liveBuffers.size());
+	}
+
+	retireQueue.FinishBatch(++ticket);
+	while (retireQueue.PopCompletedLargeBuffer(ticket) != nullptr)
+	{
+		++poppedCount;
+	}
+	TEST_CHECK(poppedCount == nextId);
+	TEST_CHECK(retireQueue.GetLargeBufferCount() == 0);
+	return 0;
+}
+
+int main()
+{
+	if (TestBatchRotation() || TestLargeBufferWaitsForTicket() || TestLargeBufferFull() || TestRandom())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("UploadRetireQueueTest passed\n");
+	return 0;
+}
@@ -0,0 +1,237 @@
+#include "../pch.h"
+#include "../Renderer/UploadRingAllocator.h"
+#include "TestCommon.h"
+#include <vector>
+
+static int TestInvalidSize()
+{
+	UploadRingAllocator ring;
+	ring.Initialize(1024);
+
+	UINT64 offset;
+	TEST_CHECK(!ring.Alloc(0, 1, &offset));
+	TEST_CHECK(!ring.Alloc(1025, 1, &offset));
+	TEST_CHECK(ring.GetUsedSize() == 0);
+
+	// alignment  ġ и. и ŭ 뷮 .
+	TEST_CHECK(ring.Alloc(1, 1, &offset) && offset == 0);
+	TEST_CHECK(ring.Alloc(16, 256, &offset) && offset == 256);
+	TEST_CHECK(ring.GetUsedSize() == 272);
+	return 0;
+}
+
+//    ڶ  0 .     ȯ  Բ ȯ.
+static int TestWrap()
+{
+	UploadRingAllocator ring;
+	ring.Initialize(1024);
+
+	UINT64 offset;
+	TEST_CHECK(ring.Alloc(400, 1, &offset) && offset == 0);
+	TEST_CHECK(ring.Alloc(400, 1, &offset) && offset == 400);
+	ring.FinishFrame(1);
+	TEST_CHECK(ring.Alloc(100, 1, &offset) && offset == 800);
+	ring.FinishFrame(2);
+
+	// head տ   124byteδ ڶ  ư .
+	TEST_CHECK(!ring.Alloc(300, 1, &offset));
+
+	ring.Retire(1);
+	TEST_CHECK(ring.GetUsedSize() == 100);
+	TEST_CHECK(ring.GetPendingFrameCount() == 1);
+
+	TEST_CHECK(ring.Alloc(300, 1, &offset) && offset == 0);
+	TEST_CHECK(ring.GetUsedSize() == 100 + 124 + 300);
+
+	//    ¿   [tail, head) .
+	TEST_CHECK(!ring.Alloc(501, 1, &offset));
+	TEST_CHECK(ring.Alloc(500, 1, &offset) && offset == 300);
+	TEST_CHECK(ring.GetUsedSize() == 1024);
+	ring.FinishFrame(3);
+
+	ring.Retire(2);
+	TEST_CHECK(ring.GetUsedSize() == 124 + 300 + 500);
+	ring.Retire(3);
+	TEST_CHECK(ring.GetUsedSize() == 0);
+	TEST_CHECK(ring.GetPendingFrameCount() == 0);
+	return 0;
+}
+
+static int TestFull()
+{
+	UploadRingAllocator ring;
+	ring.Initialize(1024);
+
+	UINT64 offset;
+	TEST_CHECK(ring.Alloc(1024, 256, &offset) && offset == 0);
+	TEST_CHECK(!ring.Alloc(1, 1, &offset));
+	ring.FinishFrame(1);
+	TEST_CHECK(!ring.Alloc(1, 1, &offset));
+
+	// GPU   ȯ .
+	ring.Retire(0);
+	TEST_CHECK(!ring.Alloc(1, 1, &offset));
+
+	ring.Retire(1);
+	TEST_CHECK(ring.GetUsedSize() == 0);
+	TEST_CHECK(ring.Alloc(1024, 256, &offset) && offset == 0);
+	return 0;
+}
+
+static int TestMergedFinishFrame()
+{
+	UploadRingAllocator ring;
+	ring.Initialize(1 << 20);
+
+	UINT64 offset;
+
+	//  fence     .
+	TEST_CHECK(ring.Alloc(100, 1, &offset));
+	ring.FinishFrame(5);
+	TEST_CHECK(ring.Alloc(100, 1, &offset));
+	ring.FinishFrame(5);
+	TEST_CHECK(ring.GetPendingFrameCount() == 1);
+
+	// Ҵ     .
+	ring.FinishFrame(6);
+	TEST_CHECK(ring.GetPendingFrameCount() == 1);
+
+	ring.Retire(5);
+	TEST_CHECK(ring.GetUsedSize() == 0);
+
+	//  ĭ     ġ fence ڷ ̷.
+	UINT64 fenceValue = 10;
+	for (UINT i = 0; i < MAX_UPLOAD_RING_FRAME_COUNT + 4; ++i)
+	{
+		TEST_CHECK(ring.Alloc(64, 1, &offset));
+		ring.FinishFrame(fenceValue++);
+	}
+	TEST_CHECK(ring.GetPendingFrameCount() == MAX_UPLOAD_RING_FRAME_COUNT);
+	TEST_CHECK(ring.GetUsedSize() == 64 * (MAX_UPLOAD_RING_FRAME_COUNT + 4));
+
+	//     fence  ȯ.
+	const UINT64 LAST_FENCE = fenceValue - 1;
+	ring.Retire(LAST_FENCE - 1);
+	TEST_CHECK(ring.GetPendingFrameCount() == 1);
+	TEST_CHECK(ring.GetUsedSize() == 64 * 5);
+	ring.Retire(LAST_FENCE);
+	TEST_CHECK(ring.GetPendingFrameCount() == 0);
+	TEST_CHECK(ring.GetUsedSize() == 0);
+	return 0;
+}
+
+static int TestRetireInOrder()
+{
+	UploadRingAllocator ring;
+	ring.Initialize(4096);
+
+	UINT64 offset;
+	for (UINT64 fenceValue = 1; fenceValue <= 3; ++fenceValue)
+	{
+		TEST_CHECK(ring.Alloc(fenceValue * 100, 1, &offset));
+		ring.FinishFrame(fenceValue);
+	}
+	TEST_CHECK(ring.GetUsedSize() == 600);
+
+	ring.Retire(2);
+	TEST_CHECK(ring.GetUsedSize() == 300);
+	TEST_CHECK(ring.GetPendingFrameCount() == 1);
+
+	// ̹ ȯ fence ٽ ҷ ȭ .
+	ring.Retire(2);
+	TEST_CHECK(ring.GetUsedSize() == 300);
+	return 0;
+}
+
+struct LiveRange
+{
+	UINT64 Offset;
+	UINT64 Size;
+	UINT64 FenceValue;
+};
+
+//  Alloc/FinishFrame/Retire. ִ  ġ ʾƾ ϰ,  ȯϸ 뷮 0.
+static int TestRandom()
+{
+	UINT seed = 3;
+	for (UINT trial = 0; trial < 200; ++trial)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const UINT64 CAPACITY = 256 * (1 + (seed >> 8) % 64);
+
+		UploadRingAllocator ring;
+		ring.Initialize(CAPACITY);
+
+		std::vector<LiveRange> liveRanges;
+		UINT64 fenceValue = 0;
+		UINT64 completedFenceValue = 0;
+		for (UINT step = 0; step < 5000; ++step)
+		{
+			seed = seed * 1664525 + 1013904223;
+			UINT operation = (seed >> 8) % 10;
+			if (operation < 7)
+			{
+				const UINT64 SIZE = 1 + (seed >> 12) % 700;
+				UINT64 offset;
+				if (!ring.Alloc(SIZE, 256, &offset))
+				{
+					continue;
+				}
+				TEST_CHECK(offset % 256 == 0 && offset + SIZE <= CAPACITY);
+				for (const LiveRange& RANGE : liveRanges)
+				{
+					TEST_CHECK(offset + SIZE <= RANGE.Offset || RANGE.Offset + RANGE.Size <= offset);
+				}
+				liveRanges.push_back({ offset, SIZE, 0xffffffffffffffffull });
+			}
+			else if (operation < 9)
+			{
+				++fenceValue;
+				for (LiveRange& range : liveRanges)
+				{
+					if (range.FenceValue == 0xffffffffffffffffull)
+					{
+						range.FenceValue = fenceValue;
+					}
+				}
+				ring.FinishFrame(fenceValue);
+			}
+			else
+			{
+				if (completedFenceValue < fenceValue)
+				{
+					completedFenceValue += 1 + (seed >> 12) % (fenceValue - completedFenceValue);
+				}
+				ring.Retire(completedFenceValue);
+
+				//   ʰ ȯǹǷ, ȯ  ġ ʸ Ͽ .
+				std::vector<LiveRange> stillLive;
+				for (const LiveRange& RANGE : liveRanges)
+				{
+					if (RANGE.FenceValue > completedFenceValue)
+					{
+						stillLive.push_back(RANGE);
+					}
+				}
+				liveRanges.swap(stillLive);
+			}
+		}
+
+		ring.FinishFrame(++fenceValue);
+		ring.Retire(fenceValue);
+		TEST_CHECK(ring.GetUsedSize() == 0);
+		TEST_CHECK(ring.GetPendingFrameCount() == 0);
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestInvalidSize() || TestWrap() || TestFull() || TestMergedFinishFrame() || TestRetireInOrder() || TestRandom())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("UploadRingAllocatorTest passed\n");
+	return 0;
+}
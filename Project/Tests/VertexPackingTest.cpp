@@ -0,0 +1,300 @@
+#include "../pch.h"
+#include <DirectXPackedVector.h>
+#include "../Model/VertexPacking.h"
+#include "AnimationReference.h"
+#include "TestCommon.h"
+#include <vector>
+
+//  skinned vertex 200k ϰ shaderó ؼ .
+// - weight:  Ȯ 255, ū , 0 ڴ  0(bone index 0),  bone  ū ͺ  .
+// - ġ/normal/tangent/uv  ȭ ѵ ̰ report  ġ.
+
+static const UINT VERTEX_COUNT = 200000;
+static const UINT SKELETON_BONE_COUNT = 65;
+
+// Common.hlsli DecodeOctahedron. VertexPacking.cpp  Ű .
+static Vector3 DecodeOctahedronShader(const INT16* pSRC)
+{
+	const float X = fmaxf((float)pSRC[0] / 32767.0f, -1.0f);
+	const float Y = fmaxf((float)pSRC[1] / 32767.0f, -1.0f);
+	Vector3 direction(X, Y, 1.0f - fabsf(X) - fabsf(Y));
+	const float T = fmaxf(-direction.z, 0.0f);
+	direction.x += (direction.x >= 0.0f ? -T : T);
+	direction.y += (direction.y >= 0.0f ? -T : T);
+	direction.Normalize();
+	return direction;
+}
+
+// acos 1 ó float е  atan2.
+static float GetAngle(const Vector3& A, const Vector3& B)
+{
+	return atan2f(A.Cross(B).Length(), A.Dot(B));
+}
+
+static Vector3 RandomUnitVector(UINT* pSeed)
+{
+	Vector3 dir;
+	do
+	{
+		dir = Vector3(NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f), NextAnimationRandomFloat(pSeed, -1.0f, 1.0f));
+	} while (dir.LengthSquared() < 0.01f || dir.LengthSquared() > 1.0f);
+	dir.Normalize();
+	return dir;
+}
+
+//  ũ mesh. influence 1~8,  weight     .
+static void MakeRandomVertices(std::vector<SkinnedVertex>* pOutVertices, UINT vertexCount, UINT seed)
+{
+	pOutVertices->assign(vertexCount, SkinnedVertex());
+	for (SkinnedVertex& vertex : *pOutVertices)
+	{
+		vertex.Position = Vector3(NextAnimationRandomFloat(&seed, -0.5f, 0.5f), NextAnimationRandomFloat(&seed, 0.0f, 1.8f), NextAnimationRandomFloat(&seed, -0.3f, 0.3f));
+		vertex.Normal = RandomUnitVector(&seed);
+		vertex.Tangent = RandomUnitVector(&seed);
+		vertex.Texcoord = Vector2(NextAnimationRandomFloat(&seed, 0.0f, 1.0f), NextAnimationRandomFloat(&seed, 0.0f, 1.0f));
+
+		const UINT INFLUENCE_COUNT = 1 + NextAnimationRandom(&seed) % 8;
+		float weightSum = 0.0f;
+		for (UINT i = 0; i < INFLUENCE_COUNT; ++i)
+		{
+			vertex.BlendWeights[i] = NextAnimationRandomFloat(&seed, 0.0f, 1.0f) * NextAnimationRandomFloat(&seed, 0.0f, 1.0f) + 0.001f;
+			vertex.BoneIndices[i] = (UCHAR)(NextAnimationRandom(&seed) % SKELETON_BONE_COUNT);
+			weightSum += vertex.BlendWeights[i];
+		}
+		for (UINT i = 0; i < INFLUENCE_COUNT; ++i)
+		{
+			vertex.BlendWeights[i] /= weightSum;
+		}
+	}
+}
+
+//  slot ū .   slot .
+static UINT SortSourceInfluences(const SkinnedVertex& VERTEX, UINT* pOutSlots)
+{
+	UINT count = 0;
+	for (UINT i = 0; i < 8; ++i)
+	{
+		if (VERTEX.BlendWeights[i] > 0.0f)
+		{
+			UINT j = count++;
+			while (j > 0 && VERTEX.BlendWeights[pOutSlots[j - 1]] < VERTEX.BlendWeights[i])
+			{
+				pOutSlots[j] = pOutSlots[j - 1];
+				--j;
+			}
+			pOutSlots[j] = i;
+		}
+	}
+	return count;
+}
+
+static int CheckBlendWeights(const SkinnedVertex& SRC, const PackedSkinnedVertex& PACKED, const VertexPackingSettings& SETTINGS, UINT* pOutPrunedCount)
+{
+	int weightSum = 0;
+	UINT activeCount = 0;
+	for (UINT i = 0; i < 8; ++i)
+	{
+		weightSum += PACKED.BlendWeights[i];
+		if (PACKED.BlendWeights[i] == 0)
+		{
+			TEST_CHECK(PACKED.BoneIndices[i] == 0);
+			continue;
+		}
+		TEST_CHECK(i == activeCount);
+		TEST_CHECK(i == 0 || PACKED.BlendWeights[i] <= PACKED.BlendWeights[i - 1]);
+		++activeCount;
+	}
+	TEST_CHECK(weightSum == 255);
+	TEST_CHECK(activeCount <= SETTINGS.MaxInfluenceCount);
+
+	//    influence.  ū  ׻,  MinBlendWeight ̻̰ MaxInfluenceCount.
+	UINT pSlots[8];
+	const UINT SOURCE_COUNT = SortSourceInfluences(SRC, pSlots);
+	float totalWeight = 0.0f;
+	for (UINT i = 0; i < SOURCE_COUNT; ++i)
+	{
+		totalWeight += SRC.BlendWeights[pSlots[i]];
+	}
+	UINT keptCount = 1;
+	float keptWeight = SRC.BlendWeights[pSlots[0]];
+	while (keptCount < SOURCE_COUNT && keptCount < SETTINGS.MaxInfluenceCount && SRC.BlendWeights[pSlots[keptCount]] / totalWeight >= SETTINGS.MinBlendWeight)
+	{
+		keptWeight += SRC.BlendWeights[pSlots[keptCount]];
+		++keptCount;
+	}
+	// 0 ȭ ͸ ߰   .
+	TEST_CHECK(activeCount <= keptCount);
+	*pOutPrunedCount = SOURCE_COUNT - activeCount;
+
+	//  slot   slot ϳ ¦. ݿø   ū weight Ƿ influence ŭ ߳  .
+	const float TOLERANCE = (0.5f * (float)keptCount + 0.5f) / 255.0f;
+	bool pbUsed[8] = {};
+	for (UINT i = 0; i < activeCount; ++i)
+	{
+		const float PACKED_WEIGHT = (float)PACKED.BlendWeights[i] / 255.0f;
+		bool bFound = false;
+		for (UINT k = 0; k < keptCount && !bFound; ++k)
+		{
+			const UINT SLOT = pSlots[k];
+			if (pbUsed[k] || SRC.BoneIndices[SLOT] != PACKED.BoneIndices[i] || fabsf(SRC.BlendWeights[SLOT] / keptWeight - PACKED_WEIGHT) > TOLERANCE)
+			{
+				continue;
+			}
+			pbUsed[k] = true;
+			bFound = true;
+		}
+		TEST_CHECK(bFound);
+	}
+	for (UINT k = 0; k < keptCount; ++k)
+	{
+		//   ȭϸ 0 Ǵ  weight.
+		TEST_CHECK(pbUsed[k] || SRC.BlendWeights[pSlots[k]] / keptWeight < 0.5f / 255.0f + 1e-6f);
+	}
+	return 0;
+}
+
+static int TestRandomVertices()
+{
+	std::vector<SkinnedVertex> vertices;
+	MakeRandomVertices(&vertices, VERTEX_COUNT, 7);
+
+	const UINT pMAX_INFLUENCE_COUNTS[] = { 8, 4 };
+	for (UINT maxInfluenceCount : pMAX_INFLUENCE_COUNTS)
+	{
+		VertexPackingSettings settings;
+		settings.MaxInfluenceCount = maxInfluenceCount;
+
+		std::vector<PackedSkinnedVertex> packed;
+		Vector3 positionScale;
+		Vector3 positionBias;
+		VertexPackingReport report;
+		PackSkinnedVertices(vertices, settings, &packed, &positionScale, &positionBias, &report);
+		TEST_CHECK(packed.size() == VERTEX_COUNT);
+		TEST_CHECK(report.SourceSize == (UINT64)VERTEX_COUNT * sizeof(SkinnedVertex));
+		TEST_CHECK(report.PackedSize == (UINT64)VERTEX_COUNT * sizeof(PackedSkinnedVertex));
+
+		UINT64 prunedCount = 0;
+		float maxPositionError = 0.0f;
+		float maxNormalError = 0.0f;
+		float maxTangentError = 0.0f;
+		float maxTexcoordError = 0.0f;
+		for (UINT i = 0; i < VERTEX_COUNT; ++i)
+		{
+			const SkinnedVertex& SRC = vertices[i];
+			const PackedSkinnedVertex& PACKED = packed[i];
+
+			UINT vertexPrunedCount;
+			if (CheckBlendWeights(SRC, PACKED, settings, &vertexPrunedCount))
+			{
+				fprintf(stderr, "max influence %u, vertex %u\n", maxInfluenceCount, i);
+				return 1;
+			}
+			prunedCount += vertexPrunedCount;
+
+			// ġ ึ  ĭ ̳.
+			const Vector3 DECODED_POSITION = Vector3((float)PACKED.Position[0], (float)PACKED.Position[1], (float)PACKED.Position[2]) / 65535.0f * positionScale + positionBias;
+			const Vector3 DELTA = DECODED_POSITION - SRC.Position;
+			TEST_CHECK(fabsf(DELTA.x) <= positionScale.x * 0.5f / 65535.0f + 1e-6f);
+			TEST_CHECK(fabsf(DELTA.y) <= positionScale.y * 0.5f / 65535.0f + 1e-6f);
+			TEST_CHECK(fabsf(DELTA.z) <= positionScale.z * 0.5f / 65535.0f + 1e-6f);
+			maxPositionError = fmaxf(maxPositionError, fabsf(DELTA.x) + fabsf(DELTA.y) + fabsf(DELTA.z));
+
+			maxNormalError = fmaxf(maxNormalError, GetAngle(SRC.Normal, DecodeOctahedronShader(PACKED.Normal)));
+			maxTangentError = fmaxf(maxTangentError, GetAngle(SRC.Tangent, DecodeOctahedronShader(PACKED.Tangent)));
+
+			for (UINT axis = 0; axis < 2; ++axis)
+			{
+				const float SOURCE_UV = (axis == 0 ? SRC.Texcoord.x : SRC.Texcoord.y);
+				maxTexcoordError = fmaxf(maxTexcoordError, fabsf(DirectX::PackedVector::XMConvertHalfToFloat(PACKED.Texcoord[axis]) - SOURCE_UV));
+			}
+		}
+
+		TEST_CHECK(prunedCount == report.PrunedInfluenceCount);
+		TEST_CHECK(prunedCount > 0);
+		TEST_CHECK(fabsf(maxPositionError - report.MaxPositionError) <= 1e-6f);
+		// 16bit octahedron 0.01 ̳.
+		TEST_CHECK(maxNormalError <= 0.01f * DirectX::XM_PI / 180.0f);
+		TEST_CHECK(maxTangentError <= 0.01f * DirectX::XM_PI / 180.0f);
+		TEST_CHECK(fabsf(maxNormalError - report.MaxNormalError) <= 1e-6f);
+		TEST_CHECK(fabsf(maxTangentError - report.MaxTangentError) <= 1e-6f);
+		// [0, 1] uv half  ulp(2^-12) ̳.
+		TEST_CHECK(maxTexcoordError <= 1.0f / 4096.0f);
+		TEST_CHECK(maxTexcoordError == report.MaxTexcoordError);
+	}
+	return 0;
+}
+
+//  , Ʒ ݱ, 𼭸 normal  0 ,  mesh.
+static int TestEdgeCases()
+{
+	const Vector3 pNORMALS[] = {
+		Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 0.0f, -1.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(-1.0f, 0.0f, 0.0f),
+		Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), Vector3(-0.577350f, 0.577350f, -0.577350f), Vector3(0.707107f, -0.707107f, 0.0f),
+	};
+	std::vector<SkinnedVertex> vertices(sizeof(pNORMALS) / sizeof(pNORMALS[0]));
+	for (UINT64 i = 0; i < vertices.size(); ++i)
+	{
+		vertices[i].Position = Vector3((float)i, 2.0f, 0.0f); // y, z  0.
+		vertices[i].Normal = pNORMALS[i];
+		vertices[i].Tangent = pNORMALS[(i + 1) % vertices.size()];
+		vertices[i].BlendWeights[3] = 0.3f; //  slot  ־ .
+		vertices[i].BoneIndices[3] = 12;
+	}
+
+	std::vector<PackedSkinnedVertex> packed;
+	Vector3 positionScale;
+	Vector3 positionBias;
+	VertexPackingReport report;
+	PackSkinnedVertices(vertices, VertexPackingSettings(), &packed, &positionScale, &positionBias, &report);
+	TEST_CHECK(positionScale == Vector3(7.0f, 0.0f, 0.0f) && positionBias == Vector3(0.0f, 2.0f, 0.0f));
+	TEST_CHECK(report.MaxPositionError <= 7.0f * 0.5f / 65535.0f + 1e-6f);
+	for (UINT64 i = 0; i < vertices.size(); ++i)
+	{
+		TEST_CHECK(GetAngle(pNORMALS[i], DecodeOctahedronShader(packed[i].Normal)) <= 1e-3f);
+		TEST_CHECK(packed[i].BlendWeights[0] == 255 && packed[i].BoneIndices[0] == 12);
+		TEST_CHECK(packed[i].BlendWeights[1] == 0 && packed[i].BoneIndices[3] == 0);
+	}
+
+	// weight   0.
+	vertices[0].BlendWeights[3] = 0.0f;
+	PackSkinnedVertices(vertices, VertexPackingSettings(), &packed, &positionScale, &positionBias, nullptr);
+	for (UINT i = 0; i < 8; ++i)
+	{
+		TEST_CHECK(packed[0].BlendWeights[i] == 0 && packed[0].BoneIndices[i] == 0);
+	}
+
+	vertices.clear();
+	PackSkinnedVertices(vertices, VertexPackingSettings(), &packed, &positionScale, &positionBias, &report);
+	TEST_CHECK(packed.empty() && report.PackedSize == 0);
+	TEST_CHECK(positionScale == Vector3(0.0f) && positionBias == Vector3(0.0f));
+	return 0;
+}
+
+// half ȯ shim DirectXMathó   ¦ ݿøϴ.
+static int TestHalfConversion()
+{
+	using namespace DirectX::PackedVector;
+	TEST_CHECK(XMConvertFloatToHalf(1.0f) == 0x3C00);
+	TEST_CHECK(XMConvertFloatToHalf(-2.0f) == 0xC000);
+	TEST_CHECK(XMConvertFloatToHalf(65504.0f) == 0x7BFF);
+	TEST_CHECK(XMConvertFloatToHalf(1e6f) == 0x7C00);
+	TEST_CHECK(XMConvertFloatToHalf(1.0f + 1.0f / 2048.0f) == 0x3C00); // ¦ .
+	TEST_CHECK(XMConvertFloatToHalf(1.0f + 3.0f / 2048.0f) == 0x3C02);
+	TEST_CHECK(XMConvertFloatToHalf(5.960464e-8f) == 0x0001); //    .
+	for (UINT value = 0; value < 0x7C00; ++value)
+	{
+		TEST_CHECK(XMConvertFloatToHalf(XMConvertHalfToFloat((HALF)value)) == value);
+	}
+	return 0;
+}
+
+int main()
+{
+	if (TestHalfConversion() || TestRandomVertices() || TestEdgeCases())
+	{
+		return 1;
+	}
+	TEST_CHECK_NO_DEBUG_BREAK();
+	printf("VertexPackingTest passed\n");
+	return 0;
+}
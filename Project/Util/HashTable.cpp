@@ -1,17 +1,42 @@
 #include "../pch.h"
 #include "HashTable.h"
 
+static const UINT64 HASH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const UINT64 HASH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const UINT64 HASH_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const UINT64 HASH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const UINT64 HASH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+// load factor 3/4  slot  2 ø.
+static const UINT HASH_TABLE_MAX_LOAD_NUMERATOR = 3;
+static const UINT HASH_TABLE_MAX_LOAD_DENOMINATOR = 4;
+
+static UINT NextPowerOfTwo(UINT value)
+{
+	UINT result = 16;
+	while (result < value)
+	{
+		result <<= 1;
+	}
+	return result;
+}
+
 void HashTable::Initialize(UINT maxBucketNum, UINT maxKeySize, UINT bucketNum)
 {
 	_ASSERT(maxBucketNum > 0);
 	_ASSERT(maxKeySize > 0);
 	_ASSERT(bucketNum > 0);
 
-	m_MaxBucketNum = maxBucketNum;
 	m_MaxKeyDataSize = maxKeySize;
 
-	m_pBucketTable = new Bucket[maxBucketNum];
-	ZeroMemory(m_pBucketTable, sizeof(Bucket) * maxBucketNum);
+	//  ׸ (bucketNum) load factor ȿ  ʱ slot  .
+	UINT expectedSlotNum = bucketNum * HASH_TABLE_MAX_LOAD_DENOMINATOR / HASH_TABLE_MAX_LOAD_NUMERATOR + 1;
+	UINT slotNum = NextPowerOfTwo(maxBucketNum > expectedSlotNum ? maxBucketNum : expectedSlotNum);
+
+	m_pSlotTable = (HashSlot*)malloc(sizeof(HashSlot) * slotNum);
+	ZeroMemory(m_pSlotTable, sizeof(HashSlot) * slotNum);
+	m_SlotNum = slotNum;
+	m_SlotMask = slotNum - 1;
 }
 
 UINT HashTable::Select(void** ppItemList, UINT maxItemNum, const void* pKeyData, UINT size)
@@ -20,37 +45,25 @@ UINT HashTable::Select(void** ppItemList, UINT maxItemNum, const void* pKeyData,
 	_ASSERT(pKeyData);
 
 	UINT selectedItemNum = 0;
-	UINT index = createKey(pKeyData, size, m_MaxBucketNum);
-	Bucket* pBucket = m_pBucketTable + index;
+	UINT64 hash = createKey(pKeyData, size);
+	UINT index = (UINT)hash & m_SlotMask;
 
-	ListElem* pCurBucket = pBucket->pBucketLinkHead;
-	BucketItem* pBucketItem;
-
-	while (pCurBucket)
+	//  slot   Ž.  Ű     Ƿ ߰  .
+	while (m_pSlotTable[index].pEntry && maxItemNum)
 	{
-		if (!maxItemNum)
-		{
-			break;
-		}
-
-		pBucketItem = (BucketItem*)pCurBucket->pItem;
-
-		if (pBucketItem->Size != size)
-		{
-			goto LB_NEXT;
-		}
-		if (memcmp(pBucketItem->pKeyData, pKeyData, size))
+		HashSlot* pSlot = m_pSlotTable + index;
+		if (pSlot->Hash == hash)
 		{
-			goto LB_NEXT;
+			HashEntry* pEntry = pSlot->pEntry;
+			if (pEntry->Size == size && !memcmp(pEntry->pKeyData, pKeyData, size))
+			{
+				ppItemList[selectedItemNum] = (void*)pEntry->pItem;
+				++selectedItemNum;
+				--maxItemNum;
+			}
 		}
 
-		--maxItemNum;
-
-		ppItemList[selectedItemNum] = (void*)pBucketItem->pItem;
-		++selectedItemNum;
-
-	LB_NEXT:
-		pCurBucket = pCurBucket->pNext;
+		index = (index + 1) & m_SlotMask;
 	}
 
 	return selectedItemNum;
@@ -61,63 +74,126 @@ void* HashTable::Insert(const void* pItem, const void* pKeyData, UINT size)
 	_ASSERT(pItem);
 	_ASSERT(pKeyData);
 
-	void* pSearchHandle = nullptr;
-
 	if (size > m_MaxKeyDataSize)
 	{
 		__debugbreak();
-		// goto LB_RETURN;
+		return nullptr;
 	}
 
-	UINT bucketMemSize = (UINT)(sizeof(BucketItem) - sizeof(char)) + m_MaxKeyDataSize;
-	BucketItem* pBucketItem = (BucketItem*)malloc(bucketMemSize);
+	if ((UINT64)(m_ItemNum + 1) * HASH_TABLE_MAX_LOAD_DENOMINATOR > (UINT64)m_SlotNum * HASH_TABLE_MAX_LOAD_NUMERATOR)
+	{
+		rehash(m_SlotNum * 2);
+	}
 
-	UINT index = createKey(pKeyData, size, m_MaxBucketNum);
-	Bucket* pBucket = m_pBucketTable + index;
+	HashEntry* pEntry = allocEntry();
+	pEntry->pItem = pItem;
+	pEntry->Size = size;
+	pEntry->Hash = createKey(pKeyData, size);
 
-	pBucketItem->pItem = pItem;
-	pBucketItem->Size = size;
-	pBucketItem->pBucket = pBucket;
-	pBucketItem->SortLink.pPrev = nullptr;
-	pBucketItem->SortLink.pNext = nullptr;
-	pBucketItem->SortLink.pItem = pBucketItem;
-	pBucket->LinkNum++;
+	char* pDestKeyData = pEntry->InlineKey;
+	if (size > HASH_TABLE_INLINE_KEY_SIZE)
+	{
+		pDestKeyData = allocKeyData(size);
+	}
+	memcpy(pDestKeyData, pKeyData, size);
+	pEntry->pKeyData = pDestKeyData;
 
-	memcpy(pBucketItem->pKeyData, pKeyData, size);
+	UINT index = (UINT)pEntry->Hash & m_SlotMask;
+	while (m_pSlotTable[index].pEntry)
+	{
+		index = (index + 1) & m_SlotMask;
+	}
 
-	LinkElemIntoListFIFO(&pBucket->pBucketLinkHead, &pBucket->pBucketLinkTail, &pBucketItem->SortLink);
+	m_pSlotTable[index].Hash = pEntry->Hash;
+	m_pSlotTable[index].pEntry = pEntry;
+	pEntry->SlotIndex = index;
 
 	++m_ItemNum;
-	pSearchHandle = pBucketItem;
 
-	return pSearchHandle;
+	return pEntry;
 }
 
 void HashTable::Delete(const void* pSearchHandle)
 {
 	_ASSERT(pSearchHandle);
 
-	BucketItem* pBucketItem = (BucketItem*)pSearchHandle;
-	Bucket* pBucket = pBucketItem->pBucket;
+	HashEntry* pEntry = (HashEntry*)pSearchHandle;
+	UINT hole = pEntry->SlotIndex;
+	_ASSERT(m_pSlotTable[hole].pEntry == pEntry);
+
+	// backward shift deletion. tombstone  probe ü .
+	UINT index = hole;
+	while (true)
+	{
+		index = (index + 1) & m_SlotMask;
+		HashSlot* pSlot = m_pSlotTable + index;
+		if (!pSlot->pEntry)
+		{
+			break;
+		}
 
-	UnLinkElemFromList(&pBucket->pBucketLinkHead, &pBucket->pBucketLinkTail, &pBucketItem->SortLink);
-	--(pBucket->LinkNum);
+		// home slot (hole, index]   ״ .
+		UINT home = (UINT)pSlot->Hash & m_SlotMask;
+		bool bInRange = (hole <= index ? (hole < home && home <= index) : (hole < home || home <= index));
+		if (bInRange)
+		{
+			continue;
+		}
 
-	free(pBucketItem);
+		m_pSlotTable[hole] = *pSlot;
+		m_pSlotTable[hole].pEntry->SlotIndex = hole;
+		hole = index;
+	}
+	m_pSlotTable[hole].Hash = 0;
+	m_pSlotTable[hole].pEntry = nullptr;
+
+	//  Ű  size class free list   Insert .
+	if (pEntry->Size > HASH_TABLE_INLINE_KEY_SIZE)
+	{
+		freeKeyData((char*)pEntry->pKeyData, pEntry->Size);
+	}
+	freeEntry(pEntry);
 	--m_ItemNum;
+
+	if (!m_ItemNum)
+	{
+		resetKeyArena();
+	}
+	else if (m_KeyArenaFreeSize > HASH_TABLE_KEY_ARENA_CHUNK_SIZE && m_KeyArenaFreeSize > m_KeyArenaLiveSize)
+	{
+		// ũⰡ  ʾ     ִ Ű  .
+		compactKeyArena();
+	}
 }
 
 void HashTable::DeleteAll()
 {
-	BucketItem* pBucketItem;
-	for (UINT i = 0; i < m_MaxBucketNum; ++i)
+	if (!m_pSlotTable)
+	{
+		return;
+	}
+
+	for (UINT i = 0; i < m_SlotNum; ++i)
 	{
-		while (m_pBucketTable[i].pBucketLinkHead)
+		if (m_pSlotTable[i].pEntry)
 		{
-			pBucketItem = (BucketItem*)m_pBucketTable[i].pBucketLinkHead->pItem;
-			Delete(pBucketItem);
+			freeEntry(m_pSlotTable[i].pEntry);
+			m_pSlotTable[i].Hash = 0;
+			m_pSlotTable[i].pEntry = nullptr;
+			--m_ItemNum;
 		}
 	}
+	resetKeyArena();
+}
+
+UINT HashTable::GetKeyArenaSize()
+{
+	UINT arenaSize = 0;
+	for (HashKeyArenaChunk* pChunk = m_pKeyArenaHead; pChunk; pChunk = pChunk->pNext)
+	{
+		arenaSize += pChunk->Capacity;
+	}
+	return arenaSize;
 }
 
 void HashTable::Cleanup()
@@ -125,52 +201,247 @@ void HashTable::Cleanup()
 	resourceCheck();
 
 	DeleteAll();
-	if (m_pBucketTable)
+	if (m_pSlotTable)
+	{
+		free(m_pSlotTable);
+		m_pSlotTable = nullptr;
+	}
+	m_SlotNum = 0;
+	m_SlotMask = 0;
+
+	while (m_pEntryBlockHead)
 	{
-		delete[] m_pBucketTable;
-		m_pBucketTable = nullptr;
+		HashEntryBlock* pNext = m_pEntryBlockHead->pNext;
+		delete m_pEntryBlockHead;
+		m_pEntryBlockHead = pNext;
+	}
+	m_pFreeEntryHead = nullptr;
+
+	while (m_pKeyArenaHead)
+	{
+		HashKeyArenaChunk* pNext = m_pKeyArenaHead->pNext;
+		free(m_pKeyArenaHead);
+		m_pKeyArenaHead = pNext;
 	}
 }
 
-UINT HashTable::createKey(const void* pData, UINT size, UINT bucketNum)
+UINT64 HashTable::createKey(const void* pData, UINT size)
 {
-	UINT keyData = 0;
+	// xxHash64 ª Է ο  .  ΰϹǷ  Ű 浹 .
+	const BYTE* pEntry = (const BYTE*)pData;
+	UINT64 acc = HASH_PRIME64_5 + (UINT64)size;
 
-	const char* pEntry = (char*)pData;
-	if (size & 0x00000001)
+	while (size >= 8)
 	{
-		keyData += (UINT)(*(BYTE*)pEntry);
+		UINT64 lane;
+		memcpy(&lane, pEntry, sizeof(UINT64));
+		lane *= HASH_PRIME64_2;
+		lane = _rotl64(lane, 31);
+		lane *= HASH_PRIME64_1;
+
+		acc ^= lane;
+		acc = _rotl64(acc, 27) * HASH_PRIME64_1 + HASH_PRIME64_4;
+
+		pEntry += 8;
+		size -= 8;
+	}
+	if (size >= 4)
+	{
+		UINT lane;
+		memcpy(&lane, pEntry, sizeof(UINT));
+
+		acc ^= (UINT64)lane * HASH_PRIME64_1;
+		acc = _rotl64(acc, 23) * HASH_PRIME64_2 + HASH_PRIME64_3;
+
+		pEntry += 4;
+		size -= 4;
+	}
+	while (size)
+	{
+		acc ^= (UINT64)(*pEntry) * HASH_PRIME64_5;
+		acc = _rotl64(acc, 11) * HASH_PRIME64_1;
+
 		++pEntry;
 		--size;
 	}
-	if (!size)
+
+	// avalanche.
+	acc ^= acc >> 33;
+	acc *= HASH_PRIME64_2;
+	acc ^= acc >> 29;
+	acc *= HASH_PRIME64_3;
+	acc ^= acc >> 32;
+
+	return acc;
+}
+
+void HashTable::rehash(UINT newSlotNum)
+{
+	_ASSERT(newSlotNum > m_SlotNum);
+	_ASSERT((newSlotNum & (newSlotNum - 1)) == 0);
+
+	HashSlot* pOldSlotTable = m_pSlotTable;
+	UINT oldSlotNum = m_SlotNum;
+
+	m_pSlotTable = (HashSlot*)malloc(sizeof(HashSlot) * newSlotNum);
+	ZeroMemory(m_pSlotTable, sizeof(HashSlot) * newSlotNum);
+	m_SlotNum = newSlotNum;
+	m_SlotMask = newSlotNum - 1;
+
+	// Ʈ ü ̵ Ƿ ܺ search handle ״ ȿ.
+	for (UINT i = 0; i < oldSlotNum; ++i)
 	{
-		goto LB_RETURN;
+		HashSlot* pOldSlot = pOldSlotTable + i;
+		if (!pOldSlot->pEntry)
+		{
+			continue;
+		}
+
+		UINT index = (UINT)pOldSlot->Hash & m_SlotMask;
+		while (m_pSlotTable[index].pEntry)
+		{
+			index = (index + 1) & m_SlotMask;
+		}
+		m_pSlotTable[index] = *pOldSlot;
+		pOldSlot->pEntry->SlotIndex = index;
 	}
 
+	free(pOldSlotTable);
+}
+
+HashEntry* HashTable::allocEntry()
+{
+	if (!m_pFreeEntryHead)
+	{
+		HashEntryBlock* pBlock = new HashEntryBlock;
+		ZeroMemory(pBlock, sizeof(HashEntryBlock));
+		pBlock->pNext = m_pEntryBlockHead;
+		m_pEntryBlockHead = pBlock;
+
+		for (UINT i = 0; i < HASH_TABLE_ENTRY_BLOCK_SIZE; ++i)
+		{
+			freeEntry(pBlock->Entries + i);
+		}
+	}
+
+	HashEntry* pEntry = m_pFreeEntryHead;
+	m_pFreeEntryHead = pEntry->pNextFree;
+	pEntry->pNextFree = nullptr;
+
+	return pEntry;
+}
+
+void HashTable::freeEntry(HashEntry* pEntry)
+{
+	_ASSERT(pEntry);
+
+	pEntry->pItem = nullptr;
+	pEntry->pKeyData = nullptr;
+	pEntry->Size = 0;
+	pEntry->pNextFree = m_pFreeEntryHead;
+	m_pFreeEntryHead = pEntry;
+}
+
+static UINT GetKeyFreeListIndex(UINT alignedSize)
+{
+	UINT index = alignedSize / HASH_TABLE_KEY_ARENA_ALIGN - 1;
+	return (index < HASH_TABLE_KEY_FREE_LIST_NUM ? index : HASH_TABLE_KEY_FREE_LIST_NUM - 1);
+}
+
+char* HashTable::allocKeyData(UINT size)
+{
+	//   ĵ ũⰡ Ȯ  ͸ .   entry Size  ũ⸦ ٽ   .
+	size = (size + HASH_TABLE_KEY_ARENA_ALIGN - 1) & ~(HASH_TABLE_KEY_ARENA_ALIGN - 1);
+
+	HashKeyFreeBlock** ppBlock = m_ppKeyFreeList + GetKeyFreeListIndex(size);
+	while (*ppBlock)
+	{
+		HashKeyFreeBlock* pBlock = *ppBlock;
+		if (pBlock->Size == size)
+		{
+			*ppBlock = pBlock->pNext;
+			m_KeyArenaFreeSize -= size;
+			m_KeyArenaLiveSize += size;
+			return (char*)pBlock;
+		}
+		ppBlock = &pBlock->pNext;
+	}
 
-	if (size & 0x00000002)
+	HashKeyArenaChunk* pChunk = m_pKeyArenaHead;
+	while (pChunk && pChunk->Capacity - pChunk->UsedSize < size)
 	{
-		keyData += (UINT)(*(USHORT*)pEntry);
-		pEntry += 2;
-		size -= 2;
+		pChunk = pChunk->pNext;
 	}
-	if (!size)
+
+	if (!pChunk)
 	{
-		goto LB_RETURN;
+		UINT capacity = (size > HASH_TABLE_KEY_ARENA_CHUNK_SIZE ? size : HASH_TABLE_KEY_ARENA_CHUNK_SIZE);
+		pChunk = (HashKeyArenaChunk*)malloc(sizeof(HashKeyArenaChunk) - sizeof(char) + capacity);
+		pChunk->Capacity = capacity;
+		pChunk->UsedSize = 0;
+		pChunk->pNext = m_pKeyArenaHead;
+		m_pKeyArenaHead = pChunk;
 	}
 
-	size = (size >> 2);
+	char* pKeyData = pChunk->pData + pChunk->UsedSize;
+	pChunk->UsedSize += size;
+	m_KeyArenaLiveSize += size;
+
+	return pKeyData;
+}
+
+void HashTable::freeKeyData(char* pKeyData, UINT size)
+{
+	_ASSERT(pKeyData);
+
+	size = (size + HASH_TABLE_KEY_ARENA_ALIGN - 1) & ~(HASH_TABLE_KEY_ARENA_ALIGN - 1);
 
-	for (UINT i = 0; i < size; ++i)
+	HashKeyFreeBlock* pBlock = (HashKeyFreeBlock*)pKeyData;
+	UINT index = GetKeyFreeListIndex(size);
+	pBlock->Size = size;
+	pBlock->pNext = m_ppKeyFreeList[index];
+	m_ppKeyFreeList[index] = pBlock;
+	m_KeyArenaLiveSize -= size;
+	m_KeyArenaFreeSize += size;
+}
+
+void HashTable::compactKeyArena()
+{
+	//  ִ  Ű  chunk ű  chunk . entry ̵ Ƿ search handle ״ ȿ.
+	HashKeyArenaChunk* pOldChunkHead = m_pKeyArenaHead;
+	m_pKeyArenaHead = nullptr;
+	resetKeyArena();
+
+	for (UINT i = 0; i < m_SlotNum; ++i)
 	{
-		keyData += *(UINT*)pEntry;
-		pEntry += 4;
+		HashEntry* pEntry = m_pSlotTable[i].pEntry;
+		if (!pEntry || pEntry->Size <= HASH_TABLE_INLINE_KEY_SIZE)
+		{
+			continue;
+		}
+
+		char* pKeyData = allocKeyData(pEntry->Size);
+		memcpy(pKeyData, pEntry->pKeyData, pEntry->Size);
+		pEntry->pKeyData = pKeyData;
 	}
 
-LB_RETURN:
-	UINT index = keyData % bucketNum;
-	return index;
+	while (pOldChunkHead)
+	{
+		HashKeyArenaChunk* pNext = pOldChunkHead->pNext;
+		free(pOldChunkHead);
+		pOldChunkHead = pNext;
+	}
+}
+
+void HashTable::resetKeyArena()
+{
+	for (HashKeyArenaChunk* pChunk = m_pKeyArenaHead; pChunk; pChunk = pChunk->pNext)
+	{
+		pChunk->UsedSize = 0;
+	}
+	ZeroMemory(m_ppKeyFreeList, sizeof(m_ppKeyFreeList));
+	m_KeyArenaLiveSize = 0;
+	m_KeyArenaFreeSize = 0;
 }
 
 void HashTable::resourceCheck()
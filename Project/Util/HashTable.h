@@ -1,20 +1,45 @@
 #pragma once
 
-#include "LinkedList.h"
+// open addressing(linear probing)  ؽ ̺.
+// slot 迭  ޸̸, Ʈ   Ҵ search handle ּҰ rehash Ŀ .
 
-struct Bucket
+static const UINT HASH_TABLE_INLINE_KEY_SIZE = 48;
+static const UINT HASH_TABLE_ENTRY_BLOCK_SIZE = 256;
+static const UINT HASH_TABLE_KEY_ARENA_CHUNK_SIZE = 16384;
+static const UINT HASH_TABLE_KEY_ARENA_ALIGN = 16;
+static const UINT HASH_TABLE_KEY_FREE_LIST_NUM = 64; // 16byte  size class.  list  ̻ ũ⸦  .
+
+struct HashEntry
 {
-	ListElem* pBucketLinkHead;
-	ListElem* pBucketLinkTail;
-	UINT LinkNum;
+	const void* pItem;
+	HashEntry* pNextFree;
+	const char* pKeyData; // ª Ű InlineKey,  Ű arena Ŵ.
+	UINT64 Hash;
+	UINT SlotIndex;
+	UINT Size;
+	char InlineKey[HASH_TABLE_INLINE_KEY_SIZE];
 };
-struct BucketItem
+struct HashSlot
 {
-	const void* pItem;
-	Bucket* pBucket;
-	ListElem SortLink;
+	UINT64 Hash;
+	HashEntry* pEntry; // nullptr̸  slot.
+};
+struct HashEntryBlock
+{
+	HashEntryBlock* pNext;
+	HashEntry Entries[HASH_TABLE_ENTRY_BLOCK_SIZE];
+};
+struct HashKeyArenaChunk
+{
+	HashKeyArenaChunk* pNext;
+	UINT Capacity;
+	UINT UsedSize;
+	char pData[1];
+};
+struct HashKeyFreeBlock
+{
+	HashKeyFreeBlock* pNext;
 	UINT Size;
-	char pKeyData[1];
 };
 class HashTable
 {
@@ -22,6 +47,7 @@ public:
 	HashTable() = default;
 	~HashTable() { Cleanup(); };
 
+	// maxBucketNum: ּ slot , maxKeySize:  ִ Ű ũ(byte), bucketNum:  ׸ .
 	void Initialize(UINT maxBucketNum, UINT maxKeySize, UINT bucketNum);
 
 	UINT Select(void** ppItemList, UINT maxItemNum, const void* pKeyData, UINT size);
@@ -31,14 +57,36 @@ public:
 
 	void Cleanup();
 
+	inline UINT GetItemNum() { return m_ItemNum; }
+	inline UINT GetSlotNum() { return m_SlotNum; }
+	UINT GetKeyArenaSize();
+
 protected:
-	UINT createKey(const void* pData, UINT size, UINT bucketNum);
+	UINT64 createKey(const void* pData, UINT size);
+
+	void rehash(UINT newSlotNum);
+
+	HashEntry* allocEntry();
+	void freeEntry(HashEntry* pEntry);
+	char* allocKeyData(UINT size);
+	void freeKeyData(char* pKeyData, UINT size);
+	void compactKeyArena();
+	void resetKeyArena();
 
 	void resourceCheck();
 
 private:
-	Bucket* m_pBucketTable = nullptr;
-	UINT m_MaxBucketNum = 0;
+	HashSlot* m_pSlotTable = nullptr;
+	UINT m_SlotNum = 0;
+	UINT m_SlotMask = 0;
 	UINT m_MaxKeyDataSize = 0;
 	UINT m_ItemNum = 0;
+
+	HashEntryBlock* m_pEntryBlockHead = nullptr;
+	HashEntry* m_pFreeEntryHead = nullptr;
+
+	HashKeyArenaChunk* m_pKeyArenaHead = nullptr;
+	HashKeyFreeBlock* m_ppKeyFreeList[HASH_TABLE_KEY_FREE_LIST_NUM] = {};
+	UINT m_KeyArenaLiveSize = 0;
+	UINT m_KeyArenaFreeSize = 0;
 };
@@ -9,62 +9,91 @@ IndexCreator::~IndexCreator()
 
 void IndexCreator::Initialize(ULONG num)
 {
-	m_pIndexTable = new ULONG[num];
-	ZeroMemory(m_pIndexTable, sizeof(ULONG) * num);
+	_ASSERT(num > 0);
+	_ASSERT(num < INDEX_CREATOR_INVALID_INDEX);
+
+	m_pNextTable = new std::atomic<ULONG>[num];
 	m_MaxNum = num;
 
-	for (ULONG i = 0; i < m_MaxNum; ++i)
+	// ʱ ´ 0 -> 1 -> ... -> num - 1  .
+	for (ULONG i = 0; i < m_MaxNum - 1; ++i)
 	{
-		m_pIndexTable[i] = i;
+		m_pNextTable[i].store(i + 1, std::memory_order_relaxed);
 	}
+	m_pNextTable[m_MaxNum - 1].store(INDEX_CREATOR_INVALID_INDEX, std::memory_order_relaxed);
+
+	m_Head.store(makeHead(0, 0));
+	m_AllocatedCount.store(0);
 }
 
-ULONG IndexCreator::Alloc()
+bool IndexCreator::Alloc(ULONG* pOutIndex)
 {
-	// 1. m_lAllocatedCount 1 .
-	// 2. m_lAllocatedCount-1ġ dwIndex ִ´.
-	//  ΰ ׼ ʿѵ 1 2̿ ٸ 尡 Alloc ȣϸ ̹ Ҵ ε   ߻Ѵ.
-	//  Alloc Free  ɶ ƾѴ.
-
-	ULONG result = 0xffff;
+	_ASSERT(pOutIndex);
 
-	if (m_AllocatedCount >= m_MaxNum)
+	// head CAS ü. tag Ź  pop  ٸ 尡  ε
+	// pop/pushؼ  ABA  .
+	// next ٸ  Free ÿ   ,   tag ٲ CAS .
+	UINT64 oldHead = m_Head.load();
+	UINT64 newHead;
+	ULONG index;
+	do
 	{
-		goto LB_RET;
-	}
+		index = (ULONG)(oldHead & 0xffffffff);
+		if (index == INDEX_CREATOR_INVALID_INDEX)
+		{
+			*pOutIndex = INDEX_CREATOR_INVALID_INDEX;
+			return false;
+		}
+
+		ULONG tag = (ULONG)(oldHead >> 32);
+		ULONG next = m_pNextTable[index].load(std::memory_order_relaxed);
+		newHead = makeHead(tag + 1, next);
+	} while (!m_Head.compare_exchange_weak(oldHead, newHead));
 
-	result = m_pIndexTable[m_AllocatedCount];
-	++m_AllocatedCount;
+	m_AllocatedCount.fetch_add(1);
+	*pOutIndex = index;
 
-LB_RET:
-	return result;
+	return true;
 }
 
 void IndexCreator::Free(ULONG index)
 {
-	if (!m_AllocatedCount)
+	if (index >= m_MaxNum)
 	{
 		__debugbreak();
+		return;
 	}
-	--m_AllocatedCount;
-	m_pIndexTable[m_AllocatedCount] = index;
+	if (m_AllocatedCount.fetch_sub(1) <= 0)
+	{
+		__debugbreak();
+	}
+
+	UINT64 oldHead = m_Head.load();
+	UINT64 newHead;
+	do
+	{
+		ULONG tag = (ULONG)(oldHead >> 32);
+		m_pNextTable[index].store((ULONG)(oldHead & 0xffffffff), std::memory_order_relaxed);
+		newHead = makeHead(tag + 1, index);
+	} while (!m_Head.compare_exchange_weak(oldHead, newHead));
 }
 
 void IndexCreator::Clear()
 {
 	m_MaxNum = 0;
-	m_AllocatedCount = 0;
+	m_AllocatedCount.store(0);
+	m_Head.store(makeHead(0, INDEX_CREATOR_INVALID_INDEX));
 
-	if (m_pIndexTable)
+	if (m_pNextTable)
 	{
-		delete[] m_pIndexTable;
-		m_pIndexTable = nullptr;
+		delete[] m_pNextTable;
+		m_pNextTable = nullptr;
 	}
 }
 
 void IndexCreator::Check()
 {
-	if (m_AllocatedCount)
+	if (m_AllocatedCount.load())
 	{
 		__debugbreak();
 	}
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <atomic>
+
+static const ULONG INDEX_CREATOR_INVALID_INDEX = 0xffffffff;
+
+// tagged head( 32bit: tag,  32bit: index)  lock-free free-list.
+// Alloc/Free  忡 ÿ ȣ .
 class IndexCreator
 {
 public:
@@ -8,7 +14,8 @@ public:
 
 	void Initialize(ULONG num);
 
-	ULONG Alloc();
+	//  ε Ҵ ¸ false ȯ.
+	bool Alloc(ULONG* pOutIndex);
 
 	void Free(ULONG index);
 
@@ -16,8 +23,15 @@ public:
 
 	void Check();
 
+	inline ULONG GetAllocatedCount() { return (ULONG)m_AllocatedCount.load(); }
+	inline ULONG GetMaxCount() { return m_MaxNum; }
+
+protected:
+	static inline UINT64 makeHead(ULONG tag, ULONG index) { return (((UINT64)tag << 32) | (UINT64)index); }
+
 private:
-	ULONG* m_pIndexTable = nullptr;
+	std::atomic<ULONG>* m_pNextTable = nullptr;
+	std::atomic<UINT64> m_Head{ (UINT64)INDEX_CREATOR_INVALID_INDEX };
 	ULONG m_MaxNum = 0;
-	ULONG m_AllocatedCount = 0;
+	std::atomic<LONG> m_AllocatedCount{ 0 };
 };
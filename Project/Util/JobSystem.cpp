@@ -0,0 +1,336 @@
+#include "../pch.h"
+#include "JobSystem.h"
+
+static thread_local UINT s_WorkerIndex = 0xffffffff;
+
+void JobSystem::Initialize(UINT workerThreadCount, UINT maxJobCount)
+{
+	_ASSERT(workerThreadCount <= MAX_JOB_WORKER_COUNT);
+	_ASSERT(maxJobCount > 0);
+
+	m_WorkerThreadCount = workerThreadCount;
+
+	m_pJobPool = new Job[maxJobCount]();
+	m_JobIndexCreator.Initialize(maxJobCount);
+
+	for (UINT i = 0; i <= MAX_JOB_WORKER_COUNT; ++i)
+	{
+		m_pDeques[i].Head = 0;
+		m_pDeques[i].Tail = 0;
+	}
+
+	m_bShutdown = false;
+	m_PendingJobCount = 0;
+	m_SleepingWorkerCount = 0;
+
+	// Initialize ȣ 尡 main worker.
+	s_WorkerIndex = m_WorkerThreadCount;
+
+	if (m_WorkerThreadCount)
+	{
+		m_pWorkerThreads = new std::thread[m_WorkerThreadCount];
+		for (UINT i = 0; i < m_WorkerThreadCount; ++i)
+		{
+			m_pWorkerThreads[i] = std::thread(workerThread, this, i);
+		}
+	}
+}
+
+void JobSystem::Submit(JobFunction pfnFunction, void* pArg, JobCounter* pCounter, JobCounter* pDependency)
+{
+	_ASSERT(pfnFunction);
+
+	ULONG poolIndex;
+	while (!m_JobIndexCreator.Alloc(&poolIndex))
+	{
+		// pool  á job ϳ óؼ ڸ .
+		if (!runOneJob(GetCurrentWorkerIndex()))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	Job* pJob = m_pJobPool + poolIndex;
+	pJob->pfnFunction = pfnFunction;
+	pJob->pArg = pArg;
+	pJob->pCounter = pCounter;
+	pJob->pNextWaiting = nullptr;
+	pJob->PoolIndex = poolIndex;
+
+	if (pCounter)
+	{
+		pCounter->Count.fetch_add(1);
+	}
+
+	if (pDependency)
+	{
+		std::lock_guard<std::mutex> lock(pDependency->WaitingLock);
+		if (pDependency->Count.load() > 0)
+		{
+			pJob->pNextWaiting = pDependency->pWaitingJobHead;
+			pDependency->pWaitingJobHead = pJob;
+			return;
+		}
+	}
+
+	pushJob(GetCurrentWorkerIndex(), pJob);
+}
+
+void JobSystem::WaitForCounter(JobCounter* pCounter)
+{
+	_ASSERT(pCounter);
+
+	UINT workerIndex = GetCurrentWorkerIndex();
+	while (pCounter->Count.load() > 0)
+	{
+		if (!runOneJob(workerIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	// 0  finishJob WaitingLock   ٸ. ȯ ڿ counter ϰų ص .
+	std::lock_guard<std::mutex> lock(pCounter->WaitingLock);
+}
+
+UINT JobSystem::SplitRange(UINT itemCount, UINT maxRangeCount, JobRange* pOutRanges)
+{
+	_ASSERT(maxRangeCount > 0);
+	_ASSERT(pOutRanges);
+
+	if (itemCount == 0)
+	{
+		return 0;
+	}
+
+	// worker    steal ϸ .
+	UINT rangeCount = GetWorkerCount() * JOB_RANGE_PER_WORKER;
+	rangeCount = (rangeCount > maxRangeCount ? maxRangeCount : rangeCount);
+	rangeCount = (rangeCount > itemCount ? itemCount : rangeCount);
+
+	const UINT ITEM_PER_RANGE = itemCount / rangeCount;
+	const UINT REMAINDER = itemCount % rangeCount;
+
+	UINT first = 0;
+	for (UINT i = 0; i < rangeCount; ++i)
+	{
+		pOutRanges[i].First = first;
+		pOutRanges[i].Count = ITEM_PER_RANGE + (i < REMAINDER ? 1 : 0);
+		first += pOutRanges[i].Count;
+	}
+	_ASSERT(first == itemCount);
+
+	return rangeCount;
+}
+
+void JobSystem::Cleanup()
+{
+	if (m_pWorkerThreads)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepLock);
+			m_bShutdown = true;
+		}
+		m_WakeCondition.notify_all();
+
+		for (UINT i = 0; i < m_WorkerThreadCount; ++i)
+		{
+			m_pWorkerThreads[i].join();
+		}
+		delete[] m_pWorkerThreads;
+		m_pWorkerThreads = nullptr;
+	}
+	m_WorkerThreadCount = 0;
+
+	if (m_pJobPool)
+	{
+		m_JobIndexCreator.Clear();
+		delete[] m_pJobPool;
+		m_pJobPool = nullptr;
+	}
+}
+
+UINT JobSystem::GetCurrentWorkerIndex()
+{
+	return s_WorkerIndex;
+}
+
+void JobSystem::workerThread(JobSystem* pJobSystem, UINT workerIndex)
+{
+	s_WorkerIndex = workerIndex;
+
+	while (true)
+	{
+		if (pJobSystem->runOneJob(workerIndex))
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(pJobSystem->m_SleepLock);
+		pJobSystem->m_SleepingWorkerCount.fetch_add(1);
+		pJobSystem->m_WakeCondition.wait(lock, [pJobSystem]() { return pJobSystem->m_PendingJobCount.load() > 0 || pJobSystem->m_bShutdown.load(); });
+		pJobSystem->m_SleepingWorkerCount.fetch_sub(1);
+		if (pJobSystem->m_bShutdown.load())
+		{
+			break;
+		}
+	}
+}
+
+void JobSystem::pushJob(UINT workerIndex, Job* pJob)
+{
+	// worker ƴ 忡 ִ job main deque .
+	if (workerIndex > m_WorkerThreadCount)
+	{
+		workerIndex = m_WorkerThreadCount;
+	}
+
+	JobDeque* pDeque = m_pDeques + workerIndex;
+	while (pDeque->Lock.test_and_set(std::memory_order_acquire));
+
+	bool bPushed = false;
+	UINT tail = pDeque->Tail.load(std::memory_order_relaxed);
+	if (tail - pDeque->Head.load(std::memory_order_relaxed) < JOB_DEQUE_SIZE)
+	{
+		pDeque->ppJobs[tail % JOB_DEQUE_SIZE] = pJob;
+		pDeque->Tail.store(tail + 1, std::memory_order_relaxed);
+		bPushed = true;
+	}
+	pDeque->Lock.clear(std::memory_order_release);
+
+	if (!bPushed)
+	{
+		// deque  á ٷ .
+		pJob->pfnFunction(pJob->pArg, workerIndex);
+		finishJob(workerIndex, pJob);
+		return;
+	}
+
+	//  worker   . pending  sleeping Ȯ  wake-up  .
+	m_PendingJobCount.fetch_add(1);
+	if (m_SleepingWorkerCount.load() > 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepLock);
+		}
+		m_WakeCondition.notify_one();
+	}
+}
+
+Job* JobSystem::popJob(UINT workerIndex)
+{
+	Job* pJob = nullptr;
+	JobDeque* pDeque = m_pDeques + workerIndex;
+
+	while (pDeque->Lock.test_and_set(std::memory_order_acquire));
+	UINT tail = pDeque->Tail.load(std::memory_order_relaxed);
+	if (tail != pDeque->Head.load(std::memory_order_relaxed))
+	{
+		--tail;
+		pJob = pDeque->ppJobs[tail % JOB_DEQUE_SIZE];
+		pDeque->Tail.store(tail, std::memory_order_relaxed);
+	}
+	pDeque->Lock.clear(std::memory_order_release);
+
+	return pJob;
+}
+
+Job* JobSystem::stealJob(UINT thiefIndex)
+{
+	const UINT TOTAL_WORKER_COUNT = m_WorkerThreadCount + 1;
+
+	for (UINT i = 1; i < TOTAL_WORKER_COUNT; ++i)
+	{
+		JobDeque* pDeque = m_pDeques + (thiefIndex + i) % TOTAL_WORKER_COUNT;
+		// lock   ִ Ȯ.
+		if (pDeque->Tail.load(std::memory_order_relaxed) == pDeque->Head.load(std::memory_order_relaxed))
+		{
+			continue;
+		}
+
+		Job* pJob = nullptr;
+		while (pDeque->Lock.test_and_set(std::memory_order_acquire));
+		UINT head = pDeque->Head.load(std::memory_order_relaxed);
+		if (pDeque->Tail.load(std::memory_order_relaxed) != head)
+		{
+			pJob = pDeque->ppJobs[head % JOB_DEQUE_SIZE];
+			pDeque->Head.store(head + 1, std::memory_order_relaxed);
+		}
+		pDeque->Lock.clear(std::memory_order_release);
+
+		if (pJob)
+		{
+			return pJob;
+		}
+	}
+
+	return nullptr;
+}
+
+bool JobSystem::runOneJob(UINT workerIndex)
+{
+	if (workerIndex > m_WorkerThreadCount)
+	{
+		workerIndex = m_WorkerThreadCount;
+	}
+
+	Job* pJob = popJob(workerIndex);
+	if (!pJob)
+	{
+		pJob = stealJob(workerIndex);
+	}
+	if (!pJob)
+	{
+		return false;
+	}
+
+	m_PendingJobCount.fetch_sub(1);
+
+	pJob->pfnFunction(pJob->pArg, workerIndex);
+	finishJob(workerIndex, pJob);
+
+	return true;
+}
+
+void JobSystem::finishJob(UINT workerIndex, Job* pJob)
+{
+	JobCounter* pCounter = pJob->pCounter;
+	m_JobIndexCreator.Free(pJob->PoolIndex);
+
+	if (!pCounter)
+	{
+		return;
+	}
+
+	//  Ұ ƴϸ lock  .
+	long count = pCounter->Count.load();
+	while (count > 1)
+	{
+		if (pCounter->Count.compare_exchange_weak(count, count - 1))
+		{
+			return;
+		}
+	}
+
+	//   ִ Ҵ WaitingLock ȿ . 0    и Բ ؼ
+	// Submit 0 ƴ counter job ɾٰ ġ ʰ ϰ, WaitForCounter lock  ڿ counter ǵ帮 .
+	Job* pWaitingJob = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(pCounter->WaitingLock);
+		if (pCounter->Count.fetch_sub(1) != 1)
+		{
+			return;
+		}
+		pWaitingJob = pCounter->pWaitingJobHead;
+		pCounter->pWaitingJobHead = nullptr;
+	}
+
+	// counter 0 .  ̴ job   · ȯ. ⼭ pCounter  .
+	while (pWaitingJob)
+	{
+		Job* pNext = pWaitingJob->pNextWaiting;
+		pWaitingJob->pNextWaiting = nullptr;
+		pushJob(workerIndex, pWaitingJob);
+		pWaitingJob = pNext;
+	}
+}
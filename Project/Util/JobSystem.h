@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "IndexCreator.h"
+
+// std::thread/atomic  work-stealing job system.
+// Ŀ deque ΰ, ڱ deque ڿ(LIFO)  ٸ Ŀ deque տ(FIFO) İ.
+//  JobCounter ǥ. dependency counter 0   job counter .
+
+static const UINT MAX_JOB_WORKER_COUNT = 16;
+static const UINT JOB_DEQUE_SIZE = 1024;
+static const UINT JOB_RANGE_PER_WORKER = 4;
+
+typedef void (*JobFunction)(void* pArg, UINT workerIndex);
+
+struct Job;
+struct JobCounter
+{
+	std::atomic<long> Count{ 0 };
+	std::mutex WaitingLock;
+	Job* pWaitingJobHead = nullptr;
+};
+struct Job
+{
+	JobFunction pfnFunction;
+	void* pArg;
+	JobCounter* pCounter;
+	Job* pNextWaiting;
+	ULONG PoolIndex;
+};
+struct JobRange
+{
+	UINT First;
+	UINT Count;
+};
+struct JobDeque
+{
+	std::atomic_flag Lock = ATOMIC_FLAG_INIT;
+	Job* ppJobs[JOB_DEQUE_SIZE];
+	std::atomic<UINT> Head; // steal ġ.
+	std::atomic<UINT> Tail; // push/pop ġ.
+};
+
+class JobSystem
+{
+public:
+	JobSystem() = default;
+	~JobSystem() { Cleanup(); }
+
+	// workerThreadCount 带 . ȣ (main)  worker index ϸ WaitForCounter ߿ job Բ ó.
+	void Initialize(UINT workerThreadCount, UINT maxJobCount);
+
+	// pCounter job Ϸ  , pDependency 0  ڿ job .
+	// counter /: counter  counter  WaitForCounter ȯϰų,  counter ɸ job    ־ .
+	//   ϰų ٸ 뵵   . ȯ ڿ  counter ٽ Submitص (frame ).
+	void Submit(JobFunction pfnFunction, void* pArg, JobCounter* pCounter, JobCounter* pDependency = nullptr);
+	// counter 0   job óϸ ٸ. ȯ   worker counter  .
+	void WaitForCounter(JobCounter* pCounter);
+
+	// [0, itemCount) worker JOB_RANGE_PER_WORKER    .   ϳ  .   ȯ.
+	UINT SplitRange(UINT itemCount, UINT maxRangeCount, JobRange* pOutRanges);
+
+	void Cleanup();
+
+	// main 带  ü worker .
+	inline UINT GetWorkerCount() { return m_WorkerThreadCount + 1; }
+	static UINT GetCurrentWorkerIndex();
+
+protected:
+	static void workerThread(JobSystem* pJobSystem, UINT workerIndex);
+
+	void pushJob(UINT workerIndex, Job* pJob);
+	Job* popJob(UINT workerIndex);
+	Job* stealJob(UINT thiefIndex);
+	bool runOneJob(UINT workerIndex);
+	void finishJob(UINT workerIndex, Job* pJob);
+
+private:
+	std::thread* m_pWorkerThreads = nullptr;
+	UINT m_WorkerThreadCount = 0;
+
+	JobDeque m_pDeques[MAX_JOB_WORKER_COUNT + 1];
+
+	Job* m_pJobPool = nullptr;
+	IndexCreator m_JobIndexCreator;
+
+	std::atomic<long> m_PendingJobCount{ 0 };
+	std::atomic<long> m_SleepingWorkerCount{ 0 };
+	std::mutex m_SleepLock;
+	std::condition_variable m_WakeCondition;
+	std::atomic<bool> m_bShutdown{ false };
+};
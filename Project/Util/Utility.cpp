@@ -1,6 +1,7 @@
 #include "../pch.h"
 #include "Utility.h"
 
+#ifndef HEADLESS_TEST
 typedef BOOL(WINAPI* LPFN_GLPI)(PSYSTEM_LOGICAL_PROCESSOR_INFORMATION, PDWORD);
 UINT CountSetBits(ULONG_PTR bitMask)
 {
@@ -205,6 +206,7 @@ void GetPhysicalCoreCount(UINT* pPhysicalCoreCount, UINT* pLogicalCoreCount)
 
 	free(pBuffer);
 }
+#endif
 
 std::string RemoveBasePath(const std::string& szFilePath)
 {
@@ -279,20 +281,28 @@ float Max(float x, float y)
 
 Vector3 Min(const Vector3& V1, const Vector3& V2)
 {
+#ifdef HEADLESS_TEST
+	return Vector3::Min(V1, V2);
+#else
 	DirectX::XMVECTOR v1 = DirectX::XMLoadFloat3(&V1);
 	DirectX::XMVECTOR v2 = DirectX::XMLoadFloat3(&V2);
 	DirectX::XMVECTOR ret = DirectX::XMVectorMin(v1, v2);
 
 	return Vector3(ret);
+#endif
 }
 
 Vector3 Max(const Vector3& V1, const Vector3& V2)
 {
+#ifdef HEADLESS_TEST
+	return Vector3::Max(V1, V2);
+#else
 	DirectX::XMVECTOR v1 = DirectX::XMLoadFloat3(&V1);
 	DirectX::XMVECTOR v2 = DirectX::XMLoadFloat3(&V2);
 	DirectX::XMVECTOR ret = DirectX::XMVectorMax(v1, v2);
 
 	return Vector3(ret);
+#endif
 }
 
 float Clamp(const float VAL, const float LOWER, const float UPPER)
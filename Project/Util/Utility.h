@@ -1,5 +1,11 @@
 #pragma once
 
+#ifdef HEADLESS_TEST
+#include <string>
+#include <directxtk12/SimpleMath.h>
+using DirectX::SimpleMath::Vector3;
+#endif
+
 struct Container
 {
 	UINT64 MemSize;
@@ -7,11 +13,13 @@ struct Container
 	BYTE Data[1];
 };
 
+#ifndef HEADLESS_TEST
 void GetHardwareAdapter(IDXGIFactory2* pFactory, IDXGIAdapter1** ppAdapter);
 void GetSoftwareAdapter(IDXGIFactory2* pFactory, IDXGIAdapter1** ppAdapter);
 void SetDebugLayerInfo(ID3D12Device* pD3DDevice);
 
 void GetPhysicalCoreCount(UINT* pPhysicalCoreCount, UINT* pLogicalCoreCount);
+#endif
 
 std::string RemoveBasePath(const std::string& szFilePath);
 std::wstring RemoveBasePath(const std::wstring& szFilePath);
@@ -1,5 +1,10 @@
 #pragma once
 
+#ifdef HEADLESS_TEST
+// Tests/CMakeLists.txt . Win32/D3D12  ÷  ⸸ .
+#include "Tests/TestPch.h"
+#else
+
 // required .lib files
 #pragma comment(lib, "DXGI.lib")
 #pragma comment(lib, "dxguid.lib")
@@ -12,7 +17,6 @@
 
 #include <PxPhysicsAPI.h>
 #include <fbxsdk.h>
-#include <Eigen/Dense>
 
 #ifdef _DEBUG
 #define _CRTDBG_MAP_ALLOC
@@ -66,3 +70,5 @@
 			(p)->Release(); \
 			(p) = nullptr;	\
 		}
+
+#endif // HEADLESS_TEST